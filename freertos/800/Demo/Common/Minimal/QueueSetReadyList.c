@@ -0,0 +1,596 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd. 
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+/*
+ * Tests the order in which a queue set that holds a list of its ready members
+ * (configUSE_QUEUE_SET_READY_LIST set to 1) selects those members.  Such a set
+ * does not record the order in which data was sent to different members, so the
+ * cross queue ordering checked by QueueSet.c does not hold, and this file checks
+ * the ordering the ready list does guarantee instead.
+ *
+ * The receive task first uses a private queue set, which no other task or
+ * interrupt accesses, to check that a member that still holds items after being
+ * selected goes behind the members that were already ready, so the members are
+ * selected in an exact round robin order.  It does this with both
+ * xQueueSelectFromSet() and uxQueueSelectMultipleFromSet().
+ *
+ * It then receives from a second queue set that a lower priority transmit task
+ * and an interrupt (through vQueueSetReadyListAccessFromISR(), which must be
+ * called from the tick hook) send to.  Each queue has a single sender that
+ * sends incrementing values, so the values received from each queue must follow
+ * on exactly from each other.  Each selection must allow exactly one receive,
+ * and a member that still holds items after it has been received from must be
+ * selected again before setreadyNUM_QUEUES_IN_SET more selections have been
+ * made.
+ */
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Demo includes. */
+#include "QueueSetReadyList.h"
+
+#if( configUSE_QUEUE_SETS != 1 )
+	#error configUSE_QUEUE_SETS must be set to 1 to use this demo file.
+#endif
+
+/* The file builds to nothing when the queue sets do not hold a list of their
+ready members, so it can be left in the build either way. */
+#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+
+/* The number of queues that are created and added to each queue set.  The
+last queue in the set the tasks use is only sent to by the interrupt. */
+#define setreadyNUM_QUEUES_IN_SET	3
+#define setreadyISR_QUEUE			( setreadyNUM_QUEUES_IN_SET - 1 )
+
+/* The length of each created queue. */
+#define setreadyQUEUE_LENGTH		3
+
+/* Block times used in this demo.  A block time or 0 means "don't block". */
+#define setreadySHORT_DELAY			( 200 / portTICK_PERIOD_MS )
+#define setreadyDONT_BLOCK			0
+
+/* The priorities used in this demo.  The receive task has the higher priority
+so it always selects from the set as soon as a member becomes ready unless it
+has delayed itself to let data build up in several members. */
+#define setreadyTX_PRIORITY			( tskIDLE_PRIORITY )
+#define setreadyRX_PRIORITY			( tskIDLE_PRIORITY + 1 )
+
+/* The receive task delays for between 0 and setreadyMAX_RX_DELAY - 1 ticks
+before each cycle. */
+#define setreadyMAX_RX_DELAY		( 3UL )
+
+/* The ISR sends to its queue every setreadyISR_TX_PERIOD ticks. */
+#define setreadyISR_TX_PERIOD		( 10UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that sends to all but the last queue in the set, in a pseudo random
+ * order.
+ */
+static void prvQueueSetReadyListSendingTask( void *pvParameters );
+
+/*
+ * The task that selects from the queue sets and checks the order, as described
+ * at the top of this file.
+ */
+static void prvQueueSetReadyListReceivingTask( void *pvParameters );
+
+/*
+ * Uses the private queue set to check the members are selected in round robin
+ * order.  xUseMultiple selects whether the members are selected one at a time
+ * or with uxQueueSelectMultipleFromSet().
+ */
+static void prvCheckSelectionOrder( BaseType_t xUseMultiple );
+
+/*
+ * Empties the queue set the transmit task and interrupt send to, checking each
+ * value received and the order in which the members are selected.
+ */
+static void prvReceiveFromQueueSet( BaseType_t xUseMultiple );
+
+/*
+ * Receive a value from xMember, which was returned by selection number
+ * ulSelection, and check it against the value expected.
+ */
+static void prvReceiveFromMember( QueueSetMemberHandle_t xMember, unsigned long ulSelection );
+
+/*
+ * Select up to setreadyNUM_QUEUES_IN_SET members of xSet, either one at a time
+ * or with uxQueueSelectMultipleFromSet().
+ */
+static UBaseType_t prvSelectFromSet( QueueSetHandle_t xSet, QueueSetMemberHandle_t *pxMembers, BaseType_t xUseMultiple, TickType_t xTicksToWait );
+
+/*
+ * Create the queues and queue sets.
+ */
+static void prvSetupTest( void );
+
+/*
+ * Local pseudo random number generator, as used by QueueSet.c.
+ */
+static unsigned long prvRand( void );
+
+/*-----------------------------------------------------------*/
+
+/* The queues and set that the transmit task and interrupt send to. */
+static QueueHandle_t xQueues[ setreadyNUM_QUEUES_IN_SET ] = { 0 };
+static QueueSetHandle_t xQueueSet;
+
+/* The queues and set that are only accessed by the receive task. */
+static QueueHandle_t xOrderQueues[ setreadyNUM_QUEUES_IN_SET ] = { 0 };
+static QueueSetHandle_t xOrderSet;
+
+/* The value next sent to, and next expected from, each queue. */
+static unsigned long ulTxValue[ setreadyNUM_QUEUES_IN_SET ] = { 0 };
+static unsigned long ulExpectedRxValue[ setreadyNUM_QUEUES_IN_SET ] = { 0 };
+
+/* Counts the number of values received from each queue, to check all the
+queues are used. */
+static unsigned long ulQueueUsedCounter[ setreadyNUM_QUEUES_IN_SET ] = { 0 };
+
+/* The number of members the receive task has selected, and the selection by
+which each member that still held items when it was last received from must
+have been selected again. */
+static unsigned long ulSelections = 0UL;
+static unsigned long ulSelectBy[ setreadyNUM_QUEUES_IN_SET ] = { 0 };
+static BaseType_t xSelectByValid[ setreadyNUM_QUEUES_IN_SET ] = { pdFALSE };
+
+/* Incremented each time the receive task completes a cycle, to check the
+tasks are still running. */
+static volatile unsigned long ulCycleCounter = 0UL;
+
+/* Set to pdFAIL if an error is detected by any queue set task or ISR. */
+static volatile BaseType_t xQueueSetReadyListTasksStatus = pdPASS;
+
+/* Just a flag to let the function that writes to a queue from an ISR know that
+the queues are setup and can be used. */
+static volatile BaseType_t xSetupComplete = pdFALSE;
+
+/* Used by the pseudo random number generator. */
+static unsigned long ulNextRand = 0;
+
+/* The handle of the transmit task, which is resumed once the queues exist. */
+static TaskHandle_t xQueueSetReadyListSendingTask;
+
+/*-----------------------------------------------------------*/
+
+void vStartQueueSetReadyListTasks( void )
+{
+	/* Create the tasks. */
+	xTaskCreate( prvQueueSetReadyListSendingTask, "RdyTx", configMINIMAL_STACK_SIZE, NULL, setreadyTX_PRIORITY, &xQueueSetReadyListSendingTask );
+	xTaskCreate( prvQueueSetReadyListReceivingTask, "RdyRx", configMINIMAL_STACK_SIZE, NULL, setreadyRX_PRIORITY, NULL );
+
+	/* The sending task must not write to a queue before the queue has been
+	created, so it is held in the suspended state until the receiving task has
+	created the queues. */
+	vTaskSuspend( xQueueSetReadyListSendingTask );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreQueueSetReadyListTasksStillRunning( void )
+{
+static unsigned long ulLastCycleCounter = 0UL;
+static unsigned long ulLastQueueUsedCounter[ setreadyNUM_QUEUES_IN_SET ] = { 0 };
+BaseType_t xReturn = pdPASS, x;
+
+	if( ulLastCycleCounter == ulCycleCounter )
+	{
+		/* The cycle counter is no longer being incremented.  Either one of the
+		tasks is stalled or an error has been detected. */
+		xReturn = pdFAIL;
+	}
+
+	ulLastCycleCounter = ulCycleCounter;
+
+	/* Ensure that all the queues in the set have been used, including the
+	one the ISR sends to. */
+	for( x = 0; x < setreadyNUM_QUEUES_IN_SET; x++ )
+	{
+		if( ulLastQueueUsedCounter[ x ] == ulQueueUsedCounter[ x ] )
+		{
+			xReturn = pdFAIL;
+		}
+
+		ulLastQueueUsedCounter[ x ] = ulQueueUsedCounter[ x ];
+	}
+
+	/* Check the global status flag. */
+	if( xQueueSetReadyListTasksStatus != pdPASS )
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vQueueSetReadyListAccessFromISR( void )
+{
+static unsigned long ulCallCount = 0;
+
+	/* xSetupComplete is set to pdTRUE when the queues have been created and
+	are available for use. */
+	if( xSetupComplete == pdTRUE )
+	{
+		/* It is intended that this function is called from the tick hook
+		function, so each call is one tick period apart. */
+		ulCallCount++;
+		if( ulCallCount >= setreadyISR_TX_PERIOD )
+		{
+			ulCallCount = 0;
+
+			/* The value is only moved on if it was sent, so the values in the
+			queue always follow on from each other.  The tick hook does not
+			request a context switch. */
+			if( xQueueSendFromISR( xQueues[ setreadyISR_QUEUE ], &( ulTxValue[ setreadyISR_QUEUE ] ), NULL ) == pdPASS )
+			{
+				ulTxValue[ setreadyISR_QUEUE ]++;
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueSetReadyListSendingTask( void *pvParameters )
+{
+unsigned long ulQueueToWriteTo;
+
+	/* Remove compiler warning about the unused parameter. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* The last queue is left for the ISR. */
+		ulQueueToWriteTo = prvRand() % ( unsigned long ) setreadyISR_QUEUE;
+
+		if( xQueueSendToBack( xQueues[ ulQueueToWriteTo ], &( ulTxValue[ ulQueueToWriteTo ] ), setreadyDONT_BLOCK ) == pdPASS )
+		{
+			ulTxValue[ ulQueueToWriteTo ]++;
+		}
+		else
+		{
+			/* The queue is full because the receive task has delayed itself.
+			Let the other idle priority tasks run. */
+			taskYIELD();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueSetReadyListReceivingTask( void *pvParameters )
+{
+BaseType_t xUseMultiple = pdFALSE;
+
+	/* Remove compiler warning about the unused parameter. */
+	( void ) pvParameters;
+
+	prvSetupTest();
+
+	for( ;; )
+	{
+		prvCheckSelectionOrder( xUseMultiple );
+
+		/* Sometimes let data build up in several members, and sometimes block
+		on the set until the transmit task runs. */
+		vTaskDelay( ( TickType_t ) ( ulCycleCounter % setreadyMAX_RX_DELAY ) );
+		prvReceiveFromQueueSet( xUseMultiple );
+
+		xUseMultiple = !xUseMultiple;
+		ulCycleCounter++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckSelectionOrder( BaseType_t xUseMultiple )
+{
+/* Items are sent to the queues in the order of ucSendOrder.  Each queue joins
+the ready list when it is first sent to, and a selected queue that still holds
+items that have not been selected goes to the back of the list, so the queues
+must be selected in the order of ucExpectedOrder. */
+static const unsigned char ucSendOrder[] = { 0, 0, 0, 1, 2, 2 };
+static const unsigned char ucExpectedOrder[] = { 0, 1, 2, 0, 2, 0 };
+unsigned long ulValue, ulSent[ setreadyNUM_QUEUES_IN_SET ] = { 0 }, ulReceived[ setreadyNUM_QUEUES_IN_SET ] = { 0 };
+QueueSetMemberHandle_t xMembers[ setreadyNUM_QUEUES_IN_SET ];
+UBaseType_t uxNext = 0, uxSelected, ux, uxQueue;
+
+	for( ux = 0; ux < sizeof( ucSendOrder ); ux++ )
+	{
+		uxQueue = ( UBaseType_t ) ucSendOrder[ ux ];
+
+		if( xQueueSendToBack( xOrderQueues[ uxQueue ], &( ulSent[ uxQueue ] ), setreadyDONT_BLOCK ) != pdPASS )
+		{
+			xQueueSetReadyListTasksStatus = pdFAIL;
+		}
+
+		ulSent[ uxQueue ]++;
+	}
+
+	while( uxNext < sizeof( ucExpectedOrder ) )
+	{
+		uxSelected = prvSelectFromSet( xOrderSet, xMembers, xUseMultiple, setreadyDONT_BLOCK );
+
+		if( ( uxSelected == 0 ) || ( ( uxNext + uxSelected ) > sizeof( ucExpectedOrder ) ) )
+		{
+			/* The members were not selected as many times as they were sent
+			to. */
+			xQueueSetReadyListTasksStatus = pdFAIL;
+			break;
+		}
+
+		for( ux = 0; ux < uxSelected; ux++ )
+		{
+			uxQueue = ( UBaseType_t ) ucExpectedOrder[ uxNext ];
+			uxNext++;
+
+			if( xMembers[ ux ] != ( QueueSetMemberHandle_t ) xOrderQueues[ uxQueue ] )
+			{
+				xQueueSetReadyListTasksStatus = pdFAIL;
+			}
+
+			/* Each selection allows exactly one receive, and the values sent
+			to each queue are received in order. */
+			if( xQueueReceive( ( QueueHandle_t ) xMembers[ ux ], &ulValue, setreadyDONT_BLOCK ) != pdPASS )
+			{
+				xQueueSetReadyListTasksStatus = pdFAIL;
+			}
+			else if( ulValue != ulReceived[ uxQueue ] )
+			{
+				xQueueSetReadyListTasksStatus = pdFAIL;
+			}
+			else
+			{
+				ulReceived[ uxQueue ]++;
+			}
+		}
+	}
+
+	/* Nothing should be left to select or receive. */
+	if( prvSelectFromSet( xOrderSet, xMembers, xUseMultiple, setreadyDONT_BLOCK ) != 0 )
+	{
+		xQueueSetReadyListTasksStatus = pdFAIL;
+	}
+
+	for( uxQueue = 0; uxQueue < setreadyNUM_QUEUES_IN_SET; uxQueue++ )
+	{
+		if( xQueueReceive( xOrderQueues[ uxQueue ], &ulValue, setreadyDONT_BLOCK ) != errQUEUE_EMPTY )
+		{
+			xQueueSetReadyListTasksStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiveFromQueueSet( BaseType_t xUseMultiple )
+{
+QueueSetMemberHandle_t xMembers[ setreadyNUM_QUEUES_IN_SET ];
+UBaseType_t uxSelected, ux;
+TickType_t xTicksToWait = setreadySHORT_DELAY;
+unsigned long ulFirstSelection;
+
+	/* Only block on the first selection, then empty the set.  The transmit
+	task has a lower priority so cannot add more data while the set is being
+	emptied, but the ISR can. */
+	for( ;; )
+	{
+		uxSelected = prvSelectFromSet( xQueueSet, xMembers, xUseMultiple, xTicksToWait );
+
+		if( uxSelected == 0 )
+		{
+			if( xTicksToWait != setreadyDONT_BLOCK )
+			{
+				/* Nothing was sent for the whole block time. */
+				xQueueSetReadyListTasksStatus = pdFAIL;
+			}
+
+			break;
+		}
+
+		xTicksToWait = setreadyDONT_BLOCK;
+
+		/* Only this task selects from the set, so the members were selected in
+		the order they appear in the array, one after the other. */
+		ulFirstSelection = ulSelections + 1UL;
+		ulSelections += ( unsigned long ) uxSelected;
+
+		for( ux = 0; ux < uxSelected; ux++ )
+		{
+			prvReceiveFromMember( xMembers[ ux ], ulFirstSelection + ( unsigned long ) ux );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiveFromMember( QueueSetMemberHandle_t xMember, unsigned long ulSelection )
+{
+unsigned long ulReceived;
+BaseType_t x;
+
+	for( x = 0; x < setreadyNUM_QUEUES_IN_SET; x++ )
+	{
+		if( xMember == ( QueueSetMemberHandle_t ) xQueues[ x ] )
+		{
+			break;
+		}
+	}
+
+	if( x >= setreadyNUM_QUEUES_IN_SET )
+	{
+		/* The handle is not one of the members of the set. */
+		xQueueSetReadyListTasksStatus = pdFAIL;
+		return;
+	}
+
+	/* A member that was still ready when it was last received from must not
+	have been passed over by more than the other members that could have been
+	ahead of it in the ready list. */
+	if( ( xSelectByValid[ x ] != pdFALSE ) && ( ( long ) ( ulSelection - ulSelectBy[ x ] ) > 0L ) )
+	{
+		xQueueSetReadyListTasksStatus = pdFAIL;
+	}
+
+	/* Each selection allows exactly one receive, and the values sent to each
+	queue are received in order. */
+	if( xQueueReceive( xQueues[ x ], &ulReceived, setreadyDONT_BLOCK ) != pdPASS )
+	{
+		xQueueSetReadyListTasksStatus = pdFAIL;
+	}
+	else if( ulReceived != ulExpectedRxValue[ x ] )
+	{
+		xQueueSetReadyListTasksStatus = pdFAIL;
+	}
+	else
+	{
+		ulExpectedRxValue[ x ]++;
+		ulQueueUsedCounter[ x ]++;
+	}
+
+	/* Only this task selects from the set, so if the queue still holds items
+	none of them have been selected and the queue is in the ready list.  It is
+	at most setreadyNUM_QUEUES_IN_SET selections from the front. */
+	if( uxQueueMessagesWaiting( xQueues[ x ] ) != ( UBaseType_t ) 0 )
+	{
+		ulSelectBy[ x ] = ulSelections + ( unsigned long ) setreadyNUM_QUEUES_IN_SET;
+		xSelectByValid[ x ] = pdTRUE;
+	}
+	else
+	{
+		xSelectByValid[ x ] = pdFALSE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvSelectFromSet( QueueSetHandle_t xSet, QueueSetMemberHandle_t *pxMembers, BaseType_t xUseMultiple, TickType_t xTicksToWait )
+{
+UBaseType_t uxSelected;
+
+	if( xUseMultiple != pdFALSE )
+	{
+		uxSelected = uxQueueSelectMultipleFromSet( xSet, pxMembers, setreadyNUM_QUEUES_IN_SET, xTicksToWait );
+	}
+	else
+	{
+		pxMembers[ 0 ] = xQueueSelectFromSet( xSet, xTicksToWait );
+
+		if( pxMembers[ 0 ] != NULL )
+		{
+			uxSelected = 1;
+		}
+		else
+		{
+			uxSelected = 0;
+		}
+	}
+
+	return uxSelected;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetupTest( void )
+{
+BaseType_t x;
+
+	xQueueSet = xQueueCreateSet( setreadyNUM_QUEUES_IN_SET * setreadyQUEUE_LENGTH );
+	xOrderSet = xQueueCreateSet( setreadyNUM_QUEUES_IN_SET * setreadyQUEUE_LENGTH );
+	configASSERT( xQueueSet );
+	configASSERT( xOrderSet );
+
+	for( x = 0; x < setreadyNUM_QUEUES_IN_SET; x++ )
+	{
+		xQueues[ x ] = xQueueCreate( setreadyQUEUE_LENGTH, sizeof( unsigned long ) );
+		xOrderQueues[ x ] = xQueueCreate( setreadyQUEUE_LENGTH, sizeof( unsigned long ) );
+		configASSERT( xQueues[ x ] );
+		configASSERT( xOrderQueues[ x ] );
+
+		if( xQueueAddToSet( xQueues[ x ], xQueueSet ) != pdPASS )
+		{
+			xQueueSetReadyListTasksStatus = pdFAIL;
+		}
+
+		if( xQueueAddToSet( xOrderQueues[ x ], xOrderSet ) != pdPASS )
+		{
+			xQueueSetReadyListTasksStatus = pdFAIL;
+		}
+	}
+
+	/* Let the ISR and transmit task access the queues. */
+	xSetupComplete = pdTRUE;
+	vTaskResume( xQueueSetReadyListSendingTask );
+}
+/*-----------------------------------------------------------*/
+
+static unsigned long prvRand( void )
+{
+	ulNextRand = ( ulNextRand * 1103515245UL ) + 12345UL;
+	return ( ulNextRand / 65536UL ) % 32768UL;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_QUEUE_SET_READY_LIST */
+
@@ -0,0 +1,649 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the creation and deletion of tasks, queues, semaphores, mutexes, event
+ * groups, software timers, stream buffers and message buffers that use memory
+ * supplied by the application rather than memory allocated from the FreeRTOS
+ * heap.
+ *
+ * The "Creator" task is itself created statically.  On each cycle it creates
+ * one of each object type from buffers declared in this file, checks the
+ * returned handle refers to the supplied buffer, uses the object a little to
+ * check it behaves as expected, then deletes it.  The same buffers are used on
+ * every cycle, so any attempt by the kernel to free memory it did not allocate
+ * will corrupt the heap and, with a heap implementation that checks the blocks
+ * it is given, be caught by configASSERT().
+ *
+ * Only one statically allocated task exists at any time, and it only runs
+ * briefly, so this file can be used alongside death.c.
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "timers.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+/* Demo program include files. */
+#include "StaticAllocation.h"
+
+#if( configSUPPORT_STATIC_ALLOCATION != 1 )
+	#error configSUPPORT_STATIC_ALLOCATION must be set to 1 to use this demo file.
+#endif
+
+/* The priority of the task that creates the statically allocated objects. */
+#define staticCREATOR_TASK_PRIORITY		( tskIDLE_PRIORITY )
+
+/* A block time of zero simply means "don't block". */
+#define staticDONT_BLOCK				( ( TickType_t ) 0 )
+
+/* The delay between each creation cycle. */
+#define staticLOOP_DELAY				( ( TickType_t ) 50 / portTICK_PERIOD_MS )
+
+/* Sizes of the objects created by the Creator task. */
+#define staticQUEUE_LENGTH_IN_ITEMS		( 5 )
+#define staticMAX_SEMAPHORE_COUNT		( 4 )
+#define staticBUFFER_SIZE_BYTES			( 32 )
+#define staticTEST_MESSAGE_LENGTH		( 10 )
+
+/* The period of the one shot timer, and how long to wait for it to expire. */
+#define staticTIMER_PERIOD				( ( TickType_t ) 5 )
+#define staticTIMER_WAIT				( staticTIMER_PERIOD * ( TickType_t ) 4 )
+
+/* Bits set in the statically allocated event group. */
+#define staticEVENT_BITS				( ( EventBits_t ) 0x55 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that creates and deletes the statically allocated objects, as
+ * described at the top of this file.
+ */
+static void prvStaticallyAllocatedCreator( void *pvParameters );
+
+/*
+ * The task created statically by the Creator task.  It suspends itself so the
+ * Creator task can check it ran before deleting it.
+ */
+static void prvStaticallyAllocatedTask( void *pvParameters );
+
+/*
+ * Callback of the statically allocated software timer.
+ */
+static void prvTimerCallback( TimerHandle_t xTimer );
+
+/*
+ * Each function creates, tests and deletes one type of object, returning
+ * pdFAIL if any check fails.
+ */
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedTask( void );
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedQueue( void );
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedSemaphores( void );
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedMutexes( void );
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedEventGroup( void );
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedTimer( void );
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedStreamBuffers( void );
+
+/*
+ * Takes a semaphore that has been given uxExpectedCount times, checking it can
+ * be taken exactly that many times.
+ */
+static portBASE_TYPE prvCheckSemaphoreCount( SemaphoreHandle_t xSemaphore, UBaseType_t uxExpectedCount );
+
+/*-----------------------------------------------------------*/
+
+/* The memory used by the Creator task. */
+static StaticTask_t xCreatorTaskTCB;
+static StackType_t uxCreatorTaskStack[ configMINIMAL_STACK_SIZE ];
+
+/* The memory used by the objects the Creator task creates.  The same memory is
+used on each cycle. */
+static StaticTask_t xCreatedTaskTCB;
+static StackType_t uxCreatedTaskStack[ configMINIMAL_STACK_SIZE ];
+static StaticQueue_t xStaticQueue;
+static uint8_t ucQueueStorage[ staticQUEUE_LENGTH_IN_ITEMS * sizeof( uint32_t ) ];
+static StaticSemaphore_t xStaticSemaphore;
+static StaticEventGroup_t xStaticEventGroup;
+static StaticTimer_t xStaticTimer;
+static StaticStreamBuffer_t xStaticStreamBuffer;
+static uint8_t ucStreamBufferStorage[ staticBUFFER_SIZE_BYTES + 1 ];
+
+/* Set by the statically allocated task and timer so the Creator task knows
+they executed. */
+static volatile portBASE_TYPE xCreatedTaskRan = pdFALSE;
+static volatile portBASE_TYPE xTimerCallbackExecuted = pdFALSE;
+
+/* Incremented on each successful cycle, and latched if an error is found. */
+static volatile unsigned long ulCycleCounter = 0UL;
+static volatile portBASE_TYPE xErrorOccurred = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartStaticallyAllocatedTasks( void )
+{
+	xTaskCreateStatic( prvStaticallyAllocatedCreator, "StatCreate", configMINIMAL_STACK_SIZE, NULL, staticCREATOR_TASK_PRIORITY, uxCreatorTaskStack, &xCreatorTaskTCB );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStaticallyAllocatedCreator( void *pvParameters )
+{
+portBASE_TYPE xResult;
+
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		xResult = prvCreateAndDeleteStaticallyAllocatedTask();
+		xResult &= prvCreateAndDeleteStaticallyAllocatedQueue();
+		xResult &= prvCreateAndDeleteStaticallyAllocatedSemaphores();
+		xResult &= prvCreateAndDeleteStaticallyAllocatedMutexes();
+		xResult &= prvCreateAndDeleteStaticallyAllocatedEventGroup();
+		xResult &= prvCreateAndDeleteStaticallyAllocatedTimer();
+		xResult &= prvCreateAndDeleteStaticallyAllocatedStreamBuffers();
+
+		if( xResult != pdPASS )
+		{
+			xErrorOccurred = pdTRUE;
+		}
+		else
+		{
+			ulCycleCounter++;
+		}
+
+		/* Give the idle task a chance to clean up the deleted task before
+		the same memory is used again. */
+		vTaskDelay( staticLOOP_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStaticallyAllocatedTask( void *pvParameters )
+{
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		xCreatedTaskRan = pdTRUE;
+		vTaskSuspend( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+	/* Just to remove compiler warning. */
+	( void ) xTimer;
+
+	xTimerCallbackExecuted = pdTRUE;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedTask( void )
+{
+TaskHandle_t xCreatedTask;
+portBASE_TYPE xReturn = pdPASS;
+
+	xCreatedTaskRan = pdFALSE;
+
+	/* The created task has a higher priority than this task, so runs, and
+	suspends itself, before xTaskCreateStatic() returns. */
+	xCreatedTask = xTaskCreateStatic( prvStaticallyAllocatedTask, "StatTask", configMINIMAL_STACK_SIZE, NULL, staticCREATOR_TASK_PRIORITY + 1, uxCreatedTaskStack, &xCreatedTaskTCB );
+
+	/* The handle of a statically allocated object is the address of the
+	buffer that holds it. */
+	if( xCreatedTask != ( TaskHandle_t ) &xCreatedTaskTCB )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		if( xCreatedTaskRan != pdTRUE )
+		{
+			xReturn = pdFAIL;
+		}
+
+		if( eTaskGetState( xCreatedTask ) != eSuspended )
+		{
+			xReturn = pdFAIL;
+		}
+
+		/* The kernel must not attempt to free the TCB or the stack. */
+		vTaskDelete( xCreatedTask );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedQueue( void )
+{
+QueueHandle_t xQueue;
+uint32_t ulValue;
+portBASE_TYPE xReturn = pdPASS;
+
+	xQueue = xQueueCreateStatic( staticQUEUE_LENGTH_IN_ITEMS, sizeof( uint32_t ), ucQueueStorage, &xStaticQueue );
+
+	if( xQueue != ( QueueHandle_t ) &xStaticQueue )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		/* Fill the queue, then check the values come out in order. */
+		for( ulValue = 0UL; ulValue < ( uint32_t ) staticQUEUE_LENGTH_IN_ITEMS; ulValue++ )
+		{
+			if( xQueueSend( xQueue, &ulValue, staticDONT_BLOCK ) != pdPASS )
+			{
+				xReturn = pdFAIL;
+			}
+		}
+
+		if( xQueueSend( xQueue, &ulValue, staticDONT_BLOCK ) != errQUEUE_FULL )
+		{
+			xReturn = pdFAIL;
+		}
+
+		for( ulValue = 0UL; ulValue < ( uint32_t ) staticQUEUE_LENGTH_IN_ITEMS; ulValue++ )
+		{
+		uint32_t ulReceived = ~ulValue;
+
+			if( ( xQueueReceive( xQueue, &ulReceived, staticDONT_BLOCK ) != pdPASS ) || ( ulReceived != ulValue ) )
+			{
+				xReturn = pdFAIL;
+			}
+		}
+
+		vQueueDelete( xQueue );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvCheckSemaphoreCount( SemaphoreHandle_t xSemaphore, UBaseType_t uxExpectedCount )
+{
+UBaseType_t ux;
+portBASE_TYPE xReturn = pdPASS;
+
+	for( ux = 0; ux < uxExpectedCount; ux++ )
+	{
+		if( xSemaphoreTake( xSemaphore, staticDONT_BLOCK ) != pdPASS )
+		{
+			xReturn = pdFAIL;
+		}
+	}
+
+	/* The semaphore should now be empty. */
+	if( xSemaphoreTake( xSemaphore, staticDONT_BLOCK ) != pdFAIL )
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedSemaphores( void )
+{
+SemaphoreHandle_t xSemaphore;
+UBaseType_t ux;
+portBASE_TYPE xReturn = pdPASS;
+
+	/* A binary semaphore is created empty. */
+	xSemaphore = xSemaphoreCreateBinaryStatic( &xStaticSemaphore );
+
+	if( xSemaphore != ( SemaphoreHandle_t ) &xStaticSemaphore )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		xReturn &= prvCheckSemaphoreCount( xSemaphore, 0 );
+		( void ) xSemaphoreGive( xSemaphore );
+		xReturn &= prvCheckSemaphoreCount( xSemaphore, 1 );
+		vSemaphoreDelete( xSemaphore );
+	}
+
+	/* A counting semaphore starts with its initial count.  The same buffer is
+	used again now the binary semaphore has been deleted. */
+	xSemaphore = xSemaphoreCreateCountingStatic( staticMAX_SEMAPHORE_COUNT, staticMAX_SEMAPHORE_COUNT, &xStaticSemaphore );
+
+	if( xSemaphore != ( SemaphoreHandle_t ) &xStaticSemaphore )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		xReturn &= prvCheckSemaphoreCount( xSemaphore, staticMAX_SEMAPHORE_COUNT );
+
+		for( ux = 0; ux < staticMAX_SEMAPHORE_COUNT; ux++ )
+		{
+			( void ) xSemaphoreGive( xSemaphore );
+		}
+
+		/* Cannot give past the maximum count. */
+		if( xSemaphoreGive( xSemaphore ) != pdFAIL )
+		{
+			xReturn = pdFAIL;
+		}
+
+		xReturn &= prvCheckSemaphoreCount( xSemaphore, staticMAX_SEMAPHORE_COUNT );
+		vSemaphoreDelete( xSemaphore );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedMutexes( void )
+{
+SemaphoreHandle_t xMutex;
+portBASE_TYPE xReturn = pdPASS;
+
+	/* A mutex is created available, and is owned by the task that takes it. */
+	xMutex = xSemaphoreCreateMutexStatic( &xStaticSemaphore );
+
+	if( xMutex != ( SemaphoreHandle_t ) &xStaticSemaphore )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		if( xSemaphoreTake( xMutex, staticDONT_BLOCK ) != pdPASS )
+		{
+			xReturn = pdFAIL;
+		}
+
+		/* The mutex is now held so cannot be taken again. */
+		if( xSemaphoreTake( xMutex, staticDONT_BLOCK ) != pdFAIL )
+		{
+			xReturn = pdFAIL;
+		}
+
+		if( xSemaphoreGive( xMutex ) != pdPASS )
+		{
+			xReturn = pdFAIL;
+		}
+
+		/* Nor can it be given twice. */
+		if( xSemaphoreGive( xMutex ) != pdFAIL )
+		{
+			xReturn = pdFAIL;
+		}
+
+		vSemaphoreDelete( xMutex );
+	}
+
+	/* A recursive mutex must be given back as many times as it was taken. */
+	xMutex = xSemaphoreCreateRecursiveMutexStatic( &xStaticSemaphore );
+
+	if( xMutex != ( SemaphoreHandle_t ) &xStaticSemaphore )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		if( ( xSemaphoreTakeRecursive( xMutex, staticDONT_BLOCK ) != pdPASS ) || ( xSemaphoreTakeRecursive( xMutex, staticDONT_BLOCK ) != pdPASS ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		if( ( xSemaphoreGiveRecursive( xMutex ) != pdPASS ) || ( xSemaphoreGiveRecursive( xMutex ) != pdPASS ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		/* The mutex is no longer held, so cannot be given again. */
+		if( xSemaphoreGiveRecursive( xMutex ) != pdFAIL )
+		{
+			xReturn = pdFAIL;
+		}
+
+		vSemaphoreDelete( xMutex );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedEventGroup( void )
+{
+EventGroupHandle_t xEventGroup;
+portBASE_TYPE xReturn = pdPASS;
+
+	xEventGroup = xEventGroupCreateStatic( &xStaticEventGroup );
+
+	if( xEventGroup != ( EventGroupHandle_t ) &xStaticEventGroup )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		/* A new event group has no bits set. */
+		if( xEventGroupGetBits( xEventGroup ) != 0 )
+		{
+			xReturn = pdFAIL;
+		}
+
+		( void ) xEventGroupSetBits( xEventGroup, staticEVENT_BITS );
+
+		if( xEventGroupWaitBits( xEventGroup, staticEVENT_BITS, pdTRUE, pdTRUE, staticDONT_BLOCK ) != staticEVENT_BITS )
+		{
+			xReturn = pdFAIL;
+		}
+
+		if( xEventGroupGetBits( xEventGroup ) != 0 )
+		{
+			xReturn = pdFAIL;
+		}
+
+		vEventGroupDelete( xEventGroup );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedTimer( void )
+{
+TimerHandle_t xTimer;
+portBASE_TYPE xReturn = pdPASS;
+
+	xTimerCallbackExecuted = pdFALSE;
+	xTimer = xTimerCreateStatic( "StatTmr", staticTIMER_PERIOD, pdFALSE, NULL, prvTimerCallback, &xStaticTimer );
+
+	if( xTimer != ( TimerHandle_t ) &xStaticTimer )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		if( xTimerStart( xTimer, staticDONT_BLOCK ) != pdPASS )
+		{
+			xReturn = pdFAIL;
+		}
+
+		vTaskDelay( staticTIMER_WAIT );
+
+		if( ( xTimerCallbackExecuted != pdTRUE ) || ( xTimerIsTimerActive( xTimer ) != pdFALSE ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		/* The timer service task has a higher priority than this task, so the
+		delete command is processed before the buffer is used again. */
+		if( xTimerDelete( xTimer, portMAX_DELAY ) != pdPASS )
+		{
+			xReturn = pdFAIL;
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static portBASE_TYPE prvCreateAndDeleteStaticallyAllocatedStreamBuffers( void )
+{
+StreamBufferHandle_t xStreamBuffer;
+MessageBufferHandle_t xMessageBuffer;
+uint8_t ucTxData[ staticTEST_MESSAGE_LENGTH ], ucRxData[ staticTEST_MESSAGE_LENGTH ];
+size_t x;
+portBASE_TYPE xReturn = pdPASS;
+
+	for( x = 0; x < sizeof( ucTxData ); x++ )
+	{
+		ucTxData[ x ] = ( uint8_t ) ( x + ulCycleCounter );
+	}
+
+	/* The stream buffer can hold exactly staticBUFFER_SIZE_BYTES bytes. */
+	xStreamBuffer = xStreamBufferCreateStatic( staticBUFFER_SIZE_BYTES, 1, ucStreamBufferStorage, &xStaticStreamBuffer );
+
+	if( xStreamBuffer != ( StreamBufferHandle_t ) &xStaticStreamBuffer )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		if( xStreamBufferSpacesAvailable( xStreamBuffer ) != staticBUFFER_SIZE_BYTES )
+		{
+			xReturn = pdFAIL;
+		}
+
+		if( xStreamBufferSend( xStreamBuffer, ucTxData, sizeof( ucTxData ), staticDONT_BLOCK ) != sizeof( ucTxData ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		memset( ucRxData, 0x00, sizeof( ucRxData ) );
+
+		if( ( xStreamBufferReceive( xStreamBuffer, ucRxData, sizeof( ucRxData ), staticDONT_BLOCK ) != sizeof( ucRxData ) ) || ( memcmp( ucTxData, ucRxData, sizeof( ucTxData ) ) != 0 ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		vStreamBufferDelete( xStreamBuffer );
+	}
+
+	/* The same memory is used again for a message buffer. */
+	xMessageBuffer = xMessageBufferCreateStatic( staticBUFFER_SIZE_BYTES, ucStreamBufferStorage, &xStaticStreamBuffer );
+
+	if( xMessageBuffer != ( MessageBufferHandle_t ) &xStaticStreamBuffer )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		if( xMessageBufferSend( xMessageBuffer, ucTxData, sizeof( ucTxData ), staticDONT_BLOCK ) != sizeof( ucTxData ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		memset( ucRxData, 0x00, sizeof( ucRxData ) );
+
+		if( ( xMessageBufferReceive( xMessageBuffer, ucRxData, sizeof( ucRxData ), staticDONT_BLOCK ) != sizeof( ucRxData ) ) || ( memcmp( ucTxData, ucRxData, sizeof( ucTxData ) ) != 0 ) )
+		{
+			xReturn = pdFAIL;
+		}
+
+		vMessageBufferDelete( xMessageBuffer );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xAreStaticAllocationTasksStillRunning( void )
+{
+static unsigned long ulLastCycleCounter = 0UL;
+portBASE_TYPE xReturn = pdPASS;
+
+	/* Check the cycle count is still incrementing to ensure the Creator task
+	is still creating and deleting objects without error. */
+	if( ulLastCycleCounter == ulCycleCounter )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastCycleCounter = ulCycleCounter;
+
+	if( xErrorOccurred != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
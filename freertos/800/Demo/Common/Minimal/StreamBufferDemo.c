@@ -0,0 +1,637 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the behaviour of stream buffers and message buffers.
+ *
+ * The "StrRx" task first performs a set of tests on buffers that it creates
+ * and deletes itself, checking the blocking, wrapping, trigger level, reset and
+ * all-or-nothing message behaviour.  It then receives an incrementing byte
+ * stream from the "StrTx" task, using a different receive length each time, while
+ * "StrTx" sends the stream in chunks of varying length, some of which are
+ * longer than the buffer itself.
+ *
+ * The "MsgTx" task sends messages of varying length to the "MsgRx" task through
+ * a message buffer.  The content of each message is derived from its sequence
+ * number, so the receiver can check both the length and the content.
+ *
+ * vPeriodicStreamBufferProcessing(), which must be called from the tick hook,
+ * sends a sequence number to the "IsrRx" task through a message buffer, and
+ * drains an incrementing byte stream written by the "IsrTx" task to a stream
+ * buffer, so both the send and receive functions are used from an interrupt.
+ *
+ * The senders and receivers of each pair run at different priorities so both
+ * the reader and the writer block.
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+/* Demo program include files. */
+#include "StreamBufferDemo.h"
+
+/* Task priorities. */
+#define sbdLOWER_PRIORITY			( tskIDLE_PRIORITY )
+#define sbdHIGHER_PRIORITY			( tskIDLE_PRIORITY + 1 )
+
+/* The size of the buffers.  An odd length is used for the stream buffer so
+the data wraps at a different position on each pass. */
+#define sbdSTREAM_BUFFER_LENGTH		( ( size_t ) 37 )
+#define sbdMESSAGE_BUFFER_LENGTH	( ( size_t ) 64 )
+#define sbdISR_BUFFER_LENGTH		( ( size_t ) 32 )
+
+/* The trigger level used by the stream buffer shared by "StrTx" and
+"StrRx". */
+#define sbdTRIGGER_LEVEL			( ( size_t ) 5 )
+
+/* The largest chunk sent to, and the largest buffer received from, the stream
+buffer.  The chunk is longer than the stream buffer. */
+#define sbdMAX_CHUNK_LENGTH			( ( size_t ) 50 )
+#define sbdMAX_RX_LENGTH			( ( size_t ) 23 )
+
+/* The largest message sent to the message buffer. */
+#define sbdMAX_MESSAGE_LENGTH		( ( size_t ) 20 )
+
+/* The ISR sends a message every sbdISR_PERIOD ticks. */
+#define sbdISR_PERIOD				( ( TickType_t ) 3 )
+
+/* The number of bytes the ISR attempts to read each tick. */
+#define sbdISR_RX_LENGTH			( ( size_t ) 8 )
+
+/* Block times. */
+#define sbdDONT_BLOCK				( ( TickType_t ) 0 )
+#define sbdSHORT_DELAY				( ( TickType_t ) 10 )
+#define sbdRX_BLOCK_TIME			( ( TickType_t ) 100 / portTICK_PERIOD_MS )
+
+/* The size of the buffers used by the single task tests. */
+#define sbdTEST_BUFFER_LENGTH		( ( size_t ) 20 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvStreamSenderTask( void *pvParameters );
+static void prvStreamReceiverTask( void *pvParameters );
+static void prvMessageSenderTask( void *pvParameters );
+static void prvMessageReceiverTask( void *pvParameters );
+static void prvISRMessageReceiverTask( void *pvParameters );
+static void prvISRStreamSenderTask( void *pvParameters );
+
+/*
+ * Tests that the "StrRx" task performs on its own before entering its loop.
+ */
+static void prvSingleTaskTests( void );
+
+/*
+ * Fill a message with content derived from its sequence number, and check a
+ * received message has the expected content.
+ */
+static void prvFillMessage( uint8_t *pucMessage, size_t xLength, uint32_t ulSequence );
+static BaseType_t prvCheckMessage( const uint8_t *pucMessage, size_t xLength, uint32_t ulSequence );
+
+/*-----------------------------------------------------------*/
+
+/* The buffers shared between the tasks and the ISR. */
+static StreamBufferHandle_t xStreamBuffer = NULL, xISRStreamBuffer = NULL;
+static MessageBufferHandle_t xMessageBuffer = NULL, xISRMessageBuffer = NULL;
+
+/* Used to latch errors found by the tasks or the ISR. */
+static volatile portBASE_TYPE xErrorStatus = pdPASS;
+
+/* Incremented by the receivers so the check function knows they are still
+running. */
+static volatile unsigned long ulStreamCycles = 0UL, ulMessageCycles = 0UL, ulISRMessageCycles = 0UL, ulISRStreamCycles = 0UL;
+
+/*-----------------------------------------------------------*/
+
+void vStartStreamBufferTasks( void )
+{
+	xStreamBuffer = xStreamBufferCreate( sbdSTREAM_BUFFER_LENGTH, sbdTRIGGER_LEVEL );
+	xMessageBuffer = xMessageBufferCreate( sbdMESSAGE_BUFFER_LENGTH );
+	xISRStreamBuffer = xStreamBufferCreate( sbdISR_BUFFER_LENGTH, 1 );
+	xISRMessageBuffer = xMessageBufferCreate( sbdISR_BUFFER_LENGTH );
+	configASSERT( xStreamBuffer );
+	configASSERT( xMessageBuffer );
+	configASSERT( xISRStreamBuffer );
+	configASSERT( xISRMessageBuffer );
+
+	xTaskCreate( prvStreamSenderTask, "StrTx", configMINIMAL_STACK_SIZE, NULL, sbdLOWER_PRIORITY, NULL );
+	xTaskCreate( prvStreamReceiverTask, "StrRx", configMINIMAL_STACK_SIZE, NULL, sbdHIGHER_PRIORITY, NULL );
+	xTaskCreate( prvMessageSenderTask, "MsgTx", configMINIMAL_STACK_SIZE, NULL, sbdHIGHER_PRIORITY, NULL );
+	xTaskCreate( prvMessageReceiverTask, "MsgRx", configMINIMAL_STACK_SIZE, NULL, sbdLOWER_PRIORITY, NULL );
+	xTaskCreate( prvISRMessageReceiverTask, "IsrRx", configMINIMAL_STACK_SIZE, NULL, sbdHIGHER_PRIORITY, NULL );
+	xTaskCreate( prvISRStreamSenderTask, "IsrTx", configMINIMAL_STACK_SIZE, NULL, sbdLOWER_PRIORITY, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSingleTaskTests( void )
+{
+StreamBufferHandle_t xTestBuffer;
+MessageBufferHandle_t xTestMessageBuffer;
+uint8_t ucTxData[ sbdTEST_BUFFER_LENGTH + 1 ], ucRxData[ sbdTEST_BUFFER_LENGTH + 1 ];
+size_t xReturned, xIndex;
+TickType_t xTimeOnEntering;
+
+	for( xIndex = 0; xIndex < sizeof( ucTxData ); xIndex++ )
+	{
+		ucTxData[ xIndex ] = ( uint8_t ) xIndex;
+	}
+
+	xTestBuffer = xStreamBufferCreate( sbdTEST_BUFFER_LENGTH, 1 );
+	configASSERT( xTestBuffer );
+
+	/* ------------------------------------------------------------------------
+	A new buffer is empty. */
+	if( ( xStreamBufferIsEmpty( xTestBuffer ) != pdTRUE ) ||
+		( xStreamBufferIsFull( xTestBuffer ) != pdFALSE ) ||
+		( xStreamBufferSpacesAvailable( xTestBuffer ) != sbdTEST_BUFFER_LENGTH ) ||
+		( xStreamBufferBytesAvailable( xTestBuffer ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* ------------------------------------------------------------------------
+	Nothing can be read from an empty buffer, and the block time is
+	respected. */
+	if( xStreamBufferReceive( xTestBuffer, ucRxData, sizeof( ucRxData ), sbdDONT_BLOCK ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xTimeOnEntering = xTaskGetTickCount();
+	if( xStreamBufferReceive( xTestBuffer, ucRxData, sizeof( ucRxData ), sbdSHORT_DELAY ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeOnEntering ) < sbdSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* ------------------------------------------------------------------------
+	Fill the buffer.  Only the space available is written. */
+	xReturned = xStreamBufferSend( xTestBuffer, ucTxData, sizeof( ucTxData ), sbdDONT_BLOCK );
+
+	if( ( xReturned != sbdTEST_BUFFER_LENGTH ) ||
+		( xStreamBufferIsFull( xTestBuffer ) != pdTRUE ) ||
+		( xStreamBufferSpacesAvailable( xTestBuffer ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Nothing can be written to a full buffer, and the block time is
+	respected. */
+	xTimeOnEntering = xTaskGetTickCount();
+	if( xStreamBufferSend( xTestBuffer, ucTxData, 1, sbdSHORT_DELAY ) != 0 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeOnEntering ) < sbdSHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* ------------------------------------------------------------------------
+	Read part of the data, then write more so the data wraps around the end
+	of the ring. */
+	xReturned = xStreamBufferReceive( xTestBuffer, ucRxData, 7, sbdDONT_BLOCK );
+
+	if( ( xReturned != 7 ) || ( memcmp( ucRxData, ucTxData, 7 ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xReturned = xStreamBufferSend( xTestBuffer, ucTxData, 7, sbdDONT_BLOCK );
+
+	if( xReturned != 7 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xReturned = xStreamBufferReceive( xTestBuffer, ucRxData, sizeof( ucRxData ), sbdDONT_BLOCK );
+
+	if( ( xReturned != sbdTEST_BUFFER_LENGTH ) ||
+		( memcmp( ucRxData, &( ucTxData[ 7 ] ), sbdTEST_BUFFER_LENGTH - 7 ) != 0 ) ||
+		( memcmp( &( ucRxData[ sbdTEST_BUFFER_LENGTH - 7 ] ), ucTxData, 7 ) != 0 ) ||
+		( xStreamBufferIsEmpty( xTestBuffer ) != pdTRUE ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* ------------------------------------------------------------------------
+	Reset discards the data. */
+	( void ) xStreamBufferSend( xTestBuffer, ucTxData, 5, sbdDONT_BLOCK );
+
+	if( ( xStreamBufferReset( xTestBuffer ) != pdPASS ) || ( xStreamBufferIsEmpty( xTestBuffer ) != pdTRUE ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* ------------------------------------------------------------------------
+	The trigger level cannot exceed the buffer length. */
+	if( ( xStreamBufferSetTriggerLevel( xTestBuffer, sbdTEST_BUFFER_LENGTH + 1 ) != pdFALSE ) ||
+		( xStreamBufferSetTriggerLevel( xTestBuffer, sbdTEST_BUFFER_LENGTH ) != pdTRUE ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	vStreamBufferDelete( xTestBuffer );
+
+	/* ------------------------------------------------------------------------
+	Messages are read whole, and left in the buffer if the receive buffer is
+	too small. */
+	xTestMessageBuffer = xMessageBufferCreate( sbdTEST_BUFFER_LENGTH + sizeof( size_t ) );
+	configASSERT( xTestMessageBuffer );
+
+	if( xMessageBufferSend( xTestMessageBuffer, ucTxData, 5, sbdDONT_BLOCK ) != 5 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xMessageBufferNextLengthBytes( xTestMessageBuffer ) != 5 ) ||
+		( xMessageBufferReceive( xTestMessageBuffer, ucRxData, 4, sbdDONT_BLOCK ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xReturned = xMessageBufferReceive( xTestMessageBuffer, ucRxData, sizeof( ucRxData ), sbdDONT_BLOCK );
+
+	if( ( xReturned != 5 ) || ( memcmp( ucRxData, ucTxData, 5 ) != 0 ) || ( xMessageBufferIsEmpty( xTestMessageBuffer ) != pdTRUE ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* ------------------------------------------------------------------------
+	A message is written in its entirety or not at all. */
+	if( xMessageBufferSend( xTestMessageBuffer, ucTxData, sbdTEST_BUFFER_LENGTH, sbdDONT_BLOCK ) != sbdTEST_BUFFER_LENGTH )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xMessageBufferIsFull( xTestMessageBuffer ) != pdTRUE ) ||
+		( xMessageBufferSend( xTestMessageBuffer, ucTxData, 1, sbdDONT_BLOCK ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xReturned = xMessageBufferReceive( xTestMessageBuffer, ucRxData, sizeof( ucRxData ), sbdDONT_BLOCK );
+
+	if( ( xReturned != sbdTEST_BUFFER_LENGTH ) || ( memcmp( ucRxData, ucTxData, sbdTEST_BUFFER_LENGTH ) != 0 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	vMessageBufferDelete( xTestMessageBuffer );
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamSenderTask( void *pvParameters )
+{
+uint8_t ucTxData[ sbdMAX_CHUNK_LENGTH ];
+uint8_t ucNextByte = 0;
+size_t xChunkLength = 1, xSent, xIndex;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		for( xIndex = 0; xIndex < xChunkLength; xIndex++ )
+		{
+			ucTxData[ xIndex ] = ucNextByte;
+			ucNextByte++;
+		}
+
+		/* A chunk longer than the buffer cannot be written in one go. */
+		xSent = 0;
+		while( xSent < xChunkLength )
+		{
+			xSent += xStreamBufferSend( xStreamBuffer, &( ucTxData[ xSent ] ), xChunkLength - xSent, portMAX_DELAY );
+		}
+
+		xChunkLength++;
+		if( xChunkLength > sbdMAX_CHUNK_LENGTH )
+		{
+			xChunkLength = 1;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStreamReceiverTask( void *pvParameters )
+{
+uint8_t ucRxData[ sbdMAX_RX_LENGTH ];
+uint8_t ucExpectedByte = 0;
+size_t xRxLength = 1, xReceived, xIndex;
+
+	( void ) pvParameters;
+
+	prvSingleTaskTests();
+
+	for( ;; )
+	{
+		xReceived = xStreamBufferReceive( xStreamBuffer, ucRxData, xRxLength, sbdRX_BLOCK_TIME );
+
+		for( xIndex = 0; xIndex < xReceived; xIndex++ )
+		{
+			if( ucRxData[ xIndex ] != ucExpectedByte )
+			{
+				xErrorStatus = pdFAIL;
+			}
+
+			ucExpectedByte++;
+		}
+
+		xRxLength++;
+		if( xRxLength > sbdMAX_RX_LENGTH )
+		{
+			xRxLength = 1;
+		}
+
+		if( ( xReceived > 0 ) && ( xErrorStatus == pdPASS ) )
+		{
+			ulStreamCycles++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvFillMessage( uint8_t *pucMessage, size_t xLength, uint32_t ulSequence )
+{
+size_t xIndex;
+
+	for( xIndex = 0; xIndex < xLength; xIndex++ )
+	{
+		pucMessage[ xIndex ] = ( uint8_t ) ( ulSequence + xIndex );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCheckMessage( const uint8_t *pucMessage, size_t xLength, uint32_t ulSequence )
+{
+size_t xIndex;
+BaseType_t xReturn = pdPASS;
+
+	for( xIndex = 0; xIndex < xLength; xIndex++ )
+	{
+		if( pucMessage[ xIndex ] != ( uint8_t ) ( ulSequence + xIndex ) )
+		{
+			xReturn = pdFAIL;
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMessageSenderTask( void *pvParameters )
+{
+uint8_t ucMessage[ sbdMAX_MESSAGE_LENGTH ];
+uint32_t ulSequence = 0;
+size_t xLength;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		xLength = ( size_t ) ( ulSequence % sbdMAX_MESSAGE_LENGTH ) + 1;
+		prvFillMessage( ucMessage, xLength, ulSequence );
+
+		if( xMessageBufferSend( xMessageBuffer, ucMessage, xLength, portMAX_DELAY ) != xLength )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		ulSequence++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMessageReceiverTask( void *pvParameters )
+{
+uint8_t ucMessage[ sbdMAX_MESSAGE_LENGTH ];
+uint32_t ulSequence = 0;
+size_t xLength;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		xLength = xMessageBufferReceive( xMessageBuffer, ucMessage, sizeof( ucMessage ), portMAX_DELAY );
+
+		if( ( xLength != ( size_t ) ( ulSequence % sbdMAX_MESSAGE_LENGTH ) + 1 ) ||
+			( prvCheckMessage( ucMessage, xLength, ulSequence ) != pdPASS ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		ulSequence++;
+
+		if( xErrorStatus == pdPASS )
+		{
+			ulMessageCycles++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvISRMessageReceiverTask( void *pvParameters )
+{
+uint32_t ulReceived, ulExpected = 0;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		if( xMessageBufferReceive( xISRMessageBuffer, &ulReceived, sizeof( ulReceived ), portMAX_DELAY ) != sizeof( ulReceived ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else if( ulReceived != ulExpected )
+		{
+			xErrorStatus = pdFAIL;
+		}
+		else
+		{
+			ulExpected++;
+
+			if( xErrorStatus == pdPASS )
+			{
+				ulISRMessageCycles++;
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvISRStreamSenderTask( void *pvParameters )
+{
+uint8_t ucTxData[ sbdISR_BUFFER_LENGTH ];
+uint8_t ucNextByte = 0;
+size_t xIndex;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		for( xIndex = 0; xIndex < sizeof( ucTxData ); xIndex++ )
+		{
+			ucTxData[ xIndex ] = ucNextByte;
+			ucNextByte++;
+		}
+
+		/* The buffer is drained by the tick interrupt, so this task spends
+		most of its time blocked waiting for space. */
+		if( xStreamBufferSend( xISRStreamBuffer, ucTxData, sizeof( ucTxData ), portMAX_DELAY ) != sizeof( ucTxData ) )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPeriodicStreamBufferProcessing( void )
+{
+static TickType_t xCallCount = 0;
+static uint32_t ulNextToSend = 0;
+static uint8_t ucExpectedByte = 0;
+uint8_t ucRxData[ sbdISR_RX_LENGTH ];
+size_t xReceived, xIndex;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* This function should be called from an interrupt, such as the tick hook
+	function vApplicationTickHook(). */
+	xCallCount++;
+
+	if( xCallCount >= sbdISR_PERIOD )
+	{
+		xCallCount = 0;
+
+		/* If the receiving task has not emptied the buffer then the same
+		sequence number is sent again next time. */
+		if( xMessageBufferSendFromISR( xISRMessageBuffer, &ulNextToSend, sizeof( ulNextToSend ), &xHigherPriorityTaskWoken ) == sizeof( ulNextToSend ) )
+		{
+			ulNextToSend++;
+		}
+	}
+
+	/* Drain part of the stream written by the "IsrTx" task. */
+	xReceived = xStreamBufferReceiveFromISR( xISRStreamBuffer, ucRxData, sizeof( ucRxData ), &xHigherPriorityTaskWoken );
+
+	for( xIndex = 0; xIndex < xReceived; xIndex++ )
+	{
+		if( ucRxData[ xIndex ] != ucExpectedByte )
+		{
+			xErrorStatus = pdFAIL;
+		}
+
+		ucExpectedByte++;
+	}
+
+	if( xReceived > 0 )
+	{
+		ulISRStreamCycles++;
+	}
+
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xAreStreamBufferTasksStillRunning( void )
+{
+static unsigned long ulLastStreamCycles = 0UL, ulLastMessageCycles = 0UL, ulLastISRMessageCycles = 0UL, ulLastISRStreamCycles = 0UL;
+portBASE_TYPE xReturn = pdPASS;
+
+	/* Check each receiver is still receiving. */
+	if( ( ulLastStreamCycles == ulStreamCycles ) ||
+		( ulLastMessageCycles == ulMessageCycles ) ||
+		( ulLastISRMessageCycles == ulISRMessageCycles ) ||
+		( ulLastISRStreamCycles == ulISRStreamCycles ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastStreamCycles = ulStreamCycles;
+	ulLastMessageCycles = ulMessageCycles;
+	ulLastISRMessageCycles = ulISRMessageCycles;
+	ulLastISRStreamCycles = ulISRStreamCycles;
+
+	if( xErrorStatus != pdPASS )
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
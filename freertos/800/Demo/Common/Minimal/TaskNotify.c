@@ -0,0 +1,465 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Tests the behaviour of direct to task notifications.
+ *
+ * The "Notified" task first performs a set of tests that it can complete on
+ * its own by notifying itself, checking each of the notification actions and
+ * the timeout behaviour of ulTaskNotifyTake() and xTaskNotifyWait().  It then
+ * enters a loop in which it waits for notifications from both a software timer
+ * callback (which executes in the context of the timer service task) and from
+ * the tick interrupt (through vNotifyTaskFromISR(), which must be called from
+ * the tick hook).  Each source sets a different bit in the task's notification
+ * value.  The timer period is varied on each cycle so the notifications arrive
+ * in a different order relative to the tick.
+ */
+
+/* Scheduler include files. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+/* Demo program include files. */
+#include "TaskNotify.h"
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 (or left undefined) to use this demo file.
+#endif
+
+/* The priority of the task that receives the notifications. */
+#define notifyTASK_PRIORITY			( tskIDLE_PRIORITY )
+
+/* A block time of zero simply means "don't block". */
+#define notifyDONT_BLOCK			( ( TickType_t ) 0 )
+
+/* Time used by the single task tests to check timeouts. */
+#define notifySHORT_DELAY			( ( TickType_t ) 10 )
+
+/* The bits set by each notification source. */
+#define notifyTIMER_BIT				( 0x01UL )
+#define notifyISR_BIT				( 0x02UL )
+#define notifyALL_BITS				( notifyTIMER_BIT | notifyISR_BIT )
+
+/* The ISR notifies the task every notifyISR_PERIOD ticks. */
+#define notifyISR_PERIOD			( ( TickType_t ) 7 )
+
+/* The software timer period cycles from 1 to notifyMAX_TIMER_PERIOD ticks. */
+#define notifyMAX_TIMER_PERIOD		( ( TickType_t ) 13 )
+
+/* The maximum time the task waits for a notification before an error is
+latched.  Generous to allow for the other demo tasks. */
+#define notifyMAX_WAIT				( ( TickType_t ) 500 / portTICK_PERIOD_MS )
+
+/* Values used by the single task tests. */
+#define notifyTEST_VALUE_1			( 0x55aa55aaUL )
+#define notifyTEST_VALUE_2			( 0x12345678UL )
+#define notifyINCREMENT_LOOPS		( 10UL )
+#define notifyMAX_VALUE				( 0xffffffffUL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that receives the notifications, as described at the top of this
+ * file.
+ */
+static void prvNotifiedTask( void *pvParameters );
+
+/*
+ * Tests that the notified task can perform on its own.
+ */
+static void prvSingleTaskTests( void );
+
+/*
+ * Callback of the one shot software timer used to notify the task.
+ */
+static void prvNotifyingTimer( TimerHandle_t xTimer );
+
+/*-----------------------------------------------------------*/
+
+/* Used to latch errors found by the task or the ISR. */
+static volatile portBASE_TYPE xErrorStatus = pdPASS;
+
+/* Incremented each time the notified task receives a notification from both
+sources. */
+static volatile unsigned long ulNotifyCycleCount = 0UL;
+
+/* The task that is notified and the timer that notifies it. */
+static TaskHandle_t xTaskToNotify = NULL;
+static TimerHandle_t xNotifyingTimer = NULL;
+
+/* The ISR does not send notifications until the single task tests, which
+expect to be the only source of notifications, have completed. */
+static volatile portBASE_TYPE xSingleTaskTestsComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartTaskNotifyTask( void )
+{
+	/* Create the timer used to send notifications from the timer service
+	task.  Its period is changed before each time it is started. */
+	xNotifyingTimer = xTimerCreate( "Notifier", notifyMAX_TIMER_PERIOD, pdFALSE, NULL, prvNotifyingTimer );
+	configASSERT( xNotifyingTimer );
+
+	xTaskCreate( prvNotifiedTask, "Notified", configMINIMAL_STACK_SIZE, NULL, notifyTASK_PRIORITY, &xTaskToNotify );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSingleTaskTests( void )
+{
+uint32_t ulNotifiedValue, ulLoop, ulPreviousValue;
+TickType_t xTimeOnEntering;
+BaseType_t xReturned;
+
+	/* ------------------------------------------------------------------------
+	Check blocking when there are no notifications. */
+	xTimeOnEntering = xTaskGetTickCount();
+	ulNotifiedValue = ulTaskNotifyTake( pdTRUE, notifySHORT_DELAY );
+
+	/* No notification was sent, so zero should be returned, and the task
+	should have blocked for the whole timeout. */
+	if( ulNotifiedValue != 0UL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeOnEntering ) < notifySHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xTimeOnEntering = xTaskGetTickCount();
+	xReturned = xTaskNotifyWait( 0UL, 0UL, &ulNotifiedValue, notifySHORT_DELAY );
+
+	if( xReturned != pdFALSE )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ( xTaskGetTickCount() - xTimeOnEntering ) < notifySHORT_DELAY )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+
+	/* ------------------------------------------------------------------------
+	Check eSetValueWithoutOverwrite.  The first notification should succeed,
+	the second should fail as the first has not been read. */
+	if( xTaskNotify( xTaskToNotify, notifyTEST_VALUE_1, eSetValueWithoutOverwrite ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( xTaskNotify( xTaskToNotify, notifyTEST_VALUE_2, eSetValueWithoutOverwrite ) != pdFAIL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* The notification is pending, so the task should not block, and the
+	value from the first notification should be received. */
+	xReturned = xTaskNotifyWait( 0UL, 0UL, &ulNotifiedValue, notifyDONT_BLOCK );
+
+	if( ( xReturned != pdTRUE ) || ( ulNotifiedValue != notifyTEST_VALUE_1 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+
+	/* ------------------------------------------------------------------------
+	Check eSetValueWithOverwrite.  Both notifications should succeed and the
+	value from the second should be received. */
+	xTaskNotify( xTaskToNotify, notifyTEST_VALUE_1, eSetValueWithOverwrite );
+
+	if( xTaskNotify( xTaskToNotify, notifyTEST_VALUE_2, eSetValueWithOverwrite ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	xReturned = xTaskNotifyWait( 0UL, 0UL, &ulNotifiedValue, notifyDONT_BLOCK );
+
+	if( ( xReturned != pdTRUE ) || ( ulNotifiedValue != notifyTEST_VALUE_2 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+
+	/* ------------------------------------------------------------------------
+	Check eNoAction.  The task should be notified but its value should not
+	change. */
+	xTaskNotify( xTaskToNotify, notifyTEST_VALUE_1, eNoAction );
+	xReturned = xTaskNotifyWait( 0UL, 0UL, &ulNotifiedValue, notifyDONT_BLOCK );
+
+	if( ( xReturned != pdTRUE ) || ( ulNotifiedValue != notifyTEST_VALUE_2 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+
+	/* ------------------------------------------------------------------------
+	Check bits are cleared on entry only if a notification is not already
+	pending, and cleared on exit only if a notification was received. */
+	xTaskNotify( xTaskToNotify, notifyTEST_VALUE_1, eSetValueWithOverwrite );
+	xReturned = xTaskNotifyWait( notifyMAX_VALUE, notifyTEST_VALUE_1, &ulNotifiedValue, notifyDONT_BLOCK );
+
+	if( ( xReturned != pdTRUE ) || ( ulNotifiedValue != notifyTEST_VALUE_1 ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* No notification is pending now, so the bits should be cleared on entry.
+	The exit bits should not be cleared as nothing was received. */
+	xTaskNotify( xTaskToNotify, notifyTEST_VALUE_2, eSetValueWithOverwrite );
+	( void ) xTaskNotifyStateClear( NULL );
+	xReturned = xTaskNotifyWait( notifyTEST_VALUE_2, notifyMAX_VALUE, &ulNotifiedValue, notifyDONT_BLOCK );
+
+	if( ( xReturned != pdFALSE ) || ( ulNotifiedValue != 0UL ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+
+	/* ------------------------------------------------------------------------
+	Check eSetBits, using the notification value as an event group. */
+	for( ulLoop = 0UL; ulLoop < 32UL; ulLoop++ )
+	{
+		xTaskNotify( xTaskToNotify, ( 1UL << ulLoop ), eSetBits );
+	}
+
+	xReturned = xTaskNotifyWait( 0UL, 0x0000ffffUL, &ulNotifiedValue, notifyDONT_BLOCK );
+
+	if( ( xReturned != pdTRUE ) || ( ulNotifiedValue != notifyMAX_VALUE ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Only the top bits should remain, and no notification is pending. */
+	xReturned = xTaskNotifyWait( 0UL, notifyMAX_VALUE, &ulNotifiedValue, notifyDONT_BLOCK );
+
+	if( ( xReturned != pdFALSE ) || ( ulNotifiedValue != 0xffff0000UL ) )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+
+	/* ------------------------------------------------------------------------
+	Check eIncrement, using the notification value as a counting semaphore. */
+	( void ) xTaskNotifyWait( notifyMAX_VALUE, 0UL, NULL, notifyDONT_BLOCK );
+
+	for( ulLoop = 0UL; ulLoop < notifyINCREMENT_LOOPS; ulLoop++ )
+	{
+		xTaskNotifyGive( xTaskToNotify );
+	}
+
+	/* Taking without clearing should decrement the count by one each time. */
+	for( ulLoop = notifyINCREMENT_LOOPS; ulLoop > ( notifyINCREMENT_LOOPS / 2UL ); ulLoop-- )
+	{
+		if( ulTaskNotifyTake( pdFALSE, notifyDONT_BLOCK ) != ulLoop )
+		{
+			xErrorStatus = pdFAIL;
+		}
+	}
+
+	/* Taking with clearing should return the remaining count then zero. */
+	if( ulTaskNotifyTake( pdTRUE, notifyDONT_BLOCK ) != ulLoop )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( ulTaskNotifyTake( pdTRUE, notifyDONT_BLOCK ) != 0UL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+
+	/* ------------------------------------------------------------------------
+	Check xTaskNotifyAndQuery() returns the value from before the update, and
+	xTaskNotifyStateClear() reports whether a notification was pending. */
+	xTaskNotify( xTaskToNotify, notifyTEST_VALUE_1, eSetValueWithOverwrite );
+	xTaskNotifyAndQuery( xTaskToNotify, notifyTEST_VALUE_2, eSetValueWithOverwrite, &ulPreviousValue );
+
+	if( ulPreviousValue != notifyTEST_VALUE_1 )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( xTaskNotifyStateClear( NULL ) != pdPASS )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	if( xTaskNotifyStateClear( xTaskToNotify ) != pdFAIL )
+	{
+		xErrorStatus = pdFAIL;
+	}
+
+	/* Leave the notification value clear for the ISR and timer tests. */
+	( void ) xTaskNotifyWait( notifyMAX_VALUE, 0UL, NULL, notifyDONT_BLOCK );
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifiedTask( void *pvParameters )
+{
+TickType_t xTimerPeriod = ( TickType_t ) 1;
+uint32_t ulNotifiedValue, ulBitsReceived;
+
+	/* Remove compiler warnings about unused parameters. */
+	( void ) pvParameters;
+
+	prvSingleTaskTests();
+	xSingleTaskTestsComplete = pdTRUE;
+
+	for( ;; )
+	{
+		/* Start the timer with a different period each cycle. */
+		xTimerChangePeriod( xNotifyingTimer, xTimerPeriod, portMAX_DELAY );
+
+		xTimerPeriod++;
+		if( xTimerPeriod > notifyMAX_TIMER_PERIOD )
+		{
+			xTimerPeriod = ( TickType_t ) 1;
+		}
+
+		/* Wait until both the timer and the ISR have notified this task.  Bits
+		are cleared on exit so each notification is only counted once. */
+		ulBitsReceived = 0UL;
+		while( ulBitsReceived != notifyALL_BITS )
+		{
+			if( xTaskNotifyWait( 0UL, notifyALL_BITS, &ulNotifiedValue, notifyMAX_WAIT ) == pdFALSE )
+			{
+				/* Timed out. */
+				xErrorStatus = pdFAIL;
+				break;
+			}
+
+			if( ( ulNotifiedValue & ~notifyALL_BITS ) != 0UL )
+			{
+				/* Only the bits set by the timer and ISR should be set. */
+				xErrorStatus = pdFAIL;
+			}
+
+			ulBitsReceived |= ulNotifiedValue;
+		}
+
+		if( xErrorStatus == pdPASS )
+		{
+			ulNotifyCycleCount++;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyingTimer( TimerHandle_t xTimer )
+{
+	( void ) xTimer;
+
+	xTaskNotify( xTaskToNotify, notifyTIMER_BIT, eSetBits );
+}
+/*-----------------------------------------------------------*/
+
+void vNotifyTaskFromISR( void )
+{
+static TickType_t xCallCount = 0;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	/* The task is notified every notifyISR_PERIOD ticks.  This function should
+	be called from an interrupt, such as the tick hook function
+	vApplicationTickHook(). */
+	if( xSingleTaskTestsComplete != pdFALSE )
+	{
+		xCallCount++;
+
+		if( xCallCount >= notifyISR_PERIOD )
+		{
+			xCallCount = 0;
+			xTaskNotifyFromISR( xTaskToNotify, notifyISR_BIT, eSetBits, &xHigherPriorityTaskWoken );
+			portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+portBASE_TYPE xAreTaskNotificationTasksStillRunning( void )
+{
+static unsigned long ulLastNotifyCycleCount = 0UL;
+portBASE_TYPE xReturn = pdPASS;
+
+	/* Check the cycle count is still incrementing to ensure the task is still
+	receiving notifications. */
+	if( ulLastNotifyCycleCount == ulNotifyCycleCount )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastNotifyCycleCount = ulNotifyCycleCount;
+
+	if( xErrorStatus != pdPASS )
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,404 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares creating kernel objects from the FreeRTOS heap with creating them
+ * from memory supplied by the application (configSUPPORT_STATIC_ALLOCATION).
+ *
+ * vRunAllocationBenchmark() must be called from main() before the scheduler is
+ * started, and before any other tasks are created, as it measures the part of
+ * the boot process that creates the application's kernel objects:
+ *
+ *   + The "boot set" - albNUM_TASKS tasks, albNUM_QUEUES queues,
+ *     albNUM_SEMAPHORES semaphores and mutexes, albNUM_EVENT_GROUPS event
+ *     groups, albNUM_TIMERS timers and albNUM_STREAM_BUFFERS stream buffers -
+ *     is created once dynamically and once statically.  The time taken and the
+ *     heap consumed are recorded.  The objects are never deleted.  The tasks
+ *     are suspended as soon as they are created so they never run, and so they
+ *     do not upset the task count checked by death.c.
+ *
+ *   + A queue, a binary semaphore, a mutex, an event group and a stream buffer
+ *     are created and deleted albCYCLES times, dynamically and then
+ *     statically, to measure the cost of allocation alone.
+ *
+ * vAllocationBenchmarkPrintResults() prints the results, along with the heap
+ * high water mark for the whole run, once the scheduler has been ended.  Note
+ * the time to create a task on this port is dominated by the creation of the
+ * host thread.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+#include "timers.h"
+#include "stream_buffer.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "AllocationBenchmark.h"
+
+#if( ( configSUPPORT_STATIC_ALLOCATION != 1 ) || ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) )
+	#error AllocationBenchmark.c requires both configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION to be 1.
+#endif
+
+/* The number of each object type in the boot set. */
+#define albNUM_TASKS				( 4 )
+#define albNUM_QUEUES				( 4 )
+#define albNUM_SEMAPHORES			( 4 )
+#define albNUM_EVENT_GROUPS			( 2 )
+#define albNUM_TIMERS				( 2 )
+#define albNUM_STREAM_BUFFERS		( 2 )
+
+/* The dimensions of the objects. */
+#define albQUEUE_LENGTH				( 10 )
+#define albQUEUE_ITEM_SIZE			( sizeof( uint32_t ) )
+#define albSTREAM_BUFFER_SIZE		( ( size_t ) 64 )
+#define albTIMER_PERIOD				( ( TickType_t ) 100 )
+
+/* The number of times the create/delete cycle is repeated. */
+#define albCYCLES					( 1000UL )
+
+/* The results of creating the boot set, or of the create/delete cycles, using
+one allocation method. */
+typedef struct ALLOCATION_BENCHMARK_RESULT
+{
+	uint64_t ullBootSetNs;
+	size_t xBootSetHeapBytes;
+	uint64_t ullCyclesNs;
+	size_t xCyclesHeapLeakBytes;
+} AllocationBenchmarkResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Create the boot set, dynamically if xStatic is pdFALSE and statically if
+ * xStatic is pdTRUE.
+ */
+static void prvCreateBootSet( BaseType_t xStatic );
+
+/*
+ * Create then delete the create/delete cycle objects once.
+ */
+static void prvCreateAndDeleteDynamically( void );
+static void prvCreateAndDeleteStatically( void );
+
+/*
+ * The function that implements the boot set tasks, which never actually run.
+ */
+static void prvBootSetTask( void *pvParameters );
+
+/*
+ * The callback of the boot set timers, which are never started.
+ */
+static void prvBootSetTimerCallback( TimerHandle_t xTimer );
+
+/*-----------------------------------------------------------*/
+
+/* Memory for the statically allocated boot set.  The objects exist for the
+life of the demo, so the memory must too. */
+static StaticTask_t xTaskBuffers[ albNUM_TASKS ];
+static StackType_t uxTaskStacks[ albNUM_TASKS ][ configMINIMAL_STACK_SIZE ];
+static StaticQueue_t xQueueBuffers[ albNUM_QUEUES ];
+static uint8_t ucQueueStorage[ albNUM_QUEUES ][ albQUEUE_LENGTH * albQUEUE_ITEM_SIZE ];
+static StaticSemaphore_t xSemaphoreBuffers[ albNUM_SEMAPHORES ];
+static StaticEventGroup_t xEventGroupBuffers[ albNUM_EVENT_GROUPS ];
+static StaticTimer_t xTimerBuffers[ albNUM_TIMERS ];
+static StaticStreamBuffer_t xStreamBufferBuffers[ albNUM_STREAM_BUFFERS ];
+static uint8_t ucStreamBufferStorage[ albNUM_STREAM_BUFFERS ][ albSTREAM_BUFFER_SIZE + 1 ];
+
+/* Memory reused by each statically allocated create/delete cycle. */
+static StaticQueue_t xCycleQueueBuffer;
+static uint8_t ucCycleQueueStorage[ albQUEUE_LENGTH * albQUEUE_ITEM_SIZE ];
+static StaticSemaphore_t xCycleSemaphoreBuffer, xCycleMutexBuffer;
+static StaticEventGroup_t xCycleEventGroupBuffer;
+static StaticStreamBuffer_t xCycleStreamBufferBuffer;
+static uint8_t ucCycleStreamBufferStorage[ albSTREAM_BUFFER_SIZE + 1 ];
+
+/* Index 0 holds the dynamic results, index 1 the static results. */
+static AllocationBenchmarkResult_t xResults[ 2 ];
+
+/*-----------------------------------------------------------*/
+
+void vRunAllocationBenchmark( void )
+{
+BaseType_t xStatic;
+size_t xFreeHeapBefore;
+uint64_t ullStartTime;
+uint32_t ulCycle;
+
+	for( xStatic = pdFALSE; xStatic <= pdTRUE; xStatic++ )
+	{
+		xFreeHeapBefore = xPortGetFreeHeapSize();
+		ullStartTime = ullBenchmarkGetTimeNs();
+		prvCreateBootSet( xStatic );
+		xResults[ xStatic ].ullBootSetNs = ullBenchmarkGetTimeNs() - ullStartTime;
+		xResults[ xStatic ].xBootSetHeapBytes = xFreeHeapBefore - xPortGetFreeHeapSize();
+
+		xFreeHeapBefore = xPortGetFreeHeapSize();
+		ullStartTime = ullBenchmarkGetTimeNs();
+
+		for( ulCycle = 0UL; ulCycle < albCYCLES; ulCycle++ )
+		{
+			if( xStatic == pdFALSE )
+			{
+				prvCreateAndDeleteDynamically();
+			}
+			else
+			{
+				prvCreateAndDeleteStatically();
+			}
+		}
+
+		xResults[ xStatic ].ullCyclesNs = ullBenchmarkGetTimeNs() - ullStartTime;
+		xResults[ xStatic ].xCyclesHeapLeakBytes = xFreeHeapBefore - xPortGetFreeHeapSize();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateBootSet( BaseType_t xStatic )
+{
+TaskHandle_t xTask;
+SemaphoreHandle_t xSemaphore;
+UBaseType_t ux;
+
+	for( ux = 0; ux < albNUM_TASKS; ux++ )
+	{
+		if( xStatic == pdFALSE )
+		{
+			xTaskCreate( prvBootSetTask, "AllocDyn", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, &xTask );
+		}
+		else
+		{
+			xTask = xTaskCreateStatic( prvBootSetTask, "AllocStat", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, uxTaskStacks[ ux ], &( xTaskBuffers[ ux ] ) );
+		}
+
+		configASSERT( xTask );
+		vTaskSuspend( xTask );
+	}
+
+	for( ux = 0; ux < albNUM_QUEUES; ux++ )
+	{
+		if( xStatic == pdFALSE )
+		{
+			configASSERT( xQueueCreate( albQUEUE_LENGTH, albQUEUE_ITEM_SIZE ) );
+		}
+		else
+		{
+			configASSERT( xQueueCreateStatic( albQUEUE_LENGTH, albQUEUE_ITEM_SIZE, ucQueueStorage[ ux ], &( xQueueBuffers[ ux ] ) ) );
+		}
+	}
+
+	/* Half binary semaphores, half mutexes. */
+	for( ux = 0; ux < albNUM_SEMAPHORES; ux++ )
+	{
+		if( xStatic == pdFALSE )
+		{
+			xSemaphore = ( ( ux & 1 ) == 0 ) ? xSemaphoreCreateBinary() : xSemaphoreCreateMutex();
+		}
+		else
+		{
+			xSemaphore = ( ( ux & 1 ) == 0 ) ? xSemaphoreCreateBinaryStatic( &( xSemaphoreBuffers[ ux ] ) ) : xSemaphoreCreateMutexStatic( &( xSemaphoreBuffers[ ux ] ) );
+		}
+
+		configASSERT( xSemaphore );
+	}
+
+	for( ux = 0; ux < albNUM_EVENT_GROUPS; ux++ )
+	{
+		if( xStatic == pdFALSE )
+		{
+			configASSERT( xEventGroupCreate() );
+		}
+		else
+		{
+			configASSERT( xEventGroupCreateStatic( &( xEventGroupBuffers[ ux ] ) ) );
+		}
+	}
+
+	for( ux = 0; ux < albNUM_TIMERS; ux++ )
+	{
+		if( xStatic == pdFALSE )
+		{
+			configASSERT( xTimerCreate( "AllocDyn", albTIMER_PERIOD, pdTRUE, NULL, prvBootSetTimerCallback ) );
+		}
+		else
+		{
+			configASSERT( xTimerCreateStatic( "AllocStat", albTIMER_PERIOD, pdTRUE, NULL, prvBootSetTimerCallback, &( xTimerBuffers[ ux ] ) ) );
+		}
+	}
+
+	for( ux = 0; ux < albNUM_STREAM_BUFFERS; ux++ )
+	{
+		if( xStatic == pdFALSE )
+		{
+			configASSERT( xStreamBufferCreate( albSTREAM_BUFFER_SIZE, 1 ) );
+		}
+		else
+		{
+			configASSERT( xStreamBufferCreateStatic( albSTREAM_BUFFER_SIZE, 1, ucStreamBufferStorage[ ux ], &( xStreamBufferBuffers[ ux ] ) ) );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateAndDeleteDynamically( void )
+{
+QueueHandle_t xQueue;
+SemaphoreHandle_t xSemaphore, xMutex;
+EventGroupHandle_t xEventGroup;
+StreamBufferHandle_t xStreamBuffer;
+
+	xQueue = xQueueCreate( albQUEUE_LENGTH, albQUEUE_ITEM_SIZE );
+	xSemaphore = xSemaphoreCreateBinary();
+	xMutex = xSemaphoreCreateMutex();
+	xEventGroup = xEventGroupCreate();
+	xStreamBuffer = xStreamBufferCreate( albSTREAM_BUFFER_SIZE, 1 );
+
+	vStreamBufferDelete( xStreamBuffer );
+	vEventGroupDelete( xEventGroup );
+	vSemaphoreDelete( xMutex );
+	vSemaphoreDelete( xSemaphore );
+	vQueueDelete( xQueue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCreateAndDeleteStatically( void )
+{
+QueueHandle_t xQueue;
+SemaphoreHandle_t xSemaphore, xMutex;
+EventGroupHandle_t xEventGroup;
+StreamBufferHandle_t xStreamBuffer;
+
+	xQueue = xQueueCreateStatic( albQUEUE_LENGTH, albQUEUE_ITEM_SIZE, ucCycleQueueStorage, &xCycleQueueBuffer );
+	xSemaphore = xSemaphoreCreateBinaryStatic( &xCycleSemaphoreBuffer );
+	xMutex = xSemaphoreCreateMutexStatic( &xCycleMutexBuffer );
+	xEventGroup = xEventGroupCreateStatic( &xCycleEventGroupBuffer );
+	xStreamBuffer = xStreamBufferCreateStatic( albSTREAM_BUFFER_SIZE, 1, ucCycleStreamBufferStorage, &xCycleStreamBufferBuffer );
+
+	vStreamBufferDelete( xStreamBuffer );
+	vEventGroupDelete( xEventGroup );
+	vSemaphoreDelete( xMutex );
+	vSemaphoreDelete( xSemaphore );
+	vQueueDelete( xQueue );
+}
+/*-----------------------------------------------------------*/
+
+static void prvBootSetTask( void *pvParameters )
+{
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	/* Should never run, as the task is suspended when it is created. */
+	for( ;; )
+	{
+		vTaskSuspend( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBootSetTimerCallback( TimerHandle_t xTimer )
+{
+	/* The timers are never started. */
+	( void ) xTimer;
+}
+/*-----------------------------------------------------------*/
+
+void vAllocationBenchmarkPrintResults( void )
+{
+static const char * const pcMethod[ 2 ] = { "dynamic", "static" };
+char cName[ 64 ];
+BaseType_t xStatic;
+
+	for( xStatic = pdFALSE; xStatic <= pdTRUE; xStatic++ )
+	{
+		snprintf( cName, sizeof( cName ), "Create boot set, %s", pcMethod[ xStatic ] );
+		vBenchmarkPrintRate( cName, 1UL, xResults[ xStatic ].ullBootSetNs );
+		printf( "Heap used by boot set, %s: %lu bytes\r\n", pcMethod[ xStatic ], ( unsigned long ) xResults[ xStatic ].xBootSetHeapBytes );
+
+		snprintf( cName, sizeof( cName ), "Create and delete cycle, %s", pcMethod[ xStatic ] );
+		vBenchmarkPrintRate( cName, albCYCLES, xResults[ xStatic ].ullCyclesNs );
+
+		if( xResults[ xStatic ].xCyclesHeapLeakBytes != ( size_t ) 0 )
+		{
+			printf( "Create and delete cycle, %s: %lu bytes not returned to the heap\r\n", pcMethod[ xStatic ], ( unsigned long ) xResults[ xStatic ].xCyclesHeapLeakBytes );
+		}
+	}
+
+	/* A heap that has had regions added to it, such as heap_regions.c with
+	RegionHeapDemo.c, is larger than the heap array, and the usage of each
+	region is reported separately. */
+	if( xPortGetMinimumEverFreeHeapSize() <= configTOTAL_HEAP_SIZE )
+	{
+		printf( "Heap high water mark: %lu of %lu bytes\r\n", ( unsigned long ) ( configTOTAL_HEAP_SIZE - xPortGetMinimumEverFreeHeapSize() ), ( unsigned long ) configTOTAL_HEAP_SIZE );
+	}
+}
+/*-----------------------------------------------------------*/
+
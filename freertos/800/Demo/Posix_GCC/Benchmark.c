@@ -0,0 +1,197 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Helpers shared by the benchmarks that run in the POSIX simulator.  See
+ * Benchmark.h.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <time.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+
+/* Used to convert between the units used in the measurements. */
+#define benchNS_PER_SECOND				( 1000000000ULL )
+#define benchNS_PER_US					( 1000ULL )
+#define benchBYTES_PER_KB				( 1024ULL )
+
+/*-----------------------------------------------------------*/
+
+uint64_t ullBenchmarkGetTimeNs( void )
+{
+struct timespec xNow;
+
+	clock_gettime( CLOCK_MONOTONIC, &xNow );
+	return ( ( uint64_t ) xNow.tv_sec * benchNS_PER_SECOND ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullBenchmarkGetCpuTimeNs( void )
+{
+struct timespec xNow;
+
+	clock_gettime( CLOCK_PROCESS_CPUTIME_ID, &xNow );
+	return ( ( uint64_t ) xNow.tv_sec * benchNS_PER_SECOND ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullBenchmarkGetTaskCpuTimeNs( void )
+{
+struct timespec xNow;
+
+	clock_gettime( CLOCK_THREAD_CPUTIME_ID, &xNow );
+	return ( ( uint64_t ) xNow.tv_sec * benchNS_PER_SECOND ) + ( uint64_t ) xNow.tv_nsec;
+}
+/*-----------------------------------------------------------*/
+
+void vBenchmarkAddSample( BenchmarkStats_t *pxStats, uint64_t ullSample )
+{
+	if( ullSample < pxStats->ullMin )
+	{
+		pxStats->ullMin = ullSample;
+	}
+
+	if( ullSample > pxStats->ullMax )
+	{
+		pxStats->ullMax = ullSample;
+	}
+
+	pxStats->ullTotal += ullSample;
+	pxStats->ulSamples++;
+}
+/*-----------------------------------------------------------*/
+
+void vBenchmarkPrintStats( const BenchmarkStats_t *pxStats )
+{
+uint64_t ullAverage;
+
+	if( pxStats->ulSamples > 0UL )
+	{
+		ullAverage = pxStats->ullTotal / pxStats->ulSamples;
+
+		printf( "%s: min %llu.%03lluus, avg %llu.%03lluus, max %llu.%03lluus, %lu samples\r\n",
+				pxStats->pcName,
+				( unsigned long long ) ( pxStats->ullMin / benchNS_PER_US ), ( unsigned long long ) ( pxStats->ullMin % benchNS_PER_US ),
+				( unsigned long long ) ( ullAverage / benchNS_PER_US ), ( unsigned long long ) ( ullAverage % benchNS_PER_US ),
+				( unsigned long long ) ( pxStats->ullMax / benchNS_PER_US ), ( unsigned long long ) ( pxStats->ullMax % benchNS_PER_US ),
+				( unsigned long ) pxStats->ulSamples );
+	}
+	else
+	{
+		printf( "%s: no samples\r\n", pxStats->pcName );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vBenchmarkPrintRate( const char *pcName, uint32_t ulOperations, uint64_t ullElapsedNs )
+{
+uint64_t ullPerOperation, ullPerSecond;
+
+	if( ( ulOperations > 0UL ) && ( ullElapsedNs > 0ULL ) )
+	{
+		ullPerOperation = ullElapsedNs / ulOperations;
+		ullPerSecond = ( ( uint64_t ) ulOperations * benchNS_PER_SECOND ) / ullElapsedNs;
+
+		printf( "%s: %llu.%03lluus per operation, %llu per second, %lu operations\r\n",
+				pcName,
+				( unsigned long long ) ( ullPerOperation / benchNS_PER_US ), ( unsigned long long ) ( ullPerOperation % benchNS_PER_US ),
+				( unsigned long long ) ullPerSecond,
+				( unsigned long ) ulOperations );
+	}
+	else
+	{
+		printf( "%s: not run\r\n", pcName );
+	}
+}
+/*-----------------------------------------------------------*/
+
+
+void vBenchmarkPrintThroughput( const char *pcName, uint32_t ulBytes, uint64_t ullElapsedNs, uint64_t ullCpuNs )
+{
+uint64_t ullBytesPerSecond, ullCpuPerKilobyte;
+
+	if( ( ulBytes > 0UL ) && ( ullElapsedNs > 0ULL ) )
+	{
+		ullBytesPerSecond = ( ( uint64_t ) ulBytes * benchNS_PER_SECOND ) / ullElapsedNs;
+		ullCpuPerKilobyte = ( ullCpuNs * benchBYTES_PER_KB ) / ulBytes;
+
+		printf( "%s: %llu KB/s, %llu.%03lluus CPU per KB, %lu bytes\r\n",
+				pcName,
+				( unsigned long long ) ( ullBytesPerSecond / benchBYTES_PER_KB ),
+				( unsigned long long ) ( ullCpuPerKilobyte / benchNS_PER_US ), ( unsigned long long ) ( ullCpuPerKilobyte % benchNS_PER_US ),
+				( unsigned long ) ulBytes );
+	}
+	else
+	{
+		printf( "%s: not run\r\n", pcName );
+	}
+}
+/*-----------------------------------------------------------*/
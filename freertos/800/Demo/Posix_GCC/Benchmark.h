@@ -0,0 +1,133 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Helpers shared by the benchmarks that run in the POSIX simulator.  Times are
+ * measured in nanoseconds using the host's monotonic clock, which (unlike the
+ * run time stats counter) can be read from both tasks and the tick interrupt.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/* Accumulates the samples taken by one latency or duration measurement. */
+typedef struct BENCHMARK_STATS
+{
+	const char *pcName;
+	uint64_t ullMin;
+	uint64_t ullMax;
+	uint64_t ullTotal;
+	uint32_t ulSamples;
+} BenchmarkStats_t;
+
+/* Used to statically initialise a BenchmarkStats_t structure. */
+#define benchmarkSTATS_INIT( pcName )	{ ( pcName ), UINT64_MAX, 0ULL, 0ULL, 0UL }
+
+/*
+ * Read the host's monotonic clock in nanoseconds.
+ */
+uint64_t ullBenchmarkGetTimeNs( void );
+
+/*
+ * Read the processor time consumed by the whole process, in nanoseconds.  As
+ * only one task runs at a time this includes the time spent in the tasks being
+ * measured, the kernel and the tick interrupt, but not time spent idle.
+ */
+uint64_t ullBenchmarkGetCpuTimeNs( void );
+
+/*
+ * Read the processor time consumed by the calling task, in nanoseconds.  This
+ * relies on the POSIX port running each task in its own host thread.
+ */
+uint64_t ullBenchmarkGetTaskCpuTimeNs( void );
+
+/*
+ * Add a sample to a set of measurements.  The caller must ensure the set is
+ * not updated from more than one task or interrupt at a time.
+ */
+void vBenchmarkAddSample( BenchmarkStats_t *pxStats, uint64_t ullSample );
+
+/*
+ * Print the minimum, average and maximum of a set of measurements.  Only call
+ * once the scheduler has been ended.
+ */
+void vBenchmarkPrintStats( const BenchmarkStats_t *pxStats );
+
+/*
+ * Print the average time taken by, and the rate of, ulOperations operations
+ * that took ullElapsedNs in total.  Only call once the scheduler has been
+ * ended.
+ */
+void vBenchmarkPrintRate( const char *pcName, uint32_t ulOperations, uint64_t ullElapsedNs );
+
+/*
+ * Print the throughput achieved when ulBytes bytes were transferred in
+ * ullElapsedNs, and the processor time used per byte.  Only call once the
+ * scheduler has been ended.
+ */
+void vBenchmarkPrintThroughput( const char *pcName, uint32_t ulBytes, uint64_t ullElapsedNs, uint64_t ullCpuNs );
+
+#endif /* BENCHMARK_H */
+
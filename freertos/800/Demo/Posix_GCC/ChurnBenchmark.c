@@ -0,0 +1,339 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the cost of creating and deleting kernel objects over and over
+ * again - the pattern a size class front end such as heap_slab.c is designed
+ * for - so the heaps can be compared by building the demo with each of them.
+ *
+ * The benchmark task first fragments the heap, by allocating cbBACKGROUND_BLOCKS
+ * blocks of assorted sizes and freeing every other one, so the free list
+ * searched by heap_4.c is not trivially short.  Then:
+ *
+ *   + A queue is created and deleted cbQUEUE_CYCLES times.  Each cycle makes
+ *     one allocation and one free.
+ *
+ *   + A task is created and deleted cbTASK_CYCLES times, in batches of
+ *     cbTASK_BATCH.  Each cycle allocates a TCB and a stack, which the idle
+ *     task frees after each batch, while the benchmark task is blocked.  The
+ *     time to create a task on this port is dominated by the creation of the
+ *     host thread, so the difference the heap makes is far smaller than it
+ *     would be on a target.
+ *
+ * The heap must have as much free space after the last cycle of each test as
+ * after the first - the first may take slabs from the backing heap.
+ *
+ * The tasks of the standard demo create and delete tasks, and check the number
+ * of tasks, so the benchmark is run on its own rather than with the standard
+ * demo tasks - see main.c.  The results, and the statistics of each size class
+ * when the demo is built with heap_slab.c, are printed once the scheduler has
+ * been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "ChurnBenchmark.h"
+
+#if( INCLUDE_vTaskDelete != 1 )
+	#error ChurnBenchmark.c requires INCLUDE_vTaskDelete to be 1.
+#endif
+
+/* Only heap_slab.c provides the statistics of its size classes.  The
+references are weak so the demo can be built with any heap. */
+extern UBaseType_t uxPortGetSlabClassCount( void ) __attribute__( ( weak ) );
+extern void vPortGetSlabClassStats( UBaseType_t uxClass, SlabClassStats_t *pxStats ) __attribute__( ( weak ) );
+
+/* The blocks used to fragment the heap, whose sizes are spread between
+cbBACKGROUND_MIN_SIZE and cbBACKGROUND_MIN_SIZE + cbBACKGROUND_SPREAD. */
+#define cbBACKGROUND_BLOCKS			( 256UL )
+#define cbBACKGROUND_MIN_SIZE		( ( size_t ) 16 )
+#define cbBACKGROUND_SPREAD			( 1000UL )
+
+/* Used to spread the sizes.  A prime, so consecutive blocks have sizes far
+apart. */
+#define cbSPREAD_MULTIPLIER			( 7919UL )
+
+/* The number of queues created and deleted, and their dimensions. */
+#define cbQUEUE_CYCLES				( 10000UL )
+#define cbQUEUE_LENGTH				( 10 )
+#define cbQUEUE_ITEM_SIZE			( sizeof( uint32_t ) )
+
+/* The number of tasks created and deleted, and the number created and deleted
+before the idle task is given the chance to free them. */
+#define cbTASK_CYCLES				( 1000UL )
+#define cbTASK_BATCH				( 10UL )
+
+/* The time the benchmark task blocks for while the idle task frees the
+deleted tasks. */
+#define cbIDLE_TICKS				( ( TickType_t ) 1 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that fragments the heap then creates and deletes the objects.
+ */
+static void prvChurnBenchmarkTask( void *pvParameters );
+
+/*
+ * The function that implements the created tasks, which never actually run.
+ */
+static void prvChurnTask( void *pvParameters );
+
+/*
+ * Blocks until the idle task has freed every deleted task, which is when the
+ * number of tasks drops back to uxNumberOfTasks.
+ */
+static void prvWaitForDeletedTasks( UBaseType_t uxNumberOfTasks );
+
+/*-----------------------------------------------------------*/
+
+static BenchmarkStats_t xQueueChurn = benchmarkSTATS_INIT( "Queue create and delete" );
+static BenchmarkStats_t xTaskChurn = benchmarkSTATS_INIT( "Task create and delete" );
+
+static void *pvBackgroundBlocks[ cbBACKGROUND_BLOCKS ];
+
+/* The bytes not returned to the heap by each test. */
+static size_t xQueueLeakBytes = 0, xTaskLeakBytes = 0;
+
+/* Incremented by each cycle, so the check task can see the benchmark is
+progressing. */
+static volatile uint32_t ulCycles = 0UL, ulLastCycles = 0UL;
+
+/* Set once both tests have completed. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartChurnBenchmark( UBaseType_t uxPriority )
+{
+	/* The created tasks must not be able to preempt the benchmark task. */
+	configASSERT( uxPriority > tskIDLE_PRIORITY );
+
+	xTaskCreate( prvChurnBenchmarkTask, "ChurnBen", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvChurnBenchmarkTask( void *pvParameters )
+{
+uint32_t ulBlock, ulCycle;
+QueueHandle_t xQueue;
+TaskHandle_t xTask;
+UBaseType_t uxNumberOfTasks;
+size_t xFreeHeapAfterFirstCycle = 0;
+uint64_t ullStartTime;
+
+	( void ) pvParameters;
+
+	for( ulBlock = 0UL; ulBlock < cbBACKGROUND_BLOCKS; ulBlock++ )
+	{
+		pvBackgroundBlocks[ ulBlock ] = pvPortMalloc( cbBACKGROUND_MIN_SIZE + ( size_t ) ( ( ulBlock * cbSPREAD_MULTIPLIER ) % cbBACKGROUND_SPREAD ) );
+		configASSERT( pvBackgroundBlocks[ ulBlock ] );
+	}
+
+	for( ulBlock = 0UL; ulBlock < cbBACKGROUND_BLOCKS; ulBlock += 2UL )
+	{
+		vPortFree( pvBackgroundBlocks[ ulBlock ] );
+		pvBackgroundBlocks[ ulBlock ] = NULL;
+	}
+
+	for( ulCycle = 0UL; ulCycle < cbQUEUE_CYCLES; ulCycle++ )
+	{
+		ullStartTime = ullBenchmarkGetTimeNs();
+		xQueue = xQueueCreate( cbQUEUE_LENGTH, cbQUEUE_ITEM_SIZE );
+		configASSERT( xQueue );
+		vQueueDelete( xQueue );
+		vBenchmarkAddSample( &xQueueChurn, ullBenchmarkGetTimeNs() - ullStartTime );
+
+		if( ulCycle == 0UL )
+		{
+			xFreeHeapAfterFirstCycle = xPortGetFreeHeapSize();
+		}
+
+		ulCycles++;
+	}
+
+	xQueueLeakBytes = xFreeHeapAfterFirstCycle - xPortGetFreeHeapSize();
+
+	uxNumberOfTasks = uxTaskGetNumberOfTasks();
+
+	for( ulCycle = 0UL; ulCycle < cbTASK_CYCLES; ulCycle++ )
+	{
+		ullStartTime = ullBenchmarkGetTimeNs();
+		xTaskCreate( prvChurnTask, "Churn", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, &xTask );
+		configASSERT( xTask );
+		vTaskDelete( xTask );
+		vBenchmarkAddSample( &xTaskChurn, ullBenchmarkGetTimeNs() - ullStartTime );
+
+		if( ( ( ulCycle + 1UL ) % cbTASK_BATCH ) == 0UL )
+		{
+			prvWaitForDeletedTasks( uxNumberOfTasks );
+
+			if( ulCycle == ( cbTASK_BATCH - 1UL ) )
+			{
+				xFreeHeapAfterFirstCycle = xPortGetFreeHeapSize();
+			}
+		}
+
+		ulCycles++;
+	}
+
+	xTaskLeakBytes = xFreeHeapAfterFirstCycle - xPortGetFreeHeapSize();
+
+	for( ulBlock = 1UL; ulBlock < cbBACKGROUND_BLOCKS; ulBlock += 2UL )
+	{
+		vPortFree( pvBackgroundBlocks[ ulBlock ] );
+		pvBackgroundBlocks[ ulBlock ] = NULL;
+	}
+
+	xComplete = pdTRUE;
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaitForDeletedTasks( UBaseType_t uxNumberOfTasks )
+{
+	do
+	{
+		vTaskDelay( cbIDLE_TICKS );
+	} while( uxTaskGetNumberOfTasks() > uxNumberOfTasks );
+
+	/* The idle task removes a task from the count before freeing its memory,
+	so give it the chance to free the last one. */
+	vTaskDelay( cbIDLE_TICKS );
+}
+/*-----------------------------------------------------------*/
+
+static void prvChurnTask( void *pvParameters )
+{
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	/* Should never run, as the task is deleted before the benchmark task
+	blocks. */
+	for( ;; )
+	{
+		vTaskSuspend( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsChurnBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( ( ulCycles == ulLastCycles ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastCycles = ulCycles;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vChurnBenchmarkPrintResults( void )
+{
+UBaseType_t uxClass;
+SlabClassStats_t xStats;
+
+	vBenchmarkPrintStats( &xQueueChurn );
+	vBenchmarkPrintStats( &xTaskChurn );
+
+	if( xQueueLeakBytes != ( size_t ) 0 )
+	{
+		printf( "Queue create and delete: %lu bytes not returned to the heap\r\n", ( unsigned long ) xQueueLeakBytes );
+	}
+
+	if( xTaskLeakBytes != ( size_t ) 0 )
+	{
+		printf( "Task create and delete: %lu bytes not returned to the heap\r\n", ( unsigned long ) xTaskLeakBytes );
+	}
+
+	/* The weak reference is NULL if the heap is not heap_slab.c. */
+	if( uxPortGetSlabClassCount != NULL )
+	{
+		for( uxClass = 0; uxClass < uxPortGetSlabClassCount(); uxClass++ )
+		{
+			vPortGetSlabClassStats( uxClass, &xStats );
+			printf( "Slab class %lu bytes: %lu allocations, %lu in use (max %lu), %lu free, %lu slabs\r\n",
+					( unsigned long ) xStats.xObjectSize,
+					( unsigned long ) xStats.ulAllocations,
+					( unsigned long ) xStats.uxObjectsInUse,
+					( unsigned long ) xStats.uxMaximumObjectsInUse,
+					( unsigned long ) xStats.uxObjectsFree,
+					( unsigned long ) xStats.uxSlabs );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
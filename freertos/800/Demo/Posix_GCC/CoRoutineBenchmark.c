@@ -0,0 +1,595 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares running many small state machines as co-routines with running each
+ * as its own task.  crbMACHINES co-routines, created with
+ * xCoRoutineCreateStatic(), pass a token around a ring: each waits for a
+ * notification in crNOTIFY_WAIT() and then notifies the next.  The benchmark
+ * task runs the co-routines by calling vCoRoutineSchedule().  Then crbMACHINES
+ * tasks pass a token around a ring in the same way using
+ * ulTaskNotifyTake() and xTaskNotifyGive().  For both, the time taken by each
+ * lap of the ring is divided by the number of machines to give the time taken
+ * to hand the token from one machine to the next, and the memory taken by each
+ * machine is reported.  A task also needs its host thread on this port, which
+ * is not counted.  On this port a task switch is a host thread switch, and
+ * each notification and each wait masks the host signals with a system call,
+ * so both times are far longer here than they would be on a target.
+ *
+ * Then a few more co-routines check the other ways a co-routine can wait:
+ *
+ *   + A producer and a consumer co-routine pass sequence numbers through a
+ *     queue, blocking indefinitely in crQUEUE_SEND() and crQUEUE_RECEIVE().
+ *
+ *   + A co-routine waits for a bit in an event group that the benchmark task
+ *     sets every crbEVENT_PERIOD ticks, with a time out short enough that it
+ *     also times out between the bits being set.
+ *
+ *   + The callback of an auto reload software timer notifies a co-routine.
+ *
+ *   + A co-routine runs every crbDELAY_PERIOD ticks using crDELAY_UNTIL().
+ *
+ * The ring tasks run at priorities used by the tasks of the standard demo, so
+ * the benchmark is run on its own - see main.c.  The results are printed once
+ * the scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+#include "event_groups.h"
+#include "croutine.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "CoRoutineBenchmark.h"
+
+#if( ( configUSE_CO_ROUTINES != 1 ) || ( configSUPPORT_STATIC_ALLOCATION != 1 ) || ( configUSE_TASK_NOTIFICATIONS != 1 ) || ( configUSE_TIMERS != 1 ) )
+	#error CoRoutineBenchmark.c requires configUSE_CO_ROUTINES, configSUPPORT_STATIC_ALLOCATION, configUSE_TASK_NOTIFICATIONS and configUSE_TIMERS to be 1.
+#endif
+
+/* The number of state machines in each ring. */
+#define crbMACHINES					( 256 )
+
+/* The number of laps of each ring, and the number of laps of the co-routine
+ring between the delays that let the lower priority tasks run. */
+#define crbCO_ROUTINE_LAPS			( 2000UL )
+#define crbTASK_LAPS				( 200UL )
+#define crbLAPS_PER_DELAY			( 100UL )
+
+/* The co-routine priorities.  The co-routines that wait for time outs, event
+bits and timers run in preference to the queue co-routines, which are always
+ready while the checks run. */
+#define crbRING_PRIORITY			( 1 )
+#define crbWAIT_PRIORITY			( 1 )
+#define crbQUEUE_PRIORITY			( 0 )
+
+/* How long the checks of the other ways of waiting run for, and the number of
+times vCoRoutineSchedule() is called in each tick while they run. */
+#define crbCHECK_TICKS				( ( TickType_t ) 500 )
+#define crbSCHEDULES_PER_TICK		( 8 )
+
+/* The period at which the event bit is set, and the time out of the
+co-routine that waits for it. */
+#define crbEVENT_PERIOD				( ( TickType_t ) 25 )
+#define crbEVENT_TIME_OUT			( ( TickType_t ) 10 )
+#define crbEVENT_BIT				( ( EventBits_t ) 0x01 )
+
+/* The periods of the timer and the crDELAY_UNTIL() co-routine. */
+#define crbTIMER_PERIOD				( ( TickType_t ) 10 )
+#define crbDELAY_PERIOD				( ( TickType_t ) 5 )
+
+/* The length of the queue used by the producer and consumer co-routines. */
+#define crbQUEUE_LENGTH				( 4 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that runs the co-routines and records the times, as described at
+ * the top of this file.
+ */
+static void prvCoRoutineBenchmarkTask( void *pvParameters );
+
+/*
+ * A co-routine in the ring, and a task in the ring.
+ */
+static void prvRingCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+static void prvRingTask( void *pvParameters );
+
+/*
+ * The co-routines that check the other ways of waiting.
+ */
+static void prvProducerCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+static void prvConsumerCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+static void prvEventCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+static void prvTimerCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+static void prvDelayUntilCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex );
+
+/*
+ * The callback of the timer, which notifies prvTimerCoRoutine().
+ */
+static void prvTimerCallback( TimerHandle_t xTimer );
+
+/*
+ * Record the time taken by a lap of a ring, and return pdTRUE if the ring has
+ * run all its laps.
+ */
+static BaseType_t prvEndOfLap( BenchmarkStats_t *pxStats, uint32_t ulTotalLaps );
+
+/*-----------------------------------------------------------*/
+
+/* The ring co-routines, and the result of each one's wait, which must be
+static as the co-routines have no stack. */
+static StaticCoRoutine_t xRingCoRoutines[ crbMACHINES ];
+static CoRoutineHandle_t xRingCoRoutineHandles[ crbMACHINES ];
+static BaseType_t xRingResults[ crbMACHINES ];
+
+/* The ring tasks. */
+static TaskHandle_t xRingTasks[ crbMACHINES ];
+static TaskHandle_t xBenchmarkTask = NULL;
+
+/* The co-routines that check the other ways of waiting. */
+static StaticCoRoutine_t xProducerCoRoutine, xConsumerCoRoutine, xEventCoRoutine, xTimerCoRoutine, xDelayUntilCoRoutine;
+static CoRoutineHandle_t xProducerCoRoutineHandle, xEventCoRoutineHandle, xDelayUntilCoRoutineHandle, xTimerCoRoutineHandle;
+static QueueHandle_t xQueue = NULL;
+static EventGroupHandle_t xEventGroup = NULL;
+static TimerHandle_t xTimer = NULL;
+
+/* Counted by the co-routines that check the other ways of waiting. */
+static volatile uint32_t ulItemsReceived = 0UL, ulEventBitsReceived = 0UL, ulEventTimeOuts = 0UL, ulTimerNotifications = 0UL, ulDelayUntilRuns = 0UL;
+
+/* The results. */
+static BenchmarkStats_t xCoRoutineHandoff = benchmarkSTATS_INIT( "Co-routine ring handoff" );
+static BenchmarkStats_t xTaskHandoff = benchmarkSTATS_INIT( "Task ring handoff" );
+static size_t xTaskBytes = 0;
+
+/* The time the current lap started, or 0 if a lap has not been started, and
+the number of laps run by the ring running now.  The lap count also lets the
+check task see the benchmark is progressing. */
+static uint64_t ullLapStartTime = 0ULL;
+static volatile uint32_t ulLaps = 0UL, ulLastLaps = 0UL;
+
+/* Set when the co-routine ring has run all its laps. */
+static volatile BaseType_t xRingComplete = pdFALSE;
+
+/* Set if a co-routine finds an error, and once the benchmark has finished. */
+static volatile BaseType_t xError = pdFALSE, xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartCoRoutineBenchmark( UBaseType_t uxPriority )
+{
+UBaseType_t uxIndex;
+size_t xFreeBefore;
+
+	configASSERT( uxPriority < ( configMAX_PRIORITIES - 2 ) );
+
+	for( uxIndex = 0; uxIndex < crbMACHINES; uxIndex++ )
+	{
+		xRingCoRoutineHandles[ uxIndex ] = xCoRoutineCreateStatic( prvRingCoRoutine, crbRING_PRIORITY, uxIndex, &( xRingCoRoutines[ uxIndex ] ) );
+	}
+
+	/* The ring tasks run above the benchmark task, so a ring task notified
+	by the benchmark task runs straight away. */
+	xFreeBefore = xPortGetFreeHeapSize();
+
+	for( uxIndex = 0; uxIndex < crbMACHINES; uxIndex++ )
+	{
+		xTaskCreate( prvRingTask, "CrbRing", configMINIMAL_STACK_SIZE, ( void * ) uxIndex, uxPriority + 1, &( xRingTasks[ uxIndex ] ) );
+		configASSERT( xRingTasks[ uxIndex ] );
+	}
+
+	xTaskBytes = ( xFreeBefore - xPortGetFreeHeapSize() ) / crbMACHINES;
+
+	xQueue = xQueueCreate( crbQUEUE_LENGTH, sizeof( uint32_t ) );
+	xEventGroup = xEventGroupCreate();
+	xTimer = xTimerCreate( "CrbTimer", crbTIMER_PERIOD, pdTRUE, NULL, prvTimerCallback );
+	configASSERT( xQueue );
+	configASSERT( xEventGroup );
+	configASSERT( xTimer );
+
+	xProducerCoRoutineHandle = xCoRoutineCreateStatic( prvProducerCoRoutine, crbQUEUE_PRIORITY, 0, &xProducerCoRoutine );
+	( void ) xCoRoutineCreateStatic( prvConsumerCoRoutine, crbQUEUE_PRIORITY, 0, &xConsumerCoRoutine );
+	xEventCoRoutineHandle = xCoRoutineCreateStatic( prvEventCoRoutine, crbWAIT_PRIORITY, 0, &xEventCoRoutine );
+	xTimerCoRoutineHandle = xCoRoutineCreateStatic( prvTimerCoRoutine, crbWAIT_PRIORITY, 0, &xTimerCoRoutine );
+	xDelayUntilCoRoutineHandle = xCoRoutineCreateStatic( prvDelayUntilCoRoutine, crbWAIT_PRIORITY, 0, &xDelayUntilCoRoutine );
+
+	xTaskCreate( prvCoRoutineBenchmarkTask, "CrBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xBenchmarkTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCoRoutineBenchmarkTask( void *pvParameters )
+{
+uint32_t ulLastDelayLaps = 0UL;
+TickType_t xTick, xStartTick, xElapsedTicks;
+UBaseType_t uxSchedule;
+
+	( void ) pvParameters;
+
+	/* Run every co-routine until it blocks, so the ring co-routines all wait
+	for the token and the others wait to be started. */
+	for( uxSchedule = 0; uxSchedule < ( crbMACHINES * 2 ); uxSchedule++ )
+	{
+		vCoRoutineSchedule();
+	}
+
+	/* Hand the token to the first co-routine of the ring, and run the
+	co-routines until the ring has run all its laps.  The first lap starts
+	when the first co-routine receives the token. */
+	xCoRoutineNotify( xRingCoRoutineHandles[ 0 ], 0UL, eNoAction );
+
+	while( xRingComplete == pdFALSE )
+	{
+		vCoRoutineSchedule();
+
+		if( ( ulLaps - ulLastDelayLaps ) >= crbLAPS_PER_DELAY )
+		{
+			ulLastDelayLaps = ulLaps;
+			vTaskDelay( ( TickType_t ) 1 );
+
+			/* Do not record the lap that included the delay. */
+			ullLapStartTime = 0ULL;
+		}
+	}
+
+	/* Then the same for the ring of tasks.  The first task notifies this task
+	once the ring has run all its laps. */
+	ulLaps = 0UL;
+	ullLapStartTime = 0ULL;
+	xTaskNotifyGive( xRingTasks[ 0 ] );
+	ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+	/* Start the co-routines that check the other ways of waiting, and run
+	them for crbCHECK_TICKS ticks. */
+	xCoRoutineNotify( xProducerCoRoutineHandle, 0UL, eNoAction );
+	xCoRoutineNotify( xEventCoRoutineHandle, 0UL, eNoAction );
+	xCoRoutineNotify( xDelayUntilCoRoutineHandle, 0UL, eNoAction );
+	xTimerStart( xTimer, portMAX_DELAY );
+	xStartTick = xTaskGetTickCount();
+
+	for( xTick = 0; xTick < crbCHECK_TICKS; xTick++ )
+	{
+		if( ( xTick % crbEVENT_PERIOD ) == ( crbEVENT_PERIOD - 1 ) )
+		{
+			xEventGroupSetBits( xEventGroup, crbEVENT_BIT );
+		}
+
+		for( uxSchedule = 0; uxSchedule < crbSCHEDULES_PER_TICK; uxSchedule++ )
+		{
+			vCoRoutineSchedule();
+		}
+
+		vTaskDelay( ( TickType_t ) 1 );
+		ulLaps++;
+	}
+
+	xTimerStop( xTimer, portMAX_DELAY );
+	xElapsedTicks = xTaskGetTickCount() - xStartTick;
+
+	/* Allow for the time the co-routines waited to be run.  The periodic
+	co-routine must never run more often than its period. */
+	if( ( ulItemsReceived == 0UL ) ||
+		( ulEventBitsReceived < ( ( crbCHECK_TICKS / crbEVENT_PERIOD ) / 2UL ) ) ||
+		( ulEventTimeOuts == 0UL ) ||
+		( ulTimerNotifications < ( ( crbCHECK_TICKS / crbTIMER_PERIOD ) / 2UL ) ) ||
+		( ulDelayUntilRuns < ( ( crbCHECK_TICKS / crbDELAY_PERIOD ) / 2UL ) ) ||
+		( ulDelayUntilRuns > ( ( xElapsedTicks / crbDELAY_PERIOD ) + 1UL ) ) )
+	{
+		xError = pdTRUE;
+	}
+
+	xComplete = pdTRUE;
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvEndOfLap( BenchmarkStats_t *pxStats, uint32_t ulTotalLaps )
+{
+uint64_t ullNow = ullBenchmarkGetTimeNs();
+
+	/* A start time of 0 means this is the start of the first lap to be
+	recorded. */
+	if( ullLapStartTime != 0ULL )
+	{
+		vBenchmarkAddSample( pxStats, ( ullNow - ullLapStartTime ) / ( uint64_t ) crbMACHINES );
+		ulLaps++;
+	}
+
+	ullLapStartTime = ullNow;
+
+	return ( ulLaps >= ulTotalLaps ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRingCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+	crSTART( xHandle );
+
+	for( ;; )
+	{
+		crNOTIFY_WAIT( xHandle, 0UL, 0UL, NULL, portMAX_DELAY, &( xRingResults[ uxIndex ] ) );
+
+		if( xRingResults[ uxIndex ] != pdTRUE )
+		{
+			/* Should not time out when waiting indefinitely. */
+			xError = pdTRUE;
+		}
+
+		if( uxIndex == 0 )
+		{
+			if( prvEndOfLap( &xCoRoutineHandoff, crbCO_ROUTINE_LAPS ) != pdFALSE )
+			{
+				/* Keep the token. */
+				xRingComplete = pdTRUE;
+				continue;
+			}
+		}
+
+		xCoRoutineNotify( xRingCoRoutineHandles[ ( uxIndex + 1 ) % crbMACHINES ], 0UL, eNoAction );
+	}
+
+	crEND();
+}
+/*-----------------------------------------------------------*/
+
+static void prvRingTask( void *pvParameters )
+{
+const UBaseType_t uxIndex = ( UBaseType_t ) pvParameters;
+
+	for( ;; )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		if( uxIndex == 0 )
+		{
+			if( prvEndOfLap( &xTaskHandoff, crbTASK_LAPS ) != pdFALSE )
+			{
+				/* Keep the token, and tell the benchmark task the ring has
+				finished. */
+				xTaskNotifyGive( xBenchmarkTask );
+				continue;
+			}
+		}
+
+		xTaskNotifyGive( xRingTasks[ ( uxIndex + 1 ) % crbMACHINES ] );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProducerCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+/* Variables in co-routines must be static if they are used across a
+blocking call. */
+static BaseType_t xResult;
+static uint32_t ulValueToSend = 0UL;
+
+	( void ) uxIndex;
+
+	crSTART( xHandle );
+
+	/* Wait to be started. */
+	crNOTIFY_WAIT( xHandle, 0UL, 0UL, NULL, portMAX_DELAY, &xResult );
+
+	for( ;; )
+	{
+		crQUEUE_SEND( xHandle, xQueue, &ulValueToSend, portMAX_DELAY, &xResult );
+
+		if( xResult != pdPASS )
+		{
+			xError = pdTRUE;
+		}
+
+		ulValueToSend++;
+	}
+
+	crEND();
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumerCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+static BaseType_t xResult;
+static uint32_t ulReceivedValue;
+
+	( void ) uxIndex;
+
+	crSTART( xHandle );
+
+	for( ;; )
+	{
+		crQUEUE_RECEIVE( xHandle, xQueue, &ulReceivedValue, portMAX_DELAY, &xResult );
+
+		if( ( xResult != pdPASS ) || ( ulReceivedValue != ulItemsReceived ) )
+		{
+			xError = pdTRUE;
+		}
+
+		ulItemsReceived++;
+	}
+
+	crEND();
+}
+/*-----------------------------------------------------------*/
+
+static void prvEventCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+static BaseType_t xResult;
+static EventBits_t uxBits;
+
+	( void ) uxIndex;
+
+	crSTART( xHandle );
+
+	crNOTIFY_WAIT( xHandle, 0UL, 0UL, NULL, portMAX_DELAY, &xResult );
+
+	for( ;; )
+	{
+		crEVENT_GROUP_WAIT_BITS( xHandle, xEventGroup, crbEVENT_BIT, pdTRUE, pdFALSE, crbEVENT_TIME_OUT, &uxBits );
+
+		if( ( uxBits & crbEVENT_BIT ) != 0 )
+		{
+			ulEventBitsReceived++;
+
+			/* The bit should have been cleared on exit. */
+			if( ( xEventGroupGetBits( xEventGroup ) & crbEVENT_BIT ) != 0 )
+			{
+				xError = pdTRUE;
+			}
+		}
+		else
+		{
+			ulEventTimeOuts++;
+		}
+	}
+
+	crEND();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+static BaseType_t xResult;
+static uint32_t ulNotifiedValue;
+
+	( void ) uxIndex;
+
+	crSTART( xHandle );
+
+	for( ;; )
+	{
+		/* The timer callback increments the notification value, which is
+		cleared on exit. */
+		crNOTIFY_WAIT( xHandle, 0UL, 0xffffffffUL, &ulNotifiedValue, portMAX_DELAY, &xResult );
+		ulTimerNotifications += ulNotifiedValue;
+	}
+
+	crEND();
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xExpiredTimer )
+{
+	( void ) xExpiredTimer;
+	xCoRoutineNotify( xTimerCoRoutineHandle, 0UL, eIncrement );
+}
+/*-----------------------------------------------------------*/
+
+static void prvDelayUntilCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+{
+static BaseType_t xResult;
+static TickType_t xPreviousWakeTime;
+
+	( void ) uxIndex;
+
+	crSTART( xHandle );
+
+	crNOTIFY_WAIT( xHandle, 0UL, 0UL, NULL, portMAX_DELAY, &xResult );
+	xPreviousWakeTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		crDELAY_UNTIL( xHandle, &xPreviousWakeTime, crbDELAY_PERIOD );
+		ulDelayUntilRuns++;
+	}
+
+	crEND();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsCoRoutineBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( xError != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ( ulLaps == ulLastLaps ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastLaps = ulLaps;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vCoRoutineBenchmarkPrintResults( void )
+{
+	printf( "Co-routine: %lu bytes per state machine\r\n", ( unsigned long ) sizeof( StaticCoRoutine_t ) );
+	printf( "Task: %lu bytes of heap per state machine, plus its host thread\r\n", ( unsigned long ) xTaskBytes );
+	vBenchmarkPrintStats( &xCoRoutineHandoff );
+	vBenchmarkPrintStats( &xTaskHandoff );
+	printf( "Co-routine waits: %lu queue items, %lu event bits, %lu event time outs, %lu timer notifications, %lu periodic runs\r\n",
+			( unsigned long ) ulItemsReceived, ( unsigned long ) ulEventBitsReceived, ( unsigned long ) ulEventTimeOuts,
+			( unsigned long ) ulTimerNotifications, ( unsigned long ) ulDelayUntilRuns );
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,438 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the cost of managing delayed tasks as the number of tasks in the
+ * Blocked state grows from 8 to 256, so the sorted delayed task lists and the
+ * delay wheel (configUSE_TASK_DELAY_WHEEL) can be compared.  For each number
+ * of tasks the benchmark task creates that many "sleeper" tasks, each of which
+ * repeatedly calls vTaskDelayUntil() with its own period.  The periods are
+ * spread between dlbMIN_PERIOD and dlbMIN_PERIOD + dlbPERIOD_SPREAD ticks, so
+ * each sleeper is inserted at a different position amongst the tasks already
+ * delayed.  Then:
+ *
+ *   + The benchmark task calls xTaskIncrementTick() dlbTICKS times, exactly as
+ *     the tick interrupt would, from a critical section, recording the time
+ *     each call takes.  This includes unblocking the sleepers that are due.
+ *     The sleepers have a higher priority than the benchmark task, so each
+ *     unblocked sleeper runs and blocks again before the next call.
+ *
+ *   + Each sleeper records the processor time it uses in vTaskDelayUntil().
+ *     On this port that includes switching to the next task's thread, which
+ *     is the same whichever way delayed tasks are managed.
+ *
+ * Each sleeper also checks it is never woken before its wake time, and the
+ * check task checks the sleepers are still being woken.
+ *
+ * The sleepers are then deleted and the same number of synchronised sleepers
+ * are created, which all call vTaskDelayUntil() with dlbSYNC_PERIOD from the
+ * same start time, so every one of them is unblocked by the same tick.  The
+ * half created last have a higher priority than the others.  The benchmark
+ * task calls xTaskIncrementTick() dlbSYNC_TICKS times as before, but only
+ * records the calls that unblock the sleepers - the worst case tick, which
+ * grows with the number of sleepers unless configTICK_UNBLOCK_LIMIT is set.  When it is set the
+ * tick leaves the remaining sleepers to the kernel's tick unblock task, so each
+ * of the lower priority sleepers checks that all of the higher priority
+ * sleepers have already run for the same wake time.
+ *
+ * The extra calls to xTaskIncrementTick() make the kernel's time run ahead of
+ * real time, so the benchmark is run on its own rather than with the standard
+ * demo tasks - see main.c.  They also count towards the run time given on the
+ * command line, and all the sizes take about 19 seconds of kernel time, so the
+ * default run time is enough.  The results are printed once the scheduler has
+ * been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "DelayBenchmark.h"
+
+#if( ( INCLUDE_vTaskDelayUntil != 1 ) || ( INCLUDE_vTaskDelete != 1 ) )
+	#error DelayBenchmark.c requires INCLUDE_vTaskDelayUntil and INCLUDE_vTaskDelete to be 1.
+#endif
+
+/* The number of sleepers is increased by a factor of 2 from 8 to
+dlbMAX_SLEEPERS. */
+#define dlbNUMBER_OF_SIZES			( 6 )
+#define dlbMAX_SLEEPERS				( 256UL )
+
+/* The range of the sleepers' periods. */
+#define dlbMIN_PERIOD				( ( TickType_t ) 20 )
+#define dlbPERIOD_SPREAD			( 500UL )
+
+/* Used to spread the periods.  A prime, so consecutive sleepers have periods
+far apart. */
+#define dlbSPREAD_MULTIPLIER		( 7919UL )
+
+/* The number of times xTaskIncrementTick() is called for each number of
+sleepers, after waiting long enough for every sleeper to have blocked with its
+own period. */
+#define dlbTICKS					( 2000UL )
+#define dlbSETTLE_TICKS				( dlbMIN_PERIOD + ( TickType_t ) dlbPERIOD_SPREAD )
+
+/* The period of the synchronised sleepers, the number of times
+xTaskIncrementTick() is called while they run, and the time they are given to
+fall into step first - the last to be created may have to catch up. */
+#define dlbSYNC_PERIOD				( ( TickType_t ) 10 )
+#define dlbSYNC_TICKS				( 500UL )
+#define dlbSYNC_SETTLE_TICKS		( dlbSYNC_PERIOD * ( TickType_t ) 4 )
+
+/* The results for one number of sleepers. */
+typedef struct DELAY_BENCHMARK_RESULT
+{
+	uint32_t ulSleepers;
+	BenchmarkStats_t xTick;
+	BenchmarkStats_t xDelayUntil;
+	BenchmarkStats_t xSyncTick;
+} DelayBenchmarkResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that creates the sleepers and calls xTaskIncrementTick(), as
+ * described at the top of this file.
+ */
+static void prvDelayBenchmarkTask( void *pvParameters );
+
+/*
+ * Delete the first ulSleepers sleepers, and wait for them to be freed.
+ */
+static void prvDeleteSleepers( uint32_t ulSleepers );
+
+/*
+ * Call xTaskIncrementTick() ulTicks times as the tick interrupt would, adding
+ * the time each call takes to pxStats - or, if xUnblockingOnly is pdTRUE, the
+ * time each call that unblocks a task takes.
+ */
+static void prvCallTickHandler( BenchmarkStats_t *pxStats, uint32_t ulTicks, BaseType_t xUnblockingOnly );
+
+/*
+ * The sleeper tasks.  The parameter is the index of the sleeper.
+ */
+static void prvSleeperTask( void *pvParameters );
+static void prvSynchronisedSleeperTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+static DelayBenchmarkResult_t xResults[ dlbNUMBER_OF_SIZES ] =
+{
+	{ 8UL, benchmarkSTATS_INIT( "xTaskIncrementTick(), 8 delayed tasks" ), benchmarkSTATS_INIT( "vTaskDelayUntil(), 8 delayed tasks" ), benchmarkSTATS_INIT( "xTaskIncrementTick() waking 8 synchronised tasks" ) },
+	{ 16UL, benchmarkSTATS_INIT( "xTaskIncrementTick(), 16 delayed tasks" ), benchmarkSTATS_INIT( "vTaskDelayUntil(), 16 delayed tasks" ), benchmarkSTATS_INIT( "xTaskIncrementTick() waking 16 synchronised tasks" ) },
+	{ 32UL, benchmarkSTATS_INIT( "xTaskIncrementTick(), 32 delayed tasks" ), benchmarkSTATS_INIT( "vTaskDelayUntil(), 32 delayed tasks" ), benchmarkSTATS_INIT( "xTaskIncrementTick() waking 32 synchronised tasks" ) },
+	{ 64UL, benchmarkSTATS_INIT( "xTaskIncrementTick(), 64 delayed tasks" ), benchmarkSTATS_INIT( "vTaskDelayUntil(), 64 delayed tasks" ), benchmarkSTATS_INIT( "xTaskIncrementTick() waking 64 synchronised tasks" ) },
+	{ 128UL, benchmarkSTATS_INIT( "xTaskIncrementTick(), 128 delayed tasks" ), benchmarkSTATS_INIT( "vTaskDelayUntil(), 128 delayed tasks" ), benchmarkSTATS_INIT( "xTaskIncrementTick() waking 128 synchronised tasks" ) },
+	{ dlbMAX_SLEEPERS, benchmarkSTATS_INIT( "xTaskIncrementTick(), 256 delayed tasks" ), benchmarkSTATS_INIT( "vTaskDelayUntil(), 256 delayed tasks" ), benchmarkSTATS_INIT( "xTaskIncrementTick() waking 256 synchronised tasks" ) }
+};
+
+static TaskHandle_t xSleepers[ dlbMAX_SLEEPERS ];
+
+/* The tick count the synchronised sleepers start from, the index of the first
+of them to have the higher priority, and the wake time each last woke for. */
+static volatile TickType_t xSyncStartTime = ( TickType_t ) 0;
+static volatile uint32_t ulFirstHighSleeper = 0UL, ulSyncSleepers = 0UL;
+static volatile TickType_t xSyncWakeTimes[ dlbMAX_SLEEPERS ];
+
+/* The results the sleepers add to, which is only changed while the sleepers
+are not running. */
+static DelayBenchmarkResult_t * volatile pxCurrentResult = NULL;
+
+/* Incremented each time a sleeper wakes, and set if a sleeper wakes early. */
+static volatile uint32_t ulWakes = 0UL, ulLastWakes = 0UL;
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/* Set once every number of sleepers has been measured. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartDelayBenchmark( UBaseType_t uxPriority )
+{
+	/* Both priorities of sleeper must be able to preempt the benchmark task,
+	and neither may be the timer task's priority. */
+	configASSERT( uxPriority < ( configMAX_PRIORITIES - 3 ) );
+
+	xTaskCreate( prvDelayBenchmarkTask, "DlyBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvDelayBenchmarkTask( void *pvParameters )
+{
+uint32_t ulSize, ulSleeper;
+const UBaseType_t uxSleeperPriority = uxTaskPriorityGet( NULL ) + 1;
+
+	( void ) pvParameters;
+
+	for( ulSize = 0UL; ulSize < dlbNUMBER_OF_SIZES; ulSize++ )
+	{
+		pxCurrentResult = &( xResults[ ulSize ] );
+
+		for( ulSleeper = 0UL; ulSleeper < xResults[ ulSize ].ulSleepers; ulSleeper++ )
+		{
+			xTaskCreate( prvSleeperTask, "Sleeper", configMINIMAL_STACK_SIZE, ( void * ) ( UBaseType_t ) ulSleeper, uxSleeperPriority, &( xSleepers[ ulSleeper ] ) );
+			configASSERT( xSleepers[ ulSleeper ] );
+		}
+
+		vTaskDelay( dlbSETTLE_TICKS );
+		prvCallTickHandler( &( xResults[ ulSize ].xTick ), dlbTICKS, pdFALSE );
+
+		/* The sleepers are blocked, as they have the higher priority. */
+		pxCurrentResult = NULL;
+		prvDeleteSleepers( xResults[ ulSize ].ulSleepers );
+
+		/* Now the synchronised sleepers, the higher priority half last. */
+		xSyncStartTime = xTaskGetTickCount();
+		ulSyncSleepers = xResults[ ulSize ].ulSleepers;
+		ulFirstHighSleeper = ulSyncSleepers / 2UL;
+
+		for( ulSleeper = 0UL; ulSleeper < ulSyncSleepers; ulSleeper++ )
+		{
+			xSyncWakeTimes[ ulSleeper ] = xSyncStartTime;
+			xTaskCreate( prvSynchronisedSleeperTask, "SyncSleep", configMINIMAL_STACK_SIZE, ( void * ) ( UBaseType_t ) ulSleeper, uxSleeperPriority + ( ( ulSleeper >= ulFirstHighSleeper ) ? 1 : 0 ), &( xSleepers[ ulSleeper ] ) );
+			configASSERT( xSleepers[ ulSleeper ] );
+		}
+
+		vTaskDelay( dlbSYNC_SETTLE_TICKS );
+		pxCurrentResult = &( xResults[ ulSize ] );
+		prvCallTickHandler( &( xResults[ ulSize ].xSyncTick ), dlbSYNC_TICKS, pdTRUE );
+		pxCurrentResult = NULL;
+		prvDeleteSleepers( ulSyncSleepers );
+	}
+
+	xComplete = pdTRUE;
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvDeleteSleepers( uint32_t ulSleepers )
+{
+uint32_t ulSleeper;
+const UBaseType_t uxTasks = uxTaskGetNumberOfTasks() - ( UBaseType_t ) ulSleepers;
+
+	for( ulSleeper = 0UL; ulSleeper < ulSleepers; ulSleeper++ )
+	{
+		vTaskDelete( xSleepers[ ulSleeper ] );
+	}
+
+	/* Wait for the idle task to free the deleted sleepers, so there is room
+	for the next ones. */
+	while( uxTaskGetNumberOfTasks() > uxTasks )
+	{
+		vTaskDelay( ( TickType_t ) 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvCallTickHandler( BenchmarkStats_t *pxStats, uint32_t ulTicks, BaseType_t xUnblockingOnly )
+{
+uint32_t ulTick;
+uint64_t ullStartTime, ullEndTime;
+BaseType_t xSwitchRequired;
+
+	for( ulTick = 0UL; ulTick < ulTicks; ulTick++ )
+	{
+		taskENTER_CRITICAL();
+		{
+			ullStartTime = ullBenchmarkGetTimeNs();
+			xSwitchRequired = xTaskIncrementTick();
+			ullEndTime = ullBenchmarkGetTimeNs();
+		}
+		taskEXIT_CRITICAL();
+
+		if( ( xUnblockingOnly == pdFALSE ) || ( xSwitchRequired != pdFALSE ) )
+		{
+			vBenchmarkAddSample( pxStats, ullEndTime - ullStartTime );
+		}
+
+		/* Let the sleepers that were unblocked run and block again.  This
+		also lets the tick unblock task unblock any sleepers the tick left. */
+		if( xSwitchRequired != pdFALSE )
+		{
+			taskYIELD();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSleeperTask( void *pvParameters )
+{
+const TickType_t xPeriod = dlbMIN_PERIOD + ( TickType_t ) ( ( ( uint32_t ) ( UBaseType_t ) pvParameters * dlbSPREAD_MULTIPLIER ) % dlbPERIOD_SPREAD );
+TickType_t xLastWakeTime;
+uint64_t ullStartTime, ullEndTime;
+DelayBenchmarkResult_t *pxResult;
+
+	xLastWakeTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		ullStartTime = ullBenchmarkGetTaskCpuTimeNs();
+		vTaskDelayUntil( &xLastWakeTime, xPeriod );
+		ullEndTime = ullBenchmarkGetTaskCpuTimeNs();
+
+		/* Only one sleeper runs at a time, and never at the same time as the
+		benchmark task changes pxCurrentResult. */
+		pxResult = pxCurrentResult;
+
+		if( pxResult != NULL )
+		{
+			vBenchmarkAddSample( &( pxResult->xDelayUntil ), ullEndTime - ullStartTime );
+		}
+
+		/* xLastWakeTime has been updated to the time the task should have
+		woken, which the tick count must have reached.  The task may run late,
+		but must never run early. */
+		if( ( TickType_t ) ( xTaskGetTickCount() - xLastWakeTime ) > ( portMAX_DELAY >> 1 ) )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		ulWakes++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSynchronisedSleeperTask( void *pvParameters )
+{
+const uint32_t ulSleeper = ( uint32_t ) ( UBaseType_t ) pvParameters;
+TickType_t xLastWakeTime = xSyncStartTime;
+uint32_t ulHighSleeper;
+
+	for( ;; )
+	{
+		vTaskDelayUntil( &xLastWakeTime, dlbSYNC_PERIOD );
+		xSyncWakeTimes[ ulSleeper ] = xLastWakeTime;
+
+		if( ( TickType_t ) ( xTaskGetTickCount() - xLastWakeTime ) > ( portMAX_DELAY >> 1 ) )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		/* Once the sleepers are in step, every higher priority sleeper must
+		have run for this wake time, or a later one, before any lower priority
+		sleeper runs for it. */
+		if( ( pxCurrentResult != NULL ) && ( ulSleeper < ulFirstHighSleeper ) )
+		{
+			for( ulHighSleeper = ulFirstHighSleeper; ulHighSleeper < ulSyncSleepers; ulHighSleeper++ )
+			{
+				if( ( TickType_t ) ( xSyncWakeTimes[ ulHighSleeper ] - xLastWakeTime ) > ( portMAX_DELAY >> 1 ) )
+				{
+					xErrorDetected = pdTRUE;
+				}
+			}
+		}
+
+		ulWakes++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsDelayBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( xErrorDetected != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ( ulWakes == ulLastWakes ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastWakes = ulWakes;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vDelayBenchmarkPrintResults( void )
+{
+uint32_t ulSize;
+
+	printf( "Delayed tasks are managed by %s\r\n", ( configUSE_TASK_DELAY_WHEEL == 1 ) ? "the delay wheel" : "sorted lists" );
+
+	if( configTICK_UNBLOCK_LIMIT > 0 )
+	{
+		printf( "The tick unblocks at most %lu tasks\r\n", ( unsigned long ) configTICK_UNBLOCK_LIMIT );
+	}
+	else
+	{
+		printf( "The tick unblocks every task that is due\r\n" );
+	}
+
+	for( ulSize = 0UL; ulSize < dlbNUMBER_OF_SIZES; ulSize++ )
+	{
+		vBenchmarkPrintStats( &( xResults[ ulSize ].xTick ) );
+		vBenchmarkPrintStats( &( xResults[ ulSize ].xDelayUntil ) );
+		vBenchmarkPrintStats( &( xResults[ ulSize ].xSyncTick ) );
+	}
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,439 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Runs a set of periodic tasks, each job of which must complete before the
+ * next is released, first scheduled by fixed priority and then earliest
+ * deadline first, and counts the deadlines each misses.
+ *
+ * The task set uses edfbUTILISATION_PERCENT of the processor.  Scheduled
+ * rate monotonic - the shorter the period, the higher the priority - the
+ * lowest priority task can be kept from running for long enough to miss some
+ * of its deadlines, which earliest deadline first scheduling avoids for any
+ * task set that uses less than all of the processor.
+ *
+ * Each phase runs the task set for edfbPHASE_TICKS ticks:
+ *   + Fixed priority - the tasks have priorities above configEDF_PRIORITY.
+ *   + EDF - the tasks have priority configEDF_PRIORITY.
+ *   + Fixed priority, overload - as the first phase, but every
+ *     edfbOVERLOAD_INTERVAL jobs the overrunning task runs for
+ *     edfbOVERLOAD_FACTOR times as long, which needs about a third more than
+ *     all of the processor.
+ *   + EDF, overload - as the second phase, with the same overruns.
+ *   + EDF, overload, budgets - as the fourth phase, but each task is given a
+ *     budget, so the overrunning task has its deadline postponed rather than
+ *     making the other tasks miss theirs.
+ *
+ * In every phase the tasks complete their jobs by calling
+ * xTaskWaitForNextPeriod(), which counts the deadlines missed whatever the
+ * task's priority.  A job runs until the task has been the running task for its
+ * execution time, so the time spent running the tasks of the set that preempt
+ * it is not counted.  The time the host takes from the running task - to
+ * simulate the tick, or to run other processes - is counted, as the time taken
+ * by an interrupt would be, so the task set uses the same share of real time
+ * however busy the host is.  Measuring the job in the host's processor time
+ * instead would let a host that gets busier during a phase push the task set
+ * past all of the processor, where a missed deadline under earliest deadline
+ * first makes the following jobs of every task late too.  The benchmark task
+ * runs above all of the tasks in the set, and otherwise only wakes to start
+ * and end each phase.
+ *
+ * The results are printed once the scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "EDFBenchmark.h"
+
+#if( ( configUSE_EDF_SCHEDULING != 1 ) || ( INCLUDE_vTaskDelete != 1 ) )
+	#error EDFBenchmark.c requires configUSE_EDF_SCHEDULING and INCLUDE_vTaskDelete to be 1.
+#endif
+
+/* The number of tasks in the set, and the utilisation of the set when none of
+the tasks overruns. */
+#define edfbTASKS					( 3U )
+#define edfbUTILISATION_PERCENT		( 85U )
+
+/* The length of each phase - 8 times the least common multiple of the
+periods. */
+#define edfbPHASE_TICKS				( ( TickType_t ) 2880 )
+
+/* How often, in jobs, the overrunning task overruns in the overload phases,
+and how many times its execution time it then runs for. */
+#define edfbOVERRUNNING_TASK		( 1U )
+#define edfbOVERLOAD_INTERVAL		( 2UL )
+#define edfbOVERLOAD_FACTOR			( 4ULL )
+
+#define edfbNS_PER_US				( 1000ULL )
+
+/* The phases, as described at the top of this file. */
+#define edfbPHASES					( 5U )
+
+/*-----------------------------------------------------------*/
+
+/* One periodic task of the set.  The relative deadline of each job is the
+period. */
+typedef struct EDF_BENCHMARK_TASK
+{
+	const char *pcName;
+	uint32_t ulExecutionTimeUs;		/*< The processor time each job takes. */
+	TickType_t xPeriod;				/*< The time between the releases of the jobs. */
+	TickType_t xBudget;				/*< The task's budget in the last phase - two more than its whole ticks of execution time, as a job can be charged for a tick more than it runs. */
+} EDFBenchmarkTask_t;
+
+/* One phase. */
+typedef struct EDF_BENCHMARK_PHASE
+{
+	const char *pcName;
+	BaseType_t xEDF;				/*< pdTRUE to run the tasks at configEDF_PRIORITY, pdFALSE to give them rate monotonic priorities above it. */
+	BaseType_t xOverload;			/*< pdTRUE if the overrunning task overruns. */
+	BaseType_t xBudgets;			/*< pdTRUE if the tasks are given budgets. */
+} EDFBenchmarkPhase_t;
+
+/* The results of one task in one phase. */
+typedef struct EDF_BENCHMARK_RESULT
+{
+	TaskDeadlineStats_t xStats;
+	uint64_t ullBusyNs;				/*< The time taken by the jobs the task completed. */
+} EDFBenchmarkResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The benchmark task, as described at the top of this file.
+ */
+static void prvEDFBenchmarkTask( void *pvParameters );
+
+/*
+ * The tasks of the set.  The parameter is the index of the task in
+ * xTaskSet[].
+ */
+static void prvPeriodicTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+static const EDFBenchmarkTask_t xTaskSet[ edfbTASKS ] =
+{
+	{ "EdfA", 10000UL, ( TickType_t ) 40, ( TickType_t ) 12 },
+	{ "EdfB", 20000UL, ( TickType_t ) 60, ( TickType_t ) 22 },
+	{ "EdfC", 24000UL, ( TickType_t ) 90, ( TickType_t ) 26 }
+};
+
+static const EDFBenchmarkPhase_t xPhases[ edfbPHASES ] =
+{
+	{ "Fixed priority", pdFALSE, pdFALSE, pdFALSE },
+	{ "EDF", pdTRUE, pdFALSE, pdFALSE },
+	{ "Fixed priority, overload", pdFALSE, pdTRUE, pdFALSE },
+	{ "EDF, overload", pdTRUE, pdTRUE, pdFALSE },
+	{ "EDF, overload, budgets", pdTRUE, pdTRUE, pdTRUE }
+};
+
+/* The phase being run.  Written by the benchmark task while the tasks of the
+set are not running. */
+static volatile UBaseType_t uxPhase = 0U;
+
+/* The index of the task of the set that last measured its time while running
+a job, so a task can tell when another task of the set has run since it last
+measured. */
+static volatile UBaseType_t uxLastRunningTask = edfbTASKS;
+
+/* The time taken by each task's completed jobs in the current phase. */
+static volatile uint64_t ullBusyNs[ edfbTASKS ];
+
+/* The results. */
+static EDFBenchmarkResult_t xResults[ edfbPHASES ][ edfbTASKS ];
+static uint64_t ullPhaseElapsedNs[ edfbPHASES ];
+
+/* Incremented each time a job completes, so the check task can see the
+benchmark is progressing. */
+static volatile uint32_t ulProgress = 0UL, ulLastProgress = 0UL;
+
+/* Latched if earliest deadline first scheduling misses more deadlines than
+fixed priority scheduling, or if giving the tasks budgets does not stop the
+overrunning task making the others miss theirs. */
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/* Set once every phase has run. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartEDFBenchmark( UBaseType_t uxPriority )
+{
+	/* The tasks of the set run at configEDF_PRIORITY, or at rate monotonic
+	priorities above it, below the benchmark task. */
+	configASSERT( ( configEDF_PRIORITY + edfbTASKS ) < uxPriority );
+	configASSERT( uxPriority < configMAX_PRIORITIES );
+
+	xTaskCreate( prvEDFBenchmarkTask, "EdfBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEDFBenchmarkTask( void *pvParameters )
+{
+UBaseType_t uxTask, uxPriority;
+TaskHandle_t xTasks[ edfbTASKS ];
+uint64_t ullStartTime;
+uint32_t ulMissed[ edfbPHASES ], ulOthersMissed[ edfbPHASES ];
+
+	( void ) pvParameters;
+
+	for( uxPhase = 0U; uxPhase < edfbPHASES; uxPhase++ )
+	{
+		for( uxTask = 0U; uxTask < edfbTASKS; uxTask++ )
+		{
+			/* The tasks are listed in order of period, so the first has the
+			highest rate monotonic priority. */
+			if( xPhases[ uxPhase ].xEDF != pdFALSE )
+			{
+				uxPriority = configEDF_PRIORITY;
+			}
+			else
+			{
+				uxPriority = configEDF_PRIORITY + edfbTASKS - uxTask;
+			}
+
+			ullBusyNs[ uxTask ] = 0ULL;
+			xTasks[ uxTask ] = NULL;
+			xTaskCreate( prvPeriodicTask, xTaskSet[ uxTask ].pcName, configMINIMAL_STACK_SIZE, ( void * ) ( size_t ) uxTask, uxPriority, &( xTasks[ uxTask ] ) );
+			configASSERT( xTasks[ uxTask ] );
+		}
+
+		/* The tasks cannot run until this task blocks, so the first job of
+		each is released at the same time. */
+		for( uxTask = 0U; uxTask < edfbTASKS; uxTask++ )
+		{
+			if( xTaskSetDeadlineParameters( xTasks[ uxTask ], xTaskSet[ uxTask ].xPeriod, xTaskSet[ uxTask ].xPeriod, ( xPhases[ uxPhase ].xBudgets != pdFALSE ) ? xTaskSet[ uxTask ].xBudget : ( TickType_t ) 0 ) != pdPASS )
+			{
+				/* configEDF_MAX_TASKS is too low.  A task without deadline
+				parameters cannot wait for its next period, so must not run. */
+				xErrorDetected = pdTRUE;
+				vTaskSuspend( xTasks[ uxTask ] );
+			}
+		}
+
+		ullStartTime = ullBenchmarkGetTimeNs();
+		vTaskDelay( edfbPHASE_TICKS );
+		ullPhaseElapsedNs[ uxPhase ] = ullBenchmarkGetTimeNs() - ullStartTime;
+
+		ulMissed[ uxPhase ] = 0UL;
+		ulOthersMissed[ uxPhase ] = 0UL;
+
+		for( uxTask = 0U; uxTask < edfbTASKS; uxTask++ )
+		{
+			vTaskGetDeadlineStats( xTasks[ uxTask ], &( xResults[ uxPhase ][ uxTask ].xStats ) );
+			xResults[ uxPhase ][ uxTask ].ullBusyNs = ullBusyNs[ uxTask ];
+			ulMissed[ uxPhase ] += xResults[ uxPhase ][ uxTask ].xStats.ulDeadlinesMissed;
+
+			if( uxTask != edfbOVERRUNNING_TASK )
+			{
+				ulOthersMissed[ uxPhase ] += xResults[ uxPhase ][ uxTask ].xStats.ulDeadlinesMissed;
+			}
+
+			vTaskDelete( xTasks[ uxTask ] );
+		}
+
+		/* Let the idle task free the deleted tasks. */
+		vTaskDelay( 1 );
+	}
+
+	/* Rate monotonic scheduling of this task set can miss deadlines, earliest
+	deadline first should not - although a simulated tick can be late, so it is
+	only required not to miss more. */
+	if( ( ulMissed[ 1 ] > ulMissed[ 0 ] ) || ( xResults[ 1 ][ 0 ].xStats.ulJobs == 0UL ) )
+	{
+		xErrorDetected = pdTRUE;
+	}
+
+	/* Without budgets the overruns make every task miss deadlines, with them
+	the overrunning task should miss its own, and the others far fewer - or
+	none at all. */
+	if( ( ( ulOthersMissed[ edfbPHASES - 1U ] != 0UL ) && ( ulOthersMissed[ edfbPHASES - 1U ] >= ulOthersMissed[ edfbPHASES - 2U ] ) ) || ( xResults[ edfbPHASES - 1U ][ edfbOVERRUNNING_TASK ].xStats.ulBudgetOverruns == 0UL ) )
+	{
+		xErrorDetected = pdTRUE;
+	}
+
+	xComplete = pdTRUE;
+
+	/* The benchmark only runs once. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicTask( void *pvParameters )
+{
+const UBaseType_t uxTask = ( UBaseType_t ) ( size_t ) pvParameters;
+uint64_t ullExecutionTimeNs, ullUsedNs, ullLastTime, ullNow;
+uint32_t ulJob;
+
+	for( ulJob = 0UL; ; ulJob++ )
+	{
+		ullExecutionTimeNs = ( uint64_t ) xTaskSet[ uxTask ].ulExecutionTimeUs * edfbNS_PER_US;
+
+		if( ( xPhases[ uxPhase ].xOverload != pdFALSE ) && ( uxTask == edfbOVERRUNNING_TASK ) && ( ( ulJob % edfbOVERLOAD_INTERVAL ) == 0UL ) )
+		{
+			ullExecutionTimeNs *= edfbOVERLOAD_FACTOR;
+		}
+
+		/* Run for the job's execution time.  The time since the last
+		measurement is only counted if no other task of the set has measured
+		since, as otherwise this task was preempted in between. */
+		ullUsedNs = 0ULL;
+		uxLastRunningTask = uxTask;
+		ullLastTime = ullBenchmarkGetTimeNs();
+
+		do
+		{
+			ullNow = ullBenchmarkGetTimeNs();
+
+			if( uxLastRunningTask == uxTask )
+			{
+				ullUsedNs += ullNow - ullLastTime;
+			}
+			else
+			{
+				uxLastRunningTask = uxTask;
+			}
+
+			ullLastTime = ullNow;
+		} while( ullUsedNs < ullExecutionTimeNs );
+
+		ullBusyNs[ uxTask ] += ullUsedNs;
+		ulProgress++;
+
+		( void ) xTaskWaitForNextPeriod();
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsEDFBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( xErrorDetected != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ( ulProgress == ulLastProgress ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		ulLastProgress = ulProgress;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vEDFBenchmarkPrintResults( void )
+{
+UBaseType_t uxPhaseToPrint, uxTask;
+uint64_t ullBusyTotal;
+uint32_t ulJobs, ulMissed;
+const EDFBenchmarkResult_t *pxResult;
+
+	printf( "Deadline scheduling, %u periodic tasks using %u%% of the processor, %lu ticks per phase\r\n",
+			( unsigned ) edfbTASKS, ( unsigned ) edfbUTILISATION_PERCENT, ( unsigned long ) edfbPHASE_TICKS );
+
+	for( uxPhaseToPrint = 0U; uxPhaseToPrint < edfbPHASES; uxPhaseToPrint++ )
+	{
+		if( ullPhaseElapsedNs[ uxPhaseToPrint ] == 0ULL )
+		{
+			/* The scheduler was ended before the phase ran. */
+			break;
+		}
+
+		ullBusyTotal = 0ULL;
+		ulJobs = 0UL;
+		ulMissed = 0UL;
+
+		for( uxTask = 0U; uxTask < edfbTASKS; uxTask++ )
+		{
+			pxResult = &( xResults[ uxPhaseToPrint ][ uxTask ] );
+			ullBusyTotal += pxResult->ullBusyNs;
+			ulJobs += pxResult->xStats.ulJobs;
+			ulMissed += pxResult->xStats.ulDeadlinesMissed;
+		}
+
+		printf( "%s: %lu jobs, %lu deadlines missed, %.1f%% of the processor used\r\n", xPhases[ uxPhaseToPrint ].pcName, ( unsigned long ) ulJobs, ( unsigned long ) ulMissed, ( ( double ) ullBusyTotal * 100.0 ) / ( double ) ullPhaseElapsedNs[ uxPhaseToPrint ] );
+
+		for( uxTask = 0U; uxTask < edfbTASKS; uxTask++ )
+		{
+			pxResult = &( xResults[ uxPhaseToPrint ][ uxTask ] );
+			printf( "    %s (%luus every %lu ticks): %lu jobs, %lu deadlines missed, %lu budget overruns\r\n", xTaskSet[ uxTask ].pcName,
+					( unsigned long ) xTaskSet[ uxTask ].ulExecutionTimeUs, ( unsigned long ) xTaskSet[ uxTask ].xPeriod,
+					( unsigned long ) pxResult->xStats.ulJobs, ( unsigned long ) pxResult->xStats.ulDeadlinesMissed, ( unsigned long ) pxResult->xStats.ulBudgetOverruns );
+		}
+	}
+}
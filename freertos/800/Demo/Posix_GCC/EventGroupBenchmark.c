@@ -0,0 +1,311 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures how the cost of setting bits in an event group grows with the
+ * number of tasks waiting on the group for other bits - which depends on
+ * configEVENT_GROUP_WAIT_LISTS (see event_groups.c).  Build with it set to 1
+ * and to 8 to compare.
+ *
+ * egbMAX_WAITERS waiter tasks are created.  Each waits for a notification, then
+ * waits on the shared event group for bits that are never set - half for any
+ * one of bit ( n % egbWAITER_BITS ), half for all of that bit and
+ * egbWAITER_ALL_BIT - and so stays blocked on the group for the rest of the
+ * run.
+ *
+ * Once, when the scheduler starts, the benchmark task releases the waiters
+ * egbWAITER_STEP at a time.  Each time, with that many waiters blocked on the
+ * group, it measures:
+ *
+ *   + The time taken to set a bit no task waits for, then clear it again.
+ *
+ *   + The wake latency - the time from the benchmark task setting
+ *     egbTARGET_BIT to a higher priority target task, blocked waiting for that
+ *     bit, starting to run.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "event_groups.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "EventGroupBenchmark.h"
+
+/* The number of waiter tasks, and how many are released between each set of
+measurements. */
+#define egbMAX_WAITERS				( 32 )
+#define egbWAITER_STEP				( 8 )
+#define egbSTEPS					( ( egbMAX_WAITERS / egbWAITER_STEP ) + 1 )
+
+/* The waiters wait for bits 0 to ( egbWAITER_BITS - 1 ), and those that wait
+for all their bits also for egbWAITER_ALL_BIT.  None of them are ever set. */
+#define egbWAITER_BITS				( 4 )
+#define egbWAITER_ALL_BIT			( ( EventBits_t ) 1 << 6 )
+
+/* The bit the target task waits for, and a bit no task waits for. */
+#define egbTARGET_BIT				( ( EventBits_t ) 1 << 4 )
+#define egbUNUSED_BIT				( ( EventBits_t ) 1 << 5 )
+
+/* The number of times each measurement is made for each number of waiters. */
+#define egbSET_CALLS				( 10000UL )
+#define egbWAKES					( 1000UL )
+
+/* The wake latency is measured egbWAKES_PER_TICK times a tick, so the other
+demo tasks are not kept from running for long. */
+#define egbWAKES_PER_TICK			( 10UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvBenchmarkTask( void *pvParameters );
+static void prvTargetTask( void *pvParameters );
+static void prvWaiterTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+/* The measurements for each number of waiters. */
+static uint64_t ullSetNs[ egbSTEPS ];
+static BenchmarkStats_t xWakeLatency[ egbSTEPS ] =
+{
+	benchmarkSTATS_INIT( "Event group wake latency, 0 other waiters" ),
+	benchmarkSTATS_INIT( "Event group wake latency, 8 other waiters" ),
+	benchmarkSTATS_INIT( "Event group wake latency, 16 other waiters" ),
+	benchmarkSTATS_INIT( "Event group wake latency, 24 other waiters" ),
+	benchmarkSTATS_INIT( "Event group wake latency, 32 other waiters" )
+};
+
+/* Set once all the measurements have been made. */
+static volatile BaseType_t xBenchmarkComplete = pdFALSE;
+
+static EventGroupHandle_t xEventGroup = NULL;
+static TaskHandle_t xWaiterTasks[ egbMAX_WAITERS ];
+
+/* Set by the benchmark task immediately before setting egbTARGET_BIT. */
+static volatile uint64_t ullSetTime = 0ULL;
+static BenchmarkStats_t * volatile pxLatencyStats = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartEventGroupBenchmark( UBaseType_t uxPriority )
+{
+UBaseType_t uxWaiter;
+
+	/* The target task must have a higher priority than the benchmark task, and
+	should have a lower priority than the timer task so the timer demo tasks
+	are not delayed. */
+	configASSERT( uxPriority < ( UBaseType_t ) ( configMAX_PRIORITIES - 1 ) );
+	configASSERT( ( sizeof( xWakeLatency ) / sizeof( xWakeLatency[ 0 ] ) ) == egbSTEPS );
+
+	xEventGroup = xEventGroupCreate();
+	configASSERT( xEventGroup );
+
+	/* The waiters are all created now as the death demo tasks check the number
+	of tasks remains constant once the scheduler has started. */
+	for( uxWaiter = 0; uxWaiter < egbMAX_WAITERS; uxWaiter++ )
+	{
+		xTaskCreate( prvWaiterTask, "EGWait", configMINIMAL_STACK_SIZE, ( void * ) uxWaiter, uxPriority, &( xWaiterTasks[ uxWaiter ] ) );
+	}
+
+	xTaskCreate( prvTargetTask, "EGTarget", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, NULL );
+	xTaskCreate( prvBenchmarkTask, "EGBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsEventGroupBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+UBaseType_t uxStep;
+
+	/* Once the measurements are complete the target task must have been
+	unblocked each time its bit was set, however many other tasks were
+	waiting. */
+	if( xBenchmarkComplete != pdFALSE )
+	{
+		for( uxStep = 0; uxStep < egbSTEPS; uxStep++ )
+		{
+			if( xWakeLatency[ uxStep ].ulSamples != egbWAKES )
+			{
+				xReturn = pdFAIL;
+			}
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWaiterTask( void *pvParameters )
+{
+const UBaseType_t uxWaiter = ( UBaseType_t ) pvParameters;
+const EventBits_t uxBit = ( EventBits_t ) 1 << ( uxWaiter % egbWAITER_BITS );
+
+	ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+	if( ( uxWaiter & 1 ) == 0 )
+	{
+		( void ) xEventGroupWaitBits( xEventGroup, uxBit, pdFALSE, pdFALSE, portMAX_DELAY );
+	}
+	else
+	{
+		( void ) xEventGroupWaitBits( xEventGroup, uxBit | egbWAITER_ALL_BIT, pdFALSE, pdTRUE, portMAX_DELAY );
+	}
+
+	/* The bits are never set, so this is not expected to be reached. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTargetTask( void *pvParameters )
+{
+uint64_t ullWakeTime;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) xEventGroupWaitBits( xEventGroup, egbTARGET_BIT, pdTRUE, pdFALSE, portMAX_DELAY );
+		ullWakeTime = ullBenchmarkGetTimeNs();
+		vBenchmarkAddSample( pxLatencyStats, ullWakeTime - ullSetTime );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void *pvParameters )
+{
+UBaseType_t uxStep, uxWaiter = 0;
+uint32_t ulCall;
+uint64_t ullStartTime;
+
+	( void ) pvParameters;
+
+	for( uxStep = 0; uxStep < egbSTEPS; uxStep++ )
+	{
+		/* Release the next egbWAITER_STEP waiters.  They have the same priority
+		as this task, so the delay lets them run and block on the group. */
+		if( uxStep > 0 )
+		{
+			for( ; uxWaiter < ( uxStep * egbWAITER_STEP ); uxWaiter++ )
+			{
+				xTaskNotifyGive( xWaiterTasks[ uxWaiter ] );
+			}
+
+			vTaskDelay( ( TickType_t ) 1 );
+		}
+
+		ullStartTime = ullBenchmarkGetTimeNs();
+		for( ulCall = 0UL; ulCall < egbSET_CALLS; ulCall++ )
+		{
+			( void ) xEventGroupSetBits( xEventGroup, egbUNUSED_BIT );
+			( void ) xEventGroupClearBits( xEventGroup, egbUNUSED_BIT );
+		}
+		ullSetNs[ uxStep ] = ullBenchmarkGetTimeNs() - ullStartTime;
+
+		/* The target task has a higher priority than this task, so it runs,
+		and records its sample, before xEventGroupSetBits() returns. */
+		pxLatencyStats = &( xWakeLatency[ uxStep ] );
+		for( ulCall = 0UL; ulCall < egbWAKES; ulCall++ )
+		{
+			if( ( ulCall % egbWAKES_PER_TICK ) == 0UL )
+			{
+				vTaskDelay( ( TickType_t ) 1 );
+			}
+
+			ullSetTime = ullBenchmarkGetTimeNs();
+			( void ) xEventGroupSetBits( xEventGroup, egbTARGET_BIT );
+		}
+	}
+
+	xBenchmarkComplete = pdTRUE;
+
+	/* The tests only run once.  The task suspends itself rather than deleting
+	itself as the death demo tasks check the number of tasks remains
+	constant. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vEventGroupBenchmarkPrintResults( void )
+{
+UBaseType_t uxStep;
+char cName[ 64 ];
+
+	printf( "Event group benchmark with configEVENT_GROUP_WAIT_LISTS = %d\r\n", ( int ) configEVENT_GROUP_WAIT_LISTS );
+
+	for( uxStep = 0; uxStep < egbSTEPS; uxStep++ )
+	{
+		snprintf( cName, sizeof( cName ), "Event group set and clear, %d other waiters", ( int ) ( uxStep * egbWAITER_STEP ) );
+		vBenchmarkPrintRate( cName, egbSET_CALLS, ullSetNs[ uxStep ] );
+		vBenchmarkPrintStats( &( xWakeLatency[ uxStep ] ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
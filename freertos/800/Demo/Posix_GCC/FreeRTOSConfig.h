@@ -0,0 +1,248 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions.
+ *
+ * These definitions should be adjusted for your particular hardware and
+ * application requirements.
+ *
+ * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+ * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
+ *
+ * See http://www.freertos.org/a00110.html.
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION					1
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION	0
+#define configUSE_IDLE_HOOK						1
+#define configUSE_TICK_HOOK						1
+#define configUSE_TICKLESS_IDLE					1 /* The tick is generated by a simulated SysTick - see the POSIX port. */
+#define configTICK_RATE_HZ						( ( TickType_t ) 1000 )
+#define configMINIMAL_STACK_SIZE				( ( unsigned short ) 128 ) /* Only holds the host thread structure - the task itself runs on the host thread's stack. */
+#define configTOTAL_HEAP_SIZE					( ( size_t ) ( 512 * 1024 ) )
+#define configMAX_TASK_NAME_LEN					( 12 )
+#define configUSE_TRACE_FACILITY				1
+#define configUSE_16_BIT_TICKS					0
+#define configIDLE_SHOULD_YIELD					1
+#define configUSE_MUTEXES						1
+#define configUSE_RECURSIVE_MUTEXES				1
+#define configUSE_COUNTING_SEMAPHORES			1
+#define configUSE_ALTERNATIVE_API				0
+#define configUSE_QUEUE_ZERO_COPY				1
+#define configQUEUE_REGISTRY_SIZE				20
+#define configCHECK_FOR_STACK_OVERFLOW			0 /* Task stacks are host thread stacks, which the kernel cannot see. */
+#define configUSE_MALLOC_FAILED_HOOK			1
+#define configUSE_APPLICATION_TASK_TAG			0
+#define configGENERATE_RUN_TIME_STATS			1
+#define configSUPPORT_STATIC_ALLOCATION			1
+#define configSUPPORT_DYNAMIC_ALLOCATION		1
+
+/* Task selection definitions.  The number of priorities can be set on the
+command line, so SwitchBenchmark.c can compare the priority bitmap with
+searching the ready lists when there are many priorities. */
+#ifndef configMAX_PRIORITIES
+	#define configMAX_PRIORITIES				( 7 )
+#endif
+#ifndef configUSE_PRIORITY_BITMAP
+	#define configUSE_PRIORITY_BITMAP			1
+#endif
+
+/* Software timer definitions. */
+#define configUSE_TIMERS						1
+#define configTIMER_TASK_PRIORITY				( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH				20
+#define configTIMER_TASK_STACK_DEPTH			( configMINIMAL_STACK_SIZE * 2 )
+#define configUSE_TIMER_HEAP					1
+#define configTIMER_HEAP_LENGTH					( 10240 ) /* Large enough for the 10,000 timers created by TimerBenchmark.c. */
+#define configUSE_TIMER_FAST_RESET				1
+
+/* The tick count overflows three seconds after the scheduler is started, so
+every run of the demo checks the kernel and the demo tasks handle it. */
+#ifndef configINITIAL_TICK_COUNT
+	#define configINITIAL_TICK_COUNT			( ( TickType_t ) 0U - ( TickType_t ) ( 3U * configTICK_RATE_HZ ) )
+#endif
+
+/* Delayed task definitions.  DelayBenchmark.c compares the timing wheel with
+the sorted delayed lists, and measures the worst case tick with and without a
+limit on the tasks the tick unblocks, so they can be set on the command line. */
+#ifndef configUSE_TASK_DELAY_WHEEL
+	#define configUSE_TASK_DELAY_WHEEL			1
+#endif
+#define configTASK_DELAY_WHEEL_SIZE				64
+#ifndef configTICK_UNBLOCK_LIMIT
+	#define configTICK_UNBLOCK_LIMIT			8
+#endif
+
+/* Event group definitions.  EventGroupBenchmark.c measures the effect of
+dividing the tasks waiting on an event group between lists by bit. */
+#define configEVENT_GROUP_WAIT_LISTS			8
+
+/* Work queue definitions.  WorkQueueBenchmark.c compares deferring work to a
+work queue with deferring it to the timer service task.  The latencies are
+measured in nanoseconds, so the last bucket of the histogram counts those of
+more than 4ms. */
+#define configWORK_QUEUE_BATCH_SIZE				8
+#define configWORK_QUEUE_TIMESTAMP()			ulMainGetTraceTimestamp()
+#define configWORK_QUEUE_LATENCY_BUCKETS		24
+
+/* Mutex definitions.  MutexBenchmark.c compares the fast mutexes with mutexes
+taken and given through the queue, so they can be set on the command line. */
+#ifndef configUSE_FAST_MUTEXES
+	#define configUSE_FAST_MUTEXES				1
+#endif
+#ifndef configFAST_MUTEX_SPIN_COUNT
+	#define configFAST_MUTEX_SPIN_COUNT			1
+#endif
+
+/* Queue set definitions.  QueueSetBenchmark.c compares the list of ready
+members with the queue of events, so it can be set on the command line. */
+#define configUSE_QUEUE_SETS					1
+#ifndef configUSE_QUEUE_SET_READY_LIST
+	#define configUSE_QUEUE_SET_READY_LIST		1
+#endif
+
+/* Task registry definitions.  RegistryBenchmark.c compares reading the task
+registry with suspending the scheduler to walk the task lists, so it can be set
+on the command line.  The registry is large enough for the 256 tasks created by
+DelayBenchmark.c. */
+#ifndef configUSE_TASK_REGISTRY
+	#define configUSE_TASK_REGISTRY				1
+#endif
+#define configTASK_REGISTRY_SIZE				320
+
+/* Deadline scheduling definitions.  EDFBenchmark.c compares scheduling a task
+set earliest deadline first with scheduling it by fixed priority.  The tasks of
+the same priority in the standard demo and the other benchmarks are not given
+deadlines, so take turns as they would otherwise. */
+#define configUSE_EDF_SCHEDULING				1
+#define configEDF_PRIORITY						( 2 )
+#define configEDF_MAX_TASKS						8
+
+/* Co-routine definitions.  CoRoutineBenchmark.c compares running state
+machines as co-routines with running them as tasks. */
+#define configUSE_CO_ROUTINES					1
+#define configMAX_CO_ROUTINE_PRIORITIES			( 2 )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet				1
+#define INCLUDE_uxTaskPriorityGet				1
+#define INCLUDE_vTaskDelete						1
+#define INCLUDE_vTaskCleanUpResources			0
+#define INCLUDE_vTaskSuspend					1
+#define INCLUDE_vTaskDelayUntil					1
+#define INCLUDE_vTaskDelay						1
+#define INCLUDE_uxTaskGetStackHighWaterMark		1
+#define INCLUDE_xTaskGetSchedulerState			1
+#define INCLUDE_xTimerGetTimerDaemonTaskHandle	1
+#define INCLUDE_xTaskGetIdleTaskHandle			1
+#define INCLUDE_pcTaskGetTaskName				1
+#define INCLUDE_eTaskGetState					1
+#define INCLUDE_xTaskGetCurrentTaskHandle		1
+#define INCLUDE_xEventGroupSetBitFromISR		1
+#define INCLUDE_xTimerPendFunctionCall			1
+
+/* Run time stats gathering definitions.  The time base counts microseconds
+using the host's monotonic clock. */
+extern uint32_t ulMainGetRunTimeCounterValue( void );
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#define portGET_RUN_TIME_COUNTER_VALUE()		ulMainGetRunTimeCounterValue()
+
+/* Trace recorder definitions.  The timestamp counts nanoseconds using the
+host's monotonic clock - on a Cortex-M target it would be the DWT cycle
+counter.  The recorder is only left running when the demo is run in trace
+mode - see main.c. */
+extern uint32_t ulMainGetTraceTimestamp( void );
+#define configUSE_TRACE_RECORDER				1
+#define configTRACE_RECORDER_TIMESTAMP()		ulMainGetTraceTimestamp()
+#define configTRACE_RECORDER_TIMESTAMP_HZ		( 1000000000UL )
+#define configTRACE_RECORDER_EVENTS				( 65536 )
+#define configTRACE_RECORDER_NAMES				( 256 )
+
+/* Record the allocations made by the demo, so they can be replayed by
+HeapBenchmark.c. */
+extern void vHeapBenchmarkRecordMalloc( void *pvAddress, size_t xSize );
+extern void vHeapBenchmarkRecordFree( void *pvAddress );
+#define traceMALLOC( pvAddress, uiSize )		vHeapBenchmarkRecordMalloc( ( pvAddress ), ( uiSize ) )
+#define traceFREE( pvAddress, uiSize )			vHeapBenchmarkRecordFree( ( pvAddress ) )
+
+/* Monitor the heap, so main.c can report who holds the memory once the demo
+has run.  The tables are large enough for the 10,000 timers created by
+TimerBenchmark.c and for every task the demo creates. */
+#define configUSE_HEAP_MONITOR					1
+#define configHEAP_MONITOR_BLOCKS				( 16384 )
+#define configHEAP_MONITOR_OWNERS				( 64 )
+
+/* Normal assert() semantics without relying on the provision of an assert.h
+header file. */
+extern void vAssertCalled( const char *pcFile, unsigned long ulLine );
+#define configASSERT( x ) if( ( x ) == 0 ) vAssertCalled( __FILE__, __LINE__ )
+
+#endif /* FREERTOS_CONFIG_H */
@@ -0,0 +1,443 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Records the allocations made by the demo, and replays them against the heap
+ * to measure the time taken by pvPortMalloc() and vPortFree(), and how
+ * fragmented the heap becomes.  The demo can be built with any heap that
+ * provides xPortGetLargestFreeBlockSize() - heap_4.c or heap_tlsf.c - so the
+ * same recorded trace can be replayed against each.
+ *
+ * Recording - FreeRTOSConfig.h maps traceMALLOC() and traceFREE() to
+ * vHeapBenchmarkRecordMalloc() and vHeapBenchmarkRecordFree(), so the first
+ * hbRECORD_EVENTS allocations and frees made by the kernel and the demo are
+ * recorded from the start of main().  vHeapBenchmarkSaveTrace() is called
+ * once the scheduler has been ended, and saves the recorded events to
+ * hbTRACE_FILE_NAME as text - "m <id> <size>" for an allocation and "f <id>"
+ * for a free - so traces can also be written by hand, or recorded on a target
+ * and copied to the host.  Note heap_4.c passes traceMALLOC() the size of the
+ * block it allocated, header included, rather than the size requested, so a
+ * trace recorded with heap_4.c asks for a little more memory than the
+ * original program did - but asks for the same amount from every heap it is
+ * replayed against.
+ *
+ * Replaying - "./rtosdemo replay <file>" calls xHeapBenchmarkReplayFile()
+ * instead of running the demo, so the heap holds nothing but the replayed
+ * blocks.  The trace is replayed hbREPLAY_PASSES times.  Each call to
+ * pvPortMalloc() and vPortFree() is timed, and after each event of the first
+ * pass the fragmentation of the heap is calculated as the percentage of the
+ * free space that is not in the largest free block.  Blocks still allocated
+ * at the end of the trace are freed before the next pass, after which the
+ * heap must have as much free space as it had before the pass.  Allocations
+ * are allowed to fail during the replay, and are counted.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "HeapBenchmark.h"
+
+/* The number of allocations and frees recorded. */
+#define hbRECORD_EVENTS				( 32768UL )
+
+/* The file the recorded trace is saved to. */
+#define hbTRACE_FILE_NAME			"rtosdemo.heap"
+
+/* The number of times the trace is replayed. */
+#define hbREPLAY_PASSES				( 10UL )
+
+/* An event is a free if its size is 0. */
+#define hbFREE						( ( size_t ) 0 )
+
+/* A recorded allocation or free.  The recorded events identify blocks by
+address, the saved and replayed events by the number of the allocation. */
+typedef struct HEAP_BENCHMARK_EVENT
+{
+	void *pvAddress;
+	uint32_t ulId;
+	size_t xSize;
+} HeapBenchmarkEvent_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Replace the addresses of the recorded events with allocation numbers, and
+ * return the number of allocations.  Frees of blocks allocated before the
+ * recording started are dropped.
+ */
+static uint32_t prvNumberRecordedEvents( void );
+
+/*
+ * Replay ulEvents events that allocate ulAllocations blocks.
+ */
+static void prvReplay( const HeapBenchmarkEvent_t *pxEvents, uint32_t ulEvents, uint32_t ulAllocations );
+
+/*
+ * The fragmentation of the heap as a percentage.
+ */
+static uint32_t prvFragmentation( void );
+
+/*-----------------------------------------------------------*/
+
+/* The recorded events. */
+static HeapBenchmarkEvent_t xRecordedEvents[ hbRECORD_EVENTS ];
+static uint32_t ulRecordedEvents = 0UL;
+
+/* Recording stops while a trace is replayed. */
+static BaseType_t xReplaying = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vHeapBenchmarkRecordMalloc( void *pvAddress, size_t xSize )
+{
+	/* Called from within the heap, with the scheduler suspended or from
+	within a critical section. */
+	if( ( xReplaying == pdFALSE ) && ( pvAddress != NULL ) && ( xSize != hbFREE ) && ( ulRecordedEvents < hbRECORD_EVENTS ) )
+	{
+		xRecordedEvents[ ulRecordedEvents ].pvAddress = pvAddress;
+		xRecordedEvents[ ulRecordedEvents ].xSize = xSize;
+		ulRecordedEvents++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHeapBenchmarkRecordFree( void *pvAddress )
+{
+	if( ( xReplaying == pdFALSE ) && ( ulRecordedEvents < hbRECORD_EVENTS ) )
+	{
+		xRecordedEvents[ ulRecordedEvents ].pvAddress = pvAddress;
+		xRecordedEvents[ ulRecordedEvents ].xSize = hbFREE;
+		ulRecordedEvents++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHeapBenchmarkIsReplaying( void )
+{
+	return xReplaying;
+}
+/*-----------------------------------------------------------*/
+
+void vHeapBenchmarkSaveTrace( void )
+{
+FILE *pxFile;
+uint32_t ulEvent;
+BaseType_t xReturn = pdFAIL;
+
+	( void ) prvNumberRecordedEvents();
+	pxFile = fopen( hbTRACE_FILE_NAME, "w" );
+
+	if( pxFile != NULL )
+	{
+		xReturn = pdPASS;
+
+		for( ulEvent = 0UL; ulEvent < ulRecordedEvents; ulEvent++ )
+		{
+			if( xRecordedEvents[ ulEvent ].xSize != hbFREE )
+			{
+				xReturn = ( fprintf( pxFile, "m %lu %lu\n", ( unsigned long ) xRecordedEvents[ ulEvent ].ulId, ( unsigned long ) xRecordedEvents[ ulEvent ].xSize ) > 0 ) ? xReturn : pdFAIL;
+			}
+			else
+			{
+				xReturn = ( fprintf( pxFile, "f %lu\n", ( unsigned long ) xRecordedEvents[ ulEvent ].ulId ) > 0 ) ? xReturn : pdFAIL;
+			}
+		}
+
+		if( fclose( pxFile ) != 0 )
+		{
+			xReturn = pdFAIL;
+		}
+	}
+
+	if( xReturn != pdFAIL )
+	{
+		printf( "Heap: %lu allocation events saved to %s, replay with \"./rtosdemo replay %s\"\r\n", ( unsigned long ) ulRecordedEvents, hbTRACE_FILE_NAME, hbTRACE_FILE_NAME );
+	}
+	else
+	{
+		printf( "Heap: cannot save %s\r\n", hbTRACE_FILE_NAME );
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHeapBenchmarkReplayFile( const char *pcFileName )
+{
+FILE *pxFile;
+HeapBenchmarkEvent_t *pxEvents = NULL;
+uint32_t ulEvents = 0UL, ulCapacity = 0UL, ulAllocations = 0UL;
+unsigned long ulId, ulSize;
+char cType;
+BaseType_t xReturn = pdFAIL;
+
+	pxFile = fopen( pcFileName, "r" );
+
+	if( pxFile == NULL )
+	{
+		printf( "Heap: cannot open %s\r\n", pcFileName );
+	}
+	else
+	{
+		xReturn = pdPASS;
+
+		while( ( xReturn != pdFAIL ) && ( fscanf( pxFile, " %c %lu", &cType, &ulId ) == 2 ) )
+		{
+			if( ulEvents == ulCapacity )
+			{
+				ulCapacity = ( ulCapacity == 0UL ) ? 1024UL : ( ulCapacity * 2UL );
+				pxEvents = realloc( pxEvents, ulCapacity * sizeof( HeapBenchmarkEvent_t ) );
+				configASSERT( pxEvents );
+			}
+
+			pxEvents[ ulEvents ].pvAddress = NULL;
+			pxEvents[ ulEvents ].ulId = ( uint32_t ) ulId;
+
+			if( ( cType == 'm' ) && ( fscanf( pxFile, "%lu", &ulSize ) == 1 ) && ( ulSize > 0UL ) && ( ulId == ulAllocations ) )
+			{
+				/* Allocations are numbered in order. */
+				pxEvents[ ulEvents ].xSize = ( size_t ) ulSize;
+				ulAllocations++;
+			}
+			else if( ( cType == 'f' ) && ( ulId < ulAllocations ) )
+			{
+				pxEvents[ ulEvents ].xSize = hbFREE;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+
+			ulEvents++;
+		}
+
+		fclose( pxFile );
+
+		if( ( xReturn != pdFAIL ) && ( ulAllocations > 0UL ) )
+		{
+			printf( "Heap: replaying %s, %lu events\r\n", pcFileName, ( unsigned long ) ulEvents );
+			prvReplay( pxEvents, ulEvents, ulAllocations );
+		}
+		else
+		{
+			printf( "Heap: %s is not a valid heap trace\r\n", pcFileName );
+			xReturn = pdFAIL;
+		}
+
+		free( pxEvents );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvNumberRecordedEvents( void )
+{
+uint32_t ulEvent, ulSearch, ulKept = 0UL, ulAllocations = 0UL;
+
+	for( ulEvent = 0UL; ulEvent < ulRecordedEvents; ulEvent++ )
+	{
+		if( xRecordedEvents[ ulEvent ].xSize != hbFREE )
+		{
+			xRecordedEvents[ ulEvent ].ulId = ulAllocations;
+			ulAllocations++;
+			xRecordedEvents[ ulKept ] = xRecordedEvents[ ulEvent ];
+			ulKept++;
+		}
+		else
+		{
+			/* An address is only reused once the block at that address has
+			been freed, so the free is of the most recent allocation at the
+			same address. */
+			for( ulSearch = ulKept; ulSearch > 0UL; ulSearch-- )
+			{
+				if( ( xRecordedEvents[ ulSearch - 1UL ].xSize != hbFREE ) && ( xRecordedEvents[ ulSearch - 1UL ].pvAddress == xRecordedEvents[ ulEvent ].pvAddress ) )
+				{
+					break;
+				}
+			}
+
+			if( ulSearch > 0UL )
+			{
+				xRecordedEvents[ ulEvent ].ulId = xRecordedEvents[ ulSearch - 1UL ].ulId;
+				xRecordedEvents[ ulKept ] = xRecordedEvents[ ulEvent ];
+				ulKept++;
+			}
+		}
+	}
+
+	ulRecordedEvents = ulKept;
+
+	return ulAllocations;
+}
+/*-----------------------------------------------------------*/
+
+static void prvReplay( const HeapBenchmarkEvent_t *pxEvents, uint32_t ulEvents, uint32_t ulAllocations )
+{
+BenchmarkStats_t xMalloc = benchmarkSTATS_INIT( "Heap replay, pvPortMalloc()" );
+BenchmarkStats_t xFree = benchmarkSTATS_INIT( "Heap replay, vPortFree()" );
+void **ppvBlocks;
+uint32_t ulPass, ulEvent, ulFailures = 0UL, ulFragmentation, ulWorstFragmentation = 0UL, ulEndFragmentation = 0UL;
+size_t xFreeBefore, xLeaked = 0;
+uint64_t ullStartTime;
+
+	ppvBlocks = calloc( ulAllocations, sizeof( void * ) );
+	configASSERT( ppvBlocks );
+
+	xReplaying = pdTRUE;
+
+	/* The heap is initialised by its first allocation. */
+	vPortFree( pvPortMalloc( 1 ) );
+	xFreeBefore = xPortGetFreeHeapSize();
+
+	for( ulPass = 0UL; ulPass < hbREPLAY_PASSES; ulPass++ )
+	{
+		for( ulEvent = 0UL; ulEvent < ulEvents; ulEvent++ )
+		{
+			if( pxEvents[ ulEvent ].xSize != hbFREE )
+			{
+				ullStartTime = ullBenchmarkGetTimeNs();
+				ppvBlocks[ pxEvents[ ulEvent ].ulId ] = pvPortMalloc( pxEvents[ ulEvent ].xSize );
+				vBenchmarkAddSample( &xMalloc, ullBenchmarkGetTimeNs() - ullStartTime );
+
+				if( ppvBlocks[ pxEvents[ ulEvent ].ulId ] == NULL )
+				{
+					ulFailures++;
+				}
+			}
+			else if( ppvBlocks[ pxEvents[ ulEvent ].ulId ] != NULL )
+			{
+				ullStartTime = ullBenchmarkGetTimeNs();
+				vPortFree( ppvBlocks[ pxEvents[ ulEvent ].ulId ] );
+				vBenchmarkAddSample( &xFree, ullBenchmarkGetTimeNs() - ullStartTime );
+				ppvBlocks[ pxEvents[ ulEvent ].ulId ] = NULL;
+			}
+
+			if( ulPass == 0UL )
+			{
+				ulFragmentation = prvFragmentation();
+
+				if( ulFragmentation > ulWorstFragmentation )
+				{
+					ulWorstFragmentation = ulFragmentation;
+				}
+			}
+		}
+
+		if( ulPass == 0UL )
+		{
+			ulEndFragmentation = prvFragmentation();
+		}
+
+		for( ulEvent = 0UL; ulEvent < ulAllocations; ulEvent++ )
+		{
+			vPortFree( ppvBlocks[ ulEvent ] );
+			ppvBlocks[ ulEvent ] = NULL;
+		}
+
+		/* heap_slab.c keeps the slabs it takes from its backing heap, so
+		reports the memory they hold as not returned. */
+		if( xPortGetFreeHeapSize() != xFreeBefore )
+		{
+			xLeaked = xFreeBefore - xPortGetFreeHeapSize();
+		}
+	}
+
+	xReplaying = pdFALSE;
+	free( ppvBlocks );
+
+	vBenchmarkPrintStats( &xMalloc );
+	vBenchmarkPrintStats( &xFree );
+	printf( "Heap replay: %lu passes, %lu allocations failed\r\n", ( unsigned long ) hbREPLAY_PASSES, ( unsigned long ) ulFailures );
+	printf( "Heap replay: high water mark %lu of %lu bytes\r\n", ( unsigned long ) ( xFreeBefore - xPortGetMinimumEverFreeHeapSize() ), ( unsigned long ) xFreeBefore );
+	printf( "Heap replay: fragmentation worst %lu%%, at end of trace %lu%%\r\n", ( unsigned long ) ulWorstFragmentation, ( unsigned long ) ulEndFragmentation );
+
+	if( xLeaked != ( size_t ) 0 )
+	{
+		printf( "Heap replay: %lu bytes not returned to the heap\r\n", ( unsigned long ) xLeaked );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvFragmentation( void )
+{
+size_t xFree;
+uint32_t ulReturn = 0UL;
+
+	xFree = xPortGetFreeHeapSize();
+
+	if( xFree > ( size_t ) 0 )
+	{
+		ulReturn = ( uint32_t ) ( 100U - ( ( xPortGetLargestFreeBlockSize() * 100U ) / xFree ) );
+	}
+
+	return ulReturn;
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,456 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * See HeapMonitorDecoder.h.  The block records are grouped twice - by call
+ * site, and, for the blocks allocated after the mark, by owner and call site -
+ * into tables of fixed size.  Groups that do not fit are counted together on
+ * one line, so the totals are always complete.  The groups are sorted by the
+ * bytes they hold before being printed.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "heap_monitor.h"
+
+/* Benchmark includes. */
+#include "HeapMonitorDecoder.h"
+
+/* The size of the tables the blocks are grouped into. */
+#define hmdMAX_GROUPS				( 256 )
+
+/* The number of groups printed in each part of the report. */
+#define hmdGROUPS_PRINTED			( 16 )
+
+/* The longest owner name that is printed, including the terminating null. */
+#define hmdNAME_LENGTH				( heapMONITOR_NAME_LENGTH + 1 )
+
+/* Blocks held by one owner from one call site.  When grouping by call site
+alone the owner is not used. */
+typedef struct HEAP_MONITOR_DECODER_GROUP
+{
+	uint64_t ullCallSite;
+	uint32_t ulOwner;
+	uint32_t ulBlocks;
+	uint64_t ullBytes;
+} HeapMonitorDecoderGroup_t;
+
+/* A table of groups, and the blocks that did not fit in it. */
+typedef struct HEAP_MONITOR_DECODER_TABLE
+{
+	HeapMonitorDecoderGroup_t xGroups[ hmdMAX_GROUPS ];
+	int iNumGroups;
+	uint32_t ulOtherBlocks;
+	uint64_t ullOtherBytes;
+} HeapMonitorDecoderTable_t;
+
+/* Everything the decoder accumulates. */
+typedef struct HEAP_MONITOR_DECODER
+{
+	HeapMonitorDumpHeader_t xHeader;
+	HeapMonitorDecoderTable_t xBySite;
+	HeapMonitorDecoderTable_t xLeaks;
+	uint32_t ulLiveBlocks;
+	uint64_t ullLiveBytes;
+} HeapMonitorDecoder_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Add a block to the group of pxTable that holds its call site, and also its
+ * owner if xByOwner is pdTRUE.
+ */
+static void prvAddToGroup( HeapMonitorDecoderTable_t *pxTable, const HeapMonitorDumpBlock_t *pxBlock, BaseType_t xByOwner );
+
+/*
+ * Sort pxTable by bytes held, largest first, then print its first
+ * hmdGROUPS_PRINTED groups, prefixed with pcTitle.  pxOwners is NULL when the
+ * owners are not printed.
+ */
+static void prvPrintTable( HeapMonitorDecoderTable_t *pxTable, const char *pcTitle, const HeapMonitorDumpOwner_t *pxOwners, uint32_t ulOwnerCount );
+
+/*
+ * Copy the name of owner ulOwner into pcName, which is hmdNAME_LENGTH bytes.
+ */
+static void prvGetOwnerName( const HeapMonitorDumpOwner_t *pxOwners, uint32_t ulOwnerCount, uint32_t ulOwner, char *pcName );
+
+/*
+ * Used by qsort() to order groups by bytes held, largest first.
+ */
+static int prvCompareGroups( const void *pvGroup1, const void *pvGroup2 );
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xHeapMonitorDecodeBuffer( const void *pvBuffer, size_t xBufferSize )
+{
+HeapMonitorDecoder_t *pxDecoder;
+HeapMonitorDumpOwner_t *pxOwners = NULL;
+HeapMonitorDumpBlock_t xBlock;
+const uint8_t *pucBuffer = ( const uint8_t * ) pvBuffer;
+size_t xOwnersSize, xBlocksSize;
+uint32_t ulIndex;
+char cName[ hmdNAME_LENGTH ];
+BaseType_t xReturn = pdFAIL;
+
+	/* As TraceDecoder.c, the decoder state comes from the host's heap. */
+	pxDecoder = ( HeapMonitorDecoder_t * ) calloc( 1, sizeof( HeapMonitorDecoder_t ) );
+
+	if( pxDecoder == NULL )
+	{
+		printf( "Heap monitor: out of memory\r\n" );
+	}
+	else if( xBufferSize < sizeof( HeapMonitorDumpHeader_t ) )
+	{
+		printf( "Heap monitor: %lu bytes is too short to be a snapshot\r\n", ( unsigned long ) xBufferSize );
+	}
+	else
+	{
+		memcpy( &( pxDecoder->xHeader ), pucBuffer, sizeof( HeapMonitorDumpHeader_t ) );
+		xOwnersSize = ( size_t ) pxDecoder->xHeader.ulOwnerCount * sizeof( HeapMonitorDumpOwner_t );
+		xBlocksSize = ( size_t ) pxDecoder->xHeader.ulBlockCount * sizeof( HeapMonitorDumpBlock_t );
+
+		if( ( pxDecoder->xHeader.ulMagic != heapMONITOR_MAGIC ) || ( pxDecoder->xHeader.ulVersion != heapMONITOR_VERSION ) )
+		{
+			printf( "Heap monitor: not a version %lu snapshot\r\n", ( unsigned long ) heapMONITOR_VERSION );
+		}
+		else if( ( pxDecoder->xHeader.ulOwnerCount == 0UL ) ||
+				 ( xBufferSize < ( sizeof( HeapMonitorDumpHeader_t ) + xOwnersSize + xBlocksSize ) ) ||
+				 ( ( pxOwners = ( HeapMonitorDumpOwner_t * ) malloc( xOwnersSize ) ) == NULL ) )
+		{
+			printf( "Heap monitor: corrupt or truncated header\r\n" );
+		}
+		else
+		{
+			/* The records are copied out of the buffer, which need not be
+			aligned. */
+			memcpy( pxOwners, pucBuffer + sizeof( HeapMonitorDumpHeader_t ), xOwnersSize );
+
+			for( ulIndex = 0UL; ulIndex < pxDecoder->xHeader.ulBlockCount; ulIndex++ )
+			{
+				memcpy( &xBlock, pucBuffer + sizeof( HeapMonitorDumpHeader_t ) + xOwnersSize + ( ( size_t ) ulIndex * sizeof( HeapMonitorDumpBlock_t ) ), sizeof( HeapMonitorDumpBlock_t ) );
+
+				pxDecoder->ulLiveBlocks++;
+				pxDecoder->ullLiveBytes += xBlock.ulSize;
+				prvAddToGroup( &( pxDecoder->xBySite ), &xBlock, pdFALSE );
+
+				/* A mark of 0 means vHeapMonitorSetMark() was not called. */
+				if( ( pxDecoder->xHeader.ulMarkSequence != 0UL ) && ( xBlock.ulSequence >= pxDecoder->xHeader.ulMarkSequence ) )
+				{
+					prvAddToGroup( &( pxDecoder->xLeaks ), &xBlock, pdTRUE );
+				}
+			}
+
+			printf( "Heap monitor: %lu bytes free, %lu at the least, largest free block %lu bytes, %lu%% fragmented\r\n",
+					( unsigned long ) pxDecoder->xHeader.ulFreeBytes,
+					( unsigned long ) pxDecoder->xHeader.ulMinimumEverFreeBytes,
+					( unsigned long ) pxDecoder->xHeader.ulLargestFreeBlock,
+					( unsigned long ) pxDecoder->xHeader.ulFragmentation );
+
+			printf( "Heap monitor: %lu blocks of %llu bytes held after %lu allocations, %lu allocations not recorded (block table full), %lu not recorded (owner table full)\r\n",
+					( unsigned long ) pxDecoder->ulLiveBlocks, ( unsigned long long ) pxDecoder->ullLiveBytes,
+					( unsigned long ) ( pxDecoder->xHeader.ulSequence - 1UL ),
+					( unsigned long ) pxDecoder->xHeader.ulBlocksDropped,
+					( unsigned long ) pxDecoder->xHeader.ulOwnersDropped );
+
+			for( ulIndex = 0UL; ulIndex < pxDecoder->xHeader.ulOwnerCount; ulIndex++ )
+			{
+				if( ( pxOwners[ ulIndex ].ulFlags & heapMONITOR_OWNER_FLAG_USED ) == 0UL )
+				{
+					continue;
+				}
+
+				prvGetOwnerName( pxOwners, pxDecoder->xHeader.ulOwnerCount, ulIndex, cName );
+
+				printf( "Heap owner %s%s: %lu bytes in %lu blocks, most %lu bytes, %lu allocations\r\n",
+						cName,
+						( ( pxOwners[ ulIndex ].ulFlags & heapMONITOR_OWNER_FLAG_DELETED ) != 0UL ) ? " (deleted)" : "",
+						( unsigned long ) pxOwners[ ulIndex ].ulLiveBytes,
+						( unsigned long ) pxOwners[ ulIndex ].ulLiveBlocks,
+						( unsigned long ) pxOwners[ ulIndex ].ulMaximumLiveBytes,
+						( unsigned long ) pxOwners[ ulIndex ].ulAllocations );
+			}
+
+			prvPrintTable( &( pxDecoder->xBySite ), "Heap call site", NULL, 0UL );
+
+			if( pxDecoder->xHeader.ulMarkSequence == 0UL )
+			{
+				printf( "Heap monitor: no mark was set, so leaks are not reported\r\n" );
+			}
+			else if( pxDecoder->xLeaks.iNumGroups == 0 )
+			{
+				printf( "Heap monitor: no blocks allocated since the mark are held\r\n" );
+			}
+			else
+			{
+				prvPrintTable( &( pxDecoder->xLeaks ), "Heap possible leak", pxOwners, pxDecoder->xHeader.ulOwnerCount );
+			}
+
+			xReturn = pdPASS;
+		}
+	}
+
+	free( pxOwners );
+	free( pxDecoder );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xHeapMonitorDecodeFile( const char *pcFileName )
+{
+FILE *pxFile;
+long lSize;
+void *pvBuffer = NULL;
+BaseType_t xReturn = pdFAIL;
+
+	pxFile = fopen( pcFileName, "rb" );
+
+	if( pxFile == NULL )
+	{
+		printf( "Heap monitor: cannot open %s\r\n", pcFileName );
+	}
+	else
+	{
+		if( ( fseek( pxFile, 0L, SEEK_END ) == 0 ) && ( ( lSize = ftell( pxFile ) ) > 0L ) && ( fseek( pxFile, 0L, SEEK_SET ) == 0 ) )
+		{
+			pvBuffer = malloc( ( size_t ) lSize );
+
+			if( ( pvBuffer != NULL ) && ( fread( pvBuffer, 1, ( size_t ) lSize, pxFile ) == ( size_t ) lSize ) )
+			{
+				printf( "Heap monitor: decoding %s\r\n", pcFileName );
+				xReturn = xHeapMonitorDecodeBuffer( pvBuffer, ( size_t ) lSize );
+			}
+			else
+			{
+				printf( "Heap monitor: cannot read %s\r\n", pcFileName );
+			}
+		}
+		else
+		{
+			printf( "Heap monitor: %s is empty\r\n", pcFileName );
+		}
+
+		free( pvBuffer );
+		fclose( pxFile );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_HEAP_MONITOR == 1 )
+
+	BaseType_t xHeapMonitorSaveDump( const char *pcFileName )
+	{
+	FILE *pxFile;
+	void *pvBuffer;
+	size_t xSize = 0;
+	BaseType_t xReturn = pdFAIL;
+
+		/* Only called once the scheduler has been ended, so the snapshot can
+		be taken into the host's heap. */
+		pvBuffer = malloc( heapMONITOR_DUMP_SIZE );
+
+		if( pvBuffer != NULL )
+		{
+			xSize = xHeapMonitorDump( pvBuffer, heapMONITOR_DUMP_SIZE );
+		}
+
+		pxFile = ( xSize > 0 ) ? fopen( pcFileName, "wb" ) : NULL;
+
+		if( pxFile != NULL )
+		{
+			if( fwrite( pvBuffer, 1, xSize, pxFile ) == xSize )
+			{
+				xReturn = pdPASS;
+			}
+
+			if( fclose( pxFile ) != 0 )
+			{
+				xReturn = pdFAIL;
+			}
+		}
+
+		if( xReturn == pdFAIL )
+		{
+			printf( "Heap monitor: cannot save %s\r\n", pcFileName );
+		}
+
+		free( pvBuffer );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_HEAP_MONITOR */
+/*-----------------------------------------------------------*/
+
+static void prvAddToGroup( HeapMonitorDecoderTable_t *pxTable, const HeapMonitorDumpBlock_t *pxBlock, BaseType_t xByOwner )
+{
+uint32_t ulOwner;
+int iIndex;
+
+	ulOwner = ( xByOwner != pdFALSE ) ? pxBlock->ulOwner : 0UL;
+
+	for( iIndex = 0; iIndex < pxTable->iNumGroups; iIndex++ )
+	{
+		if( ( pxTable->xGroups[ iIndex ].ullCallSite == pxBlock->ullCallSite ) && ( pxTable->xGroups[ iIndex ].ulOwner == ulOwner ) )
+		{
+			break;
+		}
+	}
+
+	if( iIndex == pxTable->iNumGroups )
+	{
+		if( pxTable->iNumGroups < hmdMAX_GROUPS )
+		{
+			pxTable->xGroups[ iIndex ].ullCallSite = pxBlock->ullCallSite;
+			pxTable->xGroups[ iIndex ].ulOwner = ulOwner;
+			pxTable->iNumGroups++;
+		}
+		else
+		{
+			iIndex = -1;
+		}
+	}
+
+	if( iIndex >= 0 )
+	{
+		pxTable->xGroups[ iIndex ].ulBlocks++;
+		pxTable->xGroups[ iIndex ].ullBytes += pxBlock->ulSize;
+	}
+	else
+	{
+		pxTable->ulOtherBlocks++;
+		pxTable->ullOtherBytes += pxBlock->ulSize;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintTable( HeapMonitorDecoderTable_t *pxTable, const char *pcTitle, const HeapMonitorDumpOwner_t *pxOwners, uint32_t ulOwnerCount )
+{
+const HeapMonitorDecoderGroup_t *pxGroup;
+uint32_t ulOtherBlocks = pxTable->ulOtherBlocks;
+uint64_t ullOtherBytes = pxTable->ullOtherBytes;
+char cName[ hmdNAME_LENGTH ];
+int iIndex;
+
+	qsort( pxTable->xGroups, ( size_t ) pxTable->iNumGroups, sizeof( HeapMonitorDecoderGroup_t ), prvCompareGroups );
+
+	for( iIndex = 0; iIndex < pxTable->iNumGroups; iIndex++ )
+	{
+		pxGroup = &( pxTable->xGroups[ iIndex ] );
+
+		if( iIndex >= hmdGROUPS_PRINTED )
+		{
+			ulOtherBlocks += pxGroup->ulBlocks;
+			ullOtherBytes += pxGroup->ullBytes;
+		}
+		else if( pxOwners != NULL )
+		{
+			prvGetOwnerName( pxOwners, ulOwnerCount, pxGroup->ulOwner, cName );
+			printf( "%s %s 0x%llx: %llu bytes in %lu blocks\r\n", pcTitle, cName, ( unsigned long long ) pxGroup->ullCallSite, ( unsigned long long ) pxGroup->ullBytes, ( unsigned long ) pxGroup->ulBlocks );
+		}
+		else
+		{
+			printf( "%s 0x%llx: %llu bytes in %lu blocks\r\n", pcTitle, ( unsigned long long ) pxGroup->ullCallSite, ( unsigned long long ) pxGroup->ullBytes, ( unsigned long ) pxGroup->ulBlocks );
+		}
+	}
+
+	if( ulOtherBlocks > 0UL )
+	{
+		printf( "%s others: %llu bytes in %lu blocks\r\n", pcTitle, ( unsigned long long ) ullOtherBytes, ( unsigned long ) ulOtherBlocks );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetOwnerName( const HeapMonitorDumpOwner_t *pxOwners, uint32_t ulOwnerCount, uint32_t ulOwner, char *pcName )
+{
+	if( ulOwner < ulOwnerCount )
+	{
+		/* The recorded name is not null terminated if it fills the field. */
+		memcpy( pcName, pxOwners[ ulOwner ].cName, heapMONITOR_NAME_LENGTH );
+		pcName[ heapMONITOR_NAME_LENGTH ] = '\0';
+	}
+	else
+	{
+		snprintf( pcName, hmdNAME_LENGTH, "#%lu", ( unsigned long ) ulOwner );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareGroups( const void *pvGroup1, const void *pvGroup2 )
+{
+const HeapMonitorDecoderGroup_t *pxGroup1 = ( const HeapMonitorDecoderGroup_t * ) pvGroup1;
+const HeapMonitorDecoderGroup_t *pxGroup2 = ( const HeapMonitorDecoderGroup_t * ) pvGroup2;
+
+	return ( pxGroup1->ullBytes < pxGroup2->ullBytes ) - ( pxGroup1->ullBytes > pxGroup2->ullBytes );
+}
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,108 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Host side decoder for the snapshot written by the kernel's heap monitor -
+ * see Source/include/heap_monitor.h.  As with TraceDecoder.c the snapshot is
+ * decoded from a copy, so the same code decodes a snapshot saved by this demo
+ * or one read from a target by a debugger, as long as the target has the same
+ * endianness as the host.
+ */
+
+#ifndef HEAP_MONITOR_DECODER_H
+#define HEAP_MONITOR_DECODER_H
+
+/*
+ * Decode xBufferSize bytes of heap monitor snapshot and print a report of:
+ *
+ *   + The free space, the smallest the free space has been, the largest free
+ *     block and the fragmentation of the heap.
+ *
+ *   + The bytes and blocks each task holds, the most bytes it has held, and
+ *     whether it has been deleted.
+ *
+ *   + The bytes and blocks held from each call site, largest first.
+ *
+ *   + The blocks allocated after vHeapMonitorSetMark() was called that are
+ *     still held - the possible leaks - grouped by task and call site.
+ *
+ * Returns pdFAIL if the buffer is not a valid snapshot.
+ */
+BaseType_t xHeapMonitorDecodeBuffer( const void *pvBuffer, size_t xBufferSize );
+
+/*
+ * Read a heap monitor snapshot saved in a file, then decode it as
+ * xHeapMonitorDecodeBuffer().
+ */
+BaseType_t xHeapMonitorDecodeFile( const char *pcFileName );
+
+/*
+ * Take a snapshot with xHeapMonitorDump() and save it to pcFileName.  Only
+ * available when configUSE_HEAP_MONITOR is 1.
+ */
+BaseType_t xHeapMonitorSaveDump( const char *pcFileName );
+
+#endif /* HEAP_MONITOR_DECODER_H */
+
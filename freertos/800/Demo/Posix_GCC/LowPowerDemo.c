@@ -0,0 +1,435 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures how well tickless idle (configUSE_TICKLESS_IDLE) reduces the number
+ * of times the processor is woken, and how well the kernel keeps time while the
+ * tick is suppressed.  The demo is run instead of the standard demo tasks, as
+ * tasks that run at the idle priority prevent the tick being suppressed.
+ *
+ * Three periodic tasks block with vTaskDelayUntil() for periods that do not
+ * divide each other, so the length of time the processor can sleep for varies.
+ * The task with the shortest period sends a sequence number to a queue each
+ * time it runs, and a receiver task that blocks on the queue indefinitely
+ * checks no sequence numbers are missed.  An auto-reload software timer also
+ * runs, so the timer service task must wake the processor too.
+ *
+ * Each time a periodic task runs it compares the time it woke according to the
+ * kernel with the time it woke according to the host's monotonic clock.  The
+ * difference is the wake latency plus any error in the kernel's timekeeping.
+ * The smallest difference seen over a window of wakes is mostly the latter, so
+ * the drift of the kernel's time relative to the host's is estimated from how
+ * that minimum changes between the first and last windows.  A task that wakes
+ * more than half a tick period earlier than the earliest wake in the first
+ * window, which would happen if the tick count were stepped too far, is
+ * reported as an error.  The first window is used as the reference, rather than
+ * the time the measurements started, as the host can delay any single wake.
+ *
+ * The number of tick interrupts is the number of ticks that passed less the
+ * number that were suppressed.  Without tickless idle every tick period ends
+ * in a tick interrupt, which wakes the processor.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+#include "tickless_idle.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "LowPowerDemo.h"
+
+#if( configUSE_TICKLESS_IDLE != 1 )
+	#error LowPowerDemo.c requires configUSE_TICKLESS_IDLE to be 1.
+#endif
+
+/* The periods of the periodic tasks, in ticks. */
+#define lpdNUMBER_OF_PERIODIC_TASKS	( 3 )
+#define lpdPERIODS					{ ( TickType_t ) 7, ( TickType_t ) 30, ( TickType_t ) 101 }
+
+/* The period of the software timer, in ticks. */
+#define lpdTIMER_PERIOD				( ( TickType_t ) 250 )
+
+/* The periodic tasks start after the receiver task has recorded the time at
+which the measurements start. */
+#define lpdSTART_DELAY				( ( TickType_t ) 20 )
+
+/* The number of wakes over which the smallest wake time difference is found
+when the drift is estimated. */
+#define lpdDRIFT_WINDOW				( 200UL )
+
+/* A task that wakes earlier than this, relative to the earliest wake in the
+first window, is reported as an error. */
+#define lpdNS_PER_TICK				( 1000000000LL / configTICK_RATE_HZ )
+#define lpdEARLY_LIMIT_NS			( -( lpdNS_PER_TICK / 2LL ) )
+
+/* Used to convert between the units used in the measurements. */
+#define lpdNS_PER_US				( 1000LL )
+#define lpdNS_PER_MS				( 1000000ULL )
+#define lpdTIMER_COUNTS_PER_US		( portSIMULATED_TIMER_HZ / 1000000UL )
+
+/* The state of the measurements at one point in time. */
+typedef struct LOW_POWER_SNAPSHOT
+{
+	TickType_t xTickCount;
+	uint64_t ullTime;
+	TicklessIdleStats_t xStats;
+} LowPowerSnapshot_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvPeriodicTask( void *pvParameters );
+static void prvReceiverTask( void *pvParameters );
+
+/*
+ * The callback function used by the software timer.
+ */
+static void prvTimerCallback( TimerHandle_t xTimer );
+
+/*
+ * Called by a periodic task each time it wakes, to compare the time it woke
+ * according to the kernel with the host time ullNow.  Returns pdFALSE if the
+ * task woke too early.
+ */
+static BaseType_t prvRecordWake( TickType_t xTickCount, uint64_t ullNow );
+
+/*
+ * Record the tick count, host time and tickless idle statistics.
+ */
+static void prvTakeSnapshot( LowPowerSnapshot_t *pxSnapshot );
+
+/*-----------------------------------------------------------*/
+
+static QueueHandle_t xSequenceQueue = NULL;
+
+/* The measurements start when the receiver task first runs, and end when
+xAreLowPowerDemoTasksStillRunning() is last called. */
+static LowPowerSnapshot_t xFirstSnapshot, xLastSnapshot;
+static volatile BaseType_t xMeasuring = pdFALSE;
+
+/* The wake latency, and the smallest differences between the kernel and host
+wake times in the first and most recent complete windows of lpdDRIFT_WINDOW
+wakes. */
+static BenchmarkStats_t xWakeLatency = benchmarkSTATS_INIT( "Low power wake latency" );
+static int64_t llWindowMinimum = INT64_MAX, llFirstWindowMinimum = 0LL, llLastWindowMinimum = 0LL;
+static uint32_t ulWindowWakes = 0UL, ulCompleteWindows = 0UL;
+
+/* Incremented as the tasks and timer run, and checked by
+xAreLowPowerDemoTasksStillRunning(). */
+static volatile uint32_t ulPeriodicCycles[ lpdNUMBER_OF_PERIODIC_TASKS ] = { 0UL };
+static volatile uint32_t ulReceiverCycles = 0UL, ulTimerCycles = 0UL;
+static uint32_t ulLastPeriodicCycles[ lpdNUMBER_OF_PERIODIC_TASKS ] = { 0UL };
+static uint32_t ulLastReceiverCycles = 0UL, ulLastTimerCycles = 0UL;
+
+/* Set if an error is detected. */
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartLowPowerDemo( UBaseType_t uxPriority )
+{
+BaseType_t xTask;
+TimerHandle_t xTimer;
+
+	xSequenceQueue = xQueueCreate( 1, sizeof( uint32_t ) );
+	configASSERT( xSequenceQueue );
+
+	/* The receiver has a higher priority so it runs first, and so the queue
+	never fills. */
+	xTaskCreate( prvReceiverTask, "LPRx", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, NULL );
+
+	for( xTask = 0; xTask < lpdNUMBER_OF_PERIODIC_TASKS; xTask++ )
+	{
+		xTaskCreate( prvPeriodicTask, "LPPeriod", configMINIMAL_STACK_SIZE, ( void * ) xTask, uxPriority, NULL );
+	}
+
+	xTimer = xTimerCreate( "LPTimer", lpdTIMER_PERIOD, pdTRUE, NULL, prvTimerCallback );
+	configASSERT( xTimer );
+	xTimerStart( xTimer, 0 );
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiverTask( void *pvParameters )
+{
+TickType_t xLastWakeTime;
+uint32_t ulReceived, ulExpected = 0UL;
+
+	( void ) pvParameters;
+
+	/* Start the measurements on a tick boundary. */
+	xLastWakeTime = xTaskGetTickCount();
+	vTaskDelayUntil( &xLastWakeTime, ( TickType_t ) 1 );
+	prvTakeSnapshot( &xFirstSnapshot );
+	xLastSnapshot = xFirstSnapshot;
+	xMeasuring = pdTRUE;
+
+	for( ;; )
+	{
+		xQueueReceive( xSequenceQueue, &ulReceived, portMAX_DELAY );
+
+		if( ulReceived != ulExpected )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		ulExpected = ulReceived + 1UL;
+		ulReceiverCycles++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvPeriodicTask( void *pvParameters )
+{
+const TickType_t xPeriods[ lpdNUMBER_OF_PERIODIC_TASKS ] = lpdPERIODS;
+const BaseType_t xTask = ( BaseType_t ) pvParameters;
+const TickType_t xPeriod = xPeriods[ xTask ];
+TickType_t xNextWakeTime;
+uint32_t ulSequence = 0UL;
+
+	vTaskDelay( lpdSTART_DELAY );
+	configASSERT( xMeasuring );
+	xNextWakeTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		vTaskDelayUntil( &xNextWakeTime, xPeriod );
+
+		if( prvRecordWake( xNextWakeTime, ullBenchmarkGetTimeNs() ) == pdFALSE )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		if( xTask == 0 )
+		{
+			xQueueSend( xSequenceQueue, &ulSequence, portMAX_DELAY );
+			ulSequence++;
+		}
+
+		ulPeriodicCycles[ xTask ]++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+	( void ) xTimer;
+	ulTimerCycles++;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvRecordWake( TickType_t xTickCount, uint64_t ullNow )
+{
+int64_t llDifference;
+BaseType_t xReturn = pdTRUE;
+
+	/* The difference between when the task woke and the start of the tick
+	period it was due to wake in, both measured from the start of the
+	measurements.  Positive if the task woke late. */
+	llDifference = ( int64_t ) ( ullNow - xFirstSnapshot.ullTime ) - ( ( int64_t ) ( TickType_t ) ( xTickCount - xFirstSnapshot.xTickCount ) * lpdNS_PER_TICK );
+
+	/* The periodic tasks share a priority, so can be time sliced. */
+	taskENTER_CRITICAL();
+	{
+		if( ( ulCompleteWindows > 0UL ) && ( ( llDifference - llFirstWindowMinimum ) < lpdEARLY_LIMIT_NS ) )
+		{
+			xReturn = pdFALSE;
+		}
+
+		if( llDifference >= 0LL )
+		{
+			vBenchmarkAddSample( &xWakeLatency, ( uint64_t ) llDifference );
+		}
+
+		if( llDifference < llWindowMinimum )
+		{
+			llWindowMinimum = llDifference;
+		}
+
+		ulWindowWakes++;
+
+		if( ulWindowWakes == lpdDRIFT_WINDOW )
+		{
+			if( ulCompleteWindows == 0UL )
+			{
+				llFirstWindowMinimum = llWindowMinimum;
+			}
+
+			llLastWindowMinimum = llWindowMinimum;
+			ulCompleteWindows++;
+			llWindowMinimum = INT64_MAX;
+			ulWindowWakes = 0UL;
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTakeSnapshot( LowPowerSnapshot_t *pxSnapshot )
+{
+	taskENTER_CRITICAL();
+	{
+		pxSnapshot->xTickCount = xTaskGetTickCount();
+		pxSnapshot->ullTime = ullBenchmarkGetTimeNs();
+		vTicklessIdleGetStats( &( pxSnapshot->xStats ) );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAreLowPowerDemoTasksStillRunning( void )
+{
+BaseType_t xReturn = pdPASS, xTask;
+
+	for( xTask = 0; xTask < lpdNUMBER_OF_PERIODIC_TASKS; xTask++ )
+	{
+		if( ulPeriodicCycles[ xTask ] == ulLastPeriodicCycles[ xTask ] )
+		{
+			xReturn = pdFAIL;
+		}
+
+		ulLastPeriodicCycles[ xTask ] = ulPeriodicCycles[ xTask ];
+	}
+
+	if( ( ulReceiverCycles == ulLastReceiverCycles ) || ( ulTimerCycles == ulLastTimerCycles ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastReceiverCycles = ulReceiverCycles;
+	ulLastTimerCycles = ulTimerCycles;
+
+	if( xErrorDetected != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+
+	if( xMeasuring != pdFALSE )
+	{
+		prvTakeSnapshot( &xLastSnapshot );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vLowPowerDemoPrintResults( void )
+{
+uint32_t ulTicks, ulSuppressed, ulInterrupts, ulSleeps, ulAborted, ulLostUs;
+uint64_t ullElapsedMs;
+int64_t llDriftNs;
+
+	ulTicks = ( uint32_t ) ( TickType_t ) ( xLastSnapshot.xTickCount - xFirstSnapshot.xTickCount );
+	ullElapsedMs = ( xLastSnapshot.ullTime - xFirstSnapshot.ullTime ) / lpdNS_PER_MS;
+
+	if( ullElapsedMs == 0ULL )
+	{
+		printf( "Low power: not run\r\n" );
+	}
+	else
+	{
+		ulSuppressed = xLastSnapshot.xStats.ulTicksSuppressed - xFirstSnapshot.xStats.ulTicksSuppressed;
+		ulSleeps = xLastSnapshot.xStats.ulSleeps - xFirstSnapshot.xStats.ulSleeps;
+		ulAborted = xLastSnapshot.xStats.ulAbortedSleeps - xFirstSnapshot.xStats.ulAbortedSleeps;
+		ulInterrupts = ulTicks - ulSuppressed;
+
+		/* The tick is generated by the port's simulated SysTick. */
+		ulLostUs = ( xLastSnapshot.xStats.ulTimerCountsLost - xFirstSnapshot.xStats.ulTimerCountsLost ) / lpdTIMER_COUNTS_PER_US;
+
+		printf( "Low power: %lu ticks in %llu ms, %lu tick interrupts (%llu per second), %lu sleeps (%llu per second), %lu sleeps abandoned\r\n",
+			( unsigned long ) ulTicks, ( unsigned long long ) ullElapsedMs,
+			( unsigned long ) ulInterrupts, ( unsigned long long ) ( ( ulInterrupts * 1000ULL ) / ullElapsedMs ),
+			( unsigned long ) ulSleeps, ( unsigned long long ) ( ( ulSleeps * 1000ULL ) / ullElapsedMs ),
+			( unsigned long ) ulAborted );
+
+		printf( "Low power: %lu ticks suppressed, %lu us lost while the tick timer was stopped and compensated for\r\n",
+			( unsigned long ) ulSuppressed, ( unsigned long ) ulLostUs );
+
+		if( ulCompleteWindows > 1UL )
+		{
+			/* A kernel that is running slow wakes tasks increasingly late. */
+			llDriftNs = llFirstWindowMinimum - llLastWindowMinimum;
+			printf( "Low power: kernel time drift %+lld us over %llu ms (%+.2f ppm)\r\n",
+				( long long ) ( llDriftNs / lpdNS_PER_US ), ( unsigned long long ) ullElapsedMs,
+				( double ) llDriftNs / ( double ) ullElapsedMs );
+		}
+		else
+		{
+			printf( "Low power: kernel time drift not measured\r\n" );
+		}
+
+		vBenchmarkPrintStats( &xWakeLatency );
+	}
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,535 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares recycling fixed size message buffers through a memory pool (see
+ * memory_pool.c) with recycling them through pvPortMalloc() and vPortFree().
+ * Every buffer is mpbBUFFER_SIZE bytes, and the pool holds mpbBUFFERS of them.
+ * The benchmark task runs four phases in turn:
+ *
+ * Allocate and free - the benchmark task allocates and immediately frees a
+ * buffer mpbPAIRS times, from the pool and then from the heap, recording the
+ * time taken.
+ *
+ * Producer and consumer - a producer task allocates buffers, writes a sequence
+ * number into each, and sends it through a queue of mpbBUFFERS pointers to a
+ * consumer task of lower priority, which checks the sequence number and frees
+ * the buffer.  The producer runs ahead until it finds the pool empty, then
+ * blocks until the consumer frees a buffer - or, with the heap, until the
+ * consumer makes space in the queue.  The time taken to pass mpbMESSAGES
+ * buffers is recorded, from the pool and then from the heap.
+ *
+ * Freed from an interrupt - as above, but the tick interrupt (see
+ * vMemoryPoolBenchmarkISR()) consumes up to mpbISR_BUFFERS_PER_TICK buffers
+ * each tick and frees them with vMemoryPoolFreeFromISR(), which wakes the
+ * producer if it is blocked on the empty pool.  The heap cannot be used from
+ * an interrupt, so this phase only uses the pool.  Its rate is set by the tick,
+ * so it shows the producer is woken from the interrupt rather than the cost of
+ * doing so.
+ *
+ * Timeout - the benchmark task allocates every block, checks that one more
+ * allocation fails after waiting for mpbTIMEOUT_TICKS, then frees them all.
+ *
+ * The pool's statistics are then checked - every buffer must be free again,
+ * every buffer must have been in use at once, some allocations must have
+ * blocked, and exactly one must have failed.  The results are printed once
+ * the scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "memory_pool.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "MemoryPoolBenchmark.h"
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error MemoryPoolBenchmark.c requires configUSE_TASK_NOTIFICATIONS to be 1.
+#endif
+
+/* The buffers, and the number held by the pool. */
+#define mpbBUFFER_SIZE				( 64 )
+#define mpbBUFFERS					( 8 )
+
+/* The number of allocate and free pairs timed in the first phase. */
+#define mpbPAIRS					( 200000UL )
+
+/* The number of buffers passed in the producer and consumer phases. */
+#define mpbMESSAGES					( 100000UL )
+
+/* The number of buffers passed, and consumed each tick, in the phase that
+frees from the tick interrupt. */
+#define mpbISR_MESSAGES				( 2000UL )
+#define mpbISR_BUFFERS_PER_TICK		( 4UL )
+
+/* How long the allocation that is expected to fail waits. */
+#define mpbTIMEOUT_TICKS			( ( TickType_t ) 5 )
+
+/* The phases that recycle buffers between a producer and a consumer. */
+typedef enum
+{
+	mpbPOOL = 0,
+	mpbHEAP,
+	mpbPOOL_ISR,
+	mpbNUMBER_OF_PHASES
+} RecyclePhase_t;
+
+/* A message buffer.  The rest of the buffer is unused. */
+typedef struct MESSAGE_BUFFER
+{
+	uint32_t ulSequence;
+	uint8_t ucPayload[ mpbBUFFER_SIZE - sizeof( uint32_t ) ];
+} MessageBuffer_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that runs the phases, as described at the top of this file.
+ */
+static void prvMemoryPoolBenchmarkTask( void *pvParameters );
+
+/*
+ * The producer and consumer tasks of the recycling phases.  The consumer is
+ * not created in the phase that frees from the tick interrupt.
+ */
+static void prvProducerTask( void *pvParameters );
+static void prvConsumerTask( void *pvParameters );
+
+/*
+ * Time mpbPAIRS allocate and free pairs, from the pool if xUsePool is pdTRUE,
+ * otherwise from the heap.
+ */
+static uint64_t prvTimeAllocateAndFree( BaseType_t xUsePool );
+
+/*
+ * Pass ulMessages buffers from the producer to the consumer, or to the tick
+ * interrupt, returning the time taken.
+ */
+static uint64_t prvTimeRecycling( RecyclePhase_t ePhase, uint32_t ulMessages );
+
+/*
+ * Check the pool times out when it is empty.
+ */
+static void prvCheckTimeout( void );
+
+/*
+ * Check the buffer holds the next sequence number, then free it.  Called by
+ * the consumer task and by the tick interrupt.
+ */
+static void prvCheckMessage( const MessageBuffer_t * const pxMessage );
+
+/*-----------------------------------------------------------*/
+
+/* The pool's storage.  Declared as uint64_t so it is aligned to
+portBYTE_ALIGNMENT. */
+static uint64_t ullPoolStorage[ memorypoolSTORAGE_SIZE( mpbBUFFERS, sizeof( MessageBuffer_t ) ) / sizeof( uint64_t ) ];
+static MemoryPoolHandle_t xPool = NULL;
+
+/* Carries buffers from the producer to the consumer or the tick interrupt. */
+static QueueHandle_t xMessageQueue = NULL;
+
+/* The phase the producer and consumer are running, the number of buffers the
+producer sends, and the sequence number the consumer expects next. */
+static volatile RecyclePhase_t eActivePhase = mpbNUMBER_OF_PHASES;
+static volatile uint32_t ulMessagesToSend = 0UL;
+static volatile uint32_t ulNextSequence = 0UL;
+
+/* The benchmark task, which is notified when the last buffer is consumed,
+and the producer, which is notified when a phase starts. */
+static TaskHandle_t xBenchmarkTask = NULL, xProducer = NULL;
+
+/* The results. */
+static uint64_t ullPairNs[ 2 ] = { 0ULL, 0ULL };
+static uint64_t ullRecycleNs[ mpbNUMBER_OF_PHASES ] = { 0ULL, 0ULL, 0ULL };
+static uint32_t ulRecycleMessages[ mpbNUMBER_OF_PHASES ] = { 0UL, 0UL, 0UL };
+static MemoryPoolStats_t xPoolStats;
+
+/* Incremented as buffers are consumed, so the check task can see the
+benchmark is progressing. */
+static volatile uint32_t ulProgress = 0UL, ulLastProgress = 0UL;
+
+/* Latched if an allocation fails unexpectedly, a buffer is received out of
+order, or the pool's statistics are not as expected. */
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/* Set once every phase has run. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartMemoryPoolBenchmark( UBaseType_t uxPriority )
+{
+	/* The benchmark task runs above the producer, which runs above the
+	consumer, so it only runs again once the last buffer has been consumed. */
+	configASSERT( ( uxPriority + 2U ) < configMAX_PRIORITIES );
+
+	xPool = xMemoryPoolCreate( mpbBUFFERS, sizeof( MessageBuffer_t ), ( uint8_t * ) ullPoolStorage );
+	xMessageQueue = xQueueCreate( mpbBUFFERS, sizeof( MessageBuffer_t * ) );
+	configASSERT( xPool );
+	configASSERT( xMessageQueue );
+
+	xTaskCreate( prvMemoryPoolBenchmarkTask, "MPBench", configMINIMAL_STACK_SIZE, ( void * ) uxPriority, uxPriority + 2U, &xBenchmarkTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvMemoryPoolBenchmarkTask( void *pvParameters )
+{
+const UBaseType_t uxPriority = ( UBaseType_t ) pvParameters;
+TaskHandle_t xConsumer;
+
+	ullPairNs[ 0 ] = prvTimeAllocateAndFree( pdTRUE );
+	ullPairNs[ 1 ] = prvTimeAllocateAndFree( pdFALSE );
+
+	xTaskCreate( prvProducerTask, "MPProd", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1U, &xProducer );
+	xTaskCreate( prvConsumerTask, "MPCons", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xConsumer );
+
+	ullRecycleNs[ mpbPOOL ] = prvTimeRecycling( mpbPOOL, mpbMESSAGES );
+	ullRecycleNs[ mpbHEAP ] = prvTimeRecycling( mpbHEAP, mpbMESSAGES );
+
+	/* The tick interrupt is the consumer in the last phase. */
+	vTaskDelete( xConsumer );
+	ullRecycleNs[ mpbPOOL_ISR ] = prvTimeRecycling( mpbPOOL_ISR, mpbISR_MESSAGES );
+	vTaskDelete( xProducer );
+
+	prvCheckTimeout();
+
+	vMemoryPoolGetStats( xPool, &xPoolStats );
+
+	if( ( xPoolStats.uxBlocksInUse != 0U ) || ( xPoolStats.uxMaxBlocksInUse != mpbBUFFERS ) || ( xPoolStats.ulBlockedAllocations == 0UL ) || ( xPoolStats.ulFailedAllocations != 1UL ) )
+	{
+		xErrorDetected = pdTRUE;
+	}
+
+	xComplete = pdTRUE;
+
+	/* The benchmark only runs once. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvTimeAllocateAndFree( BaseType_t xUsePool )
+{
+uint32_t ulPair;
+uint64_t ullStartTime;
+void *pvBuffer;
+
+	ullStartTime = ullBenchmarkGetTimeNs();
+
+	for( ulPair = 0UL; ulPair < mpbPAIRS; ulPair++ )
+	{
+		if( xUsePool != pdFALSE )
+		{
+			pvBuffer = pvMemoryPoolAllocate( xPool, 0 );
+		}
+		else
+		{
+			pvBuffer = pvPortMalloc( sizeof( MessageBuffer_t ) );
+		}
+
+		if( pvBuffer == NULL )
+		{
+			xErrorDetected = pdTRUE;
+			break;
+		}
+
+		if( xUsePool != pdFALSE )
+		{
+			vMemoryPoolFree( xPool, pvBuffer );
+		}
+		else
+		{
+			vPortFree( pvBuffer );
+		}
+	}
+
+	return ullBenchmarkGetTimeNs() - ullStartTime;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvTimeRecycling( RecyclePhase_t ePhase, uint32_t ulMessages )
+{
+uint64_t ullStartTime;
+
+	ulNextSequence = 0UL;
+	ulMessagesToSend = ulMessages;
+	ulRecycleMessages[ ePhase ] = ulMessages;
+
+	ullStartTime = ullBenchmarkGetTimeNs();
+
+	/* Setting the phase starts the tick interrupt, if it is the consumer.
+	The benchmark task runs at the highest priority of the three tasks, so
+	the producer does not start until the benchmark task blocks waiting for
+	the last buffer to be consumed. */
+	eActivePhase = ePhase;
+	xTaskNotifyGive( xProducer );
+
+	if( ePhase == mpbPOOL_ISR )
+	{
+		/* Wake every tick while waiting, otherwise, once the producer blocks,
+		the idle task would suppress the ticks that free the buffers. */
+		while( ulTaskNotifyTake( pdTRUE, ( TickType_t ) 1 ) == 0UL )
+		{
+		}
+	}
+	else
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	}
+
+	eActivePhase = mpbNUMBER_OF_PHASES;
+
+	return ullBenchmarkGetTimeNs() - ullStartTime;
+}
+/*-----------------------------------------------------------*/
+
+static void prvProducerTask( void *pvParameters )
+{
+RecyclePhase_t ePhase;
+MessageBuffer_t *pxMessage;
+uint32_t ulSequence;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Wait for the benchmark task to start a phase. */
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		ePhase = eActivePhase;
+
+		for( ulSequence = 0UL; ulSequence < ulMessagesToSend; ulSequence++ )
+		{
+			if( ePhase == mpbHEAP )
+			{
+				pxMessage = ( MessageBuffer_t * ) pvPortMalloc( sizeof( MessageBuffer_t ) );
+			}
+			else
+			{
+				pxMessage = ( MessageBuffer_t * ) pvMemoryPoolAllocate( xPool, portMAX_DELAY );
+			}
+
+			if( pxMessage == NULL )
+			{
+				xErrorDetected = pdTRUE;
+				break;
+			}
+
+			pxMessage->ulSequence = ulSequence;
+			( void ) xQueueSend( xMessageQueue, &pxMessage, portMAX_DELAY );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumerTask( void *pvParameters )
+{
+MessageBuffer_t *pxMessage;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) xQueueReceive( xMessageQueue, &pxMessage, portMAX_DELAY );
+		prvCheckMessage( pxMessage );
+
+		if( eActivePhase == mpbHEAP )
+		{
+			vPortFree( pxMessage );
+		}
+		else
+		{
+			vMemoryPoolFree( xPool, pxMessage );
+		}
+
+		if( ulNextSequence == ulMessagesToSend )
+		{
+			xTaskNotifyGive( xBenchmarkTask );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vMemoryPoolBenchmarkISR( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+MessageBuffer_t *pxMessage;
+uint32_t ulBuffer;
+
+	if( eActivePhase == mpbPOOL_ISR )
+	{
+		for( ulBuffer = 0UL; ulBuffer < mpbISR_BUFFERS_PER_TICK; ulBuffer++ )
+		{
+			if( xQueueReceiveFromISR( xMessageQueue, &pxMessage, &xHigherPriorityTaskWoken ) != pdPASS )
+			{
+				break;
+			}
+
+			prvCheckMessage( pxMessage );
+			vMemoryPoolFreeFromISR( xPool, pxMessage, &xHigherPriorityTaskWoken );
+
+			if( ulNextSequence == ulMessagesToSend )
+			{
+				vTaskNotifyGiveFromISR( xBenchmarkTask, &xHigherPriorityTaskWoken );
+			}
+		}
+	}
+
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckMessage( const MessageBuffer_t * const pxMessage )
+{
+	if( pxMessage->ulSequence != ulNextSequence )
+	{
+		xErrorDetected = pdTRUE;
+	}
+
+	ulNextSequence++;
+	ulProgress++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckTimeout( void )
+{
+void *pvBuffers[ mpbBUFFERS ];
+UBaseType_t uxBuffer;
+TickType_t xStartTime;
+
+	for( uxBuffer = 0U; uxBuffer < mpbBUFFERS; uxBuffer++ )
+	{
+		pvBuffers[ uxBuffer ] = pvMemoryPoolAllocate( xPool, 0 );
+
+		if( pvBuffers[ uxBuffer ] == NULL )
+		{
+			xErrorDetected = pdTRUE;
+		}
+	}
+
+	if( uxMemoryPoolGetFreeBlocks( xPool ) != 0U )
+	{
+		xErrorDetected = pdTRUE;
+	}
+
+	/* The pool is empty, so the next allocation should wait for the whole
+	block time then fail. */
+	xStartTime = xTaskGetTickCount();
+
+	if( ( pvMemoryPoolAllocate( xPool, mpbTIMEOUT_TICKS ) != NULL ) || ( ( xTaskGetTickCount() - xStartTime ) < mpbTIMEOUT_TICKS ) )
+	{
+		xErrorDetected = pdTRUE;
+	}
+
+	for( uxBuffer = 0U; uxBuffer < mpbBUFFERS; uxBuffer++ )
+	{
+		if( pvBuffers[ uxBuffer ] != NULL )
+		{
+			vMemoryPoolFree( xPool, pvBuffers[ uxBuffer ] );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsMemoryPoolBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( xErrorDetected != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ( ulProgress == ulLastProgress ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		ulLastProgress = ulProgress;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vMemoryPoolBenchmarkPrintResults( void )
+{
+	vBenchmarkPrintRate( "Allocate and free, memory pool", mpbPAIRS, ullPairNs[ 0 ] );
+	vBenchmarkPrintRate( "Allocate and free, heap", mpbPAIRS, ullPairNs[ 1 ] );
+	vBenchmarkPrintRate( "Producer to consumer, memory pool", ulRecycleMessages[ mpbPOOL ], ullRecycleNs[ mpbPOOL ] );
+	vBenchmarkPrintRate( "Producer to consumer, heap", ulRecycleMessages[ mpbHEAP ], ullRecycleNs[ mpbHEAP ] );
+	vBenchmarkPrintRate( "Producer to tick interrupt, memory pool", ulRecycleMessages[ mpbPOOL_ISR ], ullRecycleNs[ mpbPOOL_ISR ] );
+
+	printf( "Memory pool: %u of %u blocks in use at most, %lu allocations, %lu blocked, %lu failed\r\n",
+			( unsigned ) xPoolStats.uxMaxBlocksInUse, ( unsigned ) xPoolStats.uxBlocks,
+			( unsigned long ) xPoolStats.ulAllocations, ( unsigned long ) xPoolStats.ulBlockedAllocations,
+			( unsigned long ) xPoolStats.ulFailedAllocations );
+}
+/*-----------------------------------------------------------*/
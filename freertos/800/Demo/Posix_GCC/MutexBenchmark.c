@@ -0,0 +1,391 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the cost of taking and giving mutexes, without and with contention.
+ * The benchmark task runs each test in turn:
+ *
+ * Uncontended - The benchmark task takes and gives a mutex, a recursive mutex
+ * and, for comparison, a binary semaphore mbCYCLES times each.  A binary
+ * semaphore is always taken and given through the queue, which is the path a
+ * mutex takes when configUSE_FAST_MUTEXES is 0.
+ *
+ * Priority inheritance - The benchmark task takes the mutex, then notifies a
+ * higher priority task that tries to take it too.  The higher priority task
+ * blocks, so the benchmark task runs again with the priority it inherited,
+ * gives the mutex, and the higher priority task runs to take and give the
+ * mutex before it waits for the next notification.  Each cycle includes four
+ * context switches, and checks the priority was inherited.
+ *
+ * Equal priorities - The benchmark task and a partner of the same priority
+ * both take the mutex, yield while holding it, give it, then yield again, so
+ * each finds the mutex held by the other on every cycle.  With
+ * configFAST_MUTEX_SPIN_COUNT above 0 the task that finds the mutex held
+ * yields back to the holder instead of blocking.
+ *
+ * Build with -DconfigUSE_FAST_MUTEXES=0 and 1 to compare the two.  The
+ * partner tasks run at priorities used by the tasks of the standard demo, so
+ * the benchmark is run on its own - see main.c.  The results are printed once
+ * the scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "MutexBenchmark.h"
+
+#if( ( configUSE_MUTEXES != 1 ) || ( configUSE_RECURSIVE_MUTEXES != 1 ) || ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error MutexBenchmark.c requires configUSE_MUTEXES, configUSE_RECURSIVE_MUTEXES and configUSE_TASK_NOTIFICATIONS to be 1.
+#endif
+
+/* The number of times each uncontended lock is taken and given. */
+#define mbCYCLES					( 200000UL )
+
+/* The number of contended cycles in each of the other two tests. */
+#define mbCONTENDED_CYCLES			( 20000UL )
+
+/* The number of cycles between the delays that let the idle task run. */
+#define mbCYCLES_PER_DELAY			( 1000UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that runs the tests, as described at the top of this file.
+ */
+static void prvMutexBenchmarkTask( void *pvParameters );
+
+/*
+ * The higher priority task that blocks on the mutex in the priority
+ * inheritance test.
+ */
+static void prvInheritingTask( void *pvParameters );
+
+/*
+ * The partner of the same priority in the equal priorities test.
+ */
+static void prvEqualPriorityTask( void *pvParameters );
+
+/*
+ * Take and give xLock ulCycles times, returning the time taken.
+ */
+static uint64_t prvTimeUncontended( SemaphoreHandle_t xLock, BaseType_t xRecursive, uint32_t ulCycles );
+
+/*
+ * Take the mutex, yield, give the mutex and yield again ulCycles times.
+ */
+static void prvYieldWhileHolding( uint32_t ulCycles );
+
+/*-----------------------------------------------------------*/
+
+static SemaphoreHandle_t xMutex = NULL, xRecursiveMutex = NULL, xBinarySemaphore = NULL;
+static TaskHandle_t xBenchmarkTask = NULL, xInheritingTask = NULL, xEqualPriorityTask = NULL;
+
+/* The results. */
+static uint64_t ullMutexNs = 0ULL, ullRecursiveMutexNs = 0ULL, ullBinarySemaphoreNs = 0ULL, ullEqualPriorityNs = 0ULL;
+static BenchmarkStats_t xInheritanceCycle = benchmarkSTATS_INIT( "Contended cycle, priority inheritance" );
+
+/* Incremented by each cycle, so the check task can see the benchmark is
+progressing. */
+static volatile uint32_t ulProgress = 0UL, ulLastProgress = 0UL;
+
+/* Latched if a mutex cannot be taken or given, or if the priority is not
+inherited. */
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/* Set once every test has run. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartMutexBenchmark( UBaseType_t uxPriority )
+{
+	/* There must be room for the inheriting task below the check task. */
+	configASSERT( uxPriority < ( configMAX_PRIORITIES - 2 ) );
+
+	xMutex = xSemaphoreCreateMutex();
+	xRecursiveMutex = xSemaphoreCreateRecursiveMutex();
+	xBinarySemaphore = xSemaphoreCreateBinary();
+	configASSERT( xMutex );
+	configASSERT( xRecursiveMutex );
+	configASSERT( xBinarySemaphore );
+	xSemaphoreGive( xBinarySemaphore );
+
+	xTaskCreate( prvMutexBenchmarkTask, "MuBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xBenchmarkTask );
+	xTaskCreate( prvInheritingTask, "MuHigh", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, &xInheritingTask );
+	xTaskCreate( prvEqualPriorityTask, "MuEqual", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xEqualPriorityTask );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvTimeUncontended( SemaphoreHandle_t xLock, BaseType_t xRecursive, uint32_t ulCycles )
+{
+uint32_t ulCycle;
+uint64_t ullStartTime, ullElapsed = 0ULL;
+
+	ullStartTime = ullBenchmarkGetTimeNs();
+
+	for( ulCycle = 0UL; ulCycle < ulCycles; ulCycle++ )
+	{
+		if( xRecursive != pdFALSE )
+		{
+			if( ( xSemaphoreTakeRecursive( xLock, 0 ) != pdPASS ) || ( xSemaphoreGiveRecursive( xLock ) != pdPASS ) )
+			{
+				xErrorDetected = pdTRUE;
+			}
+		}
+		else
+		{
+			if( ( xSemaphoreTake( xLock, 0 ) != pdPASS ) || ( xSemaphoreGive( xLock ) != pdPASS ) )
+			{
+				xErrorDetected = pdTRUE;
+			}
+		}
+
+		/* Let the idle task run now and then, leaving the delay out of the
+		time. */
+		if( ( ( ulCycle + 1UL ) % mbCYCLES_PER_DELAY ) == 0UL )
+		{
+			ullElapsed += ullBenchmarkGetTimeNs() - ullStartTime;
+			vTaskDelay( ( TickType_t ) 1 );
+			ullStartTime = ullBenchmarkGetTimeNs();
+		}
+
+		ulProgress++;
+	}
+
+	return ullElapsed + ( ullBenchmarkGetTimeNs() - ullStartTime );
+}
+/*-----------------------------------------------------------*/
+
+static void prvYieldWhileHolding( uint32_t ulCycles )
+{
+uint32_t ulCycle;
+
+	for( ulCycle = 0UL; ulCycle < ulCycles; ulCycle++ )
+	{
+		if( xSemaphoreTake( xMutex, portMAX_DELAY ) != pdPASS )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		taskYIELD();
+
+		if( xSemaphoreGive( xMutex ) != pdPASS )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		taskYIELD();
+		ulProgress++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMutexBenchmarkTask( void *pvParameters )
+{
+uint32_t ulCycle;
+uint64_t ullStartTime;
+const UBaseType_t uxPriority = uxTaskPriorityGet( NULL );
+
+	( void ) pvParameters;
+
+	/* Uncontended. */
+	ullMutexNs = prvTimeUncontended( xMutex, pdFALSE, mbCYCLES );
+	ullRecursiveMutexNs = prvTimeUncontended( xRecursiveMutex, pdTRUE, mbCYCLES );
+	ullBinarySemaphoreNs = prvTimeUncontended( xBinarySemaphore, pdFALSE, mbCYCLES );
+
+	/* Priority inheritance. */
+	for( ulCycle = 0UL; ulCycle < mbCONTENDED_CYCLES; ulCycle++ )
+	{
+		ullStartTime = ullBenchmarkGetTimeNs();
+
+		if( xSemaphoreTake( xMutex, portMAX_DELAY ) != pdPASS )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		/* The inheriting task preempts this task, and blocks on the mutex,
+		before the notify function returns. */
+		xTaskNotifyGive( xInheritingTask );
+
+		if( uxTaskPriorityGet( NULL ) != ( uxPriority + 1 ) )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		/* Likewise the inheriting task takes and gives the mutex before the
+		give function returns. */
+		if( xSemaphoreGive( xMutex ) != pdPASS )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		if( uxTaskPriorityGet( NULL ) != uxPriority )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		vBenchmarkAddSample( &xInheritanceCycle, ullBenchmarkGetTimeNs() - ullStartTime );
+
+		if( ( ( ulCycle + 1UL ) % mbCYCLES_PER_DELAY ) == 0UL )
+		{
+			vTaskDelay( ( TickType_t ) 1 );
+		}
+
+		ulProgress++;
+	}
+
+	/* Equal priorities.  The partner starts once this task yields, and this
+	task waits for it to finish. */
+	ullStartTime = ullBenchmarkGetTimeNs();
+	xTaskNotifyGive( xEqualPriorityTask );
+	prvYieldWhileHolding( mbCONTENDED_CYCLES );
+	ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	ullEqualPriorityNs = ullBenchmarkGetTimeNs() - ullStartTime;
+
+	xComplete = pdTRUE;
+
+	/* The tests only run once. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInheritingTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		if( xSemaphoreTake( xMutex, portMAX_DELAY ) != pdPASS )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		if( xSemaphoreGive( xMutex ) != pdPASS )
+		{
+			xErrorDetected = pdTRUE;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvEqualPriorityTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	prvYieldWhileHolding( mbCONTENDED_CYCLES );
+	xTaskNotifyGive( xBenchmarkTask );
+
+	/* The tests only run once. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsMutexBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( xErrorDetected != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ( ulProgress == ulLastProgress ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		ulLastProgress = ulProgress;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vMutexBenchmarkPrintResults( void )
+{
+	#if( configUSE_FAST_MUTEXES == 1 )
+		printf( "Fast mutexes, spin count %lu\r\n", ( unsigned long ) configFAST_MUTEX_SPIN_COUNT );
+	#else
+		printf( "Mutexes taken and given through the queue\r\n" );
+	#endif
+
+	vBenchmarkPrintRate( "Uncontended cycle, mutex", mbCYCLES, ullMutexNs );
+	vBenchmarkPrintRate( "Uncontended cycle, recursive mutex", mbCYCLES, ullRecursiveMutexNs );
+	vBenchmarkPrintRate( "Uncontended cycle, binary semaphore", mbCYCLES, ullBinarySemaphoreNs );
+	vBenchmarkPrintStats( &xInheritanceCycle );
+	vBenchmarkPrintRate( "Contended cycle, equal priorities", mbCONTENDED_CYCLES * 2UL, ullEqualPriorityNs );
+}
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,304 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares direct to task notifications, used as a light weight binary
+ * semaphore, against binary semaphores.
+ *
+ * Latency - Two receiver tasks block, one on a binary semaphore and one on
+ * ulTaskNotifyTake().  Every nbSTIMULUS_PERIOD ticks a lower priority stimulus
+ * task gives the semaphore then notifies the other receiver, and every
+ * nbSTIMULUS_PERIOD ticks (offset by half a period) vNotifyBenchmarkISR(),
+ * which must be called from the tick hook, alternately gives the semaphore or
+ * notifies the receiver from the tick interrupt.  Each receiver records the
+ * time between the give and it starting to run.
+ *
+ * Round trip - Once, when the scheduler starts, two tasks of equal priority
+ * pass control back and forth nbROUND_TRIPS times, first using a pair of binary
+ * semaphores and then using notifications.  Each round trip includes two
+ * context switches.
+ */
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "NotifyBenchmark.h"
+
+/* Priority of the task that gives from task level. */
+#define nbSTIMULUS_PRIORITY			( tskIDLE_PRIORITY + 1 )
+
+/* The stimulus task and the ISR each give once per period. */
+#define nbSTIMULUS_PERIOD			( ( TickType_t ) 4 )
+#define nbISR_OFFSET				( nbSTIMULUS_PERIOD / ( TickType_t ) 2 )
+
+/* The number of times control is passed back and forth in the round trip
+tests. */
+#define nbROUND_TRIPS				( 20000UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvSemaphoreReceiverTask( void *pvParameters );
+static void prvNotifyReceiverTask( void *pvParameters );
+static void prvStimulusTask( void *pvParameters );
+static void prvPingTask( void *pvParameters );
+static void prvPongTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+/* Latency measurements. */
+static BenchmarkStats_t xTaskSemaphoreLatency = benchmarkSTATS_INIT( "Task to task latency, binary semaphore" );
+static BenchmarkStats_t xTaskNotifyLatency = benchmarkSTATS_INIT( "Task to task latency, notification" );
+static BenchmarkStats_t xISRSemaphoreLatency = benchmarkSTATS_INIT( "ISR to task latency, binary semaphore" );
+static BenchmarkStats_t xISRNotifyLatency = benchmarkSTATS_INIT( "ISR to task latency, notification" );
+
+/* Round trip measurements. */
+static uint64_t ullSemaphoreRoundTripNs = 0ULL, ullNotifyRoundTripNs = 0ULL;
+
+/* The semaphores and tasks used by the tests. */
+static SemaphoreHandle_t xLatencySemaphore = NULL, xPingSemaphore = NULL, xPongSemaphore = NULL;
+static TaskHandle_t xNotifyReceiverTask = NULL, xPingTask = NULL, xPongTask = NULL;
+
+/* Set by whichever task or interrupt gives the semaphore or notification, so
+the receiver knows when, and from where, it was given. */
+static volatile uint64_t ullSemaphoreGiveTime = 0ULL, ullNotifyGiveTime = 0ULL;
+static BenchmarkStats_t * volatile pxSemaphoreStats = NULL;
+static BenchmarkStats_t * volatile pxNotifyStats = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartNotifyBenchmark( UBaseType_t uxPriority )
+{
+	xLatencySemaphore = xSemaphoreCreateBinary();
+	xPingSemaphore = xSemaphoreCreateBinary();
+	xPongSemaphore = xSemaphoreCreateBinary();
+	configASSERT( xLatencySemaphore );
+	configASSERT( xPingSemaphore );
+	configASSERT( xPongSemaphore );
+
+	xTaskCreate( prvSemaphoreReceiverTask, "SemRx", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+	xTaskCreate( prvNotifyReceiverTask, "NotifyRx", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xNotifyReceiverTask );
+	xTaskCreate( prvStimulusTask, "Stimulus", configMINIMAL_STACK_SIZE, NULL, nbSTIMULUS_PRIORITY, NULL );
+	xTaskCreate( prvPingTask, "Ping", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xPingTask );
+	xTaskCreate( prvPongTask, "Pong", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xPongTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSemaphoreReceiverTask( void *pvParameters )
+{
+uint64_t ullTakeTime;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		xSemaphoreTake( xLatencySemaphore, portMAX_DELAY );
+		ullTakeTime = ullBenchmarkGetTimeNs();
+		vBenchmarkAddSample( pxSemaphoreStats, ullTakeTime - ullSemaphoreGiveTime );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyReceiverTask( void *pvParameters )
+{
+uint64_t ullTakeTime;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		ullTakeTime = ullBenchmarkGetTimeNs();
+		vBenchmarkAddSample( pxNotifyStats, ullTakeTime - ullNotifyGiveTime );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvStimulusTask( void *pvParameters )
+{
+TickType_t xNextWakeTime;
+
+	( void ) pvParameters;
+
+	xNextWakeTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		vTaskDelayUntil( &xNextWakeTime, nbSTIMULUS_PERIOD );
+
+		/* The receivers have a higher priority than this task, so each runs,
+		and records its sample, before the give function returns. */
+		pxSemaphoreStats = &xTaskSemaphoreLatency;
+		ullSemaphoreGiveTime = ullBenchmarkGetTimeNs();
+		xSemaphoreGive( xLatencySemaphore );
+
+		pxNotifyStats = &xTaskNotifyLatency;
+		ullNotifyGiveTime = ullBenchmarkGetTimeNs();
+		xTaskNotifyGive( xNotifyReceiverTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vNotifyBenchmarkISR( void )
+{
+static BaseType_t xUseSemaphore = pdTRUE;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	if( ( xTaskGetTickCountFromISR() % nbSTIMULUS_PERIOD ) == nbISR_OFFSET )
+	{
+		/* Only one receiver is unblocked per interrupt so the measurement of
+		one does not include the time taken by the other. */
+		if( xUseSemaphore != pdFALSE )
+		{
+			pxSemaphoreStats = &xISRSemaphoreLatency;
+			ullSemaphoreGiveTime = ullBenchmarkGetTimeNs();
+			xSemaphoreGiveFromISR( xLatencySemaphore, &xHigherPriorityTaskWoken );
+			xUseSemaphore = pdFALSE;
+		}
+		else
+		{
+			pxNotifyStats = &xISRNotifyLatency;
+			ullNotifyGiveTime = ullBenchmarkGetTimeNs();
+			vTaskNotifyGiveFromISR( xNotifyReceiverTask, &xHigherPriorityTaskWoken );
+			xUseSemaphore = pdTRUE;
+		}
+
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvPingTask( void *pvParameters )
+{
+uint32_t ulRoundTrip;
+uint64_t ullStartTime;
+
+	( void ) pvParameters;
+
+	/* Pass control to the pong task using semaphores. */
+	ullStartTime = ullBenchmarkGetTimeNs();
+	for( ulRoundTrip = 0UL; ulRoundTrip < nbROUND_TRIPS; ulRoundTrip++ )
+	{
+		xSemaphoreGive( xPingSemaphore );
+		xSemaphoreTake( xPongSemaphore, portMAX_DELAY );
+	}
+	ullSemaphoreRoundTripNs = ullBenchmarkGetTimeNs() - ullStartTime;
+
+	/* Then pass control to the pong task using notifications. */
+	ullStartTime = ullBenchmarkGetTimeNs();
+	for( ulRoundTrip = 0UL; ulRoundTrip < nbROUND_TRIPS; ulRoundTrip++ )
+	{
+		xTaskNotifyGive( xPongTask );
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	}
+	ullNotifyRoundTripNs = ullBenchmarkGetTimeNs() - ullStartTime;
+
+	/* The tests only run once.  The task suspends itself rather than deleting
+	itself as the death demo tasks check the number of tasks remains
+	constant. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPongTask( void *pvParameters )
+{
+uint32_t ulRoundTrip;
+
+	( void ) pvParameters;
+
+	for( ulRoundTrip = 0UL; ulRoundTrip < nbROUND_TRIPS; ulRoundTrip++ )
+	{
+		xSemaphoreTake( xPingSemaphore, portMAX_DELAY );
+		xSemaphoreGive( xPongSemaphore );
+	}
+
+	for( ulRoundTrip = 0UL; ulRoundTrip < nbROUND_TRIPS; ulRoundTrip++ )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		xTaskNotifyGive( xPingTask );
+	}
+
+	/* The tests only run once. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vNotifyBenchmarkPrintResults( void )
+{
+	vBenchmarkPrintStats( &xTaskSemaphoreLatency );
+	vBenchmarkPrintStats( &xTaskNotifyLatency );
+	vBenchmarkPrintStats( &xISRSemaphoreLatency );
+	vBenchmarkPrintStats( &xISRNotifyLatency );
+	vBenchmarkPrintRate( "Round trip, binary semaphores", nbROUND_TRIPS, ullSemaphoreRoundTripNs );
+	vBenchmarkPrintRate( "Round trip, notifications", nbROUND_TRIPS, ullNotifyRoundTripNs );
+}
+/*-----------------------------------------------------------*/
+
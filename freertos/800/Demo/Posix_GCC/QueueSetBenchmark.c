@@ -0,0 +1,383 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the cost of multiplexing queues with a queue set as the number of
+ * members grows from 4 to 64, so a queue set that holds a list of its ready
+ * members (configUSE_QUEUE_SET_READY_LIST) can be compared with one that holds
+ * a queue of events.  For each number of members the benchmark task creates a
+ * queue set and that many queues, adds the queues to the set, then runs
+ * qsbROUNDS rounds of:
+ *
+ *   + Sending an item to every member, recording the time taken, which
+ *     includes notifying the set.
+ *
+ *   + Draining the members one at a time with xQueueSelectFromSet() and
+ *     xQueueReceive(), recording the time taken.
+ *
+ *   + When the set holds a list of its ready members, sending an item to every
+ *     member again and draining up to qsbBATCH_SIZE members at a time with
+ *     uxQueueSelectMultipleFromSet(), recording the time taken.
+ *
+ * Every receive must succeed with a block time of zero, every item must be
+ * the one sent in the same round, and the set must be empty at the end of
+ * each round.  The check task checks the rounds are still being run.
+ *
+ * Build with -DconfigUSE_QUEUE_SET_READY_LIST=0 and 1 to compare the two.  The
+ * benchmark is run on its own rather than with the standard demo tasks - see
+ * main.c.  The results are printed once the scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "QueueSetBenchmark.h"
+
+#if( configUSE_QUEUE_SETS != 1 )
+	#error QueueSetBenchmark.c requires configUSE_QUEUE_SETS to be 1.
+#endif
+
+/* The numbers of members measured. */
+#define qsbNUMBER_OF_SIZES			( 6 )
+#define qsbMAX_MEMBERS				( 64 )
+
+/* The length of each member queue. */
+#define qsbQUEUE_LENGTH				( 4 )
+
+/* The number of rounds run for each number of members, and the number of
+rounds between the delays that let the idle task run. */
+#define qsbROUNDS					( 5000UL )
+#define qsbROUNDS_PER_DELAY			( 100UL )
+
+/* The most members uxQueueSelectMultipleFromSet() is asked for at once. */
+#define qsbBATCH_SIZE				( 8 )
+
+/* The results for one number of members. */
+typedef struct QUEUE_SET_BENCHMARK_RESULT
+{
+	UBaseType_t uxMembers;
+	uint64_t ullSendNs;
+	uint64_t ullSelectNs;
+	uint64_t ullSelectMultipleNs;
+} QueueSetBenchmarkResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that runs the rounds, as described at the top of this file.
+ */
+static void prvQueueSetBenchmarkTask( void *pvParameters );
+
+/*
+ * Send ulValue to each of the first uxMembers queues, returning the time taken.
+ */
+static uint64_t prvSendToMembers( UBaseType_t uxMembers, uint32_t ulValue );
+
+/*
+ * Receive uxMembers items from the members of xQueueSet, each of which should
+ * be ulValue, returning the time taken.  If xMultiple is pdTRUE then the
+ * members are selected with uxQueueSelectMultipleFromSet().
+ */
+static uint64_t prvDrainSet( QueueSetHandle_t xQueueSet, UBaseType_t uxMembers, uint32_t ulValue, BaseType_t xMultiple );
+
+/*-----------------------------------------------------------*/
+
+static QueueSetBenchmarkResult_t xResults[ qsbNUMBER_OF_SIZES ] =
+{
+	{ 4, 0ULL, 0ULL, 0ULL },
+	{ 8, 0ULL, 0ULL, 0ULL },
+	{ 16, 0ULL, 0ULL, 0ULL },
+	{ 24, 0ULL, 0ULL, 0ULL },
+	{ 32, 0ULL, 0ULL, 0ULL },
+	{ qsbMAX_MEMBERS, 0ULL, 0ULL, 0ULL }
+};
+
+static QueueHandle_t xMembers[ qsbMAX_MEMBERS ];
+
+/* Incremented by each round, so the check task can see the benchmark is
+progressing. */
+static volatile uint32_t ulProgress = 0UL, ulLastProgress = 0UL;
+
+/* Latched if a member cannot be sent to, selected or received from, or if an
+item is not the one expected. */
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/* Set once every number of members has been measured. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartQueueSetBenchmark( UBaseType_t uxPriority )
+{
+	xTaskCreate( prvQueueSetBenchmarkTask, "QSBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvSendToMembers( UBaseType_t uxMembers, uint32_t ulValue )
+{
+UBaseType_t uxMember;
+uint64_t ullStartTime;
+
+	ullStartTime = ullBenchmarkGetTimeNs();
+
+	for( uxMember = 0; uxMember < uxMembers; uxMember++ )
+	{
+		if( xQueueSendToBack( xMembers[ uxMember ], &ulValue, 0 ) != pdPASS )
+		{
+			xErrorDetected = pdTRUE;
+		}
+	}
+
+	return ullBenchmarkGetTimeNs() - ullStartTime;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvDrainSet( QueueSetHandle_t xQueueSet, UBaseType_t uxMembers, uint32_t ulValue, BaseType_t xMultiple )
+{
+UBaseType_t uxReceived = 0, uxSelected, uxIndex;
+QueueSetMemberHandle_t xSelected[ qsbBATCH_SIZE ];
+uint32_t ulReceived;
+uint64_t ullStartTime, ullElapsed;
+
+	ullStartTime = ullBenchmarkGetTimeNs();
+
+	while( uxReceived < uxMembers )
+	{
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+		{
+			if( xMultiple != pdFALSE )
+			{
+				uxSelected = uxQueueSelectMultipleFromSet( xQueueSet, xSelected, qsbBATCH_SIZE, 0 );
+			}
+			else
+			{
+				xSelected[ 0 ] = xQueueSelectFromSet( xQueueSet, 0 );
+				uxSelected = ( xSelected[ 0 ] != NULL ) ? 1 : 0;
+			}
+		}
+		#else
+		{
+			( void ) xMultiple;
+			xSelected[ 0 ] = xQueueSelectFromSet( xQueueSet, 0 );
+			uxSelected = ( xSelected[ 0 ] != NULL ) ? 1 : 0;
+		}
+		#endif /* configUSE_QUEUE_SET_READY_LIST */
+
+		if( uxSelected == 0 )
+		{
+			/* Every item sent should be selected. */
+			xErrorDetected = pdTRUE;
+			break;
+		}
+
+		for( uxIndex = 0; uxIndex < uxSelected; uxIndex++ )
+		{
+			if( ( xQueueReceive( ( QueueHandle_t ) xSelected[ uxIndex ], &ulReceived, 0 ) != pdPASS ) || ( ulReceived != ulValue ) )
+			{
+				xErrorDetected = pdTRUE;
+			}
+		}
+
+		uxReceived += uxSelected;
+	}
+
+	ullElapsed = ullBenchmarkGetTimeNs() - ullStartTime;
+
+	/* Nothing should be left. */
+	if( ( uxReceived != uxMembers ) || ( xQueueSelectFromSet( xQueueSet, 0 ) != NULL ) )
+	{
+		xErrorDetected = pdTRUE;
+	}
+
+	return ullElapsed;
+}
+/*-----------------------------------------------------------*/
+
+static void prvQueueSetBenchmarkTask( void *pvParameters )
+{
+uint32_t ulSize, ulRound;
+UBaseType_t uxMember, uxMembers;
+QueueSetHandle_t xQueueSet;
+
+	( void ) pvParameters;
+
+	for( ulSize = 0UL; ulSize < qsbNUMBER_OF_SIZES; ulSize++ )
+	{
+		uxMembers = xResults[ ulSize ].uxMembers;
+
+		/* The set needs room for an event for every item the members can
+		hold, unless it holds a list of its ready members. */
+		xQueueSet = xQueueCreateSet( uxMembers * qsbQUEUE_LENGTH );
+		configASSERT( xQueueSet );
+
+		for( uxMember = 0; uxMember < uxMembers; uxMember++ )
+		{
+			xMembers[ uxMember ] = xQueueCreate( qsbQUEUE_LENGTH, sizeof( uint32_t ) );
+			configASSERT( xMembers[ uxMember ] );
+
+			if( xQueueAddToSet( xMembers[ uxMember ], xQueueSet ) != pdPASS )
+			{
+				xErrorDetected = pdTRUE;
+			}
+		}
+
+		for( ulRound = 0UL; ulRound < qsbROUNDS; ulRound++ )
+		{
+			xResults[ ulSize ].ullSendNs += prvSendToMembers( uxMembers, ulRound );
+			xResults[ ulSize ].ullSelectNs += prvDrainSet( xQueueSet, uxMembers, ulRound, pdFALSE );
+
+			#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+			{
+				( void ) prvSendToMembers( uxMembers, ulRound );
+				xResults[ ulSize ].ullSelectMultipleNs += prvDrainSet( xQueueSet, uxMembers, ulRound, pdTRUE );
+			}
+			#endif /* configUSE_QUEUE_SET_READY_LIST */
+
+			if( ( ( ulRound + 1UL ) % qsbROUNDS_PER_DELAY ) == 0UL )
+			{
+				vTaskDelay( ( TickType_t ) 1 );
+			}
+
+			ulProgress++;
+		}
+
+		for( uxMember = 0; uxMember < uxMembers; uxMember++ )
+		{
+			if( xQueueRemoveFromSet( xMembers[ uxMember ], xQueueSet ) != pdPASS )
+			{
+				xErrorDetected = pdTRUE;
+			}
+
+			vQueueDelete( xMembers[ uxMember ] );
+		}
+
+		vQueueDelete( xQueueSet );
+	}
+
+	xComplete = pdTRUE;
+
+	/* The benchmark only runs once. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsQueueSetBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( xErrorDetected != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ( ulProgress == ulLastProgress ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		ulLastProgress = ulProgress;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vQueueSetBenchmarkPrintResults( void )
+{
+uint32_t ulSize;
+uint32_t ulItems;
+char cName[ 64 ];
+
+	#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+		printf( "Queue sets hold a list of their ready members\r\n" );
+	#else
+		printf( "Queue sets hold a queue of events\r\n" );
+	#endif
+
+	for( ulSize = 0UL; ulSize < qsbNUMBER_OF_SIZES; ulSize++ )
+	{
+		ulItems = ( uint32_t ) xResults[ ulSize ].uxMembers * qsbROUNDS;
+
+		snprintf( cName, sizeof( cName ), "Send to member, %lu members", ( unsigned long ) xResults[ ulSize ].uxMembers );
+		vBenchmarkPrintRate( cName, ulItems, xResults[ ulSize ].ullSendNs );
+		snprintf( cName, sizeof( cName ), "Select and receive, %lu members", ( unsigned long ) xResults[ ulSize ].uxMembers );
+		vBenchmarkPrintRate( cName, ulItems, xResults[ ulSize ].ullSelectNs );
+
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+		{
+			snprintf( cName, sizeof( cName ), "Select %d and receive, %lu members", qsbBATCH_SIZE, ( unsigned long ) xResults[ ulSize ].uxMembers );
+			vBenchmarkPrintRate( cName, ulItems, xResults[ ulSize ].ullSelectMultipleNs );
+		}
+		#endif /* configUSE_QUEUE_SET_READY_LIST */
+	}
+}
+/*-----------------------------------------------------------*/
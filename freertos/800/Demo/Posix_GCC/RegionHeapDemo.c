@@ -0,0 +1,338 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Simulates the memory of an STM32F4 with three arrays added to the heap as
+ * regions - core coupled memory (fast), SRAM2 (DMA capable) and an external
+ * SDRAM (bulk and DMA capable) - and checks that heap_regions.c places each
+ * allocation in a region that has the attributes asked for.  The heap array
+ * stands in for SRAM1, and has no attributes on the host.
+ *
+ * The demo task's own stack is allocated from the fast region with
+ * xTaskCreateWithStackHints(), which is checked from the fast region's free
+ * space before the scheduler is started.  Then each cycle the task:
+ *
+ *   + Allocates a DMA buffer, a fast block and a bulk buffer, and checks each
+ *     is in a region with the attribute asked for.
+ *
+ *   + Asks for memory that is both fast and DMA capable, which no region is,
+ *     and checks the request falls back to a DMA capable region, as fast is
+ *     only a preference.
+ *
+ *   + Fills the fast region, and checks the request that does not fit falls
+ *     back to another region.
+ *
+ * The standard demo tasks do not use hints, and the heap array is large enough
+ * for them, so they do not take memory from the simulated regions.  The usage
+ * of each region is printed once the scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Demo includes. */
+#include "RegionHeapDemo.h"
+
+#if( configUSE_HEAP_PLACEMENT_HINTS != 1 )
+	#error RegionHeapDemo.c requires configUSE_HEAP_PLACEMENT_HINTS to be 1, and heap_regions.c.
+#endif
+
+/* The sizes of the simulated regions. */
+#define rhdCCM_SIZE				( 64U * 1024U )
+#define rhdSRAM2_SIZE			( 16U * 1024U )
+#define rhdSDRAM_SIZE			( 1024U * 1024U )
+
+/* The sizes of the blocks allocated each cycle. */
+#define rhdDMA_BUFFER_SIZE		( ( size_t ) 512 )
+#define rhdFAST_BLOCK_SIZE		( ( size_t ) 256 )
+#define rhdBULK_BUFFER_SIZE		( ( size_t ) ( 256U * 1024U ) )
+
+/* The size of the blocks used to fill the fast region.  More than enough are
+held to fill it. */
+#define rhdFILL_BLOCK_SIZE		( ( size_t ) 4096 )
+#define rhdFILL_BLOCKS			( ( rhdCCM_SIZE / rhdFILL_BLOCK_SIZE ) + 1U )
+
+/* The time between cycles. */
+#define rhdCYCLE_DELAY			( ( TickType_t ) 10 / portTICK_PERIOD_MS )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that allocates from the regions and checks where each block is
+ * placed.
+ */
+static void prvRegionHeapTask( void *pvParameters );
+
+/*
+ * Return the attributes of the region that holds the memory pointed to by pv.
+ * Reports an error if the memory is not in any region.
+ */
+static UBaseType_t prvRegionAttributes( const void *pv );
+
+/*
+ * Return the number of free bytes in the first region that has the attributes
+ * uxAttributes.
+ */
+static size_t prvRegionFreeBytes( UBaseType_t uxAttributes );
+
+/*-----------------------------------------------------------*/
+
+/* The simulated regions. */
+static uint8_t ucCCM[ rhdCCM_SIZE ];
+static uint8_t ucSRAM2[ rhdSRAM2_SIZE ];
+static uint8_t ucSDRAM[ rhdSDRAM_SIZE ];
+
+/* Regions that requests without hints should not use are added last. */
+static const HeapRegion_t xHeapRegions[] =
+{
+	{ ucSRAM2, sizeof( ucSRAM2 ), portHEAP_ATTRIBUTE_DMA },
+	{ ucSDRAM, sizeof( ucSDRAM ), portHEAP_ATTRIBUTE_BULK | portHEAP_ATTRIBUTE_DMA },
+	{ ucCCM, sizeof( ucCCM ), portHEAP_ATTRIBUTE_FAST },
+	{ NULL, 0, 0 }
+};
+
+/* Set to pdTRUE if a check fails. */
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/* Incremented by each cycle, so the check task can see the demo is still
+running. */
+static volatile uint32_t ulCycles = 0UL, ulLastCycles = 0UL;
+
+/*-----------------------------------------------------------*/
+
+void vStartRegionHeapDemo( UBaseType_t uxPriority )
+{
+size_t xFreeBefore;
+
+	vPortDefineHeapRegions( xHeapRegions );
+
+	/* The stack of the task is placed in the fast region, so the free space in
+	the fast region falls by at least the size of the stack. */
+	xFreeBefore = prvRegionFreeBytes( portHEAP_ATTRIBUTE_FAST );
+	xTaskCreateWithStackHints( prvRegionHeapTask, "RegHeap", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL, portHEAP_ATTRIBUTE_FAST );
+
+	if( ( xFreeBefore - prvRegionFreeBytes( portHEAP_ATTRIBUTE_FAST ) ) < ( configMINIMAL_STACK_SIZE * sizeof( StackType_t ) ) )
+	{
+		xErrorDetected = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvRegionHeapTask( void *pvParameters )
+{
+void *pvDMA, *pvFast, *pvBulk, *pvFastDMA;
+void *pvFill[ rhdFILL_BLOCKS ];
+UBaseType_t uxBlock, uxBlocks;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Each block must be in a region with the attribute asked for. */
+		pvDMA = pvPortMallocWithHints( rhdDMA_BUFFER_SIZE, portHEAP_ATTRIBUTE_DMA );
+		pvFast = pvPortMallocWithHints( rhdFAST_BLOCK_SIZE, portHEAP_ATTRIBUTE_FAST );
+		pvBulk = pvPortMallocWithHints( rhdBULK_BUFFER_SIZE, portHEAP_ATTRIBUTE_BULK );
+
+		if( ( prvRegionAttributes( pvDMA ) & portHEAP_ATTRIBUTE_DMA ) == 0 )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		if( ( prvRegionAttributes( pvFast ) & portHEAP_ATTRIBUTE_FAST ) == 0 )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		if( ( prvRegionAttributes( pvBulk ) & portHEAP_ATTRIBUTE_BULK ) == 0 )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		/* No region is both fast and DMA capable.  Fast is only a preference,
+		so the block must come from a DMA capable region. */
+		pvFastDMA = pvPortMallocWithHints( rhdDMA_BUFFER_SIZE, portHEAP_ATTRIBUTE_FAST | portHEAP_ATTRIBUTE_DMA );
+
+		if( ( prvRegionAttributes( pvFastDMA ) & portHEAP_ATTRIBUTE_DMA ) == 0 )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		vPortFree( pvDMA );
+		vPortFree( pvFast );
+		vPortFree( pvBulk );
+		vPortFree( pvFastDMA );
+
+		/* Fill the fast region.  The block that does not fit must still be
+		allocated, from another region. */
+		uxBlocks = 0;
+
+		do
+		{
+			pvFill[ uxBlocks ] = pvPortMallocWithHints( rhdFILL_BLOCK_SIZE, portHEAP_ATTRIBUTE_FAST );
+			uxBlocks++;
+		} while( ( uxBlocks < rhdFILL_BLOCKS ) && ( ( prvRegionAttributes( pvFill[ uxBlocks - 1 ] ) & portHEAP_ATTRIBUTE_FAST ) != 0 ) );
+
+		if( ( prvRegionAttributes( pvFill[ uxBlocks - 1 ] ) & portHEAP_ATTRIBUTE_FAST ) != 0 )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		for( uxBlock = 0; uxBlock < uxBlocks; uxBlock++ )
+		{
+			vPortFree( pvFill[ uxBlock ] );
+		}
+
+		ulCycles++;
+		vTaskDelay( rhdCYCLE_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvRegionAttributes( const void *pv )
+{
+UBaseType_t uxRegion, uxAttributes = 0;
+HeapRegionStats_t xStats;
+BaseType_t xFound = pdFALSE;
+
+	for( uxRegion = 0; uxRegion < uxPortGetHeapRegionCount(); uxRegion++ )
+	{
+		vPortGetHeapRegionStats( uxRegion, &xStats );
+
+		if( ( ( const uint8_t * ) pv >= xStats.pucStartAddress ) && ( ( const uint8_t * ) pv < ( xStats.pucStartAddress + xStats.xSizeInBytes ) ) )
+		{
+			uxAttributes = xStats.uxAttributes;
+			xFound = pdTRUE;
+		}
+	}
+
+	if( xFound == pdFALSE )
+	{
+		xErrorDetected = pdTRUE;
+	}
+
+	return uxAttributes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvRegionFreeBytes( UBaseType_t uxAttributes )
+{
+UBaseType_t uxRegion;
+HeapRegionStats_t xStats;
+size_t xFreeBytes = 0;
+BaseType_t xFound = pdFALSE;
+
+	for( uxRegion = 0; ( uxRegion < uxPortGetHeapRegionCount() ) && ( xFound == pdFALSE ); uxRegion++ )
+	{
+		vPortGetHeapRegionStats( uxRegion, &xStats );
+
+		if( ( xStats.uxAttributes & uxAttributes ) == uxAttributes )
+		{
+			xFreeBytes = xStats.xFreeBytes;
+			xFound = pdTRUE;
+		}
+	}
+
+	return xFreeBytes;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsRegionHeapDemoStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( ( xErrorDetected != pdFALSE ) || ( ulCycles == ulLastCycles ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastCycles = ulCycles;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRegionHeapDemoPrintResults( void )
+{
+UBaseType_t uxRegion;
+HeapRegionStats_t xStats;
+
+	for( uxRegion = 0; uxRegion < uxPortGetHeapRegionCount(); uxRegion++ )
+	{
+		vPortGetHeapRegionStats( uxRegion, &xStats );
+		printf( "Heap region %lu (attributes 0x%02lx): %lu bytes, %lu free (min %lu), largest free block %lu, %lu blocks allocated\r\n",
+				( unsigned long ) uxRegion,
+				( unsigned long ) xStats.uxAttributes,
+				( unsigned long ) xStats.xSizeInBytes,
+				( unsigned long ) xStats.xFreeBytes,
+				( unsigned long ) xStats.xMinimumEverFreeBytes,
+				( unsigned long ) xStats.xLargestFreeBlock,
+				( unsigned long ) xStats.uxAllocatedBlocks );
+	}
+}
+/*-----------------------------------------------------------*/
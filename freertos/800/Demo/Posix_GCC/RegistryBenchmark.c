@@ -0,0 +1,501 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the effect on the scheduler of taking snapshots of every task with
+ * uxTaskGetSystemState(), as a monitoring task would.  When
+ * configUSE_TASK_REGISTRY is 0 uxTaskGetSystemState() suspends the scheduler
+ * while it walks every task list; when it is 1 it reads the task registry one
+ * task at a time, each within a short critical section.  Build the demo with
+ * -DconfigUSE_TASK_REGISTRY=0 to compare the two.
+ *
+ * trbWORKERS worker tasks block for between 1 and trbDELAY_SPREAD ticks in
+ * turn, so the tasks move between the ready and delayed lists while the
+ * snapshots are taken.  A churn task creates a task and deletes it a tick
+ * later, over and over, so tasks are created and freed during the snapshots.
+ *
+ * The benchmark task runs at the lowest priority of them all.  Each round it
+ * takes trbBURST snapshots back to back, then blocks for a tick so the idle
+ * task can free the deleted tasks.  The processor time each snapshot takes is
+ * recorded - the time spent running the tasks that preempt it is not - and
+ * the snapshot is checked to hold every worker task once and no task more than
+ * once.  When the registry is used, each round also exports the registry with
+ * xTaskRegistryExport() and decodes the export in the same way a host would,
+ * checking it in the same way.
+ *
+ * A probe task, at the highest priority, is notified by every tick interrupt
+ * (see vRegistryBenchmarkISR()), which records the time.  The time the probe
+ * takes to run is recorded separately for ticks that occur while a snapshot is
+ * being taken and for those that do not - the difference is how long the
+ * snapshot kept the scheduler from running the probe.
+ *
+ * The results are printed once the scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "RegistryBenchmark.h"
+
+#if( configUSE_TRACE_FACILITY != 1 )
+	#error RegistryBenchmark.c requires configUSE_TRACE_FACILITY to be 1.
+#endif
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error RegistryBenchmark.c requires configUSE_TASK_NOTIFICATIONS to be 1.
+#endif
+
+/* The worker tasks, and the most ticks each blocks for. */
+#define trbWORKERS					( 128U )
+#define trbDELAY_SPREAD				( 8U )
+
+/* Room for the workers and every other task the benchmark and the demo
+create, including the idle, timer service and check tasks, and the deleted
+tasks the idle task has yet to free. */
+#define trbMAX_TASKS				( trbWORKERS + 64U )
+
+/* The number of rounds, and the number of snapshots taken each round. */
+#define trbROUNDS					( 1000UL )
+#define trbBURST					( 4UL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The benchmark task, as described at the top of this file.
+ */
+static void prvRegistryBenchmarkTask( void *pvParameters );
+
+/*
+ * The worker, churn and probe tasks, and the task the churn task creates and
+ * deletes.
+ */
+static void prvWorkerTask( void *pvParameters );
+static void prvChurnTask( void *pvParameters );
+static void prvChurnedTask( void *pvParameters );
+static void prvProbeTask( void *pvParameters );
+
+/*
+ * Check a snapshot holds each worker task once and no task more than once.
+ * pxHandles holds the handle of each of the uxTasks tasks in the snapshot.
+ */
+static void prvCheckSnapshot( const TaskHandle_t * const pxHandles, UBaseType_t uxTasks );
+
+/*
+ * Export the task registry, decode the export and check it.
+ */
+#if( configUSE_TASK_REGISTRY == 1 )
+
+	static void prvExportAndDecode( void );
+
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* The snapshots.  Only accessed by the benchmark task. */
+static TaskStatus_t xTaskStatus[ trbMAX_TASKS ];
+static TaskHandle_t xSnapshotHandles[ trbMAX_TASKS ];
+
+#if( configUSE_TASK_REGISTRY == 1 )
+
+	/* The export.  Declared as uint64_t so the records can be read in place
+	once decoded. */
+	static uint64_t ullExport[ ( sizeof( TaskRegistryExportHeader_t ) + ( trbMAX_TASKS * sizeof( TaskRegistryExportRecord_t ) ) ) / sizeof( uint64_t ) ];
+	static uint32_t ulExports = 0UL, ulExportsWithChanges = 0UL;
+
+#endif
+
+/* The worker tasks. */
+static TaskHandle_t xWorkers[ trbWORKERS ];
+
+/* The probe, which is notified each tick once the benchmark has started. */
+static TaskHandle_t xProbe = NULL;
+
+/* Set while the benchmark task is taking a snapshot. */
+static volatile BaseType_t xSnapshotInProgress = pdFALSE;
+
+/* Written by the tick interrupt before it notifies the probe. */
+static volatile uint32_t ulProbeNotifiedTime = 0UL;
+static volatile BaseType_t xProbeNotifiedDuringSnapshot = pdFALSE;
+
+/* The results. */
+static BenchmarkStats_t xSnapshotDuration = benchmarkSTATS_INIT( "Snapshot processor time (ns)" );
+static BenchmarkStats_t xProbeLatencyDuringSnapshot = benchmarkSTATS_INIT( "Tick to probe, tick during a snapshot (ns)" );
+static BenchmarkStats_t xProbeLatencyOtherwise = benchmarkSTATS_INIT( "Tick to probe, other ticks (ns)" );
+static UBaseType_t uxTasksInSnapshot = 0U;
+static uint32_t ulChurnedTasks = 0UL;
+
+/* Incremented each round, so the check task can see the benchmark is
+progressing. */
+static volatile uint32_t ulProgress = 0UL, ulLastProgress = 0UL;
+
+/* Latched if a snapshot or export is missing a worker task or holds a task
+more than once, or if the export cannot be decoded. */
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+/* Set once every round has run. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartRegistryBenchmark( UBaseType_t uxPriority )
+{
+UBaseType_t uxWorker;
+
+	/* The workers and churn task run above the benchmark task, and the probe
+	above them all. */
+	configASSERT( ( uxPriority + 2U ) < configMAX_PRIORITIES );
+
+	for( uxWorker = 0U; uxWorker < trbWORKERS; uxWorker++ )
+	{
+		xTaskCreate( prvWorkerTask, "RegWork", configMINIMAL_STACK_SIZE, ( void * ) uxWorker, uxPriority + 1U, &( xWorkers[ uxWorker ] ) );
+		configASSERT( xWorkers[ uxWorker ] );
+	}
+
+	xTaskCreate( prvChurnTask, "RegChurn", configMINIMAL_STACK_SIZE, ( void * ) ( uxPriority + 1U ), uxPriority + 1U, NULL );
+	xTaskCreate( prvProbeTask, "RegProbe", configMINIMAL_STACK_SIZE, NULL, uxPriority + 2U, &xProbe );
+	xTaskCreate( prvRegistryBenchmarkTask, "RegBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRegistryBenchmarkTask( void *pvParameters )
+{
+uint32_t ulRound, ulSnapshot;
+uint64_t ullStartTime, ullEndTime;
+UBaseType_t uxTasks, uxTask;
+
+	( void ) pvParameters;
+
+	for( ulRound = 0UL; ulRound < trbROUNDS; ulRound++ )
+	{
+		for( ulSnapshot = 0UL; ulSnapshot < trbBURST; ulSnapshot++ )
+		{
+			xSnapshotInProgress = pdTRUE;
+			ullStartTime = ullBenchmarkGetTaskCpuTimeNs();
+			uxTasks = uxTaskGetSystemState( xTaskStatus, trbMAX_TASKS, NULL );
+			ullEndTime = ullBenchmarkGetTaskCpuTimeNs();
+			xSnapshotInProgress = pdFALSE;
+
+			vBenchmarkAddSample( &xSnapshotDuration, ullEndTime - ullStartTime );
+			uxTasksInSnapshot = uxTasks;
+
+			for( uxTask = 0U; uxTask < uxTasks; uxTask++ )
+			{
+				xSnapshotHandles[ uxTask ] = xTaskStatus[ uxTask ].xHandle;
+			}
+
+			prvCheckSnapshot( xSnapshotHandles, uxTasks );
+		}
+
+		#if( configUSE_TASK_REGISTRY == 1 )
+		{
+			prvExportAndDecode();
+		}
+		#endif
+
+		ulProgress++;
+
+		/* Let the idle task free the tasks deleted by the churn task. */
+		vTaskDelay( 1 );
+	}
+
+	xComplete = pdTRUE;
+
+	/* The benchmark only runs once. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckSnapshot( const TaskHandle_t * const pxHandles, UBaseType_t uxTasks )
+{
+UBaseType_t uxTask, uxOther, uxWorker, uxFound;
+
+	for( uxTask = 0U; uxTask < uxTasks; uxTask++ )
+	{
+		for( uxOther = uxTask + 1U; uxOther < uxTasks; uxOther++ )
+		{
+			if( pxHandles[ uxTask ] == pxHandles[ uxOther ] )
+			{
+				xErrorDetected = pdTRUE;
+			}
+		}
+	}
+
+	/* No two handles are the same, so each worker found once is found once
+	only. */
+	uxFound = 0U;
+
+	for( uxWorker = 0U; uxWorker < trbWORKERS; uxWorker++ )
+	{
+		for( uxTask = 0U; uxTask < uxTasks; uxTask++ )
+		{
+			if( pxHandles[ uxTask ] == xWorkers[ uxWorker ] )
+			{
+				uxFound++;
+				break;
+			}
+		}
+	}
+
+	if( uxFound != trbWORKERS )
+	{
+		xErrorDetected = pdTRUE;
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_REGISTRY == 1 )
+
+	static void prvExportAndDecode( void )
+	{
+	size_t xBytes;
+	TaskRegistryExportHeader_t xHeader;
+	TaskRegistryExportRecord_t xRecord;
+	const uint8_t *pucExport = ( const uint8_t * ) ullExport;
+	UBaseType_t uxRecord, uxWorkersNamed = 0U;
+
+		xBytes = xTaskRegistryExport( ullExport, sizeof( ullExport ) );
+
+		/* Decode the export as a host would, from the bytes alone. */
+		if( xBytes < sizeof( TaskRegistryExportHeader_t ) )
+		{
+			xErrorDetected = pdTRUE;
+			return;
+		}
+
+		memcpy( &xHeader, pucExport, sizeof( TaskRegistryExportHeader_t ) );
+
+		if( ( xHeader.ulMagic != taskREGISTRY_MAGIC ) || ( xHeader.ulVersion != taskREGISTRY_VERSION ) || ( xHeader.ulTasksDropped != 0UL ) ||
+			( xBytes != ( sizeof( TaskRegistryExportHeader_t ) + ( xHeader.ulTaskCount * sizeof( TaskRegistryExportRecord_t ) ) ) ) || ( xHeader.ulTaskCount > trbMAX_TASKS ) )
+		{
+			xErrorDetected = pdTRUE;
+			return;
+		}
+
+		for( uxRecord = 0U; uxRecord < ( UBaseType_t ) xHeader.ulTaskCount; uxRecord++ )
+		{
+			memcpy( &xRecord, &( pucExport[ sizeof( TaskRegistryExportHeader_t ) + ( uxRecord * sizeof( TaskRegistryExportRecord_t ) ) ] ), sizeof( TaskRegistryExportRecord_t ) );
+			xSnapshotHandles[ uxRecord ] = ( TaskHandle_t ) ( portPOINTER_SIZE_TYPE ) xRecord.ullHandle;
+
+			if( strncmp( xRecord.cName, "RegWork", taskREGISTRY_NAME_LENGTH ) == 0 )
+			{
+				uxWorkersNamed++;
+			}
+		}
+
+		if( uxWorkersNamed != trbWORKERS )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		prvCheckSnapshot( xSnapshotHandles, ( UBaseType_t ) xHeader.ulTaskCount );
+
+		ulExports++;
+
+		if( xHeader.ulGenerationStart != xHeader.ulGenerationEnd )
+		{
+			ulExportsWithChanges++;
+		}
+	}
+
+#endif /* configUSE_TASK_REGISTRY */
+/*-----------------------------------------------------------*/
+
+static void prvWorkerTask( void *pvParameters )
+{
+const TickType_t xDelay = ( TickType_t ) 1 + ( ( TickType_t ) ( size_t ) pvParameters % ( TickType_t ) trbDELAY_SPREAD );
+
+	for( ;; )
+	{
+		vTaskDelay( xDelay );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvChurnTask( void *pvParameters )
+{
+const UBaseType_t uxPriority = ( UBaseType_t ) pvParameters;
+TaskHandle_t xChurned;
+
+	for( ;; )
+	{
+		if( xTaskCreate( prvChurnedTask, "RegTemp", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xChurned ) == pdPASS )
+		{
+			ulChurnedTasks++;
+			vTaskDelay( 1 );
+			vTaskDelete( xChurned );
+		}
+		else
+		{
+			xErrorDetected = pdTRUE;
+			vTaskDelay( 1 );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvChurnedTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvProbeTask( void *pvParameters )
+{
+uint32_t ulLatency;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		ulLatency = ulMainGetTraceTimestamp() - ulProbeNotifiedTime;
+
+		if( xComplete == pdFALSE )
+		{
+			if( xProbeNotifiedDuringSnapshot != pdFALSE )
+			{
+				vBenchmarkAddSample( &xProbeLatencyDuringSnapshot, ( uint64_t ) ulLatency );
+			}
+			else
+			{
+				vBenchmarkAddSample( &xProbeLatencyOtherwise, ( uint64_t ) ulLatency );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vRegistryBenchmarkISR( void )
+{
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+	if( xProbe != NULL )
+	{
+		ulProbeNotifiedTime = ulMainGetTraceTimestamp();
+		xProbeNotifiedDuringSnapshot = xSnapshotInProgress;
+		vTaskNotifyGiveFromISR( xProbe, &xHigherPriorityTaskWoken );
+	}
+
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsRegistryBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( xErrorDetected != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+	else if( ( ulProgress == ulLastProgress ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+	else
+	{
+		ulLastProgress = ulProgress;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRegistryBenchmarkPrintResults( void )
+{
+	#if( configUSE_TASK_REGISTRY == 1 )
+	{
+		printf( "Task snapshots read from the task registry, %u tasks, %lu tasks created and deleted\r\n", ( unsigned ) uxTasksInSnapshot, ( unsigned long ) ulChurnedTasks );
+	}
+	#else
+	{
+		printf( "Task snapshots taken with the scheduler suspended, %u tasks, %lu tasks created and deleted\r\n", ( unsigned ) uxTasksInSnapshot, ( unsigned long ) ulChurnedTasks );
+	}
+	#endif
+
+	vBenchmarkPrintStats( &xSnapshotDuration );
+	vBenchmarkPrintStats( &xProbeLatencyDuringSnapshot );
+	vBenchmarkPrintStats( &xProbeLatencyOtherwise );
+
+	#if( configUSE_TASK_REGISTRY == 1 )
+	{
+		printf( "Task registry: %lu exports decoded, %lu with tasks created or freed during the export, generation %lu\r\n",
+				( unsigned long ) ulExports, ( unsigned long ) ulExportsWithChanges, ( unsigned long ) uxTaskGetRegistryGeneration() );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,518 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares passing uint32_t items through a queue, a single producer ring
+ * queue and a multiple producer ring queue (see ring_queue.c).
+ *
+ * Uncontended - the benchmark task writes an item then reads it back,
+ * rqbUNCONTENDED_ITEMS times for each of the three.
+ *
+ * Contended - for the queue, then for the multiple producer ring queue,
+ * rqbPRODUCERS producer tasks each write rqbITEMS_PER_PRODUCER items while the
+ * tick interrupt (see vRingQueueBenchmarkISR()) writes one item each tick.  The
+ * producers and the consumer task all have the same priority, so they are time
+ * sliced, and the tick interrupt and the other producers regularly interrupt a
+ * producer part way through a write.  The consumer blocks whenever there is
+ * nothing to read, and checks each item arrives exactly once and in the order
+ * it was written by its producer.  The time the interrupt spends writing each
+ * item is recorded, as that is the time for which a write can delay other
+ * interrupts.
+ *
+ * The tests run once, shortly after the scheduler starts.  The results are
+ * printed once the scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "ring_queue.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "RingQueueBenchmark.h"
+
+/* The length of the queue and the ring queues. */
+#define rqbLENGTH					( 64 )
+
+/* The number of items passed by each test. */
+#define rqbUNCONTENDED_ITEMS		( 20000UL )
+#define rqbPRODUCERS				( 4 )
+#define rqbITEMS_PER_PRODUCER		( 5000UL )
+
+/* The uncontended test delays for a tick each time it has written and read
+this many items, so the lower priority demo tasks are not kept from running
+for long. */
+#define rqbITEMS_PER_TICK			( 500UL )
+
+/* Each item holds the number of the producer that wrote it in its top byte,
+and the producer's count of the items it has written in the rest.  The tick
+interrupt is producer number rqbPRODUCERS. */
+#define rqbSOURCE_SHIFT				( 24 )
+#define rqbSEQUENCE_MASK			( 0x00ffffffUL )
+#define rqbISR_SOURCE				( rqbPRODUCERS )
+#define rqbSOURCES					( rqbPRODUCERS + 1 )
+
+/* Written by the benchmark task once all the other producers have finished. */
+#define rqbEND_ITEM					( 0xffffffffUL )
+
+/* The tests start after a delay so they do not run at the same time as the
+other benchmarks. */
+#define rqbSTART_DELAY				( ( TickType_t ) 3000 / portTICK_PERIOD_MS )
+
+/* The objects compared, in the order they are tested. */
+typedef enum
+{
+	rqbQUEUE = 0,
+	rqbSINGLE_PRODUCER_RING,
+	rqbMULTIPLE_PRODUCER_RING,
+	rqbNUMBER_OF_OBJECTS
+} RingQueueBenchmarkObject_t;
+
+/* The results of the contended test for one object. */
+typedef struct RING_QUEUE_BENCHMARK_RESULT
+{
+	uint64_t ullElapsedNs;
+	uint64_t ullCpuNs;
+	uint32_t ulItems;
+	uint32_t ulISRDropped;
+	BenchmarkStats_t xISRSendTime;
+} RingQueueBenchmarkResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvBenchmarkTask( void *pvParameters );
+static void prvProducerTask( void *pvParameters );
+static void prvConsumerTask( void *pvParameters );
+
+/*
+ * Write or read one item without blocking, or read one item, blocking if
+ * necessary.
+ */
+static BaseType_t prvSend( RingQueueBenchmarkObject_t xObject, uint32_t ulItem );
+static BaseType_t prvReceive( RingQueueBenchmarkObject_t xObject, uint32_t *pulItem, TickType_t xTicksToWait );
+
+/*-----------------------------------------------------------*/
+
+static const char * const pcObjectNames[ rqbNUMBER_OF_OBJECTS ] =
+{
+	"Queue",
+	"Single producer ring queue",
+	"Multiple producer ring queue"
+};
+
+static uint64_t ullUncontendedNs[ rqbNUMBER_OF_OBJECTS ];
+static RingQueueBenchmarkResult_t xContendedResults[ rqbNUMBER_OF_OBJECTS ] =
+{
+	{ 0ULL, 0ULL, 0UL, 0UL, benchmarkSTATS_INIT( "Queue write from the tick interrupt" ) },
+	{ 0ULL, 0ULL, 0UL, 0UL, benchmarkSTATS_INIT( "" ) },
+	{ 0ULL, 0ULL, 0UL, 0UL, benchmarkSTATS_INIT( "Ring queue write from the tick interrupt" ) }
+};
+
+/* The objects the items are passed through. */
+static QueueHandle_t xQueue = NULL;
+static RingQueueHandle_t xRingQueues[ rqbNUMBER_OF_OBJECTS ] = { NULL };
+
+/* The object being used by the contended test, and whether the tick interrupt
+should write to it. */
+static volatile RingQueueBenchmarkObject_t xCurrentObject = rqbQUEUE;
+static volatile BaseType_t xISRActive = pdFALSE;
+static volatile uint32_t ulISRSent = 0UL;
+
+/* Set once all the tests are complete, and if an item was lost, duplicated or
+reordered. */
+static volatile BaseType_t xBenchmarkComplete = pdFALSE;
+static volatile BaseType_t xErrorDetected = pdFALSE;
+
+static TaskHandle_t xBenchmarkTask = NULL, xConsumerTask = NULL;
+static TaskHandle_t xProducerTasks[ rqbPRODUCERS ];
+
+/*-----------------------------------------------------------*/
+
+void vStartRingQueueBenchmark( UBaseType_t uxPriority )
+{
+UBaseType_t uxProducer;
+
+	/* All the tasks share the priority, which must be below the timer task so
+	the timer demo tasks are not delayed. */
+	configASSERT( uxPriority > tskIDLE_PRIORITY );
+	configASSERT( uxPriority < ( UBaseType_t ) ( configMAX_PRIORITIES - 1 ) );
+
+	xQueue = xQueueCreate( rqbLENGTH, sizeof( uint32_t ) );
+	xRingQueues[ rqbSINGLE_PRODUCER_RING ] = xRingQueueCreate( rqbLENGTH, sizeof( uint32_t ) );
+	xRingQueues[ rqbMULTIPLE_PRODUCER_RING ] = xRingQueueCreateMultiProducer( rqbLENGTH, sizeof( uint32_t ) );
+	configASSERT( xQueue );
+	configASSERT( xRingQueues[ rqbSINGLE_PRODUCER_RING ] );
+	configASSERT( xRingQueues[ rqbMULTIPLE_PRODUCER_RING ] );
+
+	/* The tasks are all created now as the death demo tasks check the number
+	of tasks remains constant once the scheduler has started. */
+	for( uxProducer = 0; uxProducer < rqbPRODUCERS; uxProducer++ )
+	{
+		xTaskCreate( prvProducerTask, "RqTx", configMINIMAL_STACK_SIZE, ( void * ) uxProducer, uxPriority, &( xProducerTasks[ uxProducer ] ) );
+	}
+
+	xTaskCreate( prvConsumerTask, "RqRx", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xConsumerTask );
+	xTaskCreate( prvBenchmarkTask, "RqBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xBenchmarkTask );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsRingQueueBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( xErrorDetected != pdFALSE )
+	{
+		xReturn = pdFAIL;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRingQueueBenchmarkISR( void )
+{
+RingQueueBenchmarkObject_t xObject;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE, xSent;
+uint64_t ullStartTime;
+uint32_t ulItem;
+
+	if( xISRActive != pdFALSE )
+	{
+		xObject = xCurrentObject;
+		ulItem = ( ( uint32_t ) rqbISR_SOURCE << rqbSOURCE_SHIFT ) | ( ulISRSent & rqbSEQUENCE_MASK );
+
+		ullStartTime = ullBenchmarkGetTimeNs();
+
+		if( xObject == rqbQUEUE )
+		{
+			xSent = xQueueSendFromISR( xQueue, &ulItem, &xHigherPriorityTaskWoken );
+		}
+		else
+		{
+			xSent = xRingQueueSendFromISR( xRingQueues[ xObject ], &ulItem, &xHigherPriorityTaskWoken );
+		}
+
+		vBenchmarkAddSample( &( xContendedResults[ xObject ].xISRSendTime ), ullBenchmarkGetTimeNs() - ullStartTime );
+
+		/* Items that do not fit are dropped, as they would be by a real
+		interrupt, so the sequence only advances when an item is written. */
+		if( xSent == pdPASS )
+		{
+			ulISRSent++;
+		}
+		else
+		{
+			xContendedResults[ xObject ].ulISRDropped++;
+		}
+
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSend( RingQueueBenchmarkObject_t xObject, uint32_t ulItem )
+{
+BaseType_t xReturn;
+
+	if( xObject == rqbQUEUE )
+	{
+		xReturn = xQueueSend( xQueue, &ulItem, 0 );
+	}
+	else
+	{
+		xReturn = xRingQueueSend( xRingQueues[ xObject ], &ulItem );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReceive( RingQueueBenchmarkObject_t xObject, uint32_t *pulItem, TickType_t xTicksToWait )
+{
+BaseType_t xReturn;
+
+	if( xObject == rqbQUEUE )
+	{
+		xReturn = xQueueReceive( xQueue, pulItem, xTicksToWait );
+	}
+	else
+	{
+		xReturn = xRingQueueReceive( xRingQueues[ xObject ], pulItem, xTicksToWait );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvProducerTask( void *pvParameters )
+{
+const uint32_t ulSource = ( uint32_t ) ( UBaseType_t ) pvParameters;
+uint32_t ulSequence;
+
+	for( ;; )
+	{
+		/* Wait to be started by the benchmark task. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		for( ulSequence = 0UL; ulSequence < rqbITEMS_PER_PRODUCER; ulSequence++ )
+		{
+			while( prvSend( xCurrentObject, ( ulSource << rqbSOURCE_SHIFT ) | ulSequence ) != pdPASS )
+			{
+				/* Full - let the consumer run. */
+				taskYIELD();
+			}
+		}
+
+		xTaskNotifyGive( xBenchmarkTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvConsumerTask( void *pvParameters )
+{
+uint32_t ulNextSequence[ rqbSOURCES ], ulItem, ulSource, ulReceived;
+RingQueueBenchmarkObject_t xObject;
+
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Wait to be started by the benchmark task.  The ring queue also uses
+		the task notification, but only with eNoAction, so does not change the
+		count used here. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		xObject = xCurrentObject;
+
+		for( ulSource = 0UL; ulSource < rqbSOURCES; ulSource++ )
+		{
+			ulNextSequence[ ulSource ] = 0UL;
+		}
+
+		for( ulReceived = 0UL; ; ulReceived++ )
+		{
+			if( prvReceive( xObject, &ulItem, portMAX_DELAY ) != pdPASS )
+			{
+				xErrorDetected = pdTRUE;
+				continue;
+			}
+
+			if( ulItem == rqbEND_ITEM )
+			{
+				break;
+			}
+
+			/* Each producer's items must arrive once each, in order. */
+			ulSource = ulItem >> rqbSOURCE_SHIFT;
+
+			if( ( ulSource >= rqbSOURCES ) || ( ( ulItem & rqbSEQUENCE_MASK ) != ulNextSequence[ ulSource ] ) )
+			{
+				xErrorDetected = pdTRUE;
+			}
+			else
+			{
+				ulNextSequence[ ulSource ]++;
+			}
+		}
+
+		/* Nothing must have been lost. */
+		for( ulSource = 0UL; ulSource < rqbPRODUCERS; ulSource++ )
+		{
+			if( ulNextSequence[ ulSource ] != rqbITEMS_PER_PRODUCER )
+			{
+				xErrorDetected = pdTRUE;
+			}
+		}
+
+		if( ulNextSequence[ rqbISR_SOURCE ] != ulISRSent )
+		{
+			xErrorDetected = pdTRUE;
+		}
+
+		xContendedResults[ xObject ].ulItems = ulReceived;
+		xTaskNotifyGive( xBenchmarkTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvBenchmarkTask( void *pvParameters )
+{
+RingQueueBenchmarkObject_t xObject;
+UBaseType_t uxProducer;
+uint32_t ulItem, ulReceivedItem, ulCall;
+uint64_t ullStartTime, ullStartCpu;
+
+	( void ) pvParameters;
+
+	vTaskDelay( rqbSTART_DELAY );
+
+	/* Write then read back each item, with no other task or interrupt using
+	the object.  Only the time spent writing and reading is counted. */
+	for( xObject = rqbQUEUE; xObject < rqbNUMBER_OF_OBJECTS; xObject++ )
+	{
+		for( ulCall = 0UL; ulCall < rqbUNCONTENDED_ITEMS; ulCall += rqbITEMS_PER_TICK )
+		{
+			vTaskDelay( ( TickType_t ) 1 );
+
+			ullStartTime = ullBenchmarkGetTimeNs();
+			for( ulItem = ulCall; ulItem < ( ulCall + rqbITEMS_PER_TICK ); ulItem++ )
+			{
+				if( ( prvSend( xObject, ulItem ) != pdPASS ) || ( prvReceive( xObject, &ulReceivedItem, 0 ) != pdPASS ) || ( ulReceivedItem != ulItem ) )
+				{
+					xErrorDetected = pdTRUE;
+				}
+			}
+			ullUncontendedNs[ xObject ] += ullBenchmarkGetTimeNs() - ullStartTime;
+		}
+	}
+
+	/* The single producer ring queue cannot be written by several tasks at
+	once, so is not included in the contended test. */
+	for( xObject = rqbQUEUE; xObject < rqbNUMBER_OF_OBJECTS; xObject++ )
+	{
+		if( xObject == rqbSINGLE_PRODUCER_RING )
+		{
+			continue;
+		}
+
+		xCurrentObject = xObject;
+		ulISRSent = 0UL;
+
+		ullStartTime = ullBenchmarkGetTimeNs();
+		ullStartCpu = ullBenchmarkGetCpuTimeNs();
+
+		/* Start the consumer, the producers and the tick interrupt. */
+		xTaskNotifyGive( xConsumerTask );
+		for( uxProducer = 0; uxProducer < rqbPRODUCERS; uxProducer++ )
+		{
+			xTaskNotifyGive( xProducerTasks[ uxProducer ] );
+		}
+		xISRActive = pdTRUE;
+
+		/* Wait for the producers to finish, stop the tick interrupt, then tell
+		the consumer there is nothing more to come. */
+		for( uxProducer = 0; uxProducer < rqbPRODUCERS; uxProducer++ )
+		{
+			ulTaskNotifyTake( pdFALSE, portMAX_DELAY );
+		}
+		xISRActive = pdFALSE;
+
+		while( prvSend( xObject, rqbEND_ITEM ) != pdPASS )
+		{
+			taskYIELD();
+		}
+
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		xContendedResults[ xObject ].ullElapsedNs = ullBenchmarkGetTimeNs() - ullStartTime;
+		xContendedResults[ xObject ].ullCpuNs = ullBenchmarkGetCpuTimeNs() - ullStartCpu;
+	}
+
+	xBenchmarkComplete = pdTRUE;
+
+	/* The tests only run once.  The task suspends itself rather than deleting
+	itself as the death demo tasks check the number of tasks remains
+	constant. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vRingQueueBenchmarkPrintResults( void )
+{
+RingQueueBenchmarkObject_t xObject;
+char cName[ 80 ];
+
+	if( xBenchmarkComplete == pdFALSE )
+	{
+		printf( "Ring queue benchmark did not complete\r\n" );
+	}
+	else
+	{
+		for( xObject = rqbQUEUE; xObject < rqbNUMBER_OF_OBJECTS; xObject++ )
+		{
+			snprintf( cName, sizeof( cName ), "%s write and read, uncontended", pcObjectNames[ xObject ] );
+			vBenchmarkPrintRate( cName, rqbUNCONTENDED_ITEMS, ullUncontendedNs[ xObject ] );
+		}
+
+		for( xObject = rqbQUEUE; xObject < rqbNUMBER_OF_OBJECTS; xObject++ )
+		{
+			if( xObject != rqbSINGLE_PRODUCER_RING )
+			{
+				snprintf( cName, sizeof( cName ), "%s, %d tasks and the tick writing", pcObjectNames[ xObject ], rqbPRODUCERS );
+				vBenchmarkPrintThroughput( cName, xContendedResults[ xObject ].ulItems * ( uint32_t ) sizeof( uint32_t ), xContendedResults[ xObject ].ullElapsedNs, xContendedResults[ xObject ].ullCpuNs );
+				vBenchmarkPrintStats( &( xContendedResults[ xObject ].xISRSendTime ) );
+				printf( "    %u items written by the tick interrupt were dropped as it was full\r\n", ( unsigned ) xContendedResults[ xObject ].ulISRDropped );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,331 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares the throughput and processor cost of passing a byte stream from one
+ * task to another through:
+ *
+ *   + A queue with an item size of one byte, which is how byte streams are
+ *     often passed when only queues are available.
+ *   + A stream buffer written and read in sbbCHUNK_LENGTH byte blocks, with a
+ *     trigger level of 1 and then with a trigger level of sbbHIGH_TRIGGER_LEVEL.
+ *   + A message buffer passing sbbCHUNK_LENGTH byte messages.
+ *
+ * The receiving task has a higher priority than the sending task, as is the
+ * case when a task processes data received by a lower priority task or by an
+ * interrupt, so the receiver runs each time the sender makes data available to
+ * it.  The tests run once, shortly after the scheduler starts.  The time taken
+ * and the processor time used (which includes the kernel and the tick
+ * interrupt, but not the time the processor is idle) are printed once the
+ * scheduler has been ended.
+ */
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "stream_buffer.h"
+#include "message_buffer.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "StreamBenchmark.h"
+
+/* The size of the buffers, and of the blocks written to and read from them. */
+#define sbbBUFFER_LENGTH			( ( size_t ) 128 )
+#define sbbCHUNK_LENGTH				( ( size_t ) 32 )
+
+/* The trigger level used by the second stream buffer test. */
+#define sbbHIGH_TRIGGER_LEVEL		( sbbBUFFER_LENGTH / ( size_t ) 2 )
+
+/* The number of bytes passed by each test.  Fewer bytes are passed through
+the queue as it takes much longer. */
+#define sbbQUEUE_BYTES				( 20000UL )
+#define sbbBUFFER_BYTES				( 256UL * 1024UL )
+
+/* The tests start after a delay so they do not run at the same time as the
+start up of the other demo tasks and benchmarks. */
+#define sbbSTART_DELAY				( ( TickType_t ) 500 / portTICK_PERIOD_MS )
+
+/* The tests, in the order they are performed. */
+typedef enum
+{
+	sbbBYTE_QUEUE = 0,
+	sbbSTREAM_BUFFER,
+	sbbSTREAM_BUFFER_HIGH_TRIGGER,
+	sbbMESSAGE_BUFFER,
+	sbbNUMBER_OF_TESTS
+} StreamBenchmarkTest_t;
+
+/* The results of one test. */
+typedef struct STREAM_BENCHMARK_RESULT
+{
+	const char *pcName;
+	uint32_t ulBytes;
+	uint64_t ullElapsedNs;
+	uint64_t ullCpuNs;
+} StreamBenchmarkResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvSenderTask( void *pvParameters );
+static void prvReceiverTask( void *pvParameters );
+
+/*
+ * Send, or receive, the bytes for one test.
+ */
+static void prvSendBytes( StreamBenchmarkTest_t xTest, uint32_t ulBytes );
+static void prvReceiveBytes( StreamBenchmarkTest_t xTest, uint32_t ulBytes );
+
+/*-----------------------------------------------------------*/
+
+static StreamBenchmarkResult_t xResults[ sbbNUMBER_OF_TESTS ] =
+{
+	{ "Byte queue", sbbQUEUE_BYTES, 0ULL, 0ULL },
+	{ "Stream buffer, trigger level 1", sbbBUFFER_BYTES, 0ULL, 0ULL },
+	{ "Stream buffer, trigger level 64", sbbBUFFER_BYTES, 0ULL, 0ULL },
+	{ "Message buffer", sbbBUFFER_BYTES, 0ULL, 0ULL }
+};
+
+/* The objects the data is passed through. */
+static QueueHandle_t xByteQueue = NULL;
+static StreamBufferHandle_t xStreamBuffer = NULL;
+static MessageBufferHandle_t xMessageBuffer = NULL;
+
+/* The test being performed, which is set by the sender before it starts the
+receiver. */
+static volatile StreamBenchmarkTest_t xCurrentTest = sbbBYTE_QUEUE;
+
+static TaskHandle_t xSenderTask = NULL, xReceiverTask = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartStreamBenchmark( UBaseType_t uxPriority )
+{
+	configASSERT( uxPriority > tskIDLE_PRIORITY );
+
+	xByteQueue = xQueueCreate( sbbBUFFER_LENGTH, sizeof( uint8_t ) );
+	xStreamBuffer = xStreamBufferCreate( sbbBUFFER_LENGTH, 1 );
+	xMessageBuffer = xMessageBufferCreate( sbbBUFFER_LENGTH );
+	configASSERT( xByteQueue );
+	configASSERT( xStreamBuffer );
+	configASSERT( xMessageBuffer );
+
+	xTaskCreate( prvSenderTask, "SbTx", configMINIMAL_STACK_SIZE, NULL, uxPriority - 1, &xSenderTask );
+	xTaskCreate( prvReceiverTask, "SbRx", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xReceiverTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSenderTask( void *pvParameters )
+{
+StreamBenchmarkTest_t xTest;
+uint64_t ullStartTime, ullStartCpu;
+
+	( void ) pvParameters;
+
+	vTaskDelay( sbbSTART_DELAY );
+
+	for( xTest = sbbBYTE_QUEUE; xTest < sbbNUMBER_OF_TESTS; xTest++ )
+	{
+		if( xTest == sbbSTREAM_BUFFER_HIGH_TRIGGER )
+		{
+			( void ) xStreamBufferSetTriggerLevel( xStreamBuffer, sbbHIGH_TRIGGER_LEVEL );
+		}
+
+		/* Start the receiver, which has the higher priority so will block on
+		the empty buffer before this task continues. */
+		xCurrentTest = xTest;
+		xTaskNotifyGive( xReceiverTask );
+
+		ullStartTime = ullBenchmarkGetTimeNs();
+		ullStartCpu = ullBenchmarkGetCpuTimeNs();
+
+		prvSendBytes( xTest, xResults[ xTest ].ulBytes );
+
+		/* Wait for the receiver to receive the last byte. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+		xResults[ xTest ].ullElapsedNs = ullBenchmarkGetTimeNs() - ullStartTime;
+		xResults[ xTest ].ullCpuNs = ullBenchmarkGetCpuTimeNs() - ullStartCpu;
+	}
+
+	/* The tests only run once.  The task suspends itself rather than deleting
+	itself as the death demo tasks check the number of tasks remains
+	constant. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiverTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Wait to be started by the sender, perform the test, then tell the
+		sender the test is complete.  The stream and message buffers also use
+		the task notification, but only with eNoAction, so do not change the
+		count used here. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		prvReceiveBytes( xCurrentTest, xResults[ xCurrentTest ].ulBytes );
+		xTaskNotifyGive( xSenderTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSendBytes( StreamBenchmarkTest_t xTest, uint32_t ulBytes )
+{
+uint8_t ucTxData[ sbbCHUNK_LENGTH ] = { 0 };
+uint32_t ulSent = 0;
+size_t xSent;
+
+	while( ulSent < ulBytes )
+	{
+		switch( xTest )
+		{
+			case sbbBYTE_QUEUE :
+				( void ) xQueueSend( xByteQueue, ucTxData, portMAX_DELAY );
+				ucTxData[ 0 ]++;
+				ulSent++;
+				break;
+
+			case sbbSTREAM_BUFFER :
+			case sbbSTREAM_BUFFER_HIGH_TRIGGER :
+				for( xSent = 0; xSent < sizeof( ucTxData ); )
+				{
+					xSent += xStreamBufferSend( xStreamBuffer, &( ucTxData[ xSent ] ), sizeof( ucTxData ) - xSent, portMAX_DELAY );
+				}
+				ulSent += sizeof( ucTxData );
+				break;
+
+			case sbbMESSAGE_BUFFER :
+				ulSent += xMessageBufferSend( xMessageBuffer, ucTxData, sizeof( ucTxData ), portMAX_DELAY );
+				break;
+
+			default :
+				/* Should not get here. */
+				configASSERT( xTest == sbbBYTE_QUEUE );
+				ulSent = ulBytes;
+				break;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiveBytes( StreamBenchmarkTest_t xTest, uint32_t ulBytes )
+{
+uint8_t ucRxData[ sbbCHUNK_LENGTH ];
+uint32_t ulReceived = 0;
+
+	while( ulReceived < ulBytes )
+	{
+		switch( xTest )
+		{
+			case sbbBYTE_QUEUE :
+				if( xQueueReceive( xByteQueue, ucRxData, portMAX_DELAY ) == pdPASS )
+				{
+					ulReceived++;
+				}
+				break;
+
+			case sbbSTREAM_BUFFER :
+			case sbbSTREAM_BUFFER_HIGH_TRIGGER :
+				ulReceived += xStreamBufferReceive( xStreamBuffer, ucRxData, sizeof( ucRxData ), portMAX_DELAY );
+				break;
+
+			case sbbMESSAGE_BUFFER :
+				ulReceived += xMessageBufferReceive( xMessageBuffer, ucRxData, sizeof( ucRxData ), portMAX_DELAY );
+				break;
+
+			default :
+				/* Should not get here. */
+				configASSERT( xTest == sbbBYTE_QUEUE );
+				ulReceived = ulBytes;
+				break;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vStreamBenchmarkPrintResults( void )
+{
+StreamBenchmarkTest_t xTest;
+
+	for( xTest = sbbBYTE_QUEUE; xTest < sbbNUMBER_OF_TESTS; xTest++ )
+	{
+		if( xResults[ xTest ].ullElapsedNs > 0ULL )
+		{
+			vBenchmarkPrintThroughput( xResults[ xTest ].pcName, xResults[ xTest ].ulBytes, xResults[ xTest ].ullElapsedNs, xResults[ xTest ].ullCpuNs );
+		}
+		else
+		{
+			vBenchmarkPrintThroughput( xResults[ xTest ].pcName, 0UL, 0ULL, 0ULL );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,253 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the time taken to switch between two tasks as the number of
+ * priorities between them grows, so the ways the kernel can select the highest
+ * priority ready task can be compared.  The benchmark task gives a direct to
+ * task notification to a partner task whose priority is 1, 2, 4 ... priorities
+ * above its own, up to the highest priority below the check task.  The partner
+ * preempts the benchmark task, takes the notification, and blocks again - at
+ * which point the kernel must find the benchmark task as the highest priority
+ * ready task.  The time from giving the notification to running again is
+ * recorded, so each sample includes two context switches.
+ *
+ * With configUSE_PRIORITY_BITMAP set to 0 the kernel finds the benchmark task
+ * by testing each ready list from the partner's priority downwards, so the time
+ * grows with the distance between the two.  With the bitmap it does not.  Build
+ * with -DconfigMAX_PRIORITIES=256 (for example) and with
+ * -DconfigUSE_PRIORITY_BITMAP=0 and 1 to compare the two.  On this port most of
+ * each switch is taken by the host threads, so the difference is far smaller
+ * than it would be on a target.
+ *
+ * The partner runs at priorities used by the tasks of the standard demo, so the
+ * benchmark is run on its own - see main.c.  The results are printed once the
+ * scheduler has been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "SwitchBenchmark.h"
+
+#if( ( INCLUDE_vTaskPrioritySet != 1 ) || ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error SwitchBenchmark.c requires INCLUDE_vTaskPrioritySet and configUSE_TASK_NOTIFICATIONS to be 1.
+#endif
+
+/* The distance between the two tasks is doubled from 1 until it would reach
+the check task, so there are at most 11 distances with 1024 priorities. */
+#define swbMAX_DISTANCES			( 11 )
+
+/* The number of round trips measured at each distance, and the number between
+the delays that let the lower priority tasks run. */
+#define swbROUND_TRIPS				( 20000UL )
+#define swbROUND_TRIPS_PER_DELAY	( 1000UL )
+
+/* The length of the names given to the results. */
+#define swbNAME_LENGTH				( 48 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that gives the notifications and records the times, as described
+ * at the top of this file.
+ */
+static void prvSwitchBenchmarkTask( void *pvParameters );
+
+/*
+ * The partner task, which just takes the notifications.
+ */
+static void prvPartnerTask( void *pvParameters );
+
+/*-----------------------------------------------------------*/
+
+static BenchmarkStats_t xResults[ swbMAX_DISTANCES ];
+static char cNames[ swbMAX_DISTANCES ][ swbNAME_LENGTH ];
+static UBaseType_t uxDistances = 0;
+
+static TaskHandle_t xPartnerTask = NULL;
+
+/* Incremented by each round trip, so the check task can see the benchmark is
+progressing. */
+static volatile uint32_t ulRoundTrips = 0UL, ulLastRoundTrips = 0UL;
+
+/* Set once every distance has been measured. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartSwitchBenchmark( UBaseType_t uxPriority )
+{
+	/* There must be room for the partner between the benchmark task and the
+	check task. */
+	configASSERT( uxPriority < ( configMAX_PRIORITIES - 2 ) );
+
+	xTaskCreate( prvSwitchBenchmarkTask, "SwBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+	xTaskCreate( prvPartnerTask, "SwPart", configMINIMAL_STACK_SIZE, NULL, uxPriority + 1, &xPartnerTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchBenchmarkTask( void *pvParameters )
+{
+UBaseType_t uxDistance, uxIndex = 0;
+uint32_t ulRoundTrip;
+uint64_t ullStartTime;
+const UBaseType_t uxPriority = uxTaskPriorityGet( NULL );
+const UBaseType_t uxMaxDistance = ( configMAX_PRIORITIES - 2 ) - uxPriority;
+
+	( void ) pvParameters;
+
+	for( uxDistance = 1; uxIndex < swbMAX_DISTANCES; uxDistance <<= 1 )
+	{
+		/* Finish with the largest distance, if it is not a power of 2. */
+		if( uxDistance > uxMaxDistance )
+		{
+			uxDistance = uxMaxDistance;
+		}
+
+		snprintf( cNames[ uxIndex ], swbNAME_LENGTH, "Notify round trip, priority distance %lu", ( unsigned long ) uxDistance );
+		xResults[ uxIndex ].pcName = cNames[ uxIndex ];
+		xResults[ uxIndex ].ullMin = UINT64_MAX;
+		vTaskPrioritySet( xPartnerTask, uxPriority + uxDistance );
+
+		for( ulRoundTrip = 0UL; ulRoundTrip < swbROUND_TRIPS; ulRoundTrip++ )
+		{
+			ullStartTime = ullBenchmarkGetTimeNs();
+			xTaskNotifyGive( xPartnerTask );
+			vBenchmarkAddSample( &( xResults[ uxIndex ] ), ullBenchmarkGetTimeNs() - ullStartTime );
+
+			if( ( ( ulRoundTrip + 1UL ) % swbROUND_TRIPS_PER_DELAY ) == 0UL )
+			{
+				vTaskDelay( ( TickType_t ) 1 );
+			}
+
+			ulRoundTrips++;
+		}
+
+		uxIndex++;
+		uxDistances = uxIndex;
+
+		if( uxDistance == uxMaxDistance )
+		{
+			break;
+		}
+	}
+
+	xComplete = pdTRUE;
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPartnerTask( void *pvParameters )
+{
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+	}
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsSwitchBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( ( ulRoundTrips == ulLastRoundTrips ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastRoundTrips = ulRoundTrips;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vSwitchBenchmarkPrintResults( void )
+{
+UBaseType_t uxIndex;
+
+	#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+		printf( "%lu priorities, selected by the port\r\n", ( unsigned long ) configMAX_PRIORITIES );
+	#elif( configUSE_PRIORITY_BITMAP == 1 )
+		printf( "%lu priorities, selected by the priority bitmap\r\n", ( unsigned long ) configMAX_PRIORITIES );
+	#else
+		printf( "%lu priorities, selected by searching the ready lists\r\n", ( unsigned long ) configMAX_PRIORITIES );
+	#endif
+
+	for( uxIndex = 0; uxIndex < uxDistances; uxIndex++ )
+	{
+		vBenchmarkPrintStats( &( xResults[ uxIndex ] ) );
+	}
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,409 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the cost of the software timer operations performed by the timer
+ * service task as the number of active timers grows from 10 to 10,000, so the
+ * sorted list and binary heap timer backends (configUSE_TIMER_HEAP) can be
+ * compared.  For each number of timers the benchmark task:
+ *
+ *   + Starts the timers, which have long periods spread so that each is
+ *     inserted at a different position amongst the timers already active.
+ *   + Resets the active timers tmbRESETS times in turn, as a task that uses a
+ *     timer as a watchdog would.  configUSE_TIMER_FAST_RESET allows most of
+ *     these resets to be performed without the timer service task.
+ *   + Stops the timers again.
+ *   + Gives the timers short, spread periods, then counts how many times they
+ *     expire during tmbEXPIRE_WINDOW ticks.  The timers are auto-reload timers,
+ *     so each expiry also re-inserts the timer amongst the others.
+ *
+ * The time recorded for the start, reset and stop commands is the processor
+ * time used by both the benchmark task and the timer service task, as a command
+ * may be performed by either.  The time used by the timer service task is read
+ * from a pended function call.  The time recorded for the expiries is the
+ * processor time used by the timer service task alone, read from the timer
+ * callback function.  The results are printed once the scheduler has been
+ * ended.
+ *
+ * Each command sent runs the timer service task, which has the highest
+ * priority, so the benchmark task should be given a low priority to prevent it
+ * delaying the time sensitive demo tasks.  It also blocks for a tick after every
+ * tmbCOMMANDS_PER_BATCH commands so the tasks that have the idle priority are
+ * not starved while thousands of commands are sent.
+ *
+ * configTIMER_HEAP_LENGTH must allow for tmbMAX_TIMERS timers in addition to
+ * those created by the other demos if configUSE_TIMER_HEAP is 1.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "TimerBenchmark.h"
+
+#if( ( configSUPPORT_STATIC_ALLOCATION != 1 ) || ( INCLUDE_xTimerPendFunctionCall != 1 ) )
+	#error TimerBenchmark.c requires configSUPPORT_STATIC_ALLOCATION and INCLUDE_xTimerPendFunctionCall to be 1.
+#endif
+
+/* The number of timers is increased by a factor of 10 from 10 to
+tmbMAX_TIMERS. */
+#define tmbNUMBER_OF_SIZES			( 4 )
+#define tmbMAX_TIMERS				( 10000UL )
+
+/* The periods used while the start and stop commands are measured are spread
+between tmbLONG_PERIOD and tmbLONG_PERIOD + tmbLONG_PERIOD_SPREAD ticks, so the
+timers never expire.  The values fit within a 16-bit tick count. */
+#define tmbLONG_PERIOD				( ( TickType_t ) 30000 )
+#define tmbLONG_PERIOD_SPREAD		( 20000UL )
+
+/* The periods used while expiries are measured start at tmbEXPIRE_PERIOD and
+are spread over a range that grows with the number of timers, so the rate at
+which timers expire stays roughly constant. */
+#define tmbEXPIRE_PERIOD			( ( TickType_t ) 50 )
+#define tmbEXPIRE_WINDOW			( ( TickType_t ) 500 / portTICK_PERIOD_MS )
+
+/* Used to spread the periods.  A prime, so consecutive timers have periods
+far apart. */
+#define tmbSPREAD_MULTIPLIER		( 7919UL )
+
+/* The number of resets performed for each number of timers. */
+#define tmbRESETS					( 10000UL )
+
+/* The number of commands sent between each short block. */
+#define tmbCOMMANDS_PER_BATCH		( 100UL )
+
+/* The benchmark starts after a delay so it does not run at the same time as
+the start up of the other demo tasks and benchmarks. */
+#define tmbSTART_DELAY				( ( TickType_t ) 1000 / portTICK_PERIOD_MS )
+
+/* The results for one number of timers. */
+typedef struct TIMER_BENCHMARK_RESULT
+{
+	uint32_t ulTimers;
+	uint64_t ullStartNs;
+	uint64_t ullResetNs;
+	uint64_t ullStopNs;
+	uint64_t ullExpireNs;
+	uint32_t ulExpiries;
+} TimerBenchmarkResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that sends the commands, as described at the top of this file.
+ */
+static void prvTimerBenchmarkTask( void *pvParameters );
+
+/*
+ * Called before each command is sent.  Blocks for a tick after every
+ * tmbCOMMANDS_PER_BATCH commands.
+ */
+static void prvPaceCommands( uint32_t ulCommand );
+
+/*
+ * The callback used by all the timers.  Records the processor time used by
+ * the timer service task each time a timer expires while expiries are being
+ * measured.
+ */
+static void prvTimerCallback( TimerHandle_t xTimer );
+
+/*
+ * Return the processor time used by the timer service task once it has
+ * processed all the commands sent to it before this function was called.
+ */
+static uint64_t prvGetTimerTaskCpuTime( void );
+
+/*
+ * Return the processor time used by the timer service task and the calling
+ * task combined, once the timer service task has processed all the commands
+ * sent to it before this function was called.
+ */
+static uint64_t prvGetCommandCpuTime( void );
+
+/*
+ * The function pended by prvGetTimerTaskCpuTime(), which executes in the
+ * context of the timer service task.
+ */
+static void prvRecordTimerTaskCpuTime( void *pvParameter1, uint32_t ulParameter2 );
+
+/*-----------------------------------------------------------*/
+
+/* The timers are statically allocated so the FreeRTOS heap need not be large
+enough to hold them all. */
+static StaticTimer_t xTimerBuffers[ tmbMAX_TIMERS ];
+static TimerHandle_t xTimers[ tmbMAX_TIMERS ];
+
+static TimerBenchmarkResult_t xResults[ tmbNUMBER_OF_SIZES ] =
+{
+	{ 10UL, 0ULL, 0ULL, 0ULL, 0ULL, 0UL },
+	{ 100UL, 0ULL, 0ULL, 0ULL, 0ULL, 0UL },
+	{ 1000UL, 0ULL, 0ULL, 0ULL, 0ULL, 0UL },
+	{ tmbMAX_TIMERS, 0ULL, 0ULL, 0ULL, 0ULL, 0UL }
+};
+
+/* Written by the timer service task, and only read by the benchmark task when
+the timer service task is known not to be using them. */
+static volatile BaseType_t xCountingExpiries = pdFALSE;
+static volatile uint32_t ulExpiries = 0UL;
+static volatile uint64_t ullFirstExpiryCpuTime = 0ULL, ullLastExpiryCpuTime = 0ULL;
+static volatile uint64_t ullTimerTaskCpuTime = 0ULL;
+
+static TaskHandle_t xBenchmarkTask = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartTimerBenchmark( UBaseType_t uxPriority )
+{
+	/* The timer service task must run each time a command is sent to it. */
+	configASSERT( uxPriority < configTIMER_TASK_PRIORITY );
+
+	xTaskCreate( prvTimerBenchmarkTask, "TmrBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xBenchmarkTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerBenchmarkTask( void *pvParameters )
+{
+uint32_t ulTimer, ulSize, ulSpread, ulReset;
+uint64_t ullStartTime;
+TickType_t xLongPeriod;
+
+	( void ) pvParameters;
+
+	vTaskDelay( tmbSTART_DELAY );
+
+	for( ulTimer = 0UL; ulTimer < tmbMAX_TIMERS; ulTimer++ )
+	{
+		xLongPeriod = tmbLONG_PERIOD + ( TickType_t ) ( ( ulTimer * tmbSPREAD_MULTIPLIER ) % tmbLONG_PERIOD_SPREAD );
+		xTimers[ ulTimer ] = xTimerCreateStatic( "TmrBench", xLongPeriod, pdTRUE, NULL, prvTimerCallback, &( xTimerBuffers[ ulTimer ] ) );
+		configASSERT( xTimers[ ulTimer ] );
+	}
+
+	for( ulSize = 0UL; ulSize < tmbNUMBER_OF_SIZES; ulSize++ )
+	{
+		/* Start the timers. */
+		ullStartTime = prvGetCommandCpuTime();
+
+		for( ulTimer = 0UL; ulTimer < xResults[ ulSize ].ulTimers; ulTimer++ )
+		{
+			prvPaceCommands( ulTimer );
+			xTimerStart( xTimers[ ulTimer ], portMAX_DELAY );
+		}
+
+		xResults[ ulSize ].ullStartNs = prvGetCommandCpuTime() - ullStartTime;
+
+		/* Reset the active timers in turn. */
+		ullStartTime = prvGetCommandCpuTime();
+
+		for( ulReset = 0UL; ulReset < tmbRESETS; ulReset++ )
+		{
+			prvPaceCommands( ulReset );
+			xTimerReset( xTimers[ ulReset % xResults[ ulSize ].ulTimers ], portMAX_DELAY );
+		}
+
+		xResults[ ulSize ].ullResetNs = prvGetCommandCpuTime() - ullStartTime;
+
+		/* Stop the timers. */
+		ullStartTime = prvGetCommandCpuTime();
+
+		for( ulTimer = 0UL; ulTimer < xResults[ ulSize ].ulTimers; ulTimer++ )
+		{
+			prvPaceCommands( ulTimer );
+			xTimerStop( xTimers[ ulTimer ], portMAX_DELAY );
+		}
+
+		xResults[ ulSize ].ullStopNs = prvGetCommandCpuTime() - ullStartTime;
+
+		/* Give the timers short periods, which also starts them, then count
+		the expiries once all the commands have been processed. */
+		ulSpread = xResults[ ulSize ].ulTimers + 1UL;
+
+		for( ulTimer = 0UL; ulTimer < xResults[ ulSize ].ulTimers; ulTimer++ )
+		{
+			prvPaceCommands( ulTimer );
+			xTimerChangePeriod( xTimers[ ulTimer ], tmbEXPIRE_PERIOD + ( TickType_t ) ( ( ulTimer * tmbSPREAD_MULTIPLIER ) % ulSpread ), portMAX_DELAY );
+		}
+
+		( void ) prvGetTimerTaskCpuTime();
+		ulExpiries = 0UL;
+		xCountingExpiries = pdTRUE;
+		vTaskDelay( tmbEXPIRE_WINDOW );
+
+		/* The timer service task has a higher priority, so is not part way
+		through a callback when this task is running. */
+		xCountingExpiries = pdFALSE;
+
+		if( ulExpiries > 1UL )
+		{
+			xResults[ ulSize ].ulExpiries = ulExpiries - 1UL;
+			xResults[ ulSize ].ullExpireNs = ullLastExpiryCpuTime - ullFirstExpiryCpuTime;
+		}
+
+		/* Put the long periods back, which restarts the timers, then stop the
+		timers ready for the next size. */
+		for( ulTimer = 0UL; ulTimer < xResults[ ulSize ].ulTimers; ulTimer++ )
+		{
+			prvPaceCommands( ulTimer );
+			xLongPeriod = tmbLONG_PERIOD + ( TickType_t ) ( ( ulTimer * tmbSPREAD_MULTIPLIER ) % tmbLONG_PERIOD_SPREAD );
+			xTimerChangePeriod( xTimers[ ulTimer ], xLongPeriod, portMAX_DELAY );
+			xTimerStop( xTimers[ ulTimer ], portMAX_DELAY );
+		}
+	}
+
+	/* The benchmark only runs once.  The task suspends itself rather than
+	deleting itself as the death demo tasks check the number of tasks remains
+	constant. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPaceCommands( uint32_t ulCommand )
+{
+	if( ( ulCommand % tmbCOMMANDS_PER_BATCH ) == ( tmbCOMMANDS_PER_BATCH - 1UL ) )
+	{
+		vTaskDelay( ( TickType_t ) 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTimerCallback( TimerHandle_t xTimer )
+{
+uint64_t ullNow;
+
+	( void ) xTimer;
+
+	if( xCountingExpiries != pdFALSE )
+	{
+		ullNow = ullBenchmarkGetTaskCpuTimeNs();
+
+		if( ulExpiries == 0UL )
+		{
+			ullFirstExpiryCpuTime = ullNow;
+		}
+
+		ullLastExpiryCpuTime = ullNow;
+		ulExpiries++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvGetTimerTaskCpuTime( void )
+{
+	/* Commands are processed in the order they are sent, so by the time the
+	function runs all the commands sent before it have been processed. */
+	xTimerPendFunctionCall( prvRecordTimerTaskCpuTime, NULL, 0UL, portMAX_DELAY );
+	ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+	return ullTimerTaskCpuTime;
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvGetCommandCpuTime( void )
+{
+uint64_t ullTimerTaskTime;
+
+	ullTimerTaskTime = prvGetTimerTaskCpuTime();
+
+	return ullTimerTaskTime + ullBenchmarkGetTaskCpuTimeNs();
+}
+/*-----------------------------------------------------------*/
+
+static void prvRecordTimerTaskCpuTime( void *pvParameter1, uint32_t ulParameter2 )
+{
+	( void ) pvParameter1;
+	( void ) ulParameter2;
+
+	ullTimerTaskCpuTime = ullBenchmarkGetTaskCpuTimeNs();
+	xTaskNotifyGive( xBenchmarkTask );
+}
+/*-----------------------------------------------------------*/
+
+void vTimerBenchmarkPrintResults( void )
+{
+char cName[ 64 ];
+uint32_t ulSize;
+
+	for( ulSize = 0UL; ulSize < tmbNUMBER_OF_SIZES; ulSize++ )
+	{
+		snprintf( cName, sizeof( cName ), "Timer start, %lu timers", ( unsigned long ) xResults[ ulSize ].ulTimers );
+		vBenchmarkPrintRate( cName, xResults[ ulSize ].ulTimers, xResults[ ulSize ].ullStartNs );
+
+		snprintf( cName, sizeof( cName ), "Timer reset, %lu timers", ( unsigned long ) xResults[ ulSize ].ulTimers );
+		vBenchmarkPrintRate( cName, tmbRESETS, xResults[ ulSize ].ullResetNs );
+
+		snprintf( cName, sizeof( cName ), "Timer stop, %lu timers", ( unsigned long ) xResults[ ulSize ].ulTimers );
+		vBenchmarkPrintRate( cName, xResults[ ulSize ].ulTimers, xResults[ ulSize ].ullStopNs );
+
+		snprintf( cName, sizeof( cName ), "Timer expire and reload, %lu timers", ( unsigned long ) xResults[ ulSize ].ulTimers );
+		vBenchmarkPrintRate( cName, xResults[ ulSize ].ulExpiries, xResults[ ulSize ].ullExpireNs );
+	}
+}
+/*-----------------------------------------------------------*/
+
@@ -0,0 +1,196 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Measures the cost of the kernel's trace recorder, and reports what it
+ * recorded - see Source/include/trace_recorder.h.
+ *
+ * vRunTraceBenchmark() must be called from main() before the scheduler is
+ * started, and before any other kernel objects are created.  It records
+ * tbCALLS events directly, with the recorder started and then stopped, to
+ * measure the cost of an event when it is recorded and when it is not.  The
+ * recorded events are then discarded, and the recorder left running so the
+ * rest of the demo is traced.
+ *
+ * vTraceBenchmarkPrintResults() is called once the scheduler has been ended.
+ * It prints the cost of an event, saves the buffer to tbTRACE_FILE_NAME, then
+ * decodes the saved file with TraceDecoder.c - exactly as it would be decoded
+ * after being saved from a target by a debugger.  The file can be decoded
+ * again later with "./rtosdemo decode rtosdemo.trace".
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "TraceDecoder.h"
+#include "TraceBenchmark.h"
+
+#if( configUSE_TRACE_RECORDER != 1 )
+	#error TraceBenchmark.c requires configUSE_TRACE_RECORDER to be 1.
+#endif
+
+/* The number of events recorded to measure the cost of an event. */
+#define tbCALLS						( 100000UL )
+
+/* The file the buffer is saved to. */
+#define tbTRACE_FILE_NAME			"rtosdemo.trace"
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Save the trace recorder buffer to pcFileName.
+ */
+static BaseType_t prvSaveTrace( const char *pcFileName );
+
+/*-----------------------------------------------------------*/
+
+/* The time taken to record tbCALLS events with the recorder started and with
+it stopped. */
+static uint64_t ullRecordingNs = 0ULL, ullStoppedNs = 0ULL;
+
+/*-----------------------------------------------------------*/
+
+void vRunTraceBenchmark( void )
+{
+uint64_t ullStartTime;
+uint32_t ulCall;
+
+	vTraceRecorderStart();
+	ullStartTime = ullBenchmarkGetTimeNs();
+
+	for( ulCall = 0UL; ulCall < tbCALLS; ulCall++ )
+	{
+		vTraceRecorderEvent( traceEVENT_QUEUE_SEND, pdFALSE, ( UBaseType_t ) ulCall );
+	}
+
+	ullRecordingNs = ullBenchmarkGetTimeNs() - ullStartTime;
+
+	vTraceRecorderStop();
+	ullStartTime = ullBenchmarkGetTimeNs();
+
+	for( ulCall = 0UL; ulCall < tbCALLS; ulCall++ )
+	{
+		vTraceRecorderEvent( traceEVENT_QUEUE_SEND, pdFALSE, ( UBaseType_t ) ulCall );
+	}
+
+	ullStoppedNs = ullBenchmarkGetTimeNs() - ullStartTime;
+
+	/* Discard the events recorded above, and trace the rest of the demo. */
+	vTraceRecorderClear();
+	vTraceRecorderStart();
+}
+/*-----------------------------------------------------------*/
+
+void vTraceBenchmarkPrintResults( void )
+{
+	vTraceRecorderStop();
+
+	vBenchmarkPrintRate( "Trace event recorded", tbCALLS, ullRecordingNs );
+	vBenchmarkPrintRate( "Trace event with the recorder stopped", tbCALLS, ullStoppedNs );
+
+	if( prvSaveTrace( tbTRACE_FILE_NAME ) != pdFAIL )
+	{
+		( void ) xTraceDecodeFile( tbTRACE_FILE_NAME );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvSaveTrace( const char *pcFileName )
+{
+FILE *pxFile;
+const TraceRecorderBuffer_t *pxBuffer;
+size_t xBufferSize;
+BaseType_t xReturn = pdFAIL;
+
+	pxBuffer = pxTraceRecorderGetBuffer( &xBufferSize );
+	pxFile = fopen( pcFileName, "wb" );
+
+	if( pxFile != NULL )
+	{
+		if( fwrite( pxBuffer, 1, xBufferSize, pxFile ) == xBufferSize )
+		{
+			xReturn = pdPASS;
+		}
+
+		if( fclose( pxFile ) != 0 )
+		{
+			xReturn = pdFAIL;
+		}
+	}
+
+	if( xReturn == pdFAIL )
+	{
+		printf( "Trace: cannot save %s\r\n", pcFileName );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
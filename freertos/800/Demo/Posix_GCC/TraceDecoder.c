@@ -0,0 +1,802 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * See TraceDecoder.h.  The decoder replays the events from the oldest to the
+ * newest, keeping track of the running task and of the interrupts that are
+ * executing:
+ *
+ *   + The time between consecutive events is charged to the running task,
+ *     unless an interrupt is executing.
+ *
+ *   + A task's wake latency is the time from its first traceEVENT_TASK_READY
+ *     event to its next traceEVENT_TASK_SWITCHED_IN event.
+ *
+ *   + A task is blocked on an object from the event that records it blocking
+ *     until its next traceEVENT_TASK_READY event - which is recorded whether it
+ *     was unblocked by the object or by its block time expiring.
+ *
+ *   + An interrupt's duration is the time between its traceEVENT_ISR_ENTER and
+ *     traceEVENT_ISR_EXIT events, including the time spent in any interrupt
+ *     that nested within it.
+ *
+ * Until the first traceEVENT_TASK_SWITCHED_IN event the running task is not
+ * known, so the events before it are only counted against objects.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "trace_recorder.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "TraceDecoder.h"
+
+/* The size of the tables the decoded tasks, objects and interrupts are
+accumulated into.  Anything that does not fit is not reported. */
+#define trdMAX_TASKS				( 64 )
+#define trdMAX_OBJECTS				( 256 )
+#define trdMAX_ISRS					( 8 )
+
+/* The deepest interrupt nesting that is tracked. */
+#define trdMAX_ISR_NESTING			( 8 )
+
+/* The wake latency histogram has a bucket for less than 1us, then one bucket
+for each power of two microseconds, the last of which also counts everything
+longer. */
+#define trdHISTOGRAM_BUCKETS		( 16 )
+
+/* Used to convert between the units used in the measurements. */
+#define trdNS_PER_SECOND			( 1000000000ULL )
+#define trdNS_PER_US				( 1000ULL )
+#define trdNS_PER_MS				( 1000000ULL )
+
+/* Used in place of a table index when there is no task or object. */
+#define trdNONE						( -1 )
+
+/* The longest name that is printed, including the terminating null. */
+#define trdNAME_LENGTH				( traceRECORDER_NAME_LENGTH + 1 )
+
+/* A task seen in the trace. */
+typedef struct TRACE_DECODER_TASK
+{
+	uint16_t usNumber;
+	char cName[ trdNAME_LENGTH ];
+	uint64_t ullRunTime;
+	uint32_t ulSwitchedIn;
+	BaseType_t xReadyPending;
+	uint64_t ullReadyTime;
+	int iBlockedOn;
+	uint64_t ullBlockTime;
+	BenchmarkStats_t xLatency;
+	uint32_t ulHistogram[ trdHISTOGRAM_BUCKETS ];
+} TraceDecoderTask_t;
+
+/* A queue, semaphore, mutex, event group or stream buffer seen in the trace. */
+typedef struct TRACE_DECODER_OBJECT
+{
+	uint16_t usNumber;
+	uint8_t ucType;
+	char cName[ trdNAME_LENGTH ];
+	uint32_t ulSends;
+	uint32_t ulSendsFromISR;
+	uint32_t ulReceives;
+	uint32_t ulReceivesFromISR;
+	uint32_t ulBlocks;
+	uint64_t ullBlockedTime;
+	uint64_t ullLongestBlock;
+} TraceDecoderObject_t;
+
+/* An interrupt seen in the trace. */
+typedef struct TRACE_DECODER_ISR
+{
+	uint16_t usNumber;
+	char cName[ trdNAME_LENGTH ];
+	BenchmarkStats_t xDuration;
+} TraceDecoderISR_t;
+
+/* The state of the decoder. */
+typedef struct TRACE_DECODER
+{
+	TraceRecorderHeader_t xHeader;
+	const TraceRecorderName_t *pxNames;
+	TraceDecoderTask_t xTasks[ trdMAX_TASKS ];
+	int iNumTasks;
+	TraceDecoderObject_t xObjects[ trdMAX_OBJECTS ];
+	int iNumObjects;
+	TraceDecoderISR_t xISRs[ trdMAX_ISRS ];
+	int iNumISRs;
+	int iRunningTask;
+	int iISRStack[ trdMAX_ISR_NESTING ];
+	uint64_t ullISRStartTime[ trdMAX_ISR_NESTING ];
+	int iISRNesting;
+	uint32_t ulUnmatchedISRExits;
+	uint64_t ullTime;
+	uint64_t ullFirstTime;
+} TraceDecoder_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Process one event.  ullTime is the event's timestamp with the wraps of the
+ * 32-bit recorded timestamp removed.
+ */
+static void prvDecodeEvent( TraceDecoder_t *pxDecoder, const TraceRecorderEvent_t *pxEvent, uint64_t ullTime );
+
+/*
+ * Return the index of the task, object or interrupt with the given number,
+ * adding it to its table if it was not already there.  Returns trdNONE if the
+ * table is full.
+ */
+static int prvGetTask( TraceDecoder_t *pxDecoder, uint16_t usNumber );
+static int prvGetObject( TraceDecoder_t *pxDecoder, uint16_t usNumber );
+static int prvGetISR( TraceDecoder_t *pxDecoder, uint16_t usNumber );
+
+/*
+ * Find the name recorded for a task, object or interrupt, and its type.
+ * Tasks, interrupts and other objects are numbered independently, so ucClass
+ * is traceTYPE_TASK, traceTYPE_ISR or (for any other object) traceTYPE_QUEUE.
+ * The name is left empty if none was recorded.
+ */
+static void prvFindName( const TraceDecoder_t *pxDecoder, uint8_t ucClass, uint16_t usNumber, char *pcName, uint8_t *pucType );
+
+/*
+ * Convert a duration in timestamp counts to nanoseconds.
+ */
+static uint64_t prvToNs( const TraceDecoder_t *pxDecoder, uint64_t ullCounts );
+
+/*
+ * Print the report once all the events have been processed.
+ */
+static void prvPrintReport( const TraceDecoder_t *pxDecoder, uint32_t ulEvents );
+
+/*-----------------------------------------------------------*/
+
+/* The names of the object types, indexed by traceTYPE_ value. */
+static const char * const pcTypeNames[] =
+{
+	"Queue", "Mutex", "Counting semaphore", "Binary semaphore", "Recursive mutex",
+	"Event group", "Stream buffer", "Message buffer", "Task", "ISR"
+};
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xTraceDecodeBuffer( const void *pvBuffer, size_t xBufferSize )
+{
+TraceDecoder_t *pxDecoder;
+const TraceRecorderEvent_t *pxEvents;
+const uint8_t *pucBuffer = ( const uint8_t * ) pvBuffer;
+uint32_t ulEvents, ulFirst, ulIndex, ulLastTimestamp;
+size_t xNamesSize, xEventsSize;
+uint64_t ullTime;
+BaseType_t xReturn = pdFAIL;
+
+	/* The decoder state is too large for a task's stack, but this only runs
+	on the host, so it can come from the host's heap. */
+	pxDecoder = ( TraceDecoder_t * ) calloc( 1, sizeof( TraceDecoder_t ) );
+
+	if( pxDecoder == NULL )
+	{
+		printf( "Trace: out of memory\r\n" );
+	}
+	else if( xBufferSize < sizeof( TraceRecorderHeader_t ) )
+	{
+		printf( "Trace: %lu bytes is too short to be a trace\r\n", ( unsigned long ) xBufferSize );
+	}
+	else
+	{
+		memcpy( &( pxDecoder->xHeader ), pucBuffer, sizeof( TraceRecorderHeader_t ) );
+		xNamesSize = ( size_t ) pxDecoder->xHeader.ulNameCapacity * sizeof( TraceRecorderName_t );
+		xEventsSize = ( size_t ) pxDecoder->xHeader.ulEventCapacity * sizeof( TraceRecorderEvent_t );
+
+		if( ( pxDecoder->xHeader.ulMagic != traceRECORDER_MAGIC ) || ( pxDecoder->xHeader.ulVersion != traceRECORDER_VERSION ) )
+		{
+			printf( "Trace: not a version %lu trace\r\n", ( unsigned long ) traceRECORDER_VERSION );
+		}
+		else if( ( pxDecoder->xHeader.ulEventCapacity == 0UL ) ||
+				 ( ( pxDecoder->xHeader.ulEventCapacity & ( pxDecoder->xHeader.ulEventCapacity - 1UL ) ) != 0UL ) ||
+				 ( pxDecoder->xHeader.ulTimestampHz == 0UL ) ||
+				 ( xBufferSize < ( sizeof( TraceRecorderHeader_t ) + xNamesSize + xEventsSize ) ) )
+		{
+			printf( "Trace: corrupt or truncated header\r\n" );
+		}
+		else
+		{
+			pxDecoder->pxNames = ( const TraceRecorderName_t * ) ( pucBuffer + sizeof( TraceRecorderHeader_t ) );
+			pxEvents = ( const TraceRecorderEvent_t * ) ( pucBuffer + sizeof( TraceRecorderHeader_t ) + xNamesSize );
+			pxDecoder->iRunningTask = trdNONE;
+
+			/* Once the ring has wrapped the oldest event is the one that will be
+			overwritten next. */
+			if( pxDecoder->xHeader.ulEventsWritten > pxDecoder->xHeader.ulEventCapacity )
+			{
+				ulEvents = pxDecoder->xHeader.ulEventCapacity;
+			}
+			else
+			{
+				ulEvents = pxDecoder->xHeader.ulEventsWritten;
+			}
+
+			ulFirst = pxDecoder->xHeader.ulEventsWritten - ulEvents;
+			ullTime = 0ULL;
+			ulLastTimestamp = ( ulEvents > 0UL ) ? pxEvents[ ulFirst & ( pxDecoder->xHeader.ulEventCapacity - 1UL ) ].ulTimestamp : 0UL;
+
+			for( ulIndex = 0UL; ulIndex < ulEvents; ulIndex++ )
+			{
+				const TraceRecorderEvent_t *pxEvent = &( pxEvents[ ( ulFirst + ulIndex ) & ( pxDecoder->xHeader.ulEventCapacity - 1UL ) ] );
+
+				/* Unsigned subtraction removes the wrap of the 32-bit count,
+				provided consecutive events are less than one wrap apart. */
+				ullTime += ( uint64_t ) ( uint32_t ) ( pxEvent->ulTimestamp - ulLastTimestamp );
+				ulLastTimestamp = pxEvent->ulTimestamp;
+
+				prvDecodeEvent( pxDecoder, pxEvent, ullTime );
+			}
+
+			prvPrintReport( pxDecoder, ulEvents );
+			xReturn = pdPASS;
+		}
+	}
+
+	free( pxDecoder );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xTraceDecodeFile( const char *pcFileName )
+{
+FILE *pxFile;
+long lSize;
+void *pvBuffer = NULL;
+BaseType_t xReturn = pdFAIL;
+
+	pxFile = fopen( pcFileName, "rb" );
+
+	if( pxFile == NULL )
+	{
+		printf( "Trace: cannot open %s\r\n", pcFileName );
+	}
+	else
+	{
+		if( ( fseek( pxFile, 0L, SEEK_END ) == 0 ) && ( ( lSize = ftell( pxFile ) ) > 0L ) && ( fseek( pxFile, 0L, SEEK_SET ) == 0 ) )
+		{
+			pvBuffer = malloc( ( size_t ) lSize );
+
+			if( ( pvBuffer != NULL ) && ( fread( pvBuffer, 1, ( size_t ) lSize, pxFile ) == ( size_t ) lSize ) )
+			{
+				printf( "Trace: decoding %s\r\n", pcFileName );
+				xReturn = xTraceDecodeBuffer( pvBuffer, ( size_t ) lSize );
+			}
+			else
+			{
+				printf( "Trace: cannot read %s\r\n", pcFileName );
+			}
+		}
+		else
+		{
+			printf( "Trace: %s is empty\r\n", pcFileName );
+		}
+
+		free( pvBuffer );
+		fclose( pxFile );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvDecodeEvent( TraceDecoder_t *pxDecoder, const TraceRecorderEvent_t *pxEvent, uint64_t ullTime )
+{
+TraceDecoderTask_t *pxTask;
+TraceDecoderObject_t *pxObject;
+uint64_t ullLatency, ullMicroseconds;
+int iTask, iObject, iISR, iBucket;
+
+	/* Charge the time since the previous event to whatever was executing. */
+	if( pxDecoder->iISRNesting == 0 )
+	{
+		if( pxDecoder->iRunningTask != trdNONE )
+		{
+			pxDecoder->xTasks[ pxDecoder->iRunningTask ].ullRunTime += ullTime - pxDecoder->ullTime;
+		}
+		else
+		{
+			pxDecoder->ullFirstTime = ullTime;
+		}
+	}
+
+	pxDecoder->ullTime = ullTime;
+
+	switch( pxEvent->ucEvent )
+	{
+		case traceEVENT_TASK_CREATE:
+			( void ) prvGetTask( pxDecoder, pxEvent->usObject );
+			break;
+
+		case traceEVENT_TASK_DELETE:
+			iTask = prvGetTask( pxDecoder, pxEvent->usObject );
+
+			if( iTask != trdNONE )
+			{
+				pxDecoder->xTasks[ iTask ].xReadyPending = pdFALSE;
+				pxDecoder->xTasks[ iTask ].iBlockedOn = trdNONE;
+			}
+			break;
+
+		case traceEVENT_TASK_READY:
+			iTask = prvGetTask( pxDecoder, pxEvent->usObject );
+
+			if( iTask != trdNONE )
+			{
+				pxTask = &( pxDecoder->xTasks[ iTask ] );
+
+				/* A task that is already running, or already waiting to run,
+				does not start a new latency measurement. */
+				if( ( iTask != pxDecoder->iRunningTask ) && ( pxTask->xReadyPending == pdFALSE ) )
+				{
+					pxTask->xReadyPending = pdTRUE;
+					pxTask->ullReadyTime = ullTime;
+				}
+
+				if( pxTask->iBlockedOn != trdNONE )
+				{
+					pxObject = &( pxDecoder->xObjects[ pxTask->iBlockedOn ] );
+					pxObject->ullBlockedTime += ullTime - pxTask->ullBlockTime;
+
+					if( ( ullTime - pxTask->ullBlockTime ) > pxObject->ullLongestBlock )
+					{
+						pxObject->ullLongestBlock = ullTime - pxTask->ullBlockTime;
+					}
+
+					pxTask->iBlockedOn = trdNONE;
+				}
+			}
+			break;
+
+		case traceEVENT_TASK_SWITCHED_IN:
+			iTask = prvGetTask( pxDecoder, pxEvent->usObject );
+			pxDecoder->iRunningTask = iTask;
+
+			if( iTask != trdNONE )
+			{
+				pxTask = &( pxDecoder->xTasks[ iTask ] );
+				pxTask->ulSwitchedIn++;
+
+				if( pxTask->xReadyPending != pdFALSE )
+				{
+					pxTask->xReadyPending = pdFALSE;
+					ullLatency = prvToNs( pxDecoder, ullTime - pxTask->ullReadyTime );
+					vBenchmarkAddSample( &( pxTask->xLatency ), ullLatency );
+
+					/* Bucket n > 0 counts latencies from 2^(n-1)us up to, but
+					not including, 2^n us. */
+					ullMicroseconds = ullLatency / trdNS_PER_US;
+
+					for( iBucket = 0; ( ullMicroseconds > 0ULL ) && ( iBucket < ( trdHISTOGRAM_BUCKETS - 1 ) ); iBucket++ )
+					{
+						ullMicroseconds >>= 1;
+					}
+
+					pxTask->ulHistogram[ iBucket ]++;
+				}
+			}
+			break;
+
+		case traceEVENT_TASK_DELAY:
+		case traceEVENT_TASK_SUSPEND:
+		case traceEVENT_TASK_NOTIFY_BLOCK:
+			/* Nothing to measure, but the task is registered. */
+			( void ) prvGetTask( pxDecoder, pxEvent->usObject );
+			break;
+
+		case traceEVENT_OBJECT_CREATE:
+			iObject = prvGetObject( pxDecoder, pxEvent->usObject );
+
+			if( iObject != trdNONE )
+			{
+				pxDecoder->xObjects[ iObject ].ucType = pxEvent->ucParameter;
+			}
+			break;
+
+		case traceEVENT_OBJECT_DELETE:
+			break;
+
+		case traceEVENT_QUEUE_SEND:
+		case traceEVENT_QUEUE_RECEIVE:
+			iObject = prvGetObject( pxDecoder, pxEvent->usObject );
+
+			if( iObject != trdNONE )
+			{
+				pxObject = &( pxDecoder->xObjects[ iObject ] );
+
+				if( pxEvent->ucEvent == traceEVENT_QUEUE_SEND )
+				{
+					pxObject->ulSends++;
+					pxObject->ulSendsFromISR += ( pxEvent->ucParameter != 0U ) ? 1UL : 0UL;
+				}
+				else
+				{
+					pxObject->ulReceives++;
+					pxObject->ulReceivesFromISR += ( pxEvent->ucParameter != 0U ) ? 1UL : 0UL;
+				}
+			}
+			break;
+
+		case traceEVENT_QUEUE_BLOCK_SEND:
+		case traceEVENT_QUEUE_BLOCK_RECEIVE:
+		case traceEVENT_EVENT_GROUP_BLOCK:
+		case traceEVENT_STREAM_BUFFER_BLOCK_SEND:
+		case traceEVENT_STREAM_BUFFER_BLOCK_RECEIVE:
+			iObject = prvGetObject( pxDecoder, pxEvent->usObject );
+
+			if( iObject != trdNONE )
+			{
+				pxDecoder->xObjects[ iObject ].ulBlocks++;
+
+				/* The blocking task is the running task. */
+				if( pxDecoder->iRunningTask != trdNONE )
+				{
+					pxTask = &( pxDecoder->xTasks[ pxDecoder->iRunningTask ] );
+					pxTask->iBlockedOn = iObject;
+					pxTask->ullBlockTime = ullTime;
+				}
+			}
+			break;
+
+		case traceEVENT_ISR_ENTER:
+			iISR = prvGetISR( pxDecoder, pxEvent->usObject );
+
+			if( pxDecoder->iISRNesting < trdMAX_ISR_NESTING )
+			{
+				pxDecoder->iISRStack[ pxDecoder->iISRNesting ] = iISR;
+				pxDecoder->ullISRStartTime[ pxDecoder->iISRNesting ] = ullTime;
+			}
+
+			pxDecoder->iISRNesting++;
+			break;
+
+		case traceEVENT_ISR_EXIT:
+			if( pxDecoder->iISRNesting == 0 )
+			{
+				/* The entry was overwritten before the trace was saved. */
+				pxDecoder->ulUnmatchedISRExits++;
+			}
+			else
+			{
+				pxDecoder->iISRNesting--;
+
+				if( pxDecoder->iISRNesting < trdMAX_ISR_NESTING )
+				{
+					iISR = pxDecoder->iISRStack[ pxDecoder->iISRNesting ];
+
+					if( iISR != trdNONE )
+					{
+						vBenchmarkAddSample( &( pxDecoder->xISRs[ iISR ].xDuration ), prvToNs( pxDecoder, ullTime - pxDecoder->ullISRStartTime[ pxDecoder->iISRNesting ] ) );
+					}
+				}
+			}
+			break;
+
+		default:
+			/* An event added by a later version of the recorder. */
+			break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static int prvGetTask( TraceDecoder_t *pxDecoder, uint16_t usNumber )
+{
+int iIndex;
+uint8_t ucType;
+TraceDecoderTask_t *pxTask;
+
+	for( iIndex = 0; iIndex < pxDecoder->iNumTasks; iIndex++ )
+	{
+		if( pxDecoder->xTasks[ iIndex ].usNumber == usNumber )
+		{
+			return iIndex;
+		}
+	}
+
+	if( pxDecoder->iNumTasks < trdMAX_TASKS )
+	{
+		iIndex = pxDecoder->iNumTasks;
+		pxDecoder->iNumTasks++;
+
+		pxTask = &( pxDecoder->xTasks[ iIndex ] );
+		pxTask->usNumber = usNumber;
+		pxTask->iBlockedOn = trdNONE;
+		prvFindName( pxDecoder, traceTYPE_TASK, usNumber, pxTask->cName, &ucType );
+
+		if( pxTask->cName[ 0 ] == 0x00 )
+		{
+			snprintf( pxTask->cName, sizeof( pxTask->cName ), "Task %u", ( unsigned ) usNumber );
+		}
+
+		pxTask->xLatency.pcName = pxTask->cName;
+		pxTask->xLatency.ullMin = UINT64_MAX;
+	}
+	else
+	{
+		iIndex = trdNONE;
+	}
+
+	return iIndex;
+}
+/*-----------------------------------------------------------*/
+
+static int prvGetObject( TraceDecoder_t *pxDecoder, uint16_t usNumber )
+{
+int iIndex;
+TraceDecoderObject_t *pxObject;
+
+	for( iIndex = 0; iIndex < pxDecoder->iNumObjects; iIndex++ )
+	{
+		if( pxDecoder->xObjects[ iIndex ].usNumber == usNumber )
+		{
+			return iIndex;
+		}
+	}
+
+	if( pxDecoder->iNumObjects < trdMAX_OBJECTS )
+	{
+		iIndex = pxDecoder->iNumObjects;
+		pxDecoder->iNumObjects++;
+
+		pxObject = &( pxDecoder->xObjects[ iIndex ] );
+		pxObject->usNumber = usNumber;
+		pxObject->ucType = traceTYPE_QUEUE;
+		prvFindName( pxDecoder, traceTYPE_QUEUE, usNumber, pxObject->cName, &( pxObject->ucType ) );
+
+		if( pxObject->cName[ 0 ] == 0x00 )
+		{
+			/* Only objects added to the queue registry are named. */
+			snprintf( pxObject->cName, sizeof( pxObject->cName ), "(unnamed)" );
+		}
+	}
+	else
+	{
+		iIndex = trdNONE;
+	}
+
+	return iIndex;
+}
+/*-----------------------------------------------------------*/
+
+static int prvGetISR( TraceDecoder_t *pxDecoder, uint16_t usNumber )
+{
+int iIndex;
+uint8_t ucType;
+TraceDecoderISR_t *pxISR;
+
+	for( iIndex = 0; iIndex < pxDecoder->iNumISRs; iIndex++ )
+	{
+		if( pxDecoder->xISRs[ iIndex ].usNumber == usNumber )
+		{
+			return iIndex;
+		}
+	}
+
+	if( pxDecoder->iNumISRs < trdMAX_ISRS )
+	{
+		iIndex = pxDecoder->iNumISRs;
+		pxDecoder->iNumISRs++;
+
+		pxISR = &( pxDecoder->xISRs[ iIndex ] );
+		pxISR->usNumber = usNumber;
+		prvFindName( pxDecoder, traceTYPE_ISR, usNumber, pxISR->cName, &ucType );
+
+		if( pxISR->cName[ 0 ] == 0x00 )
+		{
+			snprintf( pxISR->cName, sizeof( pxISR->cName ), "ISR %u", ( unsigned ) usNumber );
+		}
+
+		pxISR->xDuration.pcName = pxISR->cName;
+		pxISR->xDuration.ullMin = UINT64_MAX;
+	}
+	else
+	{
+		iIndex = trdNONE;
+	}
+
+	return iIndex;
+}
+/*-----------------------------------------------------------*/
+
+static void prvFindName( const TraceDecoder_t *pxDecoder, uint8_t ucClass, uint16_t usNumber, char *pcName, uint8_t *pucType )
+{
+uint32_t ulIndex;
+const TraceRecorderName_t *pxName;
+uint8_t ucNameClass;
+
+	pcName[ 0 ] = 0x00;
+
+	for( ulIndex = 0UL; ulIndex < pxDecoder->xHeader.ulNameCapacity; ulIndex++ )
+	{
+		pxName = &( pxDecoder->pxNames[ ulIndex ] );
+
+		if( ( pxName->ucType == traceTYPE_TASK ) || ( pxName->ucType == traceTYPE_ISR ) )
+		{
+			ucNameClass = pxName->ucType;
+		}
+		else
+		{
+			ucNameClass = traceTYPE_QUEUE;
+		}
+
+		/* The entry of a deleted object still holds its name, but may since
+		have been reused, in which case it no longer matches. */
+		if( ( ( pxName->ucFlags & traceNAME_FLAG_USED ) != 0U ) && ( ucNameClass == ucClass ) && ( pxName->usObject == usNumber ) )
+		{
+			memcpy( pcName, pxName->cName, traceRECORDER_NAME_LENGTH );
+			pcName[ traceRECORDER_NAME_LENGTH ] = 0x00;
+			*pucType = pxName->ucType;
+			break;
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint64_t prvToNs( const TraceDecoder_t *pxDecoder, uint64_t ullCounts )
+{
+const uint64_t ullHz = ( uint64_t ) pxDecoder->xHeader.ulTimestampHz;
+
+	return ( ( ullCounts / ullHz ) * trdNS_PER_SECOND ) + ( ( ( ullCounts % ullHz ) * trdNS_PER_SECOND ) / ullHz );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintReport( const TraceDecoder_t *pxDecoder, uint32_t ulEvents )
+{
+const TraceDecoderTask_t *pxTask;
+const TraceDecoderObject_t *pxObject;
+const char *pcType;
+uint64_t ullSpan, ullRunTime, ullBlockedTime;
+uint32_t ulBucket;
+int iIndex;
+
+	ullSpan = prvToNs( pxDecoder, pxDecoder->ullTime - pxDecoder->ullFirstTime );
+
+	printf( "Trace: %lu events over %llu ms, %lu events overwritten, %lu names dropped, %lu interrupt exits without an entry\r\n",
+			( unsigned long ) ulEvents, ( unsigned long long ) ( ullSpan / trdNS_PER_MS ),
+			( unsigned long ) ( pxDecoder->xHeader.ulEventsWritten - ulEvents ),
+			( unsigned long ) pxDecoder->xHeader.ulNamesDropped,
+			( unsigned long ) pxDecoder->ulUnmatchedISRExits );
+
+	for( iIndex = 0; iIndex < pxDecoder->iNumTasks; iIndex++ )
+	{
+		pxTask = &( pxDecoder->xTasks[ iIndex ] );
+		ullRunTime = prvToNs( pxDecoder, pxTask->ullRunTime );
+
+		printf( "Trace task %s: run %llu.%03llums (%llu%%), switched in %lu times\r\n",
+				pxTask->cName,
+				( unsigned long long ) ( ullRunTime / trdNS_PER_MS ), ( unsigned long long ) ( ( ullRunTime % trdNS_PER_MS ) / trdNS_PER_US ),
+				( unsigned long long ) ( ( ullSpan > 0ULL ) ? ( ( ullRunTime * 100ULL ) / ullSpan ) : 0ULL ),
+				( unsigned long ) pxTask->ulSwitchedIn );
+
+		if( pxTask->xLatency.ulSamples > 0UL )
+		{
+			printf( "  wake latency " );
+			vBenchmarkPrintStats( &( pxTask->xLatency ) );
+			printf( "  wake latency histogram:" );
+
+			for( ulBucket = 0UL; ulBucket < trdHISTOGRAM_BUCKETS; ulBucket++ )
+			{
+				if( pxTask->ulHistogram[ ulBucket ] == 0UL )
+				{
+					continue;
+				}
+				else if( ulBucket == 0UL )
+				{
+					printf( " <1us:%lu", ( unsigned long ) pxTask->ulHistogram[ ulBucket ] );
+				}
+				else if( ulBucket == ( trdHISTOGRAM_BUCKETS - 1UL ) )
+				{
+					printf( " >=%luus:%lu", 1UL << ( ulBucket - 1UL ), ( unsigned long ) pxTask->ulHistogram[ ulBucket ] );
+				}
+				else
+				{
+					printf( " <%luus:%lu", 1UL << ulBucket, ( unsigned long ) pxTask->ulHistogram[ ulBucket ] );
+				}
+			}
+
+			printf( "\r\n" );
+		}
+	}
+
+	for( iIndex = 0; iIndex < pxDecoder->iNumObjects; iIndex++ )
+	{
+		pxObject = &( pxDecoder->xObjects[ iIndex ] );
+		pcType = ( pxObject->ucType < ( sizeof( pcTypeNames ) / sizeof( pcTypeNames[ 0 ] ) ) ) ? pcTypeNames[ pxObject->ucType ] : "Object";
+		ullBlockedTime = prvToNs( pxDecoder, pxObject->ullBlockedTime );
+
+		/* Objects that were created and deleted without being used, such as
+		those of the allocation benchmark, are not worth a line each. */
+		if( ( pxObject->ulSends + pxObject->ulReceives + pxObject->ulBlocks ) == 0UL )
+		{
+			continue;
+		}
+
+		printf( "Trace %s %u %s: %lu sends (%lu from ISR), %lu receives (%lu from ISR), blocked %lu times for %llu.%03llums, longest %lluus\r\n",
+				pcType, ( unsigned ) pxObject->usNumber, pxObject->cName,
+				( unsigned long ) pxObject->ulSends, ( unsigned long ) pxObject->ulSendsFromISR,
+				( unsigned long ) pxObject->ulReceives, ( unsigned long ) pxObject->ulReceivesFromISR,
+				( unsigned long ) pxObject->ulBlocks,
+				( unsigned long long ) ( ullBlockedTime / trdNS_PER_MS ), ( unsigned long long ) ( ( ullBlockedTime % trdNS_PER_MS ) / trdNS_PER_US ),
+				( unsigned long long ) ( prvToNs( pxDecoder, pxObject->ullLongestBlock ) / trdNS_PER_US ) );
+	}
+
+	for( iIndex = 0; iIndex < pxDecoder->iNumISRs; iIndex++ )
+	{
+		printf( "Trace ISR duration " );
+		vBenchmarkPrintStats( &( pxDecoder->xISRs[ iIndex ].xDuration ) );
+	}
+}
+/*-----------------------------------------------------------*/
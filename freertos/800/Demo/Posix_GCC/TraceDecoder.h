@@ -0,0 +1,101 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Host side decoder for the buffer written by the kernel's trace recorder -
+ * see Source/include/trace_recorder.h.  The buffer is decoded from a copy, so
+ * the same code decodes a buffer saved by this demo or one read from a target
+ * by a debugger, as long as the target has the same endianness as the host.
+ */
+
+#ifndef TRACE_DECODER_H
+#define TRACE_DECODER_H
+
+/*
+ * Decode xBufferSize bytes of trace recorder buffer and print a report of:
+ *
+ *   + Each task's run time, excluding time spent in interrupts, and the
+ *     latency from the task being made ready to the task running, as a
+ *     histogram and as min/avg/max.
+ *
+ *   + Each queue's, semaphore's, mutex's, event group's and stream buffer's
+ *     send/give and receive/take counts, how many times tasks blocked on it,
+ *     and how long they were blocked for.
+ *
+ *   + The duration of each interrupt traced with traceISR_ENTER().
+ *
+ * Only the events still held in the ring are decoded.  Returns pdFAIL if the
+ * buffer is not a valid trace.
+ */
+BaseType_t xTraceDecodeBuffer( const void *pvBuffer, size_t xBufferSize );
+
+/*
+ * Read a trace recorder buffer saved in a file, then decode it as
+ * xTraceDecodeBuffer().
+ */
+BaseType_t xTraceDecodeFile( const char *pcFileName );
+
+#endif /* TRACE_DECODER_H */
+
@@ -0,0 +1,484 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares deferring work from an interrupt to the timer service task, using
+ * xTimerPendFunctionCallFromISR(), with deferring it to a work queue (see
+ * work_queue.c) that has an urgent worker and a lower priority bulk worker.
+ * The tick interrupt (see vWorkQueueBenchmarkISR()) submits the work, for
+ * wqbPHASE_TICKS ticks at a time, in two patterns:
+ *
+ * Mixed - every wqbBURST_PERIOD ticks the interrupt submits wqbBULK_ITEMS bulk
+ * items, each of which takes wqbBULK_WORK_NS to run, then one urgent item that
+ * takes almost no time.  The timer service task runs the urgent item after all
+ * the bulk items ahead of it, whereas the urgent worker preempts the bulk
+ * worker.  The time from submitting each urgent item to it starting to run is
+ * recorded, and the median and 99th percentile reported, along with the time
+ * taken to complete each burst.
+ *
+ * Throughput - every tick the interrupt submits wqbTHROUGHPUT_ITEMS items that
+ * do nothing, all to the bulk worker.  The time from submitting the first item
+ * to completing the last gives the cost of deferring each item.
+ *
+ * The work keeps the timer service task busy for much of each tick, which would
+ * upset the timing checks of the standard demo tasks, so the benchmark is run
+ * on its own - see main.c.  The results are printed once the scheduler has
+ * been ended.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "work_queue.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "WorkQueueBenchmark.h"
+
+#if( ( configUSE_TIMERS != 1 ) || ( INCLUDE_xTimerPendFunctionCall != 1 ) )
+	#error WorkQueueBenchmark.c requires configUSE_TIMERS and INCLUDE_xTimerPendFunctionCall to be 1.
+#endif
+
+/* The workers of the work queue. */
+#define wqbURGENT_WORKER			( 0 )
+#define wqbBULK_WORKER				( 1 )
+#define wqbWORKERS					( 2 )
+
+/* The number of items each worker can have waiting.  The timer queue holds
+configTIMER_QUEUE_LENGTH. */
+#define wqbLENGTH					( 32 )
+
+/* The mixed pattern. */
+#define wqbBURST_PERIOD				( 4UL )
+#define wqbBULK_ITEMS				( 8UL )
+#define wqbBULK_WORK_NS				( 200000ULL )
+
+/* The throughput pattern. */
+#define wqbTHROUGHPUT_ITEMS			( 16UL )
+
+/* How long each phase runs, and how long the benchmark task waits after each
+phase for the work already submitted to complete. */
+#define wqbPHASE_TICKS				( ( TickType_t ) 1000 )
+#define wqbDRAIN_TICKS				( ( TickType_t ) 100 )
+
+/* Enough to hold the latency of every urgent item submitted in a phase. */
+#define wqbMAX_URGENT_SAMPLES		( ( wqbPHASE_TICKS / wqbBURST_PERIOD ) + 1UL )
+
+/* The length of the names given to the results. */
+#define wqbNAME_LENGTH				( 64 )
+
+/* The phases, in the order they run. */
+typedef enum
+{
+	wqbTIMER_MIXED = 0,
+	wqbWORK_QUEUE_MIXED,
+	wqbTIMER_THROUGHPUT,
+	wqbWORK_QUEUE_THROUGHPUT,
+	wqbNUMBER_OF_PHASES
+} WorkQueueBenchmarkPhase_t;
+
+/* The results of one phase. */
+typedef struct WORK_QUEUE_BENCHMARK_RESULT
+{
+	const char *pcName;
+	BaseType_t xUseWorkQueue;
+	BaseType_t xMixed;
+	BenchmarkStats_t xUrgentLatency;
+	BenchmarkStats_t xBurstTime;
+	uint32_t ulUrgentSamples[ wqbMAX_URGENT_SAMPLES ];
+	uint32_t ulUrgentCount;
+	uint32_t ulItemsRun;
+	uint32_t ulItemsSubmitted;
+	uint32_t ulSubmitFailures;
+	char cUrgentName[ wqbNAME_LENGTH ];
+	char cBurstName[ wqbNAME_LENGTH ];
+} WorkQueueBenchmarkResult_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The task that moves from one phase to the next, as described at the top of
+ * this file.
+ */
+static void prvWorkQueueBenchmarkTask( void *pvParameters );
+
+/*
+ * The work.  pvParameter1 points to the result of the phase, and ulParameter2
+ * is the time at which the item, or the burst it is the last item of, was
+ * submitted.
+ */
+static void prvUrgentWork( void *pvParameter1, uint32_t ulParameter2 );
+static void prvBulkWork( void *pvParameter1, uint32_t ulParameter2 );
+static void prvLastBulkWork( void *pvParameter1, uint32_t ulParameter2 );
+static void prvEmptyWork( void *pvParameter1, uint32_t ulParameter2 );
+static void prvLastEmptyWork( void *pvParameter1, uint32_t ulParameter2 );
+
+/*
+ * Submit one item as the current phase requires, from the tick interrupt.
+ */
+static void prvSubmitFromISR( WorkQueueBenchmarkResult_t *pxResult, UBaseType_t uxWorker, PendedFunction_t xFunction, uint32_t ulSubmitTime, BaseType_t *pxHigherPriorityTaskWoken );
+
+/*
+ * Used to sort the latencies of the urgent items.
+ */
+static int prvCompareLatencies( const void *pvLatency1, const void *pvLatency2 );
+
+/*-----------------------------------------------------------*/
+
+static WorkQueueBenchmarkResult_t xResults[ wqbNUMBER_OF_PHASES ];
+
+static const char * const pcPhaseNames[ wqbNUMBER_OF_PHASES ] =
+{
+	"Timer service task, mixed",
+	"Work queue, mixed",
+	"Timer service task, throughput",
+	"Work queue, throughput"
+};
+
+static WorkQueueHandle_t xWorkQueue = NULL;
+
+/* The statistics of each worker, copied once the phases have all run. */
+static WorkQueueStats_t xWorkerStats[ wqbWORKERS ];
+
+/* The phase the tick interrupt is submitting work for, or NULL if none. */
+static WorkQueueBenchmarkResult_t * volatile pxActivePhase = NULL;
+static uint32_t ulISRTicks = 0UL;
+
+/* Incremented as each phase starts and ends, so the check task can see the
+benchmark is progressing. */
+static volatile uint32_t ulPhaseChanges = 0UL, ulLastPhaseChanges = 0UL;
+
+/* Set once every phase has run. */
+static volatile BaseType_t xComplete = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+void vStartWorkQueueBenchmark( UBaseType_t uxPriority )
+{
+/* The urgent worker runs above the bulk worker, and both run above the
+benchmark task. */
+const UBaseType_t uxPriorities[ wqbWORKERS ] = { uxPriority + 2, uxPriority + 1 };
+UBaseType_t uxPhase;
+
+	configASSERT( ( uxPriority + 2 ) < configTIMER_TASK_PRIORITY );
+
+	for( uxPhase = 0; uxPhase < wqbNUMBER_OF_PHASES; uxPhase++ )
+	{
+		xResults[ uxPhase ].pcName = pcPhaseNames[ uxPhase ];
+		xResults[ uxPhase ].xUseWorkQueue = ( ( uxPhase == wqbWORK_QUEUE_MIXED ) || ( uxPhase == wqbWORK_QUEUE_THROUGHPUT ) ) ? pdTRUE : pdFALSE;
+		xResults[ uxPhase ].xMixed = ( uxPhase <= wqbWORK_QUEUE_MIXED ) ? pdTRUE : pdFALSE;
+		snprintf( xResults[ uxPhase ].cUrgentName, wqbNAME_LENGTH, "%s: urgent item latency", xResults[ uxPhase ].pcName );
+		snprintf( xResults[ uxPhase ].cBurstName, wqbNAME_LENGTH, "%s: burst completion", xResults[ uxPhase ].pcName );
+		xResults[ uxPhase ].xUrgentLatency.pcName = xResults[ uxPhase ].cUrgentName;
+		xResults[ uxPhase ].xUrgentLatency.ullMin = UINT64_MAX;
+		xResults[ uxPhase ].xBurstTime.pcName = xResults[ uxPhase ].cBurstName;
+		xResults[ uxPhase ].xBurstTime.ullMin = UINT64_MAX;
+	}
+
+	xWorkQueue = xWorkQueueCreate( wqbWORKERS, uxPriorities, wqbLENGTH, configMINIMAL_STACK_SIZE );
+	configASSERT( xWorkQueue );
+
+	xTaskCreate( prvWorkQueueBenchmarkTask, "WqBench", configMINIMAL_STACK_SIZE, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvWorkQueueBenchmarkTask( void *pvParameters )
+{
+UBaseType_t uxPhase, uxWorker;
+TickType_t xTick;
+
+	( void ) pvParameters;
+
+	for( uxPhase = 0; uxPhase < wqbNUMBER_OF_PHASES; uxPhase++ )
+	{
+		ulISRTicks = 0UL;
+		pxActivePhase = &( xResults[ uxPhase ] );
+		ulPhaseChanges++;
+
+		/* Delay one tick at a time, as the tick hook is not called for the
+		ticks that tickless idle suppresses. */
+		for( xTick = 0; xTick < wqbPHASE_TICKS; xTick++ )
+		{
+			vTaskDelay( ( TickType_t ) 1 );
+		}
+
+		pxActivePhase = NULL;
+		ulPhaseChanges++;
+		vTaskDelay( wqbDRAIN_TICKS );
+	}
+
+	for( uxWorker = 0; uxWorker < wqbWORKERS; uxWorker++ )
+	{
+		vWorkQueueGetStats( xWorkQueue, uxWorker, &( xWorkerStats[ uxWorker ] ) );
+	}
+
+	xComplete = pdTRUE;
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vWorkQueueBenchmarkISR( void )
+{
+WorkQueueBenchmarkResult_t * const pxResult = pxActivePhase;
+BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+uint32_t ulItem, ulSubmitTime;
+
+	if( pxResult != NULL )
+	{
+		ulSubmitTime = ulMainGetTraceTimestamp();
+
+		if( pxResult->xMixed != pdFALSE )
+		{
+			if( ( ulISRTicks % wqbBURST_PERIOD ) == 0UL )
+			{
+				for( ulItem = 1UL; ulItem < wqbBULK_ITEMS; ulItem++ )
+				{
+					prvSubmitFromISR( pxResult, wqbBULK_WORKER, prvBulkWork, ulSubmitTime, &xHigherPriorityTaskWoken );
+				}
+
+				prvSubmitFromISR( pxResult, wqbBULK_WORKER, prvLastBulkWork, ulSubmitTime, &xHigherPriorityTaskWoken );
+
+				/* The urgent item's latency is measured from when it is
+				submitted. */
+				prvSubmitFromISR( pxResult, wqbURGENT_WORKER, prvUrgentWork, ulMainGetTraceTimestamp(), &xHigherPriorityTaskWoken );
+			}
+		}
+		else
+		{
+			for( ulItem = 1UL; ulItem < wqbTHROUGHPUT_ITEMS; ulItem++ )
+			{
+				prvSubmitFromISR( pxResult, wqbBULK_WORKER, prvEmptyWork, ulSubmitTime, &xHigherPriorityTaskWoken );
+			}
+
+			prvSubmitFromISR( pxResult, wqbBULK_WORKER, prvLastEmptyWork, ulSubmitTime, &xHigherPriorityTaskWoken );
+		}
+
+		ulISRTicks++;
+	}
+
+	portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSubmitFromISR( WorkQueueBenchmarkResult_t *pxResult, UBaseType_t uxWorker, PendedFunction_t xFunction, uint32_t ulSubmitTime, BaseType_t *pxHigherPriorityTaskWoken )
+{
+BaseType_t xSubmitted;
+
+	if( pxResult->xUseWorkQueue != pdFALSE )
+	{
+		xSubmitted = xWorkQueueSubmitFromISR( xWorkQueue, uxWorker, xFunction, ( void * ) pxResult, ulSubmitTime, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		xSubmitted = xTimerPendFunctionCallFromISR( xFunction, ( void * ) pxResult, ulSubmitTime, pxHigherPriorityTaskWoken );
+	}
+
+	if( xSubmitted == pdPASS )
+	{
+		( pxResult->ulItemsSubmitted )++;
+	}
+	else
+	{
+		( pxResult->ulSubmitFailures )++;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvUrgentWork( void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkQueueBenchmarkResult_t * const pxResult = ( WorkQueueBenchmarkResult_t * ) pvParameter1;
+const uint32_t ulLatency = ulMainGetTraceTimestamp() - ulParameter2;
+
+	vBenchmarkAddSample( &( pxResult->xUrgentLatency ), ( uint64_t ) ulLatency );
+
+	if( pxResult->ulUrgentCount < wqbMAX_URGENT_SAMPLES )
+	{
+		pxResult->ulUrgentSamples[ pxResult->ulUrgentCount ] = ulLatency;
+		( pxResult->ulUrgentCount )++;
+	}
+
+	( pxResult->ulItemsRun )++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvBulkWork( void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkQueueBenchmarkResult_t * const pxResult = ( WorkQueueBenchmarkResult_t * ) pvParameter1;
+const uint64_t ullStartTime = ullBenchmarkGetTimeNs();
+
+	( void ) ulParameter2;
+
+	/* Stand in for processing a frame or writing a sector. */
+	while( ( ullBenchmarkGetTimeNs() - ullStartTime ) < wqbBULK_WORK_NS )
+	{
+	}
+
+	( pxResult->ulItemsRun )++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvLastBulkWork( void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkQueueBenchmarkResult_t * const pxResult = ( WorkQueueBenchmarkResult_t * ) pvParameter1;
+
+	prvBulkWork( pvParameter1, ulParameter2 );
+	vBenchmarkAddSample( &( pxResult->xBurstTime ), ( uint64_t ) ( ulMainGetTraceTimestamp() - ulParameter2 ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvEmptyWork( void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkQueueBenchmarkResult_t * const pxResult = ( WorkQueueBenchmarkResult_t * ) pvParameter1;
+
+	( void ) ulParameter2;
+	( pxResult->ulItemsRun )++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvLastEmptyWork( void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkQueueBenchmarkResult_t * const pxResult = ( WorkQueueBenchmarkResult_t * ) pvParameter1;
+
+	prvEmptyWork( pvParameter1, ulParameter2 );
+	vBenchmarkAddSample( &( pxResult->xBurstTime ), ( uint64_t ) ( ulMainGetTraceTimestamp() - ulParameter2 ) );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xIsWorkQueueBenchmarkStillRunning( void )
+{
+BaseType_t xReturn = pdPASS;
+
+	if( ( ulPhaseChanges == ulLastPhaseChanges ) && ( xComplete == pdFALSE ) )
+	{
+		xReturn = pdFAIL;
+	}
+
+	ulLastPhaseChanges = ulPhaseChanges;
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static int prvCompareLatencies( const void *pvLatency1, const void *pvLatency2 )
+{
+const uint32_t ulLatency1 = *( const uint32_t * ) pvLatency1;
+const uint32_t ulLatency2 = *( const uint32_t * ) pvLatency2;
+
+	return ( ulLatency1 > ulLatency2 ) - ( ulLatency1 < ulLatency2 );
+}
+/*-----------------------------------------------------------*/
+
+void vWorkQueueBenchmarkPrintResults( void )
+{
+UBaseType_t uxPhase, uxWorker;
+WorkQueueBenchmarkResult_t *pxResult;
+static const char * const pcWorkerNames[ wqbWORKERS ] = { "urgent", "bulk" };
+
+	for( uxPhase = 0; uxPhase < wqbNUMBER_OF_PHASES; uxPhase++ )
+	{
+		pxResult = &( xResults[ uxPhase ] );
+
+		printf( "%s: %lu items submitted, %lu run, %lu not submitted as the queue was full\r\n",
+				pxResult->pcName,
+				( unsigned long ) pxResult->ulItemsSubmitted,
+				( unsigned long ) pxResult->ulItemsRun,
+				( unsigned long ) pxResult->ulSubmitFailures );
+
+		if( pxResult->xMixed != pdFALSE )
+		{
+			vBenchmarkPrintStats( &( pxResult->xUrgentLatency ) );
+
+			if( pxResult->ulUrgentCount > 0UL )
+			{
+				qsort( pxResult->ulUrgentSamples, pxResult->ulUrgentCount, sizeof( uint32_t ), prvCompareLatencies );
+				printf( "%s: median %.3fus, 99th percentile %.3fus\r\n",
+						pxResult->cUrgentName,
+						( double ) pxResult->ulUrgentSamples[ pxResult->ulUrgentCount / 2UL ] / 1000.0,
+						( double ) pxResult->ulUrgentSamples[ ( pxResult->ulUrgentCount * 99UL ) / 100UL ] / 1000.0 );
+			}
+
+			vBenchmarkPrintStats( &( pxResult->xBurstTime ) );
+		}
+		else
+		{
+			vBenchmarkPrintRate( pxResult->pcName, pxResult->xBurstTime.ulSamples * wqbTHROUGHPUT_ITEMS, pxResult->xBurstTime.ullTotal );
+		}
+	}
+
+	for( uxWorker = 0; uxWorker < wqbWORKERS; uxWorker++ )
+	{
+		printf( "Work queue %s worker: %lu items in %lu batches, at most %lu waiting\r\n",
+				pcWorkerNames[ uxWorker ],
+				( unsigned long ) xWorkerStats[ uxWorker ].ulItemsRun,
+				( unsigned long ) xWorkerStats[ uxWorker ].ulBatches,
+				( unsigned long ) xWorkerStats[ uxWorker ].uxMaxWaiting );
+	}
+}
+/*-----------------------------------------------------------*/
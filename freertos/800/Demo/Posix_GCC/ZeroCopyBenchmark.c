@@ -0,0 +1,323 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * Compares the throughput and processor cost of passing fixed size items from
+ * one task to another through a queue:
+ *
+ *   + By copy, using xQueueSend() and xQueueReceive().  The sender builds each
+ *     item in a buffer of its own, which is copied into the queue, then copied
+ *     out again into a buffer belonging to the receiver.
+ *   + By reference, using xQueueReserve() and xQueueCommit() to write each item
+ *     directly into the queue's storage, and xQueueReceiveReference() and
+ *     xQueueReleaseReference() to read it where it is stored.
+ *
+ * Both are tested with each of the item sizes in ulItemSizes[].  In every test
+ * the sender writes the whole of each item and the receiver checks the first
+ * and last bytes, so the only difference is the two copies.  The receiving
+ * task has a higher priority than the sending task, as in StreamBenchmark.c.
+ * The tests run once, after the stream benchmark has completed.  The time taken
+ * and the processor time used are printed once the scheduler has been ended.
+ *
+ * Passing an item by reference takes four API calls, and so four critical
+ * sections, rather than two.  On this port a critical section masks a signal,
+ * which is a system call that takes longer than copying even the largest item
+ * tested, so here passing by reference is no faster.  On a microcontroller,
+ * where a critical section takes a few instructions, the saving is the time
+ * taken to copy each item twice.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "ZeroCopyBenchmark.h"
+
+#if( configUSE_QUEUE_ZERO_COPY != 1 )
+	#error ZeroCopyBenchmark.c requires configUSE_QUEUE_ZERO_COPY to be set to 1.
+#endif
+
+/* The number of item sizes tested, and the largest. */
+#define zcbNUMBER_OF_SIZES			( 5 )
+#define zcbMAX_ITEM_SIZE			( 4096UL )
+
+/* The length of each queue, in items. */
+#define zcbQUEUE_LENGTH				( 4 )
+
+/* The number of items passed by each test.  Each test keeps the processor busy
+at a high priority, so this is kept small enough not to upset the timing checks
+of the standard demo tasks. */
+#define zcbITEMS					( 500UL )
+
+/* The tests start after a delay so they do not run at the same time as the
+start up of the other demo tasks, or as StreamBenchmark.c, and are spaced out
+to let the lower priority tasks run in between. */
+#define zcbSTART_DELAY				( ( TickType_t ) 2000 / portTICK_PERIOD_MS )
+#define zcbTEST_INTERVAL			( ( TickType_t ) 50 / portTICK_PERIOD_MS )
+
+/* The two ways of passing items that are compared. */
+#define zcbBY_COPY					( 0 )
+#define zcbBY_REFERENCE				( 1 )
+#define zcbNUMBER_OF_METHODS		( 2 )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The tasks described at the top of this file.
+ */
+static void prvSenderTask( void *pvParameters );
+static void prvReceiverTask( void *pvParameters );
+
+/*
+ * Send, or receive, the items for one test.
+ */
+static void prvSendItems( QueueHandle_t xQueue, uint32_t ulItemSize, BaseType_t xMethod );
+static void prvReceiveItems( QueueHandle_t xQueue, uint32_t ulItemSize, BaseType_t xMethod );
+
+/*-----------------------------------------------------------*/
+
+static const uint32_t ulItemSizes[ zcbNUMBER_OF_SIZES ] = { 16UL, 64UL, 256UL, 1024UL, zcbMAX_ITEM_SIZE };
+
+/* One queue for each item size. */
+static QueueHandle_t xQueues[ zcbNUMBER_OF_SIZES ] = { NULL };
+
+/* The results of each test. */
+static uint64_t ullElapsedNs[ zcbNUMBER_OF_SIZES ][ zcbNUMBER_OF_METHODS ];
+static uint64_t ullCpuNs[ zcbNUMBER_OF_SIZES ][ zcbNUMBER_OF_METHODS ];
+
+/* The buffers used by the tests that pass items by copy. */
+static uint8_t ucTxBuffer[ zcbMAX_ITEM_SIZE ], ucRxBuffer[ zcbMAX_ITEM_SIZE ];
+
+/* The test being performed, which is set by the sender before it starts the
+receiver. */
+static volatile UBaseType_t uxCurrentSize = 0;
+static volatile BaseType_t xCurrentMethod = zcbBY_COPY;
+
+static TaskHandle_t xSenderTask = NULL, xReceiverTask = NULL;
+
+/*-----------------------------------------------------------*/
+
+void vStartZeroCopyBenchmark( UBaseType_t uxPriority )
+{
+UBaseType_t uxSize;
+
+	configASSERT( uxPriority > tskIDLE_PRIORITY );
+
+	for( uxSize = 0; uxSize < zcbNUMBER_OF_SIZES; uxSize++ )
+	{
+		xQueues[ uxSize ] = xQueueCreate( zcbQUEUE_LENGTH, ulItemSizes[ uxSize ] );
+		configASSERT( xQueues[ uxSize ] );
+	}
+
+	xTaskCreate( prvSenderTask, "ZcTx", configMINIMAL_STACK_SIZE, NULL, uxPriority - 1, &xSenderTask );
+	xTaskCreate( prvReceiverTask, "ZcRx", configMINIMAL_STACK_SIZE, NULL, uxPriority, &xReceiverTask );
+}
+/*-----------------------------------------------------------*/
+
+static void prvSenderTask( void *pvParameters )
+{
+UBaseType_t uxSize;
+BaseType_t xMethod;
+uint64_t ullStartTime, ullStartCpu;
+
+	( void ) pvParameters;
+
+	vTaskDelay( zcbSTART_DELAY );
+
+	for( uxSize = 0; uxSize < zcbNUMBER_OF_SIZES; uxSize++ )
+	{
+		for( xMethod = zcbBY_COPY; xMethod < zcbNUMBER_OF_METHODS; xMethod++ )
+		{
+			/* Start the receiver, which has the higher priority so will block
+			on the empty queue before this task continues. */
+			uxCurrentSize = uxSize;
+			xCurrentMethod = xMethod;
+			xTaskNotifyGive( xReceiverTask );
+
+			ullStartTime = ullBenchmarkGetTimeNs();
+			ullStartCpu = ullBenchmarkGetCpuTimeNs();
+
+			prvSendItems( xQueues[ uxSize ], ulItemSizes[ uxSize ], xMethod );
+
+			/* Wait for the receiver to receive the last item. */
+			ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+			ullElapsedNs[ uxSize ][ xMethod ] = ullBenchmarkGetTimeNs() - ullStartTime;
+			ullCpuNs[ uxSize ][ xMethod ] = ullBenchmarkGetCpuTimeNs() - ullStartCpu;
+
+			vTaskDelay( zcbTEST_INTERVAL );
+		}
+	}
+
+	/* The tests only run once.  The task suspends itself rather than deleting
+	itself as the death demo tasks check the number of tasks remains
+	constant. */
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiverTask( void *pvParameters )
+{
+	( void ) pvParameters;
+
+	for( ;; )
+	{
+		/* Wait to be started by the sender, perform the test, then tell the
+		sender the test is complete. */
+		ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+		prvReceiveItems( xQueues[ uxCurrentSize ], ulItemSizes[ uxCurrentSize ], xCurrentMethod );
+		xTaskNotifyGive( xSenderTask );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSendItems( QueueHandle_t xQueue, uint32_t ulItemSize, BaseType_t xMethod )
+{
+uint32_t ulItem;
+uint8_t *pucItem;
+
+	for( ulItem = 0; ulItem < zcbITEMS; ulItem++ )
+	{
+		if( xMethod == zcbBY_COPY )
+		{
+			memset( ucTxBuffer, ( int ) ( uint8_t ) ulItem, ( size_t ) ulItemSize );
+			( void ) xQueueSend( xQueue, ucTxBuffer, portMAX_DELAY );
+		}
+		else
+		{
+			if( xQueueReserve( xQueue, ( void ** ) &pucItem, portMAX_DELAY ) == pdPASS )
+			{
+				memset( pucItem, ( int ) ( uint8_t ) ulItem, ( size_t ) ulItemSize );
+				( void ) xQueueCommit( xQueue );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvReceiveItems( QueueHandle_t xQueue, uint32_t ulItemSize, BaseType_t xMethod )
+{
+uint32_t ulItem;
+const uint8_t *pucItem = NULL;
+
+	for( ulItem = 0; ulItem < zcbITEMS; ulItem++ )
+	{
+		if( xMethod == zcbBY_COPY )
+		{
+			if( xQueueReceive( xQueue, ucRxBuffer, portMAX_DELAY ) == pdPASS )
+			{
+				pucItem = ucRxBuffer;
+			}
+		}
+		else
+		{
+			( void ) xQueueReceiveReference( xQueue, ( void ** ) &pucItem, portMAX_DELAY );
+		}
+
+		/* The items must be received in the order they were sent. */
+		configASSERT( pucItem != NULL );
+		configASSERT( pucItem[ 0 ] == ( uint8_t ) ulItem );
+		configASSERT( pucItem[ ulItemSize - 1UL ] == ( uint8_t ) ulItem );
+
+		if( xMethod == zcbBY_REFERENCE )
+		{
+			( void ) xQueueReleaseReference( xQueue );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vZeroCopyBenchmarkPrintResults( void )
+{
+UBaseType_t uxSize;
+BaseType_t xMethod;
+char cName[ 48 ];
+static const char * const pcMethodNames[ zcbNUMBER_OF_METHODS ] = { "by copy", "by reference" };
+
+	for( uxSize = 0; uxSize < zcbNUMBER_OF_SIZES; uxSize++ )
+	{
+		for( xMethod = zcbBY_COPY; xMethod < zcbNUMBER_OF_METHODS; xMethod++ )
+		{
+			snprintf( cName, sizeof( cName ), "Queue %s, %lu byte items", pcMethodNames[ xMethod ], ( unsigned long ) ulItemSizes[ uxSize ] );
+
+			if( ullElapsedNs[ uxSize ][ xMethod ] > 0ULL )
+			{
+				vBenchmarkPrintThroughput( cName, zcbITEMS * ulItemSizes[ uxSize ], ullElapsedNs[ uxSize ][ xMethod ], ullCpuNs[ uxSize ][ xMethod ] );
+			}
+			else
+			{
+				vBenchmarkPrintThroughput( cName, 0UL, 0ULL, 0ULL );
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
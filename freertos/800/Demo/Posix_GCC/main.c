@@ -0,0 +1,1165 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * main() creates the standard demo tasks from Demo/Common/Minimal, a check
+ * task, a latency measurement task and the benchmark tasks, then starts the
+ * scheduler using the POSIX simulator port.  The demo runs for the number of
+ * seconds given on the command line (mainDEFAULT_RUN_TIME_SECONDS if no time is
+ * given), after which the check task ends the scheduler and main() reports the
+ * results.  The process exits with 0 if no errors were detected, so the demo
+ * can be used as a regression test.
+ *
+ * If "lowpower" is given on the command line after the run time then only the
+ * low power demo in LowPowerDemo.c and the check task are created.  The tasks
+ * of the standard demo run at the idle priority, which prevents tickless idle
+ * suppressing the tick, so the two cannot run together.
+ *
+ * If "trace" is given on the command line after the run time then the
+ * standard demo is run with the kernel's trace recorder running, and the trace
+ * is saved and decoded by TraceBenchmark.c once the scheduler has been ended.
+ * Otherwise the recorder is stopped so it does not affect the benchmarks.
+ * "./rtosdemo decode <file>" decodes a saved trace without running the demo.
+ *
+ * The allocations made by the standard demo are recorded, and saved by
+ * HeapBenchmark.c once the scheduler has been ended.  "./rtosdemo replay
+ * <file>" replays a saved allocation trace against the heap without running
+ * the demo.
+ *
+ * The kernel's heap monitor records which task allocated each block and from
+ * where.  The mark is set as the scheduler is started, and once the scheduler
+ * has been ended the monitor's snapshot is saved and decoded by
+ * HeapMonitorDecoder.c - so any blocks allocated while the demo was running
+ * that are still held are reported as possible leaks.  "./rtosdemo heapdecode
+ * <file>" decodes a saved snapshot without running the demo.
+ *
+ * If "delay" is given on the command line after the run time then only the
+ * delayed task benchmark in DelayBenchmark.c and the check task are created.
+ * The benchmark calls the kernel's tick function directly, which would upset
+ * the timing checks of the standard demo tasks.
+ *
+ * If "churn" is given on the command line after the run time then only the
+ * object churn benchmark in ChurnBenchmark.c and the check task are created.
+ * The benchmark creates and deletes tasks, which would upset the task count
+ * checked by death.c.
+ *
+ * If "switch" is given on the command line after the run time then only the
+ * context switch benchmark in SwitchBenchmark.c and the check task are
+ * created.  The benchmark moves a task through the priorities used by the
+ * standard demo tasks.
+ *
+ * If "coroutine" is given on the command line after the run time then only
+ * the co-routine benchmark in CoRoutineBenchmark.c and the check task are
+ * created.  The benchmark creates a ring of tasks at a priority used by the
+ * standard demo tasks.
+ *
+ * If "workqueue" is given on the command line after the run time then only
+ * the deferred work benchmark in WorkQueueBenchmark.c and the check task are
+ * created.  The benchmark keeps the timer service task busy.
+ *
+ * If "mutex" is given on the command line after the run time then only the
+ * mutex benchmark in MutexBenchmark.c and the check task are created.  The
+ * benchmark runs tasks at priorities used by the standard demo tasks.
+ *
+ * If "queueset" is given on the command line after the run time then only the
+ * queue set benchmark in QueueSetBenchmark.c and the check task are created.
+ * The benchmark creates up to 64 queues at a time.
+ *
+ * If "pool" is given on the command line after the run time then only the
+ * memory pool benchmark in MemoryPoolBenchmark.c and the check task are
+ * created.  The tick interrupt frees some of the benchmark's buffers.
+ *
+ * If "registry" is given on the command line after the run time then only the
+ * task snapshot benchmark in RegistryBenchmark.c and the check task are
+ * created.  The benchmark creates over 128 tasks, and the tick interrupt wakes
+ * one of them.
+ *
+ * If "edf" is given on the command line after the run time then only the
+ * deadline scheduling benchmark in EDFBenchmark.c and the check task are
+ * created.  The benchmark takes most of the processor for about 15 seconds.
+ *
+ * "Check" task - This only executes every mainCHECK_PERIOD milliseconds.  It
+ * queries each of the standard demo tasks to ensure they are all still
+ * executing without error, and ends the scheduler when the run time expires.
+ *
+ * "Tick latency" task - This measures the deviation between the actual and the
+ * ideal wake time of a task that unblocks on every tick.
+ *
+ * "Tick wrap" task - FreeRTOSConfig.h starts the tick count a few seconds
+ * before it overflows.  This task blocks until mainWRAP_DELAY ticks before the
+ * overflow, then blocks again for mainWRAP_DELAY ticks, so wakes at exactly
+ * the tick at which the tick count overflows to 0.  It is created in every
+ * mode, and the check task reports an error if it has not woken by the time
+ * the overflow is a check period in the past.
+ *
+ * Benchmarks - Each benchmark is implemented in its own file in this
+ * directory, and prints its results once the scheduler has been ended:
+ *   + NotifyBenchmark.c compares direct to task notifications against binary
+ *     semaphores.
+ *   + StreamBenchmark.c compares passing a byte stream through stream and
+ *     message buffers against a queue of single bytes.
+ *   + ZeroCopyBenchmark.c compares passing items of between 16 and 4096 bytes
+ *     through a queue by copy and by reference.
+ *   + TimerBenchmark.c measures the cost of starting, stopping and expiring
+ *     software timers with between 10 and 10,000 timers active.
+ *   + EventGroupBenchmark.c measures the cost of setting event group bits, and
+ *     the wake latency, with between 0 and 32 other tasks waiting on the group.
+ *   + RingQueueBenchmark.c compares the lock free ring queues against a queue,
+ *     with and without several tasks and the tick interrupt writing at once.
+ *   + AllocationBenchmark.c compares the time and heap taken to create kernel
+ *     objects statically and dynamically.  Unlike the other benchmarks it runs
+ *     from main() before anything else is created.
+ *   + LowPowerDemo.c reports how many tick interrupts tickless idle avoids,
+ *     and the drift in the kernel's time while the tick is suppressed.
+ *   + DelayBenchmark.c measures the cost of the tick and of vTaskDelayUntil()
+ *     with between 8 and 256 tasks delayed, and the worst case tick when they
+ *     all wake together (delay mode only).
+ *   + TraceBenchmark.c measures the cost of recording a trace event, and
+ *     reports each task's run time and wake latency, the time tasks spend
+ *     blocked on each queue and semaphore, and the duration of the tick
+ *     interrupt, from the trace (trace mode only).
+ *   + HeapBenchmark.c measures the time taken by pvPortMalloc() and
+ *     vPortFree(), and the fragmentation of the heap, as a recorded
+ *     allocation trace is replayed (replay mode only).  Build with
+ *     heap_tlsf.c in place of heap_4.c to compare the two.
+ *   + ChurnBenchmark.c measures the cost of creating and deleting queues and
+ *     tasks over and over again (churn mode only).  Build with heap_slab.c in
+ *     place of heap_4.c to compare the size class front end with heap_4.c
+ *     alone.
+ *   + SwitchBenchmark.c measures the time taken to switch between two tasks
+ *     with between 1 and configMAX_PRIORITIES - 3 priorities between them, to
+ *     compare the priority bitmap with searching the ready lists (switch mode
+ *     only).
+ *   + CoRoutineBenchmark.c compares the memory taken by, and the time taken to
+ *     switch between, 256 state machines run as co-routines and run as tasks,
+ *     and checks co-routines can wait on queues, event groups, software timers
+ *     and notifications (coroutine mode only).
+ *   + WorkQueueBenchmark.c compares the latency of urgent work deferred from
+ *     an interrupt, and the cost of deferring work, using a work queue and
+ *     using the timer service task (workqueue mode only).
+ *   + MutexBenchmark.c measures the cost of taking and giving mutexes with and
+ *     without contention, to compare the fast mutexes with mutexes taken and
+ *     given through the queue (mutex mode only).
+ *   + QueueSetBenchmark.c measures the cost of selecting from queue sets of
+ *     4 to 64 members, to compare queue sets that hold a list of their ready
+ *     members with queue sets that hold a queue of events (queueset mode
+ *     only).
+ *   + MemoryPoolBenchmark.c compares recycling message buffers between tasks,
+ *     and from tasks to an interrupt, through a memory pool with recycling
+ *     them through the heap (pool mode only).
+ *   + RegistryBenchmark.c measures how long taking a snapshot of every task
+ *     keeps the scheduler from running a high priority task, to compare
+ *     reading the task registry with suspending the scheduler (registry mode
+ *     only).
+ *   + EDFBenchmark.c compares the deadlines missed by a set of periodic tasks
+ *     scheduled earliest deadline first and by fixed priority, with and
+ *     without overruns and budgets (edf mode only).
+ *   + RegionHeapDemo.c adds arrays that simulate the core coupled memory,
+ *     SRAM2 and external SDRAM of an STM32F4 to the heap, checks blocks and
+ *     task stacks are placed in the regions their hints ask for, and reports
+ *     the usage of each region.  Only built with heap_regions.c - see below.
+ *   + HeapMonitorDecoder.c reports the bytes held by each task and from each
+ *     call site, the fragmentation of the heap, and the possible leaks.
+ *
+ * The tick hook function calls the 'from ISR' tests of the standard demo tasks
+ * and benchmarks.
+ *
+ * There is no makefile.  To build, from this directory:
+ *
+ *   gcc -O2 -pthread -I. -I../Common/include -I../../Source/include \
+ *       -I../../Source/portable/GCC/Posix main.c Benchmark.c \
+ *       NotifyBenchmark.c StreamBenchmark.c TimerBenchmark.c \
+ *       AllocationBenchmark.c LowPowerDemo.c TraceBenchmark.c \
+ *       TraceDecoder.c DelayBenchmark.c ZeroCopyBenchmark.c HeapBenchmark.c \
+ *       ChurnBenchmark.c HeapMonitorDecoder.c EventGroupBenchmark.c \
+ *       RingQueueBenchmark.c SwitchBenchmark.c CoRoutineBenchmark.c \
+ *       WorkQueueBenchmark.c MutexBenchmark.c QueueSetBenchmark.c \
+ *       MemoryPoolBenchmark.c RegistryBenchmark.c EDFBenchmark.c \
+ *       ../../Source/tasks.c ../../Source/queue.c ../../Source/list.c \
+ *       ../../Source/croutine.c \
+ *       ../../Source/timers.c ../../Source/event_groups.c \
+ *       ../../Source/stream_buffer.c ../../Source/trace_recorder.c \
+ *       ../../Source/heap_monitor.c ../../Source/ring_queue.c \
+ *       ../../Source/work_queue.c ../../Source/memory_pool.c \
+ *       ../../Source/portable/GCC/Posix/port.c \
+ *       ../../Source/portable/Common/tickless_idle.c \
+ *       ../../Source/portable/MemMang/heap_4.c \
+ *       ../Common/Minimal/{BlockQ,blocktim,countsem,death,dynamic,flop,GenQTest,integer,PollQ,QPeek,QueueOverwrite,QueueSet,QueueSetReadyList,recmutex,semtest,TimerDemo,EventGroupsDemo,TaskNotify,StreamBufferDemo,StaticAllocation}.c \
+ *       -lm -o rtosdemo
+ *
+ * To build with heap_regions.c, use it in place of heap_4.c, add RegionHeapDemo.c
+ * and add -DconfigUSE_HEAP_PLACEMENT_HINTS=1.
+ *
+ * Then run "./rtosdemo [seconds] [lowpower|trace|delay|churn|switch|coroutine|workqueue|mutex|queueset|pool|registry|edf]", or
+ * "./rtosdemo replay rtosdemo.heap", or "./rtosdemo heapdecode rtosdemo.hmon".
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/* Kernel includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+/* Standard demo includes. */
+#include "BlockQ.h"
+#include "blocktim.h"
+#include "countsem.h"
+#include "death.h"
+#include "dynamic.h"
+#include "flop.h"
+#include "GenQTest.h"
+#include "integer.h"
+#include "PollQ.h"
+#include "QPeek.h"
+#include "QueueOverwrite.h"
+#include "QueueSet.h"
+#include "QueueSetReadyList.h"
+#include "recmutex.h"
+#include "semtest.h"
+#include "TimerDemo.h"
+#include "EventGroupsDemo.h"
+#include "TaskNotify.h"
+#include "StreamBufferDemo.h"
+#include "StaticAllocation.h"
+
+/* Benchmark includes. */
+#include "Benchmark.h"
+#include "NotifyBenchmark.h"
+#include "EventGroupBenchmark.h"
+#include "RingQueueBenchmark.h"
+#include "StreamBenchmark.h"
+#include "ZeroCopyBenchmark.h"
+#include "TimerBenchmark.h"
+#include "AllocationBenchmark.h"
+#include "LowPowerDemo.h"
+#include "TraceBenchmark.h"
+#include "TraceDecoder.h"
+#include "DelayBenchmark.h"
+#include "HeapBenchmark.h"
+#include "ChurnBenchmark.h"
+#include "SwitchBenchmark.h"
+#include "CoRoutineBenchmark.h"
+#include "WorkQueueBenchmark.h"
+#include "MutexBenchmark.h"
+#include "QueueSetBenchmark.h"
+#include "MemoryPoolBenchmark.h"
+#include "RegistryBenchmark.h"
+#include "EDFBenchmark.h"
+#include "RegionHeapDemo.h"
+#include "HeapMonitorDecoder.h"
+
+/* Priorities for the demo application tasks. */
+#define mainQUEUE_POLL_PRIORITY				( tskIDLE_PRIORITY + 1UL )
+#define mainSEM_TEST_PRIORITY				( tskIDLE_PRIORITY + 1UL )
+#define mainBLOCK_Q_PRIORITY				( tskIDLE_PRIORITY + 2UL )
+#define mainGEN_QUEUE_TASK_PRIORITY			( tskIDLE_PRIORITY )
+#define mainQUEUE_OVERWRITE_PRIORITY		( tskIDLE_PRIORITY )
+#define mainCREATOR_TASK_PRIORITY			( tskIDLE_PRIORITY + 3UL )
+#define mainFLOP_TASK_PRIORITY				( tskIDLE_PRIORITY )
+#define mainINTEGER_TASK_PRIORITY			( tskIDLE_PRIORITY )
+#define mainCHECK_TASK_PRIORITY				( configMAX_PRIORITIES - 1UL )
+#define mainLATENCY_TASK_PRIORITY			( configMAX_PRIORITIES - 2UL )
+#define mainBENCHMARK_PRIORITY				( configMAX_PRIORITIES - 2UL )
+#define mainTIMER_BENCHMARK_PRIORITY		( tskIDLE_PRIORITY + 1UL )
+#define mainEVENT_GROUP_BENCHMARK_PRIORITY	( configMAX_PRIORITIES - 3UL ) /* Its target task runs one priority higher, below the timer task. */
+#define mainLOW_POWER_DEMO_PRIORITY			( tskIDLE_PRIORITY + 1UL )
+#define mainDELAY_BENCHMARK_PRIORITY		( tskIDLE_PRIORITY + 1UL )
+#define mainCHURN_BENCHMARK_PRIORITY		( tskIDLE_PRIORITY + 1UL )
+#define mainSWITCH_BENCHMARK_PRIORITY		( tskIDLE_PRIORITY + 1UL )
+#define mainCO_ROUTINE_BENCHMARK_PRIORITY	( tskIDLE_PRIORITY + 1UL )
+#define mainWORK_QUEUE_BENCHMARK_PRIORITY	( tskIDLE_PRIORITY + 1UL ) /* Its workers run one and two priorities higher. */
+#define mainMUTEX_BENCHMARK_PRIORITY		( tskIDLE_PRIORITY + 1UL )
+#define mainQUEUE_SET_BENCHMARK_PRIORITY	( tskIDLE_PRIORITY + 1UL )
+#define mainMEMORY_POOL_BENCHMARK_PRIORITY	( tskIDLE_PRIORITY + 1UL ) /* Its producer and benchmark tasks run one and two priorities higher. */
+#define mainREGISTRY_BENCHMARK_PRIORITY		( tskIDLE_PRIORITY + 1UL ) /* Its workers and probe run one and two priorities higher. */
+#define mainEDF_BENCHMARK_PRIORITY			( configMAX_PRIORITIES - 1UL ) /* Its periodic tasks run at configEDF_PRIORITY, or at the priorities above it. */
+#define mainREGION_HEAP_DEMO_PRIORITY		( tskIDLE_PRIORITY + 1UL )
+#define mainRING_QUEUE_BENCHMARK_PRIORITY	( tskIDLE_PRIORITY + 1UL ) /* Its tasks are time sliced, so would otherwise delay the block time tasks. */
+
+/* The period at which the check task executes, in ms. */
+#define mainCHECK_PERIOD					( 2000UL / portTICK_PERIOD_MS )
+
+/* The priority of the tick wrap task, and the time it blocks for to reach the
+tick at which the tick count overflows - short enough for the delay wheel to
+hold the task in the bucket for that tick. */
+#define mainWRAP_TASK_PRIORITY				( configMAX_PRIORITIES - 1UL )
+#define mainWRAP_DELAY						( ( TickType_t ) 16 )
+
+/* The base period used by the timer test tasks. */
+#define mainTIMER_TEST_PERIOD				( 50 )
+
+/* How long the demo runs for if no run time is given on the command line. */
+#define mainDEFAULT_RUN_TIME_SECONDS		( 20UL )
+
+/* The file the heap monitor's snapshot is saved to. */
+#define mainHEAP_MONITOR_FILE_NAME			"rtosdemo.hmon"
+
+/* The length of a tick period in the units used by the latency measurements. */
+#define mainNS_PER_TICK						( 1000000000ULL / configTICK_RATE_HZ )
+#define mainNS_PER_US						( 1000ULL )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The check task, as described at the top of this file.
+ */
+static void prvCheckTask( void *pvParameters );
+
+/*
+ * The tick latency task, as described at the top of this file.
+ */
+static void prvTickLatencyTask( void *pvParameters );
+
+/*
+ * The tick wrap task, as described at the top of this file.
+ */
+static void prvTickWrapTask( void *pvParameters );
+
+/*
+ * Host library functions must not be interrupted by a context switch, so all
+ * output from tasks goes through this function.
+ */
+static void prvPrintString( const char *pcString );
+
+/*
+ * Used as the run time stats time base.
+ */
+uint32_t ulMainGetRunTimeCounterValue( void );
+
+/*
+ * Used as the trace recorder's timestamp.
+ */
+uint32_t ulMainGetTraceTimestamp( void );
+
+/*-----------------------------------------------------------*/
+
+/* The number of errors detected by the check task. */
+static volatile uint32_t ulErrorCount = 0UL;
+
+/* How long the demo runs before the scheduler is ended. */
+static uint32_t ulRunTimeSeconds = mainDEFAULT_RUN_TIME_SECONDS;
+
+/* The number of ticks from the scheduler starting to the tick count
+overflowing, which is 0 if the tick count starts from 0, and whether the tick
+wrap task has woken at the overflow. */
+static const TickType_t xTicksToWrap = ( TickType_t ) 0U - ( TickType_t ) configINITIAL_TICK_COUNT;
+static volatile BaseType_t xTickWrapped = pdFALSE;
+
+/* The tick latency measurements. */
+static BenchmarkStats_t xTickToTaskJitter = benchmarkSTATS_INIT( "Tick wake time jitter" );
+
+/* The time at which the scheduler was started. */
+static uint64_t ullStartTime = 0ULL;
+
+/* Set if the low power demo is run instead of the standard demo. */
+static BaseType_t xLowPowerDemo = pdFALSE;
+
+/* Set if the standard demo is traced. */
+static BaseType_t xTraceDemo = pdFALSE;
+
+/* Set if the delayed task benchmark is run instead of the standard demo. */
+static BaseType_t xDelayBenchmark = pdFALSE;
+
+/* Set if the object churn benchmark is run instead of the standard demo. */
+static BaseType_t xChurnBenchmark = pdFALSE;
+
+/* Set if the context switch benchmark is run instead of the standard demo. */
+static BaseType_t xSwitchBenchmark = pdFALSE;
+
+/* Set if the co-routine benchmark is run instead of the standard demo. */
+static BaseType_t xCoRoutineBenchmark = pdFALSE;
+
+/* Set if the deferred work benchmark is run instead of the standard demo. */
+static BaseType_t xWorkQueueBenchmark = pdFALSE;
+
+/* Set if the mutex benchmark is run instead of the standard demo. */
+static BaseType_t xMutexBenchmark = pdFALSE;
+
+/* Set if the queue set benchmark is run instead of the standard demo. */
+static BaseType_t xQueueSetBenchmark = pdFALSE;
+
+/* Set if the memory pool benchmark is run instead of the standard demo. */
+static BaseType_t xMemoryPoolBenchmark = pdFALSE;
+
+/* Set if the task snapshot benchmark is run instead of the standard demo. */
+static BaseType_t xRegistryBenchmark = pdFALSE;
+
+/* Set if the deadline scheduling benchmark is run instead of the standard
+demo. */
+static BaseType_t xEDFBenchmark = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+int main( int argc, char *argv[] )
+{
+	if( ( argc > 2 ) && ( strcmp( argv[ 1 ], "decode" ) == 0 ) )
+	{
+		return ( xTraceDecodeFile( argv[ 2 ] ) != pdFAIL ) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if( ( argc > 2 ) && ( strcmp( argv[ 1 ], "replay" ) == 0 ) )
+	{
+		return ( xHeapBenchmarkReplayFile( argv[ 2 ] ) != pdFAIL ) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if( ( argc > 2 ) && ( strcmp( argv[ 1 ], "heapdecode" ) == 0 ) )
+	{
+		return ( xHeapMonitorDecodeFile( argv[ 2 ] ) != pdFAIL ) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if( argc > 1 )
+	{
+		ulRunTimeSeconds = ( uint32_t ) strtoul( argv[ 1 ], NULL, 10 );
+	}
+
+	if( argc > 2 )
+	{
+		if( strcmp( argv[ 2 ], "lowpower" ) == 0 )
+		{
+			xLowPowerDemo = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "trace" ) == 0 )
+		{
+			xTraceDemo = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "delay" ) == 0 )
+		{
+			xDelayBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "churn" ) == 0 )
+		{
+			xChurnBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "switch" ) == 0 )
+		{
+			xSwitchBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "coroutine" ) == 0 )
+		{
+			xCoRoutineBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "workqueue" ) == 0 )
+		{
+			xWorkQueueBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "mutex" ) == 0 )
+		{
+			xMutexBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "queueset" ) == 0 )
+		{
+			xQueueSetBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "pool" ) == 0 )
+		{
+			xMemoryPoolBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "registry" ) == 0 )
+		{
+			xRegistryBenchmark = pdTRUE;
+		}
+		else if( strcmp( argv[ 2 ], "edf" ) == 0 )
+		{
+			xEDFBenchmark = pdTRUE;
+		}
+	}
+
+	ullStartTime = ullBenchmarkGetTimeNs();
+
+	if( xTraceDemo != pdFALSE )
+	{
+		/* Must run before any other kernel objects are created, so they are
+		all named in the trace. */
+		vRunTraceBenchmark();
+	}
+	else
+	{
+		vTraceRecorderStop();
+	}
+
+	if( xLowPowerDemo != pdFALSE )
+	{
+		vStartLowPowerDemo( mainLOW_POWER_DEMO_PRIORITY );
+	}
+	else if( xDelayBenchmark != pdFALSE )
+	{
+		vStartDelayBenchmark( mainDELAY_BENCHMARK_PRIORITY );
+	}
+	else if( xChurnBenchmark != pdFALSE )
+	{
+		vStartChurnBenchmark( mainCHURN_BENCHMARK_PRIORITY );
+	}
+	else if( xSwitchBenchmark != pdFALSE )
+	{
+		vStartSwitchBenchmark( mainSWITCH_BENCHMARK_PRIORITY );
+	}
+	else if( xCoRoutineBenchmark != pdFALSE )
+	{
+		vStartCoRoutineBenchmark( mainCO_ROUTINE_BENCHMARK_PRIORITY );
+	}
+	else if( xWorkQueueBenchmark != pdFALSE )
+	{
+		vStartWorkQueueBenchmark( mainWORK_QUEUE_BENCHMARK_PRIORITY );
+	}
+	else if( xMutexBenchmark != pdFALSE )
+	{
+		vStartMutexBenchmark( mainMUTEX_BENCHMARK_PRIORITY );
+	}
+	else if( xQueueSetBenchmark != pdFALSE )
+	{
+		vStartQueueSetBenchmark( mainQUEUE_SET_BENCHMARK_PRIORITY );
+	}
+	else if( xMemoryPoolBenchmark != pdFALSE )
+	{
+		vStartMemoryPoolBenchmark( mainMEMORY_POOL_BENCHMARK_PRIORITY );
+	}
+	else if( xRegistryBenchmark != pdFALSE )
+	{
+		vStartRegistryBenchmark( mainREGISTRY_BENCHMARK_PRIORITY );
+	}
+	else if( xEDFBenchmark != pdFALSE )
+	{
+		vStartEDFBenchmark( mainEDF_BENCHMARK_PRIORITY );
+	}
+	else
+	{
+		/* Must run before any other kernel objects are created. */
+		vRunAllocationBenchmark();
+
+		/* Start the standard demo tasks. */
+		vStartBlockingQueueTasks( mainBLOCK_Q_PRIORITY );
+		vCreateBlockTimeTasks();
+		vStartCountingSemaphoreTasks();
+		vStartDynamicPriorityTasks();
+		vStartMathTasks( mainFLOP_TASK_PRIORITY );
+		vStartGenericQueueTasks( mainGEN_QUEUE_TASK_PRIORITY );
+		vStartIntegerMathTasks( mainINTEGER_TASK_PRIORITY );
+		vStartPolledQueueTasks( mainQUEUE_POLL_PRIORITY );
+		vStartQueuePeekTasks();
+		vStartQueueOverwriteTask( mainQUEUE_OVERWRITE_PRIORITY );
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+		{
+			/* A queue set that holds a list of its ready members does not keep
+			the order in which data was sent to different members, which
+			QueueSet.c checks, so the order it does keep is checked instead. */
+			vStartQueueSetReadyListTasks();
+		}
+		#else
+		{
+			vStartQueueSetTasks();
+		}
+		#endif /* configUSE_QUEUE_SET_READY_LIST */
+		vStartRecursiveMutexTasks();
+		vStartSemaphoreTasks( mainSEM_TEST_PRIORITY );
+		vStartTimerDemoTask( mainTIMER_TEST_PERIOD );
+		vStartEventGroupTasks();
+		vStartTaskNotifyTask();
+		vStartStreamBufferTasks();
+		vStartStaticallyAllocatedTasks();
+
+		#if( configUSE_HEAP_PLACEMENT_HINTS == 1 )
+		{
+			vStartRegionHeapDemo( mainREGION_HEAP_DEMO_PRIORITY );
+		}
+		#endif
+
+		/* Create the latency measurement task and start the benchmarks. */
+		xTaskCreate( prvTickLatencyTask, "TickLat", configMINIMAL_STACK_SIZE, NULL, mainLATENCY_TASK_PRIORITY, NULL );
+		vStartNotifyBenchmark( mainBENCHMARK_PRIORITY );
+		vStartEventGroupBenchmark( mainEVENT_GROUP_BENCHMARK_PRIORITY );
+		vStartRingQueueBenchmark( mainRING_QUEUE_BENCHMARK_PRIORITY );
+		vStartStreamBenchmark( mainBENCHMARK_PRIORITY );
+		vStartZeroCopyBenchmark( mainBENCHMARK_PRIORITY );
+		vStartTimerBenchmark( mainTIMER_BENCHMARK_PRIORITY );
+	}
+
+	/* Create the check task. */
+	xTaskCreate( prvCheckTask, "Check", configMINIMAL_STACK_SIZE, NULL, mainCHECK_TASK_PRIORITY, NULL );
+
+	/* The tick wrap task needs time to block before the tick count reaches
+	mainWRAP_DELAY ticks before the overflow. */
+	if( xTicksToWrap > ( mainWRAP_DELAY * ( TickType_t ) 2 ) )
+	{
+		xTaskCreate( prvTickWrapTask, "TickWrap", configMINIMAL_STACK_SIZE, NULL, mainWRAP_TASK_PRIORITY, NULL );
+	}
+
+	if( ( xLowPowerDemo == pdFALSE ) && ( xDelayBenchmark == pdFALSE ) && ( xChurnBenchmark == pdFALSE ) && ( xSwitchBenchmark == pdFALSE ) && ( xCoRoutineBenchmark == pdFALSE ) && ( xWorkQueueBenchmark == pdFALSE ) && ( xMutexBenchmark == pdFALSE ) && ( xQueueSetBenchmark == pdFALSE ) && ( xMemoryPoolBenchmark == pdFALSE ) && ( xRegistryBenchmark == pdFALSE ) && ( xEDFBenchmark == pdFALSE ) )
+	{
+		/* The suicide tasks must be created last as they need to know how many
+		tasks were running prior to their creation in order to ascertain whether
+		or not the correct/expected number of tasks are running at any given
+		time. */
+		vCreateSuicidalTasks( mainCREATOR_TASK_PRIORITY );
+	}
+
+	/* Everything allocated from here on should be freed by the time the
+	scheduler is ended, other than by the tasks that never exit. */
+	vHeapMonitorSetMark();
+
+	/* Start the scheduler.  This only returns when the check task calls
+	vTaskEndScheduler(), at which point all the task threads are parked and
+	the host library can be used freely again. */
+	vTaskStartScheduler();
+
+	if( xLowPowerDemo != pdFALSE )
+	{
+		vLowPowerDemoPrintResults();
+	}
+	else if( xDelayBenchmark != pdFALSE )
+	{
+		vDelayBenchmarkPrintResults();
+	}
+	else if( xChurnBenchmark != pdFALSE )
+	{
+		vChurnBenchmarkPrintResults();
+	}
+	else if( xSwitchBenchmark != pdFALSE )
+	{
+		vSwitchBenchmarkPrintResults();
+	}
+	else if( xCoRoutineBenchmark != pdFALSE )
+	{
+		vCoRoutineBenchmarkPrintResults();
+	}
+	else if( xWorkQueueBenchmark != pdFALSE )
+	{
+		vWorkQueueBenchmarkPrintResults();
+	}
+	else if( xMutexBenchmark != pdFALSE )
+	{
+		vMutexBenchmarkPrintResults();
+	}
+	else if( xQueueSetBenchmark != pdFALSE )
+	{
+		vQueueSetBenchmarkPrintResults();
+	}
+	else if( xMemoryPoolBenchmark != pdFALSE )
+	{
+		vMemoryPoolBenchmarkPrintResults();
+	}
+	else if( xRegistryBenchmark != pdFALSE )
+	{
+		vRegistryBenchmarkPrintResults();
+	}
+	else if( xEDFBenchmark != pdFALSE )
+	{
+		vEDFBenchmarkPrintResults();
+	}
+	else
+	{
+		vBenchmarkPrintStats( &xTickToTaskJitter );
+		vNotifyBenchmarkPrintResults();
+		vEventGroupBenchmarkPrintResults();
+		vRingQueueBenchmarkPrintResults();
+		vStreamBenchmarkPrintResults();
+		vZeroCopyBenchmarkPrintResults();
+		vTimerBenchmarkPrintResults();
+		vAllocationBenchmarkPrintResults();
+		vHeapBenchmarkSaveTrace();
+
+		#if( configUSE_HEAP_PLACEMENT_HINTS == 1 )
+		{
+			vRegionHeapDemoPrintResults();
+		}
+		#endif
+
+		if( xTraceDemo != pdFALSE )
+		{
+			vTraceBenchmarkPrintResults();
+		}
+	}
+
+	if( xHeapMonitorSaveDump( mainHEAP_MONITOR_FILE_NAME ) != pdFAIL )
+	{
+		( void ) xHeapMonitorDecodeFile( mainHEAP_MONITOR_FILE_NAME );
+	}
+
+	if( ulErrorCount == 0UL )
+	{
+		printf( "PASS: %lu seconds, %lu ticks, no errors\r\n", ( unsigned long ) ulRunTimeSeconds, ( unsigned long ) ( TickType_t ) ( xTaskGetTickCount() - ( TickType_t ) configINITIAL_TICK_COUNT ) );
+	}
+	else
+	{
+		printf( "FAIL: %lu errors\r\n", ( unsigned long ) ulErrorCount );
+	}
+
+	return ( ulErrorCount == 0UL ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCheckTask( void *pvParameters )
+{
+TickType_t xNextWakeTime;
+const TickType_t xRunTime = ( TickType_t ) ( ulRunTimeSeconds * configTICK_RATE_HZ );
+TickType_t xElapsedTime;
+const char *pcStatusMessage;
+
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	/* Initialise xNextWakeTime - this only needs to be done once. */
+	xNextWakeTime = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		/* Place this task in the blocked state until it is time to run again. */
+		vTaskDelayUntil( &xNextWakeTime, mainCHECK_PERIOD );
+
+		pcStatusMessage = NULL;
+
+		/* The tick count does not start from 0, so is compared with the tick
+		count the scheduler was started with. */
+		xElapsedTime = xTaskGetTickCount() - ( TickType_t ) configINITIAL_TICK_COUNT;
+
+		/* Check the demo tasks are running without error. */
+		if( ( xTicksToWrap > ( mainWRAP_DELAY * ( TickType_t ) 2 ) ) && ( xElapsedTime >= ( xTicksToWrap + mainCHECK_PERIOD ) ) && ( xTickWrapped == pdFALSE ) )
+		{
+			pcStatusMessage = "Error: TickWrap";
+		}
+		else if( xLowPowerDemo != pdFALSE )
+		{
+			if( xAreLowPowerDemoTasksStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: LowPower";
+			}
+		}
+		else if( xDelayBenchmark != pdFALSE )
+		{
+			if( xIsDelayBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: DelayBenchmark";
+			}
+		}
+		else if( xChurnBenchmark != pdFALSE )
+		{
+			if( xIsChurnBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: ChurnBenchmark";
+			}
+		}
+		else if( xSwitchBenchmark != pdFALSE )
+		{
+			if( xIsSwitchBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: SwitchBenchmark";
+			}
+		}
+		else if( xCoRoutineBenchmark != pdFALSE )
+		{
+			if( xIsCoRoutineBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: CoRoutineBenchmark";
+			}
+		}
+		else if( xWorkQueueBenchmark != pdFALSE )
+		{
+			if( xIsWorkQueueBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: WorkQueueBenchmark";
+			}
+		}
+		else if( xMutexBenchmark != pdFALSE )
+		{
+			if( xIsMutexBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: MutexBenchmark";
+			}
+		}
+		else if( xQueueSetBenchmark != pdFALSE )
+		{
+			if( xIsQueueSetBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: QueueSetBenchmark";
+			}
+		}
+		else if( xMemoryPoolBenchmark != pdFALSE )
+		{
+			if( xIsMemoryPoolBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: MemoryPoolBenchmark";
+			}
+		}
+		else if( xRegistryBenchmark != pdFALSE )
+		{
+			if( xIsRegistryBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: RegistryBenchmark";
+			}
+		}
+		else if( xEDFBenchmark != pdFALSE )
+		{
+			if( xIsEDFBenchmarkStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: EDFBenchmark";
+			}
+		}
+		else if( xAreBlockingQueuesStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: BlockQueue";
+		}
+		else if( xAreBlockTimeTestTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: BlockTime";
+		}
+		else if( xAreCountingSemaphoreTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: CountSem";
+		}
+		else if( xAreDynamicPriorityTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: DynamicPriority";
+		}
+		else if( xAreMathsTaskStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: Flop";
+		}
+		else if( xAreGenericQueueTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: GenQueue";
+		}
+		else if( xAreIntegerMathsTaskStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: IntMath";
+		}
+		else if( xArePollingQueuesStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: PollQueue";
+		}
+		else if( xAreQueuePeekTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: QueuePeek";
+		}
+		else if( xIsQueueOverwriteTaskStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: QueueOverwrite";
+		}
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+			else if( xAreQueueSetReadyListTasksStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: QueueSetReadyList";
+			}
+		#else
+			else if( xAreQueueSetTasksStillRunning() != pdTRUE )
+			{
+				pcStatusMessage = "Error: QueueSet";
+			}
+		#endif /* configUSE_QUEUE_SET_READY_LIST */
+		else if( xAreRecursiveMutexTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: RecMutex";
+		}
+		else if( xAreSemaphoreTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: SemTest";
+		}
+		else if( xAreTimerDemoTasksStillRunning( mainCHECK_PERIOD ) != pdTRUE )
+		{
+			pcStatusMessage = "Error: TimerDemo";
+		}
+		else if( xAreEventGroupTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: EventGroup";
+		}
+		else if( xAreTaskNotificationTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: TaskNotify";
+		}
+		else if( xAreStreamBufferTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: StreamBuffer";
+		}
+		else if( xAreStaticAllocationTasksStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: StaticAllocation";
+		}
+		else if( xIsEventGroupBenchmarkStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: EventGroupBenchmark";
+		}
+		else if( xIsRingQueueBenchmarkStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: RingQueueBenchmark";
+		}
+		#if( configUSE_HEAP_PLACEMENT_HINTS == 1 )
+		else if( xIsRegionHeapDemoStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: RegionHeap";
+		}
+		#endif
+		else if( xIsCreateTaskStillRunning() != pdTRUE )
+		{
+			pcStatusMessage = "Error: Death";
+		}
+
+		if( pcStatusMessage != NULL )
+		{
+			ulErrorCount++;
+			prvPrintString( pcStatusMessage );
+		}
+		else
+		{
+			prvPrintString( "OK" );
+		}
+
+		if( xElapsedTime >= xRunTime )
+		{
+			vTaskEndScheduler();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickLatencyTask( void *pvParameters )
+{
+TickType_t xNextWakeTime;
+uint64_t ullWakeTime, ullLastWakeTime, ullPeriod;
+
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	xNextWakeTime = xTaskGetTickCount();
+	vTaskDelayUntil( &xNextWakeTime, 1 );
+	ullLastWakeTime = ullBenchmarkGetTimeNs();
+
+	for( ;; )
+	{
+		/* Unblock on every tick, and record how far the time between each
+		wake deviates from one tick period. */
+		vTaskDelayUntil( &xNextWakeTime, 1 );
+		ullWakeTime = ullBenchmarkGetTimeNs();
+		ullPeriod = ullWakeTime - ullLastWakeTime;
+		ullLastWakeTime = ullWakeTime;
+
+		if( ullPeriod > mainNS_PER_TICK )
+		{
+			vBenchmarkAddSample( &xTickToTaskJitter, ullPeriod - mainNS_PER_TICK );
+		}
+		else
+		{
+			vBenchmarkAddSample( &xTickToTaskJitter, mainNS_PER_TICK - ullPeriod );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickWrapTask( void *pvParameters )
+{
+TickType_t xWakeTime;
+
+	/* Just to remove compiler warning. */
+	( void ) pvParameters;
+
+	/* Block until mainWRAP_DELAY ticks before the tick count overflows, then
+	until the overflow itself.  The task must not wake early either time. */
+	xWakeTime = ( TickType_t ) 0U - mainWRAP_DELAY;
+	vTaskDelay( xWakeTime - xTaskGetTickCount() );
+
+	if( ( TickType_t ) ( xTaskGetTickCount() - xWakeTime ) < mainWRAP_DELAY )
+	{
+		vTaskDelay( mainWRAP_DELAY );
+
+		if( xTaskGetTickCount() < mainWRAP_DELAY )
+		{
+			xTickWrapped = pdTRUE;
+		}
+	}
+
+	vTaskSuspend( NULL );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulMainGetRunTimeCounterValue( void )
+{
+	/* One count per microsecond. */
+	return ( uint32_t ) ( ( ullBenchmarkGetTimeNs() - ullStartTime ) / mainNS_PER_US );
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulMainGetTraceTimestamp( void )
+{
+	/* One count per nanosecond, wrapping every 4.3 seconds. */
+	return ( uint32_t ) ( ullBenchmarkGetTimeNs() - ullStartTime );
+}
+/*-----------------------------------------------------------*/
+
+static void prvPrintString( const char *pcString )
+{
+	taskENTER_CRITICAL();
+	{
+		printf( "%s\r\n", pcString );
+		fflush( stdout );
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationTickHook( void )
+{
+	/* The tasks and objects used below are not created by the low power
+	demo or the delayed task, object churn, context switch, co-routine,
+	deferred work, mutex, queue set, memory pool, task snapshot or deadline
+	scheduling benchmarks. */
+	if( ( xLowPowerDemo == pdFALSE ) && ( xDelayBenchmark == pdFALSE ) && ( xChurnBenchmark == pdFALSE ) && ( xSwitchBenchmark == pdFALSE ) && ( xCoRoutineBenchmark == pdFALSE ) && ( xWorkQueueBenchmark == pdFALSE ) && ( xMutexBenchmark == pdFALSE ) && ( xQueueSetBenchmark == pdFALSE ) && ( xMemoryPoolBenchmark == pdFALSE ) && ( xRegistryBenchmark == pdFALSE ) && ( xEDFBenchmark == pdFALSE ) )
+	{
+		/* Call the periodic tests that use the 'from ISR' API functions. */
+		vTimerPeriodicISRTests();
+		vQueueOverwritePeriodicISRDemo();
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+		{
+			vQueueSetReadyListAccessFromISR();
+		}
+		#else
+		{
+			vQueueSetAccessQueueSetFromISR();
+		}
+		#endif /* configUSE_QUEUE_SET_READY_LIST */
+		vPeriodicEventGroupsProcessing();
+		vNotifyTaskFromISR();
+		vPeriodicStreamBufferProcessing();
+
+		/* Call the benchmarks that use the tick as their interrupt source. */
+		vNotifyBenchmarkISR();
+		vRingQueueBenchmarkISR();
+	}
+	else if( xWorkQueueBenchmark != pdFALSE )
+	{
+		vWorkQueueBenchmarkISR();
+	}
+	else if( xMemoryPoolBenchmark != pdFALSE )
+	{
+		vMemoryPoolBenchmarkISR();
+	}
+	else if( xRegistryBenchmark != pdFALSE )
+	{
+		vRegistryBenchmarkISR();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook( void )
+{
+	/* Sleep until the next tick rather than spin, in the same way a real
+	target would wait for an interrupt.  The low power demo leaves the idle task
+	to suppress the tick and sleep for as long as possible instead, which it
+	would not do until after the next tick if it paused here first. */
+	if( xLowPowerDemo == pdFALSE )
+	{
+		pause();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationMallocFailedHook( void )
+{
+	/* vApplicationMallocFailedHook() will only be called if
+	configUSE_MALLOC_FAILED_HOOK is set to 1 in FreeRTOSConfig.h.  It is a hook
+	function that will get called if a call to pvPortMalloc() fails.  The
+	allocations replayed by HeapBenchmark.c are allowed to fail. */
+	if( xHeapBenchmarkIsReplaying() == pdFALSE )
+	{
+		vAssertCalled( __FILE__, __LINE__ );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize )
+{
+/* The idle task's TCB and stack are declared static so they exist after this
+function returns. */
+static StaticTask_t xIdleTaskTCB;
+static StackType_t uxIdleTaskStack[ configMINIMAL_STACK_SIZE ];
+
+	/* configSUPPORT_STATIC_ALLOCATION is set to 1, so the application must
+	provide the memory used by the idle task. */
+	*ppxIdleTaskTCBBuffer = &xIdleTaskTCB;
+	*ppxIdleTaskStackBuffer = uxIdleTaskStack;
+	*pusIdleTaskStackSize = configMINIMAL_STACK_SIZE;
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize )
+{
+/* As above, but for the timer service task. */
+static StaticTask_t xTimerTaskTCB;
+static StackType_t uxTimerTaskStack[ configTIMER_TASK_STACK_DEPTH ];
+
+	*ppxTimerTaskTCBBuffer = &xTimerTaskTCB;
+	*ppxTimerTaskStackBuffer = uxTimerTaskStack;
+	*pusTimerTaskStackSize = configTIMER_TASK_STACK_DEPTH;
+}
+/*-----------------------------------------------------------*/
+
+void vAssertCalled( const char *pcFile, unsigned long ulLine )
+{
+	taskDISABLE_INTERRUPTS();
+	fprintf( stderr, "ASSERT: %s:%lu\r\n", pcFile, ulLine );
+	abort();
+}
+/*-----------------------------------------------------------*/
@@ -67,6 +67,14 @@
 #include "task.h"
 #include "croutine.h"
 
+#if( ( configUSE_CO_ROUTINES != 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	#error Co-routine control blocks are allocated from the heap or provided by the application, so configSUPPORT_DYNAMIC_ALLOCATION or configSUPPORT_STATIC_ALLOCATION must be 1 when configUSE_CO_ROUTINES is 1
+#endif
+
+#if( configMAX_CO_ROUTINE_PRIORITIES > 32 )
+	#error configMAX_CO_ROUTINE_PRIORITIES must be less than or equal to 32, as the ready priorities are held in a 32-bit bitmap.
+#endif
+
 /*
  * Some kernel aware debuggers require data to be viewed to be global, rather
  * than file scope.
@@ -83,15 +91,29 @@ static List_t xDelayedCoRoutineList2;									/*< Delayed co-routines (two lists
 static List_t * pxDelayedCoRoutineList;									/*< Points to the delayed co-routine list currently being used. */
 static List_t * pxOverflowDelayedCoRoutineList;							/*< Points to the delayed co-routine list currently being used to hold co-routines that have overflowed the current tick count. */
 static List_t xPendingReadyCoRoutineList;								/*< Holds co-routines that have been readied by an external event.  They cannot be added directly to the ready lists as the ready lists cannot be accessed by interrupts. */
+static List_t xSuspendedCoRoutineList;									/*< Co-routines waiting without a time out. */
 
 /* Other file private variables. --------------------------------*/
 CRCB_t * pxCurrentCoRoutine = NULL;
-static UBaseType_t uxTopCoRoutineReadyPriority = 0;
+static uint32_t ulReadyCoRoutinePriorities = 0;	/*< Bit n is set while co-routines of priority n might be ready. */
 static TickType_t xCoRoutineTickCount = 0, xLastTickCount = 0, xPassedTicks = 0;
 
 /* The initial state of the co-routine when it is created. */
 #define corINITIAL_STATE	( 0 )
 
+/* Values that can be assigned to the ucNotifyState member of the CRCB. */
+#define corNOT_WAITING_NOTIFICATION	( ( uint8_t ) 0 )
+#define corWAITING_NOTIFICATION		( ( uint8_t ) 1 )
+#define corNOTIFICATION_RECEIVED	( ( uint8_t ) 2 )
+
+/* Returns the highest priority whose bit is set in ulPriorities, which must
+not be zero. */
+#ifdef portCOUNT_LEADING_ZEROS
+	#define corHIGHEST_PRIORITY( ulPriorities )	( ( UBaseType_t ) 31U - ( UBaseType_t ) portCOUNT_LEADING_ZEROS( ( ulPriorities ) ) )
+#else
+	#define corHIGHEST_PRIORITY( ulPriorities )	prvHighestPriority( ( ulPriorities ) )
+#endif
+
 /*
  * Place the co-routine represented by pxCRCB into the appropriate ready queue
  * for the priority.  It is inserted at the end of the list.
@@ -101,10 +123,7 @@ static TickType_t xCoRoutineTickCount = 0, xLastTickCount = 0, xPassedTicks = 0;
  */
 #define prvAddCoRoutineToReadyQueue( pxCRCB )																		\
 {																													\
-	if( pxCRCB->uxPriority > uxTopCoRoutineReadyPriority )															\
-	{																												\
-		uxTopCoRoutineReadyPriority = pxCRCB->uxPriority;															\
-	}																												\
+	ulReadyCoRoutinePriorities |= ( 1UL << ( pxCRCB )->uxPriority );												\
 	vListInsertEnd( ( List_t * ) &( pxReadyCoRoutineLists[ pxCRCB->uxPriority ] ), &( pxCRCB->xGenericListItem ) );	\
 }
 
@@ -132,62 +151,121 @@ static void prvCheckPendingReadyList( void );
  */
 static void prvCheckDelayedList( void );
 
+/*
+ * Fill out a newly allocated co-routine control block, and add it to the ready
+ * list of its priority.
+ */
+static void prvInitialiseNewCoRoutine( CRCB_t *pxCoRoutine, crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex );
+
+/*
+ * Returns the highest bit set in ulPriorities, which must not be zero.  Only
+ * used if the port does not define portCOUNT_LEADING_ZEROS().
+ */
+#ifndef portCOUNT_LEADING_ZEROS
+
+	static UBaseType_t prvHighestPriority( uint32_t ulPriorities );
+
+#endif
+
+/*
+ * Update the notification value of pxCRCB as described by eAction, and move it
+ * to the pending ready list if it is waiting for a notification.  Must be
+ * called with interrupts disabled.
+ */
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	static BaseType_t prvNotify( CRCB_t *pxCRCB, uint32_t ulValue, eNotifyAction eAction );
+
+#endif
+
 /*-----------------------------------------------------------*/
 
-BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex )
-{
-BaseType_t xReturn;
-CRCB_t *pxCoRoutine;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	/* Allocate the memory that will store the co-routine control block. */
-	pxCoRoutine = ( CRCB_t * ) pvPortMalloc( sizeof( CRCB_t ) );
-	if( pxCoRoutine )
+	BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex )
 	{
-		/* If pxCurrentCoRoutine is NULL then this is the first co-routine to
-		be created and the co-routine data structures need initialising. */
-		if( pxCurrentCoRoutine == NULL )
+	BaseType_t xReturn;
+	CRCB_t *pxCoRoutine;
+
+		/* Allocate the memory that will store the co-routine control block. */
+		pxCoRoutine = ( CRCB_t * ) pvPortMalloc( sizeof( CRCB_t ) );
+		if( pxCoRoutine )
 		{
-			pxCurrentCoRoutine = pxCoRoutine;
-			prvInitialiseCoRoutineLists();
+			prvInitialiseNewCoRoutine( pxCoRoutine, pxCoRoutineCode, uxPriority, uxIndex );
+			xReturn = pdPASS;
 		}
-
-		/* Check the priority is within limits. */
-		if( uxPriority >= configMAX_CO_ROUTINE_PRIORITIES )
+		else
 		{
-			uxPriority = configMAX_CO_ROUTINE_PRIORITIES - 1;
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
 		}
 
-		/* Fill out the co-routine control block from the function parameters. */
-		pxCoRoutine->uxState = corINITIAL_STATE;
-		pxCoRoutine->uxPriority = uxPriority;
-		pxCoRoutine->uxIndex = uxIndex;
-		pxCoRoutine->pxCoRoutineFunction = pxCoRoutineCode;
+		return xReturn;
+	}
 
-		/* Initialise all the other co-routine control block parameters. */
-		vListInitialiseItem( &( pxCoRoutine->xGenericListItem ) );
-		vListInitialiseItem( &( pxCoRoutine->xEventListItem ) );
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
 
-		/* Set the co-routine control block as a link back from the ListItem_t.
-		This is so we can get back to the containing CRCB from a generic item
-		in a list. */
-		listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xGenericListItem ), pxCoRoutine );
-		listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xEventListItem ), pxCoRoutine );
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 
-		/* Event lists are always in priority order. */
-		listSET_LIST_ITEM_VALUE( &( pxCoRoutine->xEventListItem ), ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) uxPriority ) );
+	CoRoutineHandle_t xCoRoutineCreateStatic( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex, StaticCoRoutine_t *pxCoRoutineBuffer )
+	{
+		configASSERT( pxCoRoutineBuffer );
 
-		/* Now the co-routine has been initialised it can be added to the ready
-		list at the correct priority. */
-		prvAddCoRoutineToReadyQueue( pxCoRoutine );
+		/* The control block is public, so StaticCoRoutine_t is the control
+		block itself rather than a structure of dummy members. */
+		prvInitialiseNewCoRoutine( ( CRCB_t * ) pxCoRoutineBuffer, pxCoRoutineCode, uxPriority, uxIndex );
 
-		xReturn = pdPASS;
+		return ( CoRoutineHandle_t ) pxCoRoutineBuffer;
 	}
-	else
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewCoRoutine( CRCB_t *pxCoRoutine, crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex )
+{
+	/* If pxCurrentCoRoutine is NULL then this is the first co-routine to be
+	created and the co-routine data structures need initialising. */
+	if( pxCurrentCoRoutine == NULL )
 	{
-		xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+		pxCurrentCoRoutine = pxCoRoutine;
+		prvInitialiseCoRoutineLists();
 	}
 
-	return xReturn;
+	/* Check the priority is within limits. */
+	if( uxPriority >= configMAX_CO_ROUTINE_PRIORITIES )
+	{
+		uxPriority = configMAX_CO_ROUTINE_PRIORITIES - 1;
+	}
+
+	/* Fill out the co-routine control block from the function parameters. */
+	pxCoRoutine->uxState = corINITIAL_STATE;
+	pxCoRoutine->uxPriority = uxPriority;
+	pxCoRoutine->uxIndex = uxIndex;
+	pxCoRoutine->pxCoRoutineFunction = pxCoRoutineCode;
+
+	#if( configUSE_TASK_NOTIFICATIONS == 1 )
+	{
+		pxCoRoutine->ulNotifiedValue = 0UL;
+		pxCoRoutine->ucNotifyState = corNOT_WAITING_NOTIFICATION;
+	}
+	#endif
+
+	/* Initialise all the other co-routine control block parameters. */
+	vListInitialiseItem( &( pxCoRoutine->xGenericListItem ) );
+	vListInitialiseItem( &( pxCoRoutine->xEventListItem ) );
+
+	/* Set the co-routine control block as a link back from the ListItem_t.
+	This is so we can get back to the containing CRCB from a generic item
+	in a list. */
+	listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xGenericListItem ), pxCoRoutine );
+	listSET_LIST_ITEM_OWNER( &( pxCoRoutine->xEventListItem ), pxCoRoutine );
+
+	/* Event lists are always in priority order. */
+	listSET_LIST_ITEM_VALUE( &( pxCoRoutine->xEventListItem ), ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) uxPriority ) );
+
+	/* Now the co-routine has been initialised it can be added to the ready
+	list at the correct priority. */
+	prvAddCoRoutineToReadyQueue( pxCoRoutine );
 }
 /*-----------------------------------------------------------*/
 
@@ -201,13 +279,20 @@ TickType_t xTimeToWake;
 
 	/* We must remove ourselves from the ready list before adding
 	ourselves to the blocked list as the same list item is used for
-	both lists. */
+	both lists.  The bit of the ready list's priority is left set, and
+	is cleared by vCoRoutineSchedule() if the list is found to be empty. */
 	( void ) uxListRemove( ( ListItem_t * ) &( pxCurrentCoRoutine->xGenericListItem ) );
 
 	/* The list item will be inserted in wake time order. */
 	listSET_LIST_ITEM_VALUE( &( pxCurrentCoRoutine->xGenericListItem ), xTimeToWake );
 
-	if( xTimeToWake < xCoRoutineTickCount )
+	if( xTicksToDelay == portMAX_DELAY )
+	{
+		/* Wait indefinitely, rather than until the wake time calculated
+		from portMAX_DELAY. */
+		vListInsertEnd( &xSuspendedCoRoutineList, &( pxCurrentCoRoutine->xGenericListItem ) );
+	}
+	else if( xTimeToWake < xCoRoutineTickCount )
 	{
 		/* Wake time has overflowed.  Place this item in the
 		overflow list. */
@@ -312,26 +397,38 @@ CRCB_t *pxCRCB;
 
 void vCoRoutineSchedule( void )
 {
+UBaseType_t uxTopPriority;
+
 	/* See if any co-routines readied by events need moving to the ready lists. */
 	prvCheckPendingReadyList();
 
 	/* See if any delayed co-routines have timed out. */
 	prvCheckDelayedList();
 
-	/* Find the highest priority queue that contains ready co-routines. */
-	while( listLIST_IS_EMPTY( &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) ) )
+	/* Find the highest priority queue that contains ready co-routines.  The
+	bit of a priority is only cleared once its list is found to be empty, so
+	this takes the same time however many priorities there are. */
+	for( ;; )
 	{
-		if( uxTopCoRoutineReadyPriority == 0 )
+		if( ulReadyCoRoutinePriorities == 0UL )
 		{
 			/* No more co-routines to check. */
 			return;
 		}
-		--uxTopCoRoutineReadyPriority;
+
+		uxTopPriority = corHIGHEST_PRIORITY( ulReadyCoRoutinePriorities );
+
+		if( listLIST_IS_EMPTY( &( pxReadyCoRoutineLists[ uxTopPriority ] ) ) == pdFALSE )
+		{
+			break;
+		}
+
+		ulReadyCoRoutinePriorities &= ~( 1UL << uxTopPriority );
 	}
 
 	/* listGET_OWNER_OF_NEXT_ENTRY walks through the list, so the co-routines
 	 of the	same priority get an equal share of the processor time. */
-	listGET_OWNER_OF_NEXT_ENTRY( pxCurrentCoRoutine, &( pxReadyCoRoutineLists[ uxTopCoRoutineReadyPriority ] ) );
+	listGET_OWNER_OF_NEXT_ENTRY( pxCurrentCoRoutine, &( pxReadyCoRoutineLists[ uxTopPriority ] ) );
 
 	/* Call the co-routine. */
 	( pxCurrentCoRoutine->pxCoRoutineFunction )( pxCurrentCoRoutine, pxCurrentCoRoutine->uxIndex );
@@ -352,6 +449,7 @@ UBaseType_t uxPriority;
 	vListInitialise( ( List_t * ) &xDelayedCoRoutineList1 );
 	vListInitialise( ( List_t * ) &xDelayedCoRoutineList2 );
 	vListInitialise( ( List_t * ) &xPendingReadyCoRoutineList );
+	vListInitialise( &xSuspendedCoRoutineList );
 
 	/* Start with pxDelayedCoRoutineList using list1 and the
 	pxOverflowDelayedCoRoutineList using list2. */
@@ -383,4 +481,276 @@ BaseType_t xReturn;
 
 	return xReturn;
 }
+/*-----------------------------------------------------------*/
+
+BaseType_t xCoRoutineRemoveFromUnorderedEventList( ListItem_t *pxEventListItem, const TickType_t xItemValue )
+{
+CRCB_t *pxUnblockedCRCB;
+BaseType_t xReturn;
+
+	/* This function is called with interrupts disabled.  It can only access
+	event lists and the pending ready list.  Store the new item value, which
+	the co-routine reads when it runs again. */
+	listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue );
+
+	pxUnblockedCRCB = ( CRCB_t * ) listGET_LIST_ITEM_OWNER( pxEventListItem );
+	( void ) uxListRemove( pxEventListItem );
+	vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), pxEventListItem );
+
+	if( pxUnblockedCRCB->uxPriority >= pxCurrentCoRoutine->uxPriority )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
 
+void vCoRoutineDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
+{
+TickType_t xTimeToWake;
+const TickType_t xConstTickCount = xCoRoutineTickCount;
+BaseType_t xShouldDelay = pdFALSE;
+
+	configASSERT( pxPreviousWakeTime );
+	configASSERT( xTimeIncrement < portMAX_DELAY );
+
+	/* Generate the tick time at which the co-routine wants to wake. */
+	xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+
+	if( xConstTickCount < *pxPreviousWakeTime )
+	{
+		/* The tick count has overflowed since this function was last called.
+		In this case the only time we should ever actually delay is if the wake
+		time has also overflowed, and the wake time is greater than the tick
+		time. */
+		if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
+		{
+			xShouldDelay = pdTRUE;
+		}
+	}
+	else
+	{
+		/* The tick time has not overflowed.  In this case we will delay if
+		either the wake time has overflowed, and/or the tick time is less than
+		the wake time. */
+		if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+		{
+			xShouldDelay = pdTRUE;
+		}
+	}
+
+	/* Update the wake time ready for the next call. */
+	*pxPreviousWakeTime = xTimeToWake;
+
+	if( xShouldDelay != pdFALSE )
+	{
+		vCoRoutineAddToDelayedList( xTimeToWake - xConstTickCount, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	static BaseType_t prvNotify( CRCB_t *pxCRCB, uint32_t ulValue, eNotifyAction eAction )
+	{
+	uint8_t ucOriginalNotifyState;
+	BaseType_t xReturn = pdPASS;
+
+		/* Called with interrupts disabled, as the pending ready list can be
+		accessed by interrupts. */
+		ucOriginalNotifyState = pxCRCB->ucNotifyState;
+		pxCRCB->ucNotifyState = corNOTIFICATION_RECEIVED;
+
+		switch( eAction )
+		{
+			case eSetBits	:
+				pxCRCB->ulNotifiedValue |= ulValue;
+				break;
+
+			case eIncrement	:
+				( pxCRCB->ulNotifiedValue )++;
+				break;
+
+			case eSetValueWithOverwrite	:
+				pxCRCB->ulNotifiedValue = ulValue;
+				break;
+
+			case eSetValueWithoutOverwrite :
+				if( ucOriginalNotifyState != corNOTIFICATION_RECEIVED )
+				{
+					pxCRCB->ulNotifiedValue = ulValue;
+				}
+				else
+				{
+					/* The value could not be written to the co-routine. */
+					xReturn = pdFAIL;
+				}
+				break;
+
+			case eNoAction:
+				/* The co-routine is being notified without its notify value
+				being updated. */
+				break;
+		}
+
+		/* If the co-routine is blocked specifically to wait for a notification
+		then ready it in the same way as if the event were caused from within an
+		interrupt.  It is not on an event list, so its event list item is free
+		to be placed in the pending ready list. */
+		if( ucOriginalNotifyState == corWAITING_NOTIFICATION )
+		{
+			configASSERT( listLIST_ITEM_CONTAINER( &( pxCRCB->xEventListItem ) ) == NULL );
+			vListInsertEnd( ( List_t * ) &( xPendingReadyCoRoutineList ), &( pxCRCB->xEventListItem ) );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xCoRoutineNotify( CoRoutineHandle_t xCoRoutineToNotify, uint32_t ulValue, eNotifyAction eAction )
+	{
+	BaseType_t xReturn;
+
+		configASSERT( xCoRoutineToNotify );
+
+		taskENTER_CRITICAL();
+		{
+			xReturn = prvNotify( ( CRCB_t * ) xCoRoutineToNotify, ulValue, eAction );
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xCoRoutineNotifyFromISR( CoRoutineHandle_t xCoRoutineToNotify, uint32_t ulValue, eNotifyAction eAction )
+	{
+	BaseType_t xReturn;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xCoRoutineToNotify );
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			xReturn = prvNotify( ( CRCB_t * ) xCoRoutineToNotify, ulValue, eAction );
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xCoRoutineNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn;
+
+		/* A critical section is required to prevent a notification arriving
+		between the check for a pending notification and blocking. */
+		portDISABLE_INTERRUPTS();
+		{
+			if( pxCurrentCoRoutine->ucNotifyState != corNOTIFICATION_RECEIVED )
+			{
+				/* Clear bits in the notification value as the co-routine
+				does not already have a notification pending. */
+				pxCurrentCoRoutine->ulNotifiedValue &= ~ulBitsToClearOnEntry;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					/* As this is called from a co-routine we cannot block
+					directly, but return indicating that we need to block. */
+					pxCurrentCoRoutine->ucNotifyState = corWAITING_NOTIFICATION;
+					vCoRoutineAddToDelayedList( xTicksToWait, NULL );
+					portENABLE_INTERRUPTS();
+					return errQUEUE_BLOCKED;
+				}
+			}
+
+			if( pulNotificationValue != NULL )
+			{
+				/* Output the current notification value, which may or may not
+				have changed. */
+				*pulNotificationValue = pxCurrentCoRoutine->ulNotifiedValue;
+			}
+
+			if( pxCurrentCoRoutine->ucNotifyState == corNOTIFICATION_RECEIVED )
+			{
+				/* A notification was received.  Clear any bits as requested on
+				exit. */
+				pxCurrentCoRoutine->ulNotifiedValue &= ~ulBitsToClearOnExit;
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				/* A notification was not received. */
+				xReturn = pdFALSE;
+			}
+
+			pxCurrentCoRoutine->ucNotifyState = corNOT_WAITING_NOTIFICATION;
+		}
+		portENABLE_INTERRUPTS();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#ifndef portCOUNT_LEADING_ZEROS
+
+	static UBaseType_t prvHighestPriority( uint32_t ulPriorities )
+	{
+	UBaseType_t uxPriority = ( UBaseType_t ) 0U;
+
+		/* Halve the width searched each time, so the time taken does not
+		depend on which bits are set. */
+		if( ( ulPriorities & 0xffff0000UL ) != 0UL )
+		{
+			uxPriority += ( UBaseType_t ) 16U;
+			ulPriorities >>= 16U;
+		}
+
+		if( ( ulPriorities & 0x0000ff00UL ) != 0UL )
+		{
+			uxPriority += ( UBaseType_t ) 8U;
+			ulPriorities >>= 8U;
+		}
+
+		if( ( ulPriorities & 0x000000f0UL ) != 0UL )
+		{
+			uxPriority += ( UBaseType_t ) 4U;
+			ulPriorities >>= 4U;
+		}
+
+		if( ( ulPriorities & 0x0000000cUL ) != 0UL )
+		{
+			uxPriority += ( UBaseType_t ) 2U;
+			ulPriorities >>= 2U;
+		}
+
+		if( ( ulPriorities & 0x00000002UL ) != 0UL )
+		{
+			uxPriority += ( UBaseType_t ) 1U;
+		}
+
+		return uxPriority;
+	}
+
+#endif /* portCOUNT_LEADING_ZEROS */
+/*-----------------------------------------------------------*/
@@ -77,6 +77,10 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "event_groups.h"
 
+#if ( configUSE_CO_ROUTINES == 1 )
+	#include "croutine.h"
+#endif
+
 /* Lint e961 and e750 are suppressed as a MISRA exception justified because the
 MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
 header files above, but not in this file, in order to generate the correct
@@ -99,22 +103,48 @@ taskEVENT_LIST_ITEM_VALUE_IN_USE definition. */
 	#define eventUNBLOCKED_DUE_TO_BIT_SET	0x0200U
 	#define eventWAIT_FOR_ALL_BITS			0x0400U
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff00U
+	#define eventNUMBER_OF_BITS				8
 #else
 	#define eventCLEAR_EVENTS_ON_EXIT_BIT	0x01000000UL
 	#define eventUNBLOCKED_DUE_TO_BIT_SET	0x02000000UL
 	#define eventWAIT_FOR_ALL_BITS			0x04000000UL
 	#define eventEVENT_BITS_CONTROL_BYTES	0xff000000UL
+	#define eventNUMBER_OF_BITS				24
+#endif
+
+#if( ( configEVENT_GROUP_WAIT_LISTS < 1 ) || ( configEVENT_GROUP_WAIT_LISTS > eventNUMBER_OF_BITS ) )
+	#error configEVENT_GROUP_WAIT_LISTS must be between 1 and the number of bits in an event group.
 #endif
 
+/* The tasks waiting for bits are divided between configEVENT_GROUP_WAIT_LISTS
+lists, so setting bits only has to test the tasks on the lists of those bits,
+rather than every task waiting on the event group.  Bit n belongs to list
+( n % configEVENT_GROUP_WAIT_LISTS ), so with one list per bit only the tasks
+that might be unblocked are tested.  See prvGetWaitList(). */
+#define eventWAIT_LIST_INDEX( uxBit )	( ( uxBit ) % ( UBaseType_t ) configEVENT_GROUP_WAIT_LISTS )
+
 typedef struct xEventGroupDefinition
 {
 	EventBits_t uxEventBits;
-	List_t xTasksWaitingForBits;		/*< List of tasks waiting for a bit to be set. */
+	List_t xTasksWaitingForBits[ configEVENT_GROUP_WAIT_LISTS ];	/*< Lists of tasks waiting for a bit to be set. */
+
+	#if( configEVENT_GROUP_WAIT_LISTS > 1 )
+		List_t xTasksWaitingForAnyBits;	/*< Tasks waiting for any one of a number of bits that do not all belong to the same list. */
+		EventBits_t uxAnyBitsWaitedFor;	/*< Includes all the bits waited for by the tasks in xTasksWaitingForAnyBits. */
+	#endif
+
+	#if( configUSE_CO_ROUTINES == 1 )
+		List_t xCoRoutinesWaitingForBits;	/*< Co-routines waiting for bits to be set - see xEventGroupCRWaitBits(). */
+	#endif
 
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t uxEventGroupNumber;
 	#endif
 
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucStaticallyAllocated; /*< Set to pdTRUE if the event group is statically allocated to ensure no attempt is made to free the memory. */
+	#endif
+
 } EventGroup_t;
 
 /*-----------------------------------------------------------*/
@@ -129,26 +159,142 @@ typedef struct xEventGroupDefinition
  */
 static BaseType_t prvTestWaitCondition( const EventBits_t uxCurrentEventBits, const EventBits_t uxBitsToWaitFor, const BaseType_t xWaitForAllBits );
 
+/*
+ * Initialise the lists of tasks waiting for bits in a newly created event
+ * group.
+ */
+static void prvInitialiseWaitLists( EventGroup_t *pxEventBits );
+
+/*
+ * Return the list a task that waits for uxBitsWaitedFor, with the control bits
+ * uxControlBits, is placed on when it blocks:
+ *
+ *   + A task waiting for all its bits cannot be unblocked until each of its
+ *     bits that is clear has been set, so it only needs to be tested when one
+ *     of those is set.  It is placed on the list of the lowest of its bits
+ *     that is clear, and moved to the list of the next such bit if it is still
+ *     waiting when that bit is set.  Bits that are cleared cannot unblock it,
+ *     so it never has to be moved when bits are cleared.
+ *
+ *   + A task waiting for any one of its bits must be tested when any of them
+ *     is set, so is placed on the list its bits belong to, or on the
+ *     xTasksWaitingForAnyBits list if they belong to more than one list.
+ *
+ * Must be called with the scheduler suspended.
+ */
+static List_t *prvGetWaitList( EventGroup_t *pxEventBits, const EventBits_t uxBitsWaitedFor, const EventBits_t uxControlBits );
+
+/*
+ * Test each task on pxList against the event group's current bits, unblocking
+ * the tasks whose wait condition is met.  Tasks waiting for all their bits
+ * that are not unblocked are moved to the list given by prvGetWaitList().  If
+ * puxBitsStillWaitedFor is not NULL the bits the tasks that remain on the list
+ * wait for are added to it.  Returns the bits to clear because a task that was
+ * unblocked set eventCLEAR_EVENTS_ON_EXIT_BIT.
+ *
+ * Must be called with the scheduler suspended.
+ */
+static EventBits_t prvTestWaitList( EventGroup_t *pxEventBits, List_t *pxList, EventBits_t *puxBitsStillWaitedFor );
+
+/*
+ * Unblock every task on one of the lists of a group that is being deleted.
+ */
+static void prvUnblockAllTasks( const List_t *pxTasksWaitingForBits );
+
+/*
+ * Test each co-routine waiting on the event group against the event group's
+ * current bits, placing the co-routines whose wait condition is met in the
+ * co-routine pending ready list.  Returns the bits to clear because a
+ * co-routine that was readied set eventCLEAR_EVENTS_ON_EXIT_BIT.  The
+ * co-routines are few compared to the tasks, so are not divided between lists
+ * by bit.
+ *
+ * Must be called with the scheduler suspended.
+ */
+#if( configUSE_CO_ROUTINES == 1 )
+
+	static EventBits_t prvTestCoRoutineWaitList( EventGroup_t *pxEventBits );
+
+#endif
+
 /*-----------------------------------------------------------*/
 
-EventGroupHandle_t xEventGroupCreate( void )
-{
-EventGroup_t *pxEventBits;
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 
-	pxEventBits = pvPortMalloc( sizeof( EventGroup_t ) );
-	if( pxEventBits != NULL )
+	EventGroupHandle_t xEventGroupCreateStatic( StaticEventGroup_t *pxEventGroupBuffer )
 	{
-		pxEventBits->uxEventBits = 0;
-		vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
-		traceEVENT_GROUP_CREATE( pxEventBits );
+	EventGroup_t *pxEventBits;
+
+		/* A StaticEventGroup_t object must be provided. */
+		configASSERT( pxEventGroupBuffer );
+
+		/* The StaticEventGroup_t structure must be exactly the same size as the
+		real event group structure, otherwise the application has been built
+		with a different configuration to the kernel. */
+		configASSERT( sizeof( StaticEventGroup_t ) == sizeof( EventGroup_t ) );
+
+		/* The user has provided a statically allocated event group - use it. */
+		pxEventBits = ( EventGroup_t * ) pxEventGroupBuffer; /*lint !e740 EventGroup_t and StaticEventGroup_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+
+		if( pxEventBits != NULL )
+		{
+			pxEventBits->uxEventBits = 0;
+			prvInitialiseWaitLists( pxEventBits );
+
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Both static and dynamic allocation can be used, so note that
+				this event group was created statically in case the event group
+				is later deleted. */
+				pxEventBits->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+			traceEVENT_GROUP_CREATE( pxEventBits );
+		}
+		else
+		{
+			traceEVENT_GROUP_CREATE_FAILED();
+		}
+
+		return ( EventGroupHandle_t ) pxEventBits;
 	}
-	else
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	EventGroupHandle_t xEventGroupCreate( void )
 	{
-		traceEVENT_GROUP_CREATE_FAILED();
+	EventGroup_t *pxEventBits;
+
+		pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) );
+		if( pxEventBits != NULL )
+		{
+			pxEventBits->uxEventBits = 0;
+			prvInitialiseWaitLists( pxEventBits );
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* Both static and dynamic allocation can be used, so note this
+				event group was allocated dynamically in case the event group
+				is later deleted. */
+				pxEventBits->ucStaticallyAllocated = pdFALSE;
+			}
+			#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+			traceEVENT_GROUP_CREATE( pxEventBits );
+		}
+		else
+		{
+			traceEVENT_GROUP_CREATE_FAILED();
+		}
+
+		return ( EventGroupHandle_t ) pxEventBits;
 	}
 
-	return ( EventGroupHandle_t ) pxEventBits;
-}
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 /*-----------------------------------------------------------*/
 
 EventBits_t xEventGroupSync( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, const EventBits_t uxBitsToWaitFor, TickType_t xTicksToWait )
@@ -192,7 +338,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 				/* Store the bits that the calling task is waiting for in the
 				task's event list item so the kernel knows when a match is
 				found.  Then enter the blocked state. */
-				vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+				vTaskPlaceOnUnorderedEventList( prvGetWaitList( pxEventBits, uxBitsToWaitFor, eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
 				/* This assignment is obsolete as uxReturn will get set after
 				the task unblocks, but some compilers mistakenly generate a
@@ -338,7 +484,7 @@ BaseType_t xTimeoutOccurred = pdFALSE;
 			/* Store the bits that the calling task is waiting for in the
 			task's event list item so the kernel knows when a match is
 			found.  Then enter the blocked state. */
-			vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+			vTaskPlaceOnUnorderedEventList( prvGetWaitList( pxEventBits, uxBitsToWaitFor, uxControlBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
 
 			/* This is obsolete as it will get set after the task unblocks, but
 			some compilers mistakenly generate a warning about the variable
@@ -463,86 +609,77 @@ EventBits_t uxReturn;
 
 EventBits_t xEventGroupSetBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet )
 {
-ListItem_t *pxListItem, *pxNext;
-ListItem_t const *pxListEnd;
-List_t *pxList;
-EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+EventBits_t uxBitsToClear = 0, uxBits, uxListsToTest = 0;
+UBaseType_t uxBit;
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-BaseType_t xMatchFound = pdFALSE;
 
 	/* Check the user is not attempting to set the bits used by the kernel
 	itself. */
 	configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-	pxList = &( pxEventBits->xTasksWaitingForBits );
-	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
 	vTaskSuspendAll();
 	{
 		traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-		pxListItem = listGET_HEAD_ENTRY( pxList );
-
 		/* Set the bits. */
 		pxEventBits->uxEventBits |= uxBitsToSet;
 
-		/* See if the new bit value should unblock any tasks. */
-		while( pxListItem != pxListEnd )
+		/* Only the tasks on the lists of the bits being set can be unblocked
+		by the new bit value. */
+		for( uxBits = uxBitsToSet, uxBit = ( UBaseType_t ) 0; uxBits != ( EventBits_t ) 0; uxBits >>= 1, uxBit++ )
 		{
-			pxNext = listGET_NEXT( pxListItem );
-			uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-			xMatchFound = pdFALSE;
-
-			/* Split the bits waited for from the control bits. */
-			uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-			uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
-
-			if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+			if( ( uxBits & ( EventBits_t ) 1 ) != ( EventBits_t ) 0 )
 			{
-				/* Just looking for single bit being set. */
-				if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
-				{
-					xMatchFound = pdTRUE;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				uxListsToTest |= ( EventBits_t ) 1 << eventWAIT_LIST_INDEX( uxBit );
 			}
-			else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+			else
 			{
-				/* All bits are set. */
-				xMatchFound = pdTRUE;
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		for( uxBit = ( UBaseType_t ) 0; uxListsToTest != ( EventBits_t ) 0; uxListsToTest >>= 1, uxBit++ )
+		{
+			if( ( uxListsToTest & ( EventBits_t ) 1 ) != ( EventBits_t ) 0 )
+			{
+				uxBitsToClear |= prvTestWaitList( pxEventBits, &( pxEventBits->xTasksWaitingForBits[ uxBit ] ), NULL );
 			}
 			else
 			{
-				/* Need all bits to be set, but not all the bits were set. */
+				mtCOVERAGE_TEST_MARKER();
 			}
+		}
 
-			if( xMatchFound != pdFALSE )
+		#if( configEVENT_GROUP_WAIT_LISTS > 1 )
+		{
+			/* The bits waited for by the tasks that remain on the list are
+			recalculated as the list is tested.  Tasks that time out do not
+			remove their bits, so uxAnyBitsWaitedFor can include bits no task is
+			waiting for, which only costs an unnecessary test. */
+			if( ( pxEventBits->uxAnyBitsWaitedFor & uxBitsToSet ) != ( EventBits_t ) 0 )
 			{
-				/* The bits match.  Should the bits be cleared on exit? */
-				if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-				{
-					uxBitsToClear |= uxBitsWaitedFor;
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-
-				/* Store the actual event flag value in the task's event list
-				item before removing the task from the event list.  The
-				eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-				that is was unblocked due to its required bits matching, rather
-				than because it timed out. */
-				( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+				pxEventBits->uxAnyBitsWaitedFor = 0;
+				uxBitsToClear |= prvTestWaitList( pxEventBits, &( pxEventBits->xTasksWaitingForAnyBits ), &( pxEventBits->uxAnyBitsWaitedFor ) );
 			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configEVENT_GROUP_WAIT_LISTS */
 
-			/* Move onto the next list item.  Note pxListItem->pxNext is not
-			used here as the list item may have been removed from the event list
-			and inserted into the ready/pending reading list. */
-			pxListItem = pxNext;
+		#if( configUSE_CO_ROUTINES == 1 )
+		{
+			if( listLIST_IS_EMPTY( &( pxEventBits->xCoRoutinesWaitingForBits ) ) == pdFALSE )
+			{
+				uxBitsToClear |= prvTestCoRoutineWaitList( pxEventBits );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
+		#endif /* configUSE_CO_ROUTINES */
 
 		/* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
 		bit was set in the control word. */
@@ -557,21 +694,58 @@ BaseType_t xMatchFound = pdFALSE;
 void vEventGroupDelete( EventGroupHandle_t xEventGroup )
 {
 EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
-const List_t *pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+UBaseType_t uxList;
 
 	vTaskSuspendAll();
 	{
 		traceEVENT_GROUP_DELETE( xEventGroup );
 
-		while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+		for( uxList = ( UBaseType_t ) 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAIT_LISTS; uxList++ )
+		{
+			prvUnblockAllTasks( &( pxEventBits->xTasksWaitingForBits[ uxList ] ) );
+		}
+
+		#if( configEVENT_GROUP_WAIT_LISTS > 1 )
 		{
-			/* Unblock the task, returning 0 as the event list is being deleted
-			and	cannot therefore have any bits set. */
-			configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-			( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+			prvUnblockAllTasks( &( pxEventBits->xTasksWaitingForAnyBits ) );
+		}
+		#endif
+
+		#if( configUSE_CO_ROUTINES == 1 )
+		{
+			/* Ready the waiting co-routines, which also obtain 0 as the event
+			group's value. */
+			taskENTER_CRITICAL();
+			{
+				while( listLIST_IS_EMPTY( &( pxEventBits->xCoRoutinesWaitingForBits ) ) == pdFALSE )
+				{
+					( void ) xCoRoutineRemoveFromUnorderedEventList( listGET_HEAD_ENTRY( &( pxEventBits->xCoRoutinesWaitingForBits ) ), eventUNBLOCKED_DUE_TO_BIT_SET );
+				}
+			}
+			taskEXIT_CRITICAL();
 		}
+		#endif
 
-		vPortFree( pxEventBits );
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+		{
+			/* The event group can only have been allocated dynamically - free
+			it again. */
+			vPortFree( pxEventBits );
+		}
+		#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+		{
+			/* The event group could have been allocated statically or
+			dynamically, so check before attempting to free the memory. */
+			if( pxEventBits->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+			{
+				vPortFree( pxEventBits );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 	}
 	( void ) xTaskResumeAll();
 }
@@ -620,6 +794,362 @@ BaseType_t xWaitConditionMet = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
+static EventBits_t prvTestWaitList( EventGroup_t *pxEventBits, List_t *pxList, EventBits_t *puxBitsStillWaitedFor )
+{
+ListItem_t *pxListItem, *pxNext;
+ListItem_t const *pxListEnd;
+List_t *pxNewList;
+EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+BaseType_t xMatchFound;
+
+	pxListEnd = listGET_END_MARKER( pxList ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+	pxListItem = listGET_HEAD_ENTRY( pxList );
+
+	/* See if the new bit value should unblock any tasks. */
+	while( pxListItem != pxListEnd )
+	{
+		pxNext = listGET_NEXT( pxListItem );
+		uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+		xMatchFound = pdFALSE;
+
+		/* Split the bits waited for from the control bits. */
+		uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+		uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+		if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+		{
+			/* Just looking for single bit being set. */
+			if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+			{
+				xMatchFound = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+		{
+			/* All bits are set. */
+			xMatchFound = pdTRUE;
+		}
+		else
+		{
+			/* Need all bits to be set, but not all the bits were set.  Move
+			the task to the list of a bit that is still clear, unless that
+			bit's list is this one.  The item is not in use by any interrupt
+			as the task is blocked and the scheduler is suspended. */
+			pxNewList = prvGetWaitList( pxEventBits, uxBitsWaitedFor, uxControlBits );
+
+			if( pxNewList != pxList )
+			{
+				( void ) uxListRemove( pxListItem );
+				vListInsertEnd( pxNewList, pxListItem );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xMatchFound != pdFALSE )
+		{
+			/* The bits match.  Should the bits be cleared on exit? */
+			if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+			{
+				uxBitsToClear |= uxBitsWaitedFor;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Store the actual event flag value in the task's event list
+			item before removing the task from the event list.  The
+			eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+			that is was unblocked due to its required bits matching, rather
+			than because it timed out. */
+			( void ) xTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+		}
+		else if( puxBitsStillWaitedFor != NULL )
+		{
+			*puxBitsStillWaitedFor |= uxBitsWaitedFor;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Move onto the next list item.  Note pxListItem->pxNext is not
+		used here as the list item may have been removed from the event list
+		and inserted into the ready/pending reading list, or moved to another
+		wait list. */
+		pxListItem = pxNext;
+	}
+
+	return uxBitsToClear;
+}
+/*-----------------------------------------------------------*/
+
+static List_t *prvGetWaitList( EventGroup_t *pxEventBits, const EventBits_t uxBitsWaitedFor, const EventBits_t uxControlBits )
+{
+EventBits_t uxBits;
+UBaseType_t uxBit = ( UBaseType_t ) 0;
+List_t *pxReturn;
+
+	if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 )
+	{
+		/* The bits still to be set.  The task would not be waiting if there
+		were none. */
+		uxBits = uxBitsWaitedFor & ~( pxEventBits->uxEventBits );
+	}
+	else
+	{
+		uxBits = uxBitsWaitedFor;
+	}
+
+	configASSERT( uxBits != ( EventBits_t ) 0 );
+
+	/* Find the lowest of the bits. */
+	while( ( uxBits & ( EventBits_t ) 1 ) == ( EventBits_t ) 0 )
+	{
+		uxBits >>= 1;
+		uxBit++;
+	}
+
+	pxReturn = &( pxEventBits->xTasksWaitingForBits[ eventWAIT_LIST_INDEX( uxBit ) ] );
+
+	#if( configEVENT_GROUP_WAIT_LISTS > 1 )
+	{
+	const UBaseType_t uxList = eventWAIT_LIST_INDEX( uxBit );
+
+		if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+		{
+			/* Check the rest of the bits belong to the same list. */
+			for( ; uxBits != ( EventBits_t ) 0; uxBits >>= 1, uxBit++ )
+			{
+				if( ( ( uxBits & ( EventBits_t ) 1 ) != ( EventBits_t ) 0 ) && ( eventWAIT_LIST_INDEX( uxBit ) != uxList ) )
+				{
+					pxReturn = &( pxEventBits->xTasksWaitingForAnyBits );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			if( pxReturn == &( pxEventBits->xTasksWaitingForAnyBits ) )
+			{
+				pxEventBits->uxAnyBitsWaitedFor |= uxBitsWaitedFor;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configEVENT_GROUP_WAIT_LISTS */
+
+	return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseWaitLists( EventGroup_t *pxEventBits )
+{
+UBaseType_t uxList;
+
+	for( uxList = ( UBaseType_t ) 0; uxList < ( UBaseType_t ) configEVENT_GROUP_WAIT_LISTS; uxList++ )
+	{
+		vListInitialise( &( pxEventBits->xTasksWaitingForBits[ uxList ] ) );
+	}
+
+	#if( configEVENT_GROUP_WAIT_LISTS > 1 )
+	{
+		vListInitialise( &( pxEventBits->xTasksWaitingForAnyBits ) );
+		pxEventBits->uxAnyBitsWaitedFor = 0;
+	}
+	#endif
+
+	#if( configUSE_CO_ROUTINES == 1 )
+	{
+		vListInitialise( &( pxEventBits->xCoRoutinesWaitingForBits ) );
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnblockAllTasks( const List_t *pxTasksWaitingForBits )
+{
+	while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+	{
+		/* Unblock the task, returning 0 as the event list is being deleted
+		and	cannot therefore have any bits set. */
+		configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
+		( void ) xTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_CO_ROUTINES == 1 )
+
+	static EventBits_t prvTestCoRoutineWaitList( EventGroup_t *pxEventBits )
+	{
+	ListItem_t *pxListItem, *pxNext;
+	ListItem_t const *pxListEnd;
+	EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits;
+
+		/* The co-routine scheduler removes co-routines that time out from the
+		list with interrupts disabled, so the scheduler being suspended is not
+		enough. */
+		taskENTER_CRITICAL();
+		{
+			pxListEnd = listGET_END_MARKER( &( pxEventBits->xCoRoutinesWaitingForBits ) ); /*lint !e826 !e740 The mini list structure is used as the list end to save RAM.  This is checked and valid. */
+			pxListItem = listGET_HEAD_ENTRY( &( pxEventBits->xCoRoutinesWaitingForBits ) );
+
+			while( pxListItem != pxListEnd )
+			{
+				pxNext = listGET_NEXT( pxListItem );
+
+				/* Split the bits waited for from the control bits. */
+				uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+				uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+				uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+				if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsWaitedFor, ( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE ) != pdFALSE )
+				{
+					if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+					{
+						uxBitsToClear |= uxBitsWaitedFor;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* As for a task, the event flag value is stored in the
+					co-routine's event list item, with eventUNBLOCKED_DUE_TO_BIT_SET
+					set so the co-routine knows it did not time out. */
+					( void ) xCoRoutineRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxListItem = pxNext;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return uxBitsToClear;
+	}
+
+#endif /* configUSE_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_CO_ROUTINES == 1 )
+
+	BaseType_t xEventGroupCRWaitBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToWaitFor, const BaseType_t xClearOnExit, const BaseType_t xWaitForAllBits, TickType_t xTicksToWait, EventBits_t *puxBits )
+	{
+	extern CRCB_t *pxCurrentCoRoutine;
+	EventGroup_t *pxEventBits = ( EventGroup_t * ) xEventGroup;
+	ListItem_t * const pxEventListItem = &( pxCurrentCoRoutine->xEventListItem );
+	EventBits_t uxItemValue, uxControlBits = 0;
+	BaseType_t xReturn;
+
+		configASSERT( xEventGroup );
+		configASSERT( puxBits );
+		configASSERT( ( uxBitsToWaitFor & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
+		configASSERT( uxBitsToWaitFor != 0 );
+
+		/* Interrupts are disabled, as in the queue's co-routine functions, to
+		prevent the bits being set between testing them and blocking. */
+		portDISABLE_INTERRUPTS();
+		{
+			/* The control bits are only set in the event list item while the
+			co-routine is blocked on an event group. */
+			uxItemValue = ( EventBits_t ) listGET_LIST_ITEM_VALUE( pxEventListItem );
+
+			if( ( uxItemValue & eventUNBLOCKED_DUE_TO_BIT_SET ) != ( EventBits_t ) 0 )
+			{
+				/* The co-routine was readied by the bits being set, which also
+				cleared the bits if that was requested. */
+				*puxBits = uxItemValue & ~eventEVENT_BITS_CONTROL_BYTES;
+				xReturn = pdPASS;
+			}
+			else if( prvTestWaitCondition( pxEventBits->uxEventBits, uxBitsToWaitFor, xWaitForAllBits ) != pdFALSE )
+			{
+				/* The wait condition is already met - either on entry, or just
+				as the co-routine timed out. */
+				*puxBits = pxEventBits->uxEventBits;
+
+				if( xClearOnExit != pdFALSE )
+				{
+					pxEventBits->uxEventBits &= ~uxBitsToWaitFor;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdPASS;
+			}
+			else if( xTicksToWait > ( TickType_t ) 0 )
+			{
+				if( xClearOnExit != pdFALSE )
+				{
+					uxControlBits |= eventCLEAR_EVENTS_ON_EXIT_BIT;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				if( xWaitForAllBits != pdFALSE )
+				{
+					uxControlBits |= eventWAIT_FOR_ALL_BITS;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* As this is called from a co-routine we cannot block
+				directly, but return indicating that we need to block. */
+				listSET_LIST_ITEM_VALUE( pxEventListItem, ( TickType_t ) ( uxBitsToWaitFor | uxControlBits ) );
+				vCoRoutineAddToDelayedList( xTicksToWait, &( pxEventBits->xCoRoutinesWaitingForBits ) );
+				xReturn = errQUEUE_BLOCKED;
+			}
+			else
+			{
+				/* Either not waiting, or timed out. */
+				*puxBits = pxEventBits->uxEventBits;
+				xReturn = pdFAIL;
+			}
+
+			if( xReturn != errQUEUE_BLOCKED )
+			{
+				/* Restore the value that orders the co-routine in the event
+				lists of queues. */
+				listSET_LIST_ITEM_VALUE( pxEventListItem, ( ( TickType_t ) configMAX_CO_ROUTINE_PRIORITIES - ( TickType_t ) pxCurrentCoRoutine->uxPriority ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portENABLE_INTERRUPTS();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_CO_ROUTINES */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 	BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToSet, BaseType_t *pxHigherPriorityTaskWoken )
 	{
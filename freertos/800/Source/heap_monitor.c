@@ -0,0 +1,539 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include the heap monitor.  This #if is closed at the very bottom of this
+file. */
+#if( configUSE_HEAP_MONITOR == 1 )
+
+/* Used to index the block table. */
+#define heapBLOCK_INDEX_MASK		( ( UBaseType_t ) configHEAP_MONITOR_BLOCKS - ( UBaseType_t ) 1 )
+
+/* Used in place of an owner index when the owner table is full. */
+#define heapNO_OWNER				( ( UBaseType_t ) configHEAP_MONITOR_OWNERS )
+
+/* Spreads the addresses of blocks, which are multiples of portBYTE_ALIGNMENT
+and often close together, across the block table. */
+#define heapHASH_MULTIPLIER			( 0x9E3779B1UL )
+
+/* An entry in the block table. */
+typedef struct HEAP_MONITOR_BLOCK
+{
+	void *pvAddress;						/*< The block's address, or NULL if the entry is not in use. */
+	const void *pvCallSite;					/*< Where the block was allocated from. */
+	size_t xSize;							/*< The size passed to traceMALLOC(). */
+	uint32_t ulSequence;					/*< The sequence number of the allocation. */
+	UBaseType_t uxOwner;					/*< The index of the owner. */
+} HeapMonitorBlock_t;
+
+/* An entry in the owner table.  The counters are held in the form they are
+dumped in. */
+typedef struct HEAP_MONITOR_OWNER
+{
+	TaskHandle_t xTask;						/*< The task, or NULL for the startup owner or once the task has been deleted. */
+	HeapMonitorDumpOwner_t xRecord;			/*< The counters and the name. */
+} HeapMonitorOwner_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the index of the block table entry at which the search for pvAddress
+ * starts.
+ */
+static UBaseType_t prvHomeIndex( const void *pvAddress );
+
+/*
+ * Return the index of the block table entry that holds pvAddress, or of the
+ * empty entry at which the search for it ended.  There is always at least one
+ * empty entry, so the search always ends.
+ */
+static UBaseType_t prvFindBlock( const void *pvAddress );
+
+/*
+ * Empty the block table entry uxIndex, moving later entries of the same run
+ * back so the searches for them still find them.
+ */
+static void prvRemoveBlock( UBaseType_t uxIndex );
+
+/*
+ * Return the index of the owner record of the calling task, claiming an unused
+ * record if it does not have one.  Returns heapNO_OWNER if the table is full.
+ */
+static UBaseType_t prvGetOwner( void );
+
+/*-----------------------------------------------------------*/
+
+/* One entry of the block table is always left empty - see prvFindBlock(). */
+static HeapMonitorBlock_t xBlocks[ configHEAP_MONITOR_BLOCKS ];
+static UBaseType_t uxBlocksInUse = ( UBaseType_t ) 0;
+
+/* The startup owner is in use from the start. */
+static HeapMonitorOwner_t xOwners[ configHEAP_MONITOR_OWNERS ] =
+{
+	{ NULL, { heapMONITOR_OWNER_FLAG_USED, 0UL, 0UL, 0UL, 0UL, "Startup" } }
+};
+
+/* Allocations are numbered from 1, so a mark of 0 means no mark was set. */
+static uint32_t ulSequence = 1UL, ulMarkSequence = 0UL;
+
+static uint32_t ulBlocksDropped = 0UL, ulOwnersDropped = 0UL;
+
+/*-----------------------------------------------------------*/
+
+void vHeapMonitorMalloc( void *pvAddress, size_t xSize, const void *pvCallSite )
+{
+UBaseType_t uxIndex, uxOwner;
+HeapMonitorDumpOwner_t *pxRecord;
+
+	/* Called from within the heap with the scheduler suspended or from a
+	critical section, so the tables cannot be accessed by anything else. */
+	if( pvAddress != NULL )
+	{
+		uxIndex = prvFindBlock( pvAddress );
+
+		/* The block can already be recorded if its free was not seen. */
+		if( xBlocks[ uxIndex ].pvAddress != NULL )
+		{
+			vHeapMonitorFree( pvAddress );
+			uxIndex = prvFindBlock( pvAddress );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxOwner = prvGetOwner();
+
+		if( uxOwner == heapNO_OWNER )
+		{
+			ulOwnersDropped++;
+		}
+		else if( uxBlocksInUse >= heapBLOCK_INDEX_MASK )
+		{
+			ulBlocksDropped++;
+		}
+		else
+		{
+			xBlocks[ uxIndex ].pvAddress = pvAddress;
+			xBlocks[ uxIndex ].pvCallSite = pvCallSite;
+			xBlocks[ uxIndex ].xSize = xSize;
+			xBlocks[ uxIndex ].ulSequence = ulSequence;
+			xBlocks[ uxIndex ].uxOwner = uxOwner;
+			uxBlocksInUse++;
+
+			pxRecord = &( xOwners[ uxOwner ].xRecord );
+			pxRecord->ulLiveBytes += ( uint32_t ) xSize;
+			pxRecord->ulLiveBlocks++;
+			pxRecord->ulAllocations++;
+
+			if( pxRecord->ulLiveBytes > pxRecord->ulMaximumLiveBytes )
+			{
+				pxRecord->ulMaximumLiveBytes = pxRecord->ulLiveBytes;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		ulSequence++;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHeapMonitorFree( void *pvAddress )
+{
+UBaseType_t uxIndex, uxOwner;
+HeapMonitorDumpOwner_t *pxRecord;
+
+	if( pvAddress != NULL )
+	{
+		uxIndex = prvFindBlock( pvAddress );
+
+		/* Blocks that were dropped are not in the table. */
+		if( xBlocks[ uxIndex ].pvAddress != NULL )
+		{
+			pxRecord = &( xOwners[ xBlocks[ uxIndex ].uxOwner ].xRecord );
+			pxRecord->ulLiveBytes -= ( uint32_t ) xBlocks[ uxIndex ].xSize;
+			pxRecord->ulLiveBlocks--;
+			prvRemoveBlock( uxIndex );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* A task's handle is the address of its TCB, so the task has been
+		deleted if the block is the TCB of an owner.  The owner record is kept
+		so the memory the task did not free is still reported against it. */
+		for( uxOwner = ( UBaseType_t ) 1; uxOwner < ( UBaseType_t ) configHEAP_MONITOR_OWNERS; uxOwner++ )
+		{
+			if( xOwners[ uxOwner ].xTask == ( TaskHandle_t ) pvAddress )
+			{
+				xOwners[ uxOwner ].xTask = NULL;
+				xOwners[ uxOwner ].xRecord.ulFlags |= heapMONITOR_OWNER_FLAG_DELETED;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vHeapMonitorSetMark( void )
+{
+	vTaskSuspendAll();
+	{
+		ulMarkSequence = ulSequence;
+	}
+	( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxHeapMonitorGetFragmentation( void )
+{
+size_t xFreeBytes, xLargestFreeBlock;
+UBaseType_t uxReturn = ( UBaseType_t ) 0;
+
+	vTaskSuspendAll();
+	{
+		xFreeBytes = xPortGetFreeHeapSize();
+		xLargestFreeBlock = xPortGetLargestFreeBlockSize();
+	}
+	( void ) xTaskResumeAll();
+
+	/* Fragmentation is the percentage of the free space that cannot be
+	allocated as one block.  The largest free block can include a block header
+	the free space does not, so can be slightly larger than the free space. */
+	if( xFreeBytes >= ( size_t ) 100 )
+	{
+		xLargestFreeBlock /= ( xFreeBytes / ( size_t ) 100 );
+
+		if( xLargestFreeBlock < ( size_t ) 100 )
+		{
+			uxReturn = ( UBaseType_t ) ( ( size_t ) 100 - xLargestFreeBlock );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xHeapMonitorGetLiveBytes( void )
+{
+UBaseType_t uxOwner;
+size_t xReturn = ( size_t ) 0;
+
+	vTaskSuspendAll();
+	{
+		uxOwner = prvGetOwner();
+
+		if( uxOwner != heapNO_OWNER )
+		{
+			xReturn = ( size_t ) xOwners[ uxOwner ].xRecord.ulLiveBytes;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xHeapMonitorDump( void *pvBuffer, size_t xBufferSize )
+{
+HeapMonitorDumpHeader_t xHeader;
+HeapMonitorDumpBlock_t xBlock;
+uint8_t *pucBuffer = ( uint8_t * ) pvBuffer;
+size_t xWritten = ( size_t ) 0;
+UBaseType_t uxIndex, uxOwner;
+
+	configASSERT( pvBuffer );
+
+	if( xBufferSize >= ( sizeof( HeapMonitorDumpHeader_t ) + sizeof( xOwners[ 0 ].xRecord ) * ( size_t ) configHEAP_MONITOR_OWNERS ) )
+	{
+		/* Calculated first, as it suspends the scheduler itself. */
+		xHeader.ulFragmentation = ( uint32_t ) uxHeapMonitorGetFragmentation();
+
+		vTaskSuspendAll();
+		{
+			/* The header is written last, once the number of blocks that fit
+			is known. */
+			xWritten = sizeof( HeapMonitorDumpHeader_t );
+
+			for( uxOwner = ( UBaseType_t ) 0; uxOwner < ( UBaseType_t ) configHEAP_MONITOR_OWNERS; uxOwner++ )
+			{
+				memcpy( &( pucBuffer[ xWritten ] ), &( xOwners[ uxOwner ].xRecord ), sizeof( HeapMonitorDumpOwner_t ) );
+				xWritten += sizeof( HeapMonitorDumpOwner_t );
+			}
+
+			xHeader.ulBlockCount = 0UL;
+
+			for( uxIndex = ( UBaseType_t ) 0; ( uxIndex < ( UBaseType_t ) configHEAP_MONITOR_BLOCKS ) && ( ( xWritten + sizeof( HeapMonitorDumpBlock_t ) ) <= xBufferSize ); uxIndex++ )
+			{
+				if( xBlocks[ uxIndex ].pvAddress != NULL )
+				{
+					xBlock.ullAddress = ( uint64_t ) ( portPOINTER_SIZE_TYPE ) xBlocks[ uxIndex ].pvAddress;
+					xBlock.ullCallSite = ( uint64_t ) ( portPOINTER_SIZE_TYPE ) xBlocks[ uxIndex ].pvCallSite;
+					xBlock.ulSize = ( uint32_t ) xBlocks[ uxIndex ].xSize;
+					xBlock.ulSequence = xBlocks[ uxIndex ].ulSequence;
+					xBlock.ulOwner = ( uint32_t ) xBlocks[ uxIndex ].uxOwner;
+					xBlock.ulReserved = 0UL;
+
+					memcpy( &( pucBuffer[ xWritten ] ), &xBlock, sizeof( HeapMonitorDumpBlock_t ) );
+					xWritten += sizeof( HeapMonitorDumpBlock_t );
+					xHeader.ulBlockCount++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			xHeader.ulMagic = heapMONITOR_MAGIC;
+			xHeader.ulVersion = heapMONITOR_VERSION;
+			xHeader.ulOwnerCount = ( uint32_t ) configHEAP_MONITOR_OWNERS;
+			xHeader.ulSequence = ulSequence;
+			xHeader.ulMarkSequence = ulMarkSequence;
+			xHeader.ulBlocksDropped = ulBlocksDropped;
+			xHeader.ulOwnersDropped = ulOwnersDropped;
+			xHeader.ulFreeBytes = ( uint32_t ) xPortGetFreeHeapSize();
+			xHeader.ulMinimumEverFreeBytes = ( uint32_t ) xPortGetMinimumEverFreeHeapSize();
+			xHeader.ulLargestFreeBlock = ( uint32_t ) xPortGetLargestFreeBlockSize();
+		}
+		( void ) xTaskResumeAll();
+
+		memcpy( pucBuffer, &xHeader, sizeof( HeapMonitorDumpHeader_t ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xWritten;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvHomeIndex( const void *pvAddress )
+{
+uint32_t ulKey;
+
+	ulKey = ( uint32_t ) ( ( portPOINTER_SIZE_TYPE ) pvAddress / ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT );
+	ulKey *= heapHASH_MULTIPLIER;
+	ulKey ^= ulKey >> 16;
+
+	return ( UBaseType_t ) ulKey & heapBLOCK_INDEX_MASK;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindBlock( const void *pvAddress )
+{
+UBaseType_t uxIndex;
+
+	uxIndex = prvHomeIndex( pvAddress );
+
+	while( ( xBlocks[ uxIndex ].pvAddress != NULL ) && ( xBlocks[ uxIndex ].pvAddress != pvAddress ) )
+	{
+		uxIndex = ( uxIndex + ( UBaseType_t ) 1 ) & heapBLOCK_INDEX_MASK;
+	}
+
+	return uxIndex;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveBlock( UBaseType_t uxIndex )
+{
+UBaseType_t uxNext, uxHome;
+
+	xBlocks[ uxIndex ].pvAddress = NULL;
+	uxBlocksInUse--;
+
+	/* Move back each later entry of the run whose search starts at or before
+	the emptied entry, otherwise the search for it would stop at the emptied
+	entry.  The table wraps, hence the two cases. */
+	for( uxNext = ( uxIndex + ( UBaseType_t ) 1 ) & heapBLOCK_INDEX_MASK; xBlocks[ uxNext ].pvAddress != NULL; uxNext = ( uxNext + ( UBaseType_t ) 1 ) & heapBLOCK_INDEX_MASK )
+	{
+		uxHome = prvHomeIndex( xBlocks[ uxNext ].pvAddress );
+
+		if( ( ( uxNext > uxIndex ) && ( ( uxHome <= uxIndex ) || ( uxHome > uxNext ) ) ) ||
+			( ( uxNext < uxIndex ) && ( uxHome <= uxIndex ) && ( uxHome > uxNext ) ) )
+		{
+			xBlocks[ uxIndex ] = xBlocks[ uxNext ];
+			xBlocks[ uxNext ].pvAddress = NULL;
+			uxIndex = uxNext;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetOwner( void )
+{
+TaskHandle_t xTask;
+UBaseType_t uxOwner, uxReturn = heapNO_OWNER, uxUnused = heapNO_OWNER;
+const char *pcName;
+
+	if( xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED )
+	{
+		uxReturn = ( UBaseType_t ) heapMONITOR_OWNER_STARTUP;
+	}
+	else
+	{
+		xTask = xTaskGetCurrentTaskHandle();
+
+		for( uxOwner = ( UBaseType_t ) 1; ( uxOwner < ( UBaseType_t ) configHEAP_MONITOR_OWNERS ) && ( uxReturn == heapNO_OWNER ); uxOwner++ )
+		{
+			if( xOwners[ uxOwner ].xTask == xTask )
+			{
+				uxReturn = uxOwner;
+			}
+			else if( ( uxUnused == heapNO_OWNER ) && ( ( xOwners[ uxOwner ].xRecord.ulFlags & heapMONITOR_OWNER_FLAG_USED ) == 0UL ) )
+			{
+				uxUnused = uxOwner;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* Records of deleted tasks that hold no memory are reused once there
+		are no unused records. */
+		for( uxOwner = ( UBaseType_t ) 1; ( uxOwner < ( UBaseType_t ) configHEAP_MONITOR_OWNERS ) && ( uxReturn == heapNO_OWNER ) && ( uxUnused == heapNO_OWNER ); uxOwner++ )
+		{
+			if( ( ( xOwners[ uxOwner ].xRecord.ulFlags & heapMONITOR_OWNER_FLAG_DELETED ) != 0UL ) && ( xOwners[ uxOwner ].xRecord.ulLiveBlocks == 0UL ) )
+			{
+				uxUnused = uxOwner;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( ( uxReturn == heapNO_OWNER ) && ( uxUnused != heapNO_OWNER ) )
+		{
+			uxReturn = uxUnused;
+			xOwners[ uxReturn ].xTask = xTask;
+			memset( &( xOwners[ uxReturn ].xRecord ), 0x00, sizeof( HeapMonitorDumpOwner_t ) );
+			xOwners[ uxReturn ].xRecord.ulFlags = heapMONITOR_OWNER_FLAG_USED;
+
+			pcName = pcTaskGetTaskName( xTask );
+			strncpy( xOwners[ uxReturn ].xRecord.cName, pcName, heapMONITOR_NAME_LENGTH );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_HEAP_MONITOR */
+
@@ -217,6 +217,89 @@ is included as it is used by the port layer. */
 	#define configUSE_TIMERS 0
 #endif
 
+#ifndef configUSE_TIMER_HEAP
+	#define configUSE_TIMER_HEAP 0
+#endif
+
+#ifndef configUSE_TIMER_FAST_RESET
+	#define configUSE_TIMER_FAST_RESET 0
+#endif
+
+/* The tick count when the scheduler is started.  Setting it a little before
+the tick count overflows lets an application check it handles the overflow
+without waiting for it. */
+#ifndef configINITIAL_TICK_COUNT
+	#define configINITIAL_TICK_COUNT 0
+#endif
+
+#ifndef configUSE_TASK_DELAY_WHEEL
+	#define configUSE_TASK_DELAY_WHEEL 0
+#endif
+
+#if( configUSE_TASK_DELAY_WHEEL == 1 )
+	#ifndef configTASK_DELAY_WHEEL_SIZE
+		#define configTASK_DELAY_WHEEL_SIZE 32
+	#endif
+
+	#if( ( configTASK_DELAY_WHEEL_SIZE < 2 ) || ( ( configTASK_DELAY_WHEEL_SIZE & ( configTASK_DELAY_WHEEL_SIZE - 1 ) ) != 0 ) )
+		#error configTASK_DELAY_WHEEL_SIZE must be a power of two, and at least 2.
+	#endif
+#endif /* configUSE_TASK_DELAY_WHEEL */
+
+/* The most tasks the tick interrupt unblocks.  Any others that are due are
+unblocked by the tick unblock task, a kernel task that unblocks at most this
+many at a time with interrupts enabled in between, so the time interrupts are
+masked does not depend on how many tasks share a wake time.  0 means no limit,
+and no tick unblock task is created. */
+#ifndef configTICK_UNBLOCK_LIMIT
+	#define configTICK_UNBLOCK_LIMIT 0
+#endif
+
+#if( configTICK_UNBLOCK_LIMIT > 0 )
+	/* The tick unblock task must have a priority above the tasks it unblocks,
+	or a task could run before one that was due earlier. */
+	#ifndef configTICK_UNBLOCK_TASK_PRIORITY
+		#define configTICK_UNBLOCK_TASK_PRIORITY ( configMAX_PRIORITIES - 1 )
+	#endif
+
+	#ifndef configTICK_UNBLOCK_TASK_STACK_DEPTH
+		#define configTICK_UNBLOCK_TASK_STACK_DEPTH configMINIMAL_STACK_SIZE
+	#endif
+#endif /* configTICK_UNBLOCK_LIMIT */
+
+#ifndef configUSE_PRIORITY_BITMAP
+	#define configUSE_PRIORITY_BITMAP 0
+#endif
+
+#if( ( configUSE_PRIORITY_BITMAP == 1 ) && ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) )
+	/* One bit per priority, in up to 32 words of 32 bits, with one bit per
+	word in a second level. */
+	#if( configMAX_PRIORITIES > 1024 )
+		#error configMAX_PRIORITIES must be less than or equal to 1024 when configUSE_PRIORITY_BITMAP is 1.
+	#endif
+#endif /* configUSE_PRIORITY_BITMAP */
+
+/* Schedules the tasks of one priority, configEDF_PRIORITY, earliest deadline
+first rather than in turn.  configEDF_MAX_TASKS is the most tasks that can
+have deadline parameters at once. */
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING 0
+#endif
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+	#ifndef configEDF_PRIORITY
+		#error configEDF_PRIORITY must be defined when configUSE_EDF_SCHEDULING is 1.
+	#endif
+
+	#if( ( configEDF_PRIORITY < 1 ) || ( configEDF_PRIORITY >= configMAX_PRIORITIES ) )
+		#error configEDF_PRIORITY must be above the idle priority and below configMAX_PRIORITIES.
+	#endif
+
+	#ifndef configEDF_MAX_TASKS
+		#define configEDF_MAX_TASKS 16
+	#endif
+#endif /* configUSE_EDF_SCHEDULING */
+
 #ifndef configUSE_COUNTING_SEMAPHORES
 	#define configUSE_COUNTING_SEMAPHORES 0
 #endif
@@ -225,6 +308,37 @@ is included as it is used by the port layer. */
 	#define configUSE_ALTERNATIVE_API 0
 #endif
 
+#ifndef configUSE_QUEUE_ZERO_COPY
+	#define configUSE_QUEUE_ZERO_COPY 0
+#endif
+
+#if( ( configUSE_QUEUE_ZERO_COPY == 1 ) && ( configUSE_ALTERNATIVE_API == 1 ) )
+	/* The alternative API does not know about reserved or referenced queue
+	slots. */
+	#error configUSE_QUEUE_ZERO_COPY cannot be used with configUSE_ALTERNATIVE_API.
+#endif
+
+#ifndef configUSE_FAST_MUTEXES
+	#define configUSE_FAST_MUTEXES 0
+#endif
+
+#if( configUSE_FAST_MUTEXES == 1 )
+	#if( configUSE_MUTEXES == 0 )
+		#error configUSE_MUTEXES must be 1 when configUSE_FAST_MUTEXES is 1.
+	#endif
+
+	#if( configUSE_ALTERNATIVE_API == 1 )
+		/* The alternative API does not know about the mutex owner word. */
+		#error configUSE_FAST_MUTEXES cannot be used with configUSE_ALTERNATIVE_API.
+	#endif
+
+	#ifndef configFAST_MUTEX_SPIN_COUNT
+		/* The number of times a task yields and tries again to take a mutex
+		held by another task before it blocks - see queue.c. */
+		#define configFAST_MUTEX_SPIN_COUNT 0
+	#endif
+#endif /* configUSE_FAST_MUTEXES */
+
 #ifndef portCRITICAL_NESTING_IN_TCB
 	#define portCRITICAL_NESTING_IN_TCB 0
 #endif
@@ -275,6 +389,18 @@ is included as it is used by the port layer. */
 		#error If configUSE_TIMERS is set to 1 then configTIMER_TASK_STACK_DEPTH must also be defined.
 	#endif /* configTIMER_TASK_STACK_DEPTH */
 
+	#if( configUSE_TIMER_HEAP == 1 )
+		#ifndef configTIMER_HEAP_LENGTH
+			#error If configUSE_TIMER_HEAP is set to 1 then configTIMER_HEAP_LENGTH must also be defined.
+		#endif /* configTIMER_HEAP_LENGTH */
+	#endif /* configUSE_TIMER_HEAP */
+
+	#if( ( configUSE_TIMER_FAST_RESET == 1 ) && ( configUSE_TIMER_HEAP == 0 ) )
+		/* Timers are reset directly from within a critical section, which must
+		not be allowed to walk a sorted list of arbitrary length. */
+		#error configUSE_TIMER_FAST_RESET can only be set to 1 if configUSE_TIMER_HEAP is also set to 1.
+	#endif
+
 #endif /* configUSE_TIMERS */
 
 #ifndef INCLUDE_xTaskGetSchedulerState
@@ -319,6 +445,24 @@ is included as it is used by the port layer. */
 	#define portPOINTER_SIZE_TYPE uint32_t
 #endif
 
+#ifndef configUSE_TRACE_RECORDER
+	#define configUSE_TRACE_RECORDER 0
+#endif
+
+#if( configUSE_TRACE_RECORDER == 1 )
+	/* The built in trace recorder defines the trace macros it uses. */
+	#include "trace_recorder.h"
+#endif
+
+#ifndef configUSE_HEAP_MONITOR
+	#define configUSE_HEAP_MONITOR 0
+#endif
+
+#if( configUSE_HEAP_MONITOR == 1 )
+	/* The heap monitor defines the heapMONITOR_ macros. */
+	#include "heap_monitor.h"
+#endif
+
 /* Remove any unused trace macros. */
 #ifndef traceSTART
 	/* Used to perform any necessary initialisation - for example, open a file
@@ -559,6 +703,14 @@ is included as it is used by the port layer. */
     #define traceFREE( pvAddress, uiSize )
 #endif
 
+#ifndef heapMONITOR_MALLOC
+	#define heapMONITOR_MALLOC( pvAddress, xSize )
+#endif
+
+#ifndef heapMONITOR_FREE
+	#define heapMONITOR_FREE( pvAddress )
+#endif
+
 #ifndef traceEVENT_GROUP_CREATE
 	#define traceEVENT_GROUP_CREATE( xEventGroup )
 #endif
@@ -615,6 +767,143 @@ is included as it is used by the port layer. */
 	#define traceQUEUE_REGISTRY_ADD(xQueue, pcQueueName)
 #endif
 
+#ifndef traceISR_ENTER
+	/* Called by the port on entry to an interrupt handler that interacts with
+	the kernel.  uxISRNumber identifies the interrupt. */
+	#define traceISR_ENTER( uxISRNumber )
+#endif
+
+#ifndef traceISR_EXIT
+	/* Called by the port before an interrupt handler that called
+	traceISR_ENTER() returns, or requests a context switch. */
+	#define traceISR_EXIT()
+#endif
+
+#ifndef traceTICK_ISR_NUMBER
+	/* The number passed to traceISR_ENTER() by the tick interrupt. */
+	#define traceTICK_ISR_NUMBER 0
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE_BLOCK
+	#define traceTASK_NOTIFY_TAKE_BLOCK()
+#endif
+
+#ifndef traceTASK_NOTIFY_TAKE
+	#define traceTASK_NOTIFY_TAKE()
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT_BLOCK
+	#define traceTASK_NOTIFY_WAIT_BLOCK()
+#endif
+
+#ifndef traceTASK_NOTIFY_WAIT
+	#define traceTASK_NOTIFY_WAIT()
+#endif
+
+#ifndef traceTASK_NOTIFY
+	#define traceTASK_NOTIFY()
+#endif
+
+#ifndef traceTASK_NOTIFY_FROM_ISR
+	#define traceTASK_NOTIFY_FROM_ISR()
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE
+	#define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_CREATE_FAILED
+	#define traceSTREAM_BUFFER_CREATE_FAILED( xIsMessageBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_DELETE
+	#define traceSTREAM_BUFFER_DELETE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RESET
+	#define traceSTREAM_BUFFER_RESET( xStreamBuffer )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_SEND
+	#define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND
+	#define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FAILED
+	#define traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_SEND_FROM_ISR
+	#define traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xBytesSent )
+#endif
+
+#ifndef traceBLOCKING_ON_STREAM_BUFFER_RECEIVE
+	#define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE
+	#define traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FAILED
+	#define traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer )
+#endif
+
+#ifndef traceSTREAM_BUFFER_RECEIVE_FROM_ISR
+	#define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
+#endif
+
+#ifndef traceRING_QUEUE_CREATE
+	#define traceRING_QUEUE_CREATE( pxRingQueue, xMultipleProducers )
+#endif
+
+#ifndef traceRING_QUEUE_CREATE_FAILED
+	#define traceRING_QUEUE_CREATE_FAILED( xMultipleProducers )
+#endif
+
+#ifndef traceRING_QUEUE_DELETE
+	#define traceRING_QUEUE_DELETE( xRingQueue )
+#endif
+
+#ifndef traceRING_QUEUE_SEND_FAILED
+	#define traceRING_QUEUE_SEND_FAILED( xRingQueue )
+#endif
+
+#ifndef traceBLOCKING_ON_RING_QUEUE_RECEIVE
+	#define traceBLOCKING_ON_RING_QUEUE_RECEIVE( xRingQueue )
+#endif
+
+#ifndef traceMEMORY_POOL_CREATE
+	#define traceMEMORY_POOL_CREATE( pxMemoryPool )
+#endif
+
+#ifndef traceMEMORY_POOL_CREATE_FAILED
+	#define traceMEMORY_POOL_CREATE_FAILED()
+#endif
+
+#ifndef traceMEMORY_POOL_DELETE
+	#define traceMEMORY_POOL_DELETE( xMemoryPool )
+#endif
+
+#ifndef traceMEMORY_POOL_ALLOCATE_FAILED
+	#define traceMEMORY_POOL_ALLOCATE_FAILED( xMemoryPool )
+#endif
+
+#ifndef traceBLOCKING_ON_MEMORY_POOL_ALLOCATE
+	#define traceBLOCKING_ON_MEMORY_POOL_ALLOCATE( xMemoryPool )
+#endif
+
+#ifndef traceTASK_DEADLINE_MISSED
+	#define traceTASK_DEADLINE_MISSED( pxTask )
+#endif
+
+#ifndef traceTASK_BUDGET_OVERRUN
+	#define traceTASK_BUDGET_OVERRUN( pxTask )
+#endif
+
 #ifndef configGENERATE_RUN_TIME_STATS
 	#define configGENERATE_RUN_TIME_STATS 0
 #endif
@@ -657,6 +946,35 @@ is included as it is used by the port layer. */
 	#define vPortFreeAligned( pvBlockToFree ) vPortFree( pvBlockToFree )
 #endif
 
+#ifndef configUSE_HEAP_PLACEMENT_HINTS
+	/* Set to 1 to allocate task stacks with pvPortMallocWithHints(), which
+	is provided by heap_regions.c. */
+	#define configUSE_HEAP_PLACEMENT_HINTS 0
+#endif
+
+#ifndef configTASK_STACK_HEAP_HINTS
+	#define configTASK_STACK_HEAP_HINTS 0
+#endif
+
+#ifndef configEVENT_GROUP_WAIT_LISTS
+	/* The number of lists the tasks waiting on an event group are divided
+	between - see event_groups.c.  Each list adds a List_t to every event
+	group. */
+	#define configEVENT_GROUP_WAIT_LISTS 1
+#endif
+
+#ifndef configWORK_QUEUE_BATCH_SIZE
+	/* The most items a work queue worker runs each time it is woken before it
+	yields - see work_queue.c. */
+	#define configWORK_QUEUE_BATCH_SIZE 8
+#endif
+
+#ifndef configWORK_QUEUE_LATENCY_BUCKETS
+	/* The number of entries in the latency histogram of each work queue
+	worker, which is only kept if configWORK_QUEUE_TIMESTAMP() is defined. */
+	#define configWORK_QUEUE_LATENCY_BUCKETS 16
+#endif
+
 #ifndef portSUPPRESS_TICKS_AND_SLEEP
 	#define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )
 #endif
@@ -685,6 +1003,16 @@ is included as it is used by the port layer. */
 	#define configUSE_QUEUE_SETS 0
 #endif
 
+/* Set to 1 for a queue set to hold a list of its members that contain data,
+rather than a queue of the handles of the members data has been sent to. */
+#ifndef configUSE_QUEUE_SET_READY_LIST
+	#define configUSE_QUEUE_SET_READY_LIST 0
+#endif
+
+#if( ( configUSE_QUEUE_SET_READY_LIST == 1 ) && ( configUSE_QUEUE_SETS == 0 ) )
+	#error configUSE_QUEUE_SETS must be 1 when configUSE_QUEUE_SET_READY_LIST is 1.
+#endif
+
 #ifndef portTASK_USES_FLOATING_POINT
 	#define portTASK_USES_FLOATING_POINT()
 #endif
@@ -713,10 +1041,294 @@ is included as it is used by the port layer. */
 	#define configUSE_TRACE_FACILITY 0
 #endif
 
+/* A table of every task, which uxTaskGetSystemState() reads one task at a time
+rather than suspending the scheduler to walk the task lists. */
+#ifndef configUSE_TASK_REGISTRY
+	#define configUSE_TASK_REGISTRY 0
+#endif
+
+#if( configUSE_TASK_REGISTRY == 1 )
+	#if( configUSE_TRACE_FACILITY != 1 )
+		#error configUSE_TRACE_FACILITY must be 1 when configUSE_TASK_REGISTRY is 1.
+	#endif
+
+	#ifndef configTASK_REGISTRY_SIZE
+		#define configTASK_REGISTRY_SIZE 32
+	#endif
+#endif /* configUSE_TASK_REGISTRY */
+
+#ifndef configUSE_TASK_NOTIFICATIONS
+	#define configUSE_TASK_NOTIFICATIONS 1
+#endif
+
+#if( ( configTICK_UNBLOCK_LIMIT > 0 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_TASK_NOTIFICATIONS must be 1 when configTICK_UNBLOCK_LIMIT is set, as the tick unblock task is notified by the tick.
+#endif
+
+#ifndef configSUPPORT_STATIC_ALLOCATION
+	/* Defaults to 0 for backward compatibility. */
+	#define configSUPPORT_STATIC_ALLOCATION 0
+#endif
+
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
+	/* Defaults to 1 for backward compatibility. */
+	#define configSUPPORT_DYNAMIC_ALLOCATION 1
+#endif
+
+#if( ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+	#error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, but can both be 1.
+#endif
+
 #ifndef mtCOVERAGE_TEST_MARKER
 	#define mtCOVERAGE_TEST_MARKER()
 #endif
 
+/*
+ * In line with software engineering best practice, FreeRTOS implements a strict
+ * data hiding policy, so the real structures used by FreeRTOS to maintain the
+ * state of tasks, queues, semaphores, etc. are not accessible to the application
+ * code.  However, if the application writer wants to statically allocate such
+ * an object then the size of the object needs to be known.  Dummy structures
+ * that are guaranteed to have the same size and alignment requirements of the
+ * real objects are used for this purpose.  The dummy list and list item
+ * structures below are used for inclusion in such a dummy structure.  The
+ * create functions assert that the size of each dummy structure matches the
+ * size of the real structure it stands in for.
+ */
+struct xSTATIC_LIST_ITEM
+{
+	TickType_t xDummy1;
+	void *pvDummy2[ 4 ];
+};
+typedef struct xSTATIC_LIST_ITEM StaticListItem_t;
+
+/* See the comments above the struct xSTATIC_LIST_ITEM definition. */
+struct xSTATIC_MINI_LIST_ITEM
+{
+	TickType_t xDummy1;
+	void *pvDummy2[ 2 ];
+};
+typedef struct xSTATIC_MINI_LIST_ITEM StaticMiniListItem_t;
+
+/* See the comments above the struct xSTATIC_LIST_ITEM definition. */
+typedef struct xSTATIC_LIST
+{
+	UBaseType_t uxDummy1;
+	void *pvDummy2;
+	StaticMiniListItem_t xDummy3;
+} StaticList_t;
+
+/*
+ * See the comments above the struct xSTATIC_LIST_ITEM definition.  A
+ * StaticTask_t variable provides the memory for a task's control block when the
+ * task is created using xTaskCreateStatic().
+ */
+typedef struct xSTATIC_TCB
+{
+	void				*pxDummy1;
+	#if ( portUSING_MPU_WRAPPERS == 1 )
+		xMPU_SETTINGS	xDummy2;
+	#endif
+	StaticListItem_t	xDummy3[ 2 ];
+	UBaseType_t			uxDummy5;
+	void				*pxDummy6;
+	uint8_t				ucDummy7[ configMAX_TASK_NAME_LEN ];
+	#if ( portSTACK_GROWTH > 0 )
+		void			*pxDummy8;
+	#endif
+	#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+		UBaseType_t		uxDummy9;
+	#endif
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t		uxDummy10[ 2 ];
+	#endif
+	#if ( configUSE_TASK_REGISTRY == 1 )
+		UBaseType_t		uxDummy11;
+	#endif
+	#if ( configUSE_MUTEXES == 1 )
+		UBaseType_t		uxDummy12;
+	#endif
+	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
+		void			*pxDummy14;
+	#endif
+	#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		uint32_t		ulDummy16;
+	#endif
+	#if ( configUSE_NEWLIB_REENTRANT == 1 )
+		struct	_reent	xDummy17;
+	#endif
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+		uint32_t		ulDummy18;
+		uint8_t			ucDummy19;
+	#endif
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		UBaseType_t		uxDummy21;
+		TickType_t		xDummy22[ 7 ];
+		uint32_t		ulDummy23[ 3 ];
+	#endif
+	#if ( ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) || ( portUSING_MPU_WRAPPERS == 1 ) ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t			uxDummy20;
+	#endif
+
+} StaticTask_t;
+
+/*
+ * See the comments above the struct xSTATIC_LIST_ITEM definition.  A
+ * StaticQueue_t variable provides the memory for a queue's control structure
+ * when the queue is created using xQueueCreateStatic().  StaticSemaphore_t is
+ * used in the same way for semaphores and mutexes.
+ */
+typedef struct xSTATIC_QUEUE
+{
+	void *pvDummy1[ 3 ];
+
+	union
+	{
+		void *pvDummy2;
+		UBaseType_t uxDummy2;
+	} u;
+
+	StaticList_t xDummy3[ 2 ];
+	UBaseType_t uxDummy4[ 3 ];
+	BaseType_t xDummy5[ 2 ];
+
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxDummy6;
+		uint8_t ucDummy7;
+	#endif
+
+	#if ( configUSE_QUEUE_SETS == 1 )
+		void *pvDummy8;
+
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+			StaticListItem_t xDummy12;
+			UBaseType_t uxDummy13;
+		#endif
+	#endif
+
+	#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy9;
+	#endif
+
+	#if( configUSE_QUEUE_ZERO_COPY == 1 )
+		BaseType_t xDummy10[ 2 ];
+	#endif
+
+	#if( configUSE_FAST_MUTEXES == 1 )
+		UBaseType_t uxDummy11;
+	#endif
+
+} StaticQueue_t;
+typedef StaticQueue_t StaticSemaphore_t;
+
+/*
+ * See the comments above the struct xSTATIC_LIST_ITEM definition.  A
+ * StaticEventGroup_t variable provides the memory for an event group when the
+ * event group is created using xEventGroupCreateStatic().
+ */
+typedef struct xSTATIC_EVENT_GROUP
+{
+	TickType_t xDummy1;
+	StaticList_t xDummy2[ configEVENT_GROUP_WAIT_LISTS ];
+
+	#if( configEVENT_GROUP_WAIT_LISTS > 1 )
+		StaticList_t xDummy5;
+		TickType_t xDummy6;
+	#endif
+
+	#if( configUSE_CO_ROUTINES == 1 )
+		StaticList_t xDummy7;
+	#endif
+
+	#if( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxDummy3;
+	#endif
+
+	#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucDummy4;
+	#endif
+
+} StaticEventGroup_t;
+
+/*
+ * See the comments above the struct xSTATIC_LIST_ITEM definition.  A
+ * StaticTimer_t variable provides the memory for a software timer when the
+ * timer is created using xTimerCreateStatic().
+ */
+typedef struct xSTATIC_TIMER
+{
+	void				*pvDummy1;
+	StaticListItem_t	xDummy2;
+	TickType_t			xDummy3;
+	UBaseType_t			uxDummy4;
+	void				*pvDummy5[ 2 ];
+	#if( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t		uxDummy6;
+	#endif
+
+	#if( configUSE_TIMER_HEAP == 1 )
+		void			*pvDummy8;
+		UBaseType_t		uxDummy9;
+	#endif
+
+	#if( configUSE_TIMER_FAST_RESET == 1 )
+		UBaseType_t		uxDummy10;
+	#endif
+
+	#if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t 		ucDummy7;
+	#endif
+
+} StaticTimer_t;
+
+/*
+ * See the comments above the struct xSTATIC_LIST_ITEM definition.  A
+ * StaticStreamBuffer_t variable provides the memory for a stream buffer's
+ * control structure when the stream buffer is created using
+ * xStreamBufferCreateStatic().  StaticMessageBuffer_t is used in the same way
+ * for message buffers.
+ */
+typedef struct xSTATIC_STREAM_BUFFER
+{
+	size_t uxDummy1[ 4 ];
+	void *pvDummy2[ 3 ];
+	uint8_t ucDummy3;
+
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxDummy4;
+	#endif
+
+} StaticStreamBuffer_t;
+typedef StaticStreamBuffer_t StaticMessageBuffer_t;
+
+/*
+ * See the comments above the struct xSTATIC_LIST_ITEM definition.  A
+ * StaticRingQueue_t variable provides the memory for a ring queue's control
+ * structure when the ring queue is created using xRingQueueCreateStatic() or
+ * xRingQueueCreateMultiProducerStatic().
+ */
+typedef struct xSTATIC_RING_QUEUE
+{
+	UBaseType_t uxDummy1[ 5 ];
+	void *pvDummy2[ 3 ];
+	uint8_t ucDummy3;
+} StaticRingQueue_t;
+
+/*
+ * See the comments above the struct xSTATIC_LIST_ITEM definition.  A
+ * StaticMemoryPool_t variable provides the memory for a memory pool's control
+ * structure when the memory pool is created using xMemoryPoolCreateStatic().
+ */
+typedef struct xSTATIC_MEMORY_POOL
+{
+	void *pvDummy1[ 2 ];
+	size_t uxDummy2;
+	UBaseType_t uxDummy3[ 3 ];
+	uint32_t ulDummy4[ 3 ];
+	StaticList_t xDummy5;
+	uint8_t ucDummy6;
+} StaticMemoryPool_t;
+
 /* Definitions to allow backward compatibility with FreeRTOS versions prior to
 V8 if desired. */
 #ifndef configENABLE_BACKWARD_COMPATIBILITY
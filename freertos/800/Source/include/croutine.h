@@ -71,6 +71,7 @@
 #endif
 
 #include "list.h"
+#include "task.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -92,8 +93,17 @@ typedef struct corCoRoutineControlBlock
 	UBaseType_t 		uxPriority;			/*< The priority of the co-routine in relation to other co-routines. */
 	UBaseType_t 		uxIndex;			/*< Used to distinguish between co-routines when multiple co-routines use the same co-routine function. */
 	uint16_t 			uxState;			/*< Used internally by the co-routine implementation. */
+
+	#if( configUSE_TASK_NOTIFICATIONS == 1 )
+		volatile uint8_t ucNotifyState;		/*< Used internally by the co-routine notification functions. */
+		volatile uint32_t ulNotifiedValue;	/*< The value set by xCoRoutineNotify() and read by crNOTIFY_WAIT(). */
+	#endif
 } CRCB_t; /* Co-routine control block.  Note must be identical in size down to uxPriority with TCB_t. */
 
+/* The co-routine control block is not hidden, so the memory provided to
+xCoRoutineCreateStatic() is simply a control block. */
+typedef CRCB_t StaticCoRoutine_t;
+
 /**
  * croutine. h
  *<pre>
@@ -168,6 +178,42 @@ typedef struct corCoRoutineControlBlock
  */
 BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex );
 
+/**
+ * croutine. h
+ *<pre>
+ CoRoutineHandle_t xCoRoutineCreateStatic(
+                                 crCOROUTINE_CODE pxCoRoutineCode,
+                                 UBaseType_t uxPriority,
+                                 UBaseType_t uxIndex,
+                                 StaticCoRoutine_t *pxCoRoutineBuffer
+                               );</pre>
+ *
+ * Create a new co-routine using memory provided by the application, and add it
+ * to the list of co-routines that are ready to run.  The co-routine uses no
+ * other memory - sizeof( StaticCoRoutine_t ) bytes in total - so hundreds of
+ * small state machines can be run as co-routines for the memory of a few task
+ * stacks.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * @param pxCoRoutineCode, uxPriority, uxIndex As for xCoRoutineCreate().
+ *
+ * @param pxCoRoutineBuffer Must point to a StaticCoRoutine_t variable, which
+ * is used to hold the co-routine's control block for as long as the
+ * application runs.
+ *
+ * @return The handle of the co-routine, which can be passed to
+ * xCoRoutineNotify().  The co-routine is also passed its own handle as the
+ * xHandle parameter of the co-routine function.
+ *
+ * \defgroup xCoRoutineCreateStatic xCoRoutineCreateStatic
+ * \ingroup Tasks
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	CoRoutineHandle_t xCoRoutineCreateStatic( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPriority, UBaseType_t uxIndex, StaticCoRoutine_t *pxCoRoutineBuffer );
+#endif
+
 
 /**
  * croutine. h
@@ -183,7 +229,12 @@ BaseType_t xCoRoutineCreate( crCOROUTINE_CODE pxCoRoutineCode, UBaseType_t uxPri
  *
  * If an application comprises of both tasks and co-routines then
  * vCoRoutineSchedule should be called from the idle task (in an idle task
- * hook).
+ * hook), or from a task created to run the co-routines.  It must always be
+ * called from the same task.
+ *
+ * The highest priority ready co-routine is found from a bitmap of the ready
+ * priorities, so the time taken does not depend on the number of co-routines
+ * or priorities.
  *
  * Example usage:
    <pre>
@@ -296,7 +347,8 @@ void vCoRoutineSchedule( void );
  * @param xTickToDelay The number of ticks that the co-routine should delay
  * for.  The actual amount of time this equates to is defined by
  * configTICK_RATE_HZ (set in FreeRTOSConfig.h).  The constant portTICK_PERIOD_MS
- * can be used to convert ticks to milliseconds.
+ * can be used to convert ticks to milliseconds.  A co-routine that delays for
+ * portMAX_DELAY ticks never runs again.
  *
  * Example usage:
    <pre>
@@ -332,6 +384,28 @@ void vCoRoutineSchedule( void );
 	}																					\
 	crSET_STATE0( ( xHandle ) );
 
+/**
+ * croutine. h
+ *<pre>
+ crDELAY_UNTIL( CoRoutineHandle_t xHandle, TickType_t *pxPreviousWakeTime, TickType_t xTimeIncrement );</pre>
+ *
+ * The co-routine equivalent of vTaskDelayUntil().  Delay a co-routine until
+ * xTimeIncrement ticks after the time held in *pxPreviousWakeTime, which is
+ * then updated, so a co-routine can run at a fixed period however long it
+ * takes to run.  *pxPreviousWakeTime must be initialised with the current time
+ * (from xTaskGetTickCount()) before its first use, and must be a static
+ * variable.
+ *
+ * crDELAY_UNTIL can only be called from the co-routine function itself - not
+ * from within a function called by the co-routine function.
+ *
+ * \defgroup crDELAY_UNTIL crDELAY_UNTIL
+ * \ingroup Tasks
+ */
+#define crDELAY_UNTIL( xHandle, pxPreviousWakeTime, xTimeIncrement )					\
+	vCoRoutineDelayUntil( ( pxPreviousWakeTime ), ( xTimeIncrement ) );					\
+	crSET_STATE0( ( xHandle ) );
+
 /**
  * <pre>
  crQUEUE_SEND(
@@ -731,6 +805,156 @@ void vCoRoutineSchedule( void );
  */
 #define crQUEUE_RECEIVE_FROM_ISR( pxQueue, pvBuffer, pxCoRoutineWoken ) xQueueCRReceiveFromISR( ( pxQueue ), ( pvBuffer ), ( pxCoRoutineWoken ) )
 
+/**
+ * croutine. h
+ * <pre>
+ crNOTIFY_WAIT(
+                  CoRoutineHandle_t xHandle,
+                  uint32_t ulBitsToClearOnEntry,
+                  uint32_t ulBitsToClearOnExit,
+                  uint32_t *pulNotificationValue,
+                  TickType_t xTicksToWait,
+                  BaseType_t *pxResult
+              )</pre>
+ *
+ * The co-routine equivalent of xTaskNotifyWait().  Each co-routine has a 32-bit
+ * notification value, which is updated by xCoRoutineNotify() or
+ * xCoRoutineNotifyFromISR().  crNOTIFY_WAIT() blocks the co-routine until it
+ * is notified, without the co-routine having to be placed on an event list,
+ * which makes notifications the cheapest way of readying a co-routine.
+ *
+ * A co-routine run by a software timer's expiry can be implemented by having
+ * the timer's callback function call xCoRoutineNotify().
+ *
+ * crNOTIFY_WAIT can only be called from the co-routine function itself - not
+ * from within a function called by the co-routine function.
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * macro to be available.
+ *
+ * @param xHandle The handle of the calling co-routine.  This is the xHandle
+ * parameter of the co-routine function.
+ *
+ * @param ulBitsToClearOnEntry, ulBitsToClearOnExit As for xTaskNotifyWait().
+ *
+ * @param pulNotificationValue If not NULL, the notification value before the
+ * ulBitsToClearOnExit bits were cleared is written to *pulNotificationValue.
+ * Must point to a static variable.
+ *
+ * @param xTicksToWait The maximum number of ticks to wait for a notification.
+ * portMAX_DELAY waits indefinitely.
+ *
+ * @param pxResult Set to pdTRUE if a notification was received, or pdFALSE if
+ * the wait timed out.  Must point to a static variable.
+ *
+ * Example usage:
+   <pre>
+ // A co-routine that handles the events of one protocol connection.
+ static void prvConnectionCoRoutine( CoRoutineHandle_t xHandle, UBaseType_t uxIndex )
+ {
+ static uint32_t ulEvents[ NUM_CONNECTIONS ];
+ static BaseType_t xResult[ NUM_CONNECTIONS ];
+
+    crSTART( xHandle );
+
+    for( ;; )
+    {
+        // Wait up to 100 ticks for an event, clearing the events received.
+        crNOTIFY_WAIT( xHandle, 0, 0xffffffffUL, &( ulEvents[ uxIndex ] ), 100, &( xResult[ uxIndex ] ) );
+
+        if( xResult[ uxIndex ] == pdFALSE )
+        {
+            // Timed out - retransmit.
+        }
+    }
+
+    crEND();
+ }</pre>
+ * \defgroup crNOTIFY_WAIT crNOTIFY_WAIT
+ * \ingroup Tasks
+ */
+#define crNOTIFY_WAIT( xHandle, ulBitsToClearOnEntry, ulBitsToClearOnExit, pulNotificationValue, xTicksToWait, pxResult )	\
+{																						\
+	*( pxResult ) = xCoRoutineNotifyWait( ( ulBitsToClearOnEntry ), ( ulBitsToClearOnExit ), ( pulNotificationValue ), ( xTicksToWait ) );	\
+	if( *( pxResult ) == errQUEUE_BLOCKED )												\
+	{																					\
+		crSET_STATE0( ( xHandle ) );													\
+		*( pxResult ) = xCoRoutineNotifyWait( 0, ( ulBitsToClearOnExit ), ( pulNotificationValue ), 0 );	\
+	}																					\
+}
+
+/**
+ * croutine. h
+ * <pre>
+ BaseType_t xCoRoutineNotify( CoRoutineHandle_t xCoRoutineToNotify, uint32_t ulValue, eNotifyAction eAction );
+ BaseType_t xCoRoutineNotifyFromISR( CoRoutineHandle_t xCoRoutineToNotify, uint32_t ulValue, eNotifyAction eAction );</pre>
+ *
+ * The co-routine equivalents of xTaskNotify() and xTaskNotifyFromISR().  Update
+ * the notification value of a co-routine as described by eAction, and ready
+ * the co-routine if it is blocked in crNOTIFY_WAIT().
+ *
+ * xCoRoutineNotify() can be called from tasks and from co-routines, and
+ * xCoRoutineNotifyFromISR() from interrupts.  A readied co-routine runs the
+ * next time vCoRoutineSchedule() is called, if it then has the highest
+ * priority.
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for these
+ * functions to be available.
+ *
+ * @return pdFAIL if eAction is eSetValueWithoutOverwrite and the co-routine
+ * already had a notification pending, otherwise pdPASS.
+ *
+ * \defgroup xCoRoutineNotify xCoRoutineNotify
+ * \ingroup Tasks
+ */
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+	BaseType_t xCoRoutineNotify( CoRoutineHandle_t xCoRoutineToNotify, uint32_t ulValue, eNotifyAction eAction );
+	BaseType_t xCoRoutineNotifyFromISR( CoRoutineHandle_t xCoRoutineToNotify, uint32_t ulValue, eNotifyAction eAction );
+#endif
+
+/**
+ * croutine. h
+ * <pre>
+ crEVENT_GROUP_WAIT_BITS(
+                            CoRoutineHandle_t xHandle,
+                            EventGroupHandle_t xEventGroup,
+                            EventBits_t uxBitsToWaitFor,
+                            BaseType_t xClearOnExit,
+                            BaseType_t xWaitForAllBits,
+                            TickType_t xTicksToWait,
+                            EventBits_t *puxBits
+                        )</pre>
+ *
+ * The co-routine equivalent of xEventGroupWaitBits().  Block the co-routine
+ * until the bits in uxBitsToWaitFor are set in the event group, as described
+ * by xWaitForAllBits, or until xTicksToWait ticks have passed.  The bits can be
+ * set by tasks, and by interrupts using xEventGroupSetBitsFromISR().
+ *
+ * crEVENT_GROUP_WAIT_BITS can only be called from the co-routine function
+ * itself - not from within a function called by the co-routine function.
+ * event_groups.h must be included to use it.
+ *
+ * @param xHandle The handle of the calling co-routine.
+ *
+ * @param xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits,
+ * xTicksToWait As for xEventGroupWaitBits().  portMAX_DELAY waits indefinitely.
+ *
+ * @param puxBits Set to the value of the event group bits when the wait
+ * condition was met, or when the wait timed out - in the same way as the
+ * value returned by xEventGroupWaitBits().  Must point to a static variable.
+ *
+ * \defgroup crEVENT_GROUP_WAIT_BITS crEVENT_GROUP_WAIT_BITS
+ * \ingroup Tasks
+ */
+#define crEVENT_GROUP_WAIT_BITS( xHandle, xEventGroup, uxBitsToWaitFor, xClearOnExit, xWaitForAllBits, xTicksToWait, puxBits )	\
+{																						\
+	if( xEventGroupCRWaitBits( ( xEventGroup ), ( uxBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), ( xTicksToWait ), ( puxBits ) ) == errQUEUE_BLOCKED )	\
+	{																					\
+		crSET_STATE0( ( xHandle ) );													\
+		( void ) xEventGroupCRWaitBits( ( xEventGroup ), ( uxBitsToWaitFor ), ( xClearOnExit ), ( xWaitForAllBits ), 0, ( puxBits ) );	\
+	}																					\
+}
+
 /*
  * This function is intended for internal use by the co-routine macros only.
  * The macro nature of the co-routine implementation requires that the
@@ -738,10 +962,25 @@ void vCoRoutineSchedule( void );
  * writers.
  *
  * Removes the current co-routine from its ready list and places it in the
- * appropriate delayed list.
+ * appropriate delayed list.  A delay of portMAX_DELAY places it in the list
+ * of co-routines that wait indefinitely.
  */
 void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay, List_t *pxEventList );
 
+/*
+ * These functions are intended for internal use by the co-routine macros
+ * only.  The function should not be used by application writers.
+ *
+ * vCoRoutineDelayUntil() implements crDELAY_UNTIL(), and
+ * xCoRoutineNotifyWait() implements crNOTIFY_WAIT().  xCoRoutineNotifyWait()
+ * returns errQUEUE_BLOCKED if the co-routine must block.
+ */
+void vCoRoutineDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement );
+
+#if( configUSE_TASK_NOTIFICATIONS == 1 )
+	BaseType_t xCoRoutineNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );
+#endif
+
 /*
  * This function is intended for internal use by the queue implementation only.
  * The function should not be used by application writers.
@@ -751,6 +990,17 @@ void vCoRoutineAddToDelayedList( TickType_t xTicksToDelay, List_t *pxEventList )
  */
 BaseType_t xCoRoutineRemoveFromEventList( const List_t *pxEventList );
 
+/*
+ * This function is intended for internal use by the event group
+ * implementation only.  The function should not be used by application
+ * writers.
+ *
+ * Sets the value of a co-routine's event list item, removes the item from the
+ * unordered event list it is in, and places the co-routine in the pending
+ * ready list.  Must be called with interrupts disabled.
+ */
+BaseType_t xCoRoutineRemoveFromUnorderedEventList( ListItem_t *pxEventListItem, const TickType_t xItemValue );
+
 #ifdef __cplusplus
 }
 #endif
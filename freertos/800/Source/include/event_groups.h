@@ -169,7 +169,46 @@ typedef TickType_t EventBits_t;
  * \defgroup xEventGroupCreate xEventGroupCreate
  * \ingroup EventGroup
  */
-EventGroupHandle_t xEventGroupCreate( void ) PRIVILEGED_FUNCTION;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	EventGroupHandle_t xEventGroupCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * event_groups.h
+ *<pre>
+ EventGroupHandle_t xEventGroupCreateStatic( StaticEventGroup_t *pxEventGroupBuffer );
+ </pre>
+ *
+ * Create a new event group, as per xEventGroupCreate(), but using the
+ * StaticEventGroup_t variable pointed to by pxEventGroupBuffer to hold the
+ * event group's data structure instead of allocating it from the FreeRTOS
+ * heap.  The memory is not freed if the event group is later deleted.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xEventGroupCreateStatic() to be available.
+ *
+ * @param pxEventGroupBuffer Must point to a variable of type
+ * StaticEventGroup_t, which will be used to hold the event group's data
+ * structures.
+ *
+ * @return If the event group was created then a handle to the event group is
+ * returned.  If pxEventGroupBuffer was NULL then NULL is returned.
+ *
+ * Example usage:
+   <pre>
+	// StaticEventGroup_t is a publicly accessible structure that has the same
+	// size and alignment requirements as the real event group structure.
+	StaticEventGroup_t xEventGroupBuffer;
+
+	// Create the event group without dynamically allocating any memory.
+	xEventGroup = xEventGroupCreateStatic( &xEventGroupBuffer );
+   </pre>
+ * \defgroup xEventGroupCreateStatic xEventGroupCreateStatic
+ * \ingroup EventGroup
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	EventGroupHandle_t xEventGroupCreateStatic( StaticEventGroup_t *pxEventGroupBuffer ) PRIVILEGED_FUNCTION;
+#endif
 
 /**
  * event_groups.h
@@ -349,6 +388,13 @@ EventBits_t xEventGroupClearBitsFromISR( EventGroupHandle_t xEventGroup, const E
  * Setting bits in an event group will automatically unblock tasks that are
  * blocked waiting for the bits.
  *
+ * The tasks waiting on the event group are tested with the scheduler
+ * suspended.  When configEVENT_GROUP_WAIT_LISTS is 1 every waiting task is
+ * tested.  Otherwise the waiting tasks are divided between that many lists by
+ * the bits they wait for, and only the lists of the bits being set are tested.
+ * Set configEVENT_GROUP_WAIT_LISTS to the number of bits in use to test only
+ * the tasks the bits being set might unblock.
+ *
  * @param xEventGroup The event group in which the bits are to be set.
  *
  * @param uxBitsToSet A bitwise value that indicates the bit or bits to set.
@@ -667,6 +713,18 @@ void vEventGroupDelete( EventGroupHandle_t xEventGroup );
 /* For internal use only. */
 void vEventGroupSetBitsCallback( void *pvEventGroup, const uint32_t ulBitsToSet );
 
+/*
+ * The function above is for waiting on an event group from a task.  The
+ * function below is the equivalent for waiting from a co-routine.
+ *
+ * It is called from the co-routine macro implementation and should not be
+ * called directly from application code.  Instead use the
+ * crEVENT_GROUP_WAIT_BITS() macro defined within croutine.h.
+ */
+#if( configUSE_CO_ROUTINES == 1 )
+	BaseType_t xEventGroupCRWaitBits( EventGroupHandle_t xEventGroup, const EventBits_t uxBitsToWaitFor, const BaseType_t xClearOnExit, const BaseType_t xWaitForAllBits, TickType_t xTicksToWait, EventBits_t *puxBits );
+#endif
+
 #if (configUSE_TRACE_FACILITY == 1)
 	UBaseType_t uxEventGroupGetNumber( void* xEventGroup );
 #endif
@@ -0,0 +1,262 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef HEAP_MONITOR_H
+#define HEAP_MONITOR_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include heap_monitor.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A monitor that records who holds the memory allocated from the heap.  When
+ * configUSE_HEAP_MONITOR is 1 this header is included by FreeRTOS.h, and
+ * defines the heapMONITOR_MALLOC() and heapMONITOR_FREE() macros that the
+ * heap_n.c files call each time a block is allocated or freed.  When it is 0
+ * the macros are empty, so the monitor costs nothing.
+ *
+ * Each allocated block is recorded in a table of configHEAP_MONITOR_BLOCKS
+ * entries (a power of two, default 256), indexed by a hash of the block's
+ * address, along with:
+ *
+ *   + The task that allocated it.  Blocks allocated before the scheduler was
+ *     started are owned by heapMONITOR_OWNER_STARTUP.
+ *
+ *   + The call site - configHEAP_MONITOR_CALL_SITE(), which by default is the
+ *     address the allocating function returns to when built with GCC, and
+ *     NULL otherwise.
+ *
+ *   + Its sequence number - allocations are numbered in the order they are
+ *     made, so blocks allocated after vHeapMonitorSetMark() was called, and
+ *     still held, can be picked out as possible leaks.
+ *
+ * Each owner, of which there are configHEAP_MONITOR_OWNERS (default 16),
+ * counts the bytes and blocks it holds, and the most bytes it has held.  The
+ * owner of a block is charged until the block is freed, whichever task frees
+ * it.  When the memory of a task's TCB is freed the owner is marked as
+ * deleted, so the memory it did not free is still reported against it.
+ * Allocations made once either table is full are counted but not recorded.
+ *
+ * The sizes are those the heap passes to traceMALLOC(), which for most heaps
+ * include the block header and any alignment padding.  The macros are called
+ * with the scheduler suspended or from a critical section, so the monitor
+ * takes no locks of its own.
+ *
+ * xHeapMonitorDump() writes a self describing snapshot - a
+ * HeapMonitorDumpHeader_t, then a HeapMonitorDumpOwner_t for each owner, then
+ * a HeapMonitorDumpBlock_t for each allocated block - that is decoded on a
+ * host.  All fields are of fixed size, and addresses are held in 64 bits, so
+ * the layout is the same on any target of the same endianness.  The dump also
+ * holds the free space, the largest free block and the fragmentation of the
+ * heap, so the heap must provide xPortGetFreeHeapSize(),
+ * xPortGetMinimumEverFreeHeapSize() and xPortGetLargestFreeBlockSize() - all
+ * the heap_n.c files do other than heap_3.c.
+ *
+ * The monitor requires INCLUDE_xTaskGetCurrentTaskHandle,
+ * INCLUDE_xTaskGetSchedulerState and INCLUDE_pcTaskGetTaskName to be 1.
+ */
+
+/* Identifies a heap monitor dump, and the version of its layout. */
+#define heapMONITOR_MAGIC					( 0x4E4F4D48UL ) /* "HMON" when stored little endian. */
+#define heapMONITOR_VERSION					( 1UL )
+
+/* The number of characters of each owner's name that are recorded, including
+the terminating null if the name is shorter. */
+#define heapMONITOR_NAME_LENGTH				( 12 )
+
+/* The owner of blocks allocated before the scheduler was started. */
+#define heapMONITOR_OWNER_STARTUP			( 0UL )
+
+/* Values of ulFlags in an owner record. */
+#define heapMONITOR_OWNER_FLAG_USED			( 0x01UL )
+#define heapMONITOR_OWNER_FLAG_DELETED		( 0x02UL )
+
+/* The start of a dump. */
+typedef struct xHEAP_MONITOR_DUMP_HEADER
+{
+	uint32_t ulMagic;						/*< heapMONITOR_MAGIC. */
+	uint32_t ulVersion;						/*< heapMONITOR_VERSION. */
+	uint32_t ulOwnerCount;					/*< The number of owner records that follow the header. */
+	uint32_t ulBlockCount;					/*< The number of block records that follow the owner records. */
+	uint32_t ulSequence;					/*< The sequence number the next allocation will be given. */
+	uint32_t ulMarkSequence;				/*< The sequence number when vHeapMonitorSetMark() was last called. */
+	uint32_t ulBlocksDropped;				/*< Allocations not recorded because the block table was full. */
+	uint32_t ulOwnersDropped;				/*< Allocations not recorded because the owner table was full. */
+	uint32_t ulFreeBytes;					/*< xPortGetFreeHeapSize(). */
+	uint32_t ulMinimumEverFreeBytes;		/*< xPortGetMinimumEverFreeHeapSize(). */
+	uint32_t ulLargestFreeBlock;			/*< xPortGetLargestFreeBlockSize(). */
+	uint32_t ulFragmentation;				/*< uxHeapMonitorGetFragmentation(). */
+} HeapMonitorDumpHeader_t;
+
+/* How much of the heap one owner holds. */
+typedef struct xHEAP_MONITOR_DUMP_OWNER
+{
+	uint32_t ulFlags;						/*< heapMONITOR_OWNER_FLAG_ bits. */
+	uint32_t ulLiveBytes;					/*< The bytes currently held. */
+	uint32_t ulMaximumLiveBytes;			/*< The most bytes held at once. */
+	uint32_t ulLiveBlocks;					/*< The blocks currently held. */
+	uint32_t ulAllocations;					/*< The number of blocks allocated. */
+	char cName[ heapMONITOR_NAME_LENGTH ];	/*< The task's name, which is not null terminated if it is heapMONITOR_NAME_LENGTH characters long. */
+} HeapMonitorDumpOwner_t;
+
+/* One allocated block. */
+typedef struct xHEAP_MONITOR_DUMP_BLOCK
+{
+	uint64_t ullAddress;					/*< The address returned by pvPortMalloc(). */
+	uint64_t ullCallSite;					/*< configHEAP_MONITOR_CALL_SITE() when the block was allocated. */
+	uint32_t ulSize;						/*< The size passed to traceMALLOC(). */
+	uint32_t ulSequence;					/*< The sequence number of the allocation. */
+	uint32_t ulOwner;						/*< The index of the owner record. */
+	uint32_t ulReserved;					/*< Pads the record to a multiple of eight bytes. */
+} HeapMonitorDumpBlock_t;
+
+#if( configUSE_HEAP_MONITOR == 1 )
+
+	#if( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+		#error configUSE_HEAP_MONITOR requires INCLUDE_xTaskGetCurrentTaskHandle to be 1.
+	#endif
+
+	#if( INCLUDE_xTaskGetSchedulerState != 1 )
+		#error configUSE_HEAP_MONITOR requires INCLUDE_xTaskGetSchedulerState to be 1.
+	#endif
+
+	#if( INCLUDE_pcTaskGetTaskName != 1 )
+		#error configUSE_HEAP_MONITOR requires INCLUDE_pcTaskGetTaskName to be 1.
+	#endif
+
+	#ifndef configHEAP_MONITOR_BLOCKS
+		#define configHEAP_MONITOR_BLOCKS 256
+	#endif
+
+	#if( ( configHEAP_MONITOR_BLOCKS & ( configHEAP_MONITOR_BLOCKS - 1 ) ) != 0 )
+		#error configHEAP_MONITOR_BLOCKS must be a power of two.
+	#endif
+
+	#ifndef configHEAP_MONITOR_OWNERS
+		#define configHEAP_MONITOR_OWNERS 16
+	#endif
+
+	#ifndef configHEAP_MONITOR_CALL_SITE
+		#ifdef __GNUC__
+			#define configHEAP_MONITOR_CALL_SITE() __builtin_return_address( 0 )
+		#else
+			#define configHEAP_MONITOR_CALL_SITE() NULL
+		#endif
+	#endif
+
+	/* The largest dump xHeapMonitorDump() can write. */
+	#define heapMONITOR_DUMP_SIZE			( sizeof( HeapMonitorDumpHeader_t ) + ( configHEAP_MONITOR_OWNERS * sizeof( HeapMonitorDumpOwner_t ) ) + ( configHEAP_MONITOR_BLOCKS * sizeof( HeapMonitorDumpBlock_t ) ) )
+
+	/*
+	 * Remember the current sequence number, so the blocks allocated after this
+	 * call that are still held when the heap is dumped are reported as possible
+	 * leaks.
+	 */
+	void vHeapMonitorSetMark( void );
+
+	/*
+	 * Return the fragmentation of the free space as a percentage - 0 when the
+	 * largest free block holds all the free space, approaching 100 as the free
+	 * space is divided into more and smaller blocks.
+	 */
+	UBaseType_t uxHeapMonitorGetFragmentation( void );
+
+	/*
+	 * Return the number of bytes held by the calling task, or by the startup
+	 * owner if called before the scheduler has been started.
+	 */
+	size_t xHeapMonitorGetLiveBytes( void );
+
+	/*
+	 * Write a snapshot of the monitor into the xBufferSize bytes at pvBuffer,
+	 * which should be heapMONITOR_DUMP_SIZE bytes to be sure of holding all
+	 * the blocks.  Returns the number of bytes written.  Blocks that do not fit
+	 * are left out, and ulBlockCount set to the number that were written.
+	 * Returns 0 if the buffer cannot hold the header and the owner records.
+	 */
+	size_t xHeapMonitorDump( void *pvBuffer, size_t xBufferSize );
+
+	/*
+	 * Used by the macros below - not for use by application code.
+	 */
+	void vHeapMonitorMalloc( void *pvAddress, size_t xSize, const void *pvCallSite );
+	void vHeapMonitorFree( void *pvAddress );
+
+	/* The macros called by the heap_n.c files. */
+	#define heapMONITOR_MALLOC( pvAddress, xSize )	vHeapMonitorMalloc( ( pvAddress ), ( xSize ), configHEAP_MONITOR_CALL_SITE() )
+	#define heapMONITOR_FREE( pvAddress )			vHeapMonitorFree( ( pvAddress ) )
+
+#endif /* configUSE_HEAP_MONITOR */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* HEAP_MONITOR_H */
+
@@ -0,0 +1,394 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef MEMORY_POOL_H
+#define MEMORY_POOL_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include memory_pool.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A memory pool hands out fixed size blocks carved from an array supplied by
+ * the application.  Unlike pvPortMalloc():
+ *
+ * + Allocating and freeing a block takes the same short time however many
+ *   blocks are in use, and never suspends the scheduler - the free blocks are
+ *   held in a list threaded through the blocks themselves, and a block is
+ *   taken from, or returned to, the head of the list inside a critical
+ *   section.
+ *
+ * + Blocks can be allocated and freed from interrupts.
+ *
+ * + A task that finds the pool empty can block, with a timeout, until another
+ *   task or an interrupt frees a block.  Waiting tasks are held in priority
+ *   order, in the same way as tasks waiting on a queue, so the highest
+ *   priority waiting task is woken first.
+ *
+ * + Each pool counts its allocations and remembers the most blocks that have
+ *   been in use at once, so the number of blocks given to a pool can be sized
+ *   from a real run - see vMemoryPoolGetStats().
+ *
+ * A pool is intended to be given to one subsystem, for example to hold the
+ * message buffers passed between an interrupt and the task that processes
+ * them.
+ *
+ * \defgroup MemoryPool MemoryPool
+ */
+
+/**
+ * memory_pool.h
+ *
+ * Type by which memory pools are referenced.  For example, a call to
+ * xMemoryPoolCreate() returns a MemoryPoolHandle_t variable that can then be
+ * used as a parameter to pvMemoryPoolAllocate(), vMemoryPoolFree(), etc.
+ *
+ * \defgroup MemoryPoolHandle_t MemoryPoolHandle_t
+ * \ingroup MemoryPool
+ */
+typedef void * MemoryPoolHandle_t;
+
+/**
+ * memory_pool.h
+ *
+ * The statistics of a pool, as returned by vMemoryPoolGetStats().
+ *
+ * \ingroup MemoryPool
+ */
+typedef struct xMEMORY_POOL_STATS
+{
+	UBaseType_t uxBlocks;				/*< The number of blocks in the pool. */
+	UBaseType_t uxBlocksInUse;			/*< The number of blocks allocated when the statistics were read. */
+	UBaseType_t uxMaxBlocksInUse;		/*< The most blocks that have been allocated at once. */
+	uint32_t ulAllocations;				/*< The number of blocks that have been allocated. */
+	uint32_t ulBlockedAllocations;		/*< The number of allocations that had to wait for a block to be freed. */
+	uint32_t ulFailedAllocations;		/*< The number of allocations that returned NULL. */
+} MemoryPoolStats_t;
+
+/**
+ * memory_pool.h
+ *
+ * The number of bytes taken by each block of a pool created with a block size
+ * of xBlockSize.  Blocks are at least the size of a pointer, as a free block
+ * holds the address of the next free block, and are rounded up to a multiple
+ * of portBYTE_ALIGNMENT so every block is aligned.
+ *
+ * \ingroup MemoryPool
+ */
+#define memorypoolBLOCK_SIZE( xBlockSize ) ( ( ( ( ( size_t ) ( xBlockSize ) ) < sizeof( void * ) ? sizeof( void * ) : ( ( size_t ) ( xBlockSize ) ) ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/**
+ * memory_pool.h
+ *
+ * The number of bytes of storage needed by a pool of uxBlocks blocks, each of
+ * xBlockSize bytes.
+ *
+ * \ingroup MemoryPool
+ */
+#define memorypoolSTORAGE_SIZE( uxBlocks, xBlockSize ) ( ( size_t ) ( uxBlocks ) * memorypoolBLOCK_SIZE( xBlockSize ) )
+
+/**
+ * memory_pool.h
+ *<pre>
+ MemoryPoolHandle_t xMemoryPoolCreate( UBaseType_t uxBlocks,
+									   size_t xBlockSize,
+									   uint8_t *pucPoolStorageArea );
+ </pre>
+ *
+ * Creates a memory pool from an array supplied by the application.  Only the
+ * pool's control structure is allocated using pvPortMalloc().
+ *
+ * @param uxBlocks The number of blocks in the pool.
+ *
+ * @param xBlockSize The size, in bytes, of each block.
+ *
+ * @param pucPoolStorageArea Must point to an array of at least
+ * memorypoolSTORAGE_SIZE( uxBlocks, xBlockSize ) bytes that is aligned to
+ * portBYTE_ALIGNMENT.  The array is used by the pool until the pool is
+ * deleted.
+ *
+ * @return If NULL is returned, then the pool cannot be created because there
+ * is insufficient heap memory available.  Otherwise the handle of the created
+ * pool is returned.
+ *
+ * Example usage:
+   <pre>
+	#define RX_BUFFERS 16
+
+	typedef struct
+	{
+		uint16_t usLength;
+		uint8_t ucData[ 62 ];
+	} RxBuffer_t;
+
+	// The storage is declared as uint64_t to align it to portBYTE_ALIGNMENT,
+	// which is 8 on this port.
+	static uint64_t ullRxStorage[ memorypoolSTORAGE_SIZE( RX_BUFFERS, sizeof( RxBuffer_t ) ) / sizeof( uint64_t ) ];
+	MemoryPoolHandle_t xRxPool;
+
+	xRxPool = xMemoryPoolCreate( RX_BUFFERS, sizeof( RxBuffer_t ), ( uint8_t * ) ullRxStorage );
+   </pre>
+ * \defgroup xMemoryPoolCreate xMemoryPoolCreate
+ * \ingroup MemoryPool
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	MemoryPoolHandle_t xMemoryPoolCreate( UBaseType_t uxBlocks, size_t xBlockSize, uint8_t * const pucPoolStorageArea ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * memory_pool.h
+ *<pre>
+ MemoryPoolHandle_t xMemoryPoolCreateStatic( UBaseType_t uxBlocks,
+											 size_t xBlockSize,
+											 uint8_t *pucPoolStorageArea,
+											 StaticMemoryPool_t *pxStaticMemoryPool );
+ </pre>
+ *
+ * Creates a memory pool, as per xMemoryPoolCreate(), but with its control
+ * structure held in memory supplied by the application instead of memory
+ * allocated from the FreeRTOS heap.  configSUPPORT_STATIC_ALLOCATION must be
+ * set to 1 in FreeRTOSConfig.h for this function to be available.
+ *
+ * @param pxStaticMemoryPool Must point to a variable of type
+ * StaticMemoryPool_t, which will be used to hold the pool's data structure.
+ *
+ * @return If the pool is created successfully then a handle to the created
+ * pool is returned.  If pucPoolStorageArea or pxStaticMemoryPool are NULL then
+ * NULL is returned.
+ *
+ * \defgroup xMemoryPoolCreateStatic xMemoryPoolCreateStatic
+ * \ingroup MemoryPool
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	MemoryPoolHandle_t xMemoryPoolCreateStatic( UBaseType_t uxBlocks, size_t xBlockSize, uint8_t * const pucPoolStorageArea, StaticMemoryPool_t * const pxStaticMemoryPool ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * memory_pool.h
+ *<pre>
+ void *pvMemoryPoolAllocate( MemoryPoolHandle_t xMemoryPool, TickType_t xTicksToWait );
+ </pre>
+ *
+ * Allocates a block from a pool, from a task.
+ *
+ * @param xMemoryPool The pool.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for a block to be freed if the pool is empty.  Setting
+ * xTicksToWait to 0 causes the function to return immediately.  Setting
+ * xTicksToWait to portMAX_DELAY causes the task to wait indefinitely (provided
+ * INCLUDE_vTaskSuspend is set to 1 in FreeRTOSConfig.h).
+ *
+ * @return A pointer to the block, or NULL if no block became free before the
+ * block time expired.  The contents of the block are undefined.
+ *
+ * Example usage:
+   <pre>
+	// The pool created in the xMemoryPoolCreate() example.
+	MemoryPoolHandle_t xRxPool;
+
+	void vRxTask( void *pvParameters )
+	{
+	RxBuffer_t *pxBuffer;
+
+		for( ;; )
+		{
+			// Wait up to 10ms for a buffer rather than fall back to the heap.
+			pxBuffer = ( RxBuffer_t * ) pvMemoryPoolAllocate( xRxPool, pdMS_TO_TICKS( 10 ) );
+
+			if( pxBuffer != NULL )
+			{
+				pxBuffer->usLength = usReceiveFrame( pxBuffer->ucData, sizeof( pxBuffer->ucData ) );
+
+				// The task that processes the buffer frees it.
+				xQueueSend( xProcessQueue, &pxBuffer, portMAX_DELAY );
+			}
+		}
+	}
+   </pre>
+ * \defgroup pvMemoryPoolAllocate pvMemoryPoolAllocate
+ * \ingroup MemoryPool
+ */
+void *pvMemoryPoolAllocate( MemoryPoolHandle_t xMemoryPool, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ *<pre>
+ void *pvMemoryPoolAllocateFromISR( MemoryPoolHandle_t xMemoryPool );
+ </pre>
+ *
+ * Interrupt safe version of pvMemoryPoolAllocate().  Never blocks.
+ *
+ * @return A pointer to the block, or NULL if the pool is empty.
+ *
+ * \defgroup pvMemoryPoolAllocateFromISR pvMemoryPoolAllocateFromISR
+ * \ingroup MemoryPool
+ */
+void *pvMemoryPoolAllocateFromISR( MemoryPoolHandle_t xMemoryPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ *<pre>
+ void vMemoryPoolFree( MemoryPoolHandle_t xMemoryPool, void *pvBlock );
+ </pre>
+ *
+ * Returns a block to the pool it was allocated from, from a task.  If tasks
+ * are waiting for a block then the highest priority of them is woken.
+ *
+ * @param xMemoryPool The pool the block was allocated from.
+ *
+ * @param pvBlock The block, as returned by pvMemoryPoolAllocate() or
+ * pvMemoryPoolAllocateFromISR().
+ *
+ * \defgroup vMemoryPoolFree vMemoryPoolFree
+ * \ingroup MemoryPool
+ */
+void vMemoryPoolFree( MemoryPoolHandle_t xMemoryPool, void *pvBlock ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ *<pre>
+ void vMemoryPoolFreeFromISR( MemoryPoolHandle_t xMemoryPool,
+							  void *pvBlock,
+							  BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Interrupt safe version of vMemoryPoolFree().
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if freeing the block woke a
+ * task that has a priority above the priority of the currently running task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.  pxHigherPriorityTaskWoken is optional and can be NULL.
+ *
+ * Example usage:
+   <pre>
+	void vTxCompleteISR( void )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		// The frame has been sent, so its buffer can be reused.
+		vMemoryPoolFreeFromISR( xTxPool, pvTxBufferDone(), &xHigherPriorityTaskWoken );
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+   </pre>
+ * \defgroup vMemoryPoolFreeFromISR vMemoryPoolFreeFromISR
+ * \ingroup MemoryPool
+ */
+void vMemoryPoolFreeFromISR( MemoryPoolHandle_t xMemoryPool, void *pvBlock, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ *<pre>
+ UBaseType_t uxMemoryPoolGetFreeBlocks( MemoryPoolHandle_t xMemoryPool );
+ </pre>
+ *
+ * Returns the number of blocks in the pool that are not allocated.
+ *
+ * \defgroup uxMemoryPoolGetFreeBlocks uxMemoryPoolGetFreeBlocks
+ * \ingroup MemoryPool
+ */
+UBaseType_t uxMemoryPoolGetFreeBlocks( MemoryPoolHandle_t xMemoryPool ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ *<pre>
+ void vMemoryPoolGetStats( MemoryPoolHandle_t xMemoryPool, MemoryPoolStats_t *pxStats );
+ </pre>
+ *
+ * Copies the statistics of a pool into *pxStats.  Can be called from any task.
+ * uxMaxBlocksInUse is the pool's high water mark - a pool whose
+ * uxMaxBlocksInUse stays below uxBlocks over a representative run has more
+ * blocks than it needs.
+ *
+ * \defgroup vMemoryPoolGetStats vMemoryPoolGetStats
+ * \ingroup MemoryPool
+ */
+void vMemoryPoolGetStats( MemoryPoolHandle_t xMemoryPool, MemoryPoolStats_t * const pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * memory_pool.h
+ *<pre>
+ void vMemoryPoolDelete( MemoryPoolHandle_t xMemoryPool );
+ </pre>
+ *
+ * Deletes a pool.  No task may be waiting to allocate from the pool.  Blocks
+ * that are still allocated must not be used once the pool is deleted, as the
+ * storage is returned to the application.
+ *
+ * \defgroup vMemoryPoolDelete vMemoryPoolDelete
+ * \ingroup MemoryPool
+ */
+void vMemoryPoolDelete( MemoryPoolHandle_t xMemoryPool ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MEMORY_POOL_H */
+
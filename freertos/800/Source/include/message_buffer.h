@@ -0,0 +1,310 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef MESSAGE_BUFFER_H
+#define MESSAGE_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include message_buffer.h"
+#endif
+
+/* Message buffers are built on top of stream buffers. */
+#include "stream_buffer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Message buffers pass discrete, variable length, messages from a single
+ * writer to a single reader.  For example, a message buffer can pass messages
+ * of 10, 20 and 123 bytes, and each read returns one complete message - a
+ * message of 10 bytes sent to a message buffer is received as a single
+ * message of 10 bytes, never as two messages of 5 bytes.
+ *
+ * Message buffers are implemented as stream buffers.  Each message is stored
+ * as a size_t length followed by the message itself, so writing a 10 byte
+ * message to a message buffer actually uses 10 + sizeof( size_t ) bytes of the
+ * buffer's space.  The single writer, single reader, restriction described in
+ * stream_buffer.h also applies to message buffers.
+ *
+ * \defgroup MessageBuffer MessageBuffer
+ */
+
+/**
+ * message_buffer.h
+ *
+ * Type by which message buffers are referenced.
+ *
+ * \defgroup MessageBufferHandle_t MessageBufferHandle_t
+ * \ingroup MessageBuffer
+ */
+typedef void * MessageBufferHandle_t;
+
+/**
+ * message_buffer.h
+ *<pre>
+ MessageBufferHandle_t xMessageBufferCreate( size_t xBufferSizeBytes );
+ </pre>
+ *
+ * Creates a new message buffer.  The memory used by the message buffer is
+ * allocated using pvPortMalloc().
+ *
+ * @param xBufferSizeBytes The total number of bytes (not messages) the message
+ * buffer will be able to hold at any one time, including the length stored
+ * with each message.
+ *
+ * @return If NULL is returned then there was insufficient heap memory
+ * available to create the message buffer, otherwise the handle of the new
+ * message buffer is returned.
+ *
+ * \defgroup xMessageBufferCreate xMessageBufferCreate
+ * \ingroup MessageBuffer
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xMessageBufferCreate( xBufferSizeBytes ) ( MessageBufferHandle_t ) xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( size_t ) 0, pdTRUE )
+#endif
+
+/**
+ * message_buffer.h
+ *<pre>
+ MessageBufferHandle_t xMessageBufferCreateStatic( size_t xBufferSizeBytes,
+												   uint8_t *pucMessageBufferStorageArea,
+												   StaticMessageBuffer_t *pxStaticMessageBuffer );
+ </pre>
+ *
+ * Creates a new message buffer using memory supplied by the application.
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xMessageBufferCreateStatic() to be available.
+ *
+ * @param xBufferSizeBytes As per xMessageBufferCreate().
+ *
+ * @param pucMessageBufferStorageArea Must point to a uint8_t array that is at
+ * least xBufferSizeBytes + 1 bytes long.
+ *
+ * @param pxStaticMessageBuffer Must point to a variable of type
+ * StaticMessageBuffer_t, which will be used to hold the message buffer's data
+ * structure.
+ *
+ * @return If the message buffer is created successfully then a handle to the
+ * created message buffer is returned.  If either pucMessageBufferStorageArea or
+ * pxStaticMessageBuffer are NULL then NULL is returned.
+ *
+ * \defgroup xMessageBufferCreateStatic xMessageBufferCreateStatic
+ * \ingroup MessageBuffer
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xMessageBufferCreateStatic( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) ( MessageBufferHandle_t ) xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( size_t ) 0, pdTRUE, ( pucMessageBufferStorageArea ), ( pxStaticMessageBuffer ) )
+#endif
+
+/**
+ * message_buffer.h
+ *<pre>
+ size_t xMessageBufferSend( MessageBufferHandle_t xMessageBuffer,
+							const void *pvTxData,
+							size_t xDataLengthBytes,
+							TickType_t xTicksToWait );
+ </pre>
+ *
+ * Sends a discrete message to the message buffer.  The message is copied into
+ * the message buffer.
+ *
+ * Use xMessageBufferSend() to write to a message buffer from a task.  Use
+ * xMessageBufferSendFromISR() to write to a message buffer from an interrupt
+ * service routine (ISR).
+ *
+ * @param xMessageBuffer The handle of the message buffer to which a message is
+ * being sent.
+ *
+ * @param pvTxData A pointer to the message that is to be copied into the
+ * message buffer.
+ *
+ * @param xDataLengthBytes The length of the message.  That is, the number of
+ * bytes to copy from pvTxData into the message buffer.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should remain
+ * in the Blocked state to wait for enough space to become available in the
+ * message buffer, should the message buffer have insufficient space when
+ * xMessageBufferSend() is called.  Unlike a stream buffer, a message is either
+ * written in its entirety or not at all.
+ *
+ * @return The number of bytes written to the message buffer.  If the call to
+ * xMessageBufferSend() times out before there was enough space to write the
+ * message into the message buffer then zero is returned.
+ *
+ * \defgroup xMessageBufferSend xMessageBufferSend
+ * \ingroup MessageBuffer
+ */
+#define xMessageBufferSend( xMessageBuffer, pvTxData, xDataLengthBytes, xTicksToWait ) xStreamBufferSend( ( StreamBufferHandle_t ) xMessageBuffer, pvTxData, xDataLengthBytes, xTicksToWait )
+
+/**
+ * message_buffer.h
+ *<pre>
+ size_t xMessageBufferSendFromISR( MessageBufferHandle_t xMessageBuffer,
+								   const void *pvTxData,
+								   size_t xDataLengthBytes,
+								   BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Interrupt safe version of xMessageBufferSend().  If there is not enough
+ * space for the whole message then nothing is written and zero is returned.
+ *
+ * \defgroup xMessageBufferSendFromISR xMessageBufferSendFromISR
+ * \ingroup MessageBuffer
+ */
+#define xMessageBufferSendFromISR( xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferSendFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *<pre>
+ size_t xMessageBufferReceive( MessageBufferHandle_t xMessageBuffer,
+							   void *pvRxData,
+							   size_t xBufferLengthBytes,
+							   TickType_t xTicksToWait );
+ </pre>
+ *
+ * Receives a discrete message from a message buffer.  Messages can be of
+ * variable length and are copied out of the buffer.
+ *
+ * @param xMessageBuffer The handle of the message buffer from which a message
+ * is being received.
+ *
+ * @param pvRxData A pointer to the buffer into which the received message is
+ * to be copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ * If the next message is longer than xBufferLengthBytes then the message is
+ * left in the message buffer and zero is returned.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for a message, should the message buffer be empty.
+ *
+ * @return The length, in bytes, of the message read from the message buffer,
+ * if any.
+ *
+ * Example usage:
+   <pre>
+	void vAFunction( MessageBufferHandle_t xMessageBuffer )
+	{
+	uint8_t ucRxData[ 20 ];
+	size_t xReceivedBytes;
+	const TickType_t xBlockTime = pdMS_TO_TICKS( 20 );
+
+		// Receive the next message from the message buffer.  Wait in the
+		// Blocked state (so not using any CPU processing time) for a maximum
+		// of 20ms for a message to become available.
+		xReceivedBytes = xMessageBufferReceive( xMessageBuffer, ( void * ) ucRxData, sizeof( ucRxData ), xBlockTime );
+
+		if( xReceivedBytes > 0 )
+		{
+			// A ucRxData contains a message that is xReceivedBytes long.
+		}
+	}
+   </pre>
+ * \defgroup xMessageBufferReceive xMessageBufferReceive
+ * \ingroup MessageBuffer
+ */
+#define xMessageBufferReceive( xMessageBuffer, pvRxData, xBufferLengthBytes, xTicksToWait ) xStreamBufferReceive( ( StreamBufferHandle_t ) xMessageBuffer, pvRxData, xBufferLengthBytes, xTicksToWait )
+
+/**
+ * message_buffer.h
+ *<pre>
+ size_t xMessageBufferReceiveFromISR( MessageBufferHandle_t xMessageBuffer,
+									  void *pvRxData,
+									  size_t xBufferLengthBytes,
+									  BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * An interrupt safe version of xMessageBufferReceive().  Never blocks.
+ *
+ * \defgroup xMessageBufferReceiveFromISR xMessageBufferReceiveFromISR
+ * \ingroup MessageBuffer
+ */
+#define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) xStreamBufferReceiveFromISR( ( StreamBufferHandle_t ) xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken )
+
+/**
+ * message_buffer.h
+ *
+ * Delete, reset and query a message buffer.  These behave as the equivalent
+ * stream buffer functions.  xMessageBufferSpaceAvailable() returns the free
+ * space in bytes - the largest message that can be written is
+ * sizeof( size_t ) bytes smaller.
+ *
+ * \defgroup vMessageBufferDelete vMessageBufferDelete
+ * \ingroup MessageBuffer
+ */
+#define vMessageBufferDelete( xMessageBuffer ) vStreamBufferDelete( ( StreamBufferHandle_t ) xMessageBuffer )
+#define xMessageBufferIsFull( xMessageBuffer ) xStreamBufferIsFull( ( StreamBufferHandle_t ) xMessageBuffer )
+#define xMessageBufferIsEmpty( xMessageBuffer ) xStreamBufferIsEmpty( ( StreamBufferHandle_t ) xMessageBuffer )
+#define xMessageBufferReset( xMessageBuffer ) xStreamBufferReset( ( StreamBufferHandle_t ) xMessageBuffer )
+#define xMessageBufferSpaceAvailable( xMessageBuffer ) xStreamBufferSpacesAvailable( ( StreamBufferHandle_t ) xMessageBuffer )
+#define xMessageBufferNextLengthBytes( xMessageBuffer ) xStreamBufferNextMessageLengthBytes( ( StreamBufferHandle_t ) xMessageBuffer )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MESSAGE_BUFFER_H */
+
@@ -363,6 +363,37 @@ extern "C" {
 	StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters ) PRIVILEGED_FUNCTION;
 #endif
 
+/* The attributes of a heap region, used by heap_regions.c.  Bits above
+portHEAP_ATTRIBUTE_BULK are free for the application to define. */
+#define portHEAP_ATTRIBUTE_FAST		( ( UBaseType_t ) 0x01 ) /* Memory with no wait states, such as core coupled memory. */
+#define portHEAP_ATTRIBUTE_DMA		( ( UBaseType_t ) 0x02 ) /* Memory the DMA controllers can reach. */
+#define portHEAP_ATTRIBUTE_BULK		( ( UBaseType_t ) 0x04 ) /* Large but slow memory, such as an external SDRAM. */
+
+/* Used by heap_tlsf.c and heap_regions.c to define the start address and size
+of each memory region, in addition to their own heap array, that together make
+up the total FreeRTOS heap space.  uxAttributes is only used by
+heap_regions.c. */
+typedef struct HeapRegion
+{
+	uint8_t *pucStartAddress;
+	size_t xSizeInBytes;
+	UBaseType_t uxAttributes;
+} HeapRegion_t;
+
+/*
+ * Used to add memory regions to the heap when heap_tlsf.c or heap_regions.c is
+ * used.  The array is terminated by a HeapRegion_t structure that has a size
+ * of 0.  The regions must not overlap each other or the heap array.
+ */
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
+
+/*
+ * Allocate memory from a region that has the attributes in uxHints.  See
+ * heap_regions.c for which attributes are requirements and which are only
+ * preferences.  Only provided by heap_regions.c.
+ */
+void *pvPortMallocWithHints( size_t xSize, UBaseType_t uxHints ) PRIVILEGED_FUNCTION;
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -372,6 +403,52 @@ void vPortInitialiseBlocks( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns the size of the largest free block, including the block's header,
+ * so it can be compared with xPortGetFreeHeapSize() to judge fragmentation.
+ * Not provided by heap_3.c.
+ */
+size_t xPortGetLargestFreeBlockSize( void ) PRIVILEGED_FUNCTION;
+
+/* How one region of heap_regions.c is being used. */
+typedef struct HEAP_REGION_STATS
+{
+	uint8_t *pucStartAddress;		/*<< The first byte of the region that is used, once aligned. */
+	size_t xSizeInBytes;			/*<< The number of bytes of the region that are used. */
+	UBaseType_t uxAttributes;		/*<< The attributes the region was added with. */
+	size_t xFreeBytes;				/*<< The number of free bytes in the region. */
+	size_t xMinimumEverFreeBytes;	/*<< The smallest number of free bytes the region has had. */
+	size_t xLargestFreeBlock;		/*<< The size of the largest free block, including its header. */
+	UBaseType_t uxAllocatedBlocks;	/*<< The number of blocks allocated from the region. */
+} HeapRegionStats_t;
+
+/*
+ * Return the number of regions, and how the region uxRegion (from 0, which is
+ * the heap array, to one less than the number of regions) is being used.  Only
+ * provided by heap_regions.c.
+ */
+UBaseType_t uxPortGetHeapRegionCount( void ) PRIVILEGED_FUNCTION;
+void vPortGetHeapRegionStats( UBaseType_t uxRegion, HeapRegionStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/* How one size class of heap_slab.c is being used. */
+typedef struct SLAB_CLASS_STATS
+{
+	size_t xObjectSize;					/*<< The largest request the class satisfies. */
+	UBaseType_t uxObjectsInUse;			/*<< The number of objects currently allocated. */
+	UBaseType_t uxMaximumObjectsInUse;	/*<< The largest number of objects that have been allocated at once. */
+	UBaseType_t uxObjectsFree;			/*<< The number of objects in the class's free list. */
+	UBaseType_t uxSlabs;				/*<< The number of slabs taken from the backing heap. */
+	uint32_t ulAllocations;				/*<< The number of requests the class has satisfied. */
+} SlabClassStats_t;
+
+/*
+ * Return the number of size classes, and how the size class uxClass (from 0
+ * to one less than the number of classes) is being used.  Only provided by
+ * heap_slab.c.
+ */
+UBaseType_t uxPortGetSlabClassCount( void ) PRIVILEGED_FUNCTION;
+void vPortGetSlabClassStats( UBaseType_t uxClass, SlabClassStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
 /*
  * Setup the hardware ready for the scheduler to take control.  This generally
  * sets up a tick interrupt and sets timers for the correct tick frequency.
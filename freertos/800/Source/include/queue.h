@@ -101,6 +101,12 @@ typedef void * QueueSetMemberHandle_t;
 #define	queueSEND_TO_BACK		( ( BaseType_t ) 0 )
 #define	queueSEND_TO_FRONT		( ( BaseType_t ) 1 )
 #define queueOVERWRITE			( ( BaseType_t ) 2 )
+#define queueRESERVE			( ( BaseType_t ) 3 )
+
+/* For internal use only.  Passed as the xJustPeek parameter of
+xQueueGenericReceive() to obtain a reference to an item rather than a copy. */
+#define queueRECEIVE_REFERENCE	( ( BaseType_t ) 2 )
+#define queuePEEK_REFERENCE		( ( BaseType_t ) 3 )
 
 /* For internal use only.  These definitions *must* match those in queue.c. */
 #define queueQUEUE_TYPE_BASE				( ( uint8_t ) 0U )
@@ -166,7 +172,86 @@ typedef void * QueueSetMemberHandle_t;
  * \defgroup xQueueCreate xQueueCreate
  * \ingroup QueueManagement
  */
-#define xQueueCreate( uxQueueLength, uxItemSize ) xQueueGenericCreate( uxQueueLength, uxItemSize, queueQUEUE_TYPE_BASE )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xQueueCreate( uxQueueLength, uxItemSize ) xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_BASE ) )
+#endif
+
+/**
+ * queue. h
+ * <pre>
+ QueueHandle_t xQueueCreateStatic(
+							  UBaseType_t uxQueueLength,
+							  UBaseType_t uxItemSize,
+							  uint8_t *pucQueueStorageBuffer,
+							  StaticQueue_t *pxQueueBuffer
+						  );
+ * </pre>
+ *
+ * Creates a new queue instance using memory supplied by the application,
+ * rather than memory allocated from the FreeRTOS heap, and returns a handle
+ * for the queue.  configSUPPORT_STATIC_ALLOCATION must be set to 1 in
+ * FreeRTOSConfig.h for xQueueCreateStatic() to be available.
+ *
+ * @param uxQueueLength The maximum number of items that the queue can contain.
+ *
+ * @param uxItemSize The number of bytes each item in the queue will require.
+ * Items are queued by copy, not by reference, so this is the number of bytes
+ * that will be copied for each posted item.  Each item on the queue must be
+ * the same size.
+ *
+ * @param pucQueueStorageBuffer If uxItemSize is not zero then
+ * pucQueueStorageBuffer must point to a uint8_t array that is at least large
+ * enough to hold the maximum number of items that can be in the queue at any
+ * one time - which is ( uxQueueLength * uxItemsSize ) bytes.  If uxItemSize is
+ * zero then pucQueueStorageBuffer can be NULL.
+ *
+ * @param pxQueueBuffer Must point to a variable of type StaticQueue_t, which
+ * will be used to hold the queue's data structure.
+ *
+ * @return If the queue is created then a handle to the created queue is
+ * returned.  If pxQueueBuffer is NULL then NULL is returned.  The memory is
+ * not freed if the queue is later deleted.
+ *
+ * Example usage:
+   <pre>
+ struct AMessage
+ {
+	char ucMessageID;
+	char ucData[ 20 ];
+ };
+
+ #define QUEUE_LENGTH 10
+ #define ITEM_SIZE sizeof( uint32_t )
+
+ // xQueueBuffer will hold the queue structure.
+ StaticQueue_t xQueueBuffer;
+
+ // ucQueueStorage will hold the items posted to the queue.  Must be at least
+ // [(queue length) * ( queue item size)] bytes long.
+ uint8_t ucQueueStorage[ QUEUE_LENGTH * ITEM_SIZE ];
+
+ void vATask( void *pvParameters )
+ {
+ QueueHandle_t xQueue1;
+
+	// Create a queue capable of containing 10 uint32_t values.
+	xQueue1 = xQueueCreateStatic( QUEUE_LENGTH, // The number of items the queue can hold.
+							ITEM_SIZE	  // The size of each item in the queue
+							&( ucQueueStorage[ 0 ] ), // The buffer that will hold the items in the queue.
+							&xQueueBuffer ); // The buffer that will hold the queue structure.
+
+	// The queue is guaranteed to be created successfully as no dynamic memory
+	// allocation is used.  Therefore xQueue1 is now a handle to a valid queue.
+
+	// ... Rest of task code.
+ }
+ </pre>
+ * \defgroup xQueueCreateStatic xQueueCreateStatic
+ * \ingroup QueueManagement
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer ) xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_BASE ) )
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
 /**
  * queue. h
@@ -1431,6 +1516,264 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue ) PRIVILEGED_FU
 BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
 
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReserve(
+							  QueueHandle_t xQueue,
+							  void **ppvSlot,
+							  TickType_t xTicksToWait
+						  );
+ * </pre>
+ *
+ * Reserve the next slot at the back of a queue so an item can be written
+ * directly into the queue's storage, rather than being built in a buffer and
+ * then copied into the queue by xQueueSend().  The item is not added to the
+ * queue, and so cannot be received, until xQueueCommit() is called.
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for this
+ * macro to be available.
+ *
+ * Only one slot in a queue can be reserved at a time.  While a slot is
+ * reserved other tasks that send to the back of the queue, or try to reserve
+ * a slot, block as if the queue were full, so items are received in the order
+ * in which their slots were reserved.  Items can still be sent to the front of
+ * the queue.  The reserved slot does not count as free space.
+ *
+ * This is a macro that calls xQueueGenericSend(), so blocks in exactly the
+ * same way as xQueueSendToBack().  It must not be used on a queue used by
+ * co-routines, on a queue that is written with xQueueOverwrite(), or on a
+ * semaphore.
+ *
+ * @param xQueue The handle to the queue in which the slot is to be reserved.
+ *
+ * @param ppvSlot The address of a pointer that is set to the reserved slot.
+ * uxItemSize bytes can be written to the slot before xQueueCommit() is called.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for a slot to become available, should the queue be full or another slot
+ * already be reserved.
+ *
+ * @return pdTRUE if a slot was reserved, otherwise errQUEUE_FULL.
+ *
+ * Example usage:
+   <pre>
+ #define frameSIZE 256
+
+ void vSensorTask( void *pvParameters )
+ {
+ QueueHandle_t xFrameQueue = ( QueueHandle_t ) pvParameters;
+ uint8_t *pucFrame;
+
+	for( ;; )
+	{
+		// Wait for space in the queue, then read the next frame straight
+		// into it.
+		if( xQueueReserve( xFrameQueue, ( void ** ) &pucFrame, portMAX_DELAY ) == pdPASS )
+		{
+			vReadSensorFrame( pucFrame, frameSIZE );
+			xQueueCommit( xFrameQueue );
+		}
+	}
+ }
+
+ void vProcessingTask( void *pvParameters )
+ {
+ QueueHandle_t xFrameQueue = ( QueueHandle_t ) pvParameters;
+ const uint8_t *pucFrame;
+
+	for( ;; )
+	{
+		// Process each frame where it is stored in the queue, then release
+		// the slot so the sensor task can use it again.
+		if( xQueueReceiveReference( xFrameQueue, ( void ** ) &pucFrame, portMAX_DELAY ) == pdPASS )
+		{
+			vProcessFrame( pucFrame, frameSIZE );
+			xQueueReleaseReference( xFrameQueue );
+		}
+	}
+ }
+ </pre>
+ * \defgroup xQueueReserve xQueueReserve
+ * \ingroup QueueManagement
+ */
+#define xQueueReserve( xQueue, ppvSlot, xTicksToWait ) xQueueGenericSend( ( xQueue ), ( ppvSlot ), ( xTicksToWait ), queueRESERVE )
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReserveFromISR(
+									 QueueHandle_t xQueue,
+									 void **ppvSlot
+								 );
+ * </pre>
+ *
+ * A version of xQueueReserve() that can be called from an interrupt service
+ * routine.  It returns errQUEUE_FULL immediately if no slot can be reserved.
+ * The slot can be committed from either an interrupt or a task.
+ *
+ * \defgroup xQueueReserveFromISR xQueueReserveFromISR
+ * \ingroup QueueManagement
+ */
+#define xQueueReserveFromISR( xQueue, ppvSlot ) xQueueGenericSendFromISR( ( xQueue ), ( ppvSlot ), NULL, queueRESERVE )
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueCommit( QueueHandle_t xQueue );
+ * </pre>
+ *
+ * Add the item written into the slot reserved by xQueueReserve() to the back
+ * of the queue.  Tasks blocked waiting to receive from the queue, or to send to
+ * it while the slot was reserved, are unblocked as they would be by
+ * xQueueSendToBack().
+ *
+ * @param xQueue The handle to the queue that contains the reserved slot.
+ *
+ * @return pdPASS if the item was added, or pdFAIL if no slot was reserved.
+ *
+ * \defgroup xQueueCommit xQueueCommit
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueCommit( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueCommitFromISR(
+									QueueHandle_t xQueue,
+									BaseType_t *pxHigherPriorityTaskWoken
+								);
+ * </pre>
+ *
+ * A version of xQueueCommit() that can be called from an interrupt service
+ * routine.  *pxHigherPriorityTaskWoken is set to pdTRUE if committing the item
+ * unblocked a task with a priority higher than the running task, in which case
+ * a context switch should be requested before the interrupt is exited.
+ *
+ * \defgroup xQueueCommitFromISR xQueueCommitFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueCommitFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveReference(
+									   QueueHandle_t xQueue,
+									   void **ppvItem,
+									   TickType_t xTicksToWait
+								   );
+ * </pre>
+ *
+ * Receive an item from a queue without copying it.  The item is removed from
+ * the queue, but its slot is not reused until xQueueReleaseReference() is
+ * called, so it can be read (or modified) where it is stored.
+ * configUSE_QUEUE_ZERO_COPY must be set to 1 in FreeRTOSConfig.h for this
+ * macro to be available.
+ *
+ * Only one reference to a queue's items can be held at a time.  While it is
+ * held other tasks that receive from or peek the queue block as if it were
+ * empty, and other tasks that send to the front of the queue block as if it
+ * were full.  Items can still be sent to the back of the queue.
+ *
+ * This is a macro that calls xQueueGenericReceive(), so blocks in exactly the
+ * same way as xQueueReceive().  See xQueueReserve() for an example.
+ *
+ * @param xQueue The handle to the queue from which the item is to be received.
+ *
+ * @param ppvItem The address of a pointer that is set to the received item.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item to receive should the queue be empty or another reference
+ * already be held.
+ *
+ * @return pdTRUE if an item was received, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xQueueReceiveReference xQueueReceiveReference
+ * \ingroup QueueManagement
+ */
+#define xQueueReceiveReference( xQueue, ppvItem, xTicksToWait ) xQueueGenericReceive( ( xQueue ), ( ppvItem ), ( xTicksToWait ), queueRECEIVE_REFERENCE )
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueuePeekReference(
+									QueueHandle_t xQueue,
+									void **ppvItem,
+									TickType_t xTicksToWait
+								);
+ * </pre>
+ *
+ * As xQueueReceiveReference(), but the item is left in the queue.  It is
+ * received by the next call to xQueueReceive() or xQueueReceiveReference()
+ * after the reference has been released with xQueueReleaseReference().
+ *
+ * \defgroup xQueuePeekReference xQueuePeekReference
+ * \ingroup QueueManagement
+ */
+#define xQueuePeekReference( xQueue, ppvItem, xTicksToWait ) xQueueGenericReceive( ( xQueue ), ( ppvItem ), ( xTicksToWait ), queuePEEK_REFERENCE )
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReceiveReferenceFromISR(
+											  QueueHandle_t xQueue,
+											  void **ppvItem
+										  );
+ * </pre>
+ *
+ * A version of xQueueReceiveReference() that can be called from an interrupt
+ * service routine.  It returns pdFAIL immediately if the queue is empty or a
+ * reference is already held.  Removing an item without releasing its slot
+ * cannot unblock a task, so there is no pxHigherPriorityTaskWoken parameter.
+ *
+ * \defgroup xQueueReceiveReferenceFromISR xQueueReceiveReferenceFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReceiveReferenceFromISR( QueueHandle_t xQueue, void ** const ppvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReleaseReference( QueueHandle_t xQueue );
+ * </pre>
+ *
+ * Release the reference obtained by xQueueReceiveReference() or
+ * xQueuePeekReference().  The item must not be accessed once it has been
+ * released.  A task blocked waiting to send to the queue and a task blocked
+ * waiting to receive from the queue are unblocked if there are any.
+ *
+ * @param xQueue The handle to the queue from which the reference was obtained.
+ *
+ * @return pdPASS if a reference was released, or pdFAIL if no reference was
+ * held.
+ *
+ * \defgroup xQueueReleaseReference xQueueReleaseReference
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReleaseReference( QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * <pre>
+ BaseType_t xQueueReleaseReferenceFromISR(
+											  QueueHandle_t xQueue,
+											  BaseType_t *pxHigherPriorityTaskWoken
+										  );
+ * </pre>
+ *
+ * A version of xQueueReleaseReference() that can be called from an interrupt
+ * service routine.
+ *
+ * \defgroup xQueueReleaseReferenceFromISR xQueueReleaseReferenceFromISR
+ * \ingroup QueueManagement
+ */
+BaseType_t xQueueReleaseReferenceFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+
 
 /*
  * xQueueAltGenericSend() is an alternative version of xQueueGenericSend().
@@ -1473,7 +1816,9 @@ BaseType_t xQueueCRReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTi
  * these functions directly.
  */
 QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 void* xQueueGetMutexHolder( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 
 /*
@@ -1537,6 +1882,13 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t pxMutex ) PRIVILEGED_FUNCTION
  */
 QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
 
+/*
+ * Generic version of the static queue creation function, which is in turn
+ * called by any statically allocated queue, semaphore or mutex creation
+ * function or macro.
+ */
+QueueHandle_t xQueueGenericCreateStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticQueue_t *pxStaticQueue, const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+
 /*
  * Queue sets provide a mechanism to allow a task to block (pend) on a read
  * operation from multiple queues or semaphores simultaneously.
@@ -1566,6 +1918,16 @@ QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseT
  * semaphore) operation must not be performed on a member of a queue set unless
  * a call to xQueueSelectFromSet() has first returned a handle to that set member.
  *
+ * Note 5:  If configUSE_QUEUE_SET_READY_LIST is set to 1 in FreeRTOSConfig.h
+ * then the set holds a list of the members that are not empty instead of a
+ * queue of events, so adding, removing and selecting a member take the same
+ * time however many members the set has, and Note 3 does not apply.  Each
+ * selection of a member still allows one item to be received from it, but
+ * members are selected in about, rather than exactly, the order data was sent
+ * to them.
+ * uxEventQueueLength is not used, and uxQueueMessagesWaiting() returns the
+ * number of ready members.
+ *
  * @param uxEventQueueLength Queue sets store events that occur on
  * the queues and semaphores contained in the set.  uxEventQueueLength specifies
  * the maximum number of events that can be queued at once.  To be absolutely
@@ -1671,6 +2033,28 @@ QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet, const Ti
  */
 QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet ) PRIVILEGED_FUNCTION;
 
+/*
+ * A version of xQueueSelectFromSet() that selects up to uxMaxMembers members
+ * of the set at once, so a task can read from every member that is ready each
+ * time it unblocks.  Each member is selected at most once.  Only available if
+ * configUSE_QUEUE_SET_READY_LIST is set to 1 in FreeRTOSConfig.h.
+ *
+ * @param xQueueSet The queue set on which the task will (potentially) block.
+ *
+ * @param pxMembers The array the handles of the selected members are written
+ * to.
+ *
+ * @param uxMaxMembers The length of the pxMembers array.
+ *
+ * @param xTicksToWait The maximum time, in ticks, that the calling task will
+ * remain in the Blocked state to wait for a member of the queue set to be
+ * ready.
+ *
+ * @return The number of handles written to pxMembers, which is zero if no
+ * member became ready before the block time expired.
+ */
+UBaseType_t uxQueueSelectMultipleFromSet( QueueSetHandle_t xQueueSet, QueueSetMemberHandle_t * const pxMembers, const UBaseType_t uxMaxMembers, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /* Not public API functions. */
 void vQueueWaitForMessageRestricted( QueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueGenericReset( QueueHandle_t xQueue, BaseType_t xNewQueue ) PRIVILEGED_FUNCTION;
@@ -0,0 +1,359 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include ring_queue.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Ring queues pass fixed size items from interrupts (or tasks) to a single
+ * reader without ever entering a critical section or masking interrupts.
+ * Unlike a queue, which protects its state with taskENTER_CRITICAL() or
+ * portSET_INTERRUPT_MASK_FROM_ISR(), a ring queue is updated with the port's
+ * lock free primitives - portCOMPARE_AND_SWAP() and portMEMORY_BARRIER() -
+ * so writing to a ring queue from a low priority interrupt never delays a
+ * higher priority interrupt.
+ *
+ * A ring queue is created with either a single producer or multiple
+ * producers:
+ *
+ * + A single producer ring queue must only ever be written by one task or one
+ *   interrupt at a time.  It is the cheapest to write to and read from.
+ *
+ * + A multiple producer ring queue can be written by any number of tasks and
+ *   interrupts at once.  Each producer claims a slot with a compare and swap.
+ *   An item that is claimed by a producer that is then interrupted does not
+ *   become visible to the reader, and nor do any items written after it, until
+ *   the interrupted producer completes its write.
+ *
+ * In both cases there must only be one reader.
+ *
+ * The reader can optionally block to wait for an item, in which case it is
+ * woken using its direct to task notification.  Only a producer that finds the
+ * reader waiting calls into the kernel, so an interrupt that runs above
+ * configMAX_SYSCALL_INTERRUPT_PRIORITY can write to a ring queue provided the
+ * reader never blocks on it.
+ *
+ * \defgroup RingQueue RingQueue
+ */
+
+/**
+ * ring_queue.h
+ *
+ * Type by which ring queues are referenced.  For example, a call to
+ * xRingQueueCreate() returns a RingQueueHandle_t variable that can then be used
+ * as a parameter to xRingQueueSendFromISR(), xRingQueueReceive(), etc.
+ *
+ * \defgroup RingQueueHandle_t RingQueueHandle_t
+ * \ingroup RingQueue
+ */
+typedef void * RingQueueHandle_t;
+
+/**
+ * ring_queue.h
+ *<pre>
+ RingQueueHandle_t xRingQueueCreate( UBaseType_t uxLength, UBaseType_t uxItemSize );
+ RingQueueHandle_t xRingQueueCreateMultiProducer( UBaseType_t uxLength, UBaseType_t uxItemSize );
+ </pre>
+ *
+ * Creates a new ring queue that has a single producer, or that has multiple
+ * producers.  The memory used by the ring queue is allocated using
+ * pvPortMalloc().
+ *
+ * @param uxLength The maximum number of items the ring queue can hold at any
+ * one time.  Must be a power of two.
+ *
+ * @param uxItemSize The size, in bytes, of each item.  Items are copied into
+ * and out of the ring queue.
+ *
+ * @return If NULL is returned, then the ring queue cannot be created because
+ * there is insufficient heap memory available.  Otherwise the handle of the
+ * created ring queue is returned.
+ *
+ * Example usage:
+   <pre>
+	RingQueueHandle_t xRingQueue;
+
+	// Create a ring queue that can hold 64 uint32_t values written by any
+	// number of interrupts.
+	xRingQueue = xRingQueueCreateMultiProducer( 64, sizeof( uint32_t ) );
+
+	if( xRingQueue == NULL )
+	{
+		// There was not enough heap memory space available to create the
+		// ring queue.
+	}
+   </pre>
+ * \defgroup xRingQueueCreate xRingQueueCreate
+ * \ingroup RingQueue
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xRingQueueCreate( uxLength, uxItemSize ) xRingQueueGenericCreate( ( uxLength ), ( uxItemSize ), pdFALSE )
+	#define xRingQueueCreateMultiProducer( uxLength, uxItemSize ) xRingQueueGenericCreate( ( uxLength ), ( uxItemSize ), pdTRUE )
+#endif
+
+/**
+ * ring_queue.h
+ *<pre>
+ RingQueueHandle_t xRingQueueCreateStatic( UBaseType_t uxLength,
+										   UBaseType_t uxItemSize,
+										   uint8_t *pucRingQueueStorageArea,
+										   StaticRingQueue_t *pxStaticRingQueue );
+
+ RingQueueHandle_t xRingQueueCreateMultiProducerStatic( UBaseType_t uxLength,
+														UBaseType_t uxItemSize,
+														uint8_t *pucRingQueueStorageArea,
+														UBaseType_t *puxSequenceStorageArea,
+														StaticRingQueue_t *pxStaticRingQueue );
+ </pre>
+ *
+ * Creates a new ring queue, as per xRingQueueCreate() and
+ * xRingQueueCreateMultiProducer(), but using memory supplied by the
+ * application instead of memory allocated from the FreeRTOS heap.
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * these macros to be available.
+ *
+ * @param pucRingQueueStorageArea Must point to a uint8_t array that is at
+ * least ( uxLength * uxItemSize ) bytes long.
+ *
+ * @param puxSequenceStorageArea Must point to a UBaseType_t array that is at
+ * least uxLength entries long.  Each slot of a multiple producer ring queue
+ * has a sequence number that records whether the slot is free, claimed or
+ * written.
+ *
+ * @param pxStaticRingQueue Must point to a variable of type
+ * StaticRingQueue_t, which will be used to hold the ring queue's data
+ * structure.
+ *
+ * @return If the ring queue is created successfully then a handle to the
+ * created ring queue is returned.  If any of the storage areas are NULL then
+ * NULL is returned.
+ *
+ * \defgroup xRingQueueCreateStatic xRingQueueCreateStatic
+ * \ingroup RingQueue
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xRingQueueCreateStatic( uxLength, uxItemSize, pucRingQueueStorageArea, pxStaticRingQueue ) xRingQueueGenericCreateStatic( ( uxLength ), ( uxItemSize ), pdFALSE, ( pucRingQueueStorageArea ), NULL, ( pxStaticRingQueue ) )
+	#define xRingQueueCreateMultiProducerStatic( uxLength, uxItemSize, pucRingQueueStorageArea, puxSequenceStorageArea, pxStaticRingQueue ) xRingQueueGenericCreateStatic( ( uxLength ), ( uxItemSize ), pdTRUE, ( pucRingQueueStorageArea ), ( puxSequenceStorageArea ), ( pxStaticRingQueue ) )
+#endif
+
+/**
+ * ring_queue.h
+ *<pre>
+ BaseType_t xRingQueueSend( RingQueueHandle_t xRingQueue, const void *pvItemToQueue );
+ </pre>
+ *
+ * Copies an item into a ring queue from a task.  Never blocks.
+ *
+ * @param xRingQueue The handle of the ring queue to which the item is sent.
+ *
+ * @param pvItemToQueue A pointer to the item to copy into the ring queue.
+ *
+ * @return pdPASS if the item was written, or errQUEUE_FULL if the ring queue
+ * was full.
+ *
+ * \defgroup xRingQueueSend xRingQueueSend
+ * \ingroup RingQueue
+ */
+BaseType_t xRingQueueSend( RingQueueHandle_t xRingQueue, const void * const pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *<pre>
+ BaseType_t xRingQueueSendFromISR( RingQueueHandle_t xRingQueue,
+								   const void *pvItemToQueue,
+								   BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Interrupt safe version of xRingQueueSend().  Interrupts are not masked
+ * unless the reader is blocked on the ring queue and has to be woken.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if writing the item unblocked
+ * a task that has a priority above the priority of the currently running task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.  pxHigherPriorityTaskWoken is optional and can be NULL.
+ *
+ * @return pdPASS if the item was written, or errQUEUE_FULL if the ring queue
+ * was full.
+ *
+ * Example usage:
+   <pre>
+	// A ring queue of uint16_t that has already been created.
+	RingQueueHandle_t xRingQueue;
+
+	void vAnInterruptServiceRoutine( void )
+	{
+	uint16_t usSample;
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		// Read the sample from the peripheral, then pass it to the task that
+		// processes it.
+		usSample = usReadADC();
+
+		if( xRingQueueSendFromISR( xRingQueue, &usSample, &xHigherPriorityTaskWoken ) != pdPASS )
+		{
+			// The task has fallen behind and the sample has been lost.
+		}
+
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+   </pre>
+ * \defgroup xRingQueueSendFromISR xRingQueueSendFromISR
+ * \ingroup RingQueue
+ */
+BaseType_t xRingQueueSendFromISR( RingQueueHandle_t xRingQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *<pre>
+ BaseType_t xRingQueueReceive( RingQueueHandle_t xRingQueue,
+							   void *pvBuffer,
+							   TickType_t xTicksToWait );
+ </pre>
+ *
+ * Copies the oldest item out of a ring queue, from a task.
+ *
+ * @param xRingQueue The handle of the ring queue from which the item is
+ * received.
+ *
+ * @param pvBuffer A pointer to the buffer into which the item is copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for an item, should the ring queue be empty.  The task
+ * waits using its direct to task notification, so xTicksToWait must be 0 if
+ * configUSE_TASK_NOTIFICATIONS is 0, or if the ring queue is written by an
+ * interrupt that runs above configMAX_SYSCALL_INTERRUPT_PRIORITY.
+ *
+ * @return pdPASS if an item was received, or errQUEUE_EMPTY if the ring queue
+ * remained empty for xTicksToWait ticks.
+ *
+ * \defgroup xRingQueueReceive xRingQueueReceive
+ * \ingroup RingQueue
+ */
+BaseType_t xRingQueueReceive( RingQueueHandle_t xRingQueue, void * const pvBuffer, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *<pre>
+ BaseType_t xRingQueueReceiveFromISR( RingQueueHandle_t xRingQueue, void *pvBuffer );
+ </pre>
+ *
+ * Interrupt safe version of xRingQueueReceive(), for when the reader is an
+ * interrupt.  Never blocks.
+ *
+ * @return pdPASS if an item was received, or errQUEUE_EMPTY if the ring queue
+ * was empty.
+ *
+ * \defgroup xRingQueueReceiveFromISR xRingQueueReceiveFromISR
+ * \ingroup RingQueue
+ */
+BaseType_t xRingQueueReceiveFromISR( RingQueueHandle_t xRingQueue, void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *<pre>
+ UBaseType_t uxRingQueueMessagesWaiting( RingQueueHandle_t xRingQueue );
+ </pre>
+ *
+ * Returns the number of items in a ring queue.  For a multiple producer ring
+ * queue the count includes items that have been claimed by a producer but not
+ * yet completely written.
+ *
+ * \defgroup uxRingQueueMessagesWaiting uxRingQueueMessagesWaiting
+ * \ingroup RingQueue
+ */
+UBaseType_t uxRingQueueMessagesWaiting( RingQueueHandle_t xRingQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *<pre>
+ void vRingQueueDelete( RingQueueHandle_t xRingQueue );
+ </pre>
+ *
+ * Deletes a ring queue that was previously created.  The reader must not be
+ * blocked on the ring queue, and no producer may be writing to it.
+ *
+ * \defgroup vRingQueueDelete vRingQueueDelete
+ * \ingroup RingQueue
+ */
+void vRingQueueDelete( RingQueueHandle_t xRingQueue ) PRIVILEGED_FUNCTION;
+
+/* Functions below here are not part of the public API. */
+RingQueueHandle_t xRingQueueGenericCreate( UBaseType_t uxLength, UBaseType_t uxItemSize, BaseType_t xMultipleProducers ) PRIVILEGED_FUNCTION;
+RingQueueHandle_t xRingQueueGenericCreateStatic( UBaseType_t uxLength, UBaseType_t uxItemSize, BaseType_t xMultipleProducers, uint8_t * const pucRingQueueStorageArea, UBaseType_t * const puxSequenceStorageArea, StaticRingQueue_t * const pxStaticRingQueue ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RING_QUEUE_H */
+
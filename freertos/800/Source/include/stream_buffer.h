@@ -0,0 +1,484 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef STREAM_BUFFER_H
+#define STREAM_BUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include stream_buffer.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Stream buffers pass a continuous stream of bytes from a single writer (a task
+ * or an interrupt) to a single reader (a task or an interrupt).  Unlike a queue,
+ * which copies fixed size items one at a time, any number of bytes can be
+ * written or read in one call, and data is copied directly into and out of a
+ * ring buffer.  Stream buffers are therefore well suited to passing data from
+ * a UART, USB CDC or audio interrupt to a task.
+ *
+ * IMPORTANT:  Uniquely among FreeRTOS objects, the stream buffer implementation
+ * assumes there is only one writer and only one reader.  The data is copied
+ * without entering a critical section - a critical section is only entered
+ * while a task registers itself as waiting, or while the task waiting at the
+ * other end is notified that it can continue.  If there are multiple writers
+ * (or multiple readers) then the application must serialise their access, for
+ * example by using a mutex or by writing from inside a critical section.
+ *
+ * A task blocked on a stream buffer waits using its direct to task
+ * notification, so configUSE_TASK_NOTIFICATIONS must not be set to 0.
+ *
+ * Message buffers (see message_buffer.h) are built on stream buffers.
+ *
+ * \defgroup StreamBuffer StreamBuffer
+ */
+
+/**
+ * stream_buffer.h
+ *
+ * Type by which stream buffers are referenced.  For example, a call to
+ * xStreamBufferCreate() returns a StreamBufferHandle_t variable that can then
+ * be used as a parameter to xStreamBufferSend(), xStreamBufferReceive(), etc.
+ *
+ * \defgroup StreamBufferHandle_t StreamBufferHandle_t
+ * \ingroup StreamBuffer
+ */
+typedef void * StreamBufferHandle_t;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ StreamBufferHandle_t xStreamBufferCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes );
+ </pre>
+ *
+ * Creates a new stream buffer.  The memory used by the stream buffer is
+ * allocated using pvPortMalloc().
+ *
+ * @param xBufferSizeBytes The total number of bytes the stream buffer will be
+ * able to hold at any one time.
+ *
+ * @param xTriggerLevelBytes The number of bytes that must be in the stream
+ * buffer before a task that is blocked on the stream buffer to wait for data
+ * is moved out of the blocked state.  For example, if a task is blocked on a
+ * read of an empty stream buffer that has a trigger level of 1 then the task
+ * will be unblocked when a single byte is written to the buffer or the task's
+ * block time expires.  As another example, if a task is blocked on a read of
+ * an empty stream buffer that has a trigger level of 10 then the task will not
+ * be unblocked until the stream buffer contains at least 10 bytes or the
+ * task's block time expires.  A larger trigger level reduces the number of
+ * context switches at the cost of latency.  Setting a trigger level of 0 will
+ * result in a trigger level of 1 being used.  It is not valid to specify a
+ * trigger level that is greater than the buffer size.
+ *
+ * @return If NULL is returned, then the stream buffer cannot be created
+ * because there is insufficient heap memory available.  A non-NULL value
+ * being returned indicates that the stream buffer has been created
+ * successfully - the returned value should be stored as the handle to the
+ * created stream buffer.
+ *
+ * Example usage:
+   <pre>
+	StreamBufferHandle_t xStreamBuffer;
+
+	// Create a stream buffer that can hold 100 bytes, and unblocks a reading
+	// task when 10 or more bytes are available.
+	xStreamBuffer = xStreamBufferCreate( 100, 10 );
+
+	if( xStreamBuffer == NULL )
+	{
+		// There was not enough heap memory space available to create the
+		// stream buffer.
+	}
+	else
+	{
+		// The stream buffer was created successfully and can now be used.
+	}
+   </pre>
+ * \defgroup xStreamBufferCreate xStreamBufferCreate
+ * \ingroup StreamBuffer
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xStreamBufferCreate( xBufferSizeBytes, xTriggerLevelBytes ) xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), pdFALSE )
+#endif
+
+/**
+ * stream_buffer.h
+ *<pre>
+ StreamBufferHandle_t xStreamBufferCreateStatic( size_t xBufferSizeBytes,
+												 size_t xTriggerLevelBytes,
+												 uint8_t *pucStreamBufferStorageArea,
+												 StaticStreamBuffer_t *pxStaticStreamBuffer );
+ </pre>
+ *
+ * Creates a new stream buffer, as per xStreamBufferCreate(), but using memory
+ * supplied by the application instead of memory allocated from the FreeRTOS
+ * heap.  configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h
+ * for xStreamBufferCreateStatic() to be available.
+ *
+ * @param xBufferSizeBytes The number of bytes the stream buffer will be able
+ * to hold at any one time.
+ *
+ * @param xTriggerLevelBytes As per xStreamBufferCreate().
+ *
+ * @param pucStreamBufferStorageArea Must point to a uint8_t array that is at
+ * least xBufferSizeBytes + 1 bytes long.  The extra byte lets a full buffer be
+ * distinguished from an empty buffer.
+ *
+ * @param pxStaticStreamBuffer Must point to a variable of type
+ * StaticStreamBuffer_t, which will be used to hold the stream buffer's data
+ * structure.
+ *
+ * @return If the stream buffer is created successfully then a handle to the
+ * created stream buffer is returned.  If either pucStreamBufferStorageArea or
+ * pxStaticStreamBuffer are NULL then NULL is returned.  The memory is not
+ * freed if the stream buffer is later deleted.
+ *
+ * Example usage:
+   <pre>
+	// Used to dimension the array used to hold the streams.  The available space
+	// will actually be one less than this, so 999.
+	#define STORAGE_SIZE_BYTES 1000
+
+	// Defines the memory that will actually hold the streams within the stream
+	// buffer.
+	static uint8_t ucStorageBuffer[ STORAGE_SIZE_BYTES ];
+
+	// The variable used to hold the stream buffer structure.
+	StaticStreamBuffer_t xStreamBufferStruct;
+
+	void MyFunction( void )
+	{
+	StreamBufferHandle_t xStreamBuffer;
+
+		xStreamBuffer = xStreamBufferCreateStatic( sizeof( ucStorageBuffer ) - 1,
+												   1,
+												   ucStorageBuffer,
+												   &xStreamBufferStruct );
+
+		// As neither the pucStreamBufferStorageArea or pxStaticStreamBuffer
+		// parameters were NULL, xStreamBuffer will not be NULL, and can be used to
+		// reference the created stream buffer in other stream buffer API calls.
+	}
+   </pre>
+ * \defgroup xStreamBufferCreateStatic xStreamBufferCreateStatic
+ * \ingroup StreamBuffer
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	#define xStreamBufferCreateStatic( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), pdFALSE, ( pucStreamBufferStorageArea ), ( pxStaticStreamBuffer ) )
+#endif
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
+						   const void *pvTxData,
+						   size_t xDataLengthBytes,
+						   TickType_t xTicksToWait );
+ </pre>
+ *
+ * Sends bytes to a stream buffer.  The bytes are copied into the stream buffer.
+ *
+ * Use xStreamBufferSend() to write to a stream buffer from a task.  Use
+ * xStreamBufferSendFromISR() to write to a stream buffer from an interrupt
+ * service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer to which a stream is
+ * being sent.
+ *
+ * @param pvTxData A pointer to the buffer that holds the bytes to be copied
+ * into the stream buffer.
+ *
+ * @param xDataLengthBytes The maximum number of bytes to copy from pvTxData
+ * into the stream buffer.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for enough space to become available in the stream
+ * buffer, should the stream buffer contain too little space to hold all
+ * xDataLengthBytes bytes.  If a task times out before all xDataLengthBytes
+ * could be written then it will still write as many bytes as possible.
+ *
+ * @return The number of bytes written to the stream buffer.
+ *
+ * \defgroup xStreamBufferSend xStreamBufferSend
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
+								  const void *pvTxData,
+								  size_t xDataLengthBytes,
+								  BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Interrupt safe version of xStreamBufferSend().  Writes as many of the bytes
+ * as will fit and never blocks.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if writing the data unblocked
+ * a task that has a priority above the priority of the currently running task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.  pxHigherPriorityTaskWoken is optional and can be NULL.
+ *
+ * @return The number of bytes written to the stream buffer.
+ *
+ * Example usage:
+   <pre>
+	// A stream buffer that has already been created.
+	StreamBufferHandle_t xStreamBuffer;
+
+	void vAnInterruptServiceRoutine( void )
+	{
+	size_t xBytesSent;
+	uint8_t ucData[ 8 ];
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		// Read the received bytes from the peripheral into ucData, then
+		// attempt to send them to the stream buffer.
+		xBytesSent = xStreamBufferSendFromISR( xStreamBuffer, ucData, sizeof( ucData ), &xHigherPriorityTaskWoken );
+
+		if( xBytesSent != sizeof( ucData ) )
+		{
+			// There was not enough free space in the stream buffer for the
+			// entire block to be written.
+		}
+
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+   </pre>
+ * \defgroup xStreamBufferSendFromISR xStreamBufferSendFromISR
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
+							  void *pvRxData,
+							  size_t xBufferLengthBytes,
+							  TickType_t xTicksToWait );
+ </pre>
+ *
+ * Receives bytes from a stream buffer.
+ *
+ * Use xStreamBufferReceive() to read from a stream buffer from a task.  Use
+ * xStreamBufferReceiveFromISR() to read from a stream buffer from an
+ * interrupt service routine (ISR).
+ *
+ * @param xStreamBuffer The handle of the stream buffer from which bytes are to
+ * be received.
+ *
+ * @param pvRxData A pointer to the buffer into which the received bytes will be
+ * copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ * This sets the maximum number of bytes to receive in one call.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data to become available if the stream buffer is
+ * empty.  xStreamBufferReceive() returns as soon as any data is available
+ * (which, if the task blocked, means the trigger level was reached).
+ *
+ * @return The number of bytes actually read from the stream buffer, which will
+ * be less than xBufferLengthBytes if the call to xStreamBufferReceive() timed
+ * out before xBufferLengthBytes were available.
+ *
+ * \defgroup xStreamBufferReceive xStreamBufferReceive
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
+									 void *pvRxData,
+									 size_t xBufferLengthBytes,
+									 BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * An interrupt safe version of xStreamBufferReceive().  Never blocks.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if reading the data unblocked
+ * a writing task that has a priority above the priority of the currently
+ * running task.  pxHigherPriorityTaskWoken is optional and can be NULL.
+ *
+ * @return The number of bytes read from the stream buffer, if any.
+ *
+ * \defgroup xStreamBufferReceiveFromISR xStreamBufferReceiveFromISR
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Deletes a stream buffer that was previously created using a call to
+ * xStreamBufferCreate().  A task must not be blocked on the stream buffer when
+ * it is deleted.
+ *
+ * \defgroup vStreamBufferDelete vStreamBufferDelete
+ * \ingroup StreamBuffer
+ */
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer );
+ BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Query whether a stream buffer is full or empty.  A stream buffer is full if
+ * it has no free space.
+ *
+ * @return pdTRUE if the stream buffer is full (or empty), otherwise pdFALSE.
+ *
+ * \defgroup xStreamBufferIsFull xStreamBufferIsFull
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Resets a stream buffer to its initial, empty, state.  Any data that was in
+ * the stream buffer is discarded.  A stream buffer can only be reset if there
+ * are no tasks blocked waiting to either send to or receive from the stream
+ * buffer.
+ *
+ * @return If the stream buffer is reset then pdPASS is returned.  If there was
+ * a task blocked waiting to send to or read from the stream buffer then the
+ * stream buffer is not reset and pdFAIL is returned.
+ *
+ * \defgroup xStreamBufferReset xStreamBufferReset
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer );
+ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer );
+ </pre>
+ *
+ * Queries a stream buffer to see how much free space it contains, which is
+ * equal to the amount of data that can be sent to the stream buffer before it
+ * is full, or how much data it contains, which is equal to the number of
+ * bytes that can be read before it is empty.
+ *
+ * \defgroup xStreamBufferSpacesAvailable xStreamBufferSpacesAvailable
+ * \ingroup StreamBuffer
+ */
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *<pre>
+ BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel );
+ </pre>
+ *
+ * Changes the trigger level of a stream buffer.  See xStreamBufferCreate() for
+ * a description of the trigger level.
+ *
+ * @return If xTriggerLevel was less than or equal to the stream buffer's
+ * length then the trigger level is updated and pdTRUE is returned.
+ * Otherwise pdFALSE is returned.
+ *
+ * \defgroup xStreamBufferSetTriggerLevel xStreamBufferSetTriggerLevel
+ * \ingroup StreamBuffer
+ */
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel ) PRIVILEGED_FUNCTION;
+
+/* Functions below here are not part of the public API. */
+StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer ) PRIVILEGED_FUNCTION;
+StreamBufferHandle_t xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer, uint8_t * const pucStreamBufferStorageArea, StaticStreamBuffer_t * const pxStaticStreamBuffer ) PRIVILEGED_FUNCTION;
+size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+	UBaseType_t uxStreamBufferGetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+	void vStreamBufferSetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer, UBaseType_t uxStreamBufferNumber ) PRIVILEGED_FUNCTION;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* STREAM_BUFFER_H */
+
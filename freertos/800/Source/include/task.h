@@ -114,6 +114,16 @@ typedef enum
 	eDeleted		/* The task being queried has been deleted, but its TCB has not yet been freed. */
 } eTaskState;
 
+/* Actions that can be performed when xTaskNotify() is called. */
+typedef enum
+{
+	eNoAction = 0,				/* Notify the task without updating its notify value. */
+	eSetBits,					/* Set bits in the task's notification value. */
+	eIncrement,					/* Increment the task's notification value. */
+	eSetValueWithOverwrite,		/* Set the task's notification value to a specific value even if the previous value has not yet been read by the task. */
+	eSetValueWithoutOverwrite	/* Set the task's notification value if the previous value has been read by the task. */
+} eNotifyAction;
+
 /*
  * Used internally only.
  */
@@ -161,6 +171,50 @@ typedef struct xTASK_STATUS
 	uint16_t usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
 } TaskStatus_t;
 
+/* Identifies the output of xTaskRegistryExport(), and the version of its
+layout. */
+#define taskREGISTRY_MAGIC					( 0x47455254UL ) /* "TREG" when stored little endian. */
+#define taskREGISTRY_VERSION				( 1UL )
+
+/* The number of characters of each task's name that are exported, including
+the terminating null if the name is shorter. */
+#define taskREGISTRY_NAME_LENGTH			( 16 )
+
+/* The start of the output of xTaskRegistryExport(). */
+typedef struct xTASK_REGISTRY_EXPORT_HEADER
+{
+	uint32_t ulMagic;						/*< taskREGISTRY_MAGIC. */
+	uint32_t ulVersion;						/*< taskREGISTRY_VERSION. */
+	uint32_t ulTaskCount;					/*< The number of task records that follow the header. */
+	uint32_t ulGenerationStart;				/*< The registry generation when the snapshot started. */
+	uint32_t ulGenerationEnd;				/*< The registry generation when the snapshot ended - if it differs from ulGenerationStart tasks were created or freed while the snapshot was taken. */
+	uint32_t ulTasksDropped;				/*< Tasks not recorded because the registry was full when they were created. */
+	uint32_t ulTickCount;					/*< The tick count when the snapshot ended. */
+	uint32_t ulTotalRunTime;				/*< The run time stats clock when the snapshot ended, or 0 if configGENERATE_RUN_TIME_STATS is not 1. */
+} TaskRegistryExportHeader_t;
+
+/* One task - the fields of a TaskStatus_t, each of fixed size. */
+typedef struct xTASK_REGISTRY_EXPORT_RECORD
+{
+	uint64_t ullHandle;						/*< The task's handle. */
+	uint32_t ulTaskNumber;					/*< TaskStatus_t::xTaskNumber. */
+	uint32_t ulState;						/*< TaskStatus_t::eCurrentState. */
+	uint32_t ulCurrentPriority;				/*< TaskStatus_t::uxCurrentPriority. */
+	uint32_t ulBasePriority;				/*< TaskStatus_t::uxBasePriority. */
+	uint32_t ulRunTimeCounter;				/*< TaskStatus_t::ulRunTimeCounter. */
+	uint32_t ulStackHighWaterMark;			/*< TaskStatus_t::usStackHighWaterMark, in words. */
+	char cName[ taskREGISTRY_NAME_LENGTH ];	/*< The task's name, which is not null terminated if it is taskREGISTRY_NAME_LENGTH characters long. */
+} TaskRegistryExportRecord_t;
+
+/* Used with the vTaskGetDeadlineStats() function to return the deadline
+statistics of a task. */
+typedef struct xTASK_DEADLINE_STATS
+{
+	uint32_t ulJobs;				/* The number of jobs the task has completed by calling xTaskWaitForNextPeriod(). */
+	uint32_t ulDeadlinesMissed;		/* The number of those jobs that completed after their deadline. */
+	uint32_t ulBudgetOverruns;		/* The number of times a job ran for its budget, and had its deadline postponed by a period. */
+} TaskDeadlineStats_t;
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -327,7 +381,147 @@ is used in assert() statements. */
  * \defgroup xTaskCreate xTaskCreate
  * \ingroup Tasks
  */
-#define xTaskCreate( pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask ) xTaskGenericCreate( ( pvTaskCode ), ( pcName ), ( usStackDepth ), ( pvParameters ), ( uxPriority ), ( pxCreatedTask ), ( NULL ), ( NULL ) )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xTaskCreate( pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask ) xTaskGenericCreate( ( pvTaskCode ), ( pcName ), ( usStackDepth ), ( pvParameters ), ( uxPriority ), ( pxCreatedTask ), ( NULL ), ( NULL ), ( configTASK_STACK_HEAP_HINTS ) )
+#endif
+
+/**
+ * task. h
+ *<pre>
+ BaseType_t xTaskCreateWithStackHints(
+							  TaskFunction_t pvTaskCode,
+							  const char * const pcName,
+							  uint16_t usStackDepth,
+							  void *pvParameters,
+							  UBaseType_t uxPriority,
+							  TaskHandle_t *pvCreatedTask,
+							  UBaseType_t uxStackHints
+						  );</pre>
+ *
+ * Create a new task as xTaskCreate() does, but allocate its stack from a heap
+ * region that has the attributes in uxStackHints - for example
+ * portHEAP_ATTRIBUTE_FAST to place the stack in core coupled memory.
+ *
+ * The hints are only used if configUSE_HEAP_PLACEMENT_HINTS is set to 1 in
+ * FreeRTOSConfig.h, which requires a heap that provides
+ * pvPortMallocWithHints(), such as heap_regions.c.  Otherwise the stack is
+ * allocated with pvPortMalloc().  Tasks created with xTaskCreate() and
+ * xTaskCreateRestricted() use the hints set by configTASK_STACK_HEAP_HINTS.
+ *
+ * @param uxStackHints The attributes the memory of the task's stack should
+ * have.  See heap_regions.c for which are requirements and which are only
+ * preferences.
+ *
+ * See xTaskCreate() for the other parameters and the return value.
+ *
+ * Example usage:
+   <pre>
+ // Create a task whose stack is in the fastest memory available.
+ xTaskCreateWithStackHints( vTaskCode, "NAME", STACK_SIZE, NULL, tskIDLE_PRIORITY, &xHandle, portHEAP_ATTRIBUTE_FAST );
+   </pre>
+ * \defgroup xTaskCreateWithStackHints xTaskCreateWithStackHints
+ * \ingroup Tasks
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xTaskCreateWithStackHints( pvTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, uxStackHints ) xTaskGenericCreate( ( pvTaskCode ), ( pcName ), ( usStackDepth ), ( pvParameters ), ( uxPriority ), ( pxCreatedTask ), ( NULL ), ( NULL ), ( uxStackHints ) )
+#endif
+
+/**
+ * task. h
+ *<pre>
+ TaskHandle_t xTaskCreateStatic( TaskFunction_t pvTaskCode,
+								 const char * const pcName,
+								 uint16_t usStackDepth,
+								 void *pvParameters,
+								 UBaseType_t uxPriority,
+								 StackType_t *pxStackBuffer,
+								 StaticTask_t *pxTaskBuffer );</pre>
+ *
+ * Create a new task and add it to the list of tasks that are ready to run.
+ *
+ * Internally, within the FreeRTOS implementation, tasks use two blocks of
+ * memory.  The first block is used to hold the task's data structures.  The
+ * second block is used by the task as its stack.  If a task is created using
+ * xTaskCreate() then both blocks of memory are automatically dynamically
+ * allocated inside the xTaskCreate() function.  If a task is created using
+ * xTaskCreateStatic() then the application writer must provide the required
+ * memory.  xTaskCreateStatic() therefore allows a task to be created without
+ * using any dynamic memory allocation.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * this function to be available.
+ *
+ * @param pvTaskCode Pointer to the task entry function.  Tasks
+ * must be implemented to never return (i.e. continuous loop).
+ *
+ * @param pcName A descriptive name for the task.  This is mainly used to
+ * facilitate debugging.  Max length defined by configMAX_TASK_NAME_LEN.
+ *
+ * @param usStackDepth The size of the task stack specified as the number of
+ * variables the stack can hold - not the number of bytes.  The array pointed
+ * to by pxStackBuffer must have at least usStackDepth indexes.
+ *
+ * @param pvParameters Pointer that will be used as the parameter for the task
+ * being created.
+ *
+ * @param uxPriority The priority at which the task will run.
+ *
+ * @param pxStackBuffer Must point to a StackType_t array that has at least
+ * usStackDepth indexes - the array will then be used as the task's stack,
+ * removing the need for the stack to be allocated dynamically.
+ *
+ * @param pxTaskBuffer Must point to a variable of type StaticTask_t, which will
+ * then be used to hold the task's data structures, removing the need for the
+ * memory to be allocated dynamically.
+ *
+ * @return If neither pxStackBuffer nor pxTaskBuffer are NULL, then the task
+ * will be created and a handle to the created task is returned.  If either
+ * pxStackBuffer or pxTaskBuffer are NULL then the task will not be created and
+ * NULL is returned.  The memory is not freed if the task is later deleted.
+ *
+ * Example usage:
+   <pre>
+
+	// Dimensions the buffer that the task being created will use as its stack.
+	// NOTE:  This is the number of words the stack will hold, not the number of
+	// bytes.  For example, if each stack item is 32-bits, and this is set to 100,
+	// then 400 bytes (100 * 32-bits) will be allocated.
+	#define STACK_SIZE 200
+
+	// Structure that will hold the TCB of the task being created.
+	StaticTask_t xTaskBuffer;
+
+	// Buffer that the task being created will use as its stack.  Note this is
+	// an array of StackType_t variables.  The size of StackType_t is dependent on
+	// the RTOS port.
+	StackType_t xStack[ STACK_SIZE ];
+
+	// Function that creates a task.
+	void vOtherFunction( void )
+	{
+	TaskHandle_t xHandle = NULL;
+
+		// Create the task without using any dynamic memory allocation.
+		xHandle = xTaskCreateStatic(
+					  vTaskCode,       // Function that implements the task.
+					  "NAME",          // Text name for the task.
+					  STACK_SIZE,      // Stack size in words, not bytes.
+					  ( void * ) 1,    // Parameter passed into the task.
+					  tskIDLE_PRIORITY,// Priority at which the task is created.
+					  xStack,          // Array to use as the task's stack.
+					  &xTaskBuffer );  // Variable to hold the task's data structure.
+
+		// pxTaskBuffer was not NULL so the task will have been created, and
+		// xHandle will be the task's handle.  Use the handle to suspend the task.
+		vTaskSuspend( xHandle );
+	}
+   </pre>
+ * \defgroup xTaskCreateStatic xTaskCreateStatic
+ * \ingroup Tasks
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, StackType_t * const puxStackBuffer, StaticTask_t * const pxTaskBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
 /**
  * task. h
@@ -396,7 +590,9 @@ TaskHandle_t xHandle;
  * \defgroup xTaskCreateRestricted xTaskCreateRestricted
  * \ingroup Tasks
  */
-#define xTaskCreateRestricted( x, pxCreatedTask ) xTaskGenericCreate( ((x)->pvTaskCode), ((x)->pcName), ((x)->usStackDepth), ((x)->pvParameters), ((x)->uxPriority), (pxCreatedTask), ((x)->puxStackBuffer), ((x)->xRegions) )
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xTaskCreateRestricted( x, pxCreatedTask ) xTaskGenericCreate( ((x)->pvTaskCode), ((x)->pcName), ((x)->usStackDepth), ((x)->pvParameters), ((x)->uxPriority), (pxCreatedTask), ((x)->puxStackBuffer), ((x)->xRegions), (configTASK_STACK_HEAP_HINTS) )
+#endif
 
 /**
  * task. h
@@ -867,6 +1063,26 @@ BaseType_t xTaskResumeFromISR( TaskHandle_t xTaskToResume ) PRIVILEGED_FUNCTION;
  */
 void vTaskStartScheduler( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize );</pre>
+ *
+ * When configSUPPORT_STATIC_ALLOCATION is set to 1 the idle task is created
+ * using memory supplied by the application, rather than memory allocated from
+ * the heap, and the application must provide an implementation of this
+ * function.  vTaskStartScheduler() calls it to obtain the buffers to use as
+ * the idle task's TCB and stack.  *pusIdleTaskStackSize is initialised to
+ * configMINIMAL_STACK_SIZE before the call and must be set to the number of
+ * StackType_t items in the stack buffer provided.  Both buffers must remain
+ * valid for as long as the scheduler is running.
+ *
+ * \defgroup vApplicationGetIdleTaskMemory vApplicationGetIdleTaskMemory
+ * \ingroup SchedulerControl
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint16_t *pusIdleTaskStackSize );
+#endif
+
 /**
  * task. h
  * <pre>void vTaskEndScheduler( void );</pre>
@@ -1169,7 +1385,15 @@ TaskHandle_t xTaskGetIdleTaskHandle( void );
  * definition in this file for the full member list.
  *
  * NOTE:  This function is intended for debugging use only as its use results in
- * the scheduler remaining suspended for an extended period.
+ * the scheduler remaining suspended for an extended period - unless
+ * configUSE_TASK_REGISTRY is 1, in which case the tasks are read from the task
+ * registry one at a time, in the order in which they were created, and the
+ * scheduler is only locked out while the fields of one task are read.  The
+ * registry then guarantees that each task that exists for the whole call
+ * appears once and once only.  If a task has ever been created while the
+ * registry was full, see configTASK_REGISTRY_SIZE, the registry does not hold
+ * every task, so the scheduler is suspended and the task lists are walked as if
+ * configUSE_TASK_REGISTRY was 0.
  *
  * @param pxTaskStatusArray A pointer to an array of TaskStatus_t structures.
  * The array must contain at least one TaskStatus_t structure for each task
@@ -1257,6 +1481,39 @@ TaskHandle_t xTaskGetIdleTaskHandle( void );
  */
 UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime );
 
+/**
+ * configUSE_TASK_REGISTRY must be defined as 1 in FreeRTOSConfig.h for
+ * uxTaskGetRegistryGeneration() to be available.
+ *
+ * Returns a number that is incremented each time a task is added to the task
+ * registry when it is created, and each time one is removed when the idle task
+ * frees its memory.  If the generation is the same before and after a call to
+ * uxTaskGetSystemState() then no task was created or freed during the call.
+ */
+UBaseType_t uxTaskGetRegistryGeneration( void );
+
+/**
+ * configUSE_TASK_REGISTRY must be defined as 1 in FreeRTOSConfig.h for
+ * xTaskRegistryExport() to be available.
+ *
+ * Writes a snapshot of the task registry into the xBufferSize bytes at
+ * pvBuffer, taken without suspending the scheduler in the same way as by
+ * uxTaskGetSystemState().  The snapshot is a TaskRegistryExportHeader_t
+ * followed by a TaskRegistryExportRecord_t for each task, with no padding
+ * between them.  All fields are of fixed size, and the handle is held in 64
+ * bits, so the layout is the same on any target of the same endianness and can
+ * be decoded on a host.
+ *
+ * @param pvBuffer The buffer to write to, which need not be aligned.
+ *
+ * @param xBufferSize The size of the buffer in bytes.  Tasks that do not fit
+ * are left out, and ulTaskCount is set to the number that were written.
+ *
+ * @return The number of bytes written, or 0 if the buffer cannot hold the
+ * header.
+ */
+size_t xTaskRegistryExport( void *pvBuffer, size_t xBufferSize );
+
 /**
  * task. h
  * <PRE>void vTaskList( char *pcWriteBuffer );</PRE>
@@ -1265,7 +1522,8 @@ UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const
  * both be defined as 1 for this function to be available.  See the
  * configuration section of the FreeRTOS.org website for more information.
  *
- * NOTE 1: This function will disable interrupts for its duration.  It is
+ * NOTE 1: This function will disable interrupts for its duration, unless
+ * configUSE_TASK_REGISTRY is 1 - see uxTaskGetSystemState().  It is
  * not intended for normal application runtime use but as a debug aid.
  *
  * Lists all the current tasks, along with their current state and stack
@@ -1316,7 +1574,8 @@ void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unquali
  * value respectively.  The counter should be at least 10 times the frequency of
  * the tick count.
  *
- * NOTE 1: This function will disable interrupts for its duration.  It is
+ * NOTE 1: This function will disable interrupts for its duration, unless
+ * configUSE_TASK_REGISTRY is 1 - see uxTaskGetSystemState().  It is
  * not intended for normal application runtime use but as a debug aid.
  *
  * Setting configGENERATE_RUN_TIME_STATS to 1 will result in a total
@@ -1358,6 +1617,323 @@ void vTaskList( char * pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unquali
  */
 void vTaskGetRunTimeStats( char *pcWriteBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction );</PRE>
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * Each task has a 32-bit notification value that is initialised to zero when
+ * the task is created.  Sending a notification to a task unblocks the task if
+ * it is blocked in xTaskNotifyWait() or ulTaskNotifyTake() waiting for one,
+ * and can optionally update the task's notification value in one of the
+ * following ways:
+ *
+ *   eNoAction - The task is notified but its notification value is not
+ *   updated.  ulValue is not used.
+ *
+ *   eSetBits - The task's notification value is bitwise ORed with ulValue,
+ *   allowing the notification value to be used as a light weight event group.
+ *
+ *   eIncrement - The task's notification value is incremented, allowing the
+ *   notification value to be used as a light weight counting semaphore.
+ *   ulValue is not used.
+ *
+ *   eSetValueWithOverwrite - The task's notification value is set to ulValue,
+ *   even if the task had not yet read the previous value, allowing the
+ *   notification value to be used as a light weight mailbox of length one
+ *   (like xQueueOverwrite()).
+ *
+ *   eSetValueWithoutOverwrite - The task's notification value is set to
+ *   ulValue only if the task does not already have a notification pending,
+ *   otherwise the value is not updated and pdFAIL is returned.
+ *
+ * A notification is sent directly to a task, so no intermediate object (such
+ * as a queue or semaphore) has to be created, and unblocking the receiving
+ * task does not require an event list to be searched.  A notification can only
+ * be received by the task to which it is sent.
+ *
+ * xTaskNotify() must not be called from an interrupt service routine.  Use
+ * xTaskNotifyFromISR() instead.
+ *
+ * @param xTaskToNotify The handle of the task being notified.
+ *
+ * @param ulValue Data that can be sent with the notification, as described by
+ * eAction.
+ *
+ * @param eAction How the task's notification value is updated, as described
+ * above.
+ *
+ * @return pdFAIL if eAction is eSetValueWithoutOverwrite and the task's
+ * notification value could not be updated, otherwise pdPASS.
+ *
+ * \defgroup xTaskNotify xTaskNotify
+ * \ingroup TaskNotifications
+ */
+#define xTaskNotify( xTaskToNotify, ulValue, eAction ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL )
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotifyAndQuery( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotifyValue );</PRE>
+ *
+ * As xTaskNotify(), but the task's notification value as it was before it was
+ * updated is also returned in *pulPreviousNotifyValue.
+ *
+ * \defgroup xTaskNotifyAndQuery xTaskNotifyAndQuery
+ * \ingroup TaskNotifications
+ */
+#define xTaskNotifyAndQuery( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue ) xTaskGenericNotify( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ) )
+
+/*
+ * The function that implements xTaskNotify(), xTaskNotifyAndQuery() and
+ * xTaskNotifyGive().  Use the macros rather than calling this function
+ * directly.
+ */
+BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
+ *
+ * A version of xTaskNotify() that can be called from an interrupt service
+ * routine.
+ *
+ * @param pxHigherPriorityTaskWoken xTaskNotifyFromISR() will set
+ * *pxHigherPriorityTaskWoken to pdTRUE if sending the notification caused the
+ * task to which the notification was sent to leave the Blocked state, and the
+ * unblocked task has a priority higher than the currently running task.  If
+ * xTaskNotifyFromISR() sets this value to pdTRUE then a context switch should
+ * be requested before the interrupt is exited.
+ *
+ * \defgroup xTaskNotifyFromISR xTaskNotifyFromISR
+ * \ingroup TaskNotifications
+ */
+#define xTaskNotifyFromISR( xTaskToNotify, ulValue, eAction, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), NULL, ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotifyAndQueryFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotifyValue, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
+ *
+ * A version of xTaskNotifyAndQuery() that can be called from an interrupt
+ * service routine.
+ *
+ * \defgroup xTaskNotifyAndQueryFromISR xTaskNotifyAndQueryFromISR
+ * \ingroup TaskNotifications
+ */
+#define xTaskNotifyAndQueryFromISR( xTaskToNotify, ulValue, eAction, pulPreviousNotifyValue, pxHigherPriorityTaskWoken ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( ulValue ), ( eAction ), ( pulPreviousNotifyValue ), ( pxHigherPriorityTaskWoken ) )
+
+/*
+ * The function that implements xTaskNotifyFromISR(),
+ * xTaskNotifyAndQueryFromISR() and vTaskNotifyGiveFromISR().  Use the macros
+ * rather than calling this function directly.
+ */
+BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait );</PRE>
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * Wait, with an optional timeout, for the calling task to receive a
+ * notification.  If a notification is already pending when
+ * xTaskNotifyWait() is called then the function returns immediately.
+ *
+ * @param ulBitsToClearOnEntry Bits that are set in ulBitsToClearOnEntry are
+ * cleared in the calling task's notification value before the task checks
+ * for a pending notification, but only if no notification was pending.
+ * Setting ulBitsToClearOnEntry to 0xffffffff clears the notification value.
+ *
+ * @param ulBitsToClearOnExit Bits that are set in ulBitsToClearOnExit are
+ * cleared in the calling task's notification value before xTaskNotifyWait()
+ * returns, but only if a notification was received.
+ *
+ * @param pulNotificationValue Used to pass out the task's notification value
+ * as it was before any bits were cleared by ulBitsToClearOnExit.  Set to NULL
+ * if the value is not required.
+ *
+ * @param xTicksToWait The maximum time to wait in the Blocked state for a
+ * notification to be received.  Setting xTicksToWait to portMAX_DELAY will
+ * cause the task to wait indefinitely (without a timeout) if
+ * INCLUDE_vTaskSuspend is set to 1.
+ *
+ * @return pdTRUE if a notification was received (or was already pending),
+ * otherwise pdFALSE.
+ *
+ * \defgroup xTaskNotifyWait xTaskNotifyWait
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotifyGive( TaskHandle_t xTaskToNotify );</PRE>
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * macro to be available.
+ *
+ * Increment the notification value of the task referenced by xTaskToNotify.
+ * When used in combination with ulTaskNotifyTake() the notification value
+ * acts as a faster, light weight, binary or counting semaphore that does not
+ * require a semaphore to be created.  Equivalent to calling xTaskNotify()
+ * with eAction set to eIncrement.
+ *
+ * @return Always pdPASS.
+ *
+ * \defgroup xTaskNotifyGive xTaskNotifyGive
+ * \ingroup TaskNotifications
+ */
+#define xTaskNotifyGive( xTaskToNotify ) xTaskGenericNotify( ( xTaskToNotify ), ( 0 ), eIncrement, NULL )
+
+/**
+ * task. h
+ * <PRE>void vTaskNotifyGiveFromISR( TaskHandle_t xTaskToNotify, BaseType_t *pxHigherPriorityTaskWoken );</PRE>
+ *
+ * A version of xTaskNotifyGive() that can be called from an interrupt service
+ * routine.  See xTaskNotifyFromISR() for a description of
+ * pxHigherPriorityTaskWoken.
+ *
+ * \defgroup vTaskNotifyGiveFromISR vTaskNotifyGiveFromISR
+ * \ingroup TaskNotifications
+ */
+#define vTaskNotifyGiveFromISR( xTaskToNotify, pxHigherPriorityTaskWoken ) ( void ) xTaskGenericNotifyFromISR( ( xTaskToNotify ), ( 0 ), eIncrement, NULL, ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * task. h
+ * <PRE>uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait );</PRE>
+ *
+ * configUSE_TASK_NOTIFICATIONS must be undefined or defined as 1 for this
+ * function to be available.
+ *
+ * Wait, with an optional timeout, for the calling task's notification value
+ * to become non-zero, then either clear or decrement the notification value
+ * before returning.  Used with xTaskNotifyGive() or vTaskNotifyGiveFromISR()
+ * as a light weight alternative to taking a binary or counting semaphore.
+ *
+ * @param xClearCountOnExit If pdFALSE the notification value is decremented
+ * before the function exits, in which case it acts like a counting semaphore.
+ * Otherwise the notification value is cleared to zero, in which case it acts
+ * like a binary semaphore.
+ *
+ * @param xTicksToWait The maximum time to wait in the Blocked state for the
+ * notification value to become non-zero.
+ *
+ * @return The task's notification value before it was decremented or cleared.
+ * Zero if the call timed out.
+ *
+ * \defgroup ulTaskNotifyTake ulTaskNotifyTake
+ * \ingroup TaskNotifications
+ */
+uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );</PRE>
+ *
+ * If a notification has been sent to xTask but not yet received then clear
+ * the pending state so the next call to xTaskNotifyWait() or
+ * ulTaskNotifyTake() blocks.  The notification value is not changed.  Pass
+ * xTask as NULL to clear the state of the calling task.
+ *
+ * @return pdPASS if a pending notification was cleared, otherwise pdFAIL.
+ *
+ * \defgroup xTaskNotifyStateClear xTaskNotifyStateClear
+ * \ingroup TaskNotifications
+ */
+BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskSetDeadlineParameters( TaskHandle_t xTask, TickType_t xPeriod, TickType_t xRelativeDeadline, TickType_t xBudget );</PRE>
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.
+ *
+ * Tasks of priority configEDF_PRIORITY are not run in turn, but earliest
+ * deadline first.  A task with deadline parameters runs as a series of jobs,
+ * the first released when this function is called and each of the rest one
+ * period after the last.  Each job must complete, by calling
+ * xTaskWaitForNextPeriod(), within xRelativeDeadline ticks of its release.
+ * Tasks of priority configEDF_PRIORITY that have no deadline parameters run,
+ * in turn, only when no task with deadline parameters is ready.  At most
+ * configEDF_MAX_TASKS tasks can have deadline parameters at once.
+ *
+ * Tasks that are unblocked by the tick, including the release of a job,
+ * preempt the running task straight away if they have an earlier deadline.
+ * Tasks that are unblocked by an event preempt it at the next tick.
+ * Priority inheritance can raise a task to configEDF_PRIORITY, but deadlines
+ * are not inherited.
+ *
+ * @param xTask The handle of the task, or NULL for the calling task.
+ *
+ * @param xPeriod The time, in ticks, between the releases of the task's jobs.
+ * 0 removes the task's deadline parameters.
+ *
+ * @param xRelativeDeadline The time, in ticks, after its release by which
+ * each job must complete.
+ *
+ * @param xBudget The time, in ticks, for which each job may run before its
+ * deadline is postponed by a period, or 0 to let jobs run for as long as they
+ * need.  A budget stops a task that overruns from making the other tasks miss
+ * their deadlines: however far behind the task falls it gets no more than
+ * xBudget ticks in each period, so if the budgets of the tasks of
+ * configEDF_PRIORITY divided by their periods sum to less than one, the tasks
+ * that keep to their budgets meet their deadlines.  Budgets are only enforced
+ * at priority configEDF_PRIORITY.  As the running task is charged for each
+ * tick interrupt, a job that runs for n and a fraction ticks can be charged
+ * n + 1 ticks, so the budget should be at least two more than the number of
+ * whole ticks a job is expected to run for.
+ *
+ * @return pdFAIL if the task had no deadline parameters and configEDF_MAX_TASKS
+ * tasks already have them, in which case the task is left unchanged, otherwise
+ * pdPASS.
+ *
+ * \defgroup xTaskSetDeadlineParameters xTaskSetDeadlineParameters
+ * \ingroup Tasks
+ */
+BaseType_t xTaskSetDeadlineParameters( TaskHandle_t xTask, TickType_t xPeriod, TickType_t xRelativeDeadline, TickType_t xBudget ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>BaseType_t xTaskWaitForNextPeriod( void );</PRE>
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.
+ *
+ * Called by a task with deadline parameters when its job is complete.
+ * Records whether the job met its deadline, then blocks until the next job is
+ * released.  If the next job has already been released, because the job that
+ * has just completed ran past the end of its period, the function returns
+ * straight away.  See xTaskSetDeadlineParameters().
+ *
+ * @return pdPASS if the job completed by its deadline, otherwise pdFAIL.
+ *
+ * \defgroup xTaskWaitForNextPeriod xTaskWaitForNextPeriod
+ * \ingroup TaskCtrl
+ */
+BaseType_t xTaskWaitForNextPeriod( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskGetDeadlineStats( TaskHandle_t xTask, TaskDeadlineStats_t *pxDeadlineStats );</PRE>
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.
+ *
+ * Reads the number of jobs a task has completed, and how many of them missed
+ * their deadline or overran their budget.
+ *
+ * @param xTask The handle of the task, or NULL for the calling task.
+ *
+ * @param pxDeadlineStats The structure into which the statistics are written.
+ *
+ * \defgroup vTaskGetDeadlineStats vTaskGetDeadlineStats
+ * \ingroup TaskUtils
+ */
+void vTaskGetDeadlineStats( TaskHandle_t xTask, TaskDeadlineStats_t *pxDeadlineStats ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------
  * SCHEDULER INTERNALS AVAILABLE FOR PORTING PURPOSES
  *----------------------------------------------------------*/
@@ -1511,9 +2087,12 @@ void vTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNC
 
 /*
  * Generic version of the task creation function which is in turn called by the
- * xTaskCreate() and xTaskCreateRestricted() macros.
+ * xTaskCreate(), xTaskCreateWithStackHints() and xTaskCreateRestricted()
+ * macros.
  */
-BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions, UBaseType_t uxStackHints ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif
 
 /*
  * Get the uxTCBNumber assigned to the task referenced by the xTask parameter.
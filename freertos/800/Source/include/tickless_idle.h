@@ -0,0 +1,198 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef TICKLESS_IDLE_H
+#define TICKLESS_IDLE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include tickless_idle.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A hardware independent implementation of portSUPPRESS_TICKS_AND_SLEEP() that
+ * ports can use when the tick interrupt is generated by a down counter that
+ * behaves like the Cortex-M SysTick:
+ *
+ *   + The counter decrements once per timer count while it is running.
+ *   + The tick interrupt is generated, and a "counted to zero" flag is set,
+ *     when the counter reaches zero.
+ *   + On the count after reaching zero the counter is loaded from a reload
+ *     register, so each period is one count longer than the reload value.
+ *   + Writing the reload register does not affect the current period.
+ *   + Clearing the counter sets it to zero and clears the flag, without
+ *     generating an interrupt.
+ *
+ * While the counter is stopped to be reprogrammed the kernel's time falls
+ * behind real time.  Rather than estimating the loss with a fixed fiddle
+ * factor, the time the counter is stopped for is measured using a free running
+ * reference counter (the DWT cycle counter on Cortex-M), and the loss, including
+ * fractions of a timer count, is carried forward and removed from the next
+ * period that is programmed.  Timekeeping therefore does not drift however
+ * often the tick is suppressed.
+ *
+ * Only available when configUSE_TICKLESS_IDLE is set to 1.  The port's
+ * vPortSuppressTicksAndSleep() calls vTicklessIdleSuppressTicksAndSleep(), and
+ * the port's vPortSetupTimerInterrupt() calls vTicklessIdleInitialise().
+ */
+
+/*
+ * Statistics maintained by vTicklessIdleSuppressTicksAndSleep(), obtained by
+ * calling vTicklessIdleGetStats().
+ */
+typedef struct xTICKLESS_IDLE_STATS
+{
+	uint32_t ulSleeps;					/*< The number of times the processor was put to sleep with the tick interrupt suppressed. */
+	uint32_t ulAbortedSleeps;			/*< The number of times a sleep was abandoned because a task became ready. */
+	uint32_t ulTicksSuppressed;			/*< The number of tick periods that passed without a tick interrupt. */
+	uint32_t ulTimerCountsLost;			/*< The number of timer counts that were lost while the timer was stopped, and so had to be compensated for. */
+} TicklessIdleStats_t;
+
+/*
+ * Called by the port's vPortSetupTimerInterrupt() before the tick interrupt is
+ * started.
+ *
+ * @param ulTimerCountsPerTick The number of timer counts in one tick period.
+ *
+ * @param ulMaximumReloadValue The largest value the timer's reload register
+ * can hold, which limits the number of tick periods that can be suppressed.
+ *
+ * @param ulReferenceCountsPerTimerCount The number of counts made by the
+ * reference counter (see ulPortTicklessGetReferenceCount()) during each timer
+ * count.
+ */
+void vTicklessIdleInitialise( uint32_t ulTimerCountsPerTick, uint32_t ulMaximumReloadValue, uint32_t ulReferenceCountsPerTimerCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Suppress the tick interrupt and sleep for up to xExpectedIdleTime tick
+ * periods, then correct the tick count for the time spent asleep.  Called with
+ * the scheduler suspended, as portSUPPRESS_TICKS_AND_SLEEP().
+ */
+void vTicklessIdleSuppressTicksAndSleep( TickType_t xExpectedIdleTime ) PRIVILEGED_FUNCTION;
+
+/*
+ * Obtain the statistics described by TicklessIdleStats_t.
+ */
+void vTicklessIdleGetStats( TicklessIdleStats_t *pxStats ) PRIVILEGED_FUNCTION;
+
+/*
+ * The functions below are implemented by the port.  All but
+ * vPortTicklessEnableInterrupts() are called with interrupts disabled.
+ */
+
+/*
+ * Globally disable and enable interrupts.  Unlike portDISABLE_INTERRUPTS() the
+ * interrupts that wake the processor from sleep must be masked too, but must
+ * still be able to end vPortTicklessWaitForInterrupt() - PRIMASK rather than
+ * BASEPRI on Cortex-M.
+ */
+void vPortTicklessDisableInterrupts( void );
+void vPortTicklessEnableInterrupts( void );
+
+/*
+ * Return the value of a free running counter that keeps counting while the
+ * timer is stopped.  It is read immediately after the timer is stopped and
+ * immediately before the timer is started.  The counter is only used to measure
+ * short intervals, so may wrap.
+ */
+uint32_t ulPortTicklessGetReferenceCount( void );
+
+/*
+ * Stop the timer and return the value of its counter.  *pxCountedToZero is set
+ * to pdTRUE if the counter reached zero since the flag was last cleared,
+ * otherwise pdFALSE.  Reading the flag clears it.
+ */
+uint32_t ulPortTicklessStopTimer( BaseType_t *pxCountedToZero );
+
+/*
+ * Restart the timer from the current value of its counter.
+ */
+void vPortTicklessStartTimer( void );
+
+/*
+ * Write the timer's reload register.
+ */
+void vPortTicklessSetReload( uint32_t ulReloadValue );
+
+/*
+ * Set the timer's counter to zero and clear its "counted to zero" flag.
+ */
+void vPortTicklessClearCount( void );
+
+/*
+ * Wait until an interrupt is pending.  The interrupt does not execute until
+ * vPortTicklessEnableInterrupts() is called.
+ */
+void vPortTicklessWaitForInterrupt( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TICKLESS_IDLE_H */
+
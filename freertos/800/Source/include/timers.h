@@ -88,7 +88,10 @@ extern "C" {
 be used solely through the macros that make up the public software timer API,
 as defined below.  The commands that are sent from interrupts must use the
 highest numbers as tmrFIRST_FROM_ISR_COMMAND is used to determine if the task
-or interrupt version of the queue send function should be used. */
+or interrupt version of the queue send function should be used.
+tmrCOMMAND_WAKE_TIMER_TASK is only sent by the kernel, when a timer that was
+reset without using the timer queue becomes the next timer to expire. */
+#define tmrCOMMAND_WAKE_TIMER_TASK				( ( BaseType_t ) -3 )
 #define tmrCOMMAND_EXECUTE_CALLBACK_FROM_ISR 	( ( BaseType_t ) -2 )
 #define tmrCOMMAND_EXECUTE_CALLBACK				( ( BaseType_t ) -1 )
 #define tmrCOMMAND_START_DONT_TRACE				( ( BaseType_t ) 0 )
@@ -169,7 +172,8 @@ typedef void (*PendedFunction_t)( void *, uint32_t );
  * @return If the timer is successfully created then a handle to the newly
  * created timer is returned.  If the timer cannot be created (because either
  * there is insufficient FreeRTOS heap remaining to allocate the timer
- * structures, or the timer period was set to 0) then NULL is returned.
+ * structures, the timer period was set to 0, or configUSE_TIMER_HEAP is 1 and
+ * configTIMER_HEAP_LENGTH timers already exist) then NULL is returned.
  *
  * Example usage:
  * @verbatim
@@ -253,7 +257,59 @@ typedef void (*PendedFunction_t)( void *, uint32_t );
  * }
  * @endverbatim
  */
-TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif
+
+/**
+ * TimerHandle_t xTimerCreateStatic( const char * const pcTimerName,
+ * 									 TickType_t xTimerPeriodInTicks,
+ * 									 UBaseType_t uxAutoReload,
+ * 									 void * pvTimerID,
+ * 									 TimerCallbackFunction_t pxCallbackFunction,
+ *									 StaticTimer_t *pxTimerBuffer );
+ *
+ * Creates a new software timer instance, as per xTimerCreate(), but using the
+ * StaticTimer_t variable pointed to by pxTimerBuffer to hold the timer's data
+ * structure instead of allocating it from the FreeRTOS heap.  The memory is not
+ * freed if the timer is later deleted.
+ *
+ * configSUPPORT_STATIC_ALLOCATION must be set to 1 in FreeRTOSConfig.h for
+ * xTimerCreateStatic() to be available.
+ *
+ * @param pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID,
+ * pxCallbackFunction As per xTimerCreate().
+ *
+ * @param pxTimerBuffer Must point to a variable of type StaticTimer_t, which
+ * will be then be used to hold the software timer's data structures.
+ *
+ * @return If the timer is created then a handle to the created timer is
+ * returned.  If pxTimerBuffer was NULL, or configUSE_TIMER_HEAP is 1 and
+ * configTIMER_HEAP_LENGTH timers already exist, then NULL is returned.
+ *
+ * Example usage:
+ * @verbatim
+ *
+ * // The buffer used to hold the software timer's data structure.
+ * static StaticTimer_t xTimerBuffer;
+ *
+ * void main( void )
+ * {
+ * TimerHandle_t xTimer;
+ *
+ *     // Create a one-shot timer with a period of 100 ticks.  The timer's data
+ *     // structure is placed in xTimerBuffer so no dynamic memory allocation is
+ *     // performed and the timer cannot fail to be created.
+ *     xTimer = xTimerCreateStatic( "T1", 100, pdFALSE, NULL, vTimerCallback, &xTimerBuffer );
+ *
+ *     xTimerStart( xTimer, 0 );
+ *     vTaskStartScheduler();
+ * }
+ * @endverbatim
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	TimerHandle_t xTimerCreateStatic( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t *pxTimerBuffer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+#endif /* configSUPPORT_STATIC_ALLOCATION */
 
 /**
  * void *pvTimerGetTimerID( TimerHandle_t xTimer );
@@ -564,6 +620,14 @@ TaskHandle_t xTimerGetTimerDaemonTaskHandle( void );
  * started, and the timers expiry time will be relative to when the scheduler is
  * started, not relative to when xTimerReset() was called.
  *
+ * If configUSE_TIMER_FAST_RESET is set to 1 then xTimerReset(), xTimerStart()
+ * and their FromISR() versions normally move the timer within the kernel's
+ * active timer heap directly, rather than sending a command to the timer
+ * service task, and only unblock the timer service task if the timer becomes
+ * the next timer to expire.  A command is still sent if earlier commands for the
+ * same timer have not been processed yet, so commands always take effect in
+ * the order they were issued.
+ *
  * The configUSE_TIMERS configuration constant must be set to 1 for xTimerReset()
  * to be available.
  *
@@ -1099,6 +1163,17 @@ BaseType_t xTimerPendFunctionCall( PendedFunction_t xFunctionToPend, void *pvPar
  * for use by the kernel only.
  */
 BaseType_t xTimerCreateTimerTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * When configSUPPORT_STATIC_ALLOCATION is set to 1 the timer service task is
+ * created using memory supplied by the application and the application must
+ * provide an implementation of this function, as it must for
+ * vApplicationGetIdleTaskMemory().  *pusTimerTaskStackSize is initialised to
+ * configTIMER_TASK_STACK_DEPTH before the call.
+ */
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	void vApplicationGetTimerTaskMemory( StaticTask_t **ppxTimerTaskTCBBuffer, StackType_t **ppxTimerTaskStackBuffer, uint16_t *pusTimerTaskStackSize );
+#endif
 BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
 #ifdef __cplusplus
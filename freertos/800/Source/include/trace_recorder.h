@@ -0,0 +1,308 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef TRACE_RECORDER_H
+#define TRACE_RECORDER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include trace_recorder.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * A trace recorder built into the kernel.  When configUSE_TRACE_RECORDER is 1
+ * this header is included by FreeRTOS.h, and defines the trace macros so each
+ * traced kernel event writes an eight byte record, stamped with
+ * configTRACE_RECORDER_TIMESTAMP(), into a ring buffer in RAM.  When the ring
+ * is full the oldest records are overwritten, so the buffer always holds the
+ * most recent configTRACE_RECORDER_EVENTS events.
+ *
+ * Writing a record never blocks and never waits for another writer.  The slot
+ * is claimed, and the record written, with interrupts masked for a handful of
+ * instructions using portSET_INTERRUPT_MASK_FROM_ISR(), so records can be
+ * written from tasks and from interrupts, and the records are always in
+ * timestamp order.
+ *
+ * The buffer is self describing - a TraceRecorderHeader_t, then
+ * configTRACE_RECORDER_NAMES name records, then the event records - so it can
+ * be copied from the target by a debugger, or by the application, and decoded
+ * on a host.  Tasks, queues, semaphores, mutexes, event groups, stream buffers
+ * and interrupts are identified by number.  The name table maps the numbers to
+ * names and object types.  Names are not overwritten by events, and the
+ * entries of deleted objects are reused.
+ *
+ * Tasks are identified by their TCB number, so configUSE_TRACE_FACILITY must be
+ * 1.  Other objects are numbered by the recorder when they are created, and
+ * take their names from the queue registry.  Interrupts are identified by the
+ * number passed to traceISR_ENTER(), and can be named with
+ * vTraceRecorderSetISRName().  The tick interrupt is traceTICK_ISR_NUMBER.
+ *
+ * FreeRTOSConfig.h must define:
+ *
+ *   configTRACE_RECORDER_TIMESTAMP() - Returns a free running 32-bit count,
+ *   ideally the processor's cycle counter (the DWT cycle counter on
+ *   Cortex-M3/M4).  The count may wrap, but the decoder can only unwrap it if
+ *   consecutive events are less than one wrap period apart.
+ *
+ *   configTRACE_RECORDER_TIMESTAMP_HZ - The frequency at which the count
+ *   increments.
+ *
+ * and can define configTRACE_RECORDER_EVENTS (a power of two, default 1024)
+ * and configTRACE_RECORDER_NAMES (default 32).
+ */
+
+/* Identifies a trace recorder buffer, and the version of its layout. */
+#define traceRECORDER_MAGIC					( 0x43525452UL ) /* "RTRC" when stored little endian. */
+#define traceRECORDER_VERSION				( 1UL )
+
+/* The number of characters of each name that are recorded, including the
+terminating null if the name is shorter. */
+#define traceRECORDER_NAME_LENGTH			( 12 )
+
+/* The events recorded.  usObject holds the number of the task, object or
+interrupt given in brackets. */
+#define traceEVENT_TASK_CREATE				( ( uint8_t ) 1 )	/* Task created (task). */
+#define traceEVENT_TASK_DELETE				( ( uint8_t ) 2 )	/* Task deleted (task). */
+#define traceEVENT_TASK_READY				( ( uint8_t ) 3 )	/* Task moved to the ready state (task). */
+#define traceEVENT_TASK_SWITCHED_IN			( ( uint8_t ) 4 )	/* Task selected to run (task). */
+#define traceEVENT_TASK_DELAY				( ( uint8_t ) 5 )	/* Running task blocked for a time (task). */
+#define traceEVENT_TASK_SUSPEND				( ( uint8_t ) 6 )	/* Task suspended (task). */
+#define traceEVENT_TASK_NOTIFY_BLOCK		( ( uint8_t ) 7 )	/* Running task blocked waiting for a notification (task). */
+#define traceEVENT_OBJECT_CREATE			( ( uint8_t ) 8 )	/* Object created, ucParameter holds the object type (object). */
+#define traceEVENT_OBJECT_DELETE			( ( uint8_t ) 9 )	/* Object deleted (object). */
+#define traceEVENT_QUEUE_SEND				( ( uint8_t ) 10 )	/* Item written to a queue, or semaphore given, ucParameter is pdTRUE from an interrupt (object). */
+#define traceEVENT_QUEUE_RECEIVE			( ( uint8_t ) 11 )	/* Item read from a queue, or semaphore taken, ucParameter is pdTRUE from an interrupt (object). */
+#define traceEVENT_QUEUE_BLOCK_SEND			( ( uint8_t ) 12 )	/* Running task blocked because a queue was full (object). */
+#define traceEVENT_QUEUE_BLOCK_RECEIVE		( ( uint8_t ) 13 )	/* Running task blocked because a queue was empty, or a semaphore or mutex was not available (object). */
+#define traceEVENT_EVENT_GROUP_BLOCK		( ( uint8_t ) 14 )	/* Running task blocked waiting for event bits (object). */
+#define traceEVENT_STREAM_BUFFER_BLOCK_SEND	( ( uint8_t ) 15 )	/* Running task blocked because a stream buffer was full (object). */
+#define traceEVENT_STREAM_BUFFER_BLOCK_RECEIVE ( ( uint8_t ) 16 ) /* Running task blocked because a stream buffer was empty (object). */
+#define traceEVENT_ISR_ENTER				( ( uint8_t ) 17 )	/* Interrupt handler entered (interrupt). */
+#define traceEVENT_ISR_EXIT					( ( uint8_t ) 18 )	/* Interrupt handler exited (interrupt). */
+
+/* The types of the entries in the name table, and of the objects created.
+The queue types match the queueQUEUE_TYPE_ values in queue.h. */
+#define traceTYPE_QUEUE						( ( uint8_t ) 0 )
+#define traceTYPE_MUTEX						( ( uint8_t ) 1 )
+#define traceTYPE_COUNTING_SEMAPHORE		( ( uint8_t ) 2 )
+#define traceTYPE_BINARY_SEMAPHORE			( ( uint8_t ) 3 )
+#define traceTYPE_RECURSIVE_MUTEX			( ( uint8_t ) 4 )
+#define traceTYPE_EVENT_GROUP				( ( uint8_t ) 5 )
+#define traceTYPE_STREAM_BUFFER				( ( uint8_t ) 6 )
+#define traceTYPE_MESSAGE_BUFFER			( ( uint8_t ) 7 )
+#define traceTYPE_TASK						( ( uint8_t ) 8 )
+#define traceTYPE_ISR						( ( uint8_t ) 9 )
+
+/* Values of ucFlags in a name record. */
+#define traceNAME_FLAG_USED					( ( uint8_t ) 0x01 )
+#define traceNAME_FLAG_DELETED				( ( uint8_t ) 0x02 )
+
+/* The start of the buffer.  All fields are 32-bit so the layout is the same on
+any target of the same endianness. */
+typedef struct xTRACE_RECORDER_HEADER
+{
+	uint32_t ulMagic;						/*< traceRECORDER_MAGIC. */
+	uint32_t ulVersion;						/*< traceRECORDER_VERSION. */
+	uint32_t ulTimestampHz;					/*< configTRACE_RECORDER_TIMESTAMP_HZ. */
+	uint32_t ulEventCapacity;				/*< The number of event records in the buffer. */
+	uint32_t ulNameCapacity;				/*< The number of name records in the buffer. */
+	uint32_t ulEventsWritten;				/*< The number of events written since the buffer was last cleared - the next event is written to ulEventsWritten modulo ulEventCapacity. */
+	uint32_t ulNamesDropped;				/*< The number of names that were not recorded because the name table was full. */
+	uint32_t ulEnabled;						/*< Events are only recorded while this is non-zero. */
+} TraceRecorderHeader_t;
+
+/* An entry in the name table. */
+typedef struct xTRACE_RECORDER_NAME
+{
+	uint16_t usObject;						/*< The number of the task, object or interrupt. */
+	uint8_t ucType;							/*< One of the traceTYPE_ values. */
+	uint8_t ucFlags;						/*< traceNAME_FLAG_ bits. */
+	char cName[ traceRECORDER_NAME_LENGTH ];/*< The name, which is not null terminated if it is traceRECORDER_NAME_LENGTH characters long. */
+} TraceRecorderName_t;
+
+/* A record of one event. */
+typedef struct xTRACE_RECORDER_EVENT
+{
+	uint32_t ulTimestamp;					/*< configTRACE_RECORDER_TIMESTAMP() when the event occurred. */
+	uint16_t usObject;						/*< The number of the task, object or interrupt the event relates to. */
+	uint8_t ucEvent;						/*< One of the traceEVENT_ values. */
+	uint8_t ucParameter;					/*< Depends on the event. */
+} TraceRecorderEvent_t;
+
+#if( configUSE_TRACE_RECORDER == 1 )
+
+	#if( configUSE_TRACE_FACILITY != 1 )
+		#error configUSE_TRACE_RECORDER requires configUSE_TRACE_FACILITY to be 1.
+	#endif
+
+	#ifndef configTRACE_RECORDER_TIMESTAMP
+		#error configUSE_TRACE_RECORDER requires configTRACE_RECORDER_TIMESTAMP() to be defined in FreeRTOSConfig.h.
+	#endif
+
+	#ifndef configTRACE_RECORDER_TIMESTAMP_HZ
+		#error configUSE_TRACE_RECORDER requires configTRACE_RECORDER_TIMESTAMP_HZ to be defined in FreeRTOSConfig.h.
+	#endif
+
+	#ifndef configTRACE_RECORDER_EVENTS
+		#define configTRACE_RECORDER_EVENTS 1024
+	#endif
+
+	#if( ( configTRACE_RECORDER_EVENTS & ( configTRACE_RECORDER_EVENTS - 1 ) ) != 0 )
+		#error configTRACE_RECORDER_EVENTS must be a power of two.
+	#endif
+
+	#ifndef configTRACE_RECORDER_NAMES
+		#define configTRACE_RECORDER_NAMES 32
+	#endif
+
+	/* The whole buffer, as it is held in RAM. */
+	typedef struct xTRACE_RECORDER_BUFFER
+	{
+		TraceRecorderHeader_t xHeader;
+		TraceRecorderName_t xNames[ configTRACE_RECORDER_NAMES ];
+		TraceRecorderEvent_t xEvents[ configTRACE_RECORDER_EVENTS ];
+	} TraceRecorderBuffer_t;
+
+	/*
+	 * Start recording events, which is the default, or stop recording events.
+	 * Names are recorded while the recorder is stopped, so events recorded
+	 * after it is started again can be decoded.
+	 */
+	void vTraceRecorderStart( void );
+	void vTraceRecorderStop( void );
+
+	/*
+	 * Discard all the recorded events.  The name table is not cleared.
+	 */
+	void vTraceRecorderClear( void );
+
+	/*
+	 * Return the buffer, and set *pxBufferSize to its size in bytes, so it can
+	 * be copied out for decoding.  Stop the recorder first if the copy must be
+	 * consistent.
+	 */
+	const TraceRecorderBuffer_t *pxTraceRecorderGetBuffer( size_t *pxBufferSize );
+
+	/*
+	 * Name the interrupt identified by uxISRNumber in traceISR_ENTER().
+	 */
+	void vTraceRecorderSetISRName( UBaseType_t uxISRNumber, const char *pcName );
+
+	/*
+	 * Used by the trace macros below - not for use by application code.
+	 */
+	void vTraceRecorderEvent( uint8_t ucEvent, uint8_t ucParameter, UBaseType_t uxObject );
+	void vTraceRecorderTaskCreate( UBaseType_t uxTaskNumber, const char *pcName );
+	UBaseType_t uxTraceRecorderObjectCreate( uint8_t ucType );
+	void vTraceRecorderObjectDelete( uint8_t ucEvent, uint8_t ucType, UBaseType_t uxObject );
+	void vTraceRecorderSetObjectName( UBaseType_t uxObject, const char *pcName );
+
+	/* The trace macros.  Those that are not defined here are removed by
+	FreeRTOS.h as normal.  Each expands within the kernel source file that
+	defines the structure it accesses. */
+	#define traceTASK_CREATE( pxNewTCB )						vTraceRecorderTaskCreate( ( pxNewTCB )->uxTCBNumber, ( pxNewTCB )->pcTaskName )
+	#define traceTASK_DELETE( pxTCB )							vTraceRecorderObjectDelete( traceEVENT_TASK_DELETE, traceTYPE_TASK, ( pxTCB )->uxTCBNumber )
+	#define traceMOVED_TASK_TO_READY_STATE( pxTCB )				vTraceRecorderEvent( traceEVENT_TASK_READY, 0, ( pxTCB )->uxTCBNumber );
+	#define traceTASK_SWITCHED_IN()								vTraceRecorderEvent( traceEVENT_TASK_SWITCHED_IN, 0, pxCurrentTCB->uxTCBNumber )
+	#define traceTASK_DELAY()									vTraceRecorderEvent( traceEVENT_TASK_DELAY, 0, pxCurrentTCB->uxTCBNumber )
+	#define traceTASK_DELAY_UNTIL()								vTraceRecorderEvent( traceEVENT_TASK_DELAY, 0, pxCurrentTCB->uxTCBNumber )
+	#define traceTASK_SUSPEND( pxTCB )							vTraceRecorderEvent( traceEVENT_TASK_SUSPEND, 0, ( pxTCB )->uxTCBNumber )
+	#define traceTASK_NOTIFY_TAKE_BLOCK()						vTraceRecorderEvent( traceEVENT_TASK_NOTIFY_BLOCK, 0, pxCurrentTCB->uxTCBNumber )
+	#define traceTASK_NOTIFY_WAIT_BLOCK()						vTraceRecorderEvent( traceEVENT_TASK_NOTIFY_BLOCK, 0, pxCurrentTCB->uxTCBNumber )
+
+	#define traceQUEUE_CREATE( pxNewQueue )						( pxNewQueue )->uxQueueNumber = uxTraceRecorderObjectCreate( ( pxNewQueue )->ucQueueType )
+	#define traceQUEUE_DELETE( pxQueue )						vTraceRecorderObjectDelete( traceEVENT_OBJECT_DELETE, ( pxQueue )->ucQueueType, ( pxQueue )->uxQueueNumber )
+	#define traceQUEUE_REGISTRY_ADD( xQueue, pcQueueName )		vTraceRecorderSetObjectName( ( ( Queue_t * ) ( xQueue ) )->uxQueueNumber, ( pcQueueName ) )
+	#define traceQUEUE_SEND( pxQueue )							vTraceRecorderEvent( traceEVENT_QUEUE_SEND, pdFALSE, ( pxQueue )->uxQueueNumber )
+	#define traceQUEUE_SEND_FROM_ISR( pxQueue )					vTraceRecorderEvent( traceEVENT_QUEUE_SEND, pdTRUE, ( pxQueue )->uxQueueNumber )
+	#define traceQUEUE_RECEIVE( pxQueue )						vTraceRecorderEvent( traceEVENT_QUEUE_RECEIVE, pdFALSE, ( pxQueue )->uxQueueNumber )
+	#define traceQUEUE_RECEIVE_FROM_ISR( pxQueue )				vTraceRecorderEvent( traceEVENT_QUEUE_RECEIVE, pdTRUE, ( pxQueue )->uxQueueNumber )
+	#define traceBLOCKING_ON_QUEUE_SEND( pxQueue )				vTraceRecorderEvent( traceEVENT_QUEUE_BLOCK_SEND, 0, ( pxQueue )->uxQueueNumber )
+	#define traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue )			vTraceRecorderEvent( traceEVENT_QUEUE_BLOCK_RECEIVE, 0, ( pxQueue )->uxQueueNumber )
+
+	#define traceEVENT_GROUP_CREATE( pxEventBits )				( pxEventBits )->uxEventGroupNumber = uxTraceRecorderObjectCreate( traceTYPE_EVENT_GROUP )
+	#define traceEVENT_GROUP_DELETE( xEventGroup )				vTraceRecorderObjectDelete( traceEVENT_OBJECT_DELETE, traceTYPE_EVENT_GROUP, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+	#define traceEVENT_GROUP_SYNC_BLOCK( xEventGroup, uxBitsToSet, uxBitsToWaitFor )	vTraceRecorderEvent( traceEVENT_EVENT_GROUP_BLOCK, 0, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+	#define traceEVENT_GROUP_WAIT_BITS_BLOCK( xEventGroup, uxBitsToWaitFor )			vTraceRecorderEvent( traceEVENT_EVENT_GROUP_BLOCK, 0, ( ( EventGroup_t * ) ( xEventGroup ) )->uxEventGroupNumber )
+
+	#define traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer )	( pxStreamBuffer )->uxStreamBufferNumber = uxTraceRecorderObjectCreate( ( ( xIsMessageBuffer ) != pdFALSE ) ? traceTYPE_MESSAGE_BUFFER : traceTYPE_STREAM_BUFFER )
+	#define traceSTREAM_BUFFER_DELETE( xStreamBuffer )						vTraceRecorderObjectDelete( traceEVENT_OBJECT_DELETE, traceTYPE_STREAM_BUFFER, ( ( StreamBuffer_t * ) ( xStreamBuffer ) )->uxStreamBufferNumber )
+	#define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )			vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_BLOCK_SEND, 0, ( ( StreamBuffer_t * ) ( xStreamBuffer ) )->uxStreamBufferNumber )
+	#define traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer )			vTraceRecorderEvent( traceEVENT_STREAM_BUFFER_BLOCK_RECEIVE, 0, ( ( StreamBuffer_t * ) ( xStreamBuffer ) )->uxStreamBufferNumber )
+
+	#define traceISR_ENTER( uxISRNumber )						vTraceRecorderEvent( traceEVENT_ISR_ENTER, 0, ( uxISRNumber ) )
+	#define traceISR_EXIT()										vTraceRecorderEvent( traceEVENT_ISR_EXIT, 0, 0 )
+
+#endif /* configUSE_TRACE_RECORDER */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TRACE_RECORDER_H */
+
@@ -0,0 +1,296 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+#ifndef WORK_QUEUE_H
+#define WORK_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include work_queue.h"
+#endif
+
+/* Work functions have the PendedFunction_t prototype defined in timers.h. */
+#include "timers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A work queue runs functions deferred by interrupts and tasks in one of a
+ * number of worker tasks, each of which has its own priority.  It does the
+ * same job as xTimerPendFunctionCallFromISR(), but:
+ *
+ * + Work is not all run at the priority of the timer service task, one item
+ *   after another, so urgent work submitted to a high priority worker does not
+ *   wait behind long running work submitted to a low priority worker.
+ *
+ * + Each worker reads its work from a multiple producer ring queue (see
+ *   ring_queue.h), so submitting work from an interrupt does not mask
+ *   interrupts unless the worker is blocked and has to be woken.
+ *
+ * + A worker that is woken runs up to configWORK_QUEUE_BATCH_SIZE items
+ *   before it yields to other tasks of the same priority or blocks again, so a
+ *   burst of work costs one wake up rather than one per item.
+ *
+ * + Each worker counts the work it runs, the deepest its queue has been, and,
+ *   if configWORK_QUEUE_TIMESTAMP() is defined, the time each item waited to
+ *   be run.
+ *
+ * The functions have the same prototype as those passed to
+ * xTimerPendFunctionCall(), so deferred work can be moved from the timer
+ * service task to a work queue without change.  They run in the worker's
+ * context, so can block, but must not use the worker's direct to task
+ * notification, which the worker uses to wait for work.
+ *
+ * A work queue is never deleted.
+ *
+ * \defgroup WorkQueue WorkQueue
+ */
+
+/**
+ * work_queue.h
+ *
+ * Type by which work queues are referenced.  For example, a call to
+ * xWorkQueueCreate() returns a WorkQueueHandle_t variable that can then be used
+ * as a parameter to xWorkQueueSubmit(), xWorkQueueSubmitFromISR(), etc.
+ *
+ * \defgroup WorkQueueHandle_t WorkQueueHandle_t
+ * \ingroup WorkQueue
+ */
+typedef void * WorkQueueHandle_t;
+
+/**
+ * work_queue.h
+ *
+ * The statistics of one worker, as returned by vWorkQueueGetStats().  The
+ * latencies are measured in the units of configWORK_QUEUE_TIMESTAMP(), from
+ * submitting an item to the worker starting to run it.  Entry n of
+ * ulLatencyHistogram counts the items that waited less than 2^n units, and
+ * not less than 2^(n-1) units, other than the last entry, which counts every
+ * item that waited longer.
+ *
+ * \ingroup WorkQueue
+ */
+typedef struct xWORK_QUEUE_STATS
+{
+	UBaseType_t uxWaiting;			/*< The number of items waiting to be run when the statistics were read. */
+	UBaseType_t uxMaxWaiting;		/*< The most items that have been waiting when the worker started a batch. */
+	uint32_t ulItemsRun;			/*< The number of items the worker has run. */
+	uint32_t ulBatches;				/*< The number of batches the items were run in. */
+	volatile UBaseType_t uxSubmitFailures;	/*< The number of items that could not be submitted because the worker's queue was full. */
+
+	#ifdef configWORK_QUEUE_TIMESTAMP
+		uint32_t ulMinLatency;
+		uint32_t ulMaxLatency;
+		uint64_t ullTotalLatency;
+		uint32_t ulLatencyHistogram[ configWORK_QUEUE_LATENCY_BUCKETS ];
+	#endif
+} WorkQueueStats_t;
+
+/**
+ * work_queue.h
+ *<pre>
+ WorkQueueHandle_t xWorkQueueCreate( UBaseType_t uxWorkers,
+									 const UBaseType_t * const puxPriorities,
+									 UBaseType_t uxLength,
+									 uint16_t usStackDepth );
+ </pre>
+ *
+ * Creates a work queue and its worker tasks.  The memory used by the work
+ * queue, its ring queues and its workers is allocated using pvPortMalloc().
+ *
+ * @param uxWorkers The number of worker tasks.
+ *
+ * @param puxPriorities An array of uxWorkers priorities.  Worker n is created
+ * with priority puxPriorities[ n ], and runs the work submitted with an
+ * uxWorker parameter of n.
+ *
+ * @param uxLength The maximum number of items each worker can have waiting.
+ * Must be a power of two.
+ *
+ * @param usStackDepth The stack depth of each worker, as for xTaskCreate().
+ *
+ * @return If NULL is returned, then the work queue cannot be created because
+ * there is insufficient heap memory available.  Otherwise the handle of the
+ * created work queue is returned.
+ *
+ * Example usage:
+   <pre>
+	static const UBaseType_t uxPriorities[ 2 ] = { 4, 1 };
+	WorkQueueHandle_t xWorkQueue;
+
+	// Create a work queue with an urgent worker at priority 4 and a bulk
+	// worker at priority 1, each of which can have 16 items waiting.
+	xWorkQueue = xWorkQueueCreate( 2, uxPriorities, 16, configMINIMAL_STACK_SIZE * 2 );
+   </pre>
+ * \defgroup xWorkQueueCreate xWorkQueueCreate
+ * \ingroup WorkQueue
+ */
+WorkQueueHandle_t xWorkQueueCreate( UBaseType_t uxWorkers, const UBaseType_t * const puxPriorities, UBaseType_t uxLength, uint16_t usStackDepth ) PRIVILEGED_FUNCTION;
+
+/**
+ * work_queue.h
+ *<pre>
+ BaseType_t xWorkQueueSubmit( WorkQueueHandle_t xWorkQueue,
+							  UBaseType_t uxWorker,
+							  PendedFunction_t xFunction,
+							  void *pvParameter1,
+							  uint32_t ulParameter2 );
+ </pre>
+ *
+ * Submits a function to be run by a worker, from a task.  Never blocks.
+ *
+ * @param xWorkQueue The work queue.
+ *
+ * @param uxWorker The index of the worker that runs the function.
+ *
+ * @param xFunction The function to run, which is passed pvParameter1 and
+ * ulParameter2.
+ *
+ * @return pdPASS if the work was submitted, or errQUEUE_FULL if the worker
+ * already had uxLength items waiting.
+ *
+ * \defgroup xWorkQueueSubmit xWorkQueueSubmit
+ * \ingroup WorkQueue
+ */
+BaseType_t xWorkQueueSubmit( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker, PendedFunction_t xFunction, void *pvParameter1, uint32_t ulParameter2 ) PRIVILEGED_FUNCTION;
+
+/**
+ * work_queue.h
+ *<pre>
+ BaseType_t xWorkQueueSubmitFromISR( WorkQueueHandle_t xWorkQueue,
+									 UBaseType_t uxWorker,
+									 PendedFunction_t xFunction,
+									 void *pvParameter1,
+									 uint32_t ulParameter2,
+									 BaseType_t *pxHigherPriorityTaskWoken );
+ </pre>
+ *
+ * Interrupt safe version of xWorkQueueSubmit().  Interrupts are only masked if
+ * the worker is blocked and has to be woken.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if submitting the work woke a
+ * worker that has a priority above the priority of the currently running task,
+ * in which case a context switch should be requested before the interrupt is
+ * exited.  pxHigherPriorityTaskWoken is optional and can be NULL.
+ *
+ * Example usage:
+   <pre>
+	// The work queue created in the xWorkQueueCreate() example.
+	WorkQueueHandle_t xWorkQueue;
+
+	static void prvProcessFrame( void *pvFrame, uint32_t ulLength )
+	{
+		// Runs in the bulk worker.
+	}
+
+	void vEthernetISR( void )
+	{
+	BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+		xWorkQueueSubmitFromISR( xWorkQueue, 1, prvProcessFrame, pvNextFrame(), ulFrameLength(), &xHigherPriorityTaskWoken );
+		portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+	}
+   </pre>
+ * \defgroup xWorkQueueSubmitFromISR xWorkQueueSubmitFromISR
+ * \ingroup WorkQueue
+ */
+BaseType_t xWorkQueueSubmitFromISR( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker, PendedFunction_t xFunction, void *pvParameter1, uint32_t ulParameter2, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * work_queue.h
+ *<pre>
+ void vWorkQueueGetStats( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker, WorkQueueStats_t *pxStats );
+ </pre>
+ *
+ * Copies the statistics of a worker into *pxStats.  Can be called from any
+ * task.  The statistics are updated by the worker as it runs each item, so an
+ * item that is running when they are read may only be partly counted.
+ *
+ * \defgroup vWorkQueueGetStats vWorkQueueGetStats
+ * \ingroup WorkQueue
+ */
+void vWorkQueueGetStats( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker, WorkQueueStats_t * const pxStats ) PRIVILEGED_FUNCTION;
+
+/**
+ * work_queue.h
+ *<pre>
+ TaskHandle_t xWorkQueueGetWorkerHandle( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker );
+ </pre>
+ *
+ * Returns the handle of a worker task, for example so its run time or stack
+ * high water mark can be queried.
+ *
+ * \defgroup xWorkQueueGetWorkerHandle xWorkQueueGetWorkerHandle
+ * \ingroup WorkQueue
+ */
+TaskHandle_t xWorkQueueGetWorkerHandle( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORK_QUEUE_H */
+
@@ -0,0 +1,552 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "memory_pool.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* Bits used in the ucFlags member of a memory pool. */
+#define mpFLAGS_IS_STATICALLY_ALLOCATED		( ( uint8_t ) 1 )
+
+/*
+ * A memory pool is an array of uxBlocks blocks, each of xBlockSize bytes.  The
+ * free blocks form a singly linked list - the first word of each free block
+ * holds the address of the next free block - so a block is allocated by
+ * unlinking the head of the list and freed by pushing it back on, neither of
+ * which depends on the number of blocks.  The list and the counters are only
+ * accessed inside a critical section, so the pool can be used from tasks and
+ * interrupts at once.
+ *
+ * Tasks waiting for a block are held in xTasksWaitingToAllocate, in priority
+ * order, using the same event list mechanism as queues.
+ */
+typedef struct xMEMORY_POOL
+{
+	void *pvFreeList;					/*< The first free block, or NULL if every block is allocated. */
+	uint8_t *pucStorage;				/*< The blocks, supplied by the application. */
+	size_t xBlockSize;					/*< The size of each block, rounded up by memorypoolBLOCK_SIZE(). */
+	UBaseType_t uxBlocks;
+	UBaseType_t uxFreeBlocks;
+	UBaseType_t uxMinimumFreeBlocks;	/*< The fewest blocks that have been free, from which the high water mark is calculated. */
+	uint32_t ulAllocations;
+	uint32_t ulBlockedAllocations;
+	uint32_t ulFailedAllocations;
+	List_t xTasksWaitingToAllocate;
+	uint8_t ucFlags;
+} MemoryPool_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by the create functions to initialise a new pool, which threads
+ * every block onto the free list.
+ */
+static void prvInitialiseNewMemoryPool( MemoryPool_t * const pxMemoryPool, UBaseType_t uxBlocks, size_t xBlockSize, uint8_t * const pucPoolStorageArea, uint8_t ucFlags );
+
+/*
+ * Unlink the block at the head of the free list, or return NULL if the pool is
+ * empty.  Must be called from a critical section.
+ */
+static void *prvTakeBlock( MemoryPool_t * const pxMemoryPool );
+
+/*
+ * Push a block onto the free list, then wake the highest priority task waiting
+ * for a block, if any.  Returns the value returned by xTaskRemoveFromEventList(),
+ * or pdFALSE if no task was waiting.  Must be called from a critical section.
+ */
+static BaseType_t prvReturnBlock( MemoryPool_t * const pxMemoryPool, void *pvBlock );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	MemoryPoolHandle_t xMemoryPoolCreate( UBaseType_t uxBlocks, size_t xBlockSize, uint8_t * const pucPoolStorageArea )
+	{
+	MemoryPool_t *pxMemoryPool;
+
+		configASSERT( pucPoolStorageArea );
+
+		pxMemoryPool = ( MemoryPool_t * ) pvPortMalloc( sizeof( MemoryPool_t ) );
+
+		if( ( pxMemoryPool != NULL ) && ( pucPoolStorageArea != NULL ) )
+		{
+			prvInitialiseNewMemoryPool( pxMemoryPool, uxBlocks, xBlockSize, pucPoolStorageArea, ( uint8_t ) 0 );
+			traceMEMORY_POOL_CREATE( pxMemoryPool );
+		}
+		else
+		{
+			/* vPortFree() accepts NULL. */
+			vPortFree( ( void * ) pxMemoryPool );
+			pxMemoryPool = NULL;
+			traceMEMORY_POOL_CREATE_FAILED();
+		}
+
+		return ( MemoryPoolHandle_t ) pxMemoryPool;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	MemoryPoolHandle_t xMemoryPoolCreateStatic( UBaseType_t uxBlocks, size_t xBlockSize, uint8_t * const pucPoolStorageArea, StaticMemoryPool_t * const pxStaticMemoryPool )
+	{
+	MemoryPool_t * const pxMemoryPool = ( MemoryPool_t * ) pxStaticMemoryPool; /*lint !e740 !e9087 MemoryPool_t and StaticMemoryPool_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+	MemoryPoolHandle_t xReturn;
+
+		configASSERT( pucPoolStorageArea );
+		configASSERT( pxStaticMemoryPool );
+
+		/* The StaticMemoryPool_t structure must be exactly the same size as the
+		real pool structure, otherwise the application has been built with a
+		different configuration to the kernel. */
+		configASSERT( sizeof( StaticMemoryPool_t ) == sizeof( MemoryPool_t ) );
+
+		if( ( pucPoolStorageArea != NULL ) && ( pxStaticMemoryPool != NULL ) )
+		{
+			prvInitialiseNewMemoryPool( pxMemoryPool, uxBlocks, xBlockSize, pucPoolStorageArea, mpFLAGS_IS_STATICALLY_ALLOCATED );
+			traceMEMORY_POOL_CREATE( pxMemoryPool );
+			xReturn = ( MemoryPoolHandle_t ) pxStaticMemoryPool;
+		}
+		else
+		{
+			xReturn = NULL;
+			traceMEMORY_POOL_CREATE_FAILED();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewMemoryPool( MemoryPool_t * const pxMemoryPool, UBaseType_t uxBlocks, size_t xBlockSize, uint8_t * const pucPoolStorageArea, uint8_t ucFlags )
+{
+UBaseType_t uxBlock;
+uint8_t *pucBlock;
+
+	configASSERT( uxBlocks > ( UBaseType_t ) 0 );
+	configASSERT( xBlockSize > ( size_t ) 0 );
+
+	/* Every block is aligned if the storage is. */
+	configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pucPoolStorageArea ) & ( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) ) == ( portPOINTER_SIZE_TYPE ) 0 );
+
+	pxMemoryPool->pucStorage = pucPoolStorageArea;
+	pxMemoryPool->xBlockSize = memorypoolBLOCK_SIZE( xBlockSize );
+	pxMemoryPool->uxBlocks = uxBlocks;
+	pxMemoryPool->uxFreeBlocks = uxBlocks;
+	pxMemoryPool->uxMinimumFreeBlocks = uxBlocks;
+	pxMemoryPool->ulAllocations = 0UL;
+	pxMemoryPool->ulBlockedAllocations = 0UL;
+	pxMemoryPool->ulFailedAllocations = 0UL;
+	pxMemoryPool->ucFlags = ucFlags;
+	vListInitialise( &( pxMemoryPool->xTasksWaitingToAllocate ) );
+
+	/* Link the blocks in address order, so they are first handed out in the
+	order they appear in the array. */
+	pucBlock = pucPoolStorageArea;
+
+	for( uxBlock = ( UBaseType_t ) 1; uxBlock < uxBlocks; uxBlock++ )
+	{
+		*( ( void ** ) pucBlock ) = ( void * ) ( pucBlock + pxMemoryPool->xBlockSize ); /*lint !e826 !e9087 The block is at least the size of a pointer and is aligned. */
+		pucBlock += pxMemoryPool->xBlockSize;
+	}
+
+	*( ( void ** ) pucBlock ) = NULL; /*lint !e826 !e9087 The block is at least the size of a pointer and is aligned. */
+	pxMemoryPool->pvFreeList = ( void * ) pucPoolStorageArea;
+}
+/*-----------------------------------------------------------*/
+
+void vMemoryPoolDelete( MemoryPoolHandle_t xMemoryPool )
+{
+MemoryPool_t * const pxMemoryPool = ( MemoryPool_t * ) xMemoryPool;
+
+	configASSERT( pxMemoryPool );
+	configASSERT( listLIST_IS_EMPTY( &( pxMemoryPool->xTasksWaitingToAllocate ) ) != pdFALSE );
+
+	traceMEMORY_POOL_DELETE( xMemoryPool );
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		if( ( pxMemoryPool->ucFlags & mpFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+		{
+			/* Only the structure was allocated - the blocks belong to the
+			application. */
+			vPortFree( ( void * ) pxMemoryPool );
+		}
+		else
+		{
+			/* The memory belongs to the application. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+static void *prvTakeBlock( MemoryPool_t * const pxMemoryPool )
+{
+void *pvBlock = pxMemoryPool->pvFreeList;
+
+	if( pvBlock != NULL )
+	{
+		pxMemoryPool->pvFreeList = *( ( void ** ) pvBlock );
+		pxMemoryPool->uxFreeBlocks--;
+		pxMemoryPool->ulAllocations++;
+
+		if( pxMemoryPool->uxFreeBlocks < pxMemoryPool->uxMinimumFreeBlocks )
+		{
+			pxMemoryPool->uxMinimumFreeBlocks = pxMemoryPool->uxFreeBlocks;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvBlock;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReturnBlock( MemoryPool_t * const pxMemoryPool, void *pvBlock )
+{
+BaseType_t xReturn = pdFALSE;
+
+	/* The block must be one of the pool's blocks, and the pool cannot already
+	hold every block. */
+	configASSERT( ( ( uint8_t * ) pvBlock >= pxMemoryPool->pucStorage ) && ( ( uint8_t * ) pvBlock < ( pxMemoryPool->pucStorage + ( ( size_t ) pxMemoryPool->uxBlocks * pxMemoryPool->xBlockSize ) ) ) );
+	configASSERT( ( ( size_t ) ( ( uint8_t * ) pvBlock - pxMemoryPool->pucStorage ) % pxMemoryPool->xBlockSize ) == ( size_t ) 0 );
+	configASSERT( pxMemoryPool->uxFreeBlocks < pxMemoryPool->uxBlocks );
+
+	*( ( void ** ) pvBlock ) = pxMemoryPool->pvFreeList;
+	pxMemoryPool->pvFreeList = pvBlock;
+	pxMemoryPool->uxFreeBlocks++;
+
+	/* The woken task takes the block when it runs.  Another task or
+	interrupt could take it first, in which case the woken task waits again
+	for the rest of its block time. */
+	if( listLIST_IS_EMPTY( &( pxMemoryPool->xTasksWaitingToAllocate ) ) == pdFALSE )
+	{
+		xReturn = xTaskRemoveFromEventList( &( pxMemoryPool->xTasksWaitingToAllocate ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void *pvMemoryPoolAllocate( MemoryPoolHandle_t xMemoryPool, TickType_t xTicksToWait )
+{
+MemoryPool_t * const pxMemoryPool = ( MemoryPool_t * ) xMemoryPool;
+void *pvReturn;
+BaseType_t xEntryTimeSet = pdFALSE, xBlocked = pdFALSE, xYieldRequired;
+TimeOut_t xTimeOut;
+
+	configASSERT( pxMemoryPool );
+
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			pvReturn = prvTakeBlock( pxMemoryPool );
+
+			if( pvReturn != NULL )
+			{
+				if( xBlocked != pdFALSE )
+				{
+					pxMemoryPool->ulBlockedAllocations++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				break;
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* The pool is empty and either no block time was specified
+				or the block time has expired. */
+				pxMemoryPool->ulFailedAllocations++;
+				taskEXIT_CRITICAL();
+				traceMEMORY_POOL_ALLOCATE_FAILED( xMemoryPool );
+				break;
+			}
+			else if( xEntryTimeSet == pdFALSE )
+			{
+				/* The pool was empty and a block time was specified so
+				configure the timeout structure. */
+				vTaskSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Entry time was already set. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* Interrupts and other tasks can free blocks now the critical section
+		has been exited.  The scheduler is suspended so no other task can run
+		while this task places itself on the event list, and the event list is
+		only updated inside a critical section, so an interrupt that frees a
+		block cannot see it part updated. */
+		xYieldRequired = pdFALSE;
+		vTaskSuspendAll();
+		taskENTER_CRITICAL();
+		{
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( pxMemoryPool->uxFreeBlocks == ( UBaseType_t ) 0 )
+				{
+					traceBLOCKING_ON_MEMORY_POOL_ALLOCATE( xMemoryPool );
+					vTaskPlaceOnEventList( &( pxMemoryPool->xTasksWaitingToAllocate ), xTicksToWait );
+					xBlocked = pdTRUE;
+					xYieldRequired = pdTRUE;
+				}
+				else
+				{
+					/* A block was freed since the critical section above was
+					exited, so try again. */
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Timed out.  Try once more without blocking, in case a block
+				was freed as the time expired. */
+				xTicksToWait = ( TickType_t ) 0;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		/* A task that placed itself on the event list is no longer in the
+		Ready state, so must yield unless resuming the scheduler already
+		did. */
+		if( ( xTaskResumeAll() == pdFALSE ) && ( xYieldRequired != pdFALSE ) )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void *pvMemoryPoolAllocateFromISR( MemoryPoolHandle_t xMemoryPool )
+{
+MemoryPool_t * const pxMemoryPool = ( MemoryPool_t * ) xMemoryPool;
+void *pvReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxMemoryPool );
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  See the comments in
+	xQueueGenericSendFromISR(). */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pvReturn = prvTakeBlock( pxMemoryPool );
+
+		if( pvReturn == NULL )
+		{
+			pxMemoryPool->ulFailedAllocations++;
+			traceMEMORY_POOL_ALLOCATE_FAILED( xMemoryPool );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vMemoryPoolFree( MemoryPoolHandle_t xMemoryPool, void *pvBlock )
+{
+MemoryPool_t * const pxMemoryPool = ( MemoryPool_t * ) xMemoryPool;
+
+	configASSERT( pxMemoryPool );
+	configASSERT( pvBlock );
+
+	taskENTER_CRITICAL();
+	{
+		if( prvReturnBlock( pxMemoryPool, pvBlock ) != pdFALSE )
+		{
+			/* The woken task has a priority above this task. */
+			#if( configUSE_PREEMPTION == 1 )
+			{
+				portYIELD_WITHIN_API();
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vMemoryPoolFreeFromISR( MemoryPoolHandle_t xMemoryPool, void *pvBlock, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+MemoryPool_t * const pxMemoryPool = ( MemoryPool_t * ) xMemoryPool;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxMemoryPool );
+	configASSERT( pvBlock );
+
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( prvReturnBlock( pxMemoryPool, pvBlock ) != pdFALSE )
+		{
+			if( pxHigherPriorityTaskWoken != NULL )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxMemoryPoolGetFreeBlocks( MemoryPoolHandle_t xMemoryPool )
+{
+MemoryPool_t * const pxMemoryPool = ( MemoryPool_t * ) xMemoryPool;
+
+	configASSERT( pxMemoryPool );
+
+	/* A single aligned read, so no critical section is needed. */
+	return pxMemoryPool->uxFreeBlocks;
+}
+/*-----------------------------------------------------------*/
+
+void vMemoryPoolGetStats( MemoryPoolHandle_t xMemoryPool, MemoryPoolStats_t * const pxStats )
+{
+MemoryPool_t * const pxMemoryPool = ( MemoryPool_t * ) xMemoryPool;
+
+	configASSERT( pxMemoryPool );
+	configASSERT( pxStats );
+
+	/* The counters are read together so they are consistent with each
+	other. */
+	taskENTER_CRITICAL();
+	{
+		pxStats->uxBlocks = pxMemoryPool->uxBlocks;
+		pxStats->uxBlocksInUse = pxMemoryPool->uxBlocks - pxMemoryPool->uxFreeBlocks;
+		pxStats->uxMaxBlocksInUse = pxMemoryPool->uxBlocks - pxMemoryPool->uxMinimumFreeBlocks;
+		pxStats->ulAllocations = pxMemoryPool->ulAllocations;
+		pxStats->ulBlockedAllocations = pxMemoryPool->ulBlockedAllocations;
+		pxStats->ulFailedAllocations = pxMemoryPool->ulFailedAllocations;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
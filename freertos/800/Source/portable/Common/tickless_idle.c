@@ -0,0 +1,362 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*-----------------------------------------------------------
+ * A hardware independent implementation of portSUPPRESS_TICKS_AND_SLEEP() for
+ * ports that generate the tick interrupt from a SysTick like down counter.  See
+ * tickless_idle.h for a description of the timer the port must provide.
+ *
+ * The same code is used by the Cortex-M ports, which drive the SysTick, and by
+ * the POSIX simulator port, which drives a simulated timer, so the algorithm can
+ * be tested on a host.
+ *----------------------------------------------------------*/
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "tickless_idle.h"
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+
+/* A period shorter than 1 / ticklessMINIMUM_PERIOD_DIVISOR of a tick period is
+never programmed into the timer, so the code that reprograms the timer always
+completes before the timer next reaches zero. */
+#define ticklessMINIMUM_PERIOD_DIVISOR		( 4UL )
+
+/*
+ * Add the time that has passed since the timer was stopped, which was when the
+ * reference counter had the value ulStoppedAt, to the counts that are yet to be
+ * compensated for.  Called immediately before the timer is started again, so
+ * the time taken to stop and start the timer is not counted as lost.
+ */
+static void prvAccountForStoppedTime( uint32_t ulStoppedAt ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return ulPeriod shortened by as many of the counts that are yet to be
+ * compensated for as possible, without making it shorter than the minimum
+ * period.
+ */
+static uint32_t prvCompensatePeriod( uint32_t ulPeriod ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The number of timer counts that make up one tick period. */
+static uint32_t ulTimerCountsForOneTick = 0;
+
+/* The maximum number of tick periods that can be suppressed is limited by the
+resolution of the timer's reload register. */
+static TickType_t xMaximumPossibleSuppressedTicks = 0;
+
+/* See ticklessMINIMUM_PERIOD_DIVISOR. */
+static uint32_t ulMinimumPeriod = 0;
+
+/* The number of reference counter counts in one timer count. */
+static uint32_t ulReferenceCountsForOneTimerCount = 1;
+
+/* Timer counts lost while the timer was stopped that have not yet been removed
+from a period, and reference counts lost that do not yet add up to a whole
+timer count. */
+static uint32_t ulUncompensatedTimerCounts = 0;
+static uint32_t ulUncompensatedReferenceCounts = 0;
+
+static TicklessIdleStats_t xStats;
+
+/*-----------------------------------------------------------*/
+
+void vTicklessIdleInitialise( uint32_t ulTimerCountsPerTick, uint32_t ulMaximumReloadValue, uint32_t ulReferenceCountsPerTimerCount )
+{
+	configASSERT( ulTimerCountsPerTick >= ticklessMINIMUM_PERIOD_DIVISOR );
+	configASSERT( ulMaximumReloadValue >= ulTimerCountsPerTick );
+	configASSERT( ulReferenceCountsPerTimerCount > 0 );
+
+	ulTimerCountsForOneTick = ulTimerCountsPerTick;
+	xMaximumPossibleSuppressedTicks = ( TickType_t ) ( ulMaximumReloadValue / ulTimerCountsPerTick );
+	ulMinimumPeriod = ulTimerCountsPerTick / ticklessMINIMUM_PERIOD_DIVISOR;
+	ulReferenceCountsForOneTimerCount = ulReferenceCountsPerTimerCount;
+}
+/*-----------------------------------------------------------*/
+
+void vTicklessIdleSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+{
+uint32_t ulStoppedAt, ulCount, ulFirstPeriod, ulSleepPeriod, ulElapsed, ulRemaining;
+uint32_t ulCompleteTickPeriods, ulOverrun;
+BaseType_t xCountedToZero;
+TickType_t xModifiableIdleTime;
+
+	/* Make sure the reload value does not overflow the counter. */
+	if( xExpectedIdleTime > xMaximumPossibleSuppressedTicks )
+	{
+		xExpectedIdleTime = xMaximumPossibleSuppressedTicks;
+	}
+
+	/* Interrupts are disabled before the timer is stopped so the tick
+	interrupt cannot execute while the timer is being reprogrammed.  Don't use
+	taskENTER_CRITICAL() as that will mask interrupts that should exit sleep
+	mode. */
+	vPortTicklessDisableInterrupts();
+
+	/* ulCount is the number of counts left in the current tick period.  The
+	counted to zero flag is stale at this point, so is ignored. */
+	ulCount = ulPortTicklessStopTimer( &xCountedToZero );
+	ulStoppedAt = ulPortTicklessGetReferenceCount();
+
+	/* If a context switch is pending or a task is waiting for the scheduler
+	to be unsuspended then abandon the low power entry. */
+	if( eTaskConfirmSleepModeStatus() == eAbortSleep )
+	{
+		/* Restart from whatever is left in the counter to complete this tick
+		period.  The reload register still holds the value required for normal
+		tick periods. */
+		prvAccountForStoppedTime( ulStoppedAt );
+		vPortTicklessStartTimer();
+		xStats.ulAbortedSleeps++;
+
+		vPortTicklessEnableInterrupts();
+	}
+	else
+	{
+		/* The timer must count what is left of the current tick period, then
+		a further xExpectedIdleTime - 1 tick periods.  Any counts lost while the
+		timer was stopped previously are removed from the first period.  The
+		counter is loaded on the count after it is cleared, so the reload value
+		is one less than the number of counts required.  A count of zero means
+		the current tick period has just ended, and its tick interrupt is
+		pending, so the first period is a whole tick period.  A first period
+		that ends very soon is not a problem as no interrupt is generated when
+		it ends. */
+		if( ulCount == 0UL )
+		{
+			ulCount = ulTimerCountsForOneTick;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		ulFirstPeriod = prvCompensatePeriod( ulCount );
+		ulSleepPeriod = ulFirstPeriod + ( ulTimerCountsForOneTick * ( ( uint32_t ) xExpectedIdleTime - 1UL ) );
+		vPortTicklessSetReload( ulSleepPeriod - 1UL );
+		vPortTicklessClearCount();
+		prvAccountForStoppedTime( ulStoppedAt );
+		vPortTicklessStartTimer();
+
+		/* Sleep until something happens.  configPRE_SLEEP_PROCESSING() can
+		set its parameter to 0 to indicate that its implementation contains
+		its own wait for interrupt or wait for event instruction, and so the
+		wait should not be performed again.  However, the original expected
+		idle time variable must remain unmodified, so a copy is taken. */
+		xModifiableIdleTime = xExpectedIdleTime;
+		configPRE_SLEEP_PROCESSING( xModifiableIdleTime );
+		if( xModifiableIdleTime > 0 )
+		{
+			vPortTicklessWaitForInterrupt();
+		}
+		configPOST_SLEEP_PROCESSING( xExpectedIdleTime );
+
+		ulCount = ulPortTicklessStopTimer( &xCountedToZero );
+		ulStoppedAt = ulPortTicklessGetReferenceCount();
+
+		/* Work out how many counts passed since the timer was started.  A
+		count of zero without the flag set means the counter has not yet been
+		loaded from the reload register.  If the flag is set then the counter
+		reached zero at the end of the sleep period, then reloaded.  It cannot
+		have reached zero twice as the processor is awake. */
+		if( ulCount == 0UL )
+		{
+			ulElapsed = 0UL;
+		}
+		else
+		{
+			ulElapsed = ulSleepPeriod - ulCount;
+		}
+
+		if( xCountedToZero != pdFALSE )
+		{
+			ulElapsed += ulSleepPeriod;
+		}
+
+		/* The tick periods end ulFirstPeriod counts after the timer was
+		started, then every ulTimerCountsForOneTick counts after that. */
+		if( ulElapsed < ulFirstPeriod )
+		{
+			ulCompleteTickPeriods = 0UL;
+			ulRemaining = ulFirstPeriod - ulElapsed;
+		}
+		else
+		{
+			ulElapsed -= ulFirstPeriod;
+			ulCompleteTickPeriods = ( ulElapsed / ulTimerCountsForOneTick ) + 1UL;
+			ulRemaining = ulTimerCountsForOneTick - ( ulElapsed % ulTimerCountsForOneTick );
+		}
+
+		if( ulCompleteTickPeriods > ( uint32_t ) xExpectedIdleTime )
+		{
+			/* The post sleep processing took so long that more time has passed
+			than the kernel can be stepped forward by.  The tick periods that
+			cannot be accounted for now are compensated for by shortening later
+			periods instead. */
+			ulOverrun = ( ulCompleteTickPeriods - ( uint32_t ) xExpectedIdleTime ) * ulTimerCountsForOneTick;
+			ulUncompensatedTimerCounts += ulOverrun;
+			xStats.ulTimerCountsLost += ulOverrun;
+			ulCompleteTickPeriods = ( uint32_t ) xExpectedIdleTime;
+		}
+		else if( ( ulRemaining < ulMinimumPeriod ) && ( ulCompleteTickPeriods < ( uint32_t ) xExpectedIdleTime ) )
+		{
+			/* The current tick period is about to end.  Rather than restart
+			the timer with a period that might end before the timer has been
+			reprogrammed, count the tick period as complete now and make the
+			next period longer by the same amount. */
+			ulCompleteTickPeriods++;
+			ulRemaining += ulTimerCountsForOneTick;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Restart the timer so it runs for what remains of the current tick
+		period, less any counts lost while it was stopped, then set the reload
+		register back to its standard value, which takes effect when the
+		current period ends. */
+		vPortTicklessSetReload( prvCompensatePeriod( ulRemaining ) - 1UL );
+		vPortTicklessClearCount();
+		prvAccountForStoppedTime( ulStoppedAt );
+		vPortTicklessStartTimer();
+		vPortTicklessSetReload( ulTimerCountsForOneTick - 1UL );
+
+		/* If the timer reached zero then the tick interrupt is pending, and
+		will account for the last of the complete tick periods when interrupts
+		are enabled again. */
+		if( xCountedToZero != pdFALSE )
+		{
+			ulCompleteTickPeriods--;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		vTaskStepTick( ( TickType_t ) ulCompleteTickPeriods );
+		xStats.ulSleeps++;
+		xStats.ulTicksSuppressed += ulCompleteTickPeriods;
+
+		vPortTicklessEnableInterrupts();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTicklessIdleGetStats( TicklessIdleStats_t *pxStats )
+{
+	/* The statistics are only updated with interrupts disabled. */
+	taskENTER_CRITICAL();
+	{
+		*pxStats = xStats;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static void prvAccountForStoppedTime( uint32_t ulStoppedAt )
+{
+uint32_t ulLostCounts;
+
+	/* The reference counter may have wrapped, which the unsigned subtraction
+	allows for. */
+	ulUncompensatedReferenceCounts += ulPortTicklessGetReferenceCount() - ulStoppedAt;
+	ulLostCounts = ulUncompensatedReferenceCounts / ulReferenceCountsForOneTimerCount;
+	ulUncompensatedReferenceCounts -= ulLostCounts * ulReferenceCountsForOneTimerCount;
+
+	ulUncompensatedTimerCounts += ulLostCounts;
+	xStats.ulTimerCountsLost += ulLostCounts;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvCompensatePeriod( uint32_t ulPeriod )
+{
+uint32_t ulRemovable;
+
+	if( ulPeriod > ulMinimumPeriod )
+	{
+		ulRemovable = ulPeriod - ulMinimumPeriod;
+
+		if( ulRemovable > ulUncompensatedTimerCounts )
+		{
+			ulRemovable = ulUncompensatedTimerCounts;
+		}
+
+		ulPeriod -= ulRemovable;
+		ulUncompensatedTimerCounts -= ulRemovable;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ulPeriod;
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TICKLESS_IDLE */
+
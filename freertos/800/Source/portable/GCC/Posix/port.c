@@ -0,0 +1,905 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the POSIX simulator
+ * port.
+ *
+ * Every task is given its own host thread, but a thread is only allowed to
+ * execute while the task it implements is the task selected to run.  All the
+ * other task threads are held waiting on a per thread semaphore.  A context
+ * switch therefore posts the semaphore of the thread being switched in before
+ * waiting on the semaphore of the thread being switched out.
+ *
+ * The tick interrupt is simulated by an interval timer that raises SIGALRM.
+ * Only the thread of the running task ever has the signal unblocked, so the
+ * signal handler always executes in the context of the running task, exactly
+ * as an interrupt would on real hardware.  Masking interrupts is simulated by
+ * blocking the signal in the running thread.
+ *
+ * If configUSE_TICKLESS_IDLE is 1 the interval timer instead simulates a
+ * Cortex-M SysTick, and the tick is suppressed by the same code as is used on
+ * Cortex-M hardware (portable/Common/tickless_idle.c).
+ *
+ * Host library functions that take internal locks (printf(), malloc(), etc.)
+ * must only be called from inside a critical section, or with the scheduler
+ * suspended, otherwise a context switch can occur while the lock is held.
+ *----------------------------------------------------------*/
+
+/* Standard includes. */
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <errno.h>
+#include <sys/time.h>
+#include <time.h>
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "tickless_idle.h"
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+	#error The POSIX port requires xTaskGetCurrentTaskHandle().  Set INCLUDE_xTaskGetCurrentTaskHandle to 1 in FreeRTOSConfig.h.
+#endif
+
+/* The signal used to simulate the tick interrupt. */
+#define portTICK_SIGNAL						SIGALRM
+
+/* The number of microseconds between each tick interrupt. */
+#define portTICK_PERIOD_US					( 1000000UL / configTICK_RATE_HZ )
+
+/* The simulated SysTick counts at portSIMULATED_TIMER_HZ, and has the same
+24-bit reload register as the real SysTick, so tickless idle is limited in the
+same way as on hardware. */
+#define portSIMULATED_TIMER_COUNTS_PER_TICK	( portSIMULATED_TIMER_HZ / configTICK_RATE_HZ )
+#define portSIMULATED_TIMER_MAX_RELOAD		( 0xffffffUL )
+#define portNS_PER_SIMULATED_TIMER_COUNT	( 1000000000UL / portSIMULATED_TIMER_HZ )
+
+/* If the host delays the tick signal by more than a tick period, the ticks it
+missed are processed this often until the tick count has caught up, so the
+tasks they unblock get to run between them. */
+#define portCATCH_UP_TICK_PERIOD_US			( portTICK_PERIOD_US / 4UL )
+
+/* The host thread used to run a task.  The structure is placed at the top of
+the stack allocated to the task by the kernel, so the TCB's pxTopOfStack member
+points to it. */
+typedef struct THREAD
+{
+	pthread_t xThread;						/*< The host thread that runs the task. */
+	sem_t xWakeSemaphore;					/*< Posted when the task is switched in. */
+	TaskFunction_t pxCode;					/*< The function that implements the task. */
+	void *pvParameters;						/*< The parameter passed into the task function. */
+	volatile BaseType_t xDying;				/*< Set when the task has been deleted and the thread must exit. */
+} Thread_t;
+
+/* The simulated SysTick.  Rather than being decremented, the value of the
+counter is calculated from the host's monotonic clock, relative to the time at
+which the counter last held a known value. */
+typedef struct SIMULATED_TIMER
+{
+	uint32_t ulReload;						/*< The reload register. */
+	uint32_t ulCount;						/*< The value of the counter at ullCountTime. */
+	uint64_t ullCountTime;					/*< The host time, in ns, at which the counter held ulCount. */
+	uint64_t ullStoppedPhase;				/*< How far through the current count the timer was when it was stopped, in ns. */
+	BaseType_t xRunning;					/*< The enable bit. */
+	BaseType_t xCountedToZero;				/*< The count flag. */
+	uint32_t ulInterruptsPending;			/*< The number of times the counter has reached zero since the tick handler last executed. */
+	uint64_t ullHiddenTime;					/*< Whole periods, in ns, that the count cannot show - see prvUpdateSimulatedTimer(). */
+	uint64_t ullReferenceOffset;			/*< Added to the host time to give the reference counter. */
+} SimulatedTimer_t;
+
+/* Obtain the thread used to run a task from the task's handle.  This relies on
+pxTopOfStack being the first member of the TCB. */
+#define prvGetThreadFromTask( xTask )		( *( Thread_t ** ) ( xTask ) )
+
+/* Each task maintains its own interrupt status in the critical nesting
+variable.  Context switches are only ever performed when the nesting count is
+zero, so the count does not need to be saved as part of the task context. */
+static volatile UBaseType_t uxCriticalNesting = 0xaaaaaaaaUL;
+
+/* Set when a context switch has been requested from inside a critical section
+or from inside the tick handler.  The switch is performed when the critical
+section is exited, or when the tick handler completes, in the same way a
+pended PendSV interrupt would be. */
+static volatile BaseType_t xSwitchPending = pdFALSE;
+
+/* Set while the tick handler is executing so portYIELD_FROM_ISR() knows it is
+being called from the simulated interrupt. */
+static volatile BaseType_t xInsideInterrupt = pdFALSE;
+
+/* Set by vPortEndScheduler() to stop the tick handler doing anything further. */
+static volatile BaseType_t xSchedulerEnded = pdFALSE;
+
+/* The thread that called xPortStartScheduler() waits on this semaphore until
+vPortEndScheduler() is called. */
+static sem_t xSchedulerEndSemaphore;
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+	/* Only accessed with the tick signal blocked. */
+	static SimulatedTimer_t xSimulatedTimer = { 0 };
+#endif /* configUSE_TICKLESS_IDLE */
+
+/*
+ * Setup the timer to generate the tick interrupts.
+ */
+void vPortSetupTimerInterrupt( void );
+
+/*
+ * The simulated tick interrupt.
+ */
+static void prvTickSignalHandler( int iSignal );
+
+/*
+ * The entry point of every task thread.  The thread waits to be switched in
+ * before calling the function that implements the task.
+ */
+static void *prvThreadEntry( void *pvThread );
+
+/*
+ * Block or unblock the tick signal in the calling thread, optionally returning
+ * the mask that was in effect before the call.
+ */
+static void prvSetTickSignalMask( int iHow, sigset_t *pxOldMask );
+
+/*
+ * Select the next task to run and, if it is not the calling task, switch to
+ * it.  Must be called with the tick signal blocked.
+ */
+static void prvSwitchContext( void );
+
+/*
+ * Wait until the calling thread's task is switched back in.
+ */
+static void prvSuspendThread( Thread_t *pxThread );
+
+/*
+ * Used to catch tasks that attempt to return from their implementing function.
+ */
+static void prvTaskExitError( void );
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+
+	/*
+	 * Read the host's monotonic clock in nanoseconds.
+	 */
+	static uint64_t prvGetHostTime( void );
+
+	/*
+	 * Bring the simulated SysTick's counter and count flag up to date with the
+	 * host time ullNow.
+	 */
+	static void prvUpdateSimulatedTimer( uint64_t ullNow );
+
+	/*
+	 * Start the interval timer so it raises the tick signal ullPendingDelayUs
+	 * microseconds from now if a tick interrupt is pending, or otherwise when
+	 * the simulated SysTick's counter next reaches zero, or stop the interval
+	 * timer if the simulated SysTick is not running.  The simulated SysTick must
+	 * be up to date with the host time ullNow.
+	 */
+	static void prvArmSimulatedTimer( uint64_t ullNow, uint64_t ullPendingDelayUs );
+
+#endif /* configUSE_TICKLESS_IDLE */
+
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+Thread_t *pxThread;
+sigset_t xAllSignals, xOldMask;
+int iResult;
+
+	/* Place the thread structure at the top of the stack.  pxTopOfStack is
+	already aligned to portBYTE_ALIGNMENT. */
+	pxThread = ( Thread_t * ) ( ( ( portPOINTER_SIZE_TYPE ) ( pxTopOfStack + 1 ) - sizeof( Thread_t ) ) & ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) );
+
+	pxThread->pxCode = pxCode;
+	pxThread->pvParameters = pvParameters;
+	pxThread->xDying = pdFALSE;
+	iResult = sem_init( &( pxThread->xWakeSemaphore ), 0, 0 );
+	configASSERT( iResult == 0 );
+
+	/* The new thread inherits the signal mask of the thread that creates it.
+	Block all signals so the new thread cannot receive the tick before it has
+	been switched in, and so the calling thread cannot be switched out while
+	the host is creating the thread. */
+	sigfillset( &xAllSignals );
+	pthread_sigmask( SIG_SETMASK, &xAllSignals, &xOldMask );
+	{
+		iResult = pthread_create( &( pxThread->xThread ), NULL, prvThreadEntry, ( void * ) pxThread );
+	}
+	pthread_sigmask( SIG_SETMASK, &xOldMask, NULL );
+	configASSERT( iResult == 0 );
+
+	return ( StackType_t * ) pxThread;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvThreadEntry( void *pvThread )
+{
+Thread_t * const pxThread = ( Thread_t * ) pvThread;
+
+	/* Wait until the task is switched in for the first time. */
+	prvSuspendThread( pxThread );
+
+	/* Tasks start with interrupts enabled. */
+	vPortEnableInterrupts();
+
+	pxThread->pxCode( pxThread->pvParameters );
+
+	/* Should not get here. */
+	prvTaskExitError();
+
+	return NULL;
+}
+/*-----------------------------------------------------------*/
+
+static void prvTaskExitError( void )
+{
+	/* A function that implements a task must not exit or attempt to return to
+	its caller as there is nothing to return to.  If a task wants to exit it
+	should instead call vTaskDelete( NULL ).
+
+	Artificially force an assert() to be triggered if configASSERT() is
+	defined, then stop here so application writers can catch the error. */
+	configASSERT( uxCriticalNesting == ~0UL );
+	portDISABLE_INTERRUPTS();
+	for( ;; )
+	{
+		prvSuspendThread( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+BaseType_t xPortStartScheduler( void )
+{
+struct sigaction xTickAction;
+int iResult;
+
+	/* The thread that starts the scheduler never runs a task, so must never
+	receive the tick signal. */
+	prvSetTickSignalMask( SIG_BLOCK, NULL );
+
+	iResult = sem_init( &xSchedulerEndSemaphore, 0, 0 );
+	configASSERT( iResult == 0 );
+
+	/* Install the tick handler.  Interrupted system calls are restarted so
+	host library calls made by tasks are not disturbed by the tick. */
+	xTickAction.sa_handler = prvTickSignalHandler;
+	xTickAction.sa_flags = SA_RESTART;
+	sigemptyset( &xTickAction.sa_mask );
+	iResult = sigaction( portTICK_SIGNAL, &xTickAction, NULL );
+	configASSERT( iResult == 0 );
+
+	/* Initialise the critical nesting count ready for the first task. */
+	uxCriticalNesting = 0;
+	xSchedulerEnded = pdFALSE;
+
+	/* Start the timer that generates the tick ISR. */
+	vPortSetupTimerInterrupt();
+
+	/* Start the first task. */
+	sem_post( &( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() )->xWakeSemaphore ) );
+
+	/* Wait for a task to call vTaskEndScheduler(). */
+	while( sem_wait( &xSchedulerEndSemaphore ) != 0 )
+	{
+		configASSERT( errno == EINTR );
+	}
+
+	return 0;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+struct itimerval xTimer = { { 0, 0 }, { 0, 0 } };
+
+	/* Stop the tick.  The tick signal is already blocked in the calling task
+	because vTaskEndScheduler() disables interrupts. */
+	setitimer( ITIMER_REAL, &xTimer, NULL );
+	xSchedulerEnded = pdTRUE;
+
+	/* Return control to the thread that started the scheduler, then park the
+	calling thread as there is nothing left for it to do.  The other task
+	threads remain parked until the process exits. */
+	sem_post( &xSchedulerEndSemaphore );
+
+	for( ;; )
+	{
+		prvSuspendThread( prvGetThreadFromTask( xTaskGetCurrentTaskHandle() ) );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYield( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	if( uxCriticalNesting != 0 )
+	{
+		/* Interrupts are masked, so as with a pended PendSV the switch does
+		not occur until the critical section is exited. */
+		xSwitchPending = pdTRUE;
+	}
+	else
+	{
+		uxSavedInterruptStatus = uxPortSetInterruptMask();
+		{
+			prvSwitchContext();
+		}
+		vPortClearInterruptMask( uxSavedInterruptStatus );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortYieldFromISR( void )
+{
+	if( xInsideInterrupt != pdFALSE )
+	{
+		/* The switch is performed when the tick handler completes. */
+		xSwitchPending = pdTRUE;
+	}
+	else
+	{
+		vPortYield();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnterCritical( void )
+{
+	portDISABLE_INTERRUPTS();
+	uxCriticalNesting++;
+}
+/*-----------------------------------------------------------*/
+
+void vPortExitCritical( void )
+{
+	configASSERT( uxCriticalNesting );
+	uxCriticalNesting--;
+	if( uxCriticalNesting == 0 )
+	{
+		/* Perform any switch that was requested while interrupts were
+		masked before interrupts are unmasked again. */
+		if( xSwitchPending != pdFALSE )
+		{
+			prvSwitchContext();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		portENABLE_INTERRUPTS();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDisableInterrupts( void )
+{
+	prvSetTickSignalMask( SIG_BLOCK, NULL );
+}
+/*-----------------------------------------------------------*/
+
+void vPortEnableInterrupts( void )
+{
+	prvSetTickSignalMask( SIG_UNBLOCK, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortSetInterruptMask( void )
+{
+sigset_t xOldMask;
+
+	/* Return pdTRUE if interrupts were already masked, so nested calls (for
+	example from inside the tick handler) do not unmask them again. */
+	prvSetTickSignalMask( SIG_BLOCK, &xOldMask );
+	return ( UBaseType_t ) ( sigismember( &xOldMask, portTICK_SIGNAL ) == 1 );
+}
+/*-----------------------------------------------------------*/
+
+void vPortClearInterruptMask( UBaseType_t uxNewMask )
+{
+	if( uxNewMask == ( UBaseType_t ) pdFALSE )
+	{
+		prvSetTickSignalMask( SIG_UNBLOCK, NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortCleanUpTCB( void *pxTCB )
+{
+Thread_t * const pxThread = prvGetThreadFromTask( pxTCB );
+UBaseType_t uxSavedInterruptStatus;
+
+	/* The thread of a deleted task is parked waiting to be switched back in.
+	Wake it with the dying flag set so it exits, then wait for it to do so
+	before the memory holding the thread structure is freed.  The calling task
+	cannot be switched out while it waits, as it is waiting on host code. */
+	uxSavedInterruptStatus = uxPortSetInterruptMask();
+	{
+		pxThread->xDying = pdTRUE;
+		sem_post( &( pxThread->xWakeSemaphore ) );
+		pthread_join( pxThread->xThread, NULL );
+		sem_destroy( &( pxThread->xWakeSemaphore ) );
+	}
+	vPortClearInterruptMask( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static void prvTickSignalHandler( int iSignal )
+{
+const int iSavedErrno = errno;
+BaseType_t xTickPending = pdTRUE;
+
+	( void ) iSignal;
+
+	if( xSchedulerEnded == pdFALSE )
+	{
+		/* The tick signal is blocked by the host while its handler executes,
+		which is equivalent to masking interrupts from the ISR. */
+		xInsideInterrupt = pdTRUE;
+		{
+			traceISR_ENTER( traceTICK_ISR_NUMBER );
+
+			#if( configUSE_TICKLESS_IDLE == 1 )
+			{
+			const uint64_t ullNow = prvGetHostTime();
+
+				/* The signal can be raised when no interrupt is pending, for
+				example when the interval timer expires while the simulated
+				SysTick is stopped, in which case there is nothing to do.
+				Unlike a real interrupt, the signal can be delayed by more than
+				a tick period, so every period that has ended is counted, but
+				only one tick is processed each time the signal is delivered.
+				Any others remain pending, and the interval timer is restarted
+				to deliver them portCATCH_UP_TICK_PERIOD_US apart, so the tasks
+				unblocked by one tick can be switched in and run before the
+				next, as they would have done had the signal not been
+				delayed. */
+				prvUpdateSimulatedTimer( ullNow );
+
+				if( xSimulatedTimer.ulInterruptsPending != 0UL )
+				{
+					xSimulatedTimer.ulInterruptsPending--;
+				}
+				else
+				{
+					xTickPending = pdFALSE;
+				}
+
+				prvArmSimulatedTimer( ullNow, portCATCH_UP_TICK_PERIOD_US );
+			}
+			#endif /* configUSE_TICKLESS_IDLE */
+
+			/* Increment the RTOS tick. */
+			if( xTickPending != pdFALSE )
+			{
+				if( xTaskIncrementTick() != pdFALSE )
+				{
+					xSwitchPending = pdTRUE;
+				}
+			}
+
+			traceISR_EXIT();
+		}
+		xInsideInterrupt = pdFALSE;
+
+		/* The signal is only ever delivered to the thread of the running task,
+		and only while that task is not inside a critical section, so any
+		pending switch can be performed now. */
+		if( xSwitchPending != pdFALSE )
+		{
+			prvSwitchContext();
+		}
+	}
+
+	errno = iSavedErrno;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSwitchContext( void )
+{
+Thread_t *pxThreadToSuspend, *pxThreadToResume;
+
+	xSwitchPending = pdFALSE;
+
+	pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+	vTaskSwitchContext();
+	pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+	if( pxThreadToResume != pxThreadToSuspend )
+	{
+		/* The signal remains blocked in the suspended thread, so only the
+		resumed thread can receive the next tick. */
+		sem_post( &( pxThreadToResume->xWakeSemaphore ) );
+		prvSuspendThread( pxThreadToSuspend );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSuspendThread( Thread_t *pxThread )
+{
+	while( sem_wait( &( pxThread->xWakeSemaphore ) ) != 0 )
+	{
+		/* Only an interrupted wait can fail. */
+		configASSERT( errno == EINTR );
+	}
+
+	if( pxThread->xDying != pdFALSE )
+	{
+		/* The task was deleted while the thread was parked. */
+		pthread_exit( NULL );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetTickSignalMask( int iHow, sigset_t *pxOldMask )
+{
+sigset_t xTickSignal;
+
+	sigemptyset( &xTickSignal );
+	sigaddset( &xTickSignal, portTICK_SIGNAL );
+	pthread_sigmask( iHow, &xTickSignal, pxOldMask );
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Setup the interval timer to generate the tick interrupts at the required
+ * frequency.
+ */
+void vPortSetupTimerInterrupt( void )
+{
+	#if( configUSE_TICKLESS_IDLE == 1 )
+	{
+		vTicklessIdleInitialise( portSIMULATED_TIMER_COUNTS_PER_TICK, portSIMULATED_TIMER_MAX_RELOAD, portNS_PER_SIMULATED_TIMER_COUNT );
+
+		vPortTicklessSetReload( portSIMULATED_TIMER_COUNTS_PER_TICK - 1UL );
+		vPortTicklessClearCount();
+		vPortTicklessStartTimer();
+	}
+	#else
+	{
+	struct itimerval xTimer;
+
+		xTimer.it_interval.tv_sec = 0;
+		xTimer.it_interval.tv_usec = portTICK_PERIOD_US;
+		xTimer.it_value = xTimer.it_interval;
+		setitimer( ITIMER_REAL, &xTimer, NULL );
+	}
+	#endif /* configUSE_TICKLESS_IDLE */
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TICKLESS_IDLE == 1 )
+
+	void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime )
+	{
+		/* The algorithm is shared with the Cortex-M ports.  The functions that
+		follow give it access to the simulated SysTick. */
+		vTicklessIdleSuppressTicksAndSleep( xExpectedIdleTime );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortTicklessDisableInterrupts( void )
+	{
+		prvSetTickSignalMask( SIG_BLOCK, NULL );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortTicklessEnableInterrupts( void )
+	{
+		prvSetTickSignalMask( SIG_UNBLOCK, NULL );
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t ulPortTicklessGetReferenceCount( void )
+	{
+		/* The reference counter counts nanoseconds, and is allowed to wrap. */
+		return ( uint32_t ) ( prvGetHostTime() + xSimulatedTimer.ullReferenceOffset );
+	}
+	/*-----------------------------------------------------------*/
+
+	uint32_t ulPortTicklessStopTimer( BaseType_t *pxCountedToZero )
+	{
+	const uint64_t ullNow = prvGetHostTime();
+
+		prvUpdateSimulatedTimer( ullNow );
+
+		if( xSimulatedTimer.xRunning != pdFALSE )
+		{
+			/* Remember how far through the current count the timer is so the
+			partial count is not lost when the timer is restarted. */
+			xSimulatedTimer.ullStoppedPhase = ullNow - xSimulatedTimer.ullCountTime;
+			xSimulatedTimer.xRunning = pdFALSE;
+
+			/* Nothing is done to the interval timer here, as that would add to
+			the time the simulated SysTick is stopped for without being
+			measured.  If it expires the tick handler finds no interrupt
+			pending.  A pending interrupt is raised when the timer is started
+			again. */
+		}
+
+		*pxCountedToZero = xSimulatedTimer.xCountedToZero;
+		xSimulatedTimer.xCountedToZero = pdFALSE;
+
+		return xSimulatedTimer.ulCount;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortTicklessStartTimer( void )
+	{
+	const uint64_t ullNow = prvGetHostTime();
+
+		if( xSimulatedTimer.xRunning == pdFALSE )
+		{
+			/* A real SysTick loads a cleared counter from the reload register
+			within a few processor cycles of being started, before the reload
+			register can be written again. */
+			if( xSimulatedTimer.ulCount == 0UL )
+			{
+				xSimulatedTimer.ulCount = xSimulatedTimer.ulReload + 1UL;
+			}
+
+			xSimulatedTimer.ullCountTime = ullNow - xSimulatedTimer.ullStoppedPhase;
+			xSimulatedTimer.xRunning = pdTRUE;
+			prvArmSimulatedTimer( ullNow, 1ULL );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortTicklessSetReload( uint32_t ulReloadValue )
+	{
+	const uint64_t ullNow = prvGetHostTime();
+
+		/* The counter is brought up to date before the reload register is
+		changed, as the new value is only used once the counter next reaches
+		zero. */
+		prvUpdateSimulatedTimer( ullNow );
+		xSimulatedTimer.ulReload = ulReloadValue;
+		prvArmSimulatedTimer( ullNow, 1ULL );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortTicklessClearCount( void )
+	{
+	const uint64_t ullNow = prvGetHostTime();
+
+		prvUpdateSimulatedTimer( ullNow );
+		xSimulatedTimer.ulCount = 0UL;
+		xSimulatedTimer.ullCountTime = ullNow;
+		xSimulatedTimer.ullStoppedPhase = 0ULL;
+		xSimulatedTimer.xCountedToZero = pdFALSE;
+		prvArmSimulatedTimer( ullNow, 1ULL );
+
+		/* The counter is only cleared while it is stopped, so the kernel sees
+		the hidden time as part of the time the counter was stopped for. */
+		xSimulatedTimer.ullReferenceOffset += xSimulatedTimer.ullHiddenTime;
+		xSimulatedTimer.ullHiddenTime = 0ULL;
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortTicklessWaitForInterrupt( void )
+	{
+	sigset_t xTickSignal;
+	int iSignal;
+
+		/* The tick signal is blocked, so wait for it to be raised, then raise
+		it again so it remains pending and the tick handler executes when the
+		signal is unblocked - as an interrupt that ends a wait for interrupt
+		executes when PRIMASK is cleared. */
+		sigemptyset( &xTickSignal );
+		sigaddset( &xTickSignal, portTICK_SIGNAL );
+		sigwait( &xTickSignal, &iSignal );
+		pthread_kill( pthread_self(), portTICK_SIGNAL );
+	}
+	/*-----------------------------------------------------------*/
+
+	static uint64_t prvGetHostTime( void )
+	{
+	struct timespec xTime;
+
+		clock_gettime( CLOCK_MONOTONIC, &xTime );
+		return ( ( uint64_t ) xTime.tv_sec * 1000000000ULL ) + ( uint64_t ) xTime.tv_nsec;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvUpdateSimulatedTimer( uint64_t ullNow )
+	{
+	uint64_t ullCounts, ullFirstPeriod, ullPeriod, ullIntoPeriod, ullExtraPeriods;
+
+		if( xSimulatedTimer.xRunning != pdFALSE )
+		{
+			ullCounts = ( ullNow - xSimulatedTimer.ullCountTime ) / portNS_PER_SIMULATED_TIMER_COUNT;
+
+			if( ullCounts > 0ULL )
+			{
+				/* The counter is loaded from the reload register on the count
+				after it reaches zero, so each period is one count longer than
+				the reload value. */
+				ullPeriod = ( uint64_t ) xSimulatedTimer.ulReload + 1ULL;
+
+				if( xSimulatedTimer.ulCount == 0UL )
+				{
+					ullFirstPeriod = ullPeriod;
+				}
+				else
+				{
+					ullFirstPeriod = xSimulatedTimer.ulCount;
+				}
+
+				if( ullCounts < ullFirstPeriod )
+				{
+					xSimulatedTimer.ulCount = ( uint32_t ) ( ullFirstPeriod - ullCounts );
+				}
+				else
+				{
+					xSimulatedTimer.xCountedToZero = pdTRUE;
+					ullExtraPeriods = ( ullCounts - ullFirstPeriod ) / ullPeriod;
+					ullIntoPeriod = ( ullCounts - ullFirstPeriod ) % ullPeriod;
+
+					if( ( ullExtraPeriods == 0ULL ) || ( ullPeriod == ( uint64_t ) portSIMULATED_TIMER_COUNTS_PER_TICK ) )
+					{
+						/* Each period is a tick period, so each time the counter
+						reached zero is a tick. */
+						xSimulatedTimer.ulInterruptsPending += ( uint32_t ) ullExtraPeriods + 1UL;
+					}
+					else
+					{
+						/* The counter reached zero more than once during a
+						suppressed tick period, which can only happen if the host
+						did not run the thread for longer than the whole period.
+						A real processor is awake long before the counter reaches
+						zero again, so the kernel does not allow for it.  The
+						time is instead passed to the kernel as time the timer
+						was stopped for, by advancing the reference counter the
+						next time the counter is cleared. */
+						xSimulatedTimer.ulInterruptsPending++;
+						xSimulatedTimer.ullHiddenTime += ullExtraPeriods * ullPeriod * portNS_PER_SIMULATED_TIMER_COUNT;
+					}
+
+					if( ullIntoPeriod == 0ULL )
+					{
+						xSimulatedTimer.ulCount = 0UL;
+					}
+					else
+					{
+						xSimulatedTimer.ulCount = ( uint32_t ) ( ullPeriod - ullIntoPeriod );
+					}
+				}
+
+				xSimulatedTimer.ullCountTime += ullCounts * portNS_PER_SIMULATED_TIMER_COUNT;
+			}
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvArmSimulatedTimer( uint64_t ullNow, uint64_t ullPendingDelayUs )
+	{
+	struct itimerval xTimer = { { 0, 0 }, { 0, 0 } };
+	uint64_t ullCountsToZero, ullZeroTime, ullDelayUs;
+
+		if( xSimulatedTimer.ulInterruptsPending != 0UL )
+		{
+			/* The counter has reached zero since the tick handler last
+			executed.  A real SysTick latches its interrupt, so make sure the
+			signal is raised, even if the simulated SysTick has just been
+			stopped.  The signal is directed at the process rather than at the
+			calling thread, so it is delivered to whichever task is running
+			when the tick signal is next unblocked. */
+			ullDelayUs = ullPendingDelayUs;
+		}
+		else if( xSimulatedTimer.xRunning != pdFALSE )
+		{
+			if( xSimulatedTimer.ulCount == 0UL )
+			{
+				ullCountsToZero = ( uint64_t ) xSimulatedTimer.ulReload + 1ULL;
+			}
+			else
+			{
+				ullCountsToZero = xSimulatedTimer.ulCount;
+			}
+
+			ullZeroTime = xSimulatedTimer.ullCountTime + ( ullCountsToZero * portNS_PER_SIMULATED_TIMER_COUNT );
+
+			/* Round up so the signal is never raised before the counter has
+			reached zero.  An it_value of zero would stop the interval timer, so
+			the delay is at least a microsecond. */
+			if( ullZeroTime > ullNow )
+			{
+				ullDelayUs = ( ( ullZeroTime - ullNow ) + 999ULL ) / 1000ULL;
+			}
+			else
+			{
+				ullDelayUs = 1ULL;
+			}
+		}
+		else
+		{
+			/* it_value is zero, which stops the interval timer. */
+			ullDelayUs = 0ULL;
+		}
+
+		xTimer.it_value.tv_sec = ( time_t ) ( ullDelayUs / 1000000ULL );
+		xTimer.it_value.tv_usec = ( suseconds_t ) ( ullDelayUs % 1000000ULL );
+
+		setitimer( ITIMER_REAL, &xTimer, NULL );
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_TICKLESS_IDLE */
+
@@ -138,6 +138,11 @@ extern void vPortYield( void );
 #endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 /*-----------------------------------------------------------*/
 
+/* Used by the generic priority bitmap (configUSE_PRIORITY_BITMAP) in place of
+the portable count leading zeros in tasks.c.  ulBitmap is never zero. */
+#define portCOUNT_LEADING_ZEROS( ulBitmap )	( ( UBaseType_t ) __CLZ( ( ulBitmap ) ) )
+/*-----------------------------------------------------------*/
+
 /* Critical section management. */
 extern void vPortEnterCritical( void );
 extern void vPortExitCritical( void );
@@ -152,6 +157,43 @@ extern void vPortClearInterruptMask( uint32_t ulNewMask );
 #define portCLEAR_INTERRUPT_MASK_FROM_ISR(x)	vPortClearInterruptMask( x )
 /*-----------------------------------------------------------*/
 
+/* Lock free primitives, used by ring_queue.c.  The exclusive monitor is cleared
+on every exception entry and return, so if an interrupt runs between the load
+exclusive and the store exclusive the store fails and the compare and swap is
+retried. */
+#include <intrinsics.h>
+
+#pragma inline=forced
+static inline BaseType_t xPortCompareAndSwap( volatile UBaseType_t *puxDestination, UBaseType_t uxComparand, UBaseType_t uxExchange )
+{
+BaseType_t xReturn = pdFALSE;
+
+	__DMB();
+
+	for( ;; )
+	{
+		if( __LDREX( ( unsigned long * ) puxDestination ) != uxComparand )
+		{
+			__CLREX();
+			break;
+		}
+
+		if( __STREX( uxExchange, ( unsigned long * ) puxDestination ) == 0UL )
+		{
+			xReturn = pdTRUE;
+			break;
+		}
+	}
+
+	__DMB();
+
+	return xReturn;
+}
+
+#define portCOMPARE_AND_SWAP( puxDestination, uxComparand, uxExchange )	xPortCompareAndSwap( ( puxDestination ), ( uxComparand ), ( uxExchange ) )
+#define portMEMORY_BARRIER()		__DMB()
+/*-----------------------------------------------------------*/
+
 /* Tickless idle/low power functionality. */
 #ifndef portSUPPRESS_TICKS_AND_SLEEP
 	extern void vPortSuppressTicksAndSleep( TickType_t xExpectedIdleTime );
@@ -84,6 +84,10 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
 /* A few bytes might be lost to byte aligning the heap start address. */
 #define configADJUSTED_HEAP_SIZE	( configTOTAL_HEAP_SIZE - portBYTE_ALIGNMENT )
 
@@ -113,6 +117,7 @@ static BlockLink_t xStart, xEnd;
 /* Keeps track of the number of free bytes remaining, but says nothing about
 fragmentation. */
 static size_t xFreeBytesRemaining = configADJUSTED_HEAP_SIZE;
+static size_t xMinimumEverFreeBytesRemaining = configADJUSTED_HEAP_SIZE;
 
 /* STATIC FUNCTIONS ARE DEFINED AS MACROS TO MINIMIZE THE FUNCTION CALL DEPTH. */
 
@@ -213,10 +218,16 @@ void *pvReturn = NULL;
 				}
 
 				xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
 			}
 		}
 
 		traceMALLOC( pvReturn, xWantedSize );
+		heapMONITOR_MALLOC( pvReturn, xWantedSize );
 	}
 	xTaskResumeAll();
 
@@ -255,6 +266,7 @@ BlockLink_t *pxLink;
 			prvInsertBlockIntoFreeList( ( ( BlockLink_t * ) pxLink ) );
 			xFreeBytesRemaining += pxLink->xBlockSize;
 			traceFREE( pv, pxLink->xBlockSize );
+			heapMONITOR_FREE( pv );
 		}
 		xTaskResumeAll();
 	}
@@ -267,6 +279,37 @@ size_t xPortGetFreeHeapSize( void )
 }
 /*-----------------------------------------------------------*/
 
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetLargestFreeBlockSize( void )
+{
+BlockLink_t *pxBlock;
+size_t xReturn = 0;
+
+	/* The free list is ordered by size, so the largest block is the last one
+	before the end marker.  The list is empty until the first allocation. */
+	vTaskSuspendAll();
+	{
+		for( pxBlock = &xStart; ( pxBlock->pxNextFreeBlock != &xEnd ) && ( pxBlock->pxNextFreeBlock != NULL ); pxBlock = pxBlock->pxNextFreeBlock )
+		{
+			/* There is nothing to do here - just iterate to the end. */
+		}
+
+		if( pxBlock != &xStart )
+		{
+			xReturn = pxBlock->xBlockSize;
+		}
+	}
+	xTaskResumeAll();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
 void vPortInitialiseBlocks( void )
 {
 	/* This just exists to keep the linker quiet. */
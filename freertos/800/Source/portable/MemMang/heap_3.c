@@ -87,6 +87,16 @@ task.h is included from an application file. */
 
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#if( configUSE_HEAP_MONITOR == 1 )
+	/* The heap monitor reports the free space, which the C library heap does
+	not provide. */
+	#error The heap monitor cannot be used with heap_3.c
+#endif
+
 /*-----------------------------------------------------------*/
 
 void *pvPortMalloc( size_t xWantedSize )
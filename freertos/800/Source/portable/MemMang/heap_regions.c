@@ -0,0 +1,809 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() for a heap that
+ * is made up of several regions of memory with different properties - for
+ * example the core coupled memory, the internal SRAM and an external SDRAM of
+ * an STM32F4.  Each region is managed as heap_4.c manages its single array:
+ * free blocks are held in a list in address order and adjacent free blocks
+ * are combined as they are freed.  A block is never combined with a block in
+ * another region.
+ *
+ * The memory in ucHeap[ configTOTAL_HEAP_SIZE ] is used as the first region,
+ * with the attributes set by configHEAP_ARRAY_ATTRIBUTES (none if not defined
+ * in FreeRTOSConfig.h).  Other regions are added by calling
+ * vPortDefineHeapRegions(), up to a total of configHEAP_MAXIMUM_REGIONS (4 if
+ * not defined).  The uxAttributes member of each HeapRegion_t structure says
+ * what the region's memory is good for - portHEAP_ATTRIBUTE_FAST,
+ * portHEAP_ATTRIBUTE_DMA, portHEAP_ATTRIBUTE_BULK, and any attributes the
+ * application defines above those.
+ *
+ * pvPortMallocWithHints() takes the attributes the memory should have.  The
+ * regions are tried in the order in which they were added, and the first
+ * region that has all the attributes and a large enough free block is used.
+ * portHEAP_ATTRIBUTE_FAST and portHEAP_ATTRIBUTE_BULK are only preferences -
+ * if no region with them can satisfy the request then the request is tried
+ * again without them.  All other attributes are requirements - memory that
+ * cannot be reached by the DMA controller is of no use for a DMA buffer.
+ * pvPortMalloc() is the same as pvPortMallocWithHints() with no hints, so
+ * uses the first region that has space, and regions best kept for requests
+ * that ask for them should be added last.
+ *
+ * Set configUSE_HEAP_PLACEMENT_HINTS to 1 in FreeRTOSConfig.h to have the
+ * kernel allocate task stacks with pvPortMallocWithHints(), using the hints
+ * passed to xTaskCreateWithStackHints(), or configTASK_STACK_HEAP_HINTS for
+ * tasks created by any other means.
+ *
+ * uxPortGetHeapRegionCount() and vPortGetHeapRegionStats() report how each
+ * region is being used.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c, heap_tlsf.c and heap_slab.c for
+ * alternative implementations, and the memory management pages of
+ * http://www.FreeRTOS.org for more information.
+ */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configHEAP_MAXIMUM_REGIONS
+	#define configHEAP_MAXIMUM_REGIONS 4
+#endif
+
+#ifndef configHEAP_ARRAY_ATTRIBUTES
+	#define configHEAP_ARRAY_ATTRIBUTES 0
+#endif
+
+/* The attributes that can be dropped from a request that cannot otherwise be
+satisfied. */
+#define heapPREFERRED_ATTRIBUTES	( portHEAP_ATTRIBUTE_FAST | portHEAP_ATTRIBUTE_BULK )
+
+/* Block sizes must not get too small. */
+#define heapMINIMUM_BLOCK_SIZE	( ( size_t ) ( heapSTRUCT_SIZE * 2 ) )
+
+/* A region must be large enough to hold one block and the end marker. */
+#define heapMINIMUM_REGION_SIZE	( heapMINIMUM_BLOCK_SIZE + heapSTRUCT_SIZE )
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE		( ( size_t ) 8 )
+
+/* Allocate the memory for the first region. */
+static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+
+/* Define the linked list structure.  This is used to link free blocks in order
+of their memory address. */
+typedef struct A_BLOCK_LINK
+{
+	struct A_BLOCK_LINK *pxNextFreeBlock;	/*<< The next free block in the list. */
+	size_t xBlockSize;						/*<< The size of the free block. */
+} BlockLink_t;
+
+/* The state of one region. */
+typedef struct HEAP_REGION_CONTROL
+{
+	BlockLink_t xStart;						/*<< Holds a pointer to the first block in the region's list of free blocks. */
+	BlockLink_t *pxEnd;						/*<< Marks the end of the list, and is placed at the end of the region. */
+	uint8_t *pucStartAddress;				/*<< The first byte of the region that is used, once aligned. */
+	UBaseType_t uxAttributes;				/*<< What the region's memory is good for. */
+	size_t xSizeInBytes;					/*<< The number of bytes of the region that are used. */
+	size_t xFreeBytesRemaining;				/*<< The number of free bytes in the region. */
+	size_t xMinimumEverFreeBytesRemaining;	/*<< The smallest value xFreeBytesRemaining has had. */
+	UBaseType_t uxAllocatedBlocks;			/*<< The number of blocks allocated from the region. */
+} HeapRegionControl_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Inserts a block of memory that is being freed into the correct position in
+ * the list of free memory blocks of the region pxRegion.  The block being
+ * freed will be merged with the block in front it and/or the block behind it
+ * if the memory blocks are adjacent to each other.
+ */
+static void prvInsertBlockIntoFreeList( HeapRegionControl_t *pxRegion, BlockLink_t *pxBlockToInsert );
+
+/*
+ * Allocate xWantedSize bytes, which includes the block's header and is
+ * aligned, from the first region that has all the attributes in uxAttributes
+ * and a large enough free block.  Returns NULL if there is no such region.
+ */
+static void *prvAllocateFromRegions( size_t xWantedSize, UBaseType_t uxAttributes );
+
+/*
+ * Allocate xWantedSize bytes from the region pxRegion, or return NULL if the
+ * region does not have a large enough free block.
+ */
+static void *prvAllocateFromRegion( HeapRegionControl_t *pxRegion, size_t xWantedSize );
+
+/*
+ * Return the region that holds the memory pointed to by pv, or NULL if no
+ * region holds it.
+ */
+static HeapRegionControl_t *prvFindRegion( const void *pv );
+
+/*
+ * Return the size of the largest free block in the region pxRegion.
+ */
+static size_t prvLargestFreeBlock( const HeapRegionControl_t *pxRegion );
+
+/*
+ * Add the xSizeInBytes bytes starting at pucStartAddress to the heap as a
+ * region with the attributes uxAttributes.
+ */
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes, UBaseType_t uxAttributes );
+
+/*
+ * Called automatically to add ucHeap as the first region, and set up the other
+ * required heap structures, the first time the heap is used.
+ */
+static void prvHeapInit( void );
+
+/*-----------------------------------------------------------*/
+
+/* The size of the structure placed at the beginning of each allocated memory
+block must by correctly byte aligned. */
+static const uint16_t heapSTRUCT_SIZE	= ( ( sizeof ( BlockLink_t ) + ( portBYTE_ALIGNMENT - 1 ) ) & ~portBYTE_ALIGNMENT_MASK );
+
+/* The regions, in the order in which they were added. */
+static HeapRegionControl_t xRegions[ configHEAP_MAXIMUM_REGIONS ];
+static UBaseType_t uxRegionCount = ( UBaseType_t ) 0;
+
+/* Keeps track of the number of free bytes remaining in all the regions, but
+says nothing about fragmentation. */
+static size_t xFreeBytesRemaining = ( size_t ) 0;
+static size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0;
+
+/* Gets set to the top bit of an size_t type.  When this bit in the xBlockSize
+member of an BlockLink_t structure is set then the block belongs to the
+application.  When the bit is free the block is still part of the free heap
+space. */
+static size_t xBlockAllocatedBit = 0;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+	return pvPortMallocWithHints( xWantedSize, ( UBaseType_t ) 0 );
+}
+/*-----------------------------------------------------------*/
+
+void *pvPortMallocWithHints( size_t xWantedSize, UBaseType_t uxHints )
+{
+void *pvReturn = NULL;
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the list of free blocks. */
+		if( uxRegionCount == ( UBaseType_t ) 0 )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Check the requested block size is not so large that the top bit is
+		set.  The top bit of the block size member of the BlockLink_t structure
+		is used to determine who owns the block - the application or the
+		kernel, so it must be free. */
+		if( ( xWantedSize & xBlockAllocatedBit ) == 0 )
+		{
+			/* The wanted size is increased so it can contain a BlockLink_t
+			structure in addition to the requested amount of bytes. */
+			if( xWantedSize > 0 )
+			{
+				xWantedSize += heapSTRUCT_SIZE;
+
+				/* Ensure that blocks are always aligned to the required number
+				of bytes. */
+				if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+				{
+					/* Byte alignment required. */
+					xWantedSize += ( portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pvReturn = prvAllocateFromRegions( xWantedSize, uxHints );
+
+				/* If no region with the preferred attributes has space then
+				try again with only the required attributes. */
+				if( ( pvReturn == NULL ) && ( ( uxHints & heapPREFERRED_ATTRIBUTES ) != 0 ) )
+				{
+					pvReturn = prvAllocateFromRegions( xWantedSize, uxHints & ~heapPREFERRED_ATTRIBUTES );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+		heapMONITOR_MALLOC( pvReturn, xWantedSize );
+	}
+	xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+uint8_t *puc = ( uint8_t * ) pv;
+BlockLink_t *pxLink;
+HeapRegionControl_t *pxRegion;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have an BlockLink_t structure immediately
+		before it. */
+		puc -= heapSTRUCT_SIZE;
+
+		/* This casting is to keep the compiler from issuing warnings. */
+		pxLink = ( void * ) puc;
+
+		/* Check the block is actually allocated. */
+		configASSERT( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 );
+		configASSERT( pxLink->pxNextFreeBlock == NULL );
+
+		if( ( pxLink->xBlockSize & xBlockAllocatedBit ) != 0 )
+		{
+			if( pxLink->pxNextFreeBlock == NULL )
+			{
+				/* The block is being returned to the heap - it is no longer
+				allocated. */
+				pxLink->xBlockSize &= ~xBlockAllocatedBit;
+
+				vTaskSuspendAll();
+				{
+					/* Regions are only ever added, so the search can be made
+					with the scheduler suspended rather than in a critical
+					section. */
+					pxRegion = prvFindRegion( pxLink );
+					configASSERT( pxRegion );
+
+					if( pxRegion != NULL )
+					{
+						/* Add this block to the list of free blocks. */
+						pxRegion->xFreeBytesRemaining += pxLink->xBlockSize;
+						pxRegion->uxAllocatedBlocks--;
+						xFreeBytesRemaining += pxLink->xBlockSize;
+						traceFREE( pv, pxLink->xBlockSize );
+						heapMONITOR_FREE( pv );
+						prvInsertBlockIntoFreeList( pxRegion, pxLink );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				xTaskResumeAll();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+const HeapRegion_t *pxRegion;
+
+	configASSERT( pxHeapRegions );
+
+	vTaskSuspendAll();
+	{
+		if( uxRegionCount == ( UBaseType_t ) 0 )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		for( pxRegion = pxHeapRegions; pxRegion->xSizeInBytes > ( size_t ) 0; pxRegion++ )
+		{
+			prvAddRegion( pxRegion->pucStartAddress, pxRegion->xSizeInBytes, pxRegion->uxAttributes );
+		}
+	}
+	xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetLargestFreeBlockSize( void )
+{
+UBaseType_t uxRegion;
+size_t xLargest = 0, xBlockSize;
+
+	vTaskSuspendAll();
+	{
+		for( uxRegion = 0; uxRegion < uxRegionCount; uxRegion++ )
+		{
+			xBlockSize = prvLargestFreeBlock( &( xRegions[ uxRegion ] ) );
+
+			if( xBlockSize > xLargest )
+			{
+				xLargest = xBlockSize;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	xTaskResumeAll();
+
+	return xLargest;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortGetHeapRegionCount( void )
+{
+UBaseType_t uxReturn;
+
+	vTaskSuspendAll();
+	{
+		if( uxRegionCount == ( UBaseType_t ) 0 )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxReturn = uxRegionCount;
+	}
+	xTaskResumeAll();
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapRegionStats( UBaseType_t uxRegion, HeapRegionStats_t *pxStats )
+{
+HeapRegionControl_t *pxRegion;
+
+	configASSERT( pxStats );
+
+	vTaskSuspendAll();
+	{
+		configASSERT( uxRegion < uxRegionCount );
+		pxRegion = &( xRegions[ uxRegion ] );
+
+		pxStats->pucStartAddress = pxRegion->pucStartAddress;
+		pxStats->xSizeInBytes = pxRegion->xSizeInBytes;
+		pxStats->uxAttributes = pxRegion->uxAttributes;
+		pxStats->xFreeBytes = pxRegion->xFreeBytesRemaining;
+		pxStats->xMinimumEverFreeBytes = pxRegion->xMinimumEverFreeBytesRemaining;
+		pxStats->xLargestFreeBlock = prvLargestFreeBlock( pxRegion );
+		pxStats->uxAllocatedBlocks = pxRegion->uxAllocatedBlocks;
+	}
+	xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static void *prvAllocateFromRegions( size_t xWantedSize, UBaseType_t uxAttributes )
+{
+UBaseType_t uxRegion;
+HeapRegionControl_t *pxRegion;
+void *pvReturn = NULL;
+
+	for( uxRegion = 0; ( uxRegion < uxRegionCount ) && ( pvReturn == NULL ); uxRegion++ )
+	{
+		pxRegion = &( xRegions[ uxRegion ] );
+
+		if( ( pxRegion->uxAttributes & uxAttributes ) == uxAttributes )
+		{
+			pvReturn = prvAllocateFromRegion( pxRegion, xWantedSize );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void *prvAllocateFromRegion( HeapRegionControl_t *pxRegion, size_t xWantedSize )
+{
+BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
+void *pvReturn = NULL;
+
+	if( xWantedSize <= pxRegion->xFreeBytesRemaining )
+	{
+		/* Traverse the list from the start	(lowest address) block until one
+		of adequate size is found. */
+		pxPreviousBlock = &( pxRegion->xStart );
+		pxBlock = pxRegion->xStart.pxNextFreeBlock;
+		while( ( pxBlock->xBlockSize < xWantedSize ) && ( pxBlock->pxNextFreeBlock != NULL ) )
+		{
+			pxPreviousBlock = pxBlock;
+			pxBlock = pxBlock->pxNextFreeBlock;
+		}
+
+		/* If the end marker was reached then a block of adequate size was not
+		found. */
+		if( pxBlock != pxRegion->pxEnd )
+		{
+			/* Return the memory space pointed to - jumping over the
+			BlockLink_t structure at its start. */
+			pvReturn = ( void * ) ( ( ( uint8_t * ) pxPreviousBlock->pxNextFreeBlock ) + heapSTRUCT_SIZE );
+
+			/* This block is being returned for use so must be taken out of
+			the list of free blocks. */
+			pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+			/* If the block is larger than required it can be split into
+			two. */
+			if( ( pxBlock->xBlockSize - xWantedSize ) > heapMINIMUM_BLOCK_SIZE )
+			{
+				/* This block is to be split into two.  Create a new block
+				following the number of bytes requested. The void cast is used
+				to prevent byte alignment warnings from the compiler. */
+				pxNewBlockLink = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+
+				/* Calculate the sizes of two blocks split from the single
+				block. */
+				pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+				pxBlock->xBlockSize = xWantedSize;
+
+				/* Insert the new block into the list of free blocks. */
+				prvInsertBlockIntoFreeList( pxRegion, pxNewBlockLink );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxRegion->xFreeBytesRemaining -= pxBlock->xBlockSize;
+			pxRegion->uxAllocatedBlocks++;
+
+			if( pxRegion->xFreeBytesRemaining < pxRegion->xMinimumEverFreeBytesRemaining )
+			{
+				pxRegion->xMinimumEverFreeBytesRemaining = pxRegion->xFreeBytesRemaining;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+			if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+			{
+				xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The block is being returned - it is allocated and owned by the
+			application and has no "next" block. */
+			pxBlock->xBlockSize |= xBlockAllocatedBit;
+			pxBlock->pxNextFreeBlock = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static HeapRegionControl_t *prvFindRegion( const void *pv )
+{
+UBaseType_t uxRegion;
+HeapRegionControl_t *pxReturn = NULL;
+
+	for( uxRegion = 0; ( uxRegion < uxRegionCount ) && ( pxReturn == NULL ); uxRegion++ )
+	{
+		if( ( ( const uint8_t * ) pv >= xRegions[ uxRegion ].pucStartAddress ) && ( ( const uint8_t * ) pv < ( const uint8_t * ) xRegions[ uxRegion ].pxEnd ) )
+		{
+			pxReturn = &( xRegions[ uxRegion ] );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return pxReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvLargestFreeBlock( const HeapRegionControl_t *pxRegion )
+{
+BlockLink_t *pxBlock;
+size_t xLargest = 0;
+
+	for( pxBlock = pxRegion->xStart.pxNextFreeBlock; pxBlock != pxRegion->pxEnd; pxBlock = pxBlock->pxNextFreeBlock )
+	{
+		if( pxBlock->xBlockSize > xLargest )
+		{
+			xLargest = pxBlock->xBlockSize;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xLargest;
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes, UBaseType_t uxAttributes )
+{
+HeapRegionControl_t *pxRegion;
+BlockLink_t *pxFirstFreeBlock;
+portPOINTER_SIZE_TYPE uxAddress;
+
+	configASSERT( uxRegionCount < ( UBaseType_t ) configHEAP_MAXIMUM_REGIONS );
+
+	/* Ensure the region starts on a correctly aligned boundary. */
+	uxAddress = ( portPOINTER_SIZE_TYPE ) pucStartAddress;
+
+	if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		uxAddress += ( portBYTE_ALIGNMENT - ( uxAddress & portBYTE_ALIGNMENT_MASK ) );
+
+		if( xSizeInBytes > ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pucStartAddress ) )
+		{
+			xSizeInBytes -= ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pucStartAddress );
+		}
+		else
+		{
+			xSizeInBytes = 0U;
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xSizeInBytes &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	if( ( uxRegionCount < ( UBaseType_t ) configHEAP_MAXIMUM_REGIONS ) && ( xSizeInBytes >= heapMINIMUM_REGION_SIZE ) )
+	{
+		pxRegion = &( xRegions[ uxRegionCount ] );
+		pxRegion->pucStartAddress = ( uint8_t * ) uxAddress;
+		pxRegion->xSizeInBytes = xSizeInBytes;
+		pxRegion->uxAttributes = uxAttributes;
+		pxRegion->uxAllocatedBlocks = ( UBaseType_t ) 0;
+
+		/* pxEnd is used to mark the end of the list of free blocks and is
+		inserted at the end of the region. */
+		pxRegion->pxEnd = ( void * ) ( pxRegion->pucStartAddress + xSizeInBytes - heapSTRUCT_SIZE );
+		pxRegion->pxEnd->xBlockSize = 0;
+		pxRegion->pxEnd->pxNextFreeBlock = NULL;
+
+		/* To start with there is a single free block that is sized to take up
+		the entire region, minus the space taken by pxEnd. */
+		pxFirstFreeBlock = ( void * ) pxRegion->pucStartAddress;
+		pxFirstFreeBlock->xBlockSize = xSizeInBytes - heapSTRUCT_SIZE;
+		pxFirstFreeBlock->pxNextFreeBlock = pxRegion->pxEnd;
+
+		/* xStart is used to hold a pointer to the first item in the list of
+		free blocks. */
+		pxRegion->xStart.pxNextFreeBlock = pxFirstFreeBlock;
+		pxRegion->xStart.xBlockSize = ( size_t ) 0;
+
+		pxRegion->xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+		pxRegion->xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+		xFreeBytesRemaining += pxFirstFreeBlock->xBlockSize;
+		xMinimumEverFreeBytesRemaining += pxFirstFreeBlock->xBlockSize;
+
+		/* The region is only searched once it is complete. */
+		uxRegionCount++;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+	/* Work out the position of the top bit in a size_t variable. */
+	xBlockAllocatedBit = ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 );
+
+	prvAddRegion( ucHeap, sizeof( ucHeap ), ( UBaseType_t ) configHEAP_ARRAY_ATTRIBUTES );
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertBlockIntoFreeList( HeapRegionControl_t *pxRegion, BlockLink_t *pxBlockToInsert )
+{
+BlockLink_t *pxIterator;
+uint8_t *puc;
+
+	/* Iterate through the list until a block is found that has a higher address
+	than the block being inserted. */
+	for( pxIterator = &( pxRegion->xStart ); pxIterator->pxNextFreeBlock < pxBlockToInsert; pxIterator = pxIterator->pxNextFreeBlock )
+	{
+		/* Nothing to do here, just iterate to the right position. */
+	}
+
+	/* Do the block being inserted, and the block it is being inserted after
+	make a contiguous block of memory? */
+	puc = ( uint8_t * ) pxIterator;
+	if( ( puc + pxIterator->xBlockSize ) == ( uint8_t * ) pxBlockToInsert )
+	{
+		pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
+		pxBlockToInsert = pxIterator;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Do the block being inserted, and the block it is being inserted before
+	make a contiguous block of memory? */
+	puc = ( uint8_t * ) pxBlockToInsert;
+	if( ( puc + pxBlockToInsert->xBlockSize ) == ( uint8_t * ) pxIterator->pxNextFreeBlock )
+	{
+		if( pxIterator->pxNextFreeBlock != pxRegion->pxEnd )
+		{
+			/* Form one big block from the two blocks. */
+			pxBlockToInsert->xBlockSize += pxIterator->pxNextFreeBlock->xBlockSize;
+			pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock->pxNextFreeBlock;
+		}
+		else
+		{
+			pxBlockToInsert->pxNextFreeBlock = pxRegion->pxEnd;
+		}
+	}
+	else
+	{
+		pxBlockToInsert->pxNextFreeBlock = pxIterator->pxNextFreeBlock;
+	}
+
+	/* If the block being inserted plugged a gap, so was merged with the block
+	before and the block after, then it's pxNextFreeBlock pointer will have
+	already been set, and should not be set here as that would make it point
+	to itself. */
+	if( pxIterator != pxBlockToInsert )
+	{
+		pxIterator->pxNextFreeBlock = pxBlockToInsert;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
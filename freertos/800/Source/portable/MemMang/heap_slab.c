@@ -0,0 +1,436 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A front end for any of the other heap implementations that keeps a free
+ * list of objects for each of a small number of size classes, so the
+ * allocations that are made most often - task control blocks, queues, timers
+ * and event groups - take an object from, or return an object to, a free list
+ * instead of searching the heap.
+ *
+ * A request no larger than the largest size class is rounded up to the
+ * smallest class it fits, and taken from that class's free list.  An object is
+ * popped from, and pushed back onto, a free list inside a critical section a
+ * few instructions long, rather than with the scheduler suspended.  When a
+ * class's free list is empty a slab of configSLAB_PAGE_SIZE bytes is allocated
+ * from the backing heap, outside the critical section, and divided into
+ * objects of that class.  Slabs are never returned to the backing heap - the
+ * memory stays with its class to be reused - so size the classes to match the
+ * objects the application creates and deletes repeatedly.  Larger requests
+ * are passed to the backing heap.
+ *
+ * Each object has a header that holds the class it belongs to (NULL if it was
+ * allocated from the backing heap), so vPortFree() knows where to return it.
+ * traceMALLOC() and traceFREE() are called from a critical section for every
+ * allocation and free, whichever way it is satisfied.
+ *
+ * FreeRTOSConfig.h can define:
+ *
+ *   configSLAB_CLASS_SIZES - An initialiser list of the object sizes of the
+ *   classes, in ascending order, for example { 32, 64, 128 }.
+ *
+ *   configSLAB_PAGE_SIZE - The size of the slabs allocated from the backing
+ *   heap.  Must hold at least one object of the largest class.
+ *
+ *   configSLAB_BACKING_HEAP - The heap implementation, in this directory,
+ *   that slabs and large requests are allocated from.  Defaults to
+ *   "heap_4.c".  The backing heap's xPortGetFreeHeapSize() and the other
+ *   functions that report on the heap are used as they are, so objects held
+ *   in the free lists are counted as allocated.
+ *
+ * uxPortGetSlabClassCount() and vPortGetSlabClassStats() report how each class
+ * is being used.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_tlsf.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configSLAB_CLASS_SIZES
+	#define configSLAB_CLASS_SIZES { 32, 64, 96, 128, 192, 256 }
+#endif
+
+#ifndef configSLAB_PAGE_SIZE
+	#define configSLAB_PAGE_SIZE 1024
+#endif
+
+#ifndef configSLAB_BACKING_HEAP
+	#define configSLAB_BACKING_HEAP "heap_4.c"
+#endif
+
+/* The memory is assumed to be aligned to portBYTE_ALIGNMENT. */
+#define slabALIGN_UP( x )			( ( ( x ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* The number of size classes. */
+#define slabNUM_CLASSES				( sizeof( xClassSizes ) / sizeof( xClassSizes[ 0 ] ) )
+
+/* The header placed in front of every object. */
+typedef struct SLAB_OBJECT
+{
+	struct SLAB_CLASS *pxClass;			/*<< The class the object belongs to, or NULL if the object was allocated from the backing heap. */
+	struct SLAB_OBJECT *pxNextFree;		/*<< The next object in the class's free list.  Only valid while the object is free. */
+} SlabObject_t;
+
+/* The size of the header, which keeps the objects correctly aligned. */
+#define slabHEADER_SIZE				slabALIGN_UP( sizeof( SlabObject_t ) )
+
+/* A size class. */
+typedef struct SLAB_CLASS
+{
+	SlabObject_t *pxFreeObjects;		/*<< The objects that are free, most recently freed first. */
+	UBaseType_t uxObjectsInUse;
+	UBaseType_t uxMaximumObjectsInUse;
+	UBaseType_t uxObjectsFree;
+	UBaseType_t uxSlabs;
+	uint32_t ulAllocations;
+} SlabClass_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The backing heap's pvPortMalloc() and vPortFree(), which are renamed when
+ * the backing heap is included at the end of this file.
+ */
+static void *prvBackingMalloc( size_t xWantedSize );
+static void prvBackingFree( void *pv );
+
+/*
+ * Allocate a slab from the backing heap, and add the objects it is divided
+ * into to pxClass's free list.  Returns pdFAIL if the backing heap is full.
+ */
+static BaseType_t prvAddSlab( SlabClass_t *pxClass, size_t xObjectSize );
+
+/*-----------------------------------------------------------*/
+
+/* The object size of each class. */
+static const size_t xClassSizes[] = configSLAB_CLASS_SIZES;
+
+static SlabClass_t xClasses[ slabNUM_CLASSES ];
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+SlabObject_t *pxObject = NULL;
+SlabClass_t *pxClass = NULL;
+UBaseType_t uxClass;
+void *pvReturn = NULL;
+
+	/* Find the smallest class the request fits. */
+	if( xWantedSize > ( size_t ) 0 )
+	{
+		for( uxClass = 0; uxClass < slabNUM_CLASSES; uxClass++ )
+		{
+			if( xWantedSize <= xClassSizes[ uxClass ] )
+			{
+				pxClass = &( xClasses[ uxClass ] );
+				break;
+			}
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxClass != NULL )
+	{
+		do
+		{
+			taskENTER_CRITICAL();
+			{
+				pxObject = pxClass->pxFreeObjects;
+
+				if( pxObject != NULL )
+				{
+					pxClass->pxFreeObjects = pxObject->pxNextFree;
+					pxClass->uxObjectsFree--;
+					pxClass->uxObjectsInUse++;
+					pxClass->ulAllocations++;
+
+					if( pxClass->uxObjectsInUse > pxClass->uxMaximumObjectsInUse )
+					{
+						pxClass->uxMaximumObjectsInUse = pxClass->uxObjectsInUse;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					pvReturn = ( void * ) ( ( ( uint8_t * ) pxObject ) + slabHEADER_SIZE );
+					traceMALLOC( pvReturn, xWantedSize );
+					heapMONITOR_MALLOC( pvReturn, xWantedSize );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			/* If the free list was empty then add a slab and try again.  A
+			task that runs while the slab is being added may take objects
+			from it first. */
+		} while( ( pxObject == NULL ) && ( prvAddSlab( pxClass, slabALIGN_UP( xClassSizes[ uxClass ] ) ) != pdFAIL ) );
+	}
+	else if( xWantedSize <= ( ( ( size_t ) ~0U ) - slabHEADER_SIZE ) )
+	{
+		/* Too large for any class, or 0 bytes, which the backing heap will
+		refuse. */
+		pxObject = prvBackingMalloc( ( xWantedSize > ( size_t ) 0 ) ? ( xWantedSize + slabHEADER_SIZE ) : ( size_t ) 0 );
+
+		if( pxObject != NULL )
+		{
+			pxObject->pxClass = NULL;
+			pvReturn = ( void * ) ( ( ( uint8_t * ) pxObject ) + slabHEADER_SIZE );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* Allocations taken from a free list were traced in the critical section
+	above.  The trace macros are always called from a critical section. */
+	if( ( pxClass == NULL ) || ( pvReturn == NULL ) )
+	{
+		taskENTER_CRITICAL();
+		{
+			traceMALLOC( pvReturn, xWantedSize );
+			heapMONITOR_MALLOC( pvReturn, xWantedSize );
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+SlabObject_t *pxObject;
+SlabClass_t *pxClass;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have a SlabObject_t structure
+		immediately before it.  The void cast is used to prevent compiler
+		warnings. */
+		pxObject = ( void * ) ( ( ( uint8_t * ) pv ) - slabHEADER_SIZE );
+		pxClass = pxObject->pxClass;
+
+		taskENTER_CRITICAL();
+		{
+			if( pxClass != NULL )
+			{
+				traceFREE( pv, xClassSizes[ pxClass - xClasses ] );
+				heapMONITOR_FREE( pv );
+				configASSERT( pxClass->uxObjectsInUse > 0 );
+				pxObject->pxNextFree = pxClass->pxFreeObjects;
+				pxClass->pxFreeObjects = pxObject;
+				pxClass->uxObjectsInUse--;
+				pxClass->uxObjectsFree++;
+			}
+			else
+			{
+				traceFREE( pv, 0 );
+				heapMONITOR_FREE( pv );
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( pxClass == NULL )
+		{
+			prvBackingFree( pxObject );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortGetSlabClassCount( void )
+{
+	return ( UBaseType_t ) slabNUM_CLASSES;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetSlabClassStats( UBaseType_t uxClass, SlabClassStats_t *pxStats )
+{
+SlabClass_t *pxClass;
+
+	configASSERT( uxClass < slabNUM_CLASSES );
+	pxClass = &( xClasses[ uxClass ] );
+
+	taskENTER_CRITICAL();
+	{
+		pxStats->xObjectSize = xClassSizes[ uxClass ];
+		pxStats->uxObjectsInUse = pxClass->uxObjectsInUse;
+		pxStats->uxMaximumObjectsInUse = pxClass->uxMaximumObjectsInUse;
+		pxStats->uxObjectsFree = pxClass->uxObjectsFree;
+		pxStats->uxSlabs = pxClass->uxSlabs;
+		pxStats->ulAllocations = pxClass->ulAllocations;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvAddSlab( SlabClass_t *pxClass, size_t xObjectSize )
+{
+uint8_t *pucSlab;
+SlabObject_t *pxObject, *pxFirst = NULL, *pxLast = NULL;
+UBaseType_t uxObject, uxObjects;
+BaseType_t xReturn = pdFAIL;
+
+	uxObjects = ( UBaseType_t ) ( configSLAB_PAGE_SIZE / ( slabHEADER_SIZE + xObjectSize ) );
+	configASSERT( uxObjects > 0 );
+
+	pucSlab = ( uint8_t * ) prvBackingMalloc( configSLAB_PAGE_SIZE );
+
+	if( pucSlab != NULL )
+	{
+		/* Link the objects together before adding them to the free list, so
+		the critical section is short. */
+		for( uxObject = 0; uxObject < uxObjects; uxObject++ )
+		{
+			/* The void cast is used to prevent byte alignment warnings from
+			the compiler. */
+			pxObject = ( void * ) ( pucSlab + ( uxObject * ( slabHEADER_SIZE + xObjectSize ) ) );
+			pxObject->pxClass = pxClass;
+			pxObject->pxNextFree = NULL;
+
+			if( pxLast == NULL )
+			{
+				pxFirst = pxObject;
+			}
+			else
+			{
+				pxLast->pxNextFree = pxObject;
+			}
+
+			pxLast = pxObject;
+		}
+
+		taskENTER_CRITICAL();
+		{
+			pxLast->pxNextFree = pxClass->pxFreeObjects;
+			pxClass->pxFreeObjects = pxFirst;
+			pxClass->uxObjectsFree += uxObjects;
+			pxClass->uxSlabs++;
+		}
+		taskEXIT_CRITICAL();
+
+		xReturn = pdPASS;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+/* The backing heap is compiled as part of this file, with its pvPortMalloc()
+and vPortFree() renamed.  Its trace macros are removed, as every allocation is
+traced above - including those the backing heap satisfies.  The heap monitor
+macros are removed for the same reason. */
+#undef traceMALLOC
+#undef traceFREE
+#undef heapMONITOR_MALLOC
+#undef heapMONITOR_FREE
+#define traceMALLOC( pvAddress, uiSize )
+#define traceFREE( pvAddress, uiSize )
+#define heapMONITOR_MALLOC( pvAddress, xSize )
+#define heapMONITOR_FREE( pvAddress )
+#define pvPortMalloc prvBackingMalloc
+#define vPortFree prvBackingFree
+
+#include configSLAB_BACKING_HEAP
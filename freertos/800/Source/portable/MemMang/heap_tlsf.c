@@ -0,0 +1,817 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that uses a two
+ * level segregated fit (TLSF) allocator, so both functions complete in a
+ * bounded time that does not depend on the number of blocks in the heap.
+ * Adjacent free blocks are combined (coalesced) as they are freed, as with
+ * heap_4.c, which can take a time proportional to the number of free blocks
+ * to find a block and to free one.
+ *
+ * Free blocks are held in an array of lists.  The first level index is the
+ * position of the most significant bit of the block's size, and the second
+ * level index divides each power of two range into heapSL_INDEX_COUNT equal
+ * ranges.  Blocks smaller than heapSMALL_BLOCK_SIZE share the first level
+ * index 0, divided into ranges of portBYTE_ALIGNMENT bytes.  A bitmap of the
+ * non empty lists at each level means a large enough block is found with two
+ * bit scans, rather than a search.  Requests are rounded up to the start of
+ * the next range before the search, so any block in the list found is large
+ * enough - which means up to one part in heapSL_INDEX_COUNT of a large request
+ * can be lost to rounding when the heap is nearly full.
+ *
+ * The heap can be made up of more than one region of memory.  The memory in
+ * ucHeap[ configTOTAL_HEAP_SIZE ] is used as the first region, and other
+ * regions, which need not be contiguous, are added by calling
+ * vPortDefineHeapRegions().  A block is never combined with a block in another
+ * region.
+ *
+ * The largest block that can be held is set by
+ * configTLSF_MAXIMUM_BLOCK_SIZE_LOG2 (2^20 bytes if not defined in
+ * FreeRTOSConfig.h).  Larger regions are divided into several regions, and
+ * because of the rounding the largest request that can be met is one part in
+ * heapSL_INDEX_COUNT smaller.  The free list array takes
+ * configTLSF_MAXIMUM_BLOCK_SIZE_LOG2 - 6 rows of heapSL_INDEX_COUNT pointers
+ * (with portBYTE_ALIGNMENT set to 8), so set it no larger than needed.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c and heap_4.c for alternative
+ * implementations, and the memory management pages of http://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stddef.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#ifndef configTLSF_MAXIMUM_BLOCK_SIZE_LOG2
+	#define configTLSF_MAXIMUM_BLOCK_SIZE_LOG2 20
+#endif
+
+/* The two least significant bits of a block's size are used as flags, so
+blocks must be aligned to at least four bytes. */
+#if( portBYTE_ALIGNMENT == 4 )
+	#define heapALIGNMENT_LOG2	2
+#elif( portBYTE_ALIGNMENT == 8 )
+	#define heapALIGNMENT_LOG2	3
+#elif( portBYTE_ALIGNMENT == 16 )
+	#define heapALIGNMENT_LOG2	4
+#elif( portBYTE_ALIGNMENT == 32 )
+	#define heapALIGNMENT_LOG2	5
+#else
+	#error heap_tlsf.c requires portBYTE_ALIGNMENT to be 4, 8, 16 or 32.
+#endif
+
+/* The number of second level lists for each first level index. */
+#define heapSL_INDEX_COUNT_LOG2		4
+#define heapSL_INDEX_COUNT			( 1UL << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE are held in the lists of first level
+index 0, which are portBYTE_ALIGNMENT bytes apart. */
+#define heapFL_INDEX_SHIFT			( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE		( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* The number of first level indexes. */
+#define heapFL_INDEX_COUNT			( configTLSF_MAXIMUM_BLOCK_SIZE_LOG2 - heapFL_INDEX_SHIFT + 1 )
+
+#if( ( configTLSF_MAXIMUM_BLOCK_SIZE_LOG2 <= heapFL_INDEX_SHIFT ) || ( configTLSF_MAXIMUM_BLOCK_SIZE_LOG2 > 31 ) )
+	#error configTLSF_MAXIMUM_BLOCK_SIZE_LOG2 is out of range.
+#endif
+
+/* The size of the largest block, excluding its header. */
+#define heapMAXIMUM_BLOCK_SIZE		( ( ( size_t ) 1 << configTLSF_MAXIMUM_BLOCK_SIZE_LOG2 ) - ( size_t ) portBYTE_ALIGNMENT )
+
+/* Flags held in the two least significant bits of a block's size. */
+#define heapBLOCK_FREE_BIT			( ( size_t ) 1 )
+#define heapPREVIOUS_FREE_BIT		( ( size_t ) 2 )
+#define heapBLOCK_SIZE_MASK			( ~( heapBLOCK_FREE_BIT | heapPREVIOUS_FREE_BIT ) )
+
+/* Accessors for the size and flags of a block. */
+#define heapBLOCK_SIZE( pxBlock )			( ( pxBlock )->xBlockSize & heapBLOCK_SIZE_MASK )
+#define heapIS_FREE( pxBlock )				( ( ( pxBlock )->xBlockSize & heapBLOCK_FREE_BIT ) != 0 )
+#define heapIS_PREVIOUS_FREE( pxBlock )		( ( ( pxBlock )->xBlockSize & heapPREVIOUS_FREE_BIT ) != 0 )
+
+/* The memory is assumed to be aligned to portBYTE_ALIGNMENT. */
+#define heapALIGN_UP( x )			( ( ( x ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK ) )
+
+/* The header at the start of every block.  The free list pointers are only
+used while the block is free, so they occupy the first bytes of the memory that
+is handed to the application while the block is allocated. */
+typedef struct HEAP_BLOCK
+{
+	struct HEAP_BLOCK *pxPreviousPhysicalBlock;	/*<< The block before this one in memory.  Only valid if heapPREVIOUS_FREE_BIT is set. */
+	size_t xBlockSize;							/*<< The size of the block, excluding the header, plus the flag bits. */
+	struct HEAP_BLOCK *pxNextFreeBlock;			/*<< The next block in the same free list.  Only valid while the block is free. */
+	struct HEAP_BLOCK *pxPreviousFreeBlock;		/*<< The previous block in the same free list.  Only valid while the block is free. */
+} HeapBlock_t;
+
+/* The size of the part of the header that is not used by the application. */
+#define heapHEADER_SIZE				heapALIGN_UP( offsetof( HeapBlock_t, pxNextFreeBlock ) )
+
+/* Block sizes must be large enough to hold the free list pointers. */
+#define heapMINIMUM_BLOCK_SIZE		heapALIGN_UP( sizeof( HeapBlock_t ) - offsetof( HeapBlock_t, pxNextFreeBlock ) )
+
+/* A region must be large enough to hold one block and the end marker. */
+#define heapMINIMUM_REGION_SIZE		( ( heapHEADER_SIZE * 2 ) + heapMINIMUM_BLOCK_SIZE )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the position of the most significant set bit in ulValue, which must
+ * not be 0.
+ */
+static UBaseType_t prvFindLastSet( uint32_t ulValue );
+
+/*
+ * Return the first and second level indexes of the free list that holds
+ * blocks of xBlockSize bytes.
+ */
+static void prvMappingInsert( size_t xBlockSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel );
+
+/*
+ * Return the first and second level indexes of the first free list in which
+ * every block is at least xBlockSize bytes.
+ */
+static void prvMappingSearch( size_t xBlockSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel );
+
+/*
+ * Return the first block from the first non empty list at or above the first
+ * and second level indexes given, updating the indexes to those of the list
+ * the block is in.  Returns NULL if there is no such list.
+ */
+static HeapBlock_t *prvFindSuitableBlock( UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel );
+
+/*
+ * Add a free block to, or remove a free block from, the free list for its
+ * size.
+ */
+static void prvInsertFreeBlock( HeapBlock_t *pxBlock );
+static void prvRemoveFreeBlock( HeapBlock_t *pxBlock );
+
+/*
+ * Return the block that follows pxBlock in memory.
+ */
+static HeapBlock_t *prvNextPhysicalBlock( const HeapBlock_t *pxBlock );
+
+/*
+ * Add xSizeInBytes bytes of memory starting at pucStartAddress to the heap.
+ */
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes );
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() or vPortDefineHeapRegions() is called.
+ */
+static void prvHeapInit( void );
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the first region of the heap. */
+static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+
+/* The free lists, and bitmaps of the lists that are not empty.  Bit n of
+ulFirstLevelBitmap is set if ulSecondLevelBitmaps[ n ] is not 0, and bit m of
+ulSecondLevelBitmaps[ n ] is set if pxFreeLists[ n ][ m ] is not NULL. */
+static HeapBlock_t *pxFreeLists[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+static uint32_t ulSecondLevelBitmaps[ heapFL_INDEX_COUNT ];
+static uint32_t ulFirstLevelBitmap = 0UL;
+
+/* Set once the heap has been initialised. */
+static BaseType_t xHeapInitialised = pdFALSE;
+
+/* Keeps track of the number of free bytes remaining, including the headers of
+the free blocks, but says nothing about fragmentation. */
+static size_t xFreeBytesRemaining = 0U;
+static size_t xMinimumEverFreeBytesRemaining = 0U;
+
+/*-----------------------------------------------------------*/
+
+void *pvPortMalloc( size_t xWantedSize )
+{
+HeapBlock_t *pxBlock, *pxRemainder;
+UBaseType_t uxFirstLevel, uxSecondLevel;
+size_t xBlockSize;
+void *pvReturn = NULL;
+
+	vTaskSuspendAll();
+	{
+		/* If this is the first call to malloc then the heap will require
+		initialisation to setup the free lists. */
+		if( xHeapInitialised == pdFALSE )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( xWantedSize > 0 ) && ( xWantedSize <= heapMAXIMUM_BLOCK_SIZE ) )
+		{
+			/* The block must be able to hold the free list pointers when it
+			is freed again, and is always aligned to the required number of
+			bytes. */
+			if( xWantedSize < heapMINIMUM_BLOCK_SIZE )
+			{
+				xBlockSize = heapMINIMUM_BLOCK_SIZE;
+			}
+			else
+			{
+				xBlockSize = heapALIGN_UP( xWantedSize );
+			}
+
+			prvMappingSearch( xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+			if( uxFirstLevel < heapFL_INDEX_COUNT )
+			{
+				pxBlock = prvFindSuitableBlock( &uxFirstLevel, &uxSecondLevel );
+			}
+			else
+			{
+				/* Rounding the size up took it past the largest list. */
+				pxBlock = NULL;
+			}
+
+			if( pxBlock != NULL )
+			{
+				/* The block is being returned for use so must be taken out of
+				its free list. */
+				prvRemoveFreeBlock( pxBlock );
+
+				/* If the block is larger than required it can be split into
+				two, in which case the remainder is still followed by the same
+				block, which still follows a free block. */
+				if( heapBLOCK_SIZE( pxBlock ) >= ( xBlockSize + heapHEADER_SIZE + heapMINIMUM_BLOCK_SIZE ) )
+				{
+					/* The void cast is used to prevent byte alignment warnings
+					from the compiler. */
+					pxRemainder = ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapHEADER_SIZE + xBlockSize );
+					pxRemainder->xBlockSize = ( heapBLOCK_SIZE( pxBlock ) - xBlockSize - heapHEADER_SIZE ) | heapBLOCK_FREE_BIT;
+					prvNextPhysicalBlock( pxRemainder )->pxPreviousPhysicalBlock = pxRemainder;
+					pxBlock->xBlockSize = xBlockSize;
+
+					/* Insert the remainder into the free lists. */
+					prvInsertFreeBlock( pxRemainder );
+				}
+				else
+				{
+					/* The block that follows no longer follows a free
+					block. */
+					pxBlock->xBlockSize &= ~heapBLOCK_FREE_BIT;
+					prvNextPhysicalBlock( pxBlock )->xBlockSize &= ~heapPREVIOUS_FREE_BIT;
+				}
+
+				xFreeBytesRemaining -= heapBLOCK_SIZE( pxBlock ) + heapHEADER_SIZE;
+
+				if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+				{
+					xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Return the memory that follows the part of the header that
+				remains in use. */
+				pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapHEADER_SIZE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		traceMALLOC( pvReturn, xWantedSize );
+		heapMONITOR_MALLOC( pvReturn, xWantedSize );
+	}
+	xTaskResumeAll();
+
+	#if( configUSE_MALLOC_FAILED_HOOK == 1 )
+	{
+		if( pvReturn == NULL )
+		{
+			extern void vApplicationMallocFailedHook( void );
+			vApplicationMallocFailedHook();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif
+
+	return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void *pv )
+{
+HeapBlock_t *pxBlock, *pxNeighbour;
+
+	if( pv != NULL )
+	{
+		/* The memory being freed will have the used part of a HeapBlock_t
+		structure immediately before it.  The void cast is used to prevent
+		compiler warnings. */
+		pxBlock = ( void * ) ( ( ( uint8_t * ) pv ) - heapHEADER_SIZE );
+
+		/* Check the block is actually allocated. */
+		configASSERT( heapIS_FREE( pxBlock ) == pdFALSE );
+
+		if( heapIS_FREE( pxBlock ) == pdFALSE )
+		{
+			vTaskSuspendAll();
+			{
+				xFreeBytesRemaining += heapBLOCK_SIZE( pxBlock ) + heapHEADER_SIZE;
+				traceFREE( pv, heapBLOCK_SIZE( pxBlock ) );
+				heapMONITOR_FREE( pv );
+				pxBlock->xBlockSize |= heapBLOCK_FREE_BIT;
+
+				/* Combine the block with the block before it if that block is
+				free.  The block before a free block is never free, so the
+				combined block does not follow a free block. */
+				if( heapIS_PREVIOUS_FREE( pxBlock ) != pdFALSE )
+				{
+					pxNeighbour = pxBlock->pxPreviousPhysicalBlock;
+					prvRemoveFreeBlock( pxNeighbour );
+					pxNeighbour->xBlockSize += heapBLOCK_SIZE( pxBlock ) + heapHEADER_SIZE;
+					pxBlock = pxNeighbour;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Combine the block with the block after it if that block is
+				free.  The end marker of a region is never free. */
+				pxNeighbour = prvNextPhysicalBlock( pxBlock );
+
+				if( heapIS_FREE( pxNeighbour ) != pdFALSE )
+				{
+					prvRemoveFreeBlock( pxNeighbour );
+					pxBlock->xBlockSize += heapBLOCK_SIZE( pxNeighbour ) + heapHEADER_SIZE;
+					pxNeighbour = prvNextPhysicalBlock( pxBlock );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxNeighbour->xBlockSize |= heapPREVIOUS_FREE_BIT;
+				pxNeighbour->pxPreviousPhysicalBlock = pxBlock;
+
+				prvInsertFreeBlock( pxBlock );
+			}
+			xTaskResumeAll();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions )
+{
+const HeapRegion_t *pxRegion;
+
+	configASSERT( pxHeapRegions );
+
+	vTaskSuspendAll();
+	{
+		if( xHeapInitialised == pdFALSE )
+		{
+			prvHeapInit();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		for( pxRegion = pxHeapRegions; pxRegion->xSizeInBytes > ( size_t ) 0; pxRegion++ )
+		{
+			prvAddRegion( pxRegion->pucStartAddress, pxRegion->xSizeInBytes );
+		}
+	}
+	xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+	return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+	return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetLargestFreeBlockSize( void )
+{
+HeapBlock_t *pxBlock;
+UBaseType_t uxFirstLevel, uxSecondLevel;
+size_t xLargest = 0U;
+
+	vTaskSuspendAll();
+	{
+		/* The largest block is in the highest non empty list, but the blocks
+		in a list are not sorted by size. */
+		if( ulFirstLevelBitmap != 0UL )
+		{
+			uxFirstLevel = prvFindLastSet( ulFirstLevelBitmap );
+			uxSecondLevel = prvFindLastSet( ulSecondLevelBitmaps[ uxFirstLevel ] );
+
+			for( pxBlock = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+			{
+				if( ( heapBLOCK_SIZE( pxBlock ) + heapHEADER_SIZE ) > xLargest )
+				{
+					xLargest = heapBLOCK_SIZE( pxBlock ) + heapHEADER_SIZE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	xTaskResumeAll();
+
+	return xLargest;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+	/* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( uint32_t ulValue )
+{
+UBaseType_t uxBit;
+
+	#if( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+	{
+		/* The port's count leading zeros instruction. */
+		portGET_HIGHEST_PRIORITY( uxBit, ulValue );
+	}
+	#else
+	{
+		/* A binary search, which takes the same five steps for any value. */
+		uxBit = 0;
+
+		if( ( ulValue & 0xffff0000UL ) != 0UL )
+		{
+			ulValue >>= 16;
+			uxBit += 16;
+		}
+
+		if( ( ulValue & 0xff00UL ) != 0UL )
+		{
+			ulValue >>= 8;
+			uxBit += 8;
+		}
+
+		if( ( ulValue & 0xf0UL ) != 0UL )
+		{
+			ulValue >>= 4;
+			uxBit += 4;
+		}
+
+		if( ( ulValue & 0xcUL ) != 0UL )
+		{
+			ulValue >>= 2;
+			uxBit += 2;
+		}
+
+		if( ( ulValue & 0x2UL ) != 0UL )
+		{
+			uxBit += 1;
+		}
+	}
+	#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+
+	return uxBit;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xBlockSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel )
+{
+UBaseType_t uxMostSignificantBit;
+
+	if( xBlockSize < heapSMALL_BLOCK_SIZE )
+	{
+		/* Small blocks are held in lists portBYTE_ALIGNMENT bytes apart. */
+		*puxFirstLevel = 0;
+		*puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+	}
+	else
+	{
+		/* The second level index is taken from the heapSL_INDEX_COUNT_LOG2
+		bits that follow the most significant bit. */
+		uxMostSignificantBit = prvFindLastSet( ( uint32_t ) xBlockSize );
+		*puxSecondLevel = ( UBaseType_t ) ( ( xBlockSize >> ( uxMostSignificantBit - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT );
+		*puxFirstLevel = uxMostSignificantBit - ( heapFL_INDEX_SHIFT - 1 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingSearch( size_t xBlockSize, UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel )
+{
+	/* Round the size up to the start of the next list, so every block in the
+	list found is large enough. */
+	if( xBlockSize >= heapSMALL_BLOCK_SIZE )
+	{
+		xBlockSize += ( ( size_t ) 1 << ( prvFindLastSet( ( uint32_t ) xBlockSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	prvMappingInsert( xBlockSize, puxFirstLevel, puxSecondLevel );
+}
+/*-----------------------------------------------------------*/
+
+static HeapBlock_t *prvFindSuitableBlock( UBaseType_t *puxFirstLevel, UBaseType_t *puxSecondLevel )
+{
+uint32_t ulBitmap;
+HeapBlock_t *pxBlock = NULL;
+
+	/* First look for a list at or above the second level index in the same
+	first level row. */
+	ulBitmap = ulSecondLevelBitmaps[ *puxFirstLevel ] & ( ~0UL << *puxSecondLevel );
+
+	if( ulBitmap == 0UL )
+	{
+		/* There is none, so look for the next non empty first level row. */
+		ulBitmap = ulFirstLevelBitmap & ( ~0UL << ( *puxFirstLevel + 1 ) );
+
+		if( ulBitmap != 0UL )
+		{
+			/* x & -x isolates the least significant set bit. */
+			*puxFirstLevel = prvFindLastSet( ulBitmap & ( ~ulBitmap + 1UL ) );
+			ulBitmap = ulSecondLevelBitmaps[ *puxFirstLevel ];
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( ulBitmap != 0UL )
+	{
+		*puxSecondLevel = prvFindLastSet( ulBitmap & ( ~ulBitmap + 1UL ) );
+		pxBlock = pxFreeLists[ *puxFirstLevel ][ *puxSecondLevel ];
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( HeapBlock_t *pxBlock )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+HeapBlock_t *pxHead;
+
+	prvMappingInsert( heapBLOCK_SIZE( pxBlock ), &uxFirstLevel, &uxSecondLevel );
+
+	/* Insert the block at the head of its list. */
+	pxHead = pxFreeLists[ uxFirstLevel ][ uxSecondLevel ];
+	pxBlock->pxNextFreeBlock = pxHead;
+	pxBlock->pxPreviousFreeBlock = NULL;
+
+	if( pxHead != NULL )
+	{
+		pxHead->pxPreviousFreeBlock = pxBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock;
+	ulFirstLevelBitmap |= 1UL << uxFirstLevel;
+	ulSecondLevelBitmaps[ uxFirstLevel ] |= 1UL << uxSecondLevel;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( HeapBlock_t *pxBlock )
+{
+UBaseType_t uxFirstLevel, uxSecondLevel;
+
+	prvMappingInsert( heapBLOCK_SIZE( pxBlock ), &uxFirstLevel, &uxSecondLevel );
+
+	if( pxBlock->pxNextFreeBlock != NULL )
+	{
+		pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock->pxPreviousFreeBlock;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	if( pxBlock->pxPreviousFreeBlock != NULL )
+	{
+		pxBlock->pxPreviousFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+	}
+	else
+	{
+		/* The block was the head of its list.  If the list is now empty then
+		clear its bit, and the bit of its first level row if that is now empty
+		too. */
+		pxFreeLists[ uxFirstLevel ][ uxSecondLevel ] = pxBlock->pxNextFreeBlock;
+
+		if( pxBlock->pxNextFreeBlock == NULL )
+		{
+			ulSecondLevelBitmaps[ uxFirstLevel ] &= ~( 1UL << uxSecondLevel );
+
+			if( ulSecondLevelBitmaps[ uxFirstLevel ] == 0UL )
+			{
+				ulFirstLevelBitmap &= ~( 1UL << uxFirstLevel );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static HeapBlock_t *prvNextPhysicalBlock( const HeapBlock_t *pxBlock )
+{
+	/* The void cast is used to prevent byte alignment warnings from the
+	compiler. */
+	return ( void * ) ( ( ( uint8_t * ) pxBlock ) + heapHEADER_SIZE + heapBLOCK_SIZE( pxBlock ) );
+}
+/*-----------------------------------------------------------*/
+
+static void prvAddRegion( uint8_t *pucStartAddress, size_t xSizeInBytes )
+{
+HeapBlock_t *pxBlock, *pxEnd;
+portPOINTER_SIZE_TYPE uxAddress;
+size_t xBlockSize;
+
+	/* Ensure the region starts on a correctly aligned boundary. */
+	uxAddress = ( portPOINTER_SIZE_TYPE ) pucStartAddress;
+
+	if( ( uxAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+	{
+		uxAddress += ( portBYTE_ALIGNMENT - ( uxAddress & portBYTE_ALIGNMENT_MASK ) );
+
+		if( xSizeInBytes > ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pucStartAddress ) )
+		{
+			xSizeInBytes -= ( size_t ) ( uxAddress - ( portPOINTER_SIZE_TYPE ) pucStartAddress );
+		}
+		else
+		{
+			xSizeInBytes = 0U;
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xSizeInBytes &= ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+	/* Each pass adds a single free block followed by an end marker, which
+	stops the block being combined with the memory that follows it.  Regions
+	too large for one block are divided into several. */
+	while( xSizeInBytes >= heapMINIMUM_REGION_SIZE )
+	{
+		xBlockSize = xSizeInBytes - ( heapHEADER_SIZE * 2 );
+
+		if( xBlockSize > heapMAXIMUM_BLOCK_SIZE )
+		{
+			xBlockSize = heapMAXIMUM_BLOCK_SIZE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* The first block does not follow a free block, so is never
+		combined with the memory before it. */
+		pxBlock = ( void * ) uxAddress;
+		pxBlock->xBlockSize = xBlockSize | heapBLOCK_FREE_BIT;
+
+		/* The end marker is a block of zero bytes that is never free. */
+		pxEnd = prvNextPhysicalBlock( pxBlock );
+		pxEnd->xBlockSize = heapPREVIOUS_FREE_BIT;
+		pxEnd->pxPreviousPhysicalBlock = pxBlock;
+
+		prvInsertFreeBlock( pxBlock );
+		xFreeBytesRemaining += xBlockSize + heapHEADER_SIZE;
+		xMinimumEverFreeBytesRemaining += xBlockSize + heapHEADER_SIZE;
+
+		uxAddress += ( portPOINTER_SIZE_TYPE ) ( xBlockSize + ( heapHEADER_SIZE * 2 ) );
+		xSizeInBytes -= xBlockSize + ( heapHEADER_SIZE * 2 );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void )
+{
+	xHeapInitialised = pdTRUE;
+	prvAddRegion( ucHeap, sizeof( ucHeap ) );
+}
+/*-----------------------------------------------------------*/
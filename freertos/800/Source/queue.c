@@ -110,6 +110,14 @@ zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME		 ( ( TickType_t ) 0U )
 
+/* When configUSE_FAST_MUTEXES is 1 a mutex is owned by the task whose handle
+is in the uxMutexOwner member, which is zero when the mutex is free.  A task
+that blocks on the mutex sets the bit below, so the holder knows it has to give
+the mutex back the slow way.  Task handles are aligned, so the bit is never
+part of the handle.  A mutex taken before any task has been created has no task
+to own it, so only the bit is set, and it is taken and given the slow way. */
+#define queueMUTEX_HAS_WAITERS			( ( UBaseType_t ) 1U )
+
 #if( configUSE_PREEMPTION == 0 )
 	/* If the cooperative scheduler is being used then a yield should not be
 	performed just because a higher priority task has been woken. */
@@ -151,6 +159,24 @@ typedef struct QueueDefinition
 
 	#if ( configUSE_QUEUE_SETS == 1 )
 		struct QueueDefinition *pxQueueSetContainer;
+
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+			ListItem_t xReadyMemberListItem;	/*< Holds the queue in the list of ready members of its queue set while it holds items that have not been selected. */
+			UBaseType_t uxItemsSelected;		/*< The number of items in the queue that selecting the queue from its queue set has claimed, and that are yet to be received. */
+		#endif
+	#endif
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t ucStaticallyAllocated;	/*< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
+	#endif
+
+	#if( configUSE_QUEUE_ZERO_COPY == 1 )
+		volatile BaseType_t xSlotReserved;	/*< Set to pdTRUE while the slot pointed to by pcWriteTo has been reserved by xQueueReserve() but not yet committed. */
+		volatile BaseType_t xReferenceHeld;	/*< Set to queueRECEIVE_REFERENCE or queuePEEK_REFERENCE while a reference to an item is held, otherwise pdFALSE. */
+	#endif
+
+	#if( configUSE_FAST_MUTEXES == 1 )
+		volatile UBaseType_t uxMutexOwner;	/*< The handle of the task holding the mutex, plus queueMUTEX_HAS_WAITERS if a task has blocked on it, or zero if the mutex is free.  pxMutexHolder and uxMessagesWaiting follow it for the benefit of the rest of the queue code. */
 	#endif
 
 } xQUEUE;
@@ -206,11 +232,21 @@ static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 static BaseType_t prvIsQueueEmpty( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
- * Uses a critical section to determine if there is any space in a queue.
+ * Uses a critical section to determine if there is any space in a queue for an
+ * item to be written to xPosition.
  *
  * @return pdTRUE if there is no space, otherwise pdFALSE;
  */
-static BaseType_t prvIsQueueFull( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsQueueFull( const Queue_t *pxQueue, const BaseType_t xPosition ) PRIVILEGED_FUNCTION;
+
+/*
+ * Determine if an item can be written to xPosition of a queue, or received from
+ * a queue, now.  Must be called from a critical section.  If
+ * configUSE_QUEUE_ZERO_COPY is 1 these also take into account a reserved slot
+ * or an item to which a reference is held.
+ */
+static BaseType_t prvCanSendToQueue( const Queue_t *pxQueue, const BaseType_t xPosition ) PRIVILEGED_FUNCTION;
+static BaseType_t prvCanReceiveFromQueue( const Queue_t *pxQueue ) PRIVILEGED_FUNCTION;
 
 /*
  * Copies an item into the queue, either at the front of the queue or the
@@ -231,6 +267,96 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
 #endif
 
+#if( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+	/*
+	 * Called when an item has been removed from a queue that may be a member
+	 * of a queue set.  Removes the queue from the list of ready members of the
+	 * set if it no longer holds an item that has not been selected.  Must be
+	 * called from a critical section.
+	 */
+	static void prvUpdateReadyMember( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Selects the member at the front of the list of ready members of a queue
+	 * set, which must not be empty, claiming one of its items.  Must be called
+	 * from a critical section.
+	 */
+	static QueueSetMemberHandle_t prvClaimReadyMember( Queue_t * const pxQueueSet ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Writes the handles of up to uxMaxMembers ready members of a queue set to
+	 * pxMembers, waiting up to xTicksToWait ticks for one to become ready.
+	 * Returns the number of handles written.
+	 */
+	static UBaseType_t prvSelectReadyMembers( Queue_t * const pxQueueSet, QueueSetMemberHandle_t * const pxMembers, const UBaseType_t uxMaxMembers, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+	/*
+	 * Unblock the tasks that may be able to continue after a reserved slot has
+	 * been committed (xItemAdded is pdTRUE) or a reference has been released
+	 * (xItemAdded is pdFALSE).  The queue must not be locked.
+	 *
+	 * @return pdTRUE if a task with a priority higher than the running task was
+	 * unblocked, otherwise pdFALSE.
+	 */
+	static BaseType_t prvUnblockZeroCopyWaiters( Queue_t * const pxQueue, const BaseType_t xItemAdded ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Make the item in the slot reserved by xQueueReserve() available to be
+	 * received.
+	 */
+	static void prvCommitReservedSlot( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Advance the read position to the next item in the queue and return a
+	 * pointer to the item.
+	 */
+	static int8_t *prvReferenceNextItem( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Called after a Queue_t structure has been allocated either statically or
+ * dynamically to fill in the structure's members.
+ */
+static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, const uint8_t ucQueueType, Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Mutexes are a special type of queue.  When a mutex is created, first the
+ * queue is created, then prvInitialiseMutex() is called to configure the queue
+ * as a mutex.
+ */
+#if( configUSE_MUTEXES == 1 )
+	static void prvInitialiseMutex( Queue_t *pxNewQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+#if( configUSE_FAST_MUTEXES == 1 )
+	/*
+	 * The paths taken by xQueueGenericReceive() and xQueueGenericSend() when a
+	 * mutex cannot be taken or given with a single compare and swap - because
+	 * another task holds the mutex, or because a task has blocked on it.
+	 */
+	static BaseType_t prvTakeContendedMutex( Queue_t * const pxMutex, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+	static BaseType_t prvGiveContendedMutex( Queue_t * const pxMutex ) PRIVILEGED_FUNCTION;
+#endif
+
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+
+	/* A queue set holds a list of the members that contain data in place of
+	the handles of the members that data has been sent to, so its storage area
+	holds the list and its message count is the number of ready members. */
+	#define queueSET_READY_MEMBERS( pxQueueSet ) ( ( List_t * ) ( pxQueueSet )->pcHead )
+
+	/* Called each time an item is removed from a queue. */
+	#define queueUPDATE_READY_MEMBER( pxQueue ) prvUpdateReadyMember( ( pxQueue ) )
+
+#else
+
+	#define queueUPDATE_READY_MEMBER( pxQueue )
+
+#endif /* configUSE_QUEUE_SET_READY_LIST */
 /*-----------------------------------------------------------*/
 
 /*
@@ -267,6 +393,13 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		pxQueue->xRxLock = queueUNLOCKED;
 		pxQueue->xTxLock = queueUNLOCKED;
 
+		#if( configUSE_QUEUE_ZERO_COPY == 1 )
+		{
+			pxQueue->xSlotReserved = pdFALSE;
+			pxQueue->xReferenceHeld = pdFALSE;
+		}
+		#endif
+
 		if( xNewQueue == pdFALSE )
 		{
 			/* If there are tasks blocked waiting to read from the queue, then
@@ -289,12 +422,37 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+
+			#if( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+			{
+				/* The queue is empty, so is not a ready member of a queue
+				set, and any items that had been selected have gone. */
+				pxQueue->uxItemsSelected = ( UBaseType_t ) 0U;
+
+				if( listLIST_ITEM_CONTAINER( &( pxQueue->xReadyMemberListItem ) ) != NULL )
+				{
+					pxQueue->pxQueueSetContainer->uxMessagesWaiting = uxListRemove( &( pxQueue->xReadyMemberListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
 		}
 		else
 		{
 			/* Ensure the event queues start in the correct state. */
 			vListInitialise( &( pxQueue->xTasksWaitingToSend ) );
 			vListInitialise( &( pxQueue->xTasksWaitingToReceive ) );
+
+			#if( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+			{
+				vListInitialiseItem( &( pxQueue->xReadyMemberListItem ) );
+				listSET_LIST_ITEM_OWNER( &( pxQueue->xReadyMemberListItem ), pxQueue );
+				pxQueue->uxItemsSelected = ( UBaseType_t ) 0U;
+			}
+			#endif
 		}
 	}
 	taskEXIT_CRITICAL();
@@ -305,129 +463,220 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 }
 /*-----------------------------------------------------------*/
 
-QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType )
-{
-Queue_t *pxNewQueue;
-size_t xQueueSizeInBytes;
-QueueHandle_t xReturn = NULL;
-
-	/* Remove compiler warnings about unused parameters should
-	configUSE_TRACE_FACILITY not be set to 1. */
-	( void ) ucQueueType;
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 
-	/* Allocate the new queue structure. */
-	if( uxQueueLength > ( UBaseType_t ) 0 )
+	QueueHandle_t xQueueGenericCreateStatic( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, StaticQueue_t *pxStaticQueue, const uint8_t ucQueueType )
 	{
-		pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) );
+	Queue_t *pxNewQueue;
+
+		configASSERT( uxQueueLength > ( UBaseType_t ) 0 );
+
+		/* The StaticQueue_t structure and the queue storage area must be
+		supplied. */
+		configASSERT( pxStaticQueue != NULL );
+
+		/* A queue storage area should be provided if the item size is not 0,
+		and should not be provided if the item size is 0. */
+		configASSERT( !( ( pucQueueStorage != NULL ) && ( uxItemSize == 0 ) ) );
+		configASSERT( !( ( pucQueueStorage == NULL ) && ( uxItemSize != 0 ) ) );
+
+		/* The StaticQueue_t structure must be exactly the same size as the real
+		queue structure, otherwise the application has been built with a
+		different configuration to the kernel. */
+		configASSERT( sizeof( StaticQueue_t ) == sizeof( Queue_t ) );
+
+		/* The address of a statically allocated queue was passed in, use it. */
+		pxNewQueue = ( Queue_t * ) pxStaticQueue; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+
 		if( pxNewQueue != NULL )
 		{
-			/* Create the list of pointers to queue items.  The queue is one byte
-			longer than asked for to make wrap checking easier/faster. */
-			xQueueSizeInBytes = ( size_t ) ( uxQueueLength * uxItemSize ) + ( size_t ) 1; /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-
-			pxNewQueue->pcHead = ( int8_t * ) pvPortMalloc( xQueueSizeInBytes );
-			if( pxNewQueue->pcHead != NULL )
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 			{
-				/* Initialise the queue members as described above where the
-				queue type is defined. */
-				pxNewQueue->uxLength = uxQueueLength;
-				pxNewQueue->uxItemSize = uxItemSize;
-				( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
+				/* Queues can be allocated either statically or dynamically, so
+				note this queue was allocated statically in case the queue is
+				later deleted. */
+				pxNewQueue->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 
-				#if ( configUSE_TRACE_FACILITY == 1 )
-				{
-					pxNewQueue->ucQueueType = ucQueueType;
-				}
-				#endif /* configUSE_TRACE_FACILITY */
+			prvInitialiseNewQueue( uxQueueLength, uxItemSize, pucQueueStorage, ucQueueType, pxNewQueue );
+		}
+		else
+		{
+			traceQUEUE_CREATE_FAILED( ucQueueType );
+		}
+
+		return pxNewQueue;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	QueueHandle_t xQueueGenericCreate( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, const uint8_t ucQueueType )
+	{
+	Queue_t *pxNewQueue = NULL;
+	size_t xQueueSizeInBytes;
+	uint8_t *pucQueueStorage;
 
-				#if( configUSE_QUEUE_SETS == 1 )
+		if( uxQueueLength > ( UBaseType_t ) 0 )
+		{
+			/* Allocate enough space to hold the maximum number of items that
+			can be in the queue at any time.  The structure and the storage
+			area are allocated in a single block so creating a queue costs one
+			heap operation, not two. */
+			xQueueSizeInBytes = ( size_t ) ( uxQueueLength * uxItemSize ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+			pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
+
+			if( pxNewQueue != NULL )
+			{
+				/* Jump past the queue structure to find the location of the
+				queue storage area. */
+				pucQueueStorage = ( ( uint8_t * ) pxNewQueue ) + sizeof( Queue_t );
+
+				#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 				{
-					pxNewQueue->pxQueueSetContainer = NULL;
+					/* Queues can be created either statically or dynamically,
+					so note this queue was created dynamically in case it is
+					later deleted. */
+					pxNewQueue->ucStaticallyAllocated = pdFALSE;
 				}
-				#endif /* configUSE_QUEUE_SETS */
+				#endif /* configSUPPORT_STATIC_ALLOCATION */
 
-				traceQUEUE_CREATE( pxNewQueue );
-				xReturn = pxNewQueue;
+				prvInitialiseNewQueue( uxQueueLength, uxItemSize, pucQueueStorage, ucQueueType, pxNewQueue );
 			}
 			else
 			{
 				traceQUEUE_CREATE_FAILED( ucQueueType );
-				vPortFree( pxNewQueue );
 			}
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		configASSERT( pxNewQueue );
+
+		return pxNewQueue;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseType_t uxItemSize, uint8_t *pucQueueStorage, const uint8_t ucQueueType, Queue_t *pxNewQueue )
+{
+	/* Remove compiler warnings about unused parameters should
+	configUSE_TRACE_FACILITY not be set to 1. */
+	( void ) ucQueueType;
+
+	if( uxItemSize == ( UBaseType_t ) 0 )
+	{
+		/* No storage area was allocated for the queue, but pcHead cannot be
+		set to NULL because NULL is used as a key to say the queue is used as
+		a mutex.  Therefore just set pcHead to point to the queue as a benign
+		value that is known to be within the memory map. */
+		pxNewQueue->pcHead = ( int8_t * ) pxNewQueue;
 	}
 	else
 	{
-		mtCOVERAGE_TEST_MARKER();
+		/* Set the head to the start of the queue storage area. */
+		pxNewQueue->pcHead = ( int8_t * ) pucQueueStorage;
 	}
 
-	configASSERT( xReturn );
+	/* Initialise the queue members as described where the queue type is
+	defined. */
+	pxNewQueue->uxLength = uxQueueLength;
+	pxNewQueue->uxItemSize = uxItemSize;
+	( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
-	return xReturn;
+	#if ( configUSE_TRACE_FACILITY == 1 )
+	{
+		pxNewQueue->ucQueueType = ucQueueType;
+	}
+	#endif /* configUSE_TRACE_FACILITY */
+
+	#if( configUSE_QUEUE_SETS == 1 )
+	{
+		pxNewQueue->pxQueueSetContainer = NULL;
+	}
+	#endif /* configUSE_QUEUE_SETS */
+
+	traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if( configUSE_MUTEXES == 1 )
 
-	QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType )
+	static void prvInitialiseMutex( Queue_t *pxNewQueue )
 	{
-	Queue_t *pxNewQueue;
-
-		/* Prevent compiler warnings about unused parameters if
-		configUSE_TRACE_FACILITY does not equal 1. */
-		( void ) ucQueueType;
-
-		/* Allocate the new queue structure. */
-		pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) );
 		if( pxNewQueue != NULL )
 		{
-			/* Information required for priority inheritance. */
+			/* The queue create function will set all the queue structure
+			members correctly for a generic queue, but this function is creating
+			a mutex.  Overwrite those members that need to be set differently -
+			in particular the information required for priority inheritance. */
 			pxNewQueue->pxMutexHolder = NULL;
 			pxNewQueue->uxQueueType = queueQUEUE_IS_MUTEX;
 
-			/* Queues used as a mutex no data is actually copied into or out
-			of the queue. */
-			pxNewQueue->pcWriteTo = NULL;
-			pxNewQueue->u.pcReadFrom = NULL;
+			/* In case this is a recursive mutex. */
+			pxNewQueue->u.uxRecursiveCallCount = 0;
 
-			/* Each mutex has a length of 1 (like a binary semaphore) and
-			an item size of 0 as nothing is actually copied into or out
-			of the mutex. */
-			pxNewQueue->uxMessagesWaiting = ( UBaseType_t ) 0U;
-			pxNewQueue->uxLength = ( UBaseType_t ) 1U;
-			pxNewQueue->uxItemSize = ( UBaseType_t ) 0U;
-			pxNewQueue->xRxLock = queueUNLOCKED;
-			pxNewQueue->xTxLock = queueUNLOCKED;
+			traceCREATE_MUTEX( pxNewQueue );
 
-			#if ( configUSE_TRACE_FACILITY == 1 )
+			/* Start with the semaphore in the expected state. */
+			#if( configUSE_FAST_MUTEXES == 1 )
 			{
-				pxNewQueue->ucQueueType = ucQueueType;
-			}
-			#endif
+				/* The owner word holds a task handle. */
+				configASSERT( sizeof( UBaseType_t ) >= sizeof( TaskHandle_t ) );
 
-			#if ( configUSE_QUEUE_SETS == 1 )
+				pxNewQueue->uxMutexOwner = ( UBaseType_t ) 0;
+				pxNewQueue->uxMessagesWaiting = ( UBaseType_t ) 1;
+			}
+			#else
 			{
-				pxNewQueue->pxQueueSetContainer = NULL;
+				( void ) xQueueGenericSend( pxNewQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
 			}
-			#endif
-
-			/* Ensure the event queues start with the correct state. */
-			vListInitialise( &( pxNewQueue->xTasksWaitingToSend ) );
-			vListInitialise( &( pxNewQueue->xTasksWaitingToReceive ) );
-
-			traceCREATE_MUTEX( pxNewQueue );
-
-			/* Start with the semaphore in the expected state. */
-			( void ) xQueueGenericSend( pxNewQueue, NULL, ( TickType_t ) 0U, queueSEND_TO_BACK );
+			#endif /* configUSE_FAST_MUTEXES */
 		}
 		else
 		{
 			traceCREATE_MUTEX_FAILED();
 		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType )
+	{
+	Queue_t *pxNewQueue;
+	const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+		/* Each mutex has a length of 1 (like a binary semaphore) and an item
+		size of 0 as nothing is actually copied into or out of the mutex. */
+		pxNewQueue = ( Queue_t * ) xQueueGenericCreate( uxMutexLength, uxMutexSize, ucQueueType );
+		prvInitialiseMutex( pxNewQueue );
+
+		configASSERT( pxNewQueue );
+		return pxNewQueue;
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue )
+	{
+	Queue_t *pxNewQueue;
+	const UBaseType_t uxMutexLength = ( UBaseType_t ) 1, uxMutexSize = ( UBaseType_t ) 0;
+
+		pxNewQueue = ( Queue_t * ) xQueueGenericCreateStatic( uxMutexLength, uxMutexSize, NULL, pxStaticQueue, ucQueueType );
+		prvInitialiseMutex( pxNewQueue );
 
 		configASSERT( pxNewQueue );
 		return pxNewQueue;
@@ -561,113 +810,417 @@ QueueHandle_t xReturn = NULL;
 #endif /* configUSE_RECURSIVE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_COUNTING_SEMAPHORES == 1 )
+#if( configUSE_FAST_MUTEXES == 1 )
 
-	QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount )
+	static BaseType_t prvTakeContendedMutex( Queue_t * const pxMutex, TickType_t xTicksToWait )
 	{
-	QueueHandle_t xHandle;
-
-		configASSERT( uxMaxCount != 0 );
-		configASSERT( uxInitialCount <= uxMaxCount );
-
-		xHandle = xQueueGenericCreate( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
-
-		if( xHandle != NULL )
-		{
-			( ( Queue_t * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+	const UBaseType_t uxCurrentTask = ( UBaseType_t ) xTaskGetCurrentTaskHandle(); /*lint !e923 The handle is only used as a value. */
+	UBaseType_t uxOwner, uxNewOwner;
+	BaseType_t xReturn = errQUEUE_EMPTY, xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
 
-			traceCREATE_COUNTING_SEMAPHORE();
-		}
-		else
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 		{
-			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
 		}
+		#endif
 
-		configASSERT( xHandle );
-		return xHandle;
-	}
-
-#endif /* configUSE_COUNTING_SEMAPHORES */
-/*-----------------------------------------------------------*/
-
-BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition )
-{
-BaseType_t xEntryTimeSet = pdFALSE;
-TimeOut_t xTimeOut;
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
-
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
-	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
-	{
-		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
-	}
-	#endif
-
-
-	/* This function relaxes the coding standard somewhat to allow return
-	statements within the function itself.  This is done in the interest
-	of execution time efficiency. */
-	for( ;; )
-	{
-		taskENTER_CRITICAL();
+		#if( configFAST_MUTEX_SPIN_COUNT > 0 )
 		{
-			/* Is there room on the queue now?  The running task must be
-			the highest priority task wanting to access the queue.  If
-			the head item in the queue is to be overwritten then it does
-			not matter if the queue is full. */
-			if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
-			{
-				traceQUEUE_SEND( pxQueue );
-				prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+		UBaseType_t uxSpin;
 
-				#if ( configUSE_QUEUE_SETS == 1 )
+			/* The holder cannot give the mutex back while this task spins on
+			a single core, so instead of spinning this task yields, which lets
+			a holder of the same priority finish with the mutex.  That is much
+			cheaper than blocking if the mutex is only held briefly. */
+			if( ( xTicksToWait != ( TickType_t ) 0 ) && ( uxCurrentTask != ( UBaseType_t ) 0 ) )
+			{
+				for( uxSpin = ( UBaseType_t ) 0; uxSpin < ( UBaseType_t ) configFAST_MUTEX_SPIN_COUNT; uxSpin++ )
 				{
-					if( pxQueue->pxQueueSetContainer != NULL )
+					taskYIELD();
+
+					if( ( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToReceive ) ) != pdFALSE ) &&
+						( portCOMPARE_AND_SWAP( &( pxMutex->uxMutexOwner ), ( UBaseType_t ) 0, uxCurrentTask ) != pdFALSE ) )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) == pdTRUE )
-						{
-							/* The queue is a member of a queue set, and posting
-							to the queue set caused a higher priority task to
-							unblock. A context switch is required. */
-							queueYIELD_IF_USING_PREEMPTION();
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						pxMutex->pxMutexHolder = ( int8_t * ) uxCurrentTask; /*lint !e923 Cast back to the handle. */
+						pxMutex->uxMessagesWaiting = ( UBaseType_t ) 0;
+						traceQUEUE_RECEIVE( pxMutex );
+						return pdPASS;
 					}
 					else
 					{
-						/* If there was a task waiting for data to arrive on the
-						queue then unblock it now. */
-						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
-						{
-							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) == pdTRUE )
-							{
-								/* The unblocked task has a priority higher than
-								our own so yield immediately.  Yes it is ok to
-								do this from within the critical section - the
-								kernel takes care of that. */
-								queueYIELD_IF_USING_PREEMPTION();
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
+						mtCOVERAGE_TEST_MARKER();
 					}
 				}
-				#else /* configUSE_QUEUE_SETS */
-				{
-					/* If there was a task waiting for data to arrive on the
-					queue then unblock it now. */
-					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configFAST_MUTEX_SPIN_COUNT */
+
+		/* Mutexes cannot be used from interrupts, so the owner word and the
+		list of waiting tasks cannot change while the scheduler is suspended.
+		The owner word is still only changed by compare and swap in case a
+		port runs tasks on more than one core. */
+		vTaskSuspendAll();
+
+		for( ;; )
+		{
+			uxOwner = pxMutex->uxMutexOwner;
+
+			if( uxOwner == ( UBaseType_t ) 0 )
+			{
+				/* The mutex is free.  If other tasks are still waiting then
+				this task must give the mutex back the slow way too, so it can
+				unblock the next of them.  So must the caller if it is not a
+				task, as otherwise the owner word would still read as free. */
+				if( ( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToReceive ) ) == pdFALSE ) || ( uxCurrentTask == ( UBaseType_t ) 0 ) )
+				{
+					uxNewOwner = uxCurrentTask | queueMUTEX_HAS_WAITERS;
+				}
+				else
+				{
+					uxNewOwner = uxCurrentTask;
+				}
+
+				if( portCOMPARE_AND_SWAP( &( pxMutex->uxMutexOwner ), uxOwner, uxNewOwner ) != pdFALSE )
+				{
+					pxMutex->pxMutexHolder = ( int8_t * ) uxCurrentTask; /*lint !e923 Cast back to the handle. */
+					pxMutex->uxMessagesWaiting = ( UBaseType_t ) 0;
+					traceQUEUE_RECEIVE( pxMutex );
+					xReturn = pdPASS;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* The mutex is held and no block time was specified (or the
+				block time has expired). */
+				traceQUEUE_RECEIVE_FAILED( pxMutex );
+				break;
+			}
+			else
+			{
+				if( xEntryTimeSet == pdFALSE )
+				{
+					vTaskSetTimeOutState( &xTimeOut );
+					xEntryTimeSet = pdTRUE;
+				}
+				else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+				{
+					/* If other tasks are still waiting then the waiting flag
+					is already set, as it is only cleared when the mutex is
+					given. */
+					traceQUEUE_RECEIVE_FAILED( pxMutex );
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Flag that a task is waiting, so the holder gives the mutex
+				back the slow way, then block - the holder inheriting this
+				task's priority in the mean time. */
+				if( portCOMPARE_AND_SWAP( &( pxMutex->uxMutexOwner ), uxOwner, uxOwner | queueMUTEX_HAS_WAITERS ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxMutex );
+
+					taskENTER_CRITICAL();
+					{
+						vTaskPriorityInherit( ( TaskHandle_t ) ( uxOwner & ~queueMUTEX_HAS_WAITERS ) ); /*lint !e923 Cast back to the handle. */
+					}
+					taskEXIT_CRITICAL();
+
+					vTaskPlaceOnEventList( &( pxMutex->xTasksWaitingToReceive ), xTicksToWait );
+
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* The task was unblocked because the mutex was given or
+					because the block time expired - try again. */
+					vTaskSuspendAll();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+		}
+
+		( void ) xTaskResumeAll();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_FAST_MUTEXES == 1 )
+
+	static BaseType_t prvGiveContendedMutex( Queue_t * const pxMutex )
+	{
+	const UBaseType_t uxCurrentTask = ( UBaseType_t ) xTaskGetCurrentTaskHandle(); /*lint !e923 The handle is only used as a value. */
+	BaseType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* Only the holder can give a mutex. */
+			if( ( pxMutex->uxMutexOwner != ( UBaseType_t ) 0 ) && ( ( pxMutex->uxMutexOwner & ~queueMUTEX_HAS_WAITERS ) == uxCurrentTask ) )
+			{
+				traceQUEUE_SEND( pxMutex );
+
+				pxMutex->pxMutexHolder = NULL;
+				pxMutex->uxMessagesWaiting = ( UBaseType_t ) 1;
+				pxMutex->uxMutexOwner = ( UBaseType_t ) 0;
+
+				/* A task has blocked on the mutex, so this task might have
+				inherited its priority. */
+				vTaskPriorityDisinherit( ( TaskHandle_t ) uxCurrentTask ); /*lint !e923 Cast back to the handle. */
+
+				/* Unblock the highest priority waiting task, which takes the
+				mutex when it runs.  The others remain blocked, and the
+				waiting flag is set again when the mutex is taken. */
+				if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToReceive ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxMutex->xTasksWaitingToReceive ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				traceQUEUE_SEND_FAILED( pxMutex );
+				xReturn = errQUEUE_FULL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_FAST_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount )
+	{
+	QueueHandle_t xHandle;
+
+		configASSERT( uxMaxCount != 0 );
+		configASSERT( uxInitialCount <= uxMaxCount );
+
+		xHandle = xQueueGenericCreate( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+
+		if( xHandle != NULL )
+		{
+			( ( Queue_t * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+
+			traceCREATE_COUNTING_SEMAPHORE();
+		}
+		else
+		{
+			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+		}
+
+		configASSERT( xHandle );
+		return xHandle;
+	}
+
+#endif /* ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue )
+	{
+	QueueHandle_t xHandle;
+
+		configASSERT( uxMaxCount != 0 );
+		configASSERT( uxInitialCount <= uxMaxCount );
+
+		xHandle = xQueueGenericCreateStatic( uxMaxCount, queueSEMAPHORE_QUEUE_ITEM_LENGTH, NULL, pxStaticQueue, queueQUEUE_TYPE_COUNTING_SEMAPHORE );
+
+		if( xHandle != NULL )
+		{
+			( ( Queue_t * ) xHandle )->uxMessagesWaiting = uxInitialCount;
+
+			traceCREATE_COUNTING_SEMAPHORE();
+		}
+		else
+		{
+			traceCREATE_COUNTING_SEMAPHORE_FAILED();
+		}
+
+		configASSERT( xHandle );
+		return xHandle;
+	}
+
+#endif /* ( ( configUSE_COUNTING_SEMAPHORES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueueGenericSend( QueueHandle_t xQueue, const void * const pvItemToQueue, TickType_t xTicksToWait, const BaseType_t xCopyPosition )
+{
+BaseType_t xEntryTimeSet = pdFALSE;
+TimeOut_t xTimeOut;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+
+	#if( configUSE_FAST_MUTEXES == 1 )
+	{
+		if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+		{
+		const UBaseType_t uxCurrentTask = ( UBaseType_t ) xTaskGetCurrentTaskHandle(); /*lint !e923 The handle is only used as a value. */
+
+			/* If no task has blocked on the mutex since it was taken then no
+			task needs unblocking and no priority was inherited, so the mutex
+			can be given back by clearing the owner word.  The members that
+			follow the owner word are updated first, as the mutex can be taken
+			by another task as soon as the owner word is cleared. */
+			if( ( uxCurrentTask != ( UBaseType_t ) 0 ) && ( pxQueue->uxMutexOwner == uxCurrentTask ) )
+			{
+				pxQueue->pxMutexHolder = NULL;
+				pxQueue->uxMessagesWaiting = ( UBaseType_t ) 1;
+
+				if( portCOMPARE_AND_SWAP( &( pxQueue->uxMutexOwner ), uxCurrentTask, ( UBaseType_t ) 0 ) != pdFALSE )
+				{
+					traceQUEUE_SEND( pxQueue );
+					return pdPASS;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return prvGiveContendedMutex( pxQueue );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_FAST_MUTEXES */
+
+	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+	configASSERT( !( ( xCopyPosition == queueRESERVE ) && ( pxQueue->uxItemSize == ( UBaseType_t ) 0U ) ) );
+	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+	{
+		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+	}
+	#endif
+
+
+	/* This function relaxes the coding standard somewhat to allow return
+	statements within the function itself.  This is done in the interest
+	of execution time efficiency. */
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			/* Is there room on the queue now?  The running task must be
+			the highest priority task wanting to access the queue.  If
+			the head item in the queue is to be overwritten then it does
+			not matter if the queue is full. */
+			if( prvCanSendToQueue( pxQueue, xCopyPosition ) != pdFALSE )
+			{
+				#if( configUSE_QUEUE_ZERO_COPY == 1 )
+				{
+					if( xCopyPosition == queueRESERVE )
+					{
+						/* Nothing is added to the queue until the slot is
+						committed, so there are no tasks to unblock. */
+						pxQueue->xSlotReserved = pdTRUE;
+						*( ( void ** ) pvItemToQueue ) = ( void * ) pxQueue->pcWriteTo;
+						taskEXIT_CRITICAL();
+						return pdPASS;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_QUEUE_ZERO_COPY */
+
+				traceQUEUE_SEND( pxQueue );
+				prvCopyDataToQueue( pxQueue, pvItemToQueue, xCopyPosition );
+
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+					if( pxQueue->pxQueueSetContainer != NULL )
+					{
+						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) == pdTRUE )
+						{
+							/* The queue is a member of a queue set, and posting
+							to the queue set caused a higher priority task to
+							unblock. A context switch is required. */
+							queueYIELD_IF_USING_PREEMPTION();
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						/* If there was a task waiting for data to arrive on the
+						queue then unblock it now. */
+						if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+						{
+							if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) == pdTRUE )
+							{
+								/* The unblocked task has a priority higher than
+								our own so yield immediately.  Yes it is ok to
+								do this from within the critical section - the
+								kernel takes care of that. */
+								queueYIELD_IF_USING_PREEMPTION();
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+				}
+				#else /* configUSE_QUEUE_SETS */
+				{
+					/* If there was a task waiting for data to arrive on the
+					queue then unblock it now. */
+					if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
 					{
 						if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) == pdTRUE )
 						{
@@ -733,7 +1286,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		/* Update the timeout state to see if it has expired yet. */
 		if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 		{
-			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
 			{
 				traceBLOCKING_ON_QUEUE_SEND( pxQueue );
 				vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
@@ -842,7 +1395,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 			{
 				if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
 				{
-					if( prvIsQueueFull( pxQueue ) != pdFALSE )
+					if( prvIsQueueFull( pxQueue, xCopyPosition ) != pdFALSE )
 					{
 						traceBLOCKING_ON_QUEUE_SEND( pxQueue );
 						vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
@@ -896,6 +1449,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 						/* Data is actually being removed (not just peeked). */
 						--( pxQueue->uxMessagesWaiting );
+						queueUPDATE_READY_MEMBER( pxQueue );
 
 						#if ( configUSE_MUTEXES == 1 )
 						{
@@ -1031,6 +1585,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	configASSERT( pxQueue );
 	configASSERT( !( ( pvItemToQueue == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
 	configASSERT( !( ( xCopyPosition == queueOVERWRITE ) && ( pxQueue->uxLength != 1 ) ) );
+	configASSERT( !( ( xCopyPosition == queueRESERVE ) && ( pxQueue->uxItemSize == ( UBaseType_t ) 0U ) ) );
 
 	/* RTOS ports that support interrupt nesting have the concept of a maximum
 	system call (or maximum API call) interrupt priority.  Interrupts that are
@@ -1055,7 +1610,22 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	post). */
 	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
 	{
-		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
+		if( prvCanSendToQueue( pxQueue, xCopyPosition ) == pdFALSE )
+		{
+			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+			xReturn = errQUEUE_FULL;
+		}
+		#if( configUSE_QUEUE_ZERO_COPY == 1 )
+			else if( xCopyPosition == queueRESERVE )
+			{
+				/* Nothing is added to the queue until the slot is committed,
+				so there are no tasks to unblock. */
+				pxQueue->xSlotReserved = pdTRUE;
+				*( ( void ** ) pvItemToQueue ) = ( void * ) pxQueue->pcWriteTo;
+				xReturn = pdPASS;
+			}
+		#endif /* configUSE_QUEUE_ZERO_COPY */
+		else
 		{
 			traceQUEUE_SEND_FROM_ISR( pxQueue );
 
@@ -1154,11 +1724,6 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 			xReturn = pdPASS;
 		}
-		else
-		{
-			traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
-			xReturn = errQUEUE_FULL;
-		}
 	}
 	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
@@ -1174,7 +1739,52 @@ int8_t *pcOriginalReadPosition;
 Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 	configASSERT( pxQueue );
+
+	#if( configUSE_FAST_MUTEXES == 1 )
+	{
+		if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
+		{
+		const UBaseType_t uxCurrentTask = ( UBaseType_t ) xTaskGetCurrentTaskHandle(); /*lint !e923 The handle is only used as a value. */
+
+			/* A mutex cannot be peeked. */
+			configASSERT( xJustPeeking == pdFALSE );
+
+			/* If the mutex is free and no task is waiting for it then it can
+			be taken by writing the owner word, without entering a critical
+			section.  While tasks are waiting the mutex is taken the slow way,
+			so the waiting flag is carried over to the new owner.  Before any
+			task has been created there is no handle to write, so the mutex is
+			taken the slow way then too. */
+			if( ( uxCurrentTask != ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE ) )
+			{
+				if( portCOMPARE_AND_SWAP( &( pxQueue->uxMutexOwner ), ( UBaseType_t ) 0, uxCurrentTask ) != pdFALSE )
+				{
+					pxQueue->pxMutexHolder = ( int8_t * ) uxCurrentTask; /*lint !e923 Cast back to the handle. */
+					pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0;
+					traceQUEUE_RECEIVE( pxQueue );
+					return pdPASS;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return prvTakeContendedMutex( pxQueue, xTicksToWait );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configUSE_FAST_MUTEXES */
+
 	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+	configASSERT( !( ( ( xJustPeeking == queueRECEIVE_REFERENCE ) || ( xJustPeeking == queuePEEK_REFERENCE ) ) && ( pxQueue->uxItemSize == ( UBaseType_t ) 0U ) ) );
 	#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
 	{
 		configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
@@ -1191,8 +1801,41 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		{
 			/* Is there data in the queue now?  To be running we must be
 			the highest priority task wanting to access the queue. */
-			if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+			if( prvCanReceiveFromQueue( pxQueue ) != pdFALSE )
 			{
+				#if( configUSE_QUEUE_ZERO_COPY == 1 )
+				{
+					if( ( xJustPeeking == queueRECEIVE_REFERENCE ) || ( xJustPeeking == queuePEEK_REFERENCE ) )
+					{
+						/* The slot holding the item cannot be written until
+						the reference is released, so there are no tasks to
+						unblock. */
+						if( xJustPeeking == queueRECEIVE_REFERENCE )
+						{
+							traceQUEUE_RECEIVE( pxQueue );
+							*( ( void ** ) pvBuffer ) = ( void * ) prvReferenceNextItem( pxQueue );
+							--( pxQueue->uxMessagesWaiting );
+							queueUPDATE_READY_MEMBER( pxQueue );
+						}
+						else
+						{
+							traceQUEUE_PEEK( pxQueue );
+							pcOriginalReadPosition = pxQueue->u.pcReadFrom;
+							*( ( void ** ) pvBuffer ) = ( void * ) prvReferenceNextItem( pxQueue );
+							pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+						}
+
+						pxQueue->xReferenceHeld = xJustPeeking;
+						taskEXIT_CRITICAL();
+						return pdPASS;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_QUEUE_ZERO_COPY */
+
 				/* Remember the read position in case the queue is only being
 				peeked. */
 				pcOriginalReadPosition = pxQueue->u.pcReadFrom;
@@ -1205,6 +1848,7 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
 					/* Actually removing data, not just peeking. */
 					--( pxQueue->uxMessagesWaiting );
+					queueUPDATE_READY_MEMBER( pxQueue );
 
 					#if ( configUSE_MUTEXES == 1 )
 					{
@@ -1380,28 +2024,334 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
 	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so check there is data available. */
+		if( prvCanReceiveFromQueue( pxQueue ) != pdFALSE )
+		{
+			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			--( pxQueue->uxMessagesWaiting );
+			queueUPDATE_READY_MEMBER( pxQueue );
+
+			/* If the queue is locked the event list will not be modified.
+			Instead update the lock count so the task that unlocks the queue
+			will know that an ISR has removed data while the queue was
+			locked. */
+			if( pxQueue->xRxLock == queueUNLOCKED )
+			{
+				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						/* The task waiting has a higher priority than us so
+						force a context switch. */
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* Increment the lock count so the task that unlocks the queue
+				knows that data was removed while it was locked. */
+				++( pxQueue->xRxLock );
+			}
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
+{
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+int8_t *pcOriginalReadPosition;
+Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+	configASSERT( pxQueue );
+	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+	/* RTOS ports that support interrupt nesting have the concept of a maximum
+	system call (or maximum API call) interrupt priority.  Interrupts that are
+	above the maximum system call priority are kept permanently enabled, even
+	when the RTOS kernel is in a critical section, but cannot make any calls to
+	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+	failure if a FreeRTOS API function is called from an interrupt that has been
+	assigned a priority above the configured maximum system call priority.
+	Only FreeRTOS functions that end in FromISR can be called from interrupts
+	that have been assigned a priority at or (logically) below the maximum
+	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
+	safe API to ensure interrupt entry is as fast and as simple as possible.
+	More information (albeit Cortex-M specific) is provided on the following
+	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Cannot block in an ISR, so check there is data available. */
+		if( prvCanReceiveFromQueue( pxQueue ) != pdFALSE )
+		{
+			traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+			/* Remember the read position so it can be reset as nothing is
+			actually being removed from the queue. */
+			pcOriginalReadPosition = pxQueue->u.pcReadFrom;
+			prvCopyDataFromQueue( pxQueue, pvBuffer );
+			pxQueue->u.pcReadFrom = pcOriginalReadPosition;
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	BaseType_t xQueueCommit( QueueHandle_t xQueue )
+	{
+	BaseType_t xReturn;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			if( pxQueue->xSlotReserved != pdFALSE )
+			{
+				traceQUEUE_SEND( pxQueue );
+				prvCommitReservedSlot( pxQueue );
+
+				if( prvUnblockZeroCopyWaiters( pxQueue, pdTRUE ) != pdFALSE )
+				{
+					/* Yes it is ok to do this from within the critical section
+					- the kernel takes care of that. */
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	BaseType_t xQueueCommitFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	BaseType_t xReturn;
+	UBaseType_t uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		/* See the comments in xQueueGenericSendFromISR(). */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pxQueue->xSlotReserved != pdFALSE )
+			{
+				traceQUEUE_SEND_FROM_ISR( pxQueue );
+				prvCommitReservedSlot( pxQueue );
+
+				if( pxQueue->xTxLock == queueUNLOCKED )
+				{
+					if( prvUnblockZeroCopyWaiters( pxQueue, pdTRUE ) != pdFALSE )
+					{
+						if( pxHigherPriorityTaskWoken != NULL )
+						{
+							*pxHigherPriorityTaskWoken = pdTRUE;
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Increment the lock counts so the task that unlocks the
+					queue knows that data was posted, and that a task waiting
+					for the reservation to end may be able to send, while it
+					was locked. */
+					++( pxQueue->xTxLock );
+					++( pxQueue->xRxLock );
+				}
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	BaseType_t xQueueReceiveReferenceFromISR( QueueHandle_t xQueue, void ** const ppvItem )
+	{
+	BaseType_t xReturn;
+	UBaseType_t uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+		configASSERT( ppvItem );
+		configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+		/* See the comments in xQueueGenericSendFromISR(). */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( prvCanReceiveFromQueue( pxQueue ) != pdFALSE )
+			{
+				traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+				/* The slot holding the item cannot be written until the
+				reference is released, so there are no tasks to unblock. */
+				*ppvItem = ( void * ) prvReferenceNextItem( pxQueue );
+				--( pxQueue->uxMessagesWaiting );
+				queueUPDATE_READY_MEMBER( pxQueue );
+				pxQueue->xReferenceHeld = queueRECEIVE_REFERENCE;
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+				traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	BaseType_t xQueueReleaseReference( QueueHandle_t xQueue )
+	{
+	BaseType_t xReturn;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
+
+		configASSERT( pxQueue );
+
+		taskENTER_CRITICAL();
+		{
+			if( pxQueue->xReferenceHeld != pdFALSE )
+			{
+				/* If the item was received its slot is now free. */
+				pxQueue->xReferenceHeld = pdFALSE;
+
+				if( prvUnblockZeroCopyWaiters( pxQueue, pdFALSE ) != pdFALSE )
+				{
+					queueYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	BaseType_t xQueueReleaseReferenceFromISR( QueueHandle_t xQueue, BaseType_t * const pxHigherPriorityTaskWoken )
 	{
-		/* Cannot block in an ISR, so check there is data available. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
-		{
-			traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+	BaseType_t xReturn;
+	UBaseType_t uxSavedInterruptStatus;
+	Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			--( pxQueue->uxMessagesWaiting );
+		configASSERT( pxQueue );
 
-			/* If the queue is locked the event list will not be modified.
-			Instead update the lock count so the task that unlocks the queue
-			will know that an ISR has removed data while the queue was
-			locked. */
-			if( pxQueue->xRxLock == queueUNLOCKED )
+		/* See the comments in xQueueGenericSendFromISR(). */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pxQueue->xReferenceHeld != pdFALSE )
 			{
-				if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+				pxQueue->xReferenceHeld = pdFALSE;
+
+				if( pxQueue->xRxLock == queueUNLOCKED )
 				{
-					if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+					if( prvUnblockZeroCopyWaiters( pxQueue, pdFALSE ) != pdFALSE )
 					{
-						/* The task waiting has a higher priority than us so
-						force a context switch. */
 						if( pxHigherPriorityTaskWoken != NULL )
 						{
 							*pxHigherPriorityTaskWoken = pdTRUE;
@@ -1418,81 +2368,47 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					/* Increment the lock count so the task that unlocks the
+					queue knows that space may have become available while it
+					was locked. */
+					++( pxQueue->xRxLock );
+
+					#if ( configUSE_QUEUE_SETS == 1 )
+					{
+						/* The Tx lock count of a queue in a set is used to
+						post to the set, which must only be done when an item
+						is added.  Tasks do not block on a queue in a set. */
+						if( pxQueue->pxQueueSetContainer == NULL )
+						{
+							++( pxQueue->xTxLock );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#else
+					{
+						/* So a task waiting for the reference to be released
+						is unblocked when the queue is unlocked. */
+						++( pxQueue->xTxLock );
+					}
+					#endif /* configUSE_QUEUE_SETS */
 				}
+
+				xReturn = pdPASS;
 			}
 			else
 			{
-				/* Increment the lock count so the task that unlocks the queue
-				knows that data was removed while it was locked. */
-				++( pxQueue->xRxLock );
+				xReturn = pdFAIL;
 			}
-
-			xReturn = pdPASS;
-		}
-		else
-		{
-			xReturn = pdFAIL;
-			traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
 		}
-	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
-
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,  void * const pvBuffer )
-{
-BaseType_t xReturn;
-UBaseType_t uxSavedInterruptStatus;
-int8_t *pcOriginalReadPosition;
-Queue_t * const pxQueue = ( Queue_t * ) xQueue;
-
-	configASSERT( pxQueue );
-	configASSERT( !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-
-	/* RTOS ports that support interrupt nesting have the concept of a maximum
-	system call (or maximum API call) interrupt priority.  Interrupts that are
-	above the maximum system call priority are kept permanently enabled, even
-	when the RTOS kernel is in a critical section, but cannot make any calls to
-	FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-	then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-	failure if a FreeRTOS API function is called from an interrupt that has been
-	assigned a priority above the configured maximum system call priority.
-	Only FreeRTOS functions that end in FromISR can be called from interrupts
-	that have been assigned a priority at or (logically) below the maximum
-	system call	interrupt priority.  FreeRTOS maintains a separate interrupt
-	safe API to ensure interrupt entry is as fast and as simple as possible.
-	More information (albeit Cortex-M specific) is provided on the following
-	link: http://www.freertos.org/RTOS-Cortex-M3-M4.html */
-	portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
-
-	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
-	{
-		/* Cannot block in an ISR, so check there is data available. */
-		if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
-		{
-			traceQUEUE_PEEK_FROM_ISR( pxQueue );
-
-			/* Remember the read position so it can be reset as nothing is
-			actually being removed from the queue. */
-			pcOriginalReadPosition = pxQueue->u.pcReadFrom;
-			prvCopyDataFromQueue( pxQueue, pvBuffer );
-			pxQueue->u.pcReadFrom = pcOriginalReadPosition;
-
-			xReturn = pdPASS;
-		}
-		else
-		{
-			xReturn = pdFAIL;
-			traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
-		}
+		return xReturn;
 	}
-	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
 
-	return xReturn;
-}
+#endif /* configUSE_QUEUE_ZERO_COPY */
 /*-----------------------------------------------------------*/
 
 UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
@@ -1522,6 +2438,30 @@ Queue_t *pxQueue;
 	taskENTER_CRITICAL();
 	{
 		uxReturn = pxQueue->uxLength - pxQueue->uxMessagesWaiting;
+
+		#if( configUSE_QUEUE_ZERO_COPY == 1 )
+		{
+			/* Neither a reserved slot nor the slot of an item received by
+			reference can be written. */
+			if( pxQueue->xSlotReserved != pdFALSE )
+			{
+				--uxReturn;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( pxQueue->xReferenceHeld == queueRECEIVE_REFERENCE )
+			{
+				--uxReturn;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_QUEUE_ZERO_COPY */
 	}
 	taskEXIT_CRITICAL();
 
@@ -1553,11 +2493,51 @@ Queue_t * const pxQueue = ( Queue_t * ) xQueue;
 		vQueueUnregisterQueue( pxQueue );
 	}
 	#endif
-	if( pxQueue->pcHead != NULL )
+
+	#if( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+	{
+		/* A queue set must not be left holding a deleted member. */
+		taskENTER_CRITICAL();
+		{
+			if( listLIST_ITEM_CONTAINER( &( pxQueue->xReadyMemberListItem ) ) != NULL )
+			{
+				pxQueue->pxQueueSetContainer->uxMessagesWaiting = uxListRemove( &( pxQueue->xReadyMemberListItem ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	#endif
+
+	#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+	{
+		/* The queue can only have been allocated dynamically - free it
+		again.  The storage area is part of the same block. */
+		vPortFree( pxQueue );
+	}
+	#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+	{
+		/* The queue could have been allocated statically or dynamically, so
+		check before attempting to free the memory. */
+		if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+		{
+			vPortFree( pxQueue );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
 	{
-		vPortFree( pxQueue->pcHead );
+		/* The queue must have been statically allocated, so is not going to be
+		deleted.  Avoid compiler warnings about the unused parameter. */
+		( void ) pxQueue;
 	}
-	vPortFree( pxQueue );
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 }
 /*-----------------------------------------------------------*/
 
@@ -1759,43 +2739,255 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 					break;
 				}
 			}
-			#endif /* configUSE_QUEUE_SETS */
+			#endif /* configUSE_QUEUE_SETS */
+
+			--( pxQueue->xTxLock );
+		}
+
+		pxQueue->xTxLock = queueUNLOCKED;
+	}
+	taskEXIT_CRITICAL();
+
+	/* Do the same for the Rx lock. */
+	taskENTER_CRITICAL();
+	{
+		while( pxQueue->xRxLock > queueLOCKED_UNMODIFIED )
+		{
+			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			{
+				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+				{
+					vTaskMissedYield();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				--( pxQueue->xRxLock );
+			}
+			else
+			{
+				break;
+			}
+		}
+
+		pxQueue->xRxLock = queueUNLOCKED;
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCanSendToQueue( const Queue_t *pxQueue, const BaseType_t xPosition )
+{
+BaseType_t xReturn;
+
+	#if( configUSE_QUEUE_ZERO_COPY == 1 )
+	{
+	UBaseType_t uxSlotsInUse = pxQueue->uxMessagesWaiting;
+
+		if( pxQueue->xSlotReserved != pdFALSE )
+		{
+			++uxSlotsInUse;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( pxQueue->xReferenceHeld == queueRECEIVE_REFERENCE )
+		{
+			++uxSlotsInUse;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( xPosition != queueSEND_TO_FRONT ) && ( pxQueue->xSlotReserved != pdFALSE ) )
+		{
+			/* An item sent to the back of the queue would be received before
+			the item being written into the reserved slot, and only one slot
+			can be reserved at a time.  The single item in a queue that is
+			overwritten cannot be overwritten while its slot is reserved. */
+			xReturn = pdFALSE;
+		}
+		else if( ( ( xPosition == queueSEND_TO_FRONT ) || ( xPosition == queueOVERWRITE ) ) && ( pxQueue->xReferenceHeld != pdFALSE ) )
+		{
+			/* Items are written to the front of the queue in the slot in front
+			of the next item to be received.  That is the slot of a received
+			item to which a reference is held, or of a peeked item if the
+			queue only holds one item. */
+			xReturn = pdFALSE;
+		}
+		else if( ( uxSlotsInUse < pxQueue->uxLength ) || ( xPosition == queueOVERWRITE ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	#else /* configUSE_QUEUE_ZERO_COPY */
+	{
+		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xPosition == queueOVERWRITE ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+	}
+	#endif /* configUSE_QUEUE_ZERO_COPY */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvCanReceiveFromQueue( const Queue_t *pxQueue )
+{
+BaseType_t xReturn;
+
+	if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+	{
+		xReturn = pdFALSE;
+	}
+	else
+	{
+		xReturn = pdTRUE;
+
+		#if( configUSE_QUEUE_ZERO_COPY == 1 )
+		{
+			/* While a reference is held the queue is treated as empty.  A
+			peeked item must not be removed, and the slot of a received item
+			must not be left in the middle of the free space, where it would
+			be overwritten. */
+			if( pxQueue->xReferenceHeld != pdFALSE )
+			{
+				xReturn = pdFALSE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_QUEUE_ZERO_COPY */
+	}
 
-			--( pxQueue->xTxLock );
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	static void prvCommitReservedSlot( Queue_t * const pxQueue )
+	{
+		/* The item has already been written into the slot pcWriteTo points
+		to, so only the write position and the item count need updating. */
+		pxQueue->pcWriteTo += pxQueue->uxItemSize;
+		if( pxQueue->pcWriteTo >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as comparison of pointers is the cleanest solution. */
+		{
+			pxQueue->pcWriteTo = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
 
-		pxQueue->xTxLock = queueUNLOCKED;
+		++( pxQueue->uxMessagesWaiting );
+		pxQueue->xSlotReserved = pdFALSE;
 	}
-	taskEXIT_CRITICAL();
 
-	/* Do the same for the Rx lock. */
-	taskENTER_CRITICAL();
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	static int8_t *prvReferenceNextItem( Queue_t * const pxQueue )
 	{
-		while( pxQueue->xRxLock > queueLOCKED_UNMODIFIED )
+		/* As prvCopyDataFromQueue(), but returns the location of the item
+		instead of copying it. */
+		pxQueue->u.pcReadFrom += pxQueue->uxItemSize;
+		if( pxQueue->u.pcReadFrom >= pxQueue->pcTail ) /*lint !e946 MISRA exception justified as use of the relational operator is the cleanest solutions. */
 		{
-			if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+			pxQueue->u.pcReadFrom = pxQueue->pcHead;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxQueue->u.pcReadFrom;
+	}
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_QUEUE_ZERO_COPY == 1 )
+
+	static BaseType_t prvUnblockZeroCopyWaiters( Queue_t * const pxQueue, const BaseType_t xItemAdded )
+	{
+	BaseType_t xReturn = pdFALSE;
+
+		#if ( configUSE_QUEUE_SETS == 1 )
+		{
+			if( ( xItemAdded != pdFALSE ) && ( pxQueue->pxQueueSetContainer != NULL ) )
 			{
-				if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
-				{
-					vTaskMissedYield();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				xReturn = prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			( void ) xItemAdded;
+		}
+		#endif /* configUSE_QUEUE_SETS */
 
-				--( pxQueue->xRxLock );
+		/* A task waiting to receive may be able to continue because an item
+		was added, or because the reference it was waiting for was released. */
+		if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+			{
+				xReturn = pdTRUE;
 			}
 			else
 			{
-				break;
+				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-		pxQueue->xRxLock = queueUNLOCKED;
+		/* A task waiting to send may be able to continue because the
+		reservation ended, or because the slot of a received item was freed. */
+		if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToSend ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToSend ) ) != pdFALSE )
+			{
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
 	}
-	taskEXIT_CRITICAL();
-}
+
+#endif /* configUSE_QUEUE_ZERO_COPY */
 /*-----------------------------------------------------------*/
 
 static BaseType_t prvIsQueueEmpty( const Queue_t *pxQueue )
@@ -1804,7 +2996,7 @@ BaseType_t xReturn;
 
 	taskENTER_CRITICAL();
 	{
-		if( pxQueue->uxMessagesWaiting == ( UBaseType_t )  0 )
+		if( prvCanReceiveFromQueue( pxQueue ) == pdFALSE )
 		{
 			xReturn = pdTRUE;
 		}
@@ -1837,13 +3029,13 @@ BaseType_t xReturn;
 } /*lint !e818 xQueue could not be pointer to const because it is a typedef. */
 /*-----------------------------------------------------------*/
 
-static BaseType_t prvIsQueueFull( const Queue_t *pxQueue )
+static BaseType_t prvIsQueueFull( const Queue_t *pxQueue, const BaseType_t xPosition )
 {
 BaseType_t xReturn;
 
 	taskENTER_CRITICAL();
 	{
-		if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+		if( prvCanSendToQueue( pxQueue, xPosition ) == pdFALSE )
 		{
 			xReturn = pdTRUE;
 		}
@@ -1888,7 +3080,7 @@ BaseType_t xReturn;
 		between the check to see if the queue is full and blocking on the queue. */
 		portDISABLE_INTERRUPTS();
 		{
-			if( prvIsQueueFull( pxQueue ) != pdFALSE )
+			if( prvIsQueueFull( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
 			{
 				/* The queue is full - do we want to block or just leave without
 				posting? */
@@ -2005,6 +3197,7 @@ BaseType_t xReturn;
 					mtCOVERAGE_TEST_MARKER();
 				}
 				--( pxQueue->uxMessagesWaiting );
+				queueUPDATE_READY_MEMBER( pxQueue );
 				( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
 
 				xReturn = pdPASS;
@@ -2113,6 +3306,7 @@ BaseType_t xReturn;
 				mtCOVERAGE_TEST_MARKER();
 			}
 			--( pxQueue->uxMessagesWaiting );
+			queueUPDATE_READY_MEMBER( pxQueue );
 			( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.pcReadFrom, ( unsigned ) pxQueue->uxItemSize );
 
 			if( ( *pxCoRoutineWoken ) == pdFALSE )
@@ -2243,18 +3437,38 @@ BaseType_t xReturn;
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_QUEUE_SETS == 1 )
+#if ( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
 	QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
 	{
 	QueueSetHandle_t pxQueue;
 
-		pxQueue = xQueueGenericCreate( uxEventQueueLength, sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+		{
+			/* Members are linked into the list held in the storage area, so
+			there is no queue of events that can overflow. */
+			( void ) uxEventQueueLength;
+			pxQueue = xQueueGenericCreate( ( UBaseType_t ) 1, sizeof( List_t ), queueQUEUE_TYPE_SET );
+
+			if( pxQueue != NULL )
+			{
+				vListInitialise( queueSET_READY_MEMBERS( ( Queue_t * ) pxQueue ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			pxQueue = xQueueGenericCreate( uxEventQueueLength, sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
+		}
+		#endif /* configUSE_QUEUE_SET_READY_LIST */
 
 		return pxQueue;
 	}
 
-#endif /* configUSE_QUEUE_SETS */
+#endif /* ( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_QUEUE_SETS == 1 )
@@ -2276,6 +3490,14 @@ BaseType_t xReturn;
 				items in the queue/semaphore. */
 				xReturn = pdFAIL;
 			}
+			#if( configUSE_FAST_MUTEXES == 1 )
+			else if( ( ( Queue_t * ) xQueueOrSemaphore )->uxQueueType == queueQUEUE_IS_MUTEX )
+			{
+				/* A mutex that is given without entering a critical section
+				cannot notify a queue set. */
+				xReturn = pdFAIL;
+			}
+			#endif /* configUSE_FAST_MUTEXES */
 			else
 			{
 				( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer = xQueueSet;
@@ -2332,27 +3554,72 @@ BaseType_t xReturn;
 	{
 	QueueSetMemberHandle_t xReturn = NULL;
 
-		( void ) xQueueGenericReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait, pdFALSE ); /*lint !e961 Casting from one typedef to another is not redundant. */
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+		{
+			( void ) prvSelectReadyMembers( ( Queue_t * ) xQueueSet, &xReturn, ( UBaseType_t ) 1, xTicksToWait );
+		}
+		#else
+		{
+			( void ) xQueueGenericReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait, pdFALSE ); /*lint !e961 Casting from one typedef to another is not redundant. */
+		}
+		#endif /* configUSE_QUEUE_SET_READY_LIST */
+
 		return xReturn;
 	}
 
 #endif /* configUSE_QUEUE_SETS */
 /*-----------------------------------------------------------*/
 
+#if( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+
+	UBaseType_t uxQueueSelectMultipleFromSet( QueueSetHandle_t xQueueSet, QueueSetMemberHandle_t * const pxMembers, const UBaseType_t uxMaxMembers, TickType_t const xTicksToWait )
+	{
+		configASSERT( pxMembers );
+		configASSERT( uxMaxMembers > ( UBaseType_t ) 0U );
+
+		return prvSelectReadyMembers( ( Queue_t * ) xQueueSet, pxMembers, uxMaxMembers, xTicksToWait );
+	}
+
+#endif /* configUSE_QUEUE_SET_READY_LIST */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 	QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet )
 	{
 	QueueSetMemberHandle_t xReturn = NULL;
 
-		( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL ); /*lint !e961 Casting from one typedef to another is not redundant. */
+		#if( configUSE_QUEUE_SET_READY_LIST == 1 )
+		{
+		UBaseType_t uxSavedInterruptStatus;
+		List_t * const pxReadyMembers = queueSET_READY_MEMBERS( ( Queue_t * ) xQueueSet );
+
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				if( listLIST_IS_EMPTY( pxReadyMembers ) == pdFALSE )
+				{
+					xReturn = prvClaimReadyMember( ( Queue_t * ) xQueueSet );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		#else
+		{
+			( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL ); /*lint !e961 Casting from one typedef to another is not redundant. */
+		}
+		#endif /* configUSE_QUEUE_SET_READY_LIST */
+
 		return xReturn;
 	}
 
 #endif /* configUSE_QUEUE_SETS */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_QUEUE_SETS == 1 )
+#if( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 0 ) )
 
 	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition )
 	{
@@ -2395,6 +3662,211 @@ BaseType_t xReturn;
 	}
 
 #endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_QUEUE_SETS == 1 ) && ( configUSE_QUEUE_SET_READY_LIST == 1 ) )
+
+	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition )
+	{
+	Queue_t *pxQueueSetContainer = pxQueue->pxQueueSetContainer;
+	List_t *pxReadyMembers;
+	BaseType_t xReturn = pdFALSE;
+
+		/* This function must be called form a critical section. */
+
+		configASSERT( pxQueueSetContainer );
+		pxReadyMembers = queueSET_READY_MEMBERS( pxQueueSetContainer );
+
+		/* Only the position of the queue in the set matters, not the position
+		of the item in the queue. */
+		( void ) xCopyPosition;
+
+		/* The queue is only added to the list of ready members if all the
+		items it held before had been selected, so nothing is copied and the
+		set cannot overflow.  Any task waiting on the set was unblocked when the
+		queue was added. */
+		if( ( listLIST_ITEM_CONTAINER( &( pxQueue->xReadyMemberListItem ) ) == NULL ) && ( pxQueue->uxMessagesWaiting > pxQueue->uxItemsSelected ) )
+		{
+			traceQUEUE_SEND( pxQueueSetContainer );
+			vListInsertEnd( pxReadyMembers, ( ListItem_t * ) &( pxQueue->xReadyMemberListItem ) );
+			pxQueueSetContainer->uxMessagesWaiting = listCURRENT_LIST_LENGTH( pxReadyMembers );
+
+			if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+			{
+				if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
+				{
+					/* The task waiting has a higher priority */
+					xReturn = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvUpdateReadyMember( Queue_t * const pxQueue )
+	{
+	Queue_t * const pxQueueSetContainer = pxQueue->pxQueueSetContainer;
+
+		if( pxQueue->uxItemsSelected > ( UBaseType_t ) 0U )
+		{
+			/* The item received was one that had been selected, so the items
+			that have not been selected are unchanged. */
+			( pxQueue->uxItemsSelected )--;
+		}
+		else if( ( listLIST_ITEM_CONTAINER( &( pxQueue->xReadyMemberListItem ) ) != NULL ) && ( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0U ) )
+		{
+			/* The item is only ever in the list of the set the queue is a
+			member of. */
+			pxQueueSetContainer->uxMessagesWaiting = uxListRemove( &( pxQueue->xReadyMemberListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static QueueSetMemberHandle_t prvClaimReadyMember( Queue_t * const pxQueueSet )
+	{
+	List_t * const pxReadyMembers = queueSET_READY_MEMBERS( pxQueueSet );
+	Queue_t * const pxMember = ( Queue_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxReadyMembers );
+
+		/* Selecting a member claims one of its items, so each selection
+		allows one receive, as if the set held an event for every item. */
+		( pxMember->uxItemsSelected )++;
+		( void ) uxListRemove( &( pxMember->xReadyMemberListItem ) );
+
+		/* A member that still holds items that have not been selected goes to
+		the back, behind the members that became ready while it was at the
+		front, so members are selected in about the order their items were
+		sent. */
+		if( pxMember->uxMessagesWaiting > pxMember->uxItemsSelected )
+		{
+			vListInsertEnd( pxReadyMembers, &( pxMember->xReadyMemberListItem ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxQueueSet->uxMessagesWaiting = listCURRENT_LIST_LENGTH( pxReadyMembers );
+
+		return ( QueueSetMemberHandle_t ) pxMember;
+	}
+	/*-----------------------------------------------------------*/
+
+	static UBaseType_t prvSelectReadyMembers( Queue_t * const pxQueueSet, QueueSetMemberHandle_t * const pxMembers, const UBaseType_t uxMaxMembers, TickType_t xTicksToWait )
+	{
+	BaseType_t xEntryTimeSet = pdFALSE;
+	TimeOut_t xTimeOut;
+	List_t * const pxReadyMembers = queueSET_READY_MEMBERS( pxQueueSet );
+	UBaseType_t uxSelected, uxMembers;
+
+		configASSERT( pxQueueSet );
+		#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+		{
+			configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+		}
+		#endif
+
+		for( ;; )
+		{
+			taskENTER_CRITICAL();
+			{
+				if( listLIST_IS_EMPTY( pxReadyMembers ) == pdFALSE )
+				{
+					/* A selected member that is still ready moves to the back
+					of the list, so no more members are selected than were in
+					the list to start with, and none is selected twice. */
+					uxMembers = listCURRENT_LIST_LENGTH( pxReadyMembers );
+
+					for( uxSelected = ( UBaseType_t ) 0U; ( uxSelected < uxMaxMembers ) && ( uxSelected < uxMembers ); uxSelected++ )
+					{
+						pxMembers[ uxSelected ] = prvClaimReadyMember( pxQueueSet );
+					}
+
+					traceQUEUE_RECEIVE( pxQueueSet );
+					taskEXIT_CRITICAL();
+					return uxSelected;
+				}
+				else
+				{
+					if( xTicksToWait == ( TickType_t ) 0 )
+					{
+						/* No member is ready and no block time is specified
+						(or the block time has expired) so leave now. */
+						taskEXIT_CRITICAL();
+						traceQUEUE_RECEIVE_FAILED( pxQueueSet );
+						return ( UBaseType_t ) 0U;
+					}
+					else if( xEntryTimeSet == pdFALSE )
+					{
+						/* No member is ready and a block time was specified so
+						configure the timeout structure. */
+						vTaskSetTimeOutState( &xTimeOut );
+						xEntryTimeSet = pdTRUE;
+					}
+					else
+					{
+						/* Entry time was already set. */
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			vTaskSuspendAll();
+			prvLockQueue( pxQueueSet );
+
+			/* Update the timeout state to see if it has expired yet. */
+			if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+			{
+				if( prvIsQueueEmpty( pxQueueSet ) != pdFALSE )
+				{
+					traceBLOCKING_ON_QUEUE_RECEIVE( pxQueueSet );
+					vTaskPlaceOnEventList( &( pxQueueSet->xTasksWaitingToReceive ), xTicksToWait );
+					prvUnlockQueue( pxQueueSet );
+					if( xTaskResumeAll() == pdFALSE )
+					{
+						portYIELD_WITHIN_API();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					/* Try again. */
+					prvUnlockQueue( pxQueueSet );
+					( void ) xTaskResumeAll();
+				}
+			}
+			else
+			{
+				prvUnlockQueue( pxQueueSet );
+				( void ) xTaskResumeAll();
+				traceQUEUE_RECEIVE_FAILED( pxQueueSet );
+				return ( UBaseType_t ) 0U;
+			}
+		}
+	}
+
+#endif /* configUSE_QUEUE_SET_READY_LIST */
 
 
 
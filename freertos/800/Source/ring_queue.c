@@ -0,0 +1,613 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ring_queue.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if !defined( portCOMPARE_AND_SWAP ) || !defined( portMEMORY_BARRIER )
+	#error The port must define portCOMPARE_AND_SWAP() and portMEMORY_BARRIER() to build ring_queue.c
+#endif
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 ) && ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+	#error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build ring_queue.c
+#endif
+
+/* Bits used in the ucFlags member of a ring queue. */
+#define rqFLAGS_MULTIPLE_PRODUCERS			( ( uint8_t ) 1 )
+#define rqFLAGS_IS_STATICALLY_ALLOCATED		( ( uint8_t ) 2 )
+
+/* Values of the uxConsumerWaiting member of a ring queue. */
+#define rqCONSUMER_NOT_WAITING				( ( UBaseType_t ) 0 )
+#define rqCONSUMER_WAITING					( ( UBaseType_t ) 1 )
+
+/*
+ * The ring queue is a ring of ( uxMask + 1 ) fixed size slots.  The length is
+ * a power of two so the free running uxHead and uxTail counters can be turned
+ * into slot indexes with a mask, and subtracted to give the number of items
+ * held, even once they have wrapped.
+ *
+ * With a single producer only the producer updates uxHead, and only the reader
+ * updates uxTail, so each end just needs a memory barrier between copying an
+ * item and publishing the counter that hands the slot to the other end.
+ *
+ * With multiple producers a producer claims the slot at uxHead by advancing
+ * uxHead with a compare and swap, copies its item into the slot, then hands the
+ * slot to the reader by updating the slot's sequence number.  The sequence
+ * number of the slot used by position n is n while the slot is free for the
+ * producer that claims position n, ( n + 1 ) once that producer has written the
+ * item, and ( n + length ) once the reader has copied the item out - which
+ * frees the slot for the producer that claims the next position that maps
+ * onto it.
+ */
+typedef struct xRING_QUEUE
+{
+	volatile UBaseType_t uxHead;					/*< The next position to be written. */
+	volatile UBaseType_t uxTail;					/*< The next position to be read.  Only updated by the reader. */
+	volatile UBaseType_t uxConsumerWaiting;			/*< rqCONSUMER_WAITING while the reader is blocked, or about to block, on an empty ring queue. */
+	UBaseType_t uxMask;								/*< The length of the ring queue minus one. */
+	UBaseType_t uxItemSize;
+	volatile UBaseType_t *puxSequence;				/*< The sequence number of each slot, or NULL if there is a single producer. */
+	uint8_t *pucStorage;							/*< The slots, which are allocated immediately after the structure unless supplied by the application. */
+	volatile TaskHandle_t xTaskWaitingToReceive;	/*< The reader, while uxConsumerWaiting is rqCONSUMER_WAITING. */
+	uint8_t ucFlags;
+} RingQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copy an item into, or out of, the ring queue.  Neither masks interrupts.
+ */
+static BaseType_t prvWriteItem( RingQueue_t * const pxRingQueue, const void * const pvItemToQueue );
+static BaseType_t prvReadItem( RingQueue_t * const pxRingQueue, void * const pvBuffer );
+
+/*
+ * Called after an item has been written.  Returns pdTRUE if the reader is
+ * waiting for an item, in which case the calling producer - and only the
+ * calling producer - must notify it.
+ */
+static BaseType_t prvClaimWaitingConsumer( RingQueue_t * const pxRingQueue );
+
+/*
+ * Called by the create functions to initialise a new ring queue.
+ */
+static void prvInitialiseNewRingQueue( RingQueue_t * const pxRingQueue, UBaseType_t uxLength, UBaseType_t uxItemSize, uint8_t * const pucStorage, UBaseType_t * const puxSequence, uint8_t ucFlags );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	RingQueueHandle_t xRingQueueGenericCreate( UBaseType_t uxLength, UBaseType_t uxItemSize, BaseType_t xMultipleProducers )
+	{
+	RingQueue_t *pxRingQueue;
+	UBaseType_t *puxSequence;
+	size_t xSequenceBytes;
+	uint8_t ucFlags;
+
+		/* The length must be a power of two. */
+		configASSERT( uxLength > ( UBaseType_t ) 0 );
+		configASSERT( ( uxLength & ( uxLength - ( UBaseType_t ) 1 ) ) == ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+		if( xMultipleProducers != pdFALSE )
+		{
+			xSequenceBytes = ( size_t ) uxLength * sizeof( UBaseType_t );
+			ucFlags = rqFLAGS_MULTIPLE_PRODUCERS;
+		}
+		else
+		{
+			xSequenceBytes = ( size_t ) 0;
+			ucFlags = ( uint8_t ) 0;
+		}
+
+		/* The sequence numbers, if any, and the slots are allocated in the
+		same block as the structure.  The size of the structure is a multiple
+		of the alignment of a pointer, so the sequence numbers that follow it
+		are correctly aligned. */
+		pxRingQueue = ( RingQueue_t * ) pvPortMalloc( sizeof( RingQueue_t ) + xSequenceBytes + ( ( size_t ) uxLength * ( size_t ) uxItemSize ) ); /*lint !e9087 !e9079 Storage is allocated for the structure and the ring in one block. */
+
+		if( pxRingQueue != NULL )
+		{
+			if( xMultipleProducers != pdFALSE )
+			{
+				puxSequence = ( UBaseType_t * ) ( pxRingQueue + 1 ); /*lint !e9087 The sequence numbers follow the structure. */
+			}
+			else
+			{
+				puxSequence = NULL;
+			}
+
+			prvInitialiseNewRingQueue( pxRingQueue, uxLength, uxItemSize, ( ( uint8_t * ) ( pxRingQueue + 1 ) ) + xSequenceBytes, puxSequence, ucFlags );
+			traceRING_QUEUE_CREATE( pxRingQueue, xMultipleProducers );
+		}
+		else
+		{
+			traceRING_QUEUE_CREATE_FAILED( xMultipleProducers );
+		}
+
+		return ( RingQueueHandle_t ) pxRingQueue;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	RingQueueHandle_t xRingQueueGenericCreateStatic( UBaseType_t uxLength, UBaseType_t uxItemSize, BaseType_t xMultipleProducers, uint8_t * const pucRingQueueStorageArea, UBaseType_t * const puxSequenceStorageArea, StaticRingQueue_t * const pxStaticRingQueue )
+	{
+	RingQueue_t * const pxRingQueue = ( RingQueue_t * ) pxStaticRingQueue; /*lint !e740 !e9087 RingQueue_t and StaticRingQueue_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+	RingQueueHandle_t xReturn;
+	uint8_t ucFlags;
+
+		configASSERT( uxLength > ( UBaseType_t ) 0 );
+		configASSERT( ( uxLength & ( uxLength - ( UBaseType_t ) 1 ) ) == ( UBaseType_t ) 0 );
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+		configASSERT( pucRingQueueStorageArea );
+		configASSERT( pxStaticRingQueue );
+
+		/* The StaticRingQueue_t structure must be exactly the same size as the
+		real ring queue structure, otherwise the application has been built
+		with a different configuration to the kernel. */
+		configASSERT( sizeof( StaticRingQueue_t ) == sizeof( RingQueue_t ) );
+
+		if( xMultipleProducers != pdFALSE )
+		{
+			configASSERT( puxSequenceStorageArea );
+			ucFlags = rqFLAGS_MULTIPLE_PRODUCERS | rqFLAGS_IS_STATICALLY_ALLOCATED;
+		}
+		else
+		{
+			ucFlags = rqFLAGS_IS_STATICALLY_ALLOCATED;
+		}
+
+		if( ( pucRingQueueStorageArea != NULL ) && ( pxStaticRingQueue != NULL ) && ( ( xMultipleProducers == pdFALSE ) || ( puxSequenceStorageArea != NULL ) ) )
+		{
+			prvInitialiseNewRingQueue( pxRingQueue, uxLength, uxItemSize, pucRingQueueStorageArea, ( xMultipleProducers != pdFALSE ) ? puxSequenceStorageArea : NULL, ucFlags );
+			traceRING_QUEUE_CREATE( pxRingQueue, xMultipleProducers );
+			xReturn = ( RingQueueHandle_t ) pxStaticRingQueue;
+		}
+		else
+		{
+			xReturn = NULL;
+			traceRING_QUEUE_CREATE_FAILED( xMultipleProducers );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void vRingQueueDelete( RingQueueHandle_t xRingQueue )
+{
+RingQueue_t * const pxRingQueue = ( RingQueue_t * ) xRingQueue;
+
+	configASSERT( pxRingQueue );
+	configASSERT( pxRingQueue->uxConsumerWaiting == rqCONSUMER_NOT_WAITING );
+
+	traceRING_QUEUE_DELETE( xRingQueue );
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		if( ( pxRingQueue->ucFlags & rqFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+		{
+			/* The structure, the sequence numbers and the slots were allocated
+			in one block. */
+			vPortFree( ( void * ) pxRingQueue );
+		}
+		else
+		{
+			/* The memory belongs to the application. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingQueueSend( RingQueueHandle_t xRingQueue, const void * const pvItemToQueue )
+{
+RingQueue_t * const pxRingQueue = ( RingQueue_t * ) xRingQueue;
+BaseType_t xReturn;
+
+	configASSERT( pxRingQueue );
+	configASSERT( pvItemToQueue );
+
+	xReturn = prvWriteItem( pxRingQueue, pvItemToQueue );
+
+	if( xReturn == pdPASS )
+	{
+		if( prvClaimWaitingConsumer( pxRingQueue ) != pdFALSE )
+		{
+			( void ) xTaskNotify( pxRingQueue->xTaskWaitingToReceive, ( uint32_t ) 0, eNoAction );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		traceRING_QUEUE_SEND_FAILED( xRingQueue );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingQueueSendFromISR( RingQueueHandle_t xRingQueue, const void * const pvItemToQueue, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+RingQueue_t * const pxRingQueue = ( RingQueue_t * ) xRingQueue;
+BaseType_t xReturn;
+
+	configASSERT( pxRingQueue );
+	configASSERT( pvItemToQueue );
+
+	xReturn = prvWriteItem( pxRingQueue, pvItemToQueue );
+
+	if( xReturn == pdPASS )
+	{
+		/* This is the only path that calls into the kernel, and it is only
+		taken when the reader is blocked on the ring queue. */
+		if( prvClaimWaitingConsumer( pxRingQueue ) != pdFALSE )
+		{
+			( void ) xTaskNotifyFromISR( pxRingQueue->xTaskWaitingToReceive, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		traceRING_QUEUE_SEND_FAILED( xRingQueue );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingQueueReceive( RingQueueHandle_t xRingQueue, void * const pvBuffer, TickType_t xTicksToWait )
+{
+RingQueue_t * const pxRingQueue = ( RingQueue_t * ) xRingQueue;
+BaseType_t xReturn;
+
+	configASSERT( pxRingQueue );
+	configASSERT( pvBuffer );
+
+	xReturn = prvReadItem( pxRingQueue, pvBuffer );
+
+	#if( configUSE_TASK_NOTIFICATIONS == 1 )
+	{
+	TimeOut_t xTimeOut;
+
+		if( ( xReturn == errQUEUE_EMPTY ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+		{
+			vTaskSetTimeOutState( &xTimeOut );
+
+			do
+			{
+				/* Register as waiting before looking at the ring queue again,
+				as a producer that wrote an item before the registration was
+				visible to it would not have notified this task.  Any stale
+				notification is cleared first. */
+				( void ) xTaskNotifyStateClear( NULL );
+				pxRingQueue->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+				portMEMORY_BARRIER();
+				pxRingQueue->uxConsumerWaiting = rqCONSUMER_WAITING;
+				portMEMORY_BARRIER();
+
+				xReturn = prvReadItem( pxRingQueue, pvBuffer );
+
+				if( xReturn == errQUEUE_EMPTY )
+				{
+					traceBLOCKING_ON_RING_QUEUE_RECEIVE( xRingQueue );
+					( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Withdraw the registration if no producer has claimed it.  If
+				a producer has claimed it then its notification is, or is about
+				to be, pending, and is cleared before this task next waits. */
+				( void ) portCOMPARE_AND_SWAP( &( pxRingQueue->uxConsumerWaiting ), rqCONSUMER_WAITING, rqCONSUMER_NOT_WAITING );
+
+				if( xReturn == errQUEUE_EMPTY )
+				{
+					xReturn = prvReadItem( pxRingQueue, pvBuffer );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+			} while( ( xReturn == errQUEUE_EMPTY ) && ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#else
+	{
+		/* Blocking requires the task notifications. */
+		configASSERT( xTicksToWait == ( TickType_t ) 0 );
+		( void ) xTicksToWait;
+	}
+	#endif /* configUSE_TASK_NOTIFICATIONS */
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingQueueReceiveFromISR( RingQueueHandle_t xRingQueue, void * const pvBuffer )
+{
+RingQueue_t * const pxRingQueue = ( RingQueue_t * ) xRingQueue;
+
+	configASSERT( pxRingQueue );
+	configASSERT( pvBuffer );
+
+	return prvReadItem( pxRingQueue, pvBuffer );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxRingQueueMessagesWaiting( RingQueueHandle_t xRingQueue )
+{
+RingQueue_t * const pxRingQueue = ( RingQueue_t * ) xRingQueue;
+UBaseType_t uxTail;
+
+	configASSERT( pxRingQueue );
+
+	/* Read uxTail first, so a reader that runs in between cannot make the
+	result appear negative. */
+	uxTail = pxRingQueue->uxTail;
+	return pxRingQueue->uxHead - uxTail;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWriteItem( RingQueue_t * const pxRingQueue, const void * const pvItemToQueue )
+{
+UBaseType_t uxPosition, uxSlot;
+BaseType_t xDifference, xReturn = pdPASS;
+
+	if( ( pxRingQueue->ucFlags & rqFLAGS_MULTIPLE_PRODUCERS ) == ( uint8_t ) 0 )
+	{
+		uxPosition = pxRingQueue->uxHead;
+		uxSlot = uxPosition & pxRingQueue->uxMask;
+
+		if( ( uxPosition - pxRingQueue->uxTail ) > pxRingQueue->uxMask )
+		{
+			xReturn = errQUEUE_FULL;
+		}
+		else
+		{
+			/* The reader has finished with the slot before it advanced
+			uxTail past it. */
+			portMEMORY_BARRIER();
+			( void ) memcpy( ( void * ) &( pxRingQueue->pucStorage[ uxSlot * pxRingQueue->uxItemSize ] ), pvItemToQueue, ( size_t ) pxRingQueue->uxItemSize );
+			portMEMORY_BARRIER();
+			pxRingQueue->uxHead = uxPosition + ( UBaseType_t ) 1;
+		}
+	}
+	else
+	{
+		for( ;; )
+		{
+			uxPosition = pxRingQueue->uxHead;
+			uxSlot = uxPosition & pxRingQueue->uxMask;
+			xDifference = ( BaseType_t ) ( pxRingQueue->puxSequence[ uxSlot ] - uxPosition );
+
+			if( xDifference == ( BaseType_t ) 0 )
+			{
+				/* The slot is free.  Claim it, unless another producer got
+				there first, in which case try again at the new uxHead. */
+				if( portCOMPARE_AND_SWAP( &( pxRingQueue->uxHead ), uxPosition, uxPosition + ( UBaseType_t ) 1 ) != pdFALSE )
+				{
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( xDifference < ( BaseType_t ) 0 )
+			{
+				/* The reader has not yet copied out the item written the last
+				time round the ring. */
+				xReturn = errQUEUE_FULL;
+				break;
+			}
+			else
+			{
+				/* Another producer claimed the slot after uxHead was read. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		if( xReturn == pdPASS )
+		{
+			( void ) memcpy( ( void * ) &( pxRingQueue->pucStorage[ uxSlot * pxRingQueue->uxItemSize ] ), pvItemToQueue, ( size_t ) pxRingQueue->uxItemSize );
+			portMEMORY_BARRIER();
+			pxRingQueue->puxSequence[ uxSlot ] = uxPosition + ( UBaseType_t ) 1;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvReadItem( RingQueue_t * const pxRingQueue, void * const pvBuffer )
+{
+const UBaseType_t uxPosition = pxRingQueue->uxTail;
+const UBaseType_t uxSlot = uxPosition & pxRingQueue->uxMask;
+BaseType_t xReturn;
+
+	if( ( pxRingQueue->ucFlags & rqFLAGS_MULTIPLE_PRODUCERS ) == ( uint8_t ) 0 )
+	{
+		xReturn = ( pxRingQueue->uxHead != uxPosition ) ? pdPASS : errQUEUE_EMPTY;
+	}
+	else
+	{
+		/* A slot that has been claimed, but not yet written, is not
+		available. */
+		xReturn = ( pxRingQueue->puxSequence[ uxSlot ] == ( uxPosition + ( UBaseType_t ) 1 ) ) ? pdPASS : errQUEUE_EMPTY;
+	}
+
+	if( xReturn == pdPASS )
+	{
+		portMEMORY_BARRIER();
+		( void ) memcpy( pvBuffer, ( void * ) &( pxRingQueue->pucStorage[ uxSlot * pxRingQueue->uxItemSize ] ), ( size_t ) pxRingQueue->uxItemSize );
+		portMEMORY_BARRIER();
+
+		if( pxRingQueue->puxSequence != NULL )
+		{
+			pxRingQueue->puxSequence[ uxSlot ] = uxPosition + pxRingQueue->uxMask + ( UBaseType_t ) 1;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxRingQueue->uxTail = uxPosition + ( UBaseType_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvClaimWaitingConsumer( RingQueue_t * const pxRingQueue )
+{
+BaseType_t xReturn;
+
+	/* The item must be visible to the reader before uxConsumerWaiting is
+	read, as the reader looks at the ring queue again after registering. */
+	portMEMORY_BARRIER();
+
+	if( pxRingQueue->uxConsumerWaiting == rqCONSUMER_WAITING )
+	{
+		/* Only one producer wins, and none wins if the reader has withdrawn
+		its registration in the meantime. */
+		xReturn = portCOMPARE_AND_SWAP( &( pxRingQueue->uxConsumerWaiting ), rqCONSUMER_WAITING, rqCONSUMER_NOT_WAITING );
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewRingQueue( RingQueue_t * const pxRingQueue, UBaseType_t uxLength, UBaseType_t uxItemSize, uint8_t * const pucStorage, UBaseType_t * const puxSequence, uint8_t ucFlags )
+{
+UBaseType_t uxSlot;
+
+	( void ) memset( ( void * ) pxRingQueue, 0x00, sizeof( RingQueue_t ) );
+	pxRingQueue->uxMask = uxLength - ( UBaseType_t ) 1;
+	pxRingQueue->uxItemSize = uxItemSize;
+	pxRingQueue->puxSequence = puxSequence;
+	pxRingQueue->pucStorage = pucStorage;
+	pxRingQueue->ucFlags = ucFlags;
+
+	/* Every slot starts free for the producer that claims the first position
+	that maps onto it. */
+	if( puxSequence != NULL )
+	{
+		for( uxSlot = ( UBaseType_t ) 0; uxSlot < uxLength; uxSlot++ )
+		{
+			puxSequence[ uxSlot ] = uxSlot;
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
@@ -0,0 +1,1029 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "stream_buffer.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if ( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error configUSE_TASK_NOTIFICATIONS must be set to 1 to build stream_buffer.c
+#endif
+
+#if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_MUTEXES != 1 )
+	#error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to build stream_buffer.c
+#endif
+
+/* Bits used in the ucFlags member of a stream buffer. */
+#define sbFLAGS_IS_MESSAGE_BUFFER		( ( uint8_t ) 1 )
+#define sbFLAGS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 2 )
+
+/* Each message written to a message buffer is preceded by its length. */
+#define sbBYTES_TO_STORE_MESSAGE_LENGTH	( sizeof( size_t ) )
+
+/*
+ * The stream buffer is a ring buffer that is written by exactly one writer and
+ * read by exactly one reader.  Only the writer updates xHead, and only the
+ * reader updates xTail, so the data itself can be copied without a critical
+ * section.  The ring is one byte longer than the space requested when the
+ * buffer was created so a full buffer (xHead one behind xTail) can be
+ * distinguished from an empty buffer (xHead equal to xTail).
+ */
+typedef struct xSTREAM_BUFFER
+{
+	volatile size_t xTail;							/*< Index of the next byte to read.  Only updated by the reader. */
+	volatile size_t xHead;							/*< Index of the next byte to write.  Only updated by the writer. */
+	size_t xLength;									/*< The length of the ring pointed to by pucBuffer. */
+	volatile size_t xTriggerLevelBytes;				/*< The number of bytes that must be in the buffer before a blocked reader is unblocked. */
+	volatile TaskHandle_t xTaskWaitingToReceive;	/*< The reader, if it is blocked waiting for data. */
+	volatile TaskHandle_t xTaskWaitingToSend;		/*< The writer, if it is blocked waiting for space. */
+	uint8_t *pucBuffer;								/*< The ring itself, which is allocated immediately after the structure unless supplied by the application. */
+	uint8_t ucFlags;
+
+	#if ( configUSE_TRACE_FACILITY == 1 )
+		UBaseType_t uxStreamBufferNumber;
+	#endif
+
+} StreamBuffer_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The number of bytes that can be read from, and the number of bytes that can
+ * be written to, the stream buffer.
+ */
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer );
+static size_t prvSpacesAvailable( const StreamBuffer_t * const pxStreamBuffer );
+
+/*
+ * Copy xCount bytes into or out of the ring starting at index xIndex, wrapping
+ * at the end of the ring if necessary.  The index that follows the last byte
+ * copied is returned - it is up to the caller to publish the new index by
+ * writing it to xHead or xTail, which must only be done once a complete
+ * message has been copied.
+ */
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xIndex );
+static size_t prvReadBytesFromBuffer( const StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount, size_t xIndex );
+
+/*
+ * Write as much of pvTxData as possible into a stream buffer, or the whole
+ * message (preceded by its length) into a message buffer.  Returns the number
+ * of data bytes written.
+ */
+static size_t prvWriteMessageOrBytes( StreamBuffer_t * const pxStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, size_t xSpace, size_t xRequiredSpace );
+
+/*
+ * Read as many bytes as will fit into pvRxData from a stream buffer, or the
+ * next message from a message buffer.  A message is left in the buffer if it
+ * does not fit into pvRxData.  Returns the number of bytes read.
+ */
+static size_t prvReadMessageOrBytes( StreamBuffer_t * const pxStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, size_t xBytesAvailable );
+
+/*
+ * Register the calling task as the task waiting to send to, or to receive
+ * from, the stream buffer.  Any notification left over from a previous wait
+ * is cleared first so the subsequent call to xTaskNotifyWait() only returns
+ * when the other end of the buffer has made progress.
+ */
+static void prvRegisterWaitingTask( TaskHandle_t volatile * const pxWaitingTask );
+
+/*
+ * Notify the task waiting at the other end of the stream buffer, if any.  A
+ * critical section is only entered if a task is actually waiting.  This is
+ * safe because a waiting task registers itself from within a critical section
+ * after checking the buffer state, and the indexes are always updated before
+ * these functions are called.
+ */
+static void prvNotifyWaitingTask( TaskHandle_t volatile * const pxWaitingTask );
+static void prvNotifyWaitingTaskFromISR( TaskHandle_t volatile * const pxWaitingTask, BaseType_t * const pxHigherPriorityTaskWoken );
+
+/*
+ * Called by both the dynamic and static create functions to set up a stream
+ * buffer that uses the ring pointed to by pucBuffer.  xLength is the length of
+ * the ring, which is one more than the number of bytes it can hold.
+ */
+static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer, uint8_t * const pucBuffer, size_t xLength, size_t xTriggerLevelBytes, uint8_t ucFlags );
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer )
+	{
+	StreamBuffer_t *pxStreamBuffer;
+	uint8_t ucFlags;
+
+		if( xIsMessageBuffer != pdFALSE )
+		{
+			/* A message buffer must at least be able to hold the length of a
+			message and one byte of data. */
+			configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+			ucFlags = sbFLAGS_IS_MESSAGE_BUFFER;
+		}
+		else
+		{
+			configASSERT( xBufferSizeBytes > ( size_t ) 0 );
+			ucFlags = ( uint8_t ) 0;
+		}
+
+		configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
+
+		/* Allocate one extra byte so a full ring can be distinguished from an
+		empty ring.  The ring is allocated in the same block as the structure. */
+		xBufferSizeBytes++;
+		pxStreamBuffer = ( StreamBuffer_t * ) pvPortMalloc( sizeof( StreamBuffer_t ) + xBufferSizeBytes ); /*lint !e9087 !e9079 Storage is allocated for the structure and the ring in one block. */
+
+		if( pxStreamBuffer != NULL )
+		{
+			prvInitialiseNewStreamBuffer( pxStreamBuffer, ( ( uint8_t * ) pxStreamBuffer ) + sizeof( StreamBuffer_t ), xBufferSizeBytes, xTriggerLevelBytes, ucFlags );
+			traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer );
+		}
+		else
+		{
+			traceSTREAM_BUFFER_CREATE_FAILED( xIsMessageBuffer );
+		}
+
+		return ( StreamBufferHandle_t ) pxStreamBuffer;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	StreamBufferHandle_t xStreamBufferGenericCreateStatic( size_t xBufferSizeBytes, size_t xTriggerLevelBytes, BaseType_t xIsMessageBuffer, uint8_t * const pucStreamBufferStorageArea, StaticStreamBuffer_t * const pxStaticStreamBuffer )
+	{
+	StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) pxStaticStreamBuffer; /*lint !e740 !e9087 StreamBuffer_t and StaticStreamBuffer_t are guaranteed to have the same size and alignment requirement - checked by configASSERT(). */
+	StreamBufferHandle_t xReturn;
+	uint8_t ucFlags;
+
+		configASSERT( pucStreamBufferStorageArea );
+		configASSERT( pxStaticStreamBuffer );
+		configASSERT( xTriggerLevelBytes <= xBufferSizeBytes );
+
+		/* The StaticStreamBuffer_t structure must be exactly the same size as
+		the real stream buffer structure, otherwise the application has been
+		built with a different configuration to the kernel. */
+		configASSERT( sizeof( StaticStreamBuffer_t ) == sizeof( StreamBuffer_t ) );
+
+		if( xIsMessageBuffer != pdFALSE )
+		{
+			configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+			ucFlags = sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_STATICALLY_ALLOCATED;
+		}
+		else
+		{
+			configASSERT( xBufferSizeBytes > ( size_t ) 0 );
+			ucFlags = sbFLAGS_IS_STATICALLY_ALLOCATED;
+		}
+
+		if( ( pucStreamBufferStorageArea != NULL ) && ( pxStaticStreamBuffer != NULL ) )
+		{
+			/* The storage area supplied must be xBufferSizeBytes + 1 bytes
+			long, for the same reason the dynamic version allocates one extra
+			byte. */
+			prvInitialiseNewStreamBuffer( pxStreamBuffer, pucStreamBufferStorageArea, xBufferSizeBytes + ( size_t ) 1, xTriggerLevelBytes, ucFlags );
+			traceSTREAM_BUFFER_CREATE( pxStreamBuffer, xIsMessageBuffer );
+			xReturn = ( StreamBufferHandle_t ) pxStaticStreamBuffer;
+		}
+		else
+		{
+			xReturn = NULL;
+			traceSTREAM_BUFFER_CREATE_FAILED( xIsMessageBuffer );
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+
+	configASSERT( pxStreamBuffer );
+	configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+	configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+
+	traceSTREAM_BUFFER_DELETE( xStreamBuffer );
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	{
+		if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+		{
+			/* The structure and the ring were allocated in one block. */
+			vPortFree( ( void * ) pxStreamBuffer );
+		}
+		else
+		{
+			/* The memory belongs to the application. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( pxStreamBuffer );
+
+	taskENTER_CRITICAL();
+	{
+		/* Can only reset the buffer if neither end is blocked on it. */
+		if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+		{
+			pxStreamBuffer->xHead = ( size_t ) 0;
+			pxStreamBuffer->xTail = ( size_t ) 0;
+			xReturn = pdPASS;
+
+			traceSTREAM_BUFFER_RESET( xStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer, size_t xTriggerLevel )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	if( xTriggerLevel == ( size_t ) 0 )
+	{
+		xTriggerLevel = ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	/* xLength includes the byte that is never used. */
+	if( xTriggerLevel < pxStreamBuffer->xLength )
+	{
+		pxStreamBuffer->xTriggerLevelBytes = xTriggerLevel;
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+	configASSERT( xStreamBuffer );
+	return prvSpacesAvailable( ( StreamBuffer_t * ) xStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer )
+{
+	configASSERT( xStreamBuffer );
+	return prvBytesInBuffer( ( StreamBuffer_t * ) xStreamBuffer );
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn, xSpace, xRequiredSpace = xDataLengthBytes;
+TimeOut_t xTimeOut;
+BaseType_t xMustWait;
+
+	configASSERT( pvTxData );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+		/* A message that is larger than the buffer could never be sent. */
+		configASSERT( xRequiredSpace < pxStreamBuffer->xLength );
+	}
+	else
+	{
+		/* Never wait for more space than the buffer can ever hold. */
+		if( xRequiredSpace >= pxStreamBuffer->xLength )
+		{
+			xRequiredSpace = pxStreamBuffer->xLength - ( size_t ) 1;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		vTaskSetTimeOutState( &xTimeOut );
+
+		do
+		{
+			/* The reader notifies this task each time it removes data, so
+			loop until there is enough space or the block time expires. */
+			taskENTER_CRITICAL();
+			{
+				if( prvSpacesAvailable( pxStreamBuffer ) < xRequiredSpace )
+				{
+					prvRegisterWaitingTask( &( pxStreamBuffer->xTaskWaitingToSend ) );
+					xMustWait = pdTRUE;
+				}
+				else
+				{
+					xMustWait = pdFALSE;
+				}
+			}
+			taskEXIT_CRITICAL();
+
+			if( xMustWait == pdFALSE )
+			{
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToSend = NULL;
+
+		} while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xSpace = prvSpacesAvailable( pxStreamBuffer );
+	xReturn = prvWriteMessageOrBytes( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+		/* Unblock the reader if enough data has accumulated. */
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			prvNotifyWaitingTask( &( pxStreamBuffer->xTaskWaitingToReceive ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn, xSpace, xRequiredSpace = xDataLengthBytes;
+
+	configASSERT( pvTxData );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xSpace = prvSpacesAvailable( pxStreamBuffer );
+	xReturn = prvWriteMessageOrBytes( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+
+	if( xReturn > ( size_t ) 0 )
+	{
+		if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+		{
+			prvNotifyWaitingTaskFromISR( &( pxStreamBuffer->xTaskWaitingToReceive ), pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, TickType_t xTicksToWait )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+	configASSERT( pvRxData );
+	configASSERT( pxStreamBuffer );
+
+	/* A message buffer only contains a message if it holds more than the
+	length of a message. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = ( size_t ) 0;
+	}
+
+	if( xTicksToWait != ( TickType_t ) 0 )
+	{
+		taskENTER_CRITICAL();
+		{
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+			if( xBytesAvailable <= xBytesToStoreMessageLength )
+			{
+				prvRegisterWaitingTask( &( pxStreamBuffer->xTaskWaitingToReceive ) );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		if( xBytesAvailable <= xBytesToStoreMessageLength )
+		{
+			/* The writer only notifies this task once the trigger level has
+			been reached, so a single wait is sufficient. */
+			traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+			( void ) xTaskNotifyWait( ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+			pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+			xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+	}
+
+	if( xBytesAvailable > xBytesToStoreMessageLength )
+	{
+		xReceivedLength = prvReadMessageOrBytes( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable );
+
+		if( xReceivedLength != ( size_t ) 0 )
+		{
+			traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
+
+			/* Space has been freed, so unblock the writer if it is waiting. */
+			prvNotifyWaitingTask( &( pxStreamBuffer->xTaskWaitingToSend ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+	}
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+	configASSERT( pvRxData );
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = ( size_t ) 0;
+	}
+
+	xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+	if( xBytesAvailable > xBytesToStoreMessageLength )
+	{
+		xReceivedLength = prvReadMessageOrBytes( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable );
+
+		if( xReceivedLength != ( size_t ) 0 )
+		{
+			prvNotifyWaitingTaskFromISR( &( pxStreamBuffer->xTaskWaitingToSend ), pxHigherPriorityTaskWoken );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength );
+
+	return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferNextMessageLengthBytes( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+size_t xReturn = 0;
+
+	configASSERT( pxStreamBuffer );
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		if( prvBytesInBuffer( pxStreamBuffer ) > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+		{
+			( void ) prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xReturn, sbBYTES_TO_STORE_MESSAGE_LENGTH, pxStreamBuffer->xTail );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn;
+
+	configASSERT( pxStreamBuffer );
+
+	if( pxStreamBuffer->xHead == pxStreamBuffer->xTail )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+{
+StreamBuffer_t * const pxStreamBuffer = ( StreamBuffer_t * ) xStreamBuffer;
+BaseType_t xReturn;
+size_t xBytesToStoreMessageLength;
+
+	configASSERT( pxStreamBuffer );
+
+	/* A message buffer is full if not even a zero length message would fit. */
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+	}
+	else
+	{
+		xBytesToStoreMessageLength = ( size_t ) 0;
+	}
+
+	if( prvSpacesAvailable( pxStreamBuffer ) <= xBytesToStoreMessageLength )
+	{
+		xReturn = pdTRUE;
+	}
+	else
+	{
+		xReturn = pdFALSE;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+size_t xCount;
+
+	/* Each index is read exactly once as either may be updated by the other
+	end of the buffer. */
+	xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
+	xCount -= pxStreamBuffer->xTail;
+
+	if( xCount >= pxStreamBuffer->xLength )
+	{
+		xCount -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSpacesAvailable( const StreamBuffer_t * const pxStreamBuffer )
+{
+	return ( pxStreamBuffer->xLength - prvBytesInBuffer( pxStreamBuffer ) ) - ( size_t ) 1;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer, const uint8_t *pucData, size_t xCount, size_t xIndex )
+{
+size_t xFirstLength;
+
+	/* Copy up to the end of the ring, then wrap to the start for any
+	remaining bytes. */
+	xFirstLength = pxStreamBuffer->xLength - xIndex;
+
+	if( xFirstLength > xCount )
+	{
+		xFirstLength = xCount;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( ( void * ) &( pxStreamBuffer->pucBuffer[ xIndex ] ), ( const void * ) pucData, xFirstLength );
+
+	if( xCount > xFirstLength )
+	{
+		( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xIndex += xCount;
+
+	if( xIndex >= pxStreamBuffer->xLength )
+	{
+		xIndex -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xIndex;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadBytesFromBuffer( const StreamBuffer_t * const pxStreamBuffer, uint8_t *pucData, size_t xCount, size_t xIndex )
+{
+size_t xFirstLength;
+
+	xFirstLength = pxStreamBuffer->xLength - xIndex;
+
+	if( xFirstLength > xCount )
+	{
+		xFirstLength = xCount;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xIndex ] ), xFirstLength );
+
+	if( xCount > xFirstLength )
+	{
+		( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( const void * ) pxStreamBuffer->pucBuffer, xCount - xFirstLength );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	xIndex += xCount;
+
+	if( xIndex >= pxStreamBuffer->xLength )
+	{
+		xIndex -= pxStreamBuffer->xLength;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xIndex;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteMessageOrBytes( StreamBuffer_t * const pxStreamBuffer, const void *pvTxData, size_t xDataLengthBytes, size_t xSpace, size_t xRequiredSpace )
+{
+size_t xHead = pxStreamBuffer->xHead;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* Messages are written in their entirety or not at all. */
+		if( xSpace >= xRequiredSpace )
+		{
+			xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &xDataLengthBytes, sbBYTES_TO_STORE_MESSAGE_LENGTH, xHead );
+		}
+		else
+		{
+			xDataLengthBytes = ( size_t ) 0;
+		}
+	}
+	else
+	{
+		/* Write as many bytes as will fit. */
+		if( xDataLengthBytes > xSpace )
+		{
+			xDataLengthBytes = xSpace;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( xDataLengthBytes != ( size_t ) 0 )
+	{
+		xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, xHead );
+
+		/* Only now is the data made visible to the reader. */
+		pxStreamBuffer->xHead = xHead;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadMessageOrBytes( StreamBuffer_t * const pxStreamBuffer, void *pvRxData, size_t xBufferLengthBytes, size_t xBytesAvailable )
+{
+size_t xTail = pxStreamBuffer->xTail, xCount;
+
+	if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+	{
+		/* Peek the length of the next message.  The tail is not moved unless
+		the whole message is read. */
+		xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xCount, sbBYTES_TO_STORE_MESSAGE_LENGTH, xTail );
+
+		if( xCount > xBufferLengthBytes )
+		{
+			xCount = ( size_t ) 0;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* Read as many bytes as are available and will fit. */
+		xCount = xBytesAvailable;
+
+		if( xCount > xBufferLengthBytes )
+		{
+			xCount = xBufferLengthBytes;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( xCount != ( size_t ) 0 )
+	{
+		xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, xTail );
+
+		/* Only now is the space made available to the writer. */
+		pxStreamBuffer->xTail = xTail;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRegisterWaitingTask( TaskHandle_t volatile * const pxWaitingTask )
+{
+	/* Only one task may wait at each end of a stream buffer. */
+	configASSERT( *pxWaitingTask == NULL );
+
+	( void ) xTaskNotifyStateClear( NULL );
+	*pxWaitingTask = xTaskGetCurrentTaskHandle();
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitingTask( TaskHandle_t volatile * const pxWaitingTask )
+{
+	if( *pxWaitingTask != NULL )
+	{
+		taskENTER_CRITICAL();
+		{
+			/* Test again as the waiting task may have timed out. */
+			if( *pxWaitingTask != NULL )
+			{
+				( void ) xTaskNotify( *pxWaitingTask, ( uint32_t ) 0, eNoAction );
+				*pxWaitingTask = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvNotifyWaitingTaskFromISR( TaskHandle_t volatile * const pxWaitingTask, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	if( *pxWaitingTask != NULL )
+	{
+		uxSavedInterruptStatus = ( UBaseType_t ) portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( *pxWaitingTask != NULL )
+			{
+				( void ) xTaskNotifyFromISR( *pxWaitingTask, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+				*pxWaitingTask = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	UBaseType_t uxStreamBufferGetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer )
+	{
+		return ( ( StreamBuffer_t * ) xStreamBuffer )->uxStreamBufferNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	void vStreamBufferSetStreamBufferNumber( StreamBufferHandle_t xStreamBuffer, UBaseType_t uxStreamBufferNumber )
+	{
+		( ( StreamBuffer_t * ) xStreamBuffer )->uxStreamBufferNumber = uxStreamBufferNumber;
+	}
+
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer, uint8_t * const pucBuffer, size_t xLength, size_t xTriggerLevelBytes, uint8_t ucFlags )
+{
+	/* A trigger level of 0 would unblock the reader when the buffer is still
+	empty. */
+	if( xTriggerLevelBytes == ( size_t ) 0 )
+	{
+		xTriggerLevelBytes = ( size_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	( void ) memset( ( void * ) pxStreamBuffer, 0x00, sizeof( StreamBuffer_t ) );
+	pxStreamBuffer->pucBuffer = pucBuffer;
+	pxStreamBuffer->xLength = xLength;
+	pxStreamBuffer->xTriggerLevelBytes = xTriggerLevelBytes;
+	pxStreamBuffer->ucFlags = ucFlags;
+}
+/*-----------------------------------------------------------*/
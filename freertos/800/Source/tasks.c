@@ -104,6 +104,24 @@ privileged Vs unprivileged linkage and placement. */
  */
 #define tskIDLE_STACK_SIZE	configMINIMAL_STACK_SIZE
 
+/* Values that can be assigned to the ucNotifyState member of the TCB.  A
+uint8_t is used, rather than an enum, so the size of the TCB is known to the
+StaticTask_t definition in FreeRTOS.h. */
+#define taskNOT_WAITING_NOTIFICATION	( ( uint8_t ) 0 )
+#define taskWAITING_NOTIFICATION		( ( uint8_t ) 1 )
+#define taskNOTIFICATION_RECEIVED		( ( uint8_t ) 2 )
+
+/* A task's stack can be supplied by the application even when the TCB is
+allocated dynamically (xTaskCreateRestricted()), so a record of what must be
+freed when the task is deleted is needed whenever both memory sources are
+possible. */
+#define tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE	( ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) || ( portUSING_MPU_WRAPPERS == 1 ) ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+/* Values that can be assigned to the ucStaticallyAllocated member of the TCB. */
+#define tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB		( ( uint8_t ) 0 )
+#define tskSTATICALLY_ALLOCATED_STACK_ONLY			( ( uint8_t ) 1 )
+#define tskSTATICALLY_ALLOCATED_STACK_AND_TCB		( ( uint8_t ) 2 )
+
 #if( configUSE_PREEMPTION == 0 )
 	/* If the cooperative scheduler is being used then a yield should not be
 	performed just because a higher priority task has been woken. */
@@ -144,6 +162,10 @@ typedef struct tskTaskControlBlock
 		UBaseType_t  	uxTaskNumber;		/*< Stores a number specifically for use by third party trace code. */
 	#endif
 
+	#if ( configUSE_TASK_REGISTRY == 1 )
+		UBaseType_t		uxRegistrySlot;		/*< The index of the task in pxTaskRegistry[], or configTASK_REGISTRY_SIZE if the registry was full when the task was created. */
+	#endif
+
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t 	uxBasePriority;		/*< The priority last assigned to the task - used by the priority inheritance mechanism. */
 	#endif
@@ -167,6 +189,29 @@ typedef struct tskTaskControlBlock
 		struct 	_reent xNewLib_reent;
 	#endif
 
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+		volatile uint32_t ulNotifiedValue;	/*< The value sent to the task by the most recent xTaskNotify() call. */
+		volatile uint8_t ucNotifyState;		/*< Whether the task is waiting for, or has received, a notification. */
+	#endif
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		UBaseType_t		uxDeadlineHeapIndex;	/*< The index of the task in pxDeadlineHeap[], or taskNOT_IN_DEADLINE_HEAP. */
+		TickType_t		xDeadline;				/*< The deadline by which the task is ordered when it has priority configEDF_PRIORITY. */
+		TickType_t		xJobDeadline;			/*< The deadline of the current job, against which misses are counted.  Unlike xDeadline it is not postponed when the job overruns its budget. */
+		TickType_t		xReleaseTime;			/*< The tick count at which the current job was released. */
+		TickType_t		xPeriod;				/*< The time between releases, or 0 if the task has no deadline parameters. */
+		TickType_t		xRelativeDeadline;		/*< The time after its release by which each job must complete. */
+		TickType_t		xBudget;				/*< The ticks each job may run for before its deadline is postponed, or 0 for no limit. */
+		TickType_t		xBudgetRemaining;		/*< The ticks the task may still run for before its deadline is postponed. */
+		uint32_t		ulJobs;					/*< The number of jobs completed. */
+		uint32_t		ulDeadlinesMissed;		/*< The number of jobs completed after their deadline. */
+		uint32_t		ulBudgetOverruns;		/*< The number of times a job used up its budget. */
+	#endif
+
+	#if ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+		uint8_t			ucStaticallyAllocated;	/*< Set to one of the tskxxx_ALLOCATED values so the memory is not freed if the task is deleted. */
+	#endif
+
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -188,10 +233,21 @@ PRIVILEGED_DATA TCB_t * volatile pxCurrentTCB = NULL;
 
 /* Lists for ready and blocked tasks. --------------------*/
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ];/*< Prioritised ready tasks. */
+
 PRIVILEGED_DATA static List_t xDelayedTaskList1;						/*< Delayed tasks. */
 PRIVILEGED_DATA static List_t xDelayedTaskList2;						/*< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;				/*< Points to the delayed task list currently being used. */
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;		/*< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+
+#if( configUSE_TASK_DELAY_WHEEL == 1 )
+
+	/* With the delay wheel the delayed task lists only hold the tasks that
+	wake more than configTASK_DELAY_WHEEL_SIZE ticks after xDelayWheelTick. */
+	PRIVILEGED_DATA static List_t xDelayedTaskWheel[ configTASK_DELAY_WHEEL_SIZE ];	/*< Delayed tasks that wake within configTASK_DELAY_WHEEL_SIZE ticks of xDelayWheelTick, unsorted, in the bucket selected by the low bits of their wake time. */
+	PRIVILEGED_DATA static TickType_t xDelayWheelTick = ( TickType_t ) configINITIAL_TICK_COUNT;	/*< The tick count when the wheel was last checked for tasks to unblock. */
+
+#endif /* configUSE_TASK_DELAY_WHEEL */
+
 PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -215,7 +271,7 @@ PRIVILEGED_DATA static List_t xPendingReadyList;						/*< Tasks that have been r
 
 /* Other file private variables. --------------------------------*/
 PRIVILEGED_DATA static volatile UBaseType_t uxCurrentNumberOfTasks 	= ( UBaseType_t ) 0U;
-PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) 0U;
+PRIVILEGED_DATA static volatile TickType_t xTickCount 				= ( TickType_t ) configINITIAL_TICK_COUNT;
 PRIVILEGED_DATA static volatile UBaseType_t uxTopReadyPriority 		= tskIDLE_PRIORITY;
 PRIVILEGED_DATA static volatile BaseType_t xSchedulerRunning 		= pdFALSE;
 PRIVILEGED_DATA static volatile UBaseType_t uxPendedTicks 			= ( UBaseType_t ) 0U;
@@ -224,6 +280,96 @@ PRIVILEGED_DATA static volatile BaseType_t xNumOfOverflows 			= ( BaseType_t ) 0
 PRIVILEGED_DATA static UBaseType_t uxTaskNumber 					= ( UBaseType_t ) 0U;
 PRIVILEGED_DATA static volatile TickType_t xNextTaskUnblockTime		= portMAX_DELAY;
 
+#if( configTICK_UNBLOCK_LIMIT > 0 )
+
+	/* Set when the tick interrupt has left tasks whose wake time has passed in
+	the Blocked state because it had already unblocked configTICK_UNBLOCK_LIMIT
+	tasks.  The rest are unblocked by the tick unblock task. */
+	PRIVILEGED_DATA static volatile BaseType_t xTickUnblockDeferred	= pdFALSE;
+	PRIVILEGED_DATA static TaskHandle_t xTickUnblockTaskHandle		= NULL;
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+
+		PRIVILEGED_DATA static StaticTask_t xTickUnblockTaskTCB;
+		PRIVILEGED_DATA static StackType_t xTickUnblockTaskStack[ configTICK_UNBLOCK_TASK_STACK_DEPTH ];
+
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+	#define taskTICK_UNBLOCK_DEFERRED() ( xTickUnblockDeferred )
+
+#else
+
+	#define taskTICK_UNBLOCK_DEFERRED() ( pdFALSE )
+
+#endif /* configTICK_UNBLOCK_LIMIT */
+
+#if( configUSE_TASK_REGISTRY == 1 )
+
+	/* Every task that has not yet been freed, indexed by its uxRegistrySlot.
+	Slots freed by deleted tasks are reused before slots that have never been
+	used, so only the first uxTaskRegistrySlotsUsed slots need to be read. */
+	PRIVILEGED_DATA static TCB_t * volatile pxTaskRegistry[ configTASK_REGISTRY_SIZE ];
+	PRIVILEGED_DATA static UBaseType_t uxTaskRegistryFreeSlots[ configTASK_REGISTRY_SIZE ];
+	PRIVILEGED_DATA static UBaseType_t uxTaskRegistryFreeSlotCount	= ( UBaseType_t ) 0U;
+	PRIVILEGED_DATA static volatile UBaseType_t uxTaskRegistrySlotsUsed	= ( UBaseType_t ) 0U;
+
+	/* Incremented each time a task is added to or removed from the registry,
+	so two snapshots taken at the same generation hold the same tasks. */
+	PRIVILEGED_DATA static volatile UBaseType_t uxTaskRegistryGeneration	= ( UBaseType_t ) 0U;
+
+	/* The number of snapshots being taken.  The idle task does not free the
+	TCB or stack of a deleted task while it is non-zero. */
+	PRIVILEGED_DATA static volatile UBaseType_t uxTaskRegistryReaders	= ( UBaseType_t ) 0U;
+
+	/* The number of tasks created while the registry was full. */
+	PRIVILEGED_DATA static volatile UBaseType_t uxTaskRegistryDropped		= ( UBaseType_t ) 0U;
+
+	#define taskREGISTRY_SNAPSHOT_IN_PROGRESS() ( uxTaskRegistryReaders != ( UBaseType_t ) 0U )
+
+#else
+
+	#define taskREGISTRY_SNAPSHOT_IN_PROGRESS() ( pdFALSE )
+
+#endif /* configUSE_TASK_REGISTRY */
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/* The tasks of priority configEDF_PRIORITY that have deadline parameters,
+	held as a binary heap ordered by xDeadline so the task with the earliest
+	deadline is pxDeadlineHeap[ 0 ].  Like the ready lists, the heap is only
+	accessed from a critical section, from the tick interrupt, or with the
+	scheduler suspended.  A task is left in the heap when it leaves the ready
+	list - it is discarded when it reaches the top of the heap, and added again
+	when it next becomes ready.  The tasks of configEDF_PRIORITY that have no
+	deadline parameters are not in the heap, and run in turn from the ready
+	list when no task in the heap is ready. */
+	PRIVILEGED_DATA static TCB_t * pxDeadlineHeap[ configEDF_MAX_TASKS ];
+	PRIVILEGED_DATA static UBaseType_t uxDeadlineHeapSize = ( UBaseType_t ) 0U;
+
+	/* The number of tasks that have deadline parameters.  It is never more
+	than configEDF_MAX_TASKS, so there is always room in the heap. */
+	PRIVILEGED_DATA static UBaseType_t uxDeadlineTasks = ( UBaseType_t ) 0U;
+
+	#define taskNOT_IN_DEADLINE_HEAP	( ( UBaseType_t ) configEDF_MAX_TASKS )
+
+	/* Deadlines are compared by their difference, so the tick count can
+	overflow provided no two deadlines are more than half the range of
+	TickType_t apart. */
+	#define taskDEADLINE_IS_BEFORE( xA, xB ) ( ( TickType_t ) ( ( xA ) - ( xB ) ) > ( portMAX_DELAY >> 1 ) )
+
+	#define taskADD_TASK_TO_DEADLINE_HEAP( pxTCB ) prvAddTaskToDeadlineHeap( pxTCB );
+
+	/* The tasks in the heap are not time sliced.  prvDeadlineTick() switches
+	them out when another task has an earlier deadline. */
+	#define taskIS_TIME_SLICED( pxTCB ) ( ( pxTCB )->uxDeadlineHeapIndex == taskNOT_IN_DEADLINE_HEAP )
+
+#else
+
+	#define taskADD_TASK_TO_DEADLINE_HEAP( pxTCB )
+	#define taskIS_TIME_SLICED( pxTCB ) ( pdTRUE )
+
+#endif /* configUSE_EDF_SCHEDULING */
+
 /* Context switches are held pending while the scheduler is suspended.  Also,
 interrupts must not manipulate the xStateListItem of a TCB, or any of the
 lists the xStateListItem can be referenced from, if the scheduler is suspended.
@@ -261,7 +407,7 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) && ( configUSE_PRIORITY_BITMAP == 0 )
 
 	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
 	performed in a generic way that is not optimised to any particular
@@ -301,6 +447,96 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 	#define taskRESET_READY_PRIORITY( uxPriority )
 	#define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )
 
+#elif ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
+
+	/* If configUSE_PRIORITY_BITMAP is 1 then task selection uses a bitmap of the
+	priorities that have ready tasks, in a way that works on any port and takes
+	the same time however far apart the ready priorities are.  With up to 32
+	priorities bit n of uxTopReadyPriority is set while the ready list for
+	priority n is not empty.  With more, bit ( p % 32 ) of
+	ulReadyPriorities[ p / 32 ] is set while the ready list for priority p is
+	not empty, and bit n of uxTopReadyPriority is set while
+	ulReadyPriorities[ n ] is not zero. */
+	#ifdef portCOUNT_LEADING_ZEROS
+		#define taskCOUNT_LEADING_ZEROS( ulBitmap )	portCOUNT_LEADING_ZEROS( ulBitmap )
+	#else
+		#define taskCOUNT_LEADING_ZEROS( ulBitmap )	prvCountLeadingZeros( ulBitmap )
+	#endif
+
+	#define taskHIGHEST_SET_BIT( ulBitmap )	( ( UBaseType_t ) 31U - ( UBaseType_t ) taskCOUNT_LEADING_ZEROS( ( uint32_t ) ( ulBitmap ) ) )
+
+	/*-----------------------------------------------------------*/
+
+	#if ( configMAX_PRIORITIES <= 32 )
+
+		#define taskRECORD_READY_PRIORITY( uxPriority )	( uxTopReadyPriority ) |= ( 1UL << ( uxPriority ) )
+
+		/*-----------------------------------------------------------*/
+
+		#define taskSELECT_HIGHEST_PRIORITY_TASK()														\
+		{																								\
+		UBaseType_t uxTopPriority;																		\
+																										\
+			/* Find the highest priority queue that contains ready tasks. */							\
+			uxTopPriority = taskHIGHEST_SET_BIT( uxTopReadyPriority );									\
+			configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
+			listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
+
+		/*-----------------------------------------------------------*/
+
+		#define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority ) ( uxTopReadyPriority ) &= ~( 1UL << ( uxPriority ) )
+
+	#else /* configMAX_PRIORITIES */
+
+		PRIVILEGED_DATA static volatile uint32_t ulReadyPriorities[ ( configMAX_PRIORITIES + 31 ) / 32 ];
+
+		#define taskRECORD_READY_PRIORITY( uxPriority )													\
+		{																								\
+			ulReadyPriorities[ ( uxPriority ) >> 5U ] |= ( 1UL << ( ( uxPriority ) & 31U ) );				\
+			uxTopReadyPriority |= ( 1UL << ( ( uxPriority ) >> 5U ) );									\
+		}
+
+		/*-----------------------------------------------------------*/
+
+		#define taskSELECT_HIGHEST_PRIORITY_TASK()														\
+		{																								\
+		UBaseType_t uxTopPriority;																		\
+																										\
+			/* Find the highest word that has a bit set, then the highest bit						\
+			set in that word. */																		\
+			uxTopPriority = taskHIGHEST_SET_BIT( uxTopReadyPriority );									\
+			uxTopPriority = ( uxTopPriority << 5U ) + taskHIGHEST_SET_BIT( ulReadyPriorities[ uxTopPriority ] );	\
+			configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
+			listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
+
+		/*-----------------------------------------------------------*/
+
+		#define portRESET_READY_PRIORITY( uxPriority, uxTopReadyPriority )								\
+		{																								\
+			ulReadyPriorities[ ( uxPriority ) >> 5U ] &= ~( 1UL << ( ( uxPriority ) & 31U ) );			\
+			if( ulReadyPriorities[ ( uxPriority ) >> 5U ] == 0UL )										\
+			{																							\
+				( uxTopReadyPriority ) &= ~( 1UL << ( ( uxPriority ) >> 5U ) );						\
+			}																							\
+		}
+
+	#endif /* configMAX_PRIORITIES */
+
+	/*-----------------------------------------------------------*/
+
+	/* Only clear the bit if the TCB being reset was the last task in its ready
+	list.  If it is referenced from a delayed or suspended list then it won't be
+	in a ready list. */
+	#define taskRESET_READY_PRIORITY( uxPriority )													\
+	{																								\
+		if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) == 0 )				\
+		{																							\
+			portRESET_READY_PRIORITY( ( uxPriority ), ( uxTopReadyPriority ) );						\
+		}																							\
+	}
+
 #else /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
 
 	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 1 then task selection is
@@ -355,15 +591,32 @@ count overflows. */
 	prvResetNextTaskUnblockTime();																	\
 }
 
+#if( configUSE_TASK_DELAY_WHEEL == 1 )
+
+	/* The bucket that holds tasks that wake at tick xTime. */
+	#define taskDELAY_WHEEL_BUCKET( xTime ) ( &( xDelayedTaskWheel[ ( xTime ) & ( TickType_t ) ( configTASK_DELAY_WHEEL_SIZE - 1 ) ] ) )
+
+	/* Is pxList one of the lists that hold delayed tasks? */
+	#define taskIS_DELAYED_TASK_LIST( pxList ) ( ( ( ( pxList ) >= &( xDelayedTaskWheel[ 0 ] ) ) && ( ( pxList ) <= &( xDelayedTaskWheel[ configTASK_DELAY_WHEEL_SIZE - 1 ] ) ) ) || ( ( pxList ) == pxDelayedTaskList ) || ( ( pxList ) == pxOverflowDelayedTaskList ) )
+
+#else
+
+	/* Is pxList one of the lists that hold delayed tasks? */
+	#define taskIS_DELAYED_TASK_LIST( pxList ) ( ( ( pxList ) == pxDelayedTaskList ) || ( ( pxList ) == pxOverflowDelayedTaskList ) )
+
+#endif /* configUSE_TASK_DELAY_WHEEL */
+
 /*-----------------------------------------------------------*/
 
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
- * the task.  It is inserted at the end of the list.
+ * the task.  It is inserted at the end of the list.  Tasks of priority
+ * configEDF_PRIORITY are also placed in the deadline heap.
  */
 #define prvAddTaskToReadyList( pxTCB )																\
 	traceMOVED_TASK_TO_READY_STATE( pxTCB )															\
 	taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );												\
+	taskADD_TASK_TO_DEADLINE_HEAP( pxTCB )															\
 	vListInsertEnd( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xGenericListItem ) )
 /*-----------------------------------------------------------*/
 
@@ -432,6 +685,20 @@ static void prvInitialiseTaskLists( void ) PRIVILEGED_FUNCTION;
  */
 static portTASK_FUNCTION_PROTO( prvIdleTask, pvParameters );
 
+/*
+ * The tick unblock task, created automatically when the scheduler is started
+ * if configTICK_UNBLOCK_LIMIT is set.  It unblocks the tasks the tick
+ * interrupt left in the Blocked state, configTICK_UNBLOCK_LIMIT at a time,
+ * with interrupts enabled between each group.
+ *
+ * void prvTickUnblockTask( void *pvParameters );
+ */
+#if( configTICK_UNBLOCK_LIMIT > 0 )
+
+	static portTASK_FUNCTION_PROTO( prvTickUnblockTask, pvParameters );
+
+#endif /* configTICK_UNBLOCK_LIMIT */
+
 /*
  * Utility to free all memory allocated by the scheduler to hold a TCB,
  * including the stack pointed to by the TCB.
@@ -458,11 +725,40 @@ static void prvCheckTasksWaitingTermination( void ) PRIVILEGED_FUNCTION;
  */
 static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns the number of leading zero bits in ulBitmap, which must not be zero.
+ * Used by the priority bitmap when the port does not define
+ * portCOUNT_LEADING_ZEROS().
+ */
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) && ( configUSE_PRIORITY_BITMAP == 1 ) && !defined( portCOUNT_LEADING_ZEROS )
+
+	static UBaseType_t prvCountLeadingZeros( uint32_t ulBitmap ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Allocates memory from the heap for a TCB and associated stack.  Checks the
  * allocation was successful.
  */
-static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer ) PRIVILEGED_FUNCTION;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer, UBaseType_t uxStackHints ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called after a TCB and stack have been obtained, either from the heap or
+ * from buffers supplied by the application, to set up the initial state of the
+ * task.  Filling the stack with a known value is done here so it is done for
+ * both allocation methods.
+ */
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, TCB_t *pxNewTCB, const MemoryRegion_t * const xRegions ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+/*
+ * Called after a new task has been initialised to place the task under the
+ * control of the scheduler.
+ */
+static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB ) PRIVILEGED_FUNCTION;
 
 /*
  * Fills an TaskStatus_t structure with information on each task that is
@@ -478,6 +774,47 @@ static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t *
 
 #endif
 
+/*
+ * Fills the pxTaskStatusArray array by walking every task list with the
+ * scheduler suspended.  This is how uxTaskGetSystemState() finds the tasks if
+ * there is no task registry, or if the registry was ever too full to hold a
+ * task.
+ */
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	static UBaseType_t prvListAllTasks( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Add a task to, and remove a task from, the task registry.  Both are called
+ * from a critical section.
+ */
+#if ( configUSE_TASK_REGISTRY == 1 )
+
+	static void prvRegisterTask( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvUnregisterTask( TCB_t *pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Read the task registry one slot at a time.  prvBeginRegistrySnapshot()
+ * returns the number of slots to read, and prvReadRegistrySlot() fills
+ * *pxTaskStatus if the slot holds a task.  Between the two calls to
+ * prvBeginRegistrySnapshot() and prvEndRegistrySnapshot() the idle task will
+ * not free the memory of a deleted task, so the TCB and stack of each task
+ * read can be accessed without suspending the scheduler, and a slot cannot be
+ * reused - every task that exists for the whole snapshot is read once and once
+ * only.
+ */
+#if ( configUSE_TASK_REGISTRY == 1 )
+
+	static UBaseType_t prvBeginRegistrySnapshot( UBaseType_t *puxGeneration ) PRIVILEGED_FUNCTION;
+	static BaseType_t prvReadRegistrySlot( UBaseType_t uxSlot, TaskStatus_t *pxTaskStatus ) PRIVILEGED_FUNCTION;
+	static UBaseType_t prvEndRegistrySnapshot( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * When a task is created, the stack of the task is filled with a known value.
  * This function determines the 'high water mark' of the task stack by
@@ -510,170 +847,268 @@ static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t *
  */
 static void prvResetNextTaskUnblockTime( void );
 
-/*-----------------------------------------------------------*/
+/*
+ * Move the delayed tasks whose wake time is not after xConstTickCount to their
+ * ready lists, in the order of their wake times.  If uxLimit is not zero then
+ * at most uxLimit tasks are moved, and xTickUnblockDeferred is set if any
+ * others are left.  Returns pdTRUE if a task that should preempt the running
+ * task was unblocked, or if tasks were left and preemption is on.
+ */
+static BaseType_t prvUnblockDelayedTasks( const TickType_t xConstTickCount, const UBaseType_t uxLimit ) PRIVILEGED_FUNCTION;
 
-BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-BaseType_t xReturn;
-TCB_t * pxNewTCB;
+/*
+ * Move the calling task from the ready list to the appropriate blocked list
+ * while it waits for a notification.  Must be called from a critical section.
+ */
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	static void prvBlockCurrentTaskForNotification( const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+#endif
 
-	configASSERT( pxTaskCode );
-	configASSERT( ( ( uxPriority & ( ~portPRIVILEGE_BIT ) ) < configMAX_PRIORITIES ) );
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	/*
+	 * Add pxTCB to the deadline heap if it has priority configEDF_PRIORITY and
+	 * deadline parameters, and is not already in the heap, or remove it from
+	 * the heap, in O(log n) time.
+	 */
+	static void prvAddTaskToDeadlineHeap( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvRemoveTaskFromDeadlineHeap( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Change the deadline by which pxTCB is ordered, moving it within the
+	 * deadline heap if it is in the heap.
+	 */
+	static void prvSetTaskDeadline( TCB_t * const pxTCB, const TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Place pxTCB in the deadline heap, starting from index uxIndex and moving
+	 * towards the root, or towards the leaves, until the heap is ordered
+	 * again.
+	 */
+	static void prvDeadlineHeapSiftUp( UBaseType_t uxIndex, TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+	static void prvDeadlineHeapSiftDown( UBaseType_t uxIndex, TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called by vTaskSwitchContext() when the highest priority ready task has
+	 * priority configEDF_PRIORITY.  Discards the tasks at the top of the
+	 * deadline heap that are no longer ready, then returns the ready task with
+	 * the earliest deadline.
+	 */
+	static TCB_t *prvSelectEarliestDeadlineTask( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called by xTaskIncrementTick() to charge the tick to the running task's
+	 * budget.  Returns pdTRUE if preemption is used and a context switch is
+	 * required because another ready task now has an earlier deadline than the
+	 * running task.
+	 */
+	static BaseType_t prvDeadlineTick( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_EDF_SCHEDULING */
 
-	/* Allocate the memory required by the TCB and stack for the new task,
-	checking that the allocation was successful. */
-	pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer );
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 
-	if( pxNewTCB != NULL )
+	TaskHandle_t xTaskCreateStatic( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, StackType_t * const puxStackBuffer, StaticTask_t * const pxTaskBuffer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		StackType_t *pxTopOfStack;
+	TCB_t *pxNewTCB;
+	TaskHandle_t xReturn;
 
-		#if( portUSING_MPU_WRAPPERS == 1 )
-			/* Should the task be created in privileged mode? */
-			BaseType_t xRunPrivileged;
-			if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
-			{
-				xRunPrivileged = pdTRUE;
-			}
-			else
-			{
-				xRunPrivileged = pdFALSE;
-			}
-			uxPriority &= ~portPRIVILEGE_BIT;
-		#endif /* portUSING_MPU_WRAPPERS == 1 */
+		configASSERT( pxTaskCode );
+		configASSERT( ( ( uxPriority & ( ~portPRIVILEGE_BIT ) ) < configMAX_PRIORITIES ) );
+		configASSERT( puxStackBuffer != NULL );
+		configASSERT( pxTaskBuffer != NULL );
 
-		/* Calculate the top of stack address.  This depends on whether the
-		stack grows from high memory to low (as per the 80x86) or vice versa.
-		portSTACK_GROWTH is used to make the result positive or negative as
-		required by the port. */
-		#if( portSTACK_GROWTH < 0 )
+		/* The StaticTask_t structure must be exactly the same size as the real
+		TCB, otherwise the application has been built with a different
+		configuration to the kernel. */
+		configASSERT( sizeof( StaticTask_t ) == sizeof( TCB_t ) );
+
+		if( ( pxTaskBuffer != NULL ) && ( puxStackBuffer != NULL ) )
 		{
-			pxTopOfStack = pxNewTCB->pxStack + ( usStackDepth - ( uint16_t ) 1 );
-			pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ( portPOINTER_SIZE_TYPE ) ~portBYTE_ALIGNMENT_MASK  ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
+			/* The memory used for the task's TCB and stack are passed into this
+			function - use them. */
+			pxNewTCB = ( TCB_t * ) pxTaskBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
+			pxNewTCB->pxStack = ( StackType_t * ) puxStackBuffer;
+
+			#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+			{
+				/* Tasks can be created statically or dynamically, so note this
+				task was created statically in case the task is later deleted. */
+				pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_AND_TCB;
+			}
+			#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
-			/* Check the alignment of the calculated top of stack is correct. */
-			configASSERT( ( ( ( uint32_t ) pxTopOfStack & ( uint32_t ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+			prvInitialiseNewTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xReturn, pxNewTCB, NULL );
+			prvAddNewTaskToReadyList( pxNewTCB );
 		}
-		#else /* portSTACK_GROWTH */
+		else
 		{
-			pxTopOfStack = pxNewTCB->pxStack;
+			xReturn = NULL;
+			traceTASK_CREATE_FAILED();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
 
-			/* Check the alignment of the stack buffer is correct. */
-			configASSERT( ( ( ( uint32_t ) pxNewTCB->pxStack & ( uint32_t ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-			/* If we want to use stack checking on architectures that use
-			a positive stack growth direction then we also need to store the
-			other extreme of the stack space. */
-			pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( usStackDepth - 1 );
-		}
-		#endif /* portSTACK_GROWTH */
+	BaseType_t xTaskGenericCreate( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, StackType_t * const puxStackBuffer, const MemoryRegion_t * const xRegions, UBaseType_t uxStackHints ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+	{
+	BaseType_t xReturn;
+	TCB_t * pxNewTCB;
 
-		/* Setup the newly allocated TCB with the initial state of the task. */
-		prvInitialiseTCBVariables( pxNewTCB, pcName, uxPriority, xRegions, usStackDepth );
+		configASSERT( pxTaskCode );
+		configASSERT( ( ( uxPriority & ( ~portPRIVILEGE_BIT ) ) < configMAX_PRIORITIES ) );
 
-		/* Initialize the TCB stack to look as if the task was already running,
-		but had been interrupted by the scheduler.  The return address is set
-		to the start of the task function. Once the stack has been initialised
-		the	top of stack variable is updated. */
-		#if( portUSING_MPU_WRAPPERS == 1 )
+		/* Allocate the memory required by the TCB and stack for the new task,
+		checking that the allocation was successful. */
+		pxNewTCB = prvAllocateTCBAndStack( usStackDepth, puxStackBuffer, uxStackHints );
+
+		if( pxNewTCB != NULL )
 		{
-			pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+			#if( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+			{
+				/* Tasks can be created statically or dynamically, so note
+				which parts of this task's memory must be freed should the task
+				later be deleted. */
+				if( puxStackBuffer != NULL )
+				{
+					pxNewTCB->ucStaticallyAllocated = tskSTATICALLY_ALLOCATED_STACK_ONLY;
+				}
+				else
+				{
+					pxNewTCB->ucStaticallyAllocated = tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB;
+				}
+			}
+			#endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
+
+			prvInitialiseNewTask( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, xRegions );
+			prvAddNewTaskToReadyList( pxNewTCB );
+			xReturn = pdPASS;
 		}
-		#else /* portUSING_MPU_WRAPPERS */
+		else
 		{
-			pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+			xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+			traceTASK_CREATE_FAILED();
 		}
-		#endif /* portUSING_MPU_WRAPPERS */
 
-		if( ( void * ) pxCreatedTask != NULL )
+		return xReturn;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewTask( TaskFunction_t pxTaskCode, const char * const pcName, const uint16_t usStackDepth, void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask, TCB_t *pxNewTCB, const MemoryRegion_t * const xRegions ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+StackType_t *pxTopOfStack;
+
+	#if( portUSING_MPU_WRAPPERS == 1 )
+		/* Should the task be created in privileged mode? */
+		BaseType_t xRunPrivileged;
+		if( ( uxPriority & portPRIVILEGE_BIT ) != 0U )
 		{
-			/* Pass the TCB out - in an anonymous way.  The calling function/
-			task can use this as a handle to delete the task later if
-			required.*/
-			*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
+			xRunPrivileged = pdTRUE;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			xRunPrivileged = pdFALSE;
 		}
+		uxPriority &= ~portPRIVILEGE_BIT;
+	#endif /* portUSING_MPU_WRAPPERS == 1 */
 
-		/* Ensure interrupts don't access the task lists while they are being
-		updated. */
-		taskENTER_CRITICAL();
-		{
-			uxCurrentNumberOfTasks++;
-			if( pxCurrentTCB == NULL )
-			{
-				/* There are no other tasks, or all the other tasks are in
-				the suspended state - make this the current task. */
-				pxCurrentTCB =  pxNewTCB;
+	/* Avoid dependency on memset() if it is not required. */
+	#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+	{
+		/* Fill the stack with a known value to assist debugging.  This is done
+		here, rather than when the stack is allocated, so statically allocated
+		stacks are filled too. */
+		( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( StackType_t ) );
+	}
+	#endif /* ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) ) */
 
-				if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
-				{
-					/* This is the first task to be created so do the preliminary
-					initialisation required.  We will not recover if this call
-					fails, but we will report the failure. */
-					prvInitialiseTaskLists();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-			}
-			else
-			{
-				/* If the scheduler is not already running, make this task the
-				current task if it is the highest priority task to be created
-				so far. */
-				if( xSchedulerRunning == pdFALSE )
-				{
-					if( pxCurrentTCB->uxPriority <= uxPriority )
-					{
-						pxCurrentTCB = pxNewTCB;
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-			}
+	/* Calculate the top of stack address.  This depends on whether the
+	stack grows from high memory to low (as per the 80x86) or vice versa.
+	portSTACK_GROWTH is used to make the result positive or negative as
+	required by the port. */
+	#if( portSTACK_GROWTH < 0 )
+	{
+		pxTopOfStack = pxNewTCB->pxStack + ( usStackDepth - ( uint16_t ) 1 );
+		pxTopOfStack = ( StackType_t * ) ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack ) & ( ( portPOINTER_SIZE_TYPE ) ~portBYTE_ALIGNMENT_MASK  ) ); /*lint !e923 MISRA exception.  Avoiding casts between pointers and integers is not practical.  Size differences accounted for using portPOINTER_SIZE_TYPE type. */
 
-			uxTaskNumber++;
+		/* Check the alignment of the calculated top of stack is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxTopOfStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
+	}
+	#else /* portSTACK_GROWTH */
+	{
+		pxTopOfStack = pxNewTCB->pxStack;
 
-			#if ( configUSE_TRACE_FACILITY == 1 )
-			{
-				/* Add a counter into the TCB for tracing only. */
-				pxNewTCB->uxTCBNumber = uxTaskNumber;
-			}
-			#endif /* configUSE_TRACE_FACILITY */
-			traceTASK_CREATE( pxNewTCB );
+		/* Check the alignment of the stack buffer is correct. */
+		configASSERT( ( ( ( portPOINTER_SIZE_TYPE ) pxNewTCB->pxStack & ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK ) == 0UL ) );
 
-			prvAddTaskToReadyList( pxNewTCB );
+		/* If we want to use stack checking on architectures that use
+		a positive stack growth direction then we also need to store the
+		other extreme of the stack space. */
+		pxNewTCB->pxEndOfStack = pxNewTCB->pxStack + ( usStackDepth - 1 );
+	}
+	#endif /* portSTACK_GROWTH */
 
-			xReturn = pdPASS;
-			portSETUP_TCB( pxNewTCB );
-		}
-		taskEXIT_CRITICAL();
+	/* Setup the newly allocated TCB with the initial state of the task. */
+	prvInitialiseTCBVariables( pxNewTCB, pcName, uxPriority, xRegions, usStackDepth );
+
+	/* Initialize the TCB stack to look as if the task was already running,
+	but had been interrupted by the scheduler.  The return address is set
+	to the start of the task function. Once the stack has been initialised
+	the	top of stack variable is updated. */
+	#if( portUSING_MPU_WRAPPERS == 1 )
+	{
+		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters, xRunPrivileged );
+	}
+	#else /* portUSING_MPU_WRAPPERS */
+	{
+		pxNewTCB->pxTopOfStack = pxPortInitialiseStack( pxTopOfStack, pxTaskCode, pvParameters );
+	}
+	#endif /* portUSING_MPU_WRAPPERS */
+
+	if( ( void * ) pxCreatedTask != NULL )
+	{
+		/* Pass the TCB out - in an anonymous way.  The calling function/
+		task can use this as a handle to delete the task later if
+		required.*/
+		*pxCreatedTask = ( TaskHandle_t ) pxNewTCB;
 	}
 	else
 	{
-		xReturn = errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
-		traceTASK_CREATE_FAILED();
+		mtCOVERAGE_TEST_MARKER();
 	}
+}
+/*-----------------------------------------------------------*/
 
-	if( xReturn == pdPASS )
+static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
+{
+	/* Ensure interrupts don't access the task lists while they are being
+	updated. */
+	taskENTER_CRITICAL();
 	{
-		if( xSchedulerRunning != pdFALSE )
+		uxCurrentNumberOfTasks++;
+		if( pxCurrentTCB == NULL )
 		{
-			/* If the created task is of a higher priority than the current task
-			then it should run now. */
-			if( pxCurrentTCB->uxPriority < uxPriority )
+			/* There are no other tasks, or all the other tasks are in
+			the suspended state - make this the current task. */
+			pxCurrentTCB =  pxNewTCB;
+
+			if( uxCurrentNumberOfTasks == ( UBaseType_t ) 1 )
 			{
-				taskYIELD_IF_USING_PREEMPTION();
+				/* This is the first task to be created so do the preliminary
+				initialisation required.  We will not recover if this call
+				fails, but we will report the failure. */
+				prvInitialiseTaskLists();
 			}
 			else
 			{
@@ -682,17 +1117,71 @@ TCB_t * pxNewTCB;
 		}
 		else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			/* If the scheduler is not already running, make this task the
+			current task if it is the highest priority task to be created
+			so far. */
+			if( xSchedulerRunning == pdFALSE )
+			{
+				if( pxCurrentTCB->uxPriority <= pxNewTCB->uxPriority )
+				{
+					pxCurrentTCB = pxNewTCB;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-	}
 
-	return xReturn;
-}
-/*-----------------------------------------------------------*/
+		uxTaskNumber++;
 
-#if ( INCLUDE_vTaskDelete == 1 )
+		#if ( configUSE_TRACE_FACILITY == 1 )
+		{
+			/* Add a counter into the TCB for tracing only. */
+			pxNewTCB->uxTCBNumber = uxTaskNumber;
+		}
+		#endif /* configUSE_TRACE_FACILITY */
 
-	void vTaskDelete( TaskHandle_t xTaskToDelete )
+		#if ( configUSE_TASK_REGISTRY == 1 )
+		{
+			prvRegisterTask( pxNewTCB );
+		}
+		#endif /* configUSE_TASK_REGISTRY */
+		traceTASK_CREATE( pxNewTCB );
+
+		prvAddTaskToReadyList( pxNewTCB );
+
+		portSETUP_TCB( pxNewTCB );
+	}
+	taskEXIT_CRITICAL();
+
+	if( xSchedulerRunning != pdFALSE )
+	{
+		/* If the created task is of a higher priority than the current task
+		then it should run now. */
+		if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+		{
+			taskYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelete == 1 )
+
+	void vTaskDelete( TaskHandle_t xTaskToDelete )
 	{
 	TCB_t *pxTCB;
 
@@ -725,6 +1214,22 @@ TCB_t * pxNewTCB;
 				mtCOVERAGE_TEST_MARKER();
 			}
 
+			#if ( configUSE_EDF_SCHEDULING == 1 )
+			{
+				prvRemoveTaskFromDeadlineHeap( pxTCB );
+
+				/* Let another task be given deadline parameters. */
+				if( pxTCB->xPeriod != ( TickType_t ) 0U )
+				{
+					uxDeadlineTasks--;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
+
 			vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xGenericListItem ) );
 
 			/* Increment the ucTasksDeleted variable so the idle task knows
@@ -953,7 +1458,7 @@ TCB_t * pxNewTCB;
 			}
 			taskEXIT_CRITICAL();
 
-			if( ( pxStateList == pxDelayedTaskList ) || ( pxStateList == pxOverflowDelayedTaskList ) )
+			if( taskIS_DELAYED_TASK_LIST( pxStateList ) )
 			{
 				/* The task being queried is referenced from one of the Blocked
 				lists. */
@@ -1166,6 +1671,21 @@ TCB_t * pxNewTCB;
 					mtCOVERAGE_TEST_MARKER();
 				}
 
+				#if ( configUSE_EDF_SCHEDULING == 1 )
+				{
+					/* A task that leaves configEDF_PRIORITY no longer needs
+					its place in the deadline heap. */
+					if( pxTCB->uxPriority != ( UBaseType_t ) configEDF_PRIORITY )
+					{
+						prvRemoveTaskFromDeadlineHeap( pxTCB );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_EDF_SCHEDULING */
+
 				if( xYieldRequired == pdTRUE )
 				{
 					taskYIELD_IF_USING_PREEMPTION();
@@ -1448,18 +1968,75 @@ void vTaskStartScheduler( void )
 BaseType_t xReturn;
 
 	/* Add the idle task at the lowest priority. */
-	#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+	#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+	{
+	StaticTask_t *pxIdleTaskTCBBuffer = NULL;
+	StackType_t *pxIdleTaskStackBuffer = NULL;
+	uint16_t usIdleTaskStackSize = tskIDLE_STACK_SIZE;
+	TaskHandle_t xIdleHandle;
+
+		/* The idle task is created using memory provided by the application -
+		obtain the address of the memory then create the idle task. */
+		vApplicationGetIdleTaskMemory( &pxIdleTaskTCBBuffer, &pxIdleTaskStackBuffer, &usIdleTaskStackSize );
+		xIdleHandle = xTaskCreateStatic( prvIdleTask, "IDLE", usIdleTaskStackSize, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), pxIdleTaskStackBuffer, pxIdleTaskTCBBuffer ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+
+		if( xIdleHandle != NULL )
+		{
+			#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+			{
+				/* Store the handle so it can be returned by the
+				xTaskGetIdleTaskHandle() function. */
+				xIdleTaskHandle = xIdleHandle;
+			}
+			#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+
+			xReturn = pdPASS;
+		}
+		else
+		{
+			xReturn = pdFAIL;
+		}
+	}
+	#else /* configSUPPORT_STATIC_ALLOCATION */
 	{
-		/* Create the idle task, storing its handle in xIdleTaskHandle so it can
-		be returned by the xTaskGetIdleTaskHandle() function. */
-		xReturn = xTaskCreate( prvIdleTask, "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		#if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
+		{
+			/* Create the idle task, storing its handle in xIdleTaskHandle so it
+			can be returned by the xTaskGetIdleTaskHandle() function. */
+			xReturn = xTaskCreate( prvIdleTask, "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), &xIdleTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		}
+		#else
+		{
+			/* Create the idle task without storing its handle. */
+			xReturn = xTaskCreate( prvIdleTask, "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), NULL );  /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		}
+		#endif /* INCLUDE_xTaskGetIdleTaskHandle */
 	}
-	#else
+	#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+	#if( configTICK_UNBLOCK_LIMIT > 0 )
 	{
-		/* Create the idle task without storing its handle. */
-		xReturn = xTaskCreate( prvIdleTask, "IDLE", tskIDLE_STACK_SIZE, ( void * ) NULL, ( tskIDLE_PRIORITY | portPRIVILEGE_BIT ), NULL );  /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+		if( xReturn == pdPASS )
+		{
+			/* Add the task that unblocks the tasks the tick interrupt leaves
+			in the Blocked state. */
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				xReturn = xTaskCreate( prvTickUnblockTask, "TickUnblk", configTICK_UNBLOCK_TASK_STACK_DEPTH, ( void * ) NULL, ( configTICK_UNBLOCK_TASK_PRIORITY | portPRIVILEGE_BIT ), &xTickUnblockTaskHandle ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+			}
+			#else
+			{
+				xTickUnblockTaskHandle = xTaskCreateStatic( prvTickUnblockTask, "TickUnblk", configTICK_UNBLOCK_TASK_STACK_DEPTH, ( void * ) NULL, ( configTICK_UNBLOCK_TASK_PRIORITY | portPRIVILEGE_BIT ), xTickUnblockTaskStack, &xTickUnblockTaskTCB ); /*lint !e961 MISRA exception, justified as it is not a redundant explicit cast to all supported compilers. */
+				xReturn = ( xTickUnblockTaskHandle != NULL ) ? pdPASS : pdFAIL;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
-	#endif /* INCLUDE_xTaskGetIdleTaskHandle */
+	#endif /* configTICK_UNBLOCK_LIMIT */
 
 	#if ( configUSE_TIMERS == 1 )
 	{
@@ -1492,7 +2069,7 @@ BaseType_t xReturn;
 		#endif /* configUSE_NEWLIB_REENTRANT */
 
 		xSchedulerRunning = pdTRUE;
-		xTickCount = ( TickType_t ) 0U;
+		xTickCount = ( TickType_t ) configINITIAL_TICK_COUNT;
 
 		/* If configGENERATE_RUN_TIME_STATS is defined then the following
 		macro must be defined to configure the timer/counter used to generate
@@ -1514,8 +2091,8 @@ BaseType_t xReturn;
 	else
 	{
 		/* This line will only be reached if the kernel could not be started,
-		because there was not enough FreeRTOS heap to create the idle task
-		or the timer task. */
+		because there was not enough FreeRTOS heap to create the idle task,
+		the tick unblock task or the timer task. */
 		configASSERT( xReturn );
 	}
 }
@@ -1559,6 +2136,12 @@ void vTaskSuspendAll( void )
 			processed. */
 			xReturn = 0;
 		}
+		else if( taskTICK_UNBLOCK_DEFERRED() != pdFALSE )
+		{
+			/* There are tasks waiting to be unblocked by the next context
+			switch. */
+			xReturn = 0;
+		}
 		else
 		{
 			xReturn = xNextTaskUnblockTime - xTickCount;
@@ -1732,78 +2315,188 @@ UBaseType_t uxTaskGetNumberOfTasks( void )
 #endif /* INCLUDE_pcTaskGetTaskName */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_TRACE_FACILITY == 1 )
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_TASK_REGISTRY == 0 ) )
 
 	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
 	{
-	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+		return prvListAllTasks( pxTaskStatusArray, uxArraySize, pulTotalRunTime );
+	}
 
-		vTaskSuspendAll();
-		{
-			/* Is there a space in the array for each task in the system? */
-			if( uxArraySize >= uxCurrentNumberOfTasks )
-			{
-				/* Fill in an TaskStatus_t structure with information on each
-				task in the Ready state. */
-				do
-				{
-					uxQueue--;
-					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+#endif /* ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_TASK_REGISTRY == 0 ) */
+/*----------------------------------------------------------*/
 
-				} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+#if ( configUSE_TASK_REGISTRY == 1 )
 
-				/* Fill in an TaskStatus_t structure with information on each
-				task in the Blocked state. */
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
-				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+	UBaseType_t uxTaskGetSystemState( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
+	{
+	UBaseType_t uxTask = 0, uxSlot, uxSlots, uxGeneration;
 
-				#if( INCLUDE_vTaskDelete == 1 )
+		if( uxTaskRegistryDropped != ( UBaseType_t ) 0U )
+		{
+			/* A task was created while the registry was full, so reading the
+			registry would miss it.  Walk the task lists instead. */
+			uxTask = prvListAllTasks( pxTaskStatusArray, uxArraySize, pulTotalRunTime );
+		}
+		else if( uxArraySize >= uxCurrentNumberOfTasks )
+		{
+			/* There is space in the array for each task in the system. */
+			/* Tasks are read one at a time, each within its own short critical
+			section, so the scheduler is never suspended.  Tasks created while
+			the registry is read can take their number beyond the size of the
+			array, so stop if the array fills. */
+			uxSlots = prvBeginRegistrySnapshot( &uxGeneration );
+			{
+				for( uxSlot = ( UBaseType_t ) 0U; ( uxSlot < uxSlots ) && ( uxTask < uxArraySize ); uxSlot++ )
 				{
-					/* Fill in an TaskStatus_t structure with information on
-					each task that has been deleted but not yet cleaned up. */
-					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
+					if( prvReadRegistrySlot( uxSlot, &( pxTaskStatusArray[ uxTask ] ) ) != pdFALSE )
+					{
+						uxTask++;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
-				#endif
+			}
+			( void ) prvEndRegistrySnapshot();
 
-				#if ( INCLUDE_vTaskSuspend == 1 )
+			#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			{
+				if( pulTotalRunTime != NULL )
 				{
-					/* Fill in an TaskStatus_t structure with information on
-					each task in the Suspended state. */
-					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
+					#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+						portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+					#else
+						*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+					#endif
 				}
-				#endif
+			}
+			#else
+			{
+				if( pulTotalRunTime != NULL )
+				{
+					*pulTotalRunTime = 0;
+				}
+			}
+			#endif
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 
-				#if ( configGENERATE_RUN_TIME_STATS == 1)
+		return uxTask;
+	}
+
+#endif /* configUSE_TASK_REGISTRY */
+/*----------------------------------------------------------*/
+
+#if ( configUSE_TASK_REGISTRY == 1 )
+
+	UBaseType_t uxTaskGetRegistryGeneration( void )
+	{
+		/* A single word read, so no critical section is needed. */
+		return uxTaskRegistryGeneration;
+	}
+
+#endif /* configUSE_TASK_REGISTRY */
+/*----------------------------------------------------------*/
+
+#if ( configUSE_TASK_REGISTRY == 1 )
+
+	size_t xTaskRegistryExport( void *pvBuffer, size_t xBufferSize )
+	{
+	TaskRegistryExportHeader_t xHeader;
+	TaskRegistryExportRecord_t xRecord;
+	TaskStatus_t xTaskStatus;
+	uint8_t *pucBuffer = ( uint8_t * ) pvBuffer;
+	size_t xWritten = ( size_t ) 0, x;
+	UBaseType_t uxSlot, uxSlots, uxGeneration;
+
+		configASSERT( pvBuffer );
+
+		if( xBufferSize >= sizeof( TaskRegistryExportHeader_t ) )
+		{
+			/* The header is written last, once the number of tasks that fit
+			is known. */
+			xWritten = sizeof( TaskRegistryExportHeader_t );
+			xHeader.ulTaskCount = 0UL;
+
+			uxSlots = prvBeginRegistrySnapshot( &uxGeneration );
+			{
+				xHeader.ulGenerationStart = ( uint32_t ) uxGeneration;
+
+				for( uxSlot = ( UBaseType_t ) 0U; ( uxSlot < uxSlots ) && ( ( xWritten + sizeof( TaskRegistryExportRecord_t ) ) <= xBufferSize ); uxSlot++ )
 				{
-					if( pulTotalRunTime != NULL )
+					if( prvReadRegistrySlot( uxSlot, &xTaskStatus ) != pdFALSE )
 					{
-						#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
-							portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
-						#else
-							*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
-						#endif
+						xRecord.ullHandle = ( uint64_t ) ( portPOINTER_SIZE_TYPE ) xTaskStatus.xHandle;
+						xRecord.ulTaskNumber = ( uint32_t ) xTaskStatus.xTaskNumber;
+						xRecord.ulState = ( uint32_t ) xTaskStatus.eCurrentState;
+						xRecord.ulCurrentPriority = ( uint32_t ) xTaskStatus.uxCurrentPriority;
+						xRecord.ulBasePriority = ( uint32_t ) xTaskStatus.uxBasePriority;
+						xRecord.ulRunTimeCounter = xTaskStatus.ulRunTimeCounter;
+						xRecord.ulStackHighWaterMark = ( uint32_t ) xTaskStatus.usStackHighWaterMark;
+
+						/* The TCB cannot be freed until the snapshot ends, so
+						the name can still be read. */
+						for( x = ( size_t ) 0; ( x < ( size_t ) taskREGISTRY_NAME_LENGTH ) && ( x < ( size_t ) configMAX_TASK_NAME_LEN ); x++ )
+						{
+							if( xTaskStatus.pcTaskName[ x ] == 0x00 )
+							{
+								break;
+							}
+
+							xRecord.cName[ x ] = xTaskStatus.pcTaskName[ x ];
+						}
+
+						for( ; x < ( size_t ) taskREGISTRY_NAME_LENGTH; x++ )
+						{
+							xRecord.cName[ x ] = 0x00;
+						}
+
+						memcpy( &( pucBuffer[ xWritten ] ), &xRecord, sizeof( TaskRegistryExportRecord_t ) );
+						xWritten += sizeof( TaskRegistryExportRecord_t );
+						xHeader.ulTaskCount++;
 					}
-				}
-				#else
-				{
-					if( pulTotalRunTime != NULL )
+					else
 					{
-						*pulTotalRunTime = 0;
+						mtCOVERAGE_TEST_MARKER();
 					}
 				}
+			}
+			xHeader.ulGenerationEnd = ( uint32_t ) prvEndRegistrySnapshot();
+
+			xHeader.ulMagic = taskREGISTRY_MAGIC;
+			xHeader.ulVersion = taskREGISTRY_VERSION;
+			xHeader.ulTasksDropped = ( uint32_t ) uxTaskRegistryDropped;
+			xHeader.ulTickCount = ( uint32_t ) xTaskGetTickCount();
+
+			#if ( configGENERATE_RUN_TIME_STATS == 1 )
+			{
+				#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+					portALT_GET_RUN_TIME_COUNTER_VALUE( xHeader.ulTotalRunTime );
+				#else
+					xHeader.ulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
 				#endif
 			}
-			else
+			#else
 			{
-				mtCOVERAGE_TEST_MARKER();
+				xHeader.ulTotalRunTime = 0UL;
 			}
+			#endif
+
+			memcpy( pucBuffer, &xHeader, sizeof( TaskRegistryExportHeader_t ) );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
 		}
-		( void ) xTaskResumeAll();
 
-		return uxTask;
+		return xWritten;
 	}
 
-#endif /* configUSE_TRACE_FACILITY */
+#endif /* configUSE_TASK_REGISTRY */
 /*----------------------------------------------------------*/
 
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
@@ -1840,8 +2533,6 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 
 BaseType_t xTaskIncrementTick( void )
 {
-TCB_t * pxTCB;
-TickType_t xItemValue;
 BaseType_t xSwitchRequired = pdFALSE;
 
 	/* Called by the portable layer each time a tick interrupt occurs.
@@ -1861,6 +2552,24 @@ BaseType_t xSwitchRequired = pdFALSE;
 
 			if( xConstTickCount == ( TickType_t ) 0U )
 			{
+				#if( configTICK_UNBLOCK_LIMIT > 0 )
+				{
+					/* Every task due before the tick count overflowed has
+					to be unblocked before the delayed lists are switched.  The
+					limit cannot be kept to here, but this can only happen on
+					the tick the tick count overflows, and only if the tick
+					unblock task has not yet caught up. */
+					if( xTickUnblockDeferred != pdFALSE )
+					{
+						( void ) prvUnblockDelayedTasks( ( TickType_t ) ( xConstTickCount - ( TickType_t ) 1U ), ( UBaseType_t ) 0U );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configTICK_UNBLOCK_LIMIT */
+
 				taskSWITCH_DELAYED_LISTS();
 			}
 			else
@@ -1868,86 +2577,43 @@ BaseType_t xSwitchRequired = pdFALSE;
 				mtCOVERAGE_TEST_MARKER();
 			}
 
-			/* See if this tick has made a timeout expire.  Tasks are stored in
-			the	queue in the order of their wake time - meaning once one task
-			has been found whose block time has not expired there is no need to
-			look any further	down the list. */
-			if( xConstTickCount >= xNextTaskUnblockTime )
+			/* See if this tick has made a timeout expire.  With
+			configTICK_UNBLOCK_LIMIT set, at most that many tasks are
+			unblocked here and the rest are left to the tick unblock task, so
+			the time taken by the tick does not depend on how many tasks share
+			a wake time.  The tick unblock task also unblocks at most that many
+			tasks at a time, with interrupts enabled in between. */
+			if( ( xConstTickCount >= xNextTaskUnblockTime ) || ( taskTICK_UNBLOCK_DEFERRED() != pdFALSE ) )
 			{
-				for( ;; )
+				if( prvUnblockDelayedTasks( xConstTickCount, ( UBaseType_t ) configTICK_UNBLOCK_LIMIT ) != pdFALSE )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				#if( configTICK_UNBLOCK_LIMIT > 0 )
 				{
-					if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+					if( xTickUnblockDeferred != pdFALSE )
 					{
-						/* The delayed list is empty.  Set xNextTaskUnblockTime
-						to the maximum possible value so it is extremely
-						unlikely that the
-						if( xTickCount >= xNextTaskUnblockTime ) test will pass
-						next time through. */
-						xNextTaskUnblockTime = portMAX_DELAY;
-						break;
+						vTaskNotifyGiveFromISR( xTickUnblockTaskHandle, NULL );
 					}
 					else
 					{
-						/* The delayed list is not empty, get the value of the
-						item at the head of the delayed list.  This is the time
-						at which the task at the head of the delayed list must
-						be removed from the Blocked state. */
-						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-						xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
-
-						if( xConstTickCount < xItemValue )
-						{
-							/* It is not time to unblock this item yet, but the
-							item value is the time at which the task at the head
-							of the blocked list must be removed from the Blocked
-							state -	so record the item value in
-							xNextTaskUnblockTime. */
-							xNextTaskUnblockTime = xItemValue;
-							break;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-
-						/* It is time to remove the item from the Blocked state. */
-						( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
-
-						/* Is the task waiting on an event also?  If so remove
-						it from the event list. */
-						if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
-						{
-							( void ) uxListRemove( &( pxTCB->xEventListItem ) );
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-
-						/* Place the unblocked task into the appropriate ready
-						list. */
-						prvAddTaskToReadyList( pxTCB );
-
-						/* A task being unblocked cannot cause an immediate
-						context switch if preemption is turned off. */
-						#if (  configUSE_PREEMPTION == 1 )
-						{
-							/* Preemption is on, but a context switch should
-							only be performed if the unblocked task has a
-							priority that is equal to or higher than the
-							currently executing task. */
-							if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
-							{
-								xSwitchRequired = pdTRUE;
-							}
-							else
-							{
-								mtCOVERAGE_TEST_MARKER();
-							}
-						}
-						#endif /* configUSE_PREEMPTION */
+						mtCOVERAGE_TEST_MARKER();
 					}
 				}
+				#endif /* configTICK_UNBLOCK_LIMIT */
+			}
+			else
+			{
+				#if( configUSE_TASK_DELAY_WHEEL == 1 )
+				{
+					xDelayWheelTick = xConstTickCount;
+				}
+				#endif /* configUSE_TASK_DELAY_WHEEL */
 			}
 		}
 
@@ -1956,7 +2622,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 		writer has not explicitly turned time slicing off. */
 		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
 		{
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+			if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) && ( taskIS_TIME_SLICED( pxCurrentTCB ) != pdFALSE ) )
 			{
 				xSwitchRequired = pdTRUE;
 			}
@@ -1967,6 +2633,22 @@ BaseType_t xSwitchRequired = pdFALSE;
 		}
 		#endif /* ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
+		#if ( configUSE_EDF_SCHEDULING == 1 )
+		{
+			/* Tasks of priority configEDF_PRIORITY that are made ready by an
+			event, rather than by the tick, preempt the running task at the
+			next tick if they have an earlier deadline. */
+			if( prvDeadlineTick() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_EDF_SCHEDULING */
+
 		#if ( configUSE_TICK_HOOK == 1 )
 		{
 			/* Guard against the tick hook being called when the pended tick
@@ -2147,8 +2829,23 @@ void vTaskSwitchContext( void )
 
 		taskSELECT_HIGHEST_PRIORITY_TASK();
 
-		traceTASK_SWITCHED_IN();
-
+		#if ( configUSE_EDF_SCHEDULING == 1 )
+		{
+			/* The tasks of priority configEDF_PRIORITY run in deadline order,
+			not in turn. */
+			if( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY )
+			{
+				pxCurrentTCB = prvSelectEarliestDeadlineTask();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_EDF_SCHEDULING */
+
+		traceTASK_SWITCHED_IN();
+
 		#if ( configUSE_NEWLIB_REENTRANT == 1 )
 		{
 			/* Switch Newlib's _impure_ptr variable to point to the _reent
@@ -2644,6 +3341,46 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
 }
 /*-----------------------------------------------------------*/
 
+#if( configTICK_UNBLOCK_LIMIT > 0 )
+
+	static portTASK_FUNCTION( prvTickUnblockTask, pvParameters )
+	{
+		/* Stop warnings. */
+		( void ) pvParameters;
+
+		for( ;; )
+		{
+			/* The tick notifies this task each time it leaves tasks in the
+			Blocked state. */
+			( void ) ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+
+			/* Interrupts are only masked while configTICK_UNBLOCK_LIMIT tasks
+			are unblocked, as they are by the tick, so the time this takes does
+			not add to the interrupt latency.  This task has a higher priority
+			than the tasks it unblocks, so none of them run until all that are
+			due have been unblocked, and the tick carries on from the same task
+			if it occurs in between. */
+			while( xTickUnblockDeferred != pdFALSE )
+			{
+				taskENTER_CRITICAL();
+				{
+					if( xTickUnblockDeferred != pdFALSE )
+					{
+						( void ) prvUnblockDelayedTasks( xTickCount, ( UBaseType_t ) configTICK_UNBLOCK_LIMIT );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				taskEXIT_CRITICAL();
+			}
+		}
+	}
+
+#endif /* configTICK_UNBLOCK_LIMIT */
+/*-----------------------------------------------------------*/
+
 #if configUSE_TICKLESS_IDLE != 0
 
 	eSleepModeStatus eTaskConfirmSleepModeStatus( void )
@@ -2761,6 +3498,29 @@ UBaseType_t x;
 	}
 	#endif /* configGENERATE_RUN_TIME_STATS */
 
+	#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+	{
+		pxTCB->ulNotifiedValue = 0UL;
+		pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+	}
+	#endif /* configUSE_TASK_NOTIFICATIONS */
+
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+	{
+		pxTCB->uxDeadlineHeapIndex = taskNOT_IN_DEADLINE_HEAP;
+		pxTCB->xDeadline = ( TickType_t ) 0U;
+		pxTCB->xJobDeadline = ( TickType_t ) 0U;
+		pxTCB->xReleaseTime = ( TickType_t ) 0U;
+		pxTCB->xPeriod = ( TickType_t ) 0U;
+		pxTCB->xRelativeDeadline = ( TickType_t ) 0U;
+		pxTCB->xBudget = ( TickType_t ) 0U;
+		pxTCB->xBudgetRemaining = ( TickType_t ) 0U;
+		pxTCB->ulJobs = 0UL;
+		pxTCB->ulDeadlinesMissed = 0UL;
+		pxTCB->ulBudgetOverruns = 0UL;
+	}
+	#endif /* configUSE_EDF_SCHEDULING */
+
 	#if ( portUSING_MPU_WRAPPERS == 1 )
 	{
 		vPortStoreTaskMPUSettings( &( pxTCB->xMPUSettings ), xRegions, pxTCB->pxStack, usStackDepth );
@@ -2807,6 +3567,16 @@ UBaseType_t uxPriority;
 
 	vListInitialise( &xDelayedTaskList1 );
 	vListInitialise( &xDelayedTaskList2 );
+
+	#if( configUSE_TASK_DELAY_WHEEL == 1 )
+	{
+		for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configTASK_DELAY_WHEEL_SIZE; uxPriority++ )
+		{
+			vListInitialise( &( xDelayedTaskWheel[ uxPriority ] ) );
+		}
+	}
+	#endif /* configUSE_TASK_DELAY_WHEEL */
+
 	vListInitialise( &xPendingReadyList );
 
 	#if ( INCLUDE_vTaskDelete == 1 )
@@ -2821,8 +3591,8 @@ UBaseType_t uxPriority;
 	}
 	#endif /* INCLUDE_vTaskSuspend */
 
-	/* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-	using list2. */
+	/* Start with pxDelayedTaskList using list1 and the
+	pxOverflowDelayedTaskList using list2. */
 	pxDelayedTaskList = &xDelayedTaskList1;
 	pxOverflowDelayedTaskList = &xDelayedTaskList2;
 }
@@ -2846,18 +3616,41 @@ static void prvCheckTasksWaitingTermination( void )
 
 			if( xListIsEmpty == pdFALSE )
 			{
-				TCB_t *pxTCB;
+				TCB_t *pxTCB = NULL;
 
 				taskENTER_CRITICAL();
 				{
-					pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
-					( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
-					--uxCurrentNumberOfTasks;
-					--uxTasksDeleted;
+					/* A snapshot of the task registry may be reading the TCB
+					or stack of the task, in which case it is freed the next
+					time the idle task runs. */
+					if( taskREGISTRY_SNAPSHOT_IN_PROGRESS() == pdFALSE )
+					{
+						pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( ( &xTasksWaitingTermination ) );
+						( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+						--uxCurrentNumberOfTasks;
+						--uxTasksDeleted;
+
+						#if ( configUSE_TASK_REGISTRY == 1 )
+						{
+							prvUnregisterTask( pxTCB );
+						}
+						#endif /* configUSE_TASK_REGISTRY */
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
 				}
 				taskEXIT_CRITICAL();
 
-				prvDeleteTCB( pxTCB );
+				if( pxTCB != NULL )
+				{
+					prvDeleteTCB( pxTCB );
+				}
+				else
+				{
+					break;
+				}
 			}
 			else
 			{
@@ -2874,20 +3667,45 @@ static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake )
 	/* The list item will be inserted in wake time order. */
 	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xGenericListItem ), xTimeToWake );
 
-	if( xTimeToWake < xTickCount )
+	#if( configUSE_TASK_DELAY_WHEEL == 1 )
 	{
-		/* Wake time has overflowed.  Place this item in the overflow list. */
-		vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
-	}
-	else
-	{
-		/* The wake time has not overflowed, so the current block list is used. */
-		vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+	const TickType_t xTicksFromWheel = xTimeToWake - xDelayWheelTick;
+
+		/* A task that wakes within one revolution of the wheel goes in the
+		bucket for its wake time, which is not sorted, so the insertion is
+		O(1), and the bucket only ever holds tasks that wake at the next tick
+		it is checked for.  The wheel lags the tick count while the tick has
+		left tasks for the context switch to unblock, so the wake time must also
+		be after the tick count - a wake time that has overflowed the tick
+		count can be behind the wheel. */
+		if( ( xTicksFromWheel <= ( TickType_t ) configTASK_DELAY_WHEEL_SIZE ) && ( xTicksFromWheel > ( TickType_t ) ( xTickCount - xDelayWheelTick ) ) )
+		{
+			vListInsertEnd( taskDELAY_WHEEL_BUCKET( xTimeToWake ), &( pxCurrentTCB->xGenericListItem ) );
+		}
+		else if( xTimeToWake == xTickCount )
+		{
+			/* A task that blocks for no time is unblocked when the wheel is
+			next checked, as it would be by the next tick when the wheel is not
+			used. */
+			vListInsertEnd( taskDELAY_WHEEL_BUCKET( xDelayWheelTick + ( TickType_t ) 1U ), &( pxCurrentTCB->xGenericListItem ) );
+		}
+		else if( xTimeToWake < xTickCount )
+		{
+			/* Tasks that wake later are inserted into the delayed task lists
+			in wake time order, as when the wheel is not used, so only the
+			tasks that block for longer than a revolution of the wheel pay for
+			a sorted insertion.  Wake time has overflowed.  Place this item in
+			the overflow list. */
+			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+		}
+		else
+		{
+			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+		}
 
-		/* If the task entering the blocked state was placed at the head of the
-		list of blocked tasks then xNextTaskUnblockTime needs to be updated
-		too. */
-		if( xTimeToWake < xNextTaskUnblockTime )
+		/* Only wake times that have not overflowed are candidates for
+		xNextTaskUnblockTime, as when the wheel is not used. */
+		if( ( xTimeToWake >= xTickCount ) && ( xTimeToWake < xNextTaskUnblockTime ) )
 		{
 			xNextTaskUnblockTime = xTimeToWake;
 		}
@@ -2896,44 +3714,214 @@ static void prvAddCurrentTaskToDelayedList( const TickType_t xTimeToWake )
 			mtCOVERAGE_TEST_MARKER();
 		}
 	}
+	#else
+	{
+		if( xTimeToWake < xTickCount )
+		{
+			/* Wake time has overflowed.  Place this item in the overflow
+			list. */
+			vListInsert( pxOverflowDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+		}
+		else
+		{
+			/* The wake time has not overflowed, so the current block list is
+			used. */
+			vListInsert( pxDelayedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+
+			/* If the task entering the blocked state was placed at the head of
+			the list of blocked tasks then xNextTaskUnblockTime needs to be
+			updated too. */
+			if( xTimeToWake < xNextTaskUnblockTime )
+			{
+				xNextTaskUnblockTime = xTimeToWake;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	#endif /* configUSE_TASK_DELAY_WHEEL */
 }
 /*-----------------------------------------------------------*/
 
-static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer )
-{
-TCB_t *pxNewTCB;
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 ) && ( configUSE_PRIORITY_BITMAP == 1 ) && !defined( portCOUNT_LEADING_ZEROS )
+
+	static UBaseType_t prvCountLeadingZeros( uint32_t ulBitmap )
+	{
+	UBaseType_t uxZeros = ( UBaseType_t ) 0U;
+
+		/* Halve the width searched each time, so the time taken does not
+		depend on which bits are set. */
+		if( ( ulBitmap & 0xffff0000UL ) == 0UL )
+		{
+			uxZeros += ( UBaseType_t ) 16U;
+			ulBitmap <<= 16U;
+		}
+
+		if( ( ulBitmap & 0xff000000UL ) == 0UL )
+		{
+			uxZeros += ( UBaseType_t ) 8U;
+			ulBitmap <<= 8U;
+		}
+
+		if( ( ulBitmap & 0xf0000000UL ) == 0UL )
+		{
+			uxZeros += ( UBaseType_t ) 4U;
+			ulBitmap <<= 4U;
+		}
+
+		if( ( ulBitmap & 0xc0000000UL ) == 0UL )
+		{
+			uxZeros += ( UBaseType_t ) 2U;
+			ulBitmap <<= 2U;
+		}
+
+		if( ( ulBitmap & 0x80000000UL ) == 0UL )
+		{
+			uxZeros += ( UBaseType_t ) 1U;
+		}
 
-	/* Allocate space for the TCB.  Where the memory comes from depends on
-	the implementation of the port malloc function. */
-	pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+		return uxZeros;
+	}
+
+#endif /* configUSE_PRIORITY_BITMAP */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	if( pxNewTCB != NULL )
+	static TCB_t *prvAllocateTCBAndStack( const uint16_t usStackDepth, StackType_t * const puxStackBuffer, UBaseType_t uxStackHints )
 	{
-		/* Allocate space for the stack used by the task being created.
-		The base of the stack memory stored in the TCB so the task can
-		be deleted later if required. */
-		pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocAligned( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ), puxStackBuffer ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	TCB_t *pxNewTCB;
 
-		if( pxNewTCB->pxStack == NULL )
+		/* Allocate space for the TCB.  Where the memory comes from depends on
+		the implementation of the port malloc function. */
+		pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+
+		if( pxNewTCB != NULL )
 		{
-			/* Could not allocate the stack.  Delete the allocated TCB. */
-			vPortFree( pxNewTCB );
-			pxNewTCB = NULL;
+			/* Allocate space for the stack used by the task being created.
+			The base of the stack memory stored in the TCB so the task can
+			be deleted later if required. */
+			#if( configUSE_HEAP_PLACEMENT_HINTS == 1 )
+			{
+				/* Place the stack in a heap region that has the attributes
+				asked for. */
+				if( puxStackBuffer == NULL )
+				{
+					pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocWithHints( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ), uxStackHints ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				}
+				else
+				{
+					pxNewTCB->pxStack = puxStackBuffer;
+				}
+			}
+			#else
+			{
+				( void ) uxStackHints;
+				pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocAligned( ( ( ( size_t ) usStackDepth ) * sizeof( StackType_t ) ), puxStackBuffer ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+			}
+			#endif /* configUSE_HEAP_PLACEMENT_HINTS */
+
+			if( pxNewTCB->pxStack == NULL )
+			{
+				/* Could not allocate the stack.  Delete the allocated TCB. */
+				vPortFree( pxNewTCB );
+				pxNewTCB = NULL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 		}
-		else
+
+		return pxNewTCB;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TRACE_FACILITY == 1 )
+
+	static UBaseType_t prvListAllTasks( TaskStatus_t * const pxTaskStatusArray, const UBaseType_t uxArraySize, uint32_t * const pulTotalRunTime )
+	{
+	UBaseType_t uxTask = 0, uxQueue = configMAX_PRIORITIES;
+
+		vTaskSuspendAll();
 		{
-			/* Avoid dependency on memset() if it is not required. */
-			#if( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+			/* Is there a space in the array for each task in the system? */
+			if( uxArraySize >= uxCurrentNumberOfTasks )
+			{
+				/* Fill in an TaskStatus_t structure with information on each
+				task in the Ready state. */
+				do
+				{
+					uxQueue--;
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady );
+
+				} while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+				/* Fill in an TaskStatus_t structure with information on each
+				task in the Blocked state. */
+				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked );
+				uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked );
+
+				#if( configUSE_TASK_DELAY_WHEEL == 1 )
+				{
+					for( uxQueue = ( UBaseType_t ) 0U; uxQueue < ( UBaseType_t ) configTASK_DELAY_WHEEL_SIZE; uxQueue++ )
+					{
+						uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayedTaskWheel[ uxQueue ] ), eBlocked );
+					}
+				}
+				#endif /* configUSE_TASK_DELAY_WHEEL */
+
+				#if( INCLUDE_vTaskDelete == 1 )
+				{
+					/* Fill in an TaskStatus_t structure with information on
+					each task that has been deleted but not yet cleaned up. */
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xTasksWaitingTermination, eDeleted );
+				}
+				#endif
+
+				#if ( INCLUDE_vTaskSuspend == 1 )
+				{
+					/* Fill in an TaskStatus_t structure with information on
+					each task in the Suspended state. */
+					uxTask += prvListTaskWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xSuspendedTaskList, eSuspended );
+				}
+				#endif
+
+				#if ( configGENERATE_RUN_TIME_STATS == 1)
+				{
+					if( pulTotalRunTime != NULL )
+					{
+						#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+							portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+						#else
+							*pulTotalRunTime = portGET_RUN_TIME_COUNTER_VALUE();
+						#endif
+					}
+				}
+				#else
+				{
+					if( pulTotalRunTime != NULL )
+					{
+						*pulTotalRunTime = 0;
+					}
+				}
+				#endif
+			}
+			else
 			{
-				/* Just to help debugging. */
-				( void ) memset( pxNewTCB->pxStack, ( int ) tskSTACK_FILL_BYTE, ( size_t ) usStackDepth * sizeof( StackType_t ) );
+				mtCOVERAGE_TEST_MARKER();
 			}
-			#endif /* ( ( configCHECK_FOR_STACK_OVERFLOW > 1 ) || ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) ) */
 		}
+		( void ) xTaskResumeAll();
+
+		return uxTask;
 	}
 
-	return pxNewTCB;
-}
+#endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TRACE_FACILITY == 1 )
@@ -3021,527 +4009,2082 @@ TCB_t *pxNewTCB;
 #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+#if ( configUSE_TASK_REGISTRY == 1 )
 
-	static uint16_t prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+	static void prvRegisterTask( TCB_t *pxTCB )
 	{
-	uint32_t ulCount = 0U;
+	UBaseType_t uxSlot;
 
-		while( *pucStackByte == tskSTACK_FILL_BYTE )
+		/* Reuse a slot freed by a deleted task if there is one, so the slots
+		read by a snapshot stay packed at the start of the registry. */
+		if( uxTaskRegistryFreeSlotCount > ( UBaseType_t ) 0U )
 		{
-			pucStackByte -= portSTACK_GROWTH;
-			ulCount++;
+			uxTaskRegistryFreeSlotCount--;
+			uxSlot = uxTaskRegistryFreeSlots[ uxTaskRegistryFreeSlotCount ];
+		}
+		else if( uxTaskRegistrySlotsUsed < ( UBaseType_t ) configTASK_REGISTRY_SIZE )
+		{
+			uxSlot = uxTaskRegistrySlotsUsed;
+			uxTaskRegistrySlotsUsed++;
+		}
+		else
+		{
+			/* The registry is full, so the task will not appear in snapshots.
+			Count it so the loss can be seen in an export, and so
+			uxTaskGetSystemState() walks the task lists instead. */
+			uxSlot = ( UBaseType_t ) configTASK_REGISTRY_SIZE;
+			uxTaskRegistryDropped++;
 		}
 
-		ulCount /= ( uint32_t ) sizeof( StackType_t );
+		pxTCB->uxRegistrySlot = uxSlot;
 
-		return ( uint16_t ) ulCount;
+		if( uxSlot < ( UBaseType_t ) configTASK_REGISTRY_SIZE )
+		{
+			pxTaskRegistry[ uxSlot ] = pxTCB;
+			uxTaskRegistryGeneration++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
 	}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) */
+#endif /* configUSE_TASK_REGISTRY */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
+#if ( configUSE_TASK_REGISTRY == 1 )
 
-	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
+	static void prvUnregisterTask( TCB_t *pxTCB )
 	{
-	TCB_t *pxTCB;
-	uint8_t *pucEndOfStack;
-	UBaseType_t uxReturn;
+	const UBaseType_t uxSlot = pxTCB->uxRegistrySlot;
 
-		pxTCB = prvGetTCBFromHandle( xTask );
+		/* Only called by the idle task when no snapshot is being taken, so
+		the slot can be reused straight away. */
+		configASSERT( uxTaskRegistryReaders == ( UBaseType_t ) 0U );
 
-		#if portSTACK_GROWTH < 0
+		if( uxSlot < ( UBaseType_t ) configTASK_REGISTRY_SIZE )
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
+			configASSERT( pxTaskRegistry[ uxSlot ] == pxTCB );
+			pxTaskRegistry[ uxSlot ] = NULL;
+			uxTaskRegistryFreeSlots[ uxTaskRegistryFreeSlotCount ] = uxSlot;
+			uxTaskRegistryFreeSlotCount++;
+			uxTaskRegistryGeneration++;
 		}
-		#else
+		else
 		{
-			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
+			mtCOVERAGE_TEST_MARKER();
 		}
-		#endif
-
-		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
-
-		return uxReturn;
 	}
 
-#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
+#endif /* configUSE_TASK_REGISTRY */
 /*-----------------------------------------------------------*/
 
-#if ( INCLUDE_vTaskDelete == 1 )
+#if ( configUSE_TASK_REGISTRY == 1 )
 
-	static void prvDeleteTCB( TCB_t *pxTCB )
+	static UBaseType_t prvBeginRegistrySnapshot( UBaseType_t *puxGeneration )
 	{
-		/* This call is required specifically for the TriCore port.  It must be
-		above the vPortFree() calls.  The call is also used by ports/demos that
-		want to allocate and clean RAM statically. */
-		portCLEAN_UP_TCB( pxTCB );
+	UBaseType_t uxSlots;
+
+		taskENTER_CRITICAL();
+		{
+			uxTaskRegistryReaders++;
+			*puxGeneration = uxTaskRegistryGeneration;
+			uxSlots = uxTaskRegistrySlotsUsed;
+		}
+		taskEXIT_CRITICAL();
 
-		/* Free up the memory allocated by the scheduler for the task.  It is up to
-		the task to free any memory allocated at the application level. */
-		vPortFreeAligned( pxTCB->pxStack );
-		vPortFree( pxTCB );
+		return uxSlots;
 	}
 
-#endif /* INCLUDE_vTaskDelete */
+#endif /* configUSE_TASK_REGISTRY */
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-TCB_t *pxTCB;
+#if ( configUSE_TASK_REGISTRY == 1 )
 
-	if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+	static BaseType_t prvReadRegistrySlot( UBaseType_t uxSlot, TaskStatus_t *pxTaskStatus )
 	{
-		/* The new current delayed list is empty.  Set
-		xNextTaskUnblockTime to the maximum possible value so it is
-		extremely unlikely that the
-		if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-		there is an item in the delayed list. */
-		xNextTaskUnblockTime = portMAX_DELAY;
-	}
-	else
-	{
-		/* The new current delayed list is not empty, get the value of
-		the item at the head of the delayed list.  This is the time at
-		which the task at the head of the delayed list should be removed
-		from the Blocked state. */
-		( pxTCB ) = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
-		xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xGenericListItem ) );
-	}
-}
-/*-----------------------------------------------------------*/
-
-#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
-
-	TaskHandle_t xTaskGetCurrentTaskHandle( void )
-	{
-	TaskHandle_t xReturn;
-
-		/* A critical section is not required as this is not called from
-		an interrupt and the current TCB will always be the same for any
-		individual execution thread. */
-		xReturn = pxCurrentTCB;
-
-		return xReturn;
-	}
-
-#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
-/*-----------------------------------------------------------*/
-
-#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
-
-	BaseType_t xTaskGetSchedulerState( void )
-	{
-	BaseType_t xReturn;
+	TCB_t *pxTCB;
+	List_t *pxStateList;
 
-		if( xSchedulerRunning == pdFALSE )
-		{
-			xReturn = taskSCHEDULER_NOT_STARTED;
-		}
-		else
+		/* Only the fields that change while the task runs are read within the
+		critical section, which is all the scheduler is locked out for. */
+		taskENTER_CRITICAL();
 		{
-			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
-			{
-				xReturn = taskSCHEDULER_RUNNING;
-			}
-			else
+			pxTCB = pxTaskRegistry[ uxSlot ];
+
+			if( pxTCB != NULL )
 			{
-				xReturn = taskSCHEDULER_SUSPENDED;
-			}
-		}
+				/* The state is found in the same way as by
+				uxTaskGetSystemState() when it walks the lists - the running
+				task is reported as Ready, and a task blocked indefinitely as
+				Suspended. */
+				pxStateList = ( List_t * ) listLIST_ITEM_CONTAINER( &( pxTCB->xGenericListItem ) );
 
-		return xReturn;
-	}
+				if( taskIS_DELAYED_TASK_LIST( pxStateList ) )
+				{
+					pxTaskStatus->eCurrentState = eBlocked;
+				}
 
-#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
-/*-----------------------------------------------------------*/
+				#if ( INCLUDE_vTaskSuspend == 1 )
+					else if( pxStateList == &xSuspendedTaskList )
+					{
+						pxTaskStatus->eCurrentState = eSuspended;
+					}
+				#endif
 
-#if ( configUSE_MUTEXES == 1 )
+				#if ( INCLUDE_vTaskDelete == 1 )
+					else if( pxStateList == &xTasksWaitingTermination )
+					{
+						pxTaskStatus->eCurrentState = eDeleted;
+					}
+				#endif
 
-	void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
-	{
-	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+				else
+				{
+					pxTaskStatus->eCurrentState = eReady;
+				}
 
-		/* If the mutex was given back by an interrupt while the queue was
-		locked then the mutex holder might now be NULL. */
-		if( pxMutexHolder != NULL )
-		{
-			if( pxTCB->uxPriority < pxCurrentTCB->uxPriority )
-			{
-				/* Adjust the mutex holder state to account for its new
-				priority.  Only reset the event list item value if the value is
-				not	being used for anything else. */
-				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+				pxTaskStatus->uxCurrentPriority = pxTCB->uxPriority;
+
+				#if ( configUSE_MUTEXES == 1 )
 				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+					pxTaskStatus->uxBasePriority = pxTCB->uxBasePriority;
 				}
-				else
+				#else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					pxTaskStatus->uxBasePriority = 0;
 				}
+				#endif
 
-				/* If the task being modified is in the ready state it will need to
-				be moved into a new list. */
-				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
+				#if ( configGENERATE_RUN_TIME_STATS == 1 )
 				{
-					if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
-					{
-						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-
-					/* Inherit the priority before being moved into the new list. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
-					prvAddTaskToReadyList( pxTCB );
+					pxTaskStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
 				}
-				else
+				#else
 				{
-					/* Just inherit the priority. */
-					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+					pxTaskStatus->ulRunTimeCounter = 0;
 				}
-
-				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
+				#endif
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
+		taskEXIT_CRITICAL();
+
+		if( pxTCB != NULL )
+		{
+			pxTaskStatus->xHandle = ( TaskHandle_t ) pxTCB;
+			pxTaskStatus->pcTaskName = ( const char * ) &( pxTCB->pcTaskName[ 0 ] );
+			pxTaskStatus->xTaskNumber = pxTCB->uxTCBNumber;
+
+			#if ( portSTACK_GROWTH > 0 )
+			{
+				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxEndOfStack );
+			}
+			#else
+			{
+				pxTaskStatus->usStackHighWaterMark = prvTaskCheckFreeStackSpace( ( uint8_t * ) pxTCB->pxStack );
+			}
+			#endif
+		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return ( pxTCB != NULL ) ? pdTRUE : pdFALSE;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_TASK_REGISTRY */
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+#if ( configUSE_TASK_REGISTRY == 1 )
 
-	void vTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
+	static UBaseType_t prvEndRegistrySnapshot( void )
 	{
-	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+	UBaseType_t uxGeneration;
 
-		if( pxMutexHolder != NULL )
+		taskENTER_CRITICAL();
 		{
-			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
-			{
-				/* We must be the running task to be able to give the mutex back.
-				Remove ourselves from the ready list we currently appear in. */
-				if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
-				{
-					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+			configASSERT( uxTaskRegistryReaders > ( UBaseType_t ) 0U );
+			uxTaskRegistryReaders--;
+			uxGeneration = uxTaskRegistryGeneration;
+		}
+		taskEXIT_CRITICAL();
 
-				/* Disinherit the priority before adding the task into the new
-				ready list. */
-				traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
-				pxTCB->uxPriority = pxTCB->uxBasePriority;
+		return uxGeneration;
+	}
 
-				/* Only reset the event list item value if the value is not
-				being used for anything else. */
-				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
-				{
-					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
-				prvAddTaskToReadyList( pxTCB );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
-			}
-		}
-		else
+#endif /* configUSE_TASK_REGISTRY */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) )
+
+	static uint16_t prvTaskCheckFreeStackSpace( const uint8_t * pucStackByte )
+	{
+	uint32_t ulCount = 0U;
+
+		while( *pucStackByte == tskSTACK_FILL_BYTE )
 		{
-			mtCOVERAGE_TEST_MARKER();
+			pucStackByte -= portSTACK_GROWTH;
+			ulCount++;
 		}
+
+		ulCount /= ( uint32_t ) sizeof( StackType_t );
+
+		return ( uint16_t ) ulCount;
 	}
 
-#endif /* configUSE_MUTEXES */
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) || ( INCLUDE_uxTaskGetStackHighWaterMark == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+#if ( INCLUDE_uxTaskGetStackHighWaterMark == 1 )
 
-	void vTaskEnterCritical( void )
+	UBaseType_t uxTaskGetStackHighWaterMark( TaskHandle_t xTask )
 	{
-		portDISABLE_INTERRUPTS();
+	TCB_t *pxTCB;
+	uint8_t *pucEndOfStack;
+	UBaseType_t uxReturn;
 
-		if( xSchedulerRunning != pdFALSE )
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		#if portSTACK_GROWTH < 0
 		{
-			( pxCurrentTCB->uxCriticalNesting )++;
+			pucEndOfStack = ( uint8_t * ) pxTCB->pxStack;
 		}
-		else
+		#else
 		{
-			mtCOVERAGE_TEST_MARKER();
+			pucEndOfStack = ( uint8_t * ) pxTCB->pxEndOfStack;
 		}
+		#endif
+
+		uxReturn = ( UBaseType_t ) prvTaskCheckFreeStackSpace( pucEndOfStack );
+
+		return uxReturn;
 	}
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
+#endif /* INCLUDE_uxTaskGetStackHighWaterMark */
 /*-----------------------------------------------------------*/
 
-#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+#if ( INCLUDE_vTaskDelete == 1 )
 
-	void vTaskExitCritical( void )
+	static void prvDeleteTCB( TCB_t *pxTCB )
 	{
-		if( xSchedulerRunning != pdFALSE )
+		/* This call is required specifically for the TriCore port.  It must be
+		above the vPortFree() calls.  The call is also used by ports/demos that
+		want to allocate and clean RAM statically. */
+		portCLEAN_UP_TCB( pxTCB );
+
+		#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE == 0 ) )
 		{
-			if( pxCurrentTCB->uxCriticalNesting > 0U )
+			/* The task can only have been allocated dynamically - free both
+			the stack and TCB.  It is up to the task to free any memory
+			allocated at the application level. */
+			vPortFreeAligned( pxTCB->pxStack );
+			vPortFree( pxTCB );
+		}
+		#elif( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
+		{
+			/* The task could have been allocated statically or dynamically, so
+			check what was statically allocated before trying to free the
+			memory. */
+			if( pxTCB->ucStaticallyAllocated == tskDYNAMICALLY_ALLOCATED_STACK_AND_TCB )
 			{
-				( pxCurrentTCB->uxCriticalNesting )--;
-
-				if( pxCurrentTCB->uxCriticalNesting == 0U )
-				{
-					portENABLE_INTERRUPTS();
-				}
-				else
-				{
-					mtCOVERAGE_TEST_MARKER();
-				}
+				vPortFreeAligned( pxTCB->pxStack );
+				vPortFree( pxTCB );
+			}
+			else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
+			{
+				/* Only the stack was supplied by the application, so only the
+				TCB needs to be freed. */
+				vPortFree( pxTCB );
 			}
 			else
 			{
+				/* Neither the stack nor the TCB were allocated dynamically, so
+				nothing needs to be freed. */
+				configASSERT( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_AND_TCB );
 				mtCOVERAGE_TEST_MARKER();
 			}
 		}
-		else
-		{
-			mtCOVERAGE_TEST_MARKER();
-		}
+		#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 	}
 
-#endif /* portCRITICAL_NESTING_IN_TCB */
+#endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) )
+#if( configUSE_TASK_DELAY_WHEEL == 1 )
 
-	void vTaskList( char * pcWriteBuffer )
+	static void prvResetNextTaskUnblockTime( void )
 	{
-	TaskStatus_t *pxTaskStatusArray;
-	volatile UBaseType_t uxArraySize, x;
-	char cStatus;
+	const TickType_t xConstTickCount = xTickCount;
+	TickType_t xTime, xNextTime;
+	TCB_t *pxTCB;
 
-		/*
-		 * PLEASE NOTE:
-		 *
-		 * This function is provided for convenience only, and is used by many
-		 * of the demo applications.  Do not consider it to be part of the
-		 * scheduler.
-		 *
-		 * vTaskList() calls uxTaskGetSystemState(), then formats part of the
-		 * uxTaskGetSystemState() output into a human readable table that
-		 * displays task names, states and stack usage.
-		 *
-		 * vTaskList() has a dependency on the sprintf() C library function that
-		 * might bloat the code size, use a lot of stack, and provide different
-		 * results on different platforms.  An alternative, tiny, third party,
-		 * and limited functionality implementation of sprintf() is provided in
-		 * many of the FreeRTOS/Demo sub-directories in a file called
+		/* The tasks that wake more than a revolution of the wheel ahead are
+		in the delayed task list in wake time order, so the earliest of them
+		is at its head. */
+		if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+		{
+			xNextTime = portMAX_DELAY;
+		}
+		else
+		{
+			pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+			xNextTime = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
+		}
+
+		/* Look for an earlier wake time in the wheel.  Each bucket only holds
+		tasks that wake at the next tick it is checked for, so the first bucket
+		that is not empty gives the earliest wake time, and at most one
+		revolution of the wheel is looked at.  Wake times that have overflowed
+		the tick count are not considered, which is the case once xTime wraps
+		to 0 - unless the tick count has itself just overflowed to 0, in which
+		case the tasks that wake at tick 0 have not been unblocked yet. */
+		for( xTime = xDelayWheelTick + ( TickType_t ) 1U; xTime != ( xDelayWheelTick + ( TickType_t ) configTASK_DELAY_WHEEL_SIZE + ( TickType_t ) 1U ); xTime++ )
+		{
+			if( ( ( xTime == ( TickType_t ) 0U ) && ( xConstTickCount != ( TickType_t ) 0U ) ) || ( xTime >= xNextTime ) )
+			{
+				break;
+			}
+			else if( listLIST_IS_EMPTY( taskDELAY_WHEEL_BUCKET( xTime ) ) == pdFALSE )
+			{
+				xNextTime = xTime;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* portMAX_DELAY if there are no delayed tasks, so it is extremely
+		unlikely that the if( xTickCount >= xNextTaskUnblockTime ) test will
+		pass until there is one. */
+		xNextTaskUnblockTime = xNextTime;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvUnblockDelayedTasks( const TickType_t xConstTickCount, const UBaseType_t uxLimit )
+	{
+	TCB_t *pxTCB;
+	TickType_t xTime, xTicksToCheck, xLastDueTime;
+	List_t *pxBucket;
+	BaseType_t xSwitchRequired = pdFALSE;
+	UBaseType_t uxUnblocked = ( UBaseType_t ) 0U;
+
+		/* Only the buckets for the ticks since the wheel was last checked, and
+		the head of the delayed task list, are looked at, so the cost does not
+		depend on the number of delayed tasks.  The ticks stepped over by
+		vTaskStepTick() are included, although no task can wake during them.
+
+		The wheel only holds tasks that wake within one revolution of
+		xDelayWheelTick, so if the tick count has moved on by more than that
+		since the wheel was last checked (only possible when vTaskStepTick()
+		was called) each bucket is checked once. */
+		xTicksToCheck = xConstTickCount - xDelayWheelTick;
+
+		if( xTicksToCheck > ( TickType_t ) configTASK_DELAY_WHEEL_SIZE )
+		{
+			xTicksToCheck = ( TickType_t ) configTASK_DELAY_WHEEL_SIZE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		for( xTime = xDelayWheelTick + ( TickType_t ) 1U; xTicksToCheck > ( TickType_t ) 0U; xTicksToCheck-- )
+		{
+			pxBucket = taskDELAY_WHEEL_BUCKET( xTime );
+
+			/* The tasks in the delayed task list that wake by xTime are
+			unblocked after the bucket for xTime, so the tasks are unblocked in
+			the order of their wake times.  When the last bucket is checked
+			that is all those that wake by xConstTickCount. */
+			if( xTicksToCheck == ( TickType_t ) 1U )
+			{
+				xLastDueTime = xConstTickCount;
+			}
+			else
+			{
+				xLastDueTime = xTime;
+			}
+
+			for( ;; )
+			{
+				/* Every task in the bucket is due. */
+				if( listLIST_IS_EMPTY( pxBucket ) == pdFALSE )
+				{
+					pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxBucket );
+				}
+				else if( listLIST_IS_EMPTY( pxDelayedTaskList ) == pdFALSE )
+				{
+					/* Is the wake time of the task at the head of the delayed
+					task list after xDelayWheelTick and not after
+					xLastDueTime?  The subtractions are performed with
+					unsigned arithmetic so the test remains correct when the
+					tick count overflows. */
+					pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+
+					if( ( TickType_t ) ( listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) ) - xDelayWheelTick - ( TickType_t ) 1U ) > ( TickType_t ) ( xLastDueTime - xDelayWheelTick - ( TickType_t ) 1U ) )
+					{
+						break;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					break;
+				}
+
+				#if( configTICK_UNBLOCK_LIMIT > 0 )
+				{
+					if( ( uxLimit != ( UBaseType_t ) 0U ) && ( uxUnblocked >= uxLimit ) )
+					{
+						/* The tick has done as much as it is allowed to.  No
+						task that wakes before xTime is still blocked, so the
+						wheel is next checked from this bucket, and
+						xNextTaskUnblockTime is left in the past.  The context
+						switch requested here selects the tick unblock task,
+						which unblocks the rest before a task of lower priority
+						can run, so a task that wakes later than another can
+						never run first.  Without preemption no switch is
+						requested - the rest are unblocked by the following
+						ticks, or by the tick unblock task once the running
+						task makes a context switch. */
+						xDelayWheelTick = xTime - ( TickType_t ) 1U;
+						xTickUnblockDeferred = pdTRUE;
+
+						#if ( configUSE_PREEMPTION == 1 )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						#endif /* configUSE_PREEMPTION */
+
+						return xSwitchRequired;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configTICK_UNBLOCK_LIMIT */
+
+				uxUnblocked++;
+
+				/* It is time to remove the item from the Blocked state. */
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+
+				/* Is the task waiting on an event also?  If so remove it from
+				the event list. */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Place the unblocked task into the appropriate ready list. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task being unblocked cannot cause an immediate context
+				switch if preemption is turned off. */
+				#if (  configUSE_PREEMPTION == 1 )
+				{
+					/* Preemption is on, but a context switch should only be
+					performed if the unblocked task has a priority that is
+					equal to or higher than the currently executing task. */
+					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+
+			xTime++;
+		}
+
+		xDelayWheelTick = xConstTickCount;
+
+		#if( configTICK_UNBLOCK_LIMIT > 0 )
+		{
+			xTickUnblockDeferred = pdFALSE;
+		}
+		#endif /* configTICK_UNBLOCK_LIMIT */
+
+		/* Prevent compiler warnings when the limit is not used. */
+		( void ) uxLimit;
+		( void ) uxUnblocked;
+
+		prvResetNextTaskUnblockTime();
+
+		return xSwitchRequired;
+	}
+
+#else /* configUSE_TASK_DELAY_WHEEL */
+
+	static void prvResetNextTaskUnblockTime( void )
+	{
+	TCB_t *pxTCB;
+
+		if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+		{
+			/* The new current delayed list is empty.  Set
+			xNextTaskUnblockTime to the maximum possible value so it is
+			extremely unlikely that the
+			if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+			there is an item in the delayed list. */
+			xNextTaskUnblockTime = portMAX_DELAY;
+		}
+		else
+		{
+			/* The new current delayed list is not empty, get the value of
+			the item at the head of the delayed list.  This is the time at
+			which the task at the head of the delayed list should be removed
+			from the Blocked state. */
+			( pxTCB ) = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+			xNextTaskUnblockTime = listGET_LIST_ITEM_VALUE( &( ( pxTCB )->xGenericListItem ) );
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvUnblockDelayedTasks( const TickType_t xConstTickCount, const UBaseType_t uxLimit )
+	{
+	TCB_t * pxTCB;
+	TickType_t xItemValue;
+	BaseType_t xSwitchRequired = pdFALSE;
+	UBaseType_t uxUnblocked = ( UBaseType_t ) 0U;
+
+		/* Tasks are stored in the queue in the order of their wake time -
+		meaning once one task has been found whose block time has not expired
+		there is no need to look any further down the list. */
+		for( ;; )
+		{
+			if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+			{
+				/* The delayed list is empty.  Set xNextTaskUnblockTime to the
+				maximum possible value so it is extremely unlikely that the
+				if( xTickCount >= xNextTaskUnblockTime ) test will pass next
+				time through. */
+				xNextTaskUnblockTime = portMAX_DELAY;
+				break;
+			}
+			else
+			{
+				/* The delayed list is not empty, get the value of the item at
+				the head of the delayed list.  This is the time at which the
+				task at the head of the delayed list must be removed from the
+				Blocked state. */
+				pxTCB = ( TCB_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxDelayedTaskList );
+				xItemValue = listGET_LIST_ITEM_VALUE( &( pxTCB->xGenericListItem ) );
+
+				if( xConstTickCount < xItemValue )
+				{
+					/* It is not time to unblock this item yet, but the item
+					value is the time at which the task at the head of the
+					blocked list must be removed from the Blocked state - so
+					record the item value in xNextTaskUnblockTime. */
+					xNextTaskUnblockTime = xItemValue;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				#if( configTICK_UNBLOCK_LIMIT > 0 )
+				{
+					if( ( uxLimit != ( UBaseType_t ) 0U ) && ( uxUnblocked >= uxLimit ) )
+					{
+						/* The tick has done as much as it is allowed to.  The
+						task at the head of the list is still due, so
+						xNextTaskUnblockTime is left in the past, and the
+						context switch requested here selects the tick unblock
+						task, which unblocks the rest before a task of lower
+						priority can run.  Without preemption no switch is
+						requested - the rest are unblocked by the following
+						ticks, or by the tick unblock task once the running
+						task makes a context switch. */
+						xTickUnblockDeferred = pdTRUE;
+
+						#if ( configUSE_PREEMPTION == 1 )
+						{
+							xSwitchRequired = pdTRUE;
+						}
+						#endif /* configUSE_PREEMPTION */
+
+						return xSwitchRequired;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configTICK_UNBLOCK_LIMIT */
+
+				uxUnblocked++;
+
+				/* It is time to remove the item from the Blocked state. */
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+
+				/* Is the task waiting on an event also?  If so remove it from
+				the event list. */
+				if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+				{
+					( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Place the unblocked task into the appropriate ready list. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task being unblocked cannot cause an immediate context
+				switch if preemption is turned off. */
+				#if (  configUSE_PREEMPTION == 1 )
+				{
+					/* Preemption is on, but a context switch should only be
+					performed if the unblocked task has a priority that is
+					equal to or higher than the currently executing task. */
+					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_PREEMPTION */
+			}
+		}
+
+		#if( configTICK_UNBLOCK_LIMIT > 0 )
+		{
+			xTickUnblockDeferred = pdFALSE;
+		}
+		#endif /* configTICK_UNBLOCK_LIMIT */
+
+		/* Prevent compiler warnings when the limit is not used. */
+		( void ) uxLimit;
+		( void ) uxUnblocked;
+
+		return xSwitchRequired;
+	}
+
+#endif /* configUSE_TASK_DELAY_WHEEL */
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+
+	TaskHandle_t xTaskGetCurrentTaskHandle( void )
+	{
+	TaskHandle_t xReturn;
+
+		/* A critical section is not required as this is not called from
+		an interrupt and the current TCB will always be the same for any
+		individual execution thread. */
+		xReturn = pxCurrentTCB;
+
+		return xReturn;
+	}
+
+#endif /* ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+
+	BaseType_t xTaskGetSchedulerState( void )
+	{
+	BaseType_t xReturn;
+
+		if( xSchedulerRunning == pdFALSE )
+		{
+			xReturn = taskSCHEDULER_NOT_STARTED;
+		}
+		else
+		{
+			if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+			{
+				xReturn = taskSCHEDULER_RUNNING;
+			}
+			else
+			{
+				xReturn = taskSCHEDULER_SUSPENDED;
+			}
+		}
+
+		return xReturn;
+	}
+
+#endif /* ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskPriorityInherit( TaskHandle_t const pxMutexHolder )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+
+		/* If the mutex was given back by an interrupt while the queue was
+		locked then the mutex holder might now be NULL. */
+		if( pxMutexHolder != NULL )
+		{
+			if( pxTCB->uxPriority < pxCurrentTCB->uxPriority )
+			{
+				/* Adjust the mutex holder state to account for its new
+				priority.  Only reset the event list item value if the value is
+				not	being used for anything else. */
+				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+				{
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* If the task being modified is in the ready state it will need to
+				be moved into a new list. */
+				if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
+				{
+					if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+					{
+						taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* Inherit the priority before being moved into the new list. */
+					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					/* Just inherit the priority. */
+					pxTCB->uxPriority = pxCurrentTCB->uxPriority;
+				}
+
+				traceTASK_PRIORITY_INHERIT( pxTCB, pxCurrentTCB->uxPriority );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+	void vTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder )
+	{
+	TCB_t * const pxTCB = ( TCB_t * ) pxMutexHolder;
+
+		if( pxMutexHolder != NULL )
+		{
+			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
+			{
+				/* We must be the running task to be able to give the mutex back.
+				Remove ourselves from the ready list we currently appear in. */
+				if( uxListRemove( &( pxTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Disinherit the priority before adding the task into the new
+				ready list. */
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, pxTCB->uxBasePriority );
+				pxTCB->uxPriority = pxTCB->uxBasePriority;
+
+				/* Only reset the event list item value if the value is not
+				being used for anything else. */
+				if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
+				{
+					listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+				prvAddTaskToReadyList( pxTCB );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+
+	void vTaskEnterCritical( void )
+	{
+		portDISABLE_INTERRUPTS();
+
+		if( xSchedulerRunning != pdFALSE )
+		{
+			( pxCurrentTCB->uxCriticalNesting )++;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* portCRITICAL_NESTING_IN_TCB */
+/*-----------------------------------------------------------*/
+
+#if ( portCRITICAL_NESTING_IN_TCB == 1 )
+
+	void vTaskExitCritical( void )
+	{
+		if( xSchedulerRunning != pdFALSE )
+		{
+			if( pxCurrentTCB->uxCriticalNesting > 0U )
+			{
+				( pxCurrentTCB->uxCriticalNesting )--;
+
+				if( pxCurrentTCB->uxCriticalNesting == 0U )
+				{
+					portENABLE_INTERRUPTS();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* portCRITICAL_NESTING_IN_TCB */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	void vTaskList( char * pcWriteBuffer )
+	{
+	TaskStatus_t *pxTaskStatusArray;
+	volatile UBaseType_t uxArraySize, x;
+	char cStatus;
+
+		/*
+		 * PLEASE NOTE:
+		 *
+		 * This function is provided for convenience only, and is used by many
+		 * of the demo applications.  Do not consider it to be part of the
+		 * scheduler.
+		 *
+		 * vTaskList() calls uxTaskGetSystemState(), then formats part of the
+		 * uxTaskGetSystemState() output into a human readable table that
+		 * displays task names, states and stack usage.
+		 *
+		 * vTaskList() has a dependency on the sprintf() C library function that
+		 * might bloat the code size, use a lot of stack, and provide different
+		 * results on different platforms.  An alternative, tiny, third party,
+		 * and limited functionality implementation of sprintf() is provided in
+		 * many of the FreeRTOS/Demo sub-directories in a file called
 		 * printf-stdarg.c (note printf-stdarg.c does not provide a full
 		 * snprintf() implementation!).
 		 *
 		 * It is recommended that production systems call uxTaskGetSystemState()
 		 * directly to get access to raw stats data, rather than indirectly
-		 * through a call to vTaskList().
+		 * through a call to vTaskList().
+		 */
+
+
+		/* Make sure the write buffer does not contain a string. */
+		*pcWriteBuffer = 0x00;
+
+		/* Take a snapshot of the number of tasks in case it changes while this
+		function is executing. */
+		uxArraySize = uxCurrentNumberOfTasks;
+
+		/* Allocate an array index for each task. */
+		pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) );
+
+		if( pxTaskStatusArray != NULL )
+		{
+			/* Generate the (binary) data. */
+			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+
+			/* Create a human readable table from the binary data. */
+			for( x = 0; x < uxArraySize; x++ )
+			{
+				switch( pxTaskStatusArray[ x ].eCurrentState )
+				{
+				case eReady:		cStatus = tskREADY_CHAR;
+									break;
+
+				case eBlocked:		cStatus = tskBLOCKED_CHAR;
+									break;
+
+				case eSuspended:	cStatus = tskSUSPENDED_CHAR;
+									break;
+
+				case eDeleted:		cStatus = tskDELETED_CHAR;
+									break;
+
+				default:			/* Should not get here, but it is included
+									to prevent static checking errors. */
+									cStatus = 0x00;
+									break;
+				}
+
+				sprintf( pcWriteBuffer, "%s\t\t%c\t%u\t%u\t%u\r\n", pxTaskStatusArray[ x ].pcTaskName, cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber );
+				pcWriteBuffer += strlen( pcWriteBuffer );
+			}
+
+			/* Free the array again. */
+			vPortFree( pxTaskStatusArray );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*----------------------------------------------------------*/
+
+#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	void vTaskGetRunTimeStats( char *pcWriteBuffer )
+	{
+	TaskStatus_t *pxTaskStatusArray;
+	volatile UBaseType_t uxArraySize, x;
+	uint32_t ulTotalTime, ulStatsAsPercentage;
+
+		#if( configUSE_TRACE_FACILITY != 1 )
+		{
+			#error configUSE_TRACE_FACILITY must also be set to 1 in FreeRTOSConfig.h to use vTaskGetRunTimeStats().
+		}
+		#endif
+
+		/*
+		 * PLEASE NOTE:
+		 *
+		 * This function is provided for convenience only, and is used by many
+		 * of the demo applications.  Do not consider it to be part of the
+		 * scheduler.
+		 *
+		 * vTaskGetRunTimeStats() calls uxTaskGetSystemState(), then formats part
+		 * of the uxTaskGetSystemState() output into a human readable table that
+		 * displays the amount of time each task has spent in the Running state
+		 * in both absolute and percentage terms.
+		 *
+		 * vTaskGetRunTimeStats() has a dependency on the sprintf() C library
+		 * function that might bloat the code size, use a lot of stack, and
+		 * provide different results on different platforms.  An alternative,
+		 * tiny, third party, and limited functionality implementation of
+		 * sprintf() is provided in many of the FreeRTOS/Demo sub-directories in
+		 * a file called printf-stdarg.c (note printf-stdarg.c does not provide
+		 * a full snprintf() implementation!).
+		 *
+		 * It is recommended that production systems call uxTaskGetSystemState()
+		 * directly to get access to raw stats data, rather than indirectly
+		 * through a call to vTaskGetRunTimeStats().
 		 */
 
+		/* Make sure the write buffer does not contain a string. */
+		*pcWriteBuffer = 0x00;
+
+		/* Take a snapshot of the number of tasks in case it changes while this
+		function is executing. */
+		uxArraySize = uxCurrentNumberOfTasks;
+
+		/* Allocate an array index for each task. */
+		pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) );
+
+		if( pxTaskStatusArray != NULL )
+		{
+			/* Generate the (binary) data. */
+			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+
+			/* For percentage calculations. */
+			ulTotalTime /= 100UL;
+
+			/* Avoid divide by zero errors. */
+			if( ulTotalTime > 0 )
+			{
+				/* Create a human readable table from the binary data. */
+				for( x = 0; x < uxArraySize; x++ )
+				{
+					/* What percentage of the total run time has the task used?
+					This will always be rounded down to the nearest integer.
+					ulTotalRunTimeDiv100 has already been divided by 100. */
+					ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
+
+					if( ulStatsAsPercentage > 0UL )
+					{
+						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+						{
+							sprintf( pcWriteBuffer, "%s\t\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
+						}
+						#else
+						{
+							/* sizeof( int ) == sizeof( long ) so a smaller
+							printf() library can be used. */
+							sprintf( pcWriteBuffer, "%s\t\t%u\t\t%u%%\r\n", pxTaskStatusArray[ x ].pcTaskName, ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage );
+						}
+						#endif
+					}
+					else
+					{
+						/* If the percentage is zero here then the task has
+						consumed less than 1% of the total run time. */
+						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
+						{
+							sprintf( pcWriteBuffer, "%s\t\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter );
+						}
+						#else
+						{
+							/* sizeof( int ) == sizeof( long ) so a smaller
+							printf() library can be used. */
+							sprintf( pcWriteBuffer, "%s\t\t%u\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter );
+						}
+						#endif
+					}
+
+					pcWriteBuffer += strlen( pcWriteBuffer );
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Free the array again. */
+			vPortFree( pxTaskStatusArray );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+TickType_t uxTaskResetEventItemValue( void )
+{
+TickType_t uxReturn;
+
+	uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+
+	/* Reset the event list item to its normal value - so it can be used with
+	queues and semaphores. */
+	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+
+	return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	static void prvBlockCurrentTaskForNotification( const TickType_t xTicksToWait )
+	{
+	TickType_t xTimeToWake;
+
+		/* The task must be removed from the ready list before it is added to
+		the blocked list as the same list item is used for both lists.  There is
+		no event list to insert the task into as the notification is sent to the
+		task directly. */
+		if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+		{
+			/* The current task must be in a ready list, so there is no need to
+			check, and the port reset macro can be called directly. */
+			portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if ( INCLUDE_vTaskSuspend == 1 )
+		{
+			if( xTicksToWait == portMAX_DELAY )
+			{
+				/* Add the task to the suspended task list instead of a delayed
+				task list to ensure the task is not woken by a timing event.  It
+				will block indefinitely. */
+				vListInsertEnd( &xSuspendedTaskList, &( pxCurrentTCB->xGenericListItem ) );
+			}
+			else
+			{
+				/* Calculate the time at which the task should be woken if no
+				notification is received.  This may overflow but this doesn't
+				matter, the scheduler will handle it. */
+				xTimeToWake = xTickCount + xTicksToWait;
+				prvAddCurrentTaskToDelayedList( xTimeToWake );
+			}
+		}
+		#else /* INCLUDE_vTaskSuspend */
+		{
+			/* Calculate the time at which the task should be woken if no
+			notification is received.  This may overflow but this doesn't
+			matter, the scheduler will handle it. */
+			xTimeToWake = xTickCount + xTicksToWait;
+			prvAddCurrentTaskToDelayedList( xTimeToWake );
+		}
+		#endif /* INCLUDE_vTaskSuspend */
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait )
+	{
+	uint32_t ulReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* Only block if the notification count is not already non-zero. */
+			if( pxCurrentTCB->ulNotifiedValue == 0UL )
+			{
+				/* Mark this task as waiting for a notification. */
+				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					prvBlockCurrentTaskForNotification( xTicksToWait );
+					traceTASK_NOTIFY_TAKE_BLOCK();
+
+					/* All ports are written to allow a yield in a critical
+					section (some will yield immediately, others wait until the
+					critical section exits) - but it is not something that
+					application code should ever do. */
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			traceTASK_NOTIFY_TAKE();
+			ulReturn = pxCurrentTCB->ulNotifiedValue;
+
+			if( ulReturn != 0UL )
+			{
+				if( xClearCountOnExit != pdFALSE )
+				{
+					pxCurrentTCB->ulNotifiedValue = 0UL;
+				}
+				else
+				{
+					( pxCurrentTCB->ulNotifiedValue )--;
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+		}
+		taskEXIT_CRITICAL();
+
+		return ulReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xTaskNotifyWait( uint32_t ulBitsToClearOnEntry, uint32_t ulBitsToClearOnExit, uint32_t *pulNotificationValue, TickType_t xTicksToWait )
+	{
+	BaseType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			/* Only block if a notification is not already pending. */
+			if( pxCurrentTCB->ucNotifyState != taskNOTIFICATION_RECEIVED )
+			{
+				/* Clear bits in the task's notification value as bits may get
+				set	by the notifying task or interrupt.  This can be used to
+				clear the value to zero. */
+				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnEntry;
+
+				/* Mark this task as waiting for a notification. */
+				pxCurrentTCB->ucNotifyState = taskWAITING_NOTIFICATION;
+
+				if( xTicksToWait > ( TickType_t ) 0 )
+				{
+					prvBlockCurrentTaskForNotification( xTicksToWait );
+					traceTASK_NOTIFY_WAIT_BLOCK();
+
+					/* All ports are written to allow a yield in a critical
+					section (some will yield immediately, others wait until the
+					critical section exits) - but it is not something that
+					application code should ever do. */
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		taskENTER_CRITICAL();
+		{
+			traceTASK_NOTIFY_WAIT();
+
+			if( pulNotificationValue != NULL )
+			{
+				/* Output the current notification value, which may or may not
+				have changed. */
+				*pulNotificationValue = pxCurrentTCB->ulNotifiedValue;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* If ucNotifyState is still taskWAITING_NOTIFICATION then either the
+			task never entered the blocked state (because a notification was
+			already pending) or the task unblocked because of a timeout. */
+			if( pxCurrentTCB->ucNotifyState == taskWAITING_NOTIFICATION )
+			{
+				/* A notification was not received. */
+				xReturn = pdFALSE;
+			}
+			else
+			{
+				/* A notification was already pending or a notification was
+				received while the task was waiting. */
+				pxCurrentTCB->ulNotifiedValue &= ~ulBitsToClearOnExit;
+				xReturn = pdTRUE;
+			}
+
+			pxCurrentTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xTaskGenericNotify( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue )
+	{
+	TCB_t * pxTCB;
+	uint8_t ucOriginalNotifyState;
+	BaseType_t xReturn = pdPASS;
+
+		configASSERT( xTaskToNotify );
+		pxTCB = ( TCB_t * ) xTaskToNotify;
+
+		taskENTER_CRITICAL();
+		{
+			if( pulPreviousNotificationValue != NULL )
+			{
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+			}
+
+			ucOriginalNotifyState = pxTCB->ucNotifyState;
+
+			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
 
-		/* Make sure the write buffer does not contain a string. */
-		*pcWriteBuffer = 0x00;
+			switch( eAction )
+			{
+				case eSetBits	:
+					pxTCB->ulNotifiedValue |= ulValue;
+					break;
+
+				case eIncrement	:
+					( pxTCB->ulNotifiedValue )++;
+					break;
+
+				case eSetValueWithOverwrite	:
+					pxTCB->ulNotifiedValue = ulValue;
+					break;
+
+				case eSetValueWithoutOverwrite :
+					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+					{
+						pxTCB->ulNotifiedValue = ulValue;
+					}
+					else
+					{
+						/* The value could not be written to the task. */
+						xReturn = pdFAIL;
+					}
+					break;
+
+				case eNoAction:
+					/* The task is being notified without its notify value being
+					updated. */
+					break;
+			}
+
+			traceTASK_NOTIFY();
+
+			/* If the task is in the blocked state specifically to wait for a
+			notification then unblock it now. */
+			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			{
+				( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+				prvAddTaskToReadyList( pxTCB );
+
+				/* The task should not have been on an event list. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+				#if( configUSE_TICKLESS_IDLE != 0 )
+				{
+					/* If a task is blocked waiting for a notification then
+					xNextTaskUnblockTime might be set to the blocked task's time
+					out time.  If the task is unblocked for a reason other than
+					a timeout xNextTaskUnblockTime is normally left unchanged,
+					because it will automatically get reset to a new value when
+					the tick count equals xNextTaskUnblockTime.  However if
+					tickless idling is used it might be more important to enter
+					sleep mode at the earliest possible time - so reset
+					xNextTaskUnblockTime here to ensure it is updated at the
+					earliest possible time. */
+					prvResetNextTaskUnblockTime();
+				}
+				#endif
+
+				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				{
+					/* The notified task has a priority above the currently
+					executing task so a yield is required. */
+					taskYIELD_IF_USING_PREEMPTION();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xTaskGenericNotifyFromISR( TaskHandle_t xTaskToNotify, uint32_t ulValue, eNotifyAction eAction, uint32_t *pulPreviousNotificationValue, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+	TCB_t * pxTCB;
+	uint8_t ucOriginalNotifyState;
+	BaseType_t xReturn = pdPASS;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( xTaskToNotify );
+
+		/* RTOS ports that support interrupt nesting have the concept of a
+		maximum	system call (or maximum API call) interrupt priority.
+		Interrupts that are	above the maximum system call priority are keep
+		permanently enabled, even when the RTOS kernel is in a critical section,
+		but cannot make any calls to FreeRTOS API functions.  If configASSERT()
+		is defined in FreeRTOSConfig.h then
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+		failure if a FreeRTOS API function is called from an interrupt that has
+		been assigned a priority above the configured maximum system call
+		priority.  Only FreeRTOS functions that end in FromISR can be called
+		from interrupts	that have been assigned a priority at or (logically)
+		below the maximum system call interrupt priority.  FreeRTOS maintains a
+		separate interrupt safe API to ensure interrupt entry is as fast and as
+		simple as possible.  More information (albeit Cortex-M specific) is
+		provided on the following link:
+		http://www.freertos.org/RTOS-Cortex-M3-M4.html */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		pxTCB = ( TCB_t * ) xTaskToNotify;
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pulPreviousNotificationValue != NULL )
+			{
+				*pulPreviousNotificationValue = pxTCB->ulNotifiedValue;
+			}
+
+			ucOriginalNotifyState = pxTCB->ucNotifyState;
+			pxTCB->ucNotifyState = taskNOTIFICATION_RECEIVED;
+
+			switch( eAction )
+			{
+				case eSetBits	:
+					pxTCB->ulNotifiedValue |= ulValue;
+					break;
+
+				case eIncrement	:
+					( pxTCB->ulNotifiedValue )++;
+					break;
+
+				case eSetValueWithOverwrite	:
+					pxTCB->ulNotifiedValue = ulValue;
+					break;
+
+				case eSetValueWithoutOverwrite :
+					if( ucOriginalNotifyState != taskNOTIFICATION_RECEIVED )
+					{
+						pxTCB->ulNotifiedValue = ulValue;
+					}
+					else
+					{
+						/* The value could not be written to the task. */
+						xReturn = pdFAIL;
+					}
+					break;
+
+				case eNoAction :
+					/* The task is being notified without its notify value being
+					updated. */
+					break;
+			}
+
+			traceTASK_NOTIFY_FROM_ISR();
+
+			/* If the task is in the blocked state specifically to wait for a
+			notification then unblock it now. */
+			if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
+			{
+				/* The task should not have been on an event list. */
+				configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+
+				if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+				{
+					( void ) uxListRemove( &( pxTCB->xGenericListItem ) );
+					prvAddTaskToReadyList( pxTCB );
+				}
+				else
+				{
+					/* The delayed and ready lists cannot be accessed, so hold
+					this task pending until the scheduler is resumed. */
+					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+				}
+
+				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				{
+					/* The notified task has a priority above the currently
+					executing task so a yield is required. */
+					if( pxHigherPriorityTaskWoken != NULL )
+					{
+						*pxHigherPriorityTaskWoken = pdTRUE;
+					}
+
+					/* Mark that a yield is pending in case the user is not
+					using the "xHigherPriorityTaskWoken" parameter. */
+					xYieldPending = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+	BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	BaseType_t xReturn;
+
+		/* If null is passed in here then it is the calling task that is having
+		its notification state cleared. */
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		taskENTER_CRITICAL();
+		{
+			if( pxTCB->ucNotifyState == taskNOTIFICATION_RECEIVED )
+			{
+				pxTCB->ucNotifyState = taskNOT_WAITING_NOTIFICATION;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvAddTaskToDeadlineHeap( TCB_t * const pxTCB )
+	{
+		if( ( pxTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) && ( pxTCB->xPeriod != ( TickType_t ) 0U ) )
+		{
+			if( pxTCB->uxDeadlineHeapIndex == taskNOT_IN_DEADLINE_HEAP )
+			{
+				/* xTaskSetDeadlineParameters() does not let more tasks have
+				deadline parameters than the heap can hold. */
+				configASSERT( uxDeadlineHeapSize < ( UBaseType_t ) configEDF_MAX_TASKS );
+
+				if( uxDeadlineHeapSize < ( UBaseType_t ) configEDF_MAX_TASKS )
+				{
+					/* Start at the first free leaf, and move towards the
+					root. */
+					uxDeadlineHeapSize++;
+					prvDeadlineHeapSiftUp( uxDeadlineHeapSize - ( UBaseType_t ) 1U, pxTCB );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvRemoveTaskFromDeadlineHeap( TCB_t * const pxTCB )
+	{
+	const UBaseType_t uxIndex = pxTCB->uxDeadlineHeapIndex;
+	TCB_t *pxLastTCB;
+
+		if( uxIndex != taskNOT_IN_DEADLINE_HEAP )
+		{
+			uxDeadlineHeapSize--;
+			pxTCB->uxDeadlineHeapIndex = taskNOT_IN_DEADLINE_HEAP;
+
+			/* Unless the task being removed was the last element, the last
+			element fills the hole it left, then moves whichever way is
+			required to restore the heap order. */
+			if( uxIndex != uxDeadlineHeapSize )
+			{
+				pxLastTCB = pxDeadlineHeap[ uxDeadlineHeapSize ];
+
+				if( ( uxIndex > ( UBaseType_t ) 0U ) && ( taskDEADLINE_IS_BEFORE( pxLastTCB->xDeadline, pxDeadlineHeap[ ( uxIndex - 1U ) >> 1U ]->xDeadline ) != pdFALSE ) )
+				{
+					prvDeadlineHeapSiftUp( uxIndex, pxLastTCB );
+				}
+				else
+				{
+					prvDeadlineHeapSiftDown( uxIndex, pxLastTCB );
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvSetTaskDeadline( TCB_t * const pxTCB, const TickType_t xDeadline )
+	{
+	const TickType_t xPreviousDeadline = pxTCB->xDeadline;
+
+		pxTCB->xDeadline = xDeadline;
+
+		if( pxTCB->uxDeadlineHeapIndex != taskNOT_IN_DEADLINE_HEAP )
+		{
+			if( taskDEADLINE_IS_BEFORE( xDeadline, xPreviousDeadline ) != pdFALSE )
+			{
+				prvDeadlineHeapSiftUp( pxTCB->uxDeadlineHeapIndex, pxTCB );
+			}
+			else
+			{
+				prvDeadlineHeapSiftDown( pxTCB->uxDeadlineHeapIndex, pxTCB );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvDeadlineHeapSiftUp( UBaseType_t uxIndex, TCB_t * const pxTCB )
+	{
+	UBaseType_t uxParent;
+	TCB_t *pxParent;
+
+		/* Move parents whose deadline is after pxTCB's down a level until
+		pxTCB's place is found. */
+		while( uxIndex > ( UBaseType_t ) 0U )
+		{
+			uxParent = ( uxIndex - 1U ) >> 1U;
+			pxParent = pxDeadlineHeap[ uxParent ];
+
+			if( taskDEADLINE_IS_BEFORE( pxTCB->xDeadline, pxParent->xDeadline ) == pdFALSE )
+			{
+				break;
+			}
+
+			pxDeadlineHeap[ uxIndex ] = pxParent;
+			pxParent->uxDeadlineHeapIndex = uxIndex;
+			uxIndex = uxParent;
+		}
+
+		pxDeadlineHeap[ uxIndex ] = pxTCB;
+		pxTCB->uxDeadlineHeapIndex = uxIndex;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	static void prvDeadlineHeapSiftDown( UBaseType_t uxIndex, TCB_t * const pxTCB )
+	{
+	UBaseType_t uxChild;
+	TCB_t *pxChild, *pxRightChild;
+
+		/* Move the child with the earliest deadline up a level until pxTCB's
+		place is found. */
+		for( ;; )
+		{
+			uxChild = ( uxIndex << 1U ) + 1U;
+
+			if( uxChild >= uxDeadlineHeapSize )
+			{
+				break;
+			}
+
+			pxChild = pxDeadlineHeap[ uxChild ];
+
+			if( ( uxChild + 1U ) < uxDeadlineHeapSize )
+			{
+				pxRightChild = pxDeadlineHeap[ uxChild + 1U ];
+
+				if( taskDEADLINE_IS_BEFORE( pxRightChild->xDeadline, pxChild->xDeadline ) != pdFALSE )
+				{
+					pxChild = pxRightChild;
+					uxChild++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( taskDEADLINE_IS_BEFORE( pxChild->xDeadline, pxTCB->xDeadline ) == pdFALSE )
+			{
+				break;
+			}
+
+			pxDeadlineHeap[ uxIndex ] = pxChild;
+			pxChild->uxDeadlineHeapIndex = uxIndex;
+			uxIndex = uxChild;
+		}
+
+		pxDeadlineHeap[ uxIndex ] = pxTCB;
+		pxTCB->uxDeadlineHeapIndex = uxIndex;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
 
-		/* Take a snapshot of the number of tasks in case it changes while this
-		function is executing. */
-		uxArraySize = uxCurrentNumberOfTasks;
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-		/* Allocate an array index for each task. */
-		pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) );
+	static TCB_t *prvSelectEarliestDeadlineTask( void )
+	{
+	TCB_t *pxTCB = pxCurrentTCB, *pxTopTCB;
 
-		if( pxTaskStatusArray != NULL )
+		/* pxCurrentTCB was selected in turn from the ready list of
+		configEDF_PRIORITY, and is kept if the heap holds no ready task, in
+		which case only tasks without deadline parameters are ready. */
+		while( uxDeadlineHeapSize > ( UBaseType_t ) 0U )
 		{
-			/* Generate the (binary) data. */
-			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, NULL );
+			pxTopTCB = pxDeadlineHeap[ 0 ];
 
-			/* Create a human readable table from the binary data. */
-			for( x = 0; x < uxArraySize; x++ )
+			if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_PRIORITY ] ), &( pxTopTCB->xGenericListItem ) ) != pdFALSE )
 			{
-				switch( pxTaskStatusArray[ x ].eCurrentState )
-				{
-				case eReady:		cStatus = tskREADY_CHAR;
-									break;
+				pxTCB = pxTopTCB;
+				break;
+			}
 
-				case eBlocked:		cStatus = tskBLOCKED_CHAR;
-									break;
+			/* The task has blocked, been suspended, or had its priority
+			raised by priority inheritance since it was added to the heap. */
+			prvRemoveTaskFromDeadlineHeap( pxTopTCB );
+		}
 
-				case eSuspended:	cStatus = tskSUSPENDED_CHAR;
-									break;
+		return pxTCB;
+	}
 
-				case eDeleted:		cStatus = tskDELETED_CHAR;
-									break;
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
 
-				default:			/* Should not get here, but it is included
-									to prevent static checking errors. */
-									cStatus = 0x00;
-									break;
-				}
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-				sprintf( pcWriteBuffer, "%s\t\t%c\t%u\t%u\t%u\r\n", pxTaskStatusArray[ x ].pcTaskName, cStatus, ( unsigned int ) pxTaskStatusArray[ x ].uxCurrentPriority, ( unsigned int ) pxTaskStatusArray[ x ].usStackHighWaterMark, ( unsigned int ) pxTaskStatusArray[ x ].xTaskNumber );
-				pcWriteBuffer += strlen( pcWriteBuffer );
+	static BaseType_t prvDeadlineTick( void )
+	{
+	TCB_t * const pxTCB = pxCurrentTCB;
+	BaseType_t xSwitchRequired = pdFALSE;
+
+		if( pxTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY )
+		{
+			if( ( pxTCB->xPeriod != ( TickType_t ) 0U ) && ( pxTCB->xBudget != ( TickType_t ) 0U ) )
+			{
+				( pxTCB->xBudgetRemaining )--;
+
+				if( pxTCB->xBudgetRemaining == ( TickType_t ) 0U )
+				{
+					/* The job has run for its budget.  As with a constant
+					bandwidth server, its deadline is postponed by a period and
+					its budget refilled, so it can continue, but can never take
+					more than xBudget ticks in each period from the tasks that
+					keep to their budgets. */
+					( pxTCB->ulBudgetOverruns )++;
+					traceTASK_BUDGET_OVERRUN( pxTCB );
+					pxTCB->xBudgetRemaining = pxTCB->xBudget;
+					prvSetTaskDeadline( pxTCB, pxTCB->xDeadline + pxTCB->xPeriod );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
 			}
 
-			/* Free the array again. */
-			vPortFree( pxTaskStatusArray );
+			#if ( configUSE_PREEMPTION == 1 )
+			{
+				/* Tasks that are no longer ready are discarded from the top of
+				the heap first, so a switch is only requested if it will select
+				a different task. */
+				if( prvSelectEarliestDeadlineTask() != pxTCB )
+				{
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_PREEMPTION */
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return xSwitchRequired;
 	}
 
-#endif /* ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) ) */
-/*----------------------------------------------------------*/
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
 
-#if ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) )
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-	void vTaskGetRunTimeStats( char *pcWriteBuffer )
+	BaseType_t xTaskSetDeadlineParameters( TaskHandle_t xTask, TickType_t xPeriod, TickType_t xRelativeDeadline, TickType_t xBudget )
 	{
-	TaskStatus_t *pxTaskStatusArray;
-	volatile UBaseType_t uxArraySize, x;
-	uint32_t ulTotalTime, ulStatsAsPercentage;
-
-		#if( configUSE_TRACE_FACILITY != 1 )
-		{
-			#error configUSE_TRACE_FACILITY must also be set to 1 in FreeRTOSConfig.h to use vTaskGetRunTimeStats().
-		}
-		#endif
-
-		/*
-		 * PLEASE NOTE:
-		 *
-		 * This function is provided for convenience only, and is used by many
-		 * of the demo applications.  Do not consider it to be part of the
-		 * scheduler.
-		 *
-		 * vTaskGetRunTimeStats() calls uxTaskGetSystemState(), then formats part
-		 * of the uxTaskGetSystemState() output into a human readable table that
-		 * displays the amount of time each task has spent in the Running state
-		 * in both absolute and percentage terms.
-		 *
-		 * vTaskGetRunTimeStats() has a dependency on the sprintf() C library
-		 * function that might bloat the code size, use a lot of stack, and
-		 * provide different results on different platforms.  An alternative,
-		 * tiny, third party, and limited functionality implementation of
-		 * sprintf() is provided in many of the FreeRTOS/Demo sub-directories in
-		 * a file called printf-stdarg.c (note printf-stdarg.c does not provide
-		 * a full snprintf() implementation!).
-		 *
-		 * It is recommended that production systems call uxTaskGetSystemState()
-		 * directly to get access to raw stats data, rather than indirectly
-		 * through a call to vTaskGetRunTimeStats().
-		 */
-
-		/* Make sure the write buffer does not contain a string. */
-		*pcWriteBuffer = 0x00;
-
-		/* Take a snapshot of the number of tasks in case it changes while this
-		function is executing. */
-		uxArraySize = uxCurrentNumberOfTasks;
+	TCB_t *pxTCB;
+	BaseType_t xReturn = pdPASS;
 
-		/* Allocate an array index for each task. */
-		pxTaskStatusArray = pvPortMalloc( uxCurrentNumberOfTasks * sizeof( TaskStatus_t ) );
+		configASSERT( ( xPeriod == ( TickType_t ) 0U ) || ( xRelativeDeadline > ( TickType_t ) 0U ) );
 
-		if( pxTaskStatusArray != NULL )
+		taskENTER_CRITICAL();
 		{
-			/* Generate the (binary) data. */
-			uxArraySize = uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, &ulTotalTime );
+			/* If null is passed in here then it is the calling task whose
+			parameters are being set. */
+			pxTCB = prvGetTCBFromHandle( xTask );
 
-			/* For percentage calculations. */
-			ulTotalTime /= 100UL;
+			if( ( xPeriod != ( TickType_t ) 0U ) && ( pxTCB->xPeriod == ( TickType_t ) 0U ) )
+			{
+				/* Every task with deadline parameters must fit in the deadline
+				heap. */
+				if( uxDeadlineTasks < ( UBaseType_t ) configEDF_MAX_TASKS )
+				{
+					uxDeadlineTasks++;
+				}
+				else
+				{
+					xReturn = pdFAIL;
+				}
+			}
+			else if( ( xPeriod == ( TickType_t ) 0U ) && ( pxTCB->xPeriod != ( TickType_t ) 0U ) )
+			{
+				uxDeadlineTasks--;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
 
-			/* Avoid divide by zero errors. */
-			if( ulTotalTime > 0 )
+			if( xReturn == pdPASS )
 			{
-				/* Create a human readable table from the binary data. */
-				for( x = 0; x < uxArraySize; x++ )
+				pxTCB->xPeriod = xPeriod;
+				pxTCB->xRelativeDeadline = xRelativeDeadline;
+				pxTCB->xBudget = xBudget;
+				pxTCB->xBudgetRemaining = xBudget;
+
+				/* The first job is released now. */
+				pxTCB->xReleaseTime = xTickCount;
+				pxTCB->xJobDeadline = xTickCount + xRelativeDeadline;
+
+				if( xPeriod != ( TickType_t ) 0U )
 				{
-					/* What percentage of the total run time has the task used?
-					This will always be rounded down to the nearest integer.
-					ulTotalRunTimeDiv100 has already been divided by 100. */
-					ulStatsAsPercentage = pxTaskStatusArray[ x ].ulRunTimeCounter / ulTotalTime;
+					prvSetTaskDeadline( pxTCB, pxTCB->xJobDeadline );
 
-					if( ulStatsAsPercentage > 0UL )
+					/* A ready task that had no deadline parameters joins the
+					heap now, rather than when it next becomes ready. */
+					if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ configEDF_PRIORITY ] ), &( pxTCB->xGenericListItem ) ) != pdFALSE )
 					{
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( pcWriteBuffer, "%s\t\t%lu\t\t%lu%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter, ulStatsAsPercentage );
-						}
-						#else
-						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( pcWriteBuffer, "%s\t\t%u\t\t%u%%\r\n", pxTaskStatusArray[ x ].pcTaskName, ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter, ( unsigned int ) ulStatsAsPercentage );
-						}
-						#endif
+						prvAddTaskToDeadlineHeap( pxTCB );
 					}
 					else
 					{
-						/* If the percentage is zero here then the task has
-						consumed less than 1% of the total run time. */
-						#ifdef portLU_PRINTF_SPECIFIER_REQUIRED
-						{
-							sprintf( pcWriteBuffer, "%s\t\t%lu\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, pxTaskStatusArray[ x ].ulRunTimeCounter );
-						}
-						#else
-						{
-							/* sizeof( int ) == sizeof( long ) so a smaller
-							printf() library can be used. */
-							sprintf( pcWriteBuffer, "%s\t\t%u\t\t<1%%\r\n", pxTaskStatusArray[ x ].pcTaskName, ( unsigned int ) pxTaskStatusArray[ x ].ulRunTimeCounter );
-						}
-						#endif
+						mtCOVERAGE_TEST_MARKER();
 					}
+				}
+				else
+				{
+					/* The task now runs in turn with the other tasks that have
+					no deadline parameters. */
+					prvRemoveTaskFromDeadlineHeap( pxTCB );
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
 
-					pcWriteBuffer += strlen( pcWriteBuffer );
+		return xReturn;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+	BaseType_t xTaskWaitForNextPeriod( void )
+	{
+	TickType_t xTimeToWake;
+	BaseType_t xAlreadyYielded, xShouldDelay, xReturn = pdPASS;
+
+		configASSERT( pxCurrentTCB->xPeriod > ( TickType_t ) 0U );
+		configASSERT( uxSchedulerSuspended == 0 );
+
+		vTaskSuspendAll();
+		{
+			/* Minor optimisation.  The tick count cannot change in this
+			block. */
+			const TickType_t xConstTickCount = xTickCount;
+
+			/* Account for the job that has just completed. */
+			( pxCurrentTCB->ulJobs )++;
+
+			if( taskDEADLINE_IS_BEFORE( pxCurrentTCB->xJobDeadline, xConstTickCount ) != pdFALSE )
+			{
+				( pxCurrentTCB->ulDeadlinesMissed )++;
+				traceTASK_DEADLINE_MISSED( pxCurrentTCB );
+				xReturn = pdFAIL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Release the next job one period after the last, so jobs that
+			complete late do not make the releases drift. */
+			xTimeToWake = pxCurrentTCB->xReleaseTime + pxCurrentTCB->xPeriod;
+			pxCurrentTCB->xReleaseTime = xTimeToWake;
+			pxCurrentTCB->xJobDeadline = xTimeToWake + pxCurrentTCB->xRelativeDeadline;
+
+			/* If the next job has already been released the task continues
+			with it straight away. */
+			xShouldDelay = taskDEADLINE_IS_BEFORE( xConstTickCount, xTimeToWake );
+
+			if( pxCurrentTCB->xBudget == ( TickType_t ) 0U )
+			{
+				/* Without a budget each job is ordered by its own deadline. */
+				prvSetTaskDeadline( pxCurrentTCB, pxCurrentTCB->xJobDeadline );
+			}
+			else if( ( xShouldDelay != pdFALSE ) && ( taskDEADLINE_IS_BEFORE( pxCurrentTCB->xDeadline, pxCurrentTCB->xJobDeadline ) != pdFALSE ) )
+			{
+				/* The task has kept up, so the next job starts with a full
+				budget and is ordered by its own deadline. */
+				pxCurrentTCB->xBudgetRemaining = pxCurrentTCB->xBudget;
+				prvSetTaskDeadline( pxCurrentTCB, pxCurrentTCB->xJobDeadline );
+			}
+			else
+			{
+				/* The task is behind, or overran its budget by so much its
+				deadline was postponed past that of the next job.  The next job
+				continues with the rest of the budget and the same deadline, as
+				if it were part of the last, so however far behind the task is
+				it never gets more than xBudget ticks in each period. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xShouldDelay != pdFALSE )
+			{
+				traceTASK_DELAY_UNTIL();
+
+				/* Remove the task from the ready list before adding it to the
+				blocked list as the same list item is used for both lists. */
+				if( uxListRemove( &( pxCurrentTCB->xGenericListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					/* The current task must be in a ready list, so there is
+					no need to check, and the port reset macro can be called
+					directly. */
+					portRESET_READY_PRIORITY( pxCurrentTCB->uxPriority, uxTopReadyPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
 				}
+
+				prvAddCurrentTaskToDelayedList( xTimeToWake );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+		}
+		xAlreadyYielded = xTaskResumeAll();
 
-			/* Free the array again. */
-			vPortFree( pxTaskStatusArray );
+		/* Force a reschedule if xTaskResumeAll has not already done so, as the
+		task has either blocked or been given a later deadline. */
+		if( xAlreadyYielded == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
 		}
 		else
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		return xReturn;
 	}
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) ) */
+#endif /* configUSE_EDF_SCHEDULING */
 /*-----------------------------------------------------------*/
 
-TickType_t uxTaskResetEventItemValue( void )
-{
-TickType_t uxReturn;
+#if ( configUSE_EDF_SCHEDULING == 1 )
 
-	uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+	void vTaskGetDeadlineStats( TaskHandle_t xTask, TaskDeadlineStats_t *pxDeadlineStats )
+	{
+	TCB_t *pxTCB;
 
-	/* Reset the event list item to its normal value - so it can be used with
-	queues and semaphores. */
-	listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+		configASSERT( pxDeadlineStats );
 
-	return uxReturn;
-}
+		taskENTER_CRITICAL();
+		{
+			/* If null is passed in here then it is the calling task whose
+			statistics are being read. */
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			pxDeadlineStats->ulJobs = pxTCB->ulJobs;
+			pxDeadlineStats->ulDeadlinesMissed = pxTCB->ulDeadlinesMissed;
+			pxDeadlineStats->ulBudgetOverruns = pxTCB->ulBudgetOverruns;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
 /*-----------------------------------------------------------*/
 
 #ifdef FREERTOS_MODULE_TEST
@@ -96,6 +96,60 @@ configUSE_TIMERS is set to 1 in FreeRTOSConfig.h. */
 /* Misc definitions. */
 #define tmrNO_DELAY		( TickType_t ) 0U
 
+/* Active timers are referenced from one of two containers, one for timers that
+expire before the tick count next overflows and one for timers that expire
+after it.  By default each container is a List_t sorted into expiry time order,
+so inserting a timer is O(n) in the number of active timers.  If
+configUSE_TIMER_HEAP is 1 each container is instead a binary min-heap keyed on
+expiry time, so inserting and removing a timer is O(log n).  The containers are
+only accessed through the macros below.  In both cases the expiry time is held
+in the timer's list item, and the containers are switched in the same way when
+the tick count overflows.  Timers that expire on the same tick are processed in
+the order they were inserted when lists are used, but in no particular order
+when heaps are used. */
+#if( configUSE_TIMER_HEAP == 1 )
+
+	#define tmrACTIVE_LIST_IS_EMPTY( pxActiveList )		( ( pxActiveList )->uxNumberOfTimers == ( UBaseType_t ) 0U )
+	#define tmrGET_HEAD_TIMER( pxActiveList )			( *( ( pxActiveList )->ppxRoot ) )
+	#define tmrINSERT_TIMER( pxActiveList, pxTimer )	prvTimerHeapInsert( ( pxActiveList ), ( pxTimer ) )
+	#define tmrREMOVE_TIMER( pxTimer )					prvTimerHeapRemove( pxTimer )
+	#define tmrTIMER_IS_ACTIVE( pxTimer )				( ( pxTimer )->pxTimerHeap != NULL )
+
+#else
+
+	#define tmrACTIVE_LIST_IS_EMPTY( pxActiveList )		listLIST_IS_EMPTY( pxActiveList )
+	#define tmrGET_HEAD_TIMER( pxActiveList )			( ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxActiveList ) )
+	#define tmrINSERT_TIMER( pxActiveList, pxTimer )	vListInsert( ( pxActiveList ), &( ( pxTimer )->xTimerListItem ) )
+	#define tmrREMOVE_TIMER( pxTimer )					( void ) uxListRemove( &( ( pxTimer )->xTimerListItem ) )
+	#define tmrTIMER_IS_ACTIVE( pxTimer )				( listIS_CONTAINED_WITHIN( NULL, &( ( pxTimer )->xTimerListItem ) ) == pdFALSE )
+
+#endif /* configUSE_TIMER_HEAP */
+
+/* The time at which an active timer will expire. */
+#define tmrGET_EXPIRY_TIME( pxTimer )		listGET_LIST_ITEM_VALUE( &( ( pxTimer )->xTimerListItem ) )
+
+/* If configUSE_TIMER_FAST_RESET is 1 then tasks and interrupts can start and
+reset timers by moving them within the active timer heaps directly, rather than
+by sending a command to the timer service task.  The heaps are then shared, so
+the timer service task must also access them from within a critical section.
+Otherwise only the timer service task accesses the active timer lists, and no
+critical section is needed. */
+#if( configUSE_TIMER_FAST_RESET == 1 )
+
+	#define tmrENTER_ACTIVE_LIST_CRITICAL()		taskENTER_CRITICAL()
+	#define tmrEXIT_ACTIVE_LIST_CRITICAL()		taskEXIT_CRITICAL()
+
+#else
+
+	#define tmrENTER_ACTIVE_LIST_CRITICAL()
+	#define tmrEXIT_ACTIVE_LIST_CRITICAL()
+
+#endif /* configUSE_TIMER_FAST_RESET */
+
+#if( configUSE_TIMER_HEAP == 1 )
+	struct tmrTimerHeap;
+#endif
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl
 {
@@ -108,6 +162,19 @@ typedef struct tmrTimerControl
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t			uxTimerNumber;		/*<< An ID assigned by trace tools such as FreeRTOS+Trace */
 	#endif
+
+	#if( configUSE_TIMER_HEAP == 1 )
+		struct tmrTimerHeap	*pxTimerHeap;		/*<< The heap that references the timer, or NULL if the timer is not active. */
+		UBaseType_t			uxHeapIndex;		/*<< The position of the timer within pxTimerHeap. */
+	#endif
+
+	#if( configUSE_TIMER_FAST_RESET == 1 )
+		UBaseType_t			uxCommandsPending;	/*<< The number of commands for the timer that are in the timer queue.  The timer is only reset directly when this is zero, so commands take effect in the order they were issued. */
+	#endif
+
+	#if( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+		uint8_t 			ucStaticallyAllocated; /*<< Set to pdTRUE if the timer was created statically so no attempt is made to free the memory again if the timer is later deleted. */
+	#endif
 } xTIMER;
 
 /* The old xTIMER name is maintained above then typedefed to the new Timer_t
@@ -150,20 +217,57 @@ typedef struct tmrTimerQueueMessage
 	} u;
 } DaemonTaskMessage_t;
 
+#if( configUSE_TIMER_HEAP == 1 )
+
+	/* A binary min-heap of active timers.  The element at index n is found at
+	ppxRoot[ n * xStride ].  The current and overflow heaps share a single array
+	of configTIMER_HEAP_LENGTH elements, one growing up from the start of the
+	array and the other growing down from its end.  As no more than
+	configTIMER_HEAP_LENGTH timers can exist at once the two never meet. */
+	typedef struct tmrTimerHeap
+	{
+		Timer_t **ppxRoot;					/*<< The element at index 0, which is the timer that expires first. */
+		BaseType_t xStride;					/*<< 1 if the heap grows up through the array, -1 if it grows down. */
+		UBaseType_t uxNumberOfTimers;		/*<< The number of timers in the heap. */
+	} TimerHeap_t;
+
+	typedef TimerHeap_t ActiveTimerList_t;
+
+#else
+
+	typedef List_t ActiveTimerList_t;
+
+#endif /* configUSE_TIMER_HEAP */
+
 /*lint -e956 A manual analysis and inspection has been used to determine which
 static variables must be declared volatile. */
 
 /* The list in which active timers are stored.  Timers are referenced in expire
 time order, with the nearest expiry time at the front of the list.  Only the
 timer service task is allowed to access these lists. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+PRIVILEGED_DATA static ActiveTimerList_t xActiveTimerList1;
+PRIVILEGED_DATA static ActiveTimerList_t xActiveTimerList2;
+PRIVILEGED_DATA static ActiveTimerList_t *pxCurrentTimerList;
+PRIVILEGED_DATA static ActiveTimerList_t *pxOverflowTimerList;
+
+#if( configUSE_TIMER_HEAP == 1 )
+
+	/* The storage shared by the two heaps, and the number of timers that exist
+	and so might need a place in one of the heaps.  uxTimersInExistence is only
+	accessed from within critical sections. */
+	PRIVILEGED_DATA static Timer_t *pxTimerHeapStorage[ configTIMER_HEAP_LENGTH ];
+	PRIVILEGED_DATA static UBaseType_t uxTimersInExistence = ( UBaseType_t ) 0U;
+
+#endif /* configUSE_TIMER_HEAP */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
 
+/* The tick count when the timer service task last checked for a tick count
+overflow.  If the tick count is now lower then the tick count has overflowed
+but the active timer lists have not been switched yet. */
+PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U;
+
 #if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
 
 	PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
@@ -203,7 +307,7 @@ static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const Tic
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto reload timer, then call its callback.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+static void prvProcessExpiredTimer( TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
 /*
  * The tick count has overflowed.  Switch the timer lists after ensuring the
@@ -231,6 +335,64 @@ static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIV
  */
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, const BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
 
+/*
+ * Called after a Timer_t structure has been allocated either statically or
+ * dynamically to fill in the structure's members.
+ */
+static void prvInitialiseNewTimer( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, Timer_t *pxNewTimer ) PRIVILEGED_FUNCTION; /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+
+#if( configUSE_TIMER_HEAP == 1 )
+
+	/*
+	 * Account for a timer that is about to be created.  Returns pdFAIL if
+	 * configTIMER_HEAP_LENGTH timers already exist, in which case the timer
+	 * must not be created as there might not be room for it in the heaps.
+	 */
+	static BaseType_t prvReserveTimerHeapElement( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Undo prvReserveTimerHeapElement() when a timer is deleted, or could not
+	 * be created after all.
+	 */
+	static void prvReleaseTimerHeapElement( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Add pxTimer to pxHeap, or remove pxTimer from the heap that contains it,
+	 * in O(log n) time.  The expiry time must already be set in the timer's
+	 * list item.
+	 */
+	static void prvTimerHeapInsert( TimerHeap_t * const pxHeap, Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+	static void prvTimerHeapRemove( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Place pxTimer in pxHeap, starting from index uxIndex and moving towards
+	 * the root, or towards the leaves, until the heap is ordered again.
+	 */
+	static void prvTimerHeapSiftUp( TimerHeap_t * const pxHeap, UBaseType_t uxIndex, Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+	static void prvTimerHeapSiftDown( TimerHeap_t * const pxHeap, UBaseType_t uxIndex, Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_HEAP */
+
+#if( configUSE_TIMER_FAST_RESET == 1 )
+
+	/*
+	 * Start or reset pxTimer by moving it within the active timer heaps rather
+	 * than by sending a command to the timer service task.  The timer service
+	 * task is only woken if the timer becomes the next timer to expire.  Returns
+	 * pdFAIL, without changing the timer, if the command must be sent to the
+	 * timer service task after all - because earlier commands for the timer
+	 * have not been processed yet, the tick count has overflowed but the timer
+	 * lists have not been switched yet, or the timer has already expired.
+	 */
+	static BaseType_t prvResetTimerDirectly( Timer_t * const pxTimer, const TickType_t xCommandTime, const BaseType_t xFromISR, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Add xAdjustment to the count of commands that are queued for pxTimer.
+	 */
+	static void prvAdjustCommandsPending( Timer_t * const pxTimer, const BaseType_t xAdjustment, const BaseType_t xFromISR ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_TIMER_FAST_RESET */
+
 /*-----------------------------------------------------------*/
 
 BaseType_t xTimerCreateTimerTask( void )
@@ -245,7 +407,34 @@ BaseType_t xReturn = pdFAIL;
 
 	if( xTimerQueue != NULL )
 	{
-		#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
+		#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+		{
+		StaticTask_t *pxTimerTaskTCBBuffer = NULL;
+		StackType_t *pxTimerTaskStackBuffer = NULL;
+		uint16_t usTimerTaskStackSize = ( uint16_t ) configTIMER_TASK_STACK_DEPTH;
+		TaskHandle_t xTimerHandle;
+
+			/* The timer service task is created using memory provided by the
+			application. */
+			vApplicationGetTimerTaskMemory( &pxTimerTaskTCBBuffer, &pxTimerTaskStackBuffer, &usTimerTaskStackSize );
+			xTimerHandle = xTaskCreateStatic( prvTimerTask, "Tmr Svc", usTimerTaskStackSize, NULL, ( ( UBaseType_t ) configTIMER_TASK_PRIORITY ) | portPRIVILEGE_BIT, pxTimerTaskStackBuffer, pxTimerTaskTCBBuffer );
+
+			if( xTimerHandle != NULL )
+			{
+				#if ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
+				{
+					xTimerTaskHandle = xTimerHandle;
+				}
+				#endif
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#elif ( INCLUDE_xTimerGetTimerDaemonTaskHandle == 1 )
 		{
 			/* Create the timer task, storing its handle in xTimerTaskHandle so
 			it can be returned by the xTimerGetTimerDaemonTaskHandle() function. */
@@ -268,44 +457,136 @@ BaseType_t xReturn = pdFAIL;
 }
 /*-----------------------------------------------------------*/
 
-TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
-{
-Timer_t *pxNewTimer;
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
 
-	/* Allocate the timer structure. */
-	if( xTimerPeriodInTicks == ( TickType_t ) 0U )
+	TimerHandle_t xTimerCreate( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		pxNewTimer = NULL;
+	Timer_t *pxNewTimer;
+
+		/* Allocate the timer structure. */
+		if( xTimerPeriodInTicks == ( TickType_t ) 0U )
+		{
+			pxNewTimer = NULL;
+		}
+		#if( configUSE_TIMER_HEAP == 1 )
+		else if( prvReserveTimerHeapElement() == pdFAIL )
+		{
+			pxNewTimer = NULL;
+			traceTIMER_CREATE_FAILED();
+		}
+		#endif /* configUSE_TIMER_HEAP */
+		else
+		{
+			pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
+			if( pxNewTimer != NULL )
+			{
+				#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+				{
+					/* Timers can be created statically or dynamically, so note
+					this timer was created dynamically in case the timer is
+					later deleted. */
+					pxNewTimer->ucStaticallyAllocated = pdFALSE;
+				}
+				#endif /* configSUPPORT_STATIC_ALLOCATION */
+
+				prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxNewTimer );
+			}
+			else
+			{
+				#if( configUSE_TIMER_HEAP == 1 )
+				{
+					prvReleaseTimerHeapElement();
+				}
+				#endif /* configUSE_TIMER_HEAP */
+
+				traceTIMER_CREATE_FAILED();
+			}
+		}
+
+		/* 0 is not a valid value for xTimerPeriodInTicks. */
+		configASSERT( ( xTimerPeriodInTicks > 0 ) );
+
+		return ( TimerHandle_t ) pxNewTimer;
 	}
-	else
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+	TimerHandle_t xTimerCreateStatic( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, StaticTimer_t *pxTimerBuffer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
 	{
-		pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
-		if( pxNewTimer != NULL )
+	Timer_t *pxNewTimer;
+
+		/* The StaticTimer_t structure must be exactly the same size as the real
+		timer structure, otherwise the application has been built with a
+		different configuration to the kernel. */
+		configASSERT( sizeof( StaticTimer_t ) == sizeof( Timer_t ) );
+
+		/* A pointer to a StaticTimer_t structure MUST be provided, use it. */
+		configASSERT( pxTimerBuffer );
+
+		/* 0 is not a valid value for xTimerPeriodInTicks. */
+		configASSERT( ( xTimerPeriodInTicks > 0 ) );
+
+		#if( configUSE_TIMER_HEAP == 1 )
+			if( ( pxTimerBuffer != NULL ) && ( xTimerPeriodInTicks != ( TickType_t ) 0U ) && ( prvReserveTimerHeapElement() != pdFAIL ) )
+		#else
+			if( ( pxTimerBuffer != NULL ) && ( xTimerPeriodInTicks != ( TickType_t ) 0U ) )
+		#endif /* configUSE_TIMER_HEAP */
 		{
-			/* Ensure the infrastructure used by the timer service task has been
-			created/initialised. */
-			prvCheckForValidListAndQueue();
+			pxNewTimer = ( Timer_t * ) pxTimerBuffer; /*lint !e740 Unusual cast is ok as the structures are designed to have the same alignment, and the size is checked by an assert. */
 
-			/* Initialise the timer structure members using the function parameters. */
-			pxNewTimer->pcTimerName = pcTimerName;
-			pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
-			pxNewTimer->uxAutoReload = uxAutoReload;
-			pxNewTimer->pvTimerID = pvTimerID;
-			pxNewTimer->pxCallbackFunction = pxCallbackFunction;
-			vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+			#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* Timers can be created statically or dynamically so note this
+				timer was created statically in case it is later deleted. */
+				pxNewTimer->ucStaticallyAllocated = pdTRUE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 
-			traceTIMER_CREATE( pxNewTimer );
+			prvInitialiseNewTimer( pcTimerName, xTimerPeriodInTicks, uxAutoReload, pvTimerID, pxCallbackFunction, pxNewTimer );
 		}
 		else
 		{
+			pxNewTimer = NULL;
 			traceTIMER_CREATE_FAILED();
 		}
+
+		return ( TimerHandle_t ) pxNewTimer;
 	}
 
-	/* 0 is not a valid value for xTimerPeriodInTicks. */
-	configASSERT( ( xTimerPeriodInTicks > 0 ) );
+#endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseNewTimer( const char * const pcTimerName, const TickType_t xTimerPeriodInTicks, const UBaseType_t uxAutoReload, void * const pvTimerID, TimerCallbackFunction_t pxCallbackFunction, Timer_t *pxNewTimer ) /*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+{
+	/* Ensure the infrastructure used by the timer service task has been
+	created/initialised. */
+	prvCheckForValidListAndQueue();
+
+	/* Initialise the timer structure members using the function parameters. */
+	pxNewTimer->pcTimerName = pcTimerName;
+	pxNewTimer->xTimerPeriodInTicks = xTimerPeriodInTicks;
+	pxNewTimer->uxAutoReload = uxAutoReload;
+	pxNewTimer->pvTimerID = pvTimerID;
+	pxNewTimer->pxCallbackFunction = pxCallbackFunction;
+	vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+
+	#if( configUSE_TIMER_HEAP == 1 )
+	{
+		pxNewTimer->pxTimerHeap = NULL;
+		pxNewTimer->uxHeapIndex = ( UBaseType_t ) 0U;
+	}
+	#endif /* configUSE_TIMER_HEAP */
+
+	#if( configUSE_TIMER_FAST_RESET == 1 )
+	{
+		pxNewTimer->uxCommandsPending = ( UBaseType_t ) 0U;
+	}
+	#endif /* configUSE_TIMER_FAST_RESET */
 
-	return ( TimerHandle_t ) pxNewTimer;
+	traceTIMER_CREATE( pxNewTimer );
 }
 /*-----------------------------------------------------------*/
 
@@ -318,25 +599,71 @@ DaemonTaskMessage_t xMessage;
 	on a particular timer definition. */
 	if( xTimerQueue != NULL )
 	{
-		/* Send a command to the timer service task to start the xTimer timer. */
-		xMessage.xMessageID = xCommandID;
-		xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
-		xMessage.u.xTimerParameters.pxTimer = ( Timer_t * ) xTimer;
+		#if( configUSE_TIMER_FAST_RESET == 1 )
+		{
+			/* Starting or resetting a timer only needs the timer to be moved
+			within the active timer heaps, which can often be done without the
+			timer service task.  Commands issued before the scheduler has started
+			are left to the timer service task, as before. */
+			if( ( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED ) &&
+				( ( xCommandID == tmrCOMMAND_START ) || ( xCommandID == tmrCOMMAND_RESET ) || ( xCommandID == tmrCOMMAND_START_FROM_ISR ) || ( xCommandID == tmrCOMMAND_RESET_FROM_ISR ) ) )
+			{
+				xReturn = prvResetTimerDirectly( ( Timer_t * ) xTimer, xOptionalValue, ( xCommandID >= tmrFIRST_FROM_ISR_COMMAND ), pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TIMER_FAST_RESET */
 
-		if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+		if( xReturn == pdFAIL )
 		{
-			if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+			/* Send a command to the timer service task to start the xTimer timer. */
+			xMessage.xMessageID = xCommandID;
+			xMessage.u.xTimerParameters.xMessageValue = xOptionalValue;
+			xMessage.u.xTimerParameters.pxTimer = ( Timer_t * ) xTimer;
+
+			#if( configUSE_TIMER_FAST_RESET == 1 )
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+				/* The count is incremented before the command is sent, so the
+				timer cannot be reset directly while the command is queued. */
+				prvAdjustCommandsPending( ( Timer_t * ) xTimer, 1, ( xCommandID >= tmrFIRST_FROM_ISR_COMMAND ) );
+			}
+			#endif /* configUSE_TIMER_FAST_RESET */
+
+			if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+			{
+				if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+				{
+					xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+				}
+				else
+				{
+					xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+				}
 			}
 			else
 			{
-				xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+				xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			}
+
+			#if( configUSE_TIMER_FAST_RESET == 1 )
+			{
+				if( xReturn == pdFAIL )
+				{
+					prvAdjustCommandsPending( ( Timer_t * ) xTimer, -1, ( xCommandID >= tmrFIRST_FROM_ISR_COMMAND ) );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
+			#endif /* configUSE_TIMER_FAST_RESET */
 		}
 		else
 		{
-			xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			mtCOVERAGE_TEST_MARKER();
 		}
 
 		traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
@@ -363,24 +690,68 @@ DaemonTaskMessage_t xMessage;
 #endif
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+static void prvProcessExpiredTimer( TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
-BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
+BaseType_t xResult, xProcessTimerNow = pdFALSE;
+Timer_t *pxTimer;
 
-	/* Remove the timer from the list of active timers.  A check has already
-	been performed to ensure the list is not empty. */
-	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-	traceTIMER_EXPIRED( pxTimer );
+	tmrENTER_ACTIVE_LIST_CRITICAL();
+	{
+		pxTimer = tmrGET_HEAD_TIMER( pxCurrentTimerList );
 
-	/* If the timer is an auto reload timer then calculate the next
-	expiry time and re-insert the timer in the list of active timers. */
-	if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+		#if( configUSE_TIMER_FAST_RESET == 1 )
+		{
+			/* Timers might have been reset directly since xNextExpireTime was
+			obtained, so check the timer at the head of the list has still
+			expired. */
+			if( tmrACTIVE_LIST_IS_EMPTY( pxCurrentTimerList ) != pdFALSE )
+			{
+				pxTimer = NULL;
+			}
+			else if( tmrGET_EXPIRY_TIME( pxTimer ) > xTimeNow )
+			{
+				pxTimer = NULL;
+			}
+			else
+			{
+				xNextExpireTime = tmrGET_EXPIRY_TIME( pxTimer );
+			}
+		}
+		#endif /* configUSE_TIMER_FAST_RESET */
+
+		if( pxTimer != NULL )
+		{
+			/* Remove the timer from the list of active timers.  A check has
+			already been performed to ensure the list is not empty. */
+			tmrREMOVE_TIMER( pxTimer );
+
+			/* If the timer is an auto reload timer then calculate the next
+			expiry time and re-insert the timer in the list of active timers.
+			The timer is inserted into a list using a time relative to anything
+			other than the current time.  It will therefore be inserted into
+			the correct list relative to the time this task thinks it is
+			now. */
+			if( pxTimer->uxAutoReload == ( UBaseType_t ) pdTRUE )
+			{
+				xProcessTimerNow = prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	tmrEXIT_ACTIVE_LIST_CRITICAL();
+
+	if( pxTimer != NULL )
 	{
-		/* The timer is inserted into a list using a time relative to anything
-		other than the current time.  It will therefore be inserted into the
-		correct list relative to the time this task thinks it is now. */
-		if( prvInsertTimerInActiveList( pxTimer, ( xNextExpireTime + pxTimer->xTimerPeriodInTicks ), xTimeNow, xNextExpireTime ) == pdTRUE )
+		traceTIMER_EXPIRED( pxTimer );
+
+		if( xProcessTimerNow == pdTRUE )
 		{
 			/* The timer expired before it was added to the active timer
 			list.  Reload it now.  */
@@ -392,14 +763,14 @@ Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTi
 		{
 			mtCOVERAGE_TEST_MARKER();
 		}
+
+		/* Call the timer callback. */
+		pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 	}
 	else
 	{
 		mtCOVERAGE_TEST_MARKER();
 	}
-
-	/* Call the timer callback. */
-	pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
 }
 /*-----------------------------------------------------------*/
 
@@ -491,16 +862,20 @@ TickType_t xNextExpireTime;
 	this task to unblock when the tick count overflows, at which point the
 	timer lists will be switched and the next expiry time can be
 	re-assessed.  */
-	*pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-	if( *pxListWasEmpty == pdFALSE )
+	tmrENTER_ACTIVE_LIST_CRITICAL();
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
-	}
-	else
-	{
-		/* Ensure the task unblocks when the tick count rolls over. */
-		xNextExpireTime = ( TickType_t ) 0U;
+		*pxListWasEmpty = tmrACTIVE_LIST_IS_EMPTY( pxCurrentTimerList );
+		if( *pxListWasEmpty == pdFALSE )
+		{
+			xNextExpireTime = tmrGET_EXPIRY_TIME( tmrGET_HEAD_TIMER( pxCurrentTimerList ) );
+		}
+		else
+		{
+			/* Ensure the task unblocks when the tick count rolls over. */
+			xNextExpireTime = ( TickType_t ) 0U;
+		}
 	}
+	tmrEXIT_ACTIVE_LIST_CRITICAL();
 
 	return xNextExpireTime;
 }
@@ -509,7 +884,6 @@ TickType_t xNextExpireTime;
 static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
 {
 TickType_t xTimeNow;
-PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Variable is only accessible to one task. */
 
 	xTimeNow = xTaskGetTickCount();
 
@@ -523,7 +897,13 @@ PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U; /*lint !e956 Va
 		*pxTimerListsWereSwitched = pdFALSE;
 	}
 
-	xLastTime = xTimeNow;
+	/* Only written once the lists have been switched, so timers are not reset
+	directly while the lists are being switched. */
+	tmrENTER_ACTIVE_LIST_CRITICAL();
+	{
+		xLastTime = xTimeNow;
+	}
+	tmrEXIT_ACTIVE_LIST_CRITICAL();
 
 	return xTimeNow;
 }
@@ -548,7 +928,7 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+			tmrINSERT_TIMER( pxOverflowTimerList, pxTimer );
 		}
 	}
 	else
@@ -562,7 +942,7 @@ BaseType_t xProcessTimerNow = pdFALSE;
 		}
 		else
 		{
-			vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+			tmrINSERT_TIMER( pxCurrentTimerList, pxTimer );
 		}
 	}
 
@@ -582,8 +962,9 @@ TickType_t xTimeNow;
 		#if ( INCLUDE_xTimerPendFunctionCall == 1 )
 		{
 			/* Negative commands are pended function calls rather than timer
-			commands. */
-			if( xMessage.xMessageID < 0 )
+			commands, other than tmrCOMMAND_WAKE_TIMER_TASK, which does
+			nothing other than unblock this task. */
+			if( ( xMessage.xMessageID == tmrCOMMAND_EXECUTE_CALLBACK ) || ( xMessage.xMessageID == tmrCOMMAND_EXECUTE_CALLBACK_FROM_ISR ) )
 			{
 				const CallbackParameters_t * const pxCallback = &( xMessage.u.xCallbackParameters );
 
@@ -609,15 +990,19 @@ TickType_t xTimeNow;
 			software timer. */
 			pxTimer = xMessage.u.xTimerParameters.pxTimer;
 
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+			tmrENTER_ACTIVE_LIST_CRITICAL();
 			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-			}
-			else
-			{
-				mtCOVERAGE_TEST_MARKER();
+				if( tmrTIMER_IS_ACTIVE( pxTimer ) )
+				{
+					/* The timer is in a list, remove it. */
+					tmrREMOVE_TIMER( pxTimer );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
 			}
+			tmrEXIT_ACTIVE_LIST_CRITICAL();
 
 			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
 
@@ -637,7 +1022,13 @@ TickType_t xTimeNow;
 			    case tmrCOMMAND_RESET_FROM_ISR :
 				case tmrCOMMAND_START_DONT_TRACE :
 					/* Start or restart a timer. */
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) == pdTRUE )
+					tmrENTER_ACTIVE_LIST_CRITICAL();
+					{
+						xResult = prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue );
+					}
+					tmrEXIT_ACTIVE_LIST_CRITICAL();
+
+					if( xResult == pdTRUE )
 					{
 						/* The timer expired before it was added to the active
 						timer list.  Process it now. */
@@ -678,19 +1069,60 @@ TickType_t xTimeNow;
 					zero the next expiry time can only be in the future, meaning
 					(unlike for the xTimerStart() case above) there is no fail case
 					that needs to be handled here. */
-					( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+					tmrENTER_ACTIVE_LIST_CRITICAL();
+					{
+						( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+					}
+					tmrEXIT_ACTIVE_LIST_CRITICAL();
 					break;
 
 				case tmrCOMMAND_DELETE :
 					/* The timer has already been removed from the active list,
-					just free up the memory. */
-					vPortFree( pxTimer );
+					just free up the memory if the memory was dynamically
+					allocated. */
+					#if( configUSE_TIMER_HEAP == 1 )
+					{
+						prvReleaseTimerHeapElement();
+					}
+					#endif /* configUSE_TIMER_HEAP */
+
+					#if( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+					{
+						vPortFree( pxTimer );
+					}
+					#elif( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+					{
+						if( pxTimer->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+						{
+							vPortFree( pxTimer );
+						}
+						else
+						{
+							mtCOVERAGE_TEST_MARKER();
+						}
+					}
+					#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
 					break;
 
 				default	:
 					/* Don't expect to get here. */
 					break;
 			}
+
+			#if( configUSE_TIMER_FAST_RESET == 1 )
+			{
+				/* The command has been processed.  A deleted timer must not be
+				accessed again. */
+				if( xMessage.xMessageID != tmrCOMMAND_DELETE )
+				{
+					prvAdjustCommandsPending( pxTimer, -1, pdFALSE );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_TIMER_FAST_RESET */
 		}
 	}
 }
@@ -699,21 +1131,22 @@ TickType_t xTimeNow;
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
-List_t *pxTemp;
+ActiveTimerList_t *pxTemp;
 Timer_t *pxTimer;
 BaseType_t xResult;
 
 	/* The tick count has overflowed.  The timer lists must be switched.
 	If there are any timers still referenced from the current timer list
 	then they must have expired and should be processed before the lists
-	are switched. */
-	while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+	are switched.  Timers are not reset directly while the tick count is
+	lower than xLastTime, so no critical section is needed here even if
+	configUSE_TIMER_FAST_RESET is 1. */
+	while( tmrACTIVE_LIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
 	{
-		xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
-
 		/* Remove the timer from the list. */
-		pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
-		( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+		pxTimer = tmrGET_HEAD_TIMER( pxCurrentTimerList );
+		xNextExpireTime = tmrGET_EXPIRY_TIME( pxTimer );
+		tmrREMOVE_TIMER( pxTimer );
 		traceTIMER_EXPIRED( pxTimer );
 
 		/* Execute its callback, then send a command to restart the timer if
@@ -734,7 +1167,7 @@ BaseType_t xResult;
 			{
 				listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xReloadTime );
 				listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
-				vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+				tmrINSERT_TIMER( pxCurrentTimerList, pxTimer );
 			}
 			else
 			{
@@ -764,11 +1197,38 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
+			#if( configUSE_TIMER_HEAP == 1 )
+			{
+				xActiveTimerList1.ppxRoot = &( pxTimerHeapStorage[ 0 ] );
+				xActiveTimerList1.xStride = ( BaseType_t ) 1;
+				xActiveTimerList1.uxNumberOfTimers = ( UBaseType_t ) 0U;
+				xActiveTimerList2.ppxRoot = &( pxTimerHeapStorage[ configTIMER_HEAP_LENGTH - 1 ] );
+				xActiveTimerList2.xStride = ( BaseType_t ) -1;
+				xActiveTimerList2.uxNumberOfTimers = ( UBaseType_t ) 0U;
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+			}
+			#endif /* configUSE_TIMER_HEAP */
 			pxCurrentTimerList = &xActiveTimerList1;
 			pxOverflowTimerList = &xActiveTimerList2;
-			xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+
+			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
+			{
+				/* The timer queue is allocated statically in case
+				configSUPPORT_DYNAMIC_ALLOCATION is 0. */
+				static StaticQueue_t xStaticTimerQueue;
+				static uint8_t ucStaticTimerQueueStorage[ ( size_t ) configTIMER_QUEUE_LENGTH * sizeof( DaemonTaskMessage_t ) ];
+
+				xTimerQueue = xQueueCreateStatic( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ), &( ucStaticTimerQueueStorage[ 0 ] ), &xStaticTimerQueue );
+			}
+			#else
+			{
+				xTimerQueue = xQueueCreate( ( UBaseType_t ) configTIMER_QUEUE_LENGTH, sizeof( DaemonTaskMessage_t ) );
+			}
+			#endif
 			configASSERT( xTimerQueue );
 
 			#if ( configQUEUE_REGISTRY_SIZE > 0 )
@@ -803,8 +1263,15 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 	{
 		/* Checking to see if it is in the NULL list in effect checks to see if
 		it is referenced from either the current or the overflow timer lists in
-		one go, but the logic has to be reversed, hence the '!'. */
-		xTimerIsInActiveList = !( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) );
+		one go. */
+		if( tmrTIMER_IS_ACTIVE( pxTimer ) )
+		{
+			xTimerIsInActiveList = pdTRUE;
+		}
+		else
+		{
+			xTimerIsInActiveList = pdFALSE;
+		}
 	}
 	taskEXIT_CRITICAL();
 
@@ -812,6 +1279,316 @@ Timer_t *pxTimer = ( Timer_t * ) xTimer;
 } /*lint !e818 Can't be pointer to const due to the typedef. */
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TIMER_HEAP == 1 )
+
+	static BaseType_t prvReserveTimerHeapElement( void )
+	{
+	BaseType_t xReturn;
+
+		taskENTER_CRITICAL();
+		{
+			if( uxTimersInExistence < ( UBaseType_t ) configTIMER_HEAP_LENGTH )
+			{
+				uxTimersInExistence++;
+				xReturn = pdPASS;
+			}
+			else
+			{
+				xReturn = pdFAIL;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_HEAP == 1 )
+
+	static void prvReleaseTimerHeapElement( void )
+	{
+		taskENTER_CRITICAL();
+		{
+			configASSERT( uxTimersInExistence );
+			uxTimersInExistence--;
+		}
+		taskEXIT_CRITICAL();
+	}
+
+#endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_HEAP == 1 )
+
+	static void prvTimerHeapInsert( TimerHeap_t * const pxHeap, Timer_t * const pxTimer )
+	{
+	UBaseType_t uxIndex;
+
+		/* prvReserveTimerHeapElement() ensures there is always room. */
+		configASSERT( ( xActiveTimerList1.uxNumberOfTimers + xActiveTimerList2.uxNumberOfTimers ) < ( UBaseType_t ) configTIMER_HEAP_LENGTH );
+
+		/* Start at the first free leaf, and move towards the root. */
+		uxIndex = pxHeap->uxNumberOfTimers;
+		( pxHeap->uxNumberOfTimers )++;
+		pxTimer->pxTimerHeap = pxHeap;
+		prvTimerHeapSiftUp( pxHeap, uxIndex, pxTimer );
+	}
+
+#endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_HEAP == 1 )
+
+	static void prvTimerHeapRemove( Timer_t * const pxTimer )
+	{
+	TimerHeap_t * const pxHeap = pxTimer->pxTimerHeap;
+	const UBaseType_t uxIndex = pxTimer->uxHeapIndex;
+	Timer_t *pxLastTimer;
+
+		( pxHeap->uxNumberOfTimers )--;
+		pxTimer->pxTimerHeap = NULL;
+
+		/* Unless the timer being removed was the last element, the last
+		element fills the hole it left, then moves whichever way is required to
+		restore the heap order. */
+		if( uxIndex != pxHeap->uxNumberOfTimers )
+		{
+			pxLastTimer = pxHeap->ppxRoot[ ( BaseType_t ) pxHeap->uxNumberOfTimers * pxHeap->xStride ];
+
+			if( ( uxIndex > ( UBaseType_t ) 0U ) && ( tmrGET_EXPIRY_TIME( pxLastTimer ) < tmrGET_EXPIRY_TIME( pxHeap->ppxRoot[ ( BaseType_t ) ( ( uxIndex - 1U ) >> 1U ) * pxHeap->xStride ] ) ) )
+			{
+				prvTimerHeapSiftUp( pxHeap, uxIndex, pxLastTimer );
+			}
+			else
+			{
+				prvTimerHeapSiftDown( pxHeap, uxIndex, pxLastTimer );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+#endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_HEAP == 1 )
+
+	static void prvTimerHeapSiftUp( TimerHeap_t * const pxHeap, UBaseType_t uxIndex, Timer_t * const pxTimer )
+	{
+	const TickType_t xExpiryTime = tmrGET_EXPIRY_TIME( pxTimer );
+	UBaseType_t uxParent;
+	Timer_t *pxParent;
+
+		/* Move parents that expire after pxTimer down a level until pxTimer's
+		place is found. */
+		while( uxIndex > ( UBaseType_t ) 0U )
+		{
+			uxParent = ( uxIndex - 1U ) >> 1U;
+			pxParent = pxHeap->ppxRoot[ ( BaseType_t ) uxParent * pxHeap->xStride ];
+
+			if( tmrGET_EXPIRY_TIME( pxParent ) <= xExpiryTime )
+			{
+				break;
+			}
+
+			pxHeap->ppxRoot[ ( BaseType_t ) uxIndex * pxHeap->xStride ] = pxParent;
+			pxParent->uxHeapIndex = uxIndex;
+			uxIndex = uxParent;
+		}
+
+		pxHeap->ppxRoot[ ( BaseType_t ) uxIndex * pxHeap->xStride ] = pxTimer;
+		pxTimer->uxHeapIndex = uxIndex;
+	}
+
+#endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_HEAP == 1 )
+
+	static void prvTimerHeapSiftDown( TimerHeap_t * const pxHeap, UBaseType_t uxIndex, Timer_t * const pxTimer )
+	{
+	const TickType_t xExpiryTime = tmrGET_EXPIRY_TIME( pxTimer );
+	UBaseType_t uxChild;
+	Timer_t *pxChild, *pxRightChild;
+
+		/* Move the child that expires first up a level until pxTimer's place
+		is found. */
+		for( ;; )
+		{
+			uxChild = ( uxIndex << 1U ) + 1U;
+
+			if( uxChild >= pxHeap->uxNumberOfTimers )
+			{
+				break;
+			}
+
+			pxChild = pxHeap->ppxRoot[ ( BaseType_t ) uxChild * pxHeap->xStride ];
+
+			if( ( uxChild + 1U ) < pxHeap->uxNumberOfTimers )
+			{
+				pxRightChild = pxHeap->ppxRoot[ ( BaseType_t ) ( uxChild + 1U ) * pxHeap->xStride ];
+
+				if( tmrGET_EXPIRY_TIME( pxRightChild ) < tmrGET_EXPIRY_TIME( pxChild ) )
+				{
+					pxChild = pxRightChild;
+					uxChild++;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xExpiryTime <= tmrGET_EXPIRY_TIME( pxChild ) )
+			{
+				break;
+			}
+
+			pxHeap->ppxRoot[ ( BaseType_t ) uxIndex * pxHeap->xStride ] = pxChild;
+			pxChild->uxHeapIndex = uxIndex;
+			uxIndex = uxChild;
+		}
+
+		pxHeap->ppxRoot[ ( BaseType_t ) uxIndex * pxHeap->xStride ] = pxTimer;
+		pxTimer->uxHeapIndex = uxIndex;
+	}
+
+#endif /* configUSE_TIMER_HEAP */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_FAST_RESET == 1 )
+
+	static BaseType_t prvResetTimerDirectly( Timer_t * const pxTimer, const TickType_t xCommandTime, const BaseType_t xFromISR, BaseType_t * const pxHigherPriorityTaskWoken )
+	{
+	BaseType_t xReturn = pdFAIL, xWakeTimerTask = pdFALSE;
+	UBaseType_t uxSavedInterruptStatus = ( UBaseType_t ) 0U;
+	TickType_t xTimeNow;
+	DaemonTaskMessage_t xMessage;
+
+		if( xFromISR != pdFALSE )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			xTimeNow = xTaskGetTickCountFromISR();
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+			xTimeNow = xTaskGetTickCount();
+		}
+		{
+			/* The timer can only be reset here if no commands for it are
+			queued, the timer lists are not waiting to be switched following a
+			tick count overflow, the command time is in the same tick count
+			epoch as the current time, and the timer will expire in the future -
+			in which case prvInsertTimerInActiveList() cannot return pdTRUE. */
+			if( ( pxTimer->uxCommandsPending == ( UBaseType_t ) 0U ) &&
+				( xTimeNow >= xLastTime ) &&
+				( xCommandTime <= xTimeNow ) &&
+				( ( xTimeNow - xCommandTime ) < pxTimer->xTimerPeriodInTicks ) )
+			{
+				if( tmrTIMER_IS_ACTIVE( pxTimer ) )
+				{
+					tmrREMOVE_TIMER( pxTimer );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				( void ) prvInsertTimerInActiveList( pxTimer, xCommandTime + pxTimer->xTimerPeriodInTicks, xTimeNow, xCommandTime );
+
+				/* The timer service task only needs to know about the timer
+				if the timer will now expire before any other, as the timer
+				service task might be blocked until a later time. */
+				if( ( pxTimer->pxTimerHeap == pxCurrentTimerList ) && ( pxTimer->uxHeapIndex == ( UBaseType_t ) 0U ) )
+				{
+					xWakeTimerTask = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		if( xFromISR != pdFALSE )
+		{
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			taskEXIT_CRITICAL();
+		}
+
+		if( xWakeTimerTask != pdFALSE )
+		{
+			/* The message only unblocks the timer service task so it
+			re-evaluates its block time.  If the queue is full the timer service
+			task is not blocked anyway, so the result is not checked. */
+			xMessage.xMessageID = tmrCOMMAND_WAKE_TIMER_TASK;
+			xMessage.u.xTimerParameters.xMessageValue = ( TickType_t ) 0U;
+			xMessage.u.xTimerParameters.pxTimer = NULL;
+
+			if( xFromISR != pdFALSE )
+			{
+				( void ) xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			}
+			else
+			{
+				( void ) xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TIMER_FAST_RESET */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TIMER_FAST_RESET == 1 )
+
+	static void prvAdjustCommandsPending( Timer_t * const pxTimer, const BaseType_t xAdjustment, const BaseType_t xFromISR )
+	{
+	UBaseType_t uxSavedInterruptStatus;
+
+		if( xFromISR != pdFALSE )
+		{
+			uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+			{
+				pxTimer->uxCommandsPending += ( UBaseType_t ) xAdjustment;
+			}
+			portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+		}
+		else
+		{
+			taskENTER_CRITICAL();
+			{
+				pxTimer->uxCommandsPending += ( UBaseType_t ) xAdjustment;
+			}
+			taskEXIT_CRITICAL();
+		}
+	}
+
+#endif /* configUSE_TIMER_FAST_RESET */
+/*-----------------------------------------------------------*/
+
 void *pvTimerGetTimerID( const TimerHandle_t xTimer )
 {
 Timer_t * const pxTimer = ( Timer_t * ) xTimer;
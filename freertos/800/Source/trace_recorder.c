@@ -0,0 +1,435 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder.  This #if is closed at the very bottom of this
+file. */
+#if( configUSE_TRACE_RECORDER == 1 )
+
+/*
+ * Return pdTRUE if the name record pxName is in use and describes the task,
+ * object or interrupt numbered uxObject of the same kind as ucType.  Tasks,
+ * interrupts and other objects are numbered independently.
+ */
+static BaseType_t prvNameMatches( const TraceRecorderName_t *pxName, uint8_t ucType, UBaseType_t uxObject );
+
+/*
+ * Return the name record for the given task, object or interrupt, claiming an
+ * unused record if there is not one already.  Records of deleted objects are
+ * only reused once there are no unused records, so the names of objects that
+ * still appear in the recorded events are kept for as long as possible.
+ * Returns NULL, and counts the dropped name, if the table is full.  Must be
+ * called with interrupts masked.
+ */
+static TraceRecorderName_t *prvGetName( uint8_t ucType, UBaseType_t uxObject );
+
+/*
+ * Copy pcName into the name record pxName.
+ */
+static void prvCopyName( TraceRecorderName_t *pxName, const char *pcName );
+
+/*-----------------------------------------------------------*/
+
+/* The buffer.  The tick interrupt is named up front as it is entered before
+the application has a chance to name anything. */
+static TraceRecorderBuffer_t xTraceRecorderBuffer =
+{
+	{
+		traceRECORDER_MAGIC,
+		traceRECORDER_VERSION,
+		configTRACE_RECORDER_TIMESTAMP_HZ,
+		configTRACE_RECORDER_EVENTS,
+		configTRACE_RECORDER_NAMES,
+		0UL,
+		0UL,
+		1UL
+	},
+	{
+		{ traceTICK_ISR_NUMBER, traceTYPE_ISR, traceNAME_FLAG_USED, "Tick" }
+	},
+	{
+		{ 0UL, 0U, 0U, 0U }
+	}
+};
+
+/* The number given to the next queue, semaphore, event group or stream buffer
+created.  Zero is not used so an object that was created before it could be
+numbered is recognisable. */
+static UBaseType_t uxNextObjectNumber = ( UBaseType_t ) 1;
+
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderEvent( uint8_t ucEvent, uint8_t ucParameter, UBaseType_t uxObject )
+{
+TraceRecorderEvent_t *pxEvent;
+UBaseType_t uxSavedInterruptStatus;
+
+	if( xTraceRecorderBuffer.xHeader.ulEnabled != 0UL )
+	{
+		/* Claiming the slot and taking the timestamp with interrupts masked
+		keeps the records in timestamp order, and stops an interrupt writing to
+		the slot claimed by the code it interrupted. */
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			pxEvent = &( xTraceRecorderBuffer.xEvents[ xTraceRecorderBuffer.xHeader.ulEventsWritten & ( uint32_t ) ( configTRACE_RECORDER_EVENTS - 1 ) ] );
+			( xTraceRecorderBuffer.xHeader.ulEventsWritten )++;
+
+			pxEvent->ulTimestamp = ( uint32_t ) configTRACE_RECORDER_TIMESTAMP();
+			pxEvent->usObject = ( uint16_t ) uxObject;
+			pxEvent->ucEvent = ucEvent;
+			pxEvent->ucParameter = ucParameter;
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderTaskCreate( UBaseType_t uxTaskNumber, const char *pcName )
+{
+TraceRecorderName_t *pxName;
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pxName = prvGetName( traceTYPE_TASK, uxTaskNumber );
+
+		if( pxName != NULL )
+		{
+			prvCopyName( pxName, pcName );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	vTraceRecorderEvent( traceEVENT_TASK_CREATE, 0, uxTaskNumber );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxTraceRecorderObjectCreate( uint8_t ucType )
+{
+UBaseType_t uxObject, uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxObject = uxNextObjectNumber;
+		uxNextObjectNumber++;
+
+		/* The object is not named until it is added to the queue registry, but
+		its type is recorded now. */
+		( void ) prvGetName( ucType, uxObject );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	vTraceRecorderEvent( traceEVENT_OBJECT_CREATE, ucType, uxObject );
+
+	return uxObject;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderObjectDelete( uint8_t ucEvent, uint8_t ucType, UBaseType_t uxObject )
+{
+UBaseType_t uxIndex, uxSavedInterruptStatus;
+TraceRecorderName_t *pxName;
+
+	vTraceRecorderEvent( ucEvent, 0, uxObject );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		for( uxIndex = 0; uxIndex < ( UBaseType_t ) configTRACE_RECORDER_NAMES; uxIndex++ )
+		{
+			pxName = &( xTraceRecorderBuffer.xNames[ uxIndex ] );
+
+			if( prvNameMatches( pxName, ucType, uxObject ) != pdFALSE )
+			{
+				/* Keep the name, as events that refer to it may still be in
+				the buffer, but allow the record to be reused. */
+				pxName->ucFlags |= traceNAME_FLAG_DELETED;
+				break;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderSetObjectName( UBaseType_t uxObject, const char *pcName )
+{
+TraceRecorderName_t *pxName;
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		/* Any type other than a task or an interrupt finds the object. */
+		pxName = prvGetName( traceTYPE_QUEUE, uxObject );
+
+		if( pxName != NULL )
+		{
+			prvCopyName( pxName, pcName );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderSetISRName( UBaseType_t uxISRNumber, const char *pcName )
+{
+TraceRecorderName_t *pxName;
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		pxName = prvGetName( traceTYPE_ISR, uxISRNumber );
+
+		if( pxName != NULL )
+		{
+			prvCopyName( pxName, pcName );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStart( void )
+{
+	xTraceRecorderBuffer.xHeader.ulEnabled = 1UL;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderStop( void )
+{
+	xTraceRecorderBuffer.xHeader.ulEnabled = 0UL;
+}
+/*-----------------------------------------------------------*/
+
+void vTraceRecorderClear( void )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		xTraceRecorderBuffer.xHeader.ulEventsWritten = 0UL;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+const TraceRecorderBuffer_t *pxTraceRecorderGetBuffer( size_t *pxBufferSize )
+{
+	if( pxBufferSize != NULL )
+	{
+		*pxBufferSize = sizeof( xTraceRecorderBuffer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return &xTraceRecorderBuffer;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvNameMatches( const TraceRecorderName_t *pxName, uint8_t ucType, UBaseType_t uxObject )
+{
+BaseType_t xReturn = pdFALSE;
+BaseType_t xIsTask, xIsISR;
+
+	if( ( ( pxName->ucFlags & traceNAME_FLAG_USED ) != 0U ) && ( ( pxName->ucFlags & traceNAME_FLAG_DELETED ) == 0U ) && ( pxName->usObject == ( uint16_t ) uxObject ) )
+	{
+		xIsTask = ( ucType == traceTYPE_TASK ) ? pdTRUE : pdFALSE;
+		xIsISR = ( ucType == traceTYPE_ISR ) ? pdTRUE : pdFALSE;
+
+		if( ( xIsTask == ( ( pxName->ucType == traceTYPE_TASK ) ? pdTRUE : pdFALSE ) ) &&
+			( xIsISR == ( ( pxName->ucType == traceTYPE_ISR ) ? pdTRUE : pdFALSE ) ) )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static TraceRecorderName_t *prvGetName( uint8_t ucType, UBaseType_t uxObject )
+{
+UBaseType_t uxIndex;
+TraceRecorderName_t *pxName, *pxFound = NULL, *pxUnused = NULL, *pxDeleted = NULL;
+
+	for( uxIndex = 0; uxIndex < ( UBaseType_t ) configTRACE_RECORDER_NAMES; uxIndex++ )
+	{
+		pxName = &( xTraceRecorderBuffer.xNames[ uxIndex ] );
+
+		if( prvNameMatches( pxName, ucType, uxObject ) != pdFALSE )
+		{
+			pxFound = pxName;
+			break;
+		}
+		else if( ( ( pxName->ucFlags & traceNAME_FLAG_USED ) == 0U ) && ( pxUnused == NULL ) )
+		{
+			pxUnused = pxName;
+		}
+		else if( ( ( pxName->ucFlags & traceNAME_FLAG_DELETED ) != 0U ) && ( pxDeleted == NULL ) )
+		{
+			pxDeleted = pxName;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	if( pxFound == NULL )
+	{
+		pxFound = ( pxUnused != NULL ) ? pxUnused : pxDeleted;
+
+		if( pxFound != NULL )
+		{
+			pxFound->usObject = ( uint16_t ) uxObject;
+			pxFound->ucType = ucType;
+			pxFound->ucFlags = traceNAME_FLAG_USED;
+			memset( ( void * ) pxFound->cName, 0x00, sizeof( pxFound->cName ) );
+		}
+		else
+		{
+			( xTraceRecorderBuffer.xHeader.ulNamesDropped )++;
+		}
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pxFound;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyName( TraceRecorderName_t *pxName, const char *pcName )
+{
+UBaseType_t x;
+
+	for( x = 0; x < ( UBaseType_t ) traceRECORDER_NAME_LENGTH; x++ )
+	{
+		pxName->cName[ x ] = pcName[ x ];
+
+		if( pcName[ x ] == 0x00 )
+		{
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include the trace recorder.  If you want to include the trace recorder then
+ensure configUSE_TRACE_RECORDER is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TRACE_RECORDER */
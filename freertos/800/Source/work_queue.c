@@ -0,0 +1,484 @@
+/*
+    FreeRTOS V8.0.0 - Copyright (C) 2014 Real Time Engineers Ltd.
+    All rights reserved
+
+    VISIT http://www.FreeRTOS.org TO ENSURE YOU ARE USING THE LATEST VERSION.
+
+    ***************************************************************************
+     *                                                                       *
+     *    FreeRTOS provides completely free yet professionally developed,    *
+     *    robust, strictly quality controlled, supported, and cross          *
+     *    platform software that has become a de facto standard.             *
+     *                                                                       *
+     *    Help yourself get started quickly and support the FreeRTOS         *
+     *    project by purchasing a FreeRTOS tutorial book, reference          *
+     *    manual, or both from: http://www.FreeRTOS.org/Documentation        *
+     *                                                                       *
+     *    Thank you!                                                         *
+     *                                                                       *
+    ***************************************************************************
+
+    This file is part of the FreeRTOS distribution.
+
+    FreeRTOS is free software; you can redistribute it and/or modify it under
+    the terms of the GNU General Public License (version 2) as published by the
+    Free Software Foundation >>!AND MODIFIED BY!<< the FreeRTOS exception.
+
+    >>! NOTE: The modification to the GPL is included to allow you to distribute
+    >>! a combined work that includes FreeRTOS without being obliged to provide
+    >>! the source code for proprietary components outside of the FreeRTOS
+    >>! kernel.
+
+    FreeRTOS is distributed in the hope that it will be useful, but WITHOUT ANY
+    WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+    FOR A PARTICULAR PURPOSE.  Full license text is available from the following
+    link: http://www.freertos.org/a00114.html
+
+    1 tab == 4 spaces!
+
+    ***************************************************************************
+     *                                                                       *
+     *    Having a problem?  Start by reading the FAQ "My application does   *
+     *    not run, what could be wrong?"                                     *
+     *                                                                       *
+     *    http://www.FreeRTOS.org/FAQHelp.html                               *
+     *                                                                       *
+    ***************************************************************************
+
+    http://www.FreeRTOS.org - Documentation, books, training, latest versions,
+    license and Real Time Engineers Ltd. contact details.
+
+    http://www.FreeRTOS.org/plus - A selection of FreeRTOS ecosystem products,
+    including FreeRTOS+Trace - an indispensable productivity tool, a DOS
+    compatible FAT file system, and our tiny thread aware UDP/IP stack.
+
+    http://www.OpenRTOS.com - Real Time Engineers ltd license FreeRTOS to High
+    Integrity Systems to sell under the OpenRTOS brand.  Low cost OpenRTOS
+    licenses offer ticketed support, indemnification and middleware.
+
+    http://www.SafeRTOS.com - High Integrity Systems also provide a safety
+    engineered and independently SIL3 certified version for use in safety and
+    mission critical applications that require provable dependability.
+
+    1 tab == 4 spaces!
+*/
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+#include "ring_queue.h"
+#include "work_queue.h"
+
+/* Lint e961 and e750 are suppressed as a MISRA exception justified because the
+MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined for the
+header files above, but not in this file, in order to generate the correct
+privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE /*lint !e961 !e750. */
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+	#error work_queue.c creates its ring queues and worker tasks dynamically, so configSUPPORT_DYNAMIC_ALLOCATION must be 1
+#endif
+
+#if( configUSE_TASK_NOTIFICATIONS != 1 )
+	#error The workers wait for work using their direct to task notifications, so configUSE_TASK_NOTIFICATIONS must be 1 to build work_queue.c
+#endif
+
+/* The name given to the worker tasks. */
+#define wqWORKER_NAME		"Worker"
+
+/*
+ * The item written to a worker's ring queue for each function submitted.
+ */
+typedef struct xWORK_ITEM
+{
+	PendedFunction_t pxFunction;
+	void *pvParameter1;
+	uint32_t ulParameter2;
+
+	#ifdef configWORK_QUEUE_TIMESTAMP
+		uint32_t ulSubmitTime;	/*< configWORK_QUEUE_TIMESTAMP() when the item was submitted. */
+	#endif
+} WorkItem_t;
+
+/*
+ * A worker.  The statistics, other than uxSubmitFailures, are only updated by
+ * the worker itself.
+ */
+typedef struct xWORKER
+{
+	RingQueueHandle_t xRingQueue;
+	TaskHandle_t xTask;
+	WorkQueueStats_t xStats;
+} Worker_t;
+
+/*
+ * A work queue is a count of workers followed by the workers themselves,
+ * allocated in one block.
+ */
+typedef struct xWORK_QUEUE
+{
+	UBaseType_t uxWorkers;
+	Worker_t *pxWorkers;
+} WorkQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The worker task.  Waits for work and runs it in batches of up to
+ * configWORK_QUEUE_BATCH_SIZE items.
+ */
+static void prvWorkerTask( void *pvParameters );
+
+/*
+ * Fill out a work item for submission to a worker.
+ */
+static void prvInitialiseWorkItem( WorkItem_t * const pxItem, PendedFunction_t xFunction, void *pvParameter1, uint32_t ulParameter2 );
+
+/*
+ * Count an item that could not be submitted.  Can be called by any number of
+ * tasks and interrupts at once.
+ */
+static void prvCountSubmitFailure( Worker_t * const pxWorker );
+
+/*
+ * Run one item and update the worker's statistics.
+ */
+static void prvRunWorkItem( Worker_t * const pxWorker, const WorkItem_t * const pxItem );
+
+/*-----------------------------------------------------------*/
+
+WorkQueueHandle_t xWorkQueueCreate( UBaseType_t uxWorkers, const UBaseType_t * const puxPriorities, UBaseType_t uxLength, uint16_t usStackDepth )
+{
+WorkQueue_t *pxWorkQueue;
+Worker_t *pxWorker;
+UBaseType_t uxWorker;
+BaseType_t xCreated = pdPASS;
+
+	configASSERT( uxWorkers > ( UBaseType_t ) 0 );
+	configASSERT( puxPriorities );
+
+	/* The workers are allocated in the same block as the structure.  The size
+	of the structure is a multiple of the alignment of a pointer, so the
+	workers that follow it are correctly aligned. */
+	pxWorkQueue = ( WorkQueue_t * ) pvPortMalloc( sizeof( WorkQueue_t ) + ( ( size_t ) uxWorkers * sizeof( Worker_t ) ) ); /*lint !e9087 !e9079 Storage is allocated for the structure and the workers in one block. */
+
+	if( pxWorkQueue != NULL )
+	{
+		pxWorkQueue->uxWorkers = uxWorkers;
+		pxWorkQueue->pxWorkers = ( Worker_t * ) ( pxWorkQueue + 1 ); /*lint !e9087 The workers follow the structure. */
+
+		/* Create every ring queue before any worker, as a worker can start to
+		run as soon as it is created. */
+		for( uxWorker = 0; uxWorker < uxWorkers; uxWorker++ )
+		{
+			pxWorker = &( pxWorkQueue->pxWorkers[ uxWorker ] );
+			( void ) memset( ( void * ) &( pxWorker->xStats ), 0x00, sizeof( pxWorker->xStats ) );
+
+			#ifdef configWORK_QUEUE_TIMESTAMP
+			{
+				pxWorker->xStats.ulMinLatency = UINT32_MAX;
+			}
+			#endif
+
+			pxWorker->xTask = NULL;
+			pxWorker->xRingQueue = xRingQueueCreateMultiProducer( uxLength, sizeof( WorkItem_t ) );
+
+			if( pxWorker->xRingQueue == NULL )
+			{
+				xCreated = pdFAIL;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		/* No worker runs until every worker has been created, so if one cannot
+		be created the others can be deleted before they wait on their ring
+		queues. */
+		vTaskSuspendAll();
+
+		for( uxWorker = 0; ( uxWorker < uxWorkers ) && ( xCreated != pdFAIL ); uxWorker++ )
+		{
+			pxWorker = &( pxWorkQueue->pxWorkers[ uxWorker ] );
+			xCreated = xTaskCreate( prvWorkerTask, wqWORKER_NAME, usStackDepth, ( void * ) pxWorker, puxPriorities[ uxWorker ], &( pxWorker->xTask ) );
+		}
+
+		if( xCreated == pdFAIL )
+		{
+			/* Free whatever was created.  No work can have been submitted, as
+			the handle has not been returned. */
+			for( uxWorker = 0; uxWorker < uxWorkers; uxWorker++ )
+			{
+				pxWorker = &( pxWorkQueue->pxWorkers[ uxWorker ] );
+
+				#if( INCLUDE_vTaskDelete == 1 )
+				{
+					if( pxWorker->xTask != NULL )
+					{
+						vTaskDelete( pxWorker->xTask );
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#else
+				{
+					/* The worker cannot be deleted again. */
+					configASSERT( pxWorker->xTask == NULL );
+				}
+				#endif
+
+				if( pxWorker->xRingQueue != NULL )
+				{
+					vRingQueueDelete( pxWorker->xRingQueue );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			vPortFree( ( void * ) pxWorkQueue );
+			pxWorkQueue = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		( void ) xTaskResumeAll();
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return ( WorkQueueHandle_t ) pxWorkQueue;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xWorkQueueSubmit( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker, PendedFunction_t xFunction, void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkQueue_t * const pxWorkQueue = ( WorkQueue_t * ) xWorkQueue;
+Worker_t *pxWorker;
+WorkItem_t xItem;
+BaseType_t xReturn;
+
+	configASSERT( pxWorkQueue );
+	configASSERT( uxWorker < pxWorkQueue->uxWorkers );
+	configASSERT( xFunction );
+
+	pxWorker = &( pxWorkQueue->pxWorkers[ uxWorker ] );
+	prvInitialiseWorkItem( &xItem, xFunction, pvParameter1, ulParameter2 );
+	xReturn = xRingQueueSend( pxWorker->xRingQueue, &xItem );
+
+	if( xReturn != pdPASS )
+	{
+		prvCountSubmitFailure( pxWorker );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xWorkQueueSubmitFromISR( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker, PendedFunction_t xFunction, void *pvParameter1, uint32_t ulParameter2, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+WorkQueue_t * const pxWorkQueue = ( WorkQueue_t * ) xWorkQueue;
+Worker_t *pxWorker;
+WorkItem_t xItem;
+BaseType_t xReturn;
+
+	configASSERT( pxWorkQueue );
+	configASSERT( uxWorker < pxWorkQueue->uxWorkers );
+	configASSERT( xFunction );
+
+	pxWorker = &( pxWorkQueue->pxWorkers[ uxWorker ] );
+	prvInitialiseWorkItem( &xItem, xFunction, pvParameter1, ulParameter2 );
+	xReturn = xRingQueueSendFromISR( pxWorker->xRingQueue, &xItem, pxHigherPriorityTaskWoken );
+
+	if( xReturn != pdPASS )
+	{
+		prvCountSubmitFailure( pxWorker );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vWorkQueueGetStats( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker, WorkQueueStats_t * const pxStats )
+{
+WorkQueue_t * const pxWorkQueue = ( WorkQueue_t * ) xWorkQueue;
+Worker_t *pxWorker;
+
+	configASSERT( pxWorkQueue );
+	configASSERT( uxWorker < pxWorkQueue->uxWorkers );
+	configASSERT( pxStats );
+
+	pxWorker = &( pxWorkQueue->pxWorkers[ uxWorker ] );
+
+	/* The worker cannot run while the statistics are copied, though it may
+	have been preempted part way through updating them. */
+	vTaskSuspendAll();
+	{
+		*pxStats = pxWorker->xStats;
+	}
+	( void ) xTaskResumeAll();
+
+	pxStats->uxWaiting = uxRingQueueMessagesWaiting( pxWorker->xRingQueue );
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xWorkQueueGetWorkerHandle( WorkQueueHandle_t xWorkQueue, UBaseType_t uxWorker )
+{
+WorkQueue_t * const pxWorkQueue = ( WorkQueue_t * ) xWorkQueue;
+
+	configASSERT( pxWorkQueue );
+	configASSERT( uxWorker < pxWorkQueue->uxWorkers );
+
+	return pxWorkQueue->pxWorkers[ uxWorker ].xTask;
+}
+/*-----------------------------------------------------------*/
+
+static void prvInitialiseWorkItem( WorkItem_t * const pxItem, PendedFunction_t xFunction, void *pvParameter1, uint32_t ulParameter2 )
+{
+	pxItem->pxFunction = xFunction;
+	pxItem->pvParameter1 = pvParameter1;
+	pxItem->ulParameter2 = ulParameter2;
+
+	#ifdef configWORK_QUEUE_TIMESTAMP
+	{
+		pxItem->ulSubmitTime = configWORK_QUEUE_TIMESTAMP();
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+static void prvCountSubmitFailure( Worker_t * const pxWorker )
+{
+UBaseType_t uxFailures;
+
+	/* Producers can be interrupted by other producers, so the count is
+	incremented with a compare and swap rather than a critical section. */
+	do
+	{
+		uxFailures = pxWorker->xStats.uxSubmitFailures;
+	} while( portCOMPARE_AND_SWAP( &( pxWorker->xStats.uxSubmitFailures ), uxFailures, uxFailures + ( UBaseType_t ) 1 ) == pdFALSE );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRunWorkItem( Worker_t * const pxWorker, const WorkItem_t * const pxItem )
+{
+	#ifdef configWORK_QUEUE_TIMESTAMP
+	{
+	WorkQueueStats_t * const pxStats = &( pxWorker->xStats );
+	const uint32_t ulLatency = configWORK_QUEUE_TIMESTAMP() - pxItem->ulSubmitTime;
+	UBaseType_t uxBucket = 0;
+	uint32_t ulLimit = 1UL;
+
+		if( ulLatency < pxStats->ulMinLatency )
+		{
+			pxStats->ulMinLatency = ulLatency;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ulLatency > pxStats->ulMaxLatency )
+		{
+			pxStats->ulMaxLatency = ulLatency;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		pxStats->ullTotalLatency += ( uint64_t ) ulLatency;
+
+		/* Find the first power of two above the latency. */
+		while( ( uxBucket < ( UBaseType_t ) ( configWORK_QUEUE_LATENCY_BUCKETS - 1 ) ) && ( ulLatency >= ulLimit ) )
+		{
+			uxBucket++;
+			ulLimit <<= 1UL;
+		}
+
+		( pxStats->ulLatencyHistogram[ uxBucket ] )++;
+	}
+	#endif /* configWORK_QUEUE_TIMESTAMP */
+
+	pxItem->pxFunction( pxItem->pvParameter1, pxItem->ulParameter2 );
+	( pxWorker->xStats.ulItemsRun )++;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWorkerTask( void *pvParameters )
+{
+Worker_t * const pxWorker = ( Worker_t * ) pvParameters;
+WorkItem_t xItem;
+UBaseType_t uxWaiting, uxBatch;
+
+	for( ;; )
+	{
+		/* Wait for work. */
+		if( xRingQueueReceive( pxWorker->xRingQueue, &xItem, portMAX_DELAY ) == pdPASS )
+		{
+			/* Including the item just received. */
+			uxWaiting = uxRingQueueMessagesWaiting( pxWorker->xRingQueue ) + ( UBaseType_t ) 1;
+
+			if( uxWaiting > pxWorker->xStats.uxMaxWaiting )
+			{
+				pxWorker->xStats.uxMaxWaiting = uxWaiting;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* Run the rest of the batch without blocking. */
+			uxBatch = 0;
+
+			do
+			{
+				prvRunWorkItem( pxWorker, &xItem );
+				uxBatch++;
+			} while( ( uxBatch < ( UBaseType_t ) configWORK_QUEUE_BATCH_SIZE ) && ( xRingQueueReceive( pxWorker->xRingQueue, &xItem, ( TickType_t ) 0 ) == pdPASS ) );
+
+			( pxWorker->xStats.ulBatches )++;
+
+			if( uxBatch == ( UBaseType_t ) configWORK_QUEUE_BATCH_SIZE )
+			{
+				/* There may be more work, but let the other tasks of the same
+				priority run first. */
+				taskYIELD();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/